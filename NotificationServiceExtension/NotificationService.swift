@@ -25,6 +25,13 @@ class NotificationService: UNNotificationServiceExtension {
     }
 
     func completeSilenty() {
+        // File logs are buffered, and the process may be suspended or
+        // terminated as soon as we complete.
+        Logger.flush()
+        // We may complete early, e.g. if we run out of memory, and
+        // should only call the content handler once.
+        let contentHandler = self.contentHandler
+        self.contentHandler = nil
         contentHandler?(.init())
     }
 
@@ -92,9 +99,16 @@ class NotificationService: UNNotificationServiceExtension {
 
         hasSetup = true
 
+        let setupStartedAt = CACurrentMediaTime()
+        self.setupStartedAt = setupStartedAt
+
         // This should be the first thing we do.
         SetCurrentAppContext(NotificationServiceExtensionContext())
 
+        // Time the phases of the cold start, e.g. storage open and
+        // migrations; they are logged once the NSE is ready.
+        LaunchTimer.shared.launchDidStart(at: setupStartedAt)
+
         DebugLogger.shared().enableTTYLogging()
         if _isDebugAssertConfiguration() {
             DebugLogger.shared().enableFileLogging()
@@ -130,6 +144,14 @@ class NotificationService: UNNotificationServiceExtension {
                                                selector: #selector(storageIsReady),
                                                name: .StorageIsReady,
                                                object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(messageProcessingDidPauseForMemory),
+                                               name: .messageProcessingDidPauseForMemory,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(messageProcessingLeaseDidChange),
+                                               name: MessageProcessingLease.leaseDidChange,
+                                               object: nil)
 
         Logger.info("completed.")
 
@@ -172,6 +194,37 @@ class NotificationService: UNNotificationServiceExtension {
         AppVersion.shared().nseLaunchDidComplete()
     }
 
+    // Message processing stops if we're about to run out of memory, leaving
+    // the remaining messages for the main app (or our next launch), so
+    // there's no point in waiting for it to finish.
+    @objc
+    func messageProcessingDidPauseForMemory() {
+        AssertIsOnMainThread()
+
+        guard isProcessingMessages.get() else { return }
+
+        Logger.warn("Message processing paused for memory; peak memory footprint: \(peakFootprintDescription).")
+
+        isProcessingMessages.set(false)
+        logColdStartIfNecessary()
+        completeSilenty()
+    }
+
+    // If another process, i.e. the main app, preempts our message processing
+    // lease, it will process the rest of the backlog.
+    @objc
+    func messageProcessingLeaseDidChange() {
+        AssertIsOnMainThread()
+
+        guard isProcessingMessages.get(), !MessageProcessingLease.shared.isHeld else { return }
+
+        Logger.info("Another process took over message processing.")
+
+        isProcessingMessages.set(false)
+        logColdStartIfNecessary()
+        completeSilenty()
+    }
+
     func askMainAppToHandleReceipt(handledCallback: @escaping (_ mainAppHandledReceipt: Bool) -> Void) {
         DispatchQueue.main.async {
             // We track whether we've ever handled the call back to ensure
@@ -239,6 +292,32 @@ class NotificationService: UNNotificationServiceExtension {
 
     private let isProcessingMessages = AtomicBool(false)
 
+    // The 24 MB memory limit of the NSE is tight, so we log how long it
+    // takes to set up and process the first notification of each process,
+    // and how much memory that takes at peak.
+    private var setupStartedAt: CFTimeInterval?
+    private var hasLoggedColdStart = false
+
+    private var peakFootprintDescription: String {
+        guard let peakFootprint = MemoryAccountant.peakPhysicalMemoryFootprint() else {
+            return "unknown"
+        }
+        return MemoryAccountant.Snapshot.format(byteCount: Int(peakFootprint))
+    }
+
+    private func logColdStartIfNecessary() {
+        AssertIsOnMainThread()
+
+        guard !hasLoggedColdStart, let setupStartedAt = setupStartedAt else {
+            return
+        }
+        hasLoggedColdStart = true
+
+        let duration = CACurrentMediaTime() - setupStartedAt
+        Logger.info(String(format: "Cold start: first notification handled in %0.0fms, ", duration * 1000)
+                        + "peak memory footprint: \(peakFootprintDescription).")
+    }
+
     func fetchAndProcessMessages() {
         AssertIsOnMainThread()
 
@@ -256,6 +335,7 @@ class NotificationService: UNNotificationServiceExtension {
         }.ensure {
             Logger.info("Message fetch completed.")
             self.isProcessingMessages.set(false)
+            self.logColdStartIfNecessary()
             self.completeSilenty()
         }.catch { error in
             Logger.warn("Error: \(error)")
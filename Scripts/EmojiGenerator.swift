@@ -204,33 +204,6 @@ class EmojiGenerator {
             fileHandle.writeLine("}")
         }
 
-        // Conversion from String
-        writeBlock(fileName: "EmojiWithSkinTones+String.swift") { fileHandle in
-            fileHandle.writeLine("extension EmojiWithSkinTones {")
-
-            fileHandle.writeLine("    init?(rawValue: String) {")
-            fileHandle.writeLine("        guard rawValue.isSingleEmoji else { return nil }")
-            fileHandle.writeLine("        switch rawValue {")
-
-            for emojiData in sortedEmojiData {
-                fileHandle.writeLine("        case \"\(emojiData.emoji)\": self.init(baseEmoji: .\(emojiData.enumName), skinTones: nil)")
-
-                if let sortedEmojiPerSkinTone = emojiData.sortedEmojiPerSkinTone {
-                    for (skinTones, emoji) in sortedEmojiPerSkinTone {
-                        fileHandle.writeLine("        case \"\(emoji)\": self.init(baseEmoji: .\(emojiData.enumName), skinTones: [\(skinTones.map { ".\($0)" }.joined(separator: ", "))])")
-                    }
-                }
-            }
-
-            fileHandle.writeLine("        default: return nil")
-
-            fileHandle.writeLine("        }")
-
-            fileHandle.writeLine("    }")
-
-            fileHandle.writeLine("}")
-        }
-
         // Skin tones lookup
         writeBlock(fileName: "Emoji+SkinTones.swift") { fileHandle in
             fileHandle.writeLine("extension Emoji {")
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Generates SignalServiceKit/src/Util/MIMETypeTables.{h,m} from Scripts/mime_types.txt.
+#
+# Each table is compiled into a minimal perfect hash ("hash and displace"):
+# the first-level hash of a key selects a seed, and the key hashed with that
+# seed selects its slot. Lookups hash the key twice and compare it against
+# the one candidate entry, without allocating or bridging.
+
+import os
+import sys
+import subprocess
+
+
+git_repo_path = os.path.abspath(subprocess.check_output(['git', 'rev-parse', '--show-toplevel']).strip().decode('utf-8'))
+src_file_path = os.path.join(git_repo_path, 'Scripts', 'mime_types.txt')
+dst_dir_path = os.path.join(git_repo_path, 'SignalServiceKit', 'src', 'Util')
+
+FNV_PRIME = 0x01000193
+
+
+def fail(message):
+    print(message)
+    sys.exit(1)
+
+
+# Must match OWSMIMETypeTableHash() below.
+def table_hash(seed, key):
+    value = seed if seed != 0 else FNV_PRIME
+    for byte in key.encode('utf-8'):
+        value = ((value * FNV_PRIME) ^ byte) & 0xffffffff
+    return value
+
+
+def parse_tables():
+    tables = []
+    with open(src_file_path, 'r', encoding='utf-8') as f:
+        for line_number, line in enumerate(f, start=1):
+            line = line.strip()
+            if len(line) == 0 or line.startswith('#'):
+                continue
+            if line.startswith('[') and line.endswith(']'):
+                tables.append((line[1:-1], []))
+                continue
+            if len(tables) == 0:
+                fail('%d: entry before the first table' % line_number)
+            components = line.split()
+            if len(components) != 2:
+                fail('%d: malformed entry: %s' % (line_number, line))
+            key, value = components
+            table_name, entries = tables[-1]
+            if key in [entry[0] for entry in entries]:
+                fail('%d: duplicate key in %s: %s' % (line_number, table_name, key))
+            entries.append((key, value))
+    return tables
+
+
+def build_perfect_hash(entries):
+    count = len(entries)
+    buckets = [[] for _ in range(count)]
+    for entry in entries:
+        buckets[table_hash(0, entry[0]) % count].append(entry)
+    buckets.sort(key=len, reverse=True)
+
+    seeds = [0] * count
+    slots = [None] * count
+
+    bucket_index = 0
+    while bucket_index < count and len(buckets[bucket_index]) > 1:
+        bucket = buckets[bucket_index]
+        seed = 1
+        item = 0
+        bucket_slots = []
+        while item < len(bucket):
+            slot = table_hash(seed, bucket[item][0]) % count
+            if slots[slot] is not None or slot in bucket_slots:
+                seed += 1
+                item = 0
+                bucket_slots = []
+            else:
+                bucket_slots.append(slot)
+                item += 1
+        if seed > 0x7fffffff:
+            fail('Could not find a seed.')
+        seeds[table_hash(0, bucket[0][0]) % count] = seed
+        for slot, entry in zip(bucket_slots, bucket):
+            slots[slot] = entry
+        bucket_index += 1
+
+    # Buckets with a single key place it directly in a free slot,
+    # encoded as a negative seed.
+    free_slots = [slot for slot in range(count) if slots[slot] is None]
+    while bucket_index < count and len(buckets[bucket_index]) == 1:
+        entry = buckets[bucket_index][0]
+        slot = free_slots.pop()
+        seeds[table_hash(0, entry[0]) % count] = -slot - 1
+        slots[slot] = entry
+        bucket_index += 1
+
+    return seeds, slots
+
+
+def lookup(seeds, slots, key):
+    seed = seeds[table_hash(0, key) % len(seeds)]
+    if seed < 0:
+        slot = -seed - 1
+    else:
+        slot = table_hash(seed, key) % len(seeds)
+    entry = slots[slot]
+    return entry[1] if entry[0] == key else None
+
+
+def objc_string(value):
+    return '"%s"' % value.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def write_file(filename, lines):
+    with open(os.path.join(dst_dir_path, filename), 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def license_header():
+    return [
+        '//',
+        '//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.',
+        '//',
+        '',
+        '// This file is generated by mime_type_tables.py, do not manually edit it.',
+        '',
+    ]
+
+
+if __name__ == '__main__':
+    tables = parse_tables()
+
+    max_key_length = 0
+    compiled_tables = []
+    for table_name, entries in tables:
+        if len(entries) == 0:
+            fail('Empty table: %s' % table_name)
+        seeds, slots = build_perfect_hash(entries)
+        for key, value in entries:
+            if lookup(seeds, slots, key) != value:
+                fail('Lookup failed in %s: %s' % (table_name, key))
+            max_key_length = max(max_key_length, len(key.encode('utf-8')))
+        compiled_tables.append((table_name, seeds, slots))
+
+    header = license_header()
+    header += [
+        'NS_ASSUME_NONNULL_BEGIN',
+        '',
+        'typedef NS_ENUM(NSUInteger, OWSMIMETypeTable) {',
+    ]
+    for table_name, _, _ in compiled_tables:
+        header.append('    OWSMIMETypeTable%s,' % table_name)
+    header += [
+        '};',
+        '',
+        '// Returns the value for `key`, or nil if the table doesn\'t contain it.',
+        '//',
+        '// The tables are static, so lookups don\'t allocate.',
+        'NSString *_Nullable OWSMIMETypeTableLookup(OWSMIMETypeTable table, NSString *key);',
+        '',
+        'NSArray<NSString *> *OWSMIMETypeTableAllKeys(OWSMIMETypeTable table);',
+        '',
+        'NS_ASSUME_NONNULL_END',
+    ]
+    write_file('MIMETypeTables.h', header)
+
+    source = license_header()
+    source += [
+        '#import "MIMETypeTables.h"',
+        '',
+        'NS_ASSUME_NONNULL_BEGIN',
+        '',
+        'typedef struct {',
+        '    const char *key;',
+        '    __unsafe_unretained NSString *value;',
+        '} OWSMIMETypeTableEntry;',
+        '',
+        'typedef struct {',
+        '    const int32_t *seeds;',
+        '    const OWSMIMETypeTableEntry *entries;',
+        '    uint32_t count;',
+        '} OWSMIMETypeTableDescriptor;',
+        '',
+        'static const size_t kOWSMIMETypeTableMaxKeyLength = %d;' % max_key_length,
+    ]
+    for table_name, seeds, slots in compiled_tables:
+        source += [
+            '',
+            '#pragma mark - %s' % table_name,
+            '',
+            'static const int32_t k%sSeeds[%d] = {' % (table_name, len(seeds)),
+        ]
+        for index in range(0, len(seeds), 10):
+            source.append('    ' + ', '.join(str(seed) for seed in seeds[index:index + 10]) + ',')
+        source += [
+            '};',
+            '',
+            'static const OWSMIMETypeTableEntry k%sEntries[%d] = {' % (table_name, len(slots)),
+        ]
+        for key, value in slots:
+            source.append('    { %s, @%s },' % (objc_string(key), objc_string(value)))
+        source.append('};')
+    source += [
+        '',
+        '#pragma mark -',
+        '',
+        'static const OWSMIMETypeTableDescriptor kOWSMIMETypeTables[] = {',
+    ]
+    for table_name, seeds, _ in compiled_tables:
+        source.append('    [OWSMIMETypeTable%s] = { k%sSeeds, k%sEntries, %d },' % (table_name, table_name, table_name, len(seeds)))
+    source += [
+        '};',
+        '',
+        'static uint32_t OWSMIMETypeTableHash(uint32_t seed, const char *key)',
+        '{',
+        '    uint32_t hash = (seed != 0 ? seed : 0x%08x);' % FNV_PRIME,
+        '    for (const char *c = key; *c != \'\\0\'; c++) {',
+        '        hash = (hash * 0x%08x) ^ (uint8_t)*c;' % FNV_PRIME,
+        '    }',
+        '    return hash;',
+        '}',
+        '',
+        'NSString *_Nullable OWSMIMETypeTableLookup(OWSMIMETypeTable table, NSString *key)',
+        '{',
+        '    if (table >= sizeof(kOWSMIMETypeTables) / sizeof(kOWSMIMETypeTables[0])) {',
+        '        OWSCFailDebug(@"Unknown table: %lu", (unsigned long)table);',
+        '        return nil;',
+        '    }',
+        '    const OWSMIMETypeTableDescriptor *descriptor = &kOWSMIMETypeTables[table];',
+        '',
+        '    // Keys longer than the longest key in any table cannot match.',
+        '    char buffer[kOWSMIMETypeTableMaxKeyLength + 1];',
+        '    if (![key getCString:buffer maxLength:sizeof(buffer) encoding:NSUTF8StringEncoding]) {',
+        '        return nil;',
+        '    }',
+        '',
+        '    int32_t seed = descriptor->seeds[OWSMIMETypeTableHash(0, buffer) % descriptor->count];',
+        '    uint32_t slot',
+        '        = (seed < 0 ? (uint32_t)(-seed - 1) : OWSMIMETypeTableHash((uint32_t)seed, buffer) % descriptor->count);',
+        '    const OWSMIMETypeTableEntry *entry = &descriptor->entries[slot];',
+        '    if (strcmp(entry->key, buffer) != 0) {',
+        '        return nil;',
+        '    }',
+        '    return entry->value;',
+        '}',
+        '',
+        'NSArray<NSString *> *OWSMIMETypeTableAllKeys(OWSMIMETypeTable table)',
+        '{',
+        '    if (table >= sizeof(kOWSMIMETypeTables) / sizeof(kOWSMIMETypeTables[0])) {',
+        '        OWSCFailDebug(@"Unknown table: %lu", (unsigned long)table);',
+        '        return @[];',
+        '    }',
+        '    const OWSMIMETypeTableDescriptor *descriptor = &kOWSMIMETypeTables[table];',
+        '',
+        '    NSMutableArray<NSString *> *keys = [NSMutableArray arrayWithCapacity:descriptor->count];',
+        '    for (uint32_t i = 0; i < descriptor->count; i++) {',
+        '        [keys addObject:@(descriptor->entries[i].key)];',
+        '    }',
+        '    return [keys copy];',
+        '}',
+        '',
+        'NS_ASSUME_NONNULL_END',
+    ]
+    write_file('MIMETypeTables.m', source)
@@ -128,6 +128,9 @@ void uncaughtExceptionHandler(NSException *exception)
 
     [SignalApp.sharedApp applicationWillTerminate];
 
+    // Let the NSE take over message processing without waiting for the lease to expire.
+    [MessageProcessingLease.shared stop];
+
     [DDLog flushLog];
 }
 
@@ -140,6 +143,7 @@ void uncaughtExceptionHandler(NSException *exception)
     SetCurrentAppContext([MainAppContext new]);
 
     launchStartedAt = CACurrentMediaTime();
+    [LaunchTimer.shared launchDidStartAt:launchStartedAt];
 
     BOOL isLoggingEnabled;
 #ifdef DEBUG
@@ -225,6 +229,8 @@ void uncaughtExceptionHandler(NSException *exception)
         return YES;
     }
 
+    [MainThreadHangMonitor.shared start];
+
     [AppSetup
         setupEnvironmentWithAppSpecificSingletonBlock:^{
             // Create AppEnvironment.
@@ -1081,6 +1087,7 @@ void uncaughtExceptionHandler(NSException *exception)
         // Only mark the app as ready once.
         return;
     }
+    [LaunchTimer.shared beginPhase:LaunchPhaseLaunchJobs];
     BOOL launchJobsAreComplete = [self.launchJobs ensureLaunchJobsWithCompletion:^{
         // If launch jobs need to run, return and
         // call checkIfAppIsReady again when they're complete.
@@ -1090,6 +1097,7 @@ void uncaughtExceptionHandler(NSException *exception)
         // Wait for launch jobs to complete.
         return;
     }
+    [LaunchTimer.shared endPhase:LaunchPhaseLaunchJobs];
 
     OWSLogInfo(@"checkIfAppIsReady");
 
@@ -1150,7 +1158,7 @@ void uncaughtExceptionHandler(NSException *exception)
     // TODO: Orphan cleanup is somewhat expensive - not least in doing a bunch
     //       of disk access.  We might want to only run it "once per version"
     //       or something like that in production.
-    [OWSOrphanDataCleaner auditOnLaunchIfNecessary];
+    [AppReadiness runNowOrWhenAppDidBecomeReadyIdle:^{ [OWSOrphanDataCleaner auditOnLaunchIfNecessary]; }];
 #endif
 
     [self.profileManager fetchLocalUsersProfile];
@@ -38,6 +38,27 @@ class GroupCallRemoteVideoManager {
         videoViews[demuxId] = nil
     }
 
+    /// Re-evaluates which remote video views are on screen, e.g. while the call view scrolls between
+    /// the grid and the speaker page. Views which aren't on screen don't render video, and we don't
+    /// request video for them.
+    func updateVideoViewVisibility() {
+        AssertIsOnMainThread()
+        guard let groupCall = currentGroupCall else { return }
+
+        var didChangeRendering = false
+        for (demuxId, videoViews) in videoViews {
+            guard let device = groupCall.remoteDeviceStates[demuxId] else { continue }
+            for videoView in videoViews.values {
+                let wasRenderingVideo = videoView.isRenderingVideo
+                videoView.configure(for: device)
+                didChangeRendering = didChangeRendering || wasRenderingVideo != videoView.isRenderingVideo
+            }
+        }
+        if didChangeRendering {
+            updateVideoRequests()
+        }
+    }
+
     private var updateVideoRequestsDebounceTimer: Timer?
     private func updateVideoRequests() {
         updateVideoRequestsDebounceTimer?.invalidate()
@@ -71,10 +92,11 @@ class GroupCallRemoteVideoManager {
 extension GroupCallRemoteVideoManager: GroupCallRemoteVideoViewSizeDelegate {
     func groupCallRemoteVideoViewDidChangeSize(remoteVideoView: GroupCallRemoteVideoView) {
         AssertIsOnMainThread()
-        updateVideoRequests()
+        // A view which was empty may now be on screen, or vice versa.
+        groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: remoteVideoView)
     }
 
-    func groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: GroupCallRemoteVideoView) {
+    func groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: GroupCallRemoteVideoView) {
         AssertIsOnMainThread()
         guard let device = currentGroupCall?.remoteDeviceStates[remoteVideoView.demuxId] else { return }
         remoteVideoView.configure(for: device)
@@ -109,7 +131,7 @@ extension GroupCallRemoteVideoManager: CallObserver {
 
 private protocol GroupCallRemoteVideoViewSizeDelegate: class {
     func groupCallRemoteVideoViewDidChangeSize(remoteVideoView: GroupCallRemoteVideoView)
-    func groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: GroupCallRemoteVideoView)
+    func groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: GroupCallRemoteVideoView)
 }
 
 class GroupCallRemoteVideoView: UIView {
@@ -144,7 +166,30 @@ class GroupCallRemoteVideoView: UIView {
     }
 
     override func didMoveToSuperview() {
-        sizeDelegate?.groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: self)
+        sizeDelegate?.groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: self)
+    }
+
+    override func didMoveToWindow() {
+        sizeDelegate?.groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: self)
+    }
+
+    override var isHidden: Bool {
+        didSet {
+            guard oldValue != isHidden else { return }
+            sizeDelegate?.groupCallRemoteVideoViewDidChangeVisibility(remoteVideoView: self)
+        }
+    }
+
+    // Whether any of this view is on screen. Views which aren't, e.g. the tiles in the grid while the
+    // speaker page is showing, or views of members whose video is muted, don't render video.
+    private var isOnScreen: Bool {
+        guard let window = window else { return false }
+        var view: UIView? = self
+        while let currentView = view {
+            if currentView.isHidden { return false }
+            view = currentView.superview
+        }
+        return convert(bounds, to: window).intersects(window.bounds)
     }
 
     var isGroupCall: Bool {
@@ -172,6 +217,6 @@ class GroupCallRemoteVideoView: UIView {
             return owsFailDebug("Tried to configure with incorrect device")
         }
 
-        videoTrack = superview == nil ? nil : device.videoTrack
+        videoTrack = isOnScreen ? device.videoTrack : nil
     }
 }
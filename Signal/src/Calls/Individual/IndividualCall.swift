@@ -114,6 +114,10 @@ public class IndividualCall: NSObject, IndividualCallNotificationInfo {
 
     public let sentAtTimestamp: UInt64
 
+    // When we started setting up the call: when the local user placed an
+    // outgoing call, or when we received the offer for an incoming call.
+    let setupStartTime = CACurrentMediaTime()
+
     public var callRecord: TSCall? {
         didSet {
             AssertIsOnMainThread()
@@ -842,6 +842,7 @@ import SignalMessaging
             let callMessage = OWSOutgoingCallMessage(thread: call.individualCall.thread, offerMessage: try offerBuilder.build(), destinationDeviceId: NSNumber(value: destinationDeviceId))
             return messageSender.sendMessage(.promise, callMessage.asPreparer)
         }.done {
+            self.logCallSetupMilestone("sent offer", call: call)
             Logger.info("sent offer message to \(call.individualCall.thread.contactAddress) device: \((destinationDeviceId != nil) ? String(destinationDeviceId!) : "nil")")
             try self.callManager.signalingMessageDidSend(callId: callId)
         }.catch { error in
@@ -862,6 +863,7 @@ import SignalMessaging
             let callMessage = OWSOutgoingCallMessage(thread: call.individualCall.thread, answerMessage: try answerBuilder.build(), destinationDeviceId: NSNumber(value: destinationDeviceId))
             return messageSender.sendMessage(.promise, callMessage.asPreparer)
         }.done {
+            self.logCallSetupMilestone("sent answer", call: call)
             Logger.debug("sent answer message to \(call.individualCall.thread.contactAddress) device: \((destinationDeviceId != nil) ? String(destinationDeviceId!) : "nil")")
             try self.callManager.signalingMessageDidSend(callId: callId)
         }.catch { error in
@@ -1101,11 +1103,13 @@ import SignalMessaging
 
         switch call.individualCall.state {
         case .dialing:
+            logCallSetupMilestone("ringing", call: call)
             if call.individualCall.state != .remoteRinging {
                 BenchEventComplete(eventId: "call-\(call.individualCall.localId)")
             }
             call.individualCall.state = .remoteRinging
         case .answering:
+            logCallSetupMilestone("ringing", call: call)
             if call.individualCall.state != .localRinging {
                 BenchEventComplete(eventId: "call-\(call.individualCall.localId)")
             }
@@ -1171,6 +1175,7 @@ import SignalMessaging
         call.individualCall.backgroundTask = nil
 
         call.individualCall.state = .connected
+        logCallSetupMilestone("connected", call: call)
 
         // We don't risk transmitting any media until the remote client has admitted to being connected.
         ensureAudioState(call: call)
@@ -1209,7 +1214,7 @@ import SignalMessaging
     private func getIceServers() -> Promise<[RTCIceServer]> {
 
         return firstly {
-            accountManager.getTurnServerInfo()
+            getTurnServerInfo()
         }.map(on: .global()) { turnServerInfo -> [RTCIceServer] in
             Logger.debug("got turn server urls: \(turnServerInfo.urls)")
 
@@ -1231,6 +1236,68 @@ import SignalMessaging
         }
     }
 
+    // Logged in production so that we can see where call setup spends its time. For outgoing calls, the time
+    // until "connected" includes the time spent waiting for the callee to answer.
+    private func logCallSetupMilestone(_ milestone: String, call: SignalCall) {
+        let elapsed = CACurrentMediaTime() - call.individualCall.setupStartTime
+        Logger.info("call: \(call.individualCall.localId), \(milestone) after \(String(format: "%0.0fms", elapsed * 1000))")
+    }
+
+    // MARK: - TURN Server Info
+
+    // Fetching the TURN server info is a round trip to the service that would
+    // otherwise delay the setup of every call, so we reuse it for a while and
+    // prefetch it when the user opens a conversation that they might call.
+    private static let turnServerInfoMaxAge: TimeInterval = 10 * kMinuteInterval
+
+    // These properties should only be accessed on the main thread.
+    private var turnServerInfoPromise: Promise<TurnServerInfo>?
+    private var turnServerInfoFetchDate: Date?
+
+    private func getTurnServerInfo() -> Promise<TurnServerInfo> {
+        AssertIsOnMainThread()
+
+        if let promise = turnServerInfoPromise,
+           let fetchDate = turnServerInfoFetchDate,
+           abs(fetchDate.timeIntervalSinceNow) < Self.turnServerInfoMaxAge {
+            return promise
+        }
+
+        // A fetch that is still in flight is reused too.
+        let promise = accountManager.getTurnServerInfo()
+        turnServerInfoPromise = promise
+        turnServerInfoFetchDate = Date()
+        promise.catch(on: .main) { [weak self] _ in
+            // Don't reuse failed fetches.
+            guard let self = self, self.turnServerInfoPromise === promise else {
+                return
+            }
+            self.turnServerInfoPromise = nil
+            self.turnServerInfoFetchDate = nil
+        }
+        return promise
+    }
+
+    /**
+     * Called when the user opens a conversation, so that a call placed from it doesn't wait on fetching the TURN
+     * server info.
+     */
+    @objc(prewarmCallSetupForThread:)
+    public func prewarmCallSetup(thread: TSThread) {
+        AssertIsOnMainThread()
+
+        guard thread is TSContactThread, !thread.isNoteToSelf else {
+            return
+        }
+        guard tsAccountManager.isRegisteredAndReady, callService.currentCall == nil else {
+            return
+        }
+
+        getTurnServerInfo().catch { error in
+            Logger.warn("Could not prefetch TURN server info: \(error)")
+        }
+    }
+
     public func handleCallKitProviderReset() {
         AssertIsOnMainThread()
         Logger.debug("")
@@ -305,33 +305,50 @@ class GroupCallRemoteMemberView: GroupCallMemberView {
         fatalError("init(coder:) has not been implemented")
     }
 
+    private struct AvatarKey: Equatable {
+        let address: SignalServiceAddress
+        let diameter: UInt
+    }
+
+    // Tiles are reconfigured whenever any member's state changes, e.g. when
+    // someone starts speaking, so we only load and build the avatar when the
+    // tile is showing a different member or has changed size.
+    private var configuredAvatarKey: AvatarKey?
+    private var conversationColorName: ConversationColorName = .default
+
     private var hasBeenConfigured = false
     func configure(call: SignalCall, device: RemoteDeviceState) {
         hasBeenConfigured = true
         deferredReconfigTimer?.invalidate()
 
-        let (profileImage, conversationColorName) = databaseStorage.uiRead { transaction in
-            return (
-                self.contactsManager.image(for: device.address, transaction: transaction),
-                self.contactsManager.conversationColorName(for: device.address, transaction: transaction)
-            )
-        }
+        let avatarKey = AvatarKey(address: device.address, diameter: avatarDiameter)
+        if avatarKey != configuredAvatarKey {
+            configuredAvatarKey = avatarKey
 
-        backgroundAvatarView.image = profileImage
+            let (profileImage, conversationColorName) = databaseStorage.uiRead { transaction in
+                return (
+                    self.contactsManager.image(for: device.address, transaction: transaction),
+                    self.contactsManager.conversationColorName(for: device.address, transaction: transaction)
+                )
+            }
+            self.conversationColorName = conversationColorName
 
-        let avatarBuilder = OWSContactAvatarBuilder(
-            address: device.address,
-            colorName: conversationColorName,
-            diameter: avatarDiameter
-        )
+            backgroundAvatarView.image = profileImage
 
-        if device.address.isLocalAddress {
-            avatarView.image = OWSProfileManager.shared().localProfileAvatarImage() ?? avatarBuilder.buildDefaultImage()
-        } else {
-            avatarView.image = avatarBuilder.build()
+            let avatarBuilder = OWSContactAvatarBuilder(
+                address: device.address,
+                colorName: conversationColorName,
+                diameter: avatarKey.diameter
+            )
+
+            if device.address.isLocalAddress {
+                avatarView.image = OWSProfileManager.shared().localProfileAvatarImage() ?? avatarBuilder.buildDefaultImage()
+            } else {
+                avatarView.image = avatarBuilder.build()
+            }
         }
 
-        avatarWidthConstraint.constant = CGFloat(avatarDiameter)
+        avatarWidthConstraint.constant = CGFloat(avatarKey.diameter)
 
         muteIndicatorImage.isHidden = mode == .speaker || device.audioMuted != true
         muteLeadingConstraint.constant = muteInsets
@@ -389,6 +406,7 @@ class GroupCallRemoteMemberView: GroupCallMemberView {
 
     func clearConfiguration() {
         deferredReconfigTimer?.invalidate()
+        configuredAvatarKey = nil
 
         cleanupVideoViews()
 
@@ -414,8 +432,11 @@ class GroupCallRemoteMemberView: GroupCallMemberView {
     }
 
     func configureRemoteVideo(device: RemoteDeviceState) {
-        if videoView?.superview == self { videoView?.removeFromSuperview() }
         let newVideoView = callService.groupCallRemoteVideoManager.remoteVideoView(for: device, mode: mode)
+        // Don't detach and reattach the renderer if this view is already showing it.
+        guard newVideoView !== videoView || newVideoView.superview != self else { return }
+
+        if videoView?.superview == self { videoView?.removeFromSuperview() }
         insertSubview(newVideoView, belowSubview: muteIndicatorImage)
         newVideoView.frame = bounds
         videoView = newVideoView
@@ -254,6 +254,8 @@ class GroupCallViewController: UIViewController {
                 scrollView.contentOffset = .zero
             }
         }
+
+        callService.groupCallRemoteVideoManager.updateVideoViewVisibility()
     }
 
     func updateVideoOverflowTrailingConstraint() {
@@ -761,6 +763,7 @@ extension GroupCallViewController: UIScrollViewDelegate {
             updateCallUI()
         }
         updateSpeakerViewToast()
+        callService.groupCallRemoteVideoManager.updateVideoViewVisibility()
     }
 }
 
@@ -80,10 +80,10 @@ class ConversationConfigurationSyncOperation: OWSOperation {
         let syncMessage = OWSSyncGroupsMessage(thread: thread)
         do {
             let attachmentDataSource: DataSource = try self.databaseStorage.read { transaction in
-                guard let messageData: Data = syncMessage.buildPlainTextAttachmentData(with: transaction) else {
+                guard let messageFileUrl = syncMessage.buildPlainTextAttachmentFile(with: transaction) else {
                     throw OWSAssertionError("could not serialize sync groups data")
                 }
-                return try DataSourcePath.dataSourceWritingSyncMessageData(messageData)
+                return try DataSourcePath.dataSource(with: messageFileUrl, shouldDeleteOnDeallocation: true)
             }
 
             self.sendConfiguration(attachmentDataSource: attachmentDataSource, syncMessage: syncMessage)
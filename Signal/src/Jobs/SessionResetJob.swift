@@ -47,15 +47,9 @@ public class SessionResetJobQueue: NSObject, JobQueue {
         // no special handling
     }
 
-    let operationQueue: OperationQueue = {
-        // no need to serialize the operation queuing, since sending will ultimately be serialized by MessageSender
-        let operationQueue = OperationQueue()
-        operationQueue.name = "SessionReset.OperationQueue"
-        return operationQueue
-    }()
-
     public func operationQueue(jobRecord: OWSSessionResetJobRecord) -> OperationQueue {
-        return self.operationQueue
+        // no need to serialize the operation queuing, since sending will ultimately be serialized by MessageSender
+        return JobQueueExecutor.shared.operationQueue(concurrencyClass: .network)
     }
 
     public func buildOperation(jobRecord: OWSSessionResetJobRecord, transaction: SDSAnyReadTransaction) throws -> SessionResetOperation {
@@ -95,8 +95,7 @@ NS_ASSUME_NONNULL_BEGIN
             @"BLOCK_LIST_BLOCKED_USERS_SECTION", @"Section header for users that have been blocked");
 
         for (SignalServiceAddress *address in blockedAddresses) {
-            [blockedContactsSection
-                addItem:[OWSTableItem
+            OWSTableItem *item = [OWSTableItem
                             itemWithCustomCellBlock:^{
                                 ContactTableViewCell *cell = [ContactTableViewCell new];
                                 [cell configureWithRecipientAddressWithSneakyTransaction:address];
@@ -110,7 +109,9 @@ NS_ASSUME_NONNULL_BEGIN
                                                                 completionBlock:^(BOOL isBlocked) {
                                                                     [weakSelf updateTableContents];
                                                                 }];
-                            }]];
+                            }];
+            item.identifier = address.serviceIdentifier;
+            [blockedContactsSection addItem:item];
         }
         [contents addSection:blockedContactsSection];
     }
@@ -130,7 +131,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                  conversationColorName:conversationColorName
                                                               diameter:kStandardAvatarSize];
             }
-            [blockedGroupsSection addItem:[OWSTableItem
+            OWSTableItem *item = [OWSTableItem
                                               itemWithCustomCellBlock:^{
                                                   OWSAvatarTableViewCell *cell = [OWSAvatarTableViewCell new];
                                                   [cell configureWithImage:image
@@ -144,7 +145,9 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                 completionBlock:^(BOOL isBlocked) {
                                                                                     [weakSelf updateTableContents];
                                                                                 }];
-                                              }]];
+                                              }];
+            item.identifier = blockedGroup.groupId.hexadecimalString;
+            [blockedGroupsSection addItem:item];
         }
         [contents addSection:blockedGroupsSection];
     }
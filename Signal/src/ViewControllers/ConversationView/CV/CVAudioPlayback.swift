@@ -21,12 +21,29 @@ protocol CVAudioPlayerListener {
 //     * Playback is manipulated in a subview like message details view
 //     * The cell is scrolled offscreen and unloaded.
 //     * etc.
+// * Play runs of consecutive voice messages without stalling.
+//   * When a voice message finishes, the voice message which immediately
+//     follows it in the conversation (if any) is played.
+//   * The next voice message is prepared while the current one plays, so
+//     that advancing doesn't have to load it.
 // * Ensure thread safety.
 //
 // It's lifetime matches CVC.
 @objc
 public class CVAudioPlayer: NSObject {
 
+    // MARK: - Dependencies
+
+    private var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    private var audioSession: OWSAudioSession {
+        return Environment.shared.audioSession
+    }
+
+    // MARK: -
+
     // The currently playing audio, if any.
     private var _audioPlayback: CVAudioPlayback?
     private var audioPlayback: CVAudioPlayback? {
@@ -42,6 +59,18 @@ public class CVAudioPlayer: NSObject {
         }
     }
 
+    // The voice message which follows the current audio, prepared for
+    // playback, if any.
+    private var preloadedPlayback: CVAudioPlayback?
+
+    // Each player ends its audio activity when it finishes, which would
+    // deactivate the audio session (and resume other apps' audio) in
+    // between voice messages. While a next voice message is preloaded, we
+    // hold an audio activity of our own to keep the session active.
+    private let autoAdvanceAudioActivity = AudioActivity(audioDescription: "[CVAudioPlayer] auto-advance",
+                                                         behavior: .audioMessagePlayback)
+    private var isHoldingAutoAdvanceAudioActivity = false
+
     // Views need to update to reflect playback progress, state changes.
     private var listeners = WeakArray<CVAudioPlayerListener>()
 
@@ -72,7 +101,8 @@ public class CVAudioPlayer: NSObject {
         return audioPlayback.audioPlaybackState
     }
 
-    private func ensurePlayback(forAttachmentStream attachmentStream: TSAttachmentStream) -> CVAudioPlayback? {
+    private func ensurePlayback(forAttachmentStream attachmentStream: TSAttachmentStream,
+                                message: TSMessage?) -> CVAudioPlayback? {
         AssertIsOnMainThread()
 
         let attachmentId = attachmentStream.uniqueId
@@ -80,10 +110,19 @@ public class CVAudioPlayer: NSObject {
            audioPlayback.attachmentId == attachmentId {
             return audioPlayback
         }
-        guard let audioPlayback = CVAudioPlayback(attachmentStream: attachmentStream) else {
+
+        let audioPlayback: CVAudioPlayback
+        if let preloadedPlayback = self.preloadedPlayback,
+           preloadedPlayback.attachmentId == attachmentId {
+            audioPlayback = preloadedPlayback
+        } else if let newPlayback = CVAudioPlayback(attachmentStream: attachmentStream, message: message) {
+            audioPlayback = newPlayback
+        } else {
             owsFailDebug("Could not play audio attachment.")
             return nil
         }
+        self.preloadedPlayback = nil
+
         // Restore playback continuity.
         if let progress = progressCache[attachmentId] {
             audioPlayback.setProgress(progress)
@@ -93,23 +132,28 @@ public class CVAudioPlayer: NSObject {
         return audioPlayback
     }
 
+    // If the message the audio belongs to is provided, playback will
+    // advance to the voice messages which follow it.
     @objc
-    public func togglePlayState(forAttachmentStream attachmentStream: TSAttachmentStream) {
+    public func togglePlayState(forAttachmentStream attachmentStream: TSAttachmentStream,
+                                message: TSMessage? = nil) {
         AssertIsOnMainThread()
 
-        guard let audioPlayback = ensurePlayback(forAttachmentStream: attachmentStream) else {
+        guard let audioPlayback = ensurePlayback(forAttachmentStream: attachmentStream, message: message) else {
             owsFailDebug("Could not play audio attachment.")
             return
         }
         audioPlayback.togglePlayState()
+        schedulePreloadOfNextVoiceMessage()
     }
 
     @objc
     public func setPlaybackProgress(progress: TimeInterval,
-                                    forAttachmentStream attachmentStream: TSAttachmentStream) {
+                                    forAttachmentStream attachmentStream: TSAttachmentStream,
+                                    message: TSMessage? = nil) {
         AssertIsOnMainThread()
 
-        guard let audioPlayback = ensurePlayback(forAttachmentStream: attachmentStream) else {
+        guard let audioPlayback = ensurePlayback(forAttachmentStream: attachmentStream, message: message) else {
             owsFailDebug("Could not play audio attachment.")
             return
         }
@@ -129,12 +173,135 @@ public class CVAudioPlayer: NSObject {
 
     @objc
     public func stopAll() {
+        preloadedPlayback = nil
+        endAutoAdvanceAudioActivity()
+
         guard let audioPlayback = self.audioPlayback else {
             return
         }
         audioPlayback.stop()
         self.audioPlayback = nil
     }
+
+    // MARK: - Auto-Advance
+
+    // Preloading reads from the database and loads the audio file, so we
+    // don't want to delay starting or advancing playback with it.
+    private func schedulePreloadOfNextVoiceMessage() {
+        DispatchQueue.main.async { [weak self] in
+            self?.preloadNextVoiceMessageIfNecessary()
+        }
+    }
+
+    private func preloadNextVoiceMessageIfNecessary() {
+        AssertIsOnMainThread()
+
+        guard let audioPlayback = self.audioPlayback,
+              audioPlayback.audioPlaybackState == .playing,
+              audioPlayback.isVoiceMessage,
+              let message = audioPlayback.message else {
+            endAutoAdvanceAudioActivity()
+            return
+        }
+        if let preloadedPlayback = self.preloadedPlayback,
+           preloadedPlayback.precedingMessageId == message.uniqueId {
+            beginAutoAdvanceAudioActivity()
+            return
+        }
+
+        preloadedPlayback = nil
+        guard let nextPlayback = buildPlayback(forVoiceMessageFollowing: message) else {
+            endAutoAdvanceAudioActivity()
+            return
+        }
+        preloadedPlayback = nextPlayback
+        beginAutoAdvanceAudioActivity()
+    }
+
+    private func buildPlayback(forVoiceMessageFollowing message: TSMessage) -> CVAudioPlayback? {
+        AssertIsOnMainThread()
+
+        typealias VoiceMessage = (message: TSMessage, attachmentStream: TSAttachmentStream)
+        let nextVoiceMessage: VoiceMessage? = databaseStorage.uiRead { transaction in
+            let interactionFinder = InteractionFinder(threadUniqueId: message.uniqueThreadId)
+            let nextInteraction: TSInteraction?
+            do {
+                nextInteraction = try interactionFinder.interaction(afterSortId: message.sortId,
+                                                                    transaction: transaction.unwrapGrdbRead)
+            } catch {
+                owsFailDebug("Error: \(error)")
+                return nil
+            }
+            guard let nextMessage = nextInteraction as? TSMessage,
+                  !nextMessage.wasRemotelyDeleted else {
+                return nil
+            }
+            let attachments = nextMessage.bodyAttachments(with: transaction.unwrapGrdbRead)
+            guard attachments.count == 1,
+                  let attachmentStream = attachments.first as? TSAttachmentStream,
+                  attachmentStream.isAudio,
+                  attachmentStream.isVoiceMessage else {
+                return nil
+            }
+            return (nextMessage, attachmentStream)
+        }
+        guard let nextVoiceMessage = nextVoiceMessage,
+              let nextPlayback = CVAudioPlayback(attachmentStream: nextVoiceMessage.attachmentStream,
+                                                 message: nextVoiceMessage.message) else {
+            return nil
+        }
+        nextPlayback.precedingMessageId = message.uniqueId
+        return nextPlayback
+    }
+
+    private func advance(from finishedPlayback: CVAudioPlayback) {
+        AssertIsOnMainThread()
+
+        defer {
+            // By now, either the next voice message has started its own
+            // audio activity or there is nothing left to play.
+            endAutoAdvanceAudioActivity()
+        }
+
+        guard finishedPlayback === audioPlayback,
+              finishedPlayback.isVoiceMessage,
+              let message = finishedPlayback.message else {
+            return
+        }
+        let nextPlayback: CVAudioPlayback
+        if let preloadedPlayback = self.preloadedPlayback,
+           preloadedPlayback.precedingMessageId == message.uniqueId {
+            nextPlayback = preloadedPlayback
+        } else if let newPlayback = buildPlayback(forVoiceMessageFollowing: message) {
+            nextPlayback = newPlayback
+        } else {
+            return
+        }
+        self.preloadedPlayback = nil
+
+        // Each voice message in a run plays from the beginning.
+        progressCache[nextPlayback.attachmentId] = 0
+        nextPlayback.delegate = self
+        self.audioPlayback = nextPlayback
+        nextPlayback.togglePlayState()
+        schedulePreloadOfNextVoiceMessage()
+    }
+
+    private func beginAutoAdvanceAudioActivity() {
+        guard !isHoldingAutoAdvanceAudioActivity else {
+            return
+        }
+        isHoldingAutoAdvanceAudioActivity = true
+        _ = audioSession.startAudioActivity(autoAdvanceAudioActivity)
+    }
+
+    private func endAutoAdvanceAudioActivity() {
+        guard isHoldingAutoAdvanceAudioActivity else {
+            return
+        }
+        isHoldingAutoAdvanceAudioActivity = false
+        audioSession.endAudioActivity(autoAdvanceAudioActivity)
+    }
 }
 
 // MARK: -
@@ -149,19 +316,28 @@ extension CVAudioPlayer: CVAudioPlaybackDelegate {
         case .stopped:
             progressCache[audioPlayback.attachmentId] = 0
         case .paused:
-            break
+            if audioPlayback === self.audioPlayback {
+                endAutoAdvanceAudioActivity()
+            }
         }
 
         for listener in listeners.elements {
             listener.audioPlayerStateDidChange()
         }
     }
+
+    fileprivate func audioPlaybackDidFinish(_ audioPlayback: CVAudioPlayback) {
+        AssertIsOnMainThread()
+
+        advance(from: audioPlayback)
+    }
 }
 
 // MARK: -
 
 private protocol CVAudioPlaybackDelegate: class {
     func audioPlaybackStateDidChange(_ audioPlayback: CVAudioPlayback)
+    func audioPlaybackDidFinish(_ audioPlayback: CVAudioPlayback)
 }
 
 // MARK: -
@@ -175,6 +351,14 @@ private class CVAudioPlayback: NSObject, OWSAudioPlayerDelegate {
 
     fileprivate let attachmentId: String
 
+    fileprivate let isVoiceMessage: Bool
+
+    // The message the audio belongs to, if known.
+    fileprivate let message: TSMessage?
+
+    // Set if this playback was preloaded to follow another message.
+    fileprivate var precedingMessageId: String?
+
     private let audioPlayer: OWSAudioPlayer
 
     private let _playbackState = AtomicValue<AudioPlaybackState>(AudioPlaybackState.stopped)
@@ -232,13 +416,16 @@ private class CVAudioPlayback: NSObject, OWSAudioPlayerDelegate {
         audioTiming.set(AudioTiming(progress: 0, duration: duration))
 
         delegate?.audioPlaybackStateDidChange(self)
+        delegate?.audioPlaybackDidFinish(self)
     }
 
     @objc
-    public required init?(attachmentStream: TSAttachmentStream) {
+    public required init?(attachmentStream: TSAttachmentStream, message: TSMessage?) {
         AssertIsOnMainThread()
 
         self.attachmentId = attachmentStream.uniqueId
+        self.isVoiceMessage = attachmentStream.isVoiceMessage
+        self.message = message
 
         guard let mediaURL = attachmentStream.originalMediaURL else {
             owsFailDebug("mediaURL was unexpectedly nil for attachment: \(attachmentStream)")
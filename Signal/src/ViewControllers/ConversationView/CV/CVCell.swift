@@ -39,6 +39,7 @@ public class CVCell: UICollectionViewCell, CVItemCell, CVRootComponentHost {
     public var isCellVisible: Bool = false {
         didSet {
             componentView?.setIsCellVisible(isCellVisible)
+            updateVisibleDownloads()
 
             if isCellVisible {
                 guard let renderItem = renderItem,
@@ -60,6 +61,24 @@ public class CVCell: UICollectionViewCell, CVItemCell, CVRootComponentHost {
 
     private var swipeToReplyState: CVSwipeToReplyState?
 
+    // The message whose attachment downloads are prioritized while this cell is visible.
+    private var visibleDownloadsMessageId: String?
+
+    private func updateVisibleDownloads() {
+        let messageId = isCellVisible ? renderItem?.interactionUniqueId : nil
+        guard messageId != visibleDownloadsMessageId else {
+            return
+        }
+        let attachmentDownloads = SSKEnvironment.shared.attachmentDownloads
+        if let oldMessageId = visibleDownloadsMessageId {
+            attachmentDownloads.messageDidBecomeHidden(oldMessageId)
+        }
+        if let messageId = messageId {
+            attachmentDownloads.messageDidBecomeVisible(messageId)
+        }
+        visibleDownloadsMessageId = messageId
+    }
+
     override init(frame: CGRect) {
         super.init(frame: frame)
 
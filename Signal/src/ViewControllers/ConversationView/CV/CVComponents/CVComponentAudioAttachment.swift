@@ -76,7 +76,8 @@ public class CVComponentAudioAttachment: CVComponentBase, CVComponent {
         guard let attachmentStream = attachmentStream else {
             return false
         }
-        audioPlayer.togglePlayState(forAttachmentStream: attachmentStream)
+        audioPlayer.togglePlayState(forAttachmentStream: attachmentStream,
+                                    message: interaction as? TSMessage)
         return true
     }
 
@@ -153,9 +154,11 @@ public class CVComponentAudioAttachment: CVComponentBase, CVComponent {
             audioMessageView.clearOverrideProgress(animated: false)
             let scrubbedTime = audioMessageView.scrubToLocation(location)
             audioPlayer.setPlaybackProgress(progress: scrubbedTime,
-                                            forAttachmentStream: attachmentStream)
+                                            forAttachmentStream: attachmentStream,
+                                            message: interaction as? TSMessage)
             if audioPlayer.audioPlaybackState(forAttachmentId: attachmentStream.uniqueId) != .playing {
-                audioPlayer.togglePlayState(forAttachmentStream: attachmentStream)
+                audioPlayer.togglePlayState(forAttachmentStream: attachmentStream,
+                                            message: interaction as? TSMessage)
             }
         case .possible, .began, .failed, .cancelled:
             audioMessageView.clearOverrideProgress(animated: false)
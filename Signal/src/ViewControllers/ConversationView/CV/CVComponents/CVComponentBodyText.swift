@@ -103,8 +103,29 @@ public class CVComponentBodyText: CVComponentBase, CVComponent {
 
     private static let unfairLock = UnfairLock()
 
+    // Item view states are rebuilt for the whole load window on every load,
+    // so without this cache we'd run the data detectors over every message
+    // body in the window each time. The result only depends on the text.
+    private static let shouldUseAttributedTextCache: NSCache<NSString, NSNumber> = {
+        let cache = NSCache<NSString, NSNumber>()
+        cache.countLimit = 1000
+        return cache
+    }()
+
     private static func shouldUseAttributedText(text: String,
                                                 shouldAllowLinkification: Bool) -> Bool {
+        let cacheKey = "\(shouldAllowLinkification ? "l" : "n")-\(text)" as NSString
+        if let cachedValue = shouldUseAttributedTextCache.object(forKey: cacheKey) {
+            return cachedValue.boolValue
+        }
+        let result = detectShouldUseAttributedText(text: text,
+                                                   shouldAllowLinkification: shouldAllowLinkification)
+        shouldUseAttributedTextCache.setObject(NSNumber(value: result), forKey: cacheKey)
+        return result
+    }
+
+    private static func detectShouldUseAttributedText(text: String,
+                                                      shouldAllowLinkification: Bool) -> Bool {
         // Use a lock to ensure that measurement on and off the main thread
         // don't conflict.
         unfairLock.withLock {
@@ -354,7 +375,25 @@ public class CVComponentBodyText: CVComponentBase, CVComponent {
         case textViewConfig(textViewConfig: CVTextViewConfig)
     }
 
+    // Building the text config (styling, search highlighting) is expensive
+    // for long attributed text, and the same config is needed for
+    // measurement and for rendering, so we build it once per component.
+    //
+    // Components are measured on the CV work queue and are only rendered
+    // after their render item has been delivered to the main thread.
+    private var cachedTextConfig: (displayableText: DisplayableText, textConfig: TextConfig)?
+
     private func textConfig(displayableText: DisplayableText) -> TextConfig {
+        if let cachedTextConfig = cachedTextConfig,
+           cachedTextConfig.displayableText === displayableText {
+            return cachedTextConfig.textConfig
+        }
+        let textConfig = buildTextConfig(displayableText: displayableText)
+        cachedTextConfig = (displayableText: displayableText, textConfig: textConfig)
+        return textConfig
+    }
+
+    private func buildTextConfig(displayableText: DisplayableText) -> TextConfig {
 
         let textValue = displayableText.textValue(isTextExpanded: isTextExpanded)
 
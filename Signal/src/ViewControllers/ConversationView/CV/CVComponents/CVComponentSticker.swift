@@ -54,16 +54,27 @@ public class CVComponentSticker: CVComponentBase, CVComponent {
                 containerView.addSubview(componentView.animatedImageView)
                 componentView.animatedImageView.autoPinEdgesToSuperviewEdges()
 
+                let stickerInfo = self.stickerInfo
                 componentView.loadBlock = {
                     guard let filePath = attachmentStream.originalFilePath else {
                         owsFailDebug("Missing filePath.")
                         return
                     }
-                    guard let image = YYImage(contentsOfFile: filePath) else {
+                    // Share decoded frames with other cells showing the same sticker.
+                    let image: UIImage?
+                    if let stickerInfo = stickerInfo {
+                        let pixelSize = CGSize(square: Self.stickerSize * UIScreen.main.scale)
+                        image = StickerFrameCache.shared.animatedImage(stickerInfo: stickerInfo,
+                                                                       stickerDataUrl: URL(fileURLWithPath: filePath),
+                                                                       pixelSize: pixelSize)
+                    } else {
+                        image = YYImage(contentsOfFile: filePath)
+                    }
+                    guard let animatedImage = image else {
                         owsFailDebug("Could not load image.")
                         return
                     }
-                    componentView.animatedImageView.image = image
+                    componentView.animatedImageView.image = animatedImage
                 }
             } else {
                 containerView.addSubview(componentView.stillmageView)
@@ -113,6 +113,8 @@ struct CVItemModelBuilder: CVItemBuilding {
             owsAssertDebug(item != nil)
         }
 
+        prefetchAttachments()
+
         var interactionIds = Set<String>()
         for interaction in messageMapping.loadedInteractions {
             guard !interactionIds.contains(interaction.uniqueId) else {
@@ -414,6 +416,23 @@ struct CVItemModelBuilder: CVItemBuilding {
     }
     private var componentStateCache = ComponentStateCache()
 
+    // Building the component state of a message looks up each of its
+    // attachments separately. Fetching the attachments of every message
+    // which needs a new component state up front adds them to the model
+    // read cache, so that those lookups don't each need a query.
+    private func prefetchAttachments() {
+        var attachmentIds = [String]()
+        for interaction in messageMapping.loadedInteractions {
+            guard let message = interaction as? TSMessage,
+                  componentStateCache.get(interactionId: message.uniqueId) == nil else {
+                continue
+            }
+            attachmentIds.append(contentsOf: message.allAttachmentIds)
+        }
+        _ = AttachmentFinder.fetchAttachments(uniqueIds: attachmentIds,
+                                              transaction: itemBuildingContext.transaction)
+    }
+
     mutating func reuseComponentStates(prevRenderState: CVRenderState,
                                        updatedInteractionIds: Set<String>) {
 
@@ -67,6 +67,8 @@ public class CVLoadCoordinator: NSObject {
 
     private var conversationStyle: ConversationStyle
 
+    private let focusMessageIdOnOpen: String?
+
     var renderState: CVRenderState
 
     // CVC is perf-sensitive during its initial load and
@@ -86,6 +88,11 @@ public class CVLoadCoordinator: NSObject {
 
     private var hasClearedUnreadMessagesIndicator = false
 
+    // If set, renderState was restored from CVRenderStateSnapshotCache and
+    // the initial load hasn't landed yet. The message mapping hasn't been
+    // loaded, so we can't load older or newer items until it has.
+    private var isShowingSnapshot = false
+
     private let messageMapping: CVMessageMapping
 
     // TODO: Remove. This model will get stale.
@@ -104,6 +111,7 @@ public class CVLoadCoordinator: NSObject {
         self.threadUniqueId = threadViewModel.threadRecord.uniqueId
         self.thread = threadViewModel.threadRecord
         self.conversationStyle = conversationStyle
+        self.focusMessageIdOnOpen = focusMessageIdOnOpen
 
         let viewStateSnapshot = CVViewStateSnapshot.snapshot(viewState: viewState,
                                                              typingIndicatorsSender: nil,
@@ -121,6 +129,13 @@ public class CVLoadCoordinator: NSObject {
         loadInitialMapping(focusMessageIdOnOpen: focusMessageIdOnOpen)
     }
 
+    deinit {
+        guard !isShowingSnapshot else {
+            return
+        }
+        CVRenderStateSnapshotCache.shared.setSnapshot(renderState, threadUniqueId: threadUniqueId)
+    }
+
     // MARK: -
 
     @objc
@@ -285,14 +300,14 @@ public class CVLoadCoordinator: NSObject {
         return abs(lastLoadNewerDate.timeIntervalSinceNow) < autoLoadMoreThreshold
     }
     private func loadInitialMapping(focusMessageIdOnOpen: String?) {
-        owsAssertDebug(renderState.isEmptyInitialState)
+        owsAssertDebug(renderState.isEmptyInitialState || isShowingSnapshot)
         loadRequestBuilder.loadInitialMapping(focusMessageIdOnOpen: focusMessageIdOnOpen)
         loadIfNecessary()
     }
 
     @objc
     public func loadOlderItems() {
-        guard !renderState.isEmptyInitialState else {
+        guard !renderState.isEmptyInitialState, !isShowingSnapshot else {
             return
         }
         loadRequestBuilder.loadOlderItems()
@@ -301,7 +316,7 @@ public class CVLoadCoordinator: NSObject {
 
     @objc
     public func loadNewerItems() {
-        guard !renderState.isEmptyInitialState else {
+        guard !renderState.isEmptyInitialState, !isShowingSnapshot else {
             return
         }
         loadRequestBuilder.loadNewerItems()
@@ -374,11 +389,48 @@ public class CVLoadCoordinator: NSObject {
 
         self.conversationStyle = conversationStyle
 
+        // The initial load can't begin until the view width is known, which
+        // is also when we can restore a snapshot.
+        if renderState.isEmptyInitialState, !isLoading.get(), focusMessageIdOnOpen == nil {
+            restoreSnapshotIfPossible()
+        }
+
         // We need to kick off a reload cycle if conversationStyle changes.
         enqueueReload(canReuseInteractionModels: true,
                       canReuseComponentStates: false)
     }
 
+    // MARK: - Snapshot
+
+    // Shows the last render state of this conversation, if it was recently
+    // closed, until the initial load lands. This lets us present a full
+    // screen of content without waiting for that load.
+    private func restoreSnapshotIfPossible() {
+        AssertIsOnMainThread()
+        owsAssertDebug(renderState.isEmptyInitialState)
+
+        // We can't use the snapshot until we know the view width.
+        guard conversationStyle.viewWidth > 0 else {
+            return
+        }
+        // The initial load will scroll to the unread indicator, which
+        // isn't in the snapshot.
+        guard !viewState.threadViewModel.hasUnreadMessages else {
+            CVRenderStateSnapshotCache.shared.removeSnapshot(threadUniqueId: threadUniqueId)
+            return
+        }
+        guard let snapshot = CVRenderStateSnapshotCache.shared.takeSnapshot(threadUniqueId: threadUniqueId) else {
+            return
+        }
+        guard snapshot.conversationStyle.isEqualForCellRendering(conversationStyle) else {
+            Logger.verbose("Discarding snapshot with a different conversation style.")
+            return
+        }
+        Logger.verbose("Restoring snapshot with \(snapshot.items.count) items.")
+        renderState = snapshot
+        isShowingSnapshot = true
+    }
+
     // MARK: - Unread Indicator
 
     @objc
@@ -443,7 +495,7 @@ public class CVLoadCoordinator: NSObject {
     private func load(loadRequest: CVLoadRequest, conversationStyle: ConversationStyle) {
         AssertIsOnMainThread()
         // We should do an "initial" load IFF this is our first load.
-        owsAssertDebug(loadRequest.isInitialLoad == renderState.isEmptyInitialState)
+        owsAssertDebug(loadRequest.isInitialLoad == (renderState.isEmptyInitialState || isShowingSnapshot))
 
         guard isLoading.get() else {
             owsFailDebug("isLoading not set.")
@@ -556,6 +608,7 @@ public class CVLoadCoordinator: NSObject {
             let updateToken = delegate.willUpdateWithNewRenderState(renderState)
 
             self.renderState = renderState
+            self.isShowingSnapshot = false
 
             let (loadDidLandPromise, loadDidLandResolver) = Promise<Void>.pending()
             self.loadDidLandResolver = loadDidLandResolver
@@ -753,6 +806,11 @@ extension CVLoadCoordinator: UICollectionViewDelegate {
             return
         }
         cell.isCellVisible = true
+
+        // Restore the media the user is about to see first.
+        if let message = (cell as? CVCell)?.renderItem?.interaction as? TSMessage {
+            AppEnvironment.shared.backupLazyRestore.prioritizeAttachments(attachmentIds: message.attachmentIds)
+        }
     }
 
     public func collectionView(_ collectionView: UICollectionView, didEndDisplaying cell: UICollectionViewCell, forItemAt indexPath: IndexPath) {
@@ -827,6 +885,14 @@ extension CVLoadCoordinator: UIScrollViewDelegate {
         delegate?.scrollViewWillBeginDragging?(scrollView)
     }
 
+    public func scrollViewWillEndDragging(_ scrollView: UIScrollView,
+                                          withVelocity velocity: CGPoint,
+                                          targetContentOffset: UnsafeMutablePointer<CGPoint>) {
+        delegate?.scrollViewWillEndDragging?(scrollView,
+                                             withVelocity: velocity,
+                                             targetContentOffset: targetContentOffset)
+    }
+
     public func scrollViewDidEndDragging(_ scrollView: UIScrollView, willDecelerate decelerate: Bool) {
         delegate?.scrollViewDidEndDragging?(scrollView, willDecelerate: decelerate)
     }
@@ -863,3 +929,112 @@ extension CVLoadCoordinator: CallServiceObserver {
                       canReuseComponentStates: false)
     }
 }
+
+// MARK: -
+
+// Holds the last render state of a few recently closed conversations, so
+// that re-opening one of them can show its last screen of content while
+// the initial load is in flight. See CVLoadCoordinator.restoreSnapshotIfPossible().
+//
+// Snapshots are only kept for conversations that were scrolled to the
+// newest messages and don't have disappearing messages. A snapshot is
+// discarded as soon as its thread changes, so it never shows messages which
+// have since been deleted. All snapshots are discarded when the app enters
+// the background or receives a memory warning.
+class CVRenderStateSnapshotCache: NSObject {
+
+    static let shared = CVRenderStateSnapshotCache()
+
+    static let maxSnapshotCount = 4
+
+    // This property should only be accessed on the main thread.
+    private var snapshots = [(threadUniqueId: String, renderState: CVRenderState)]()
+
+    private var isObservingDatabase = false
+
+    override init() {
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(removeAllSnapshots),
+                                               name: UIApplication.didReceiveMemoryWarningNotification,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(removeAllSnapshots),
+                                               name: .OWSApplicationDidEnterBackground,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    func setSnapshot(_ renderState: CVRenderState, threadUniqueId: String) {
+        DispatchMainThreadSafe {
+            self.removeSnapshot(threadUniqueId: threadUniqueId)
+
+            guard !renderState.isEmptyInitialState,
+                  !renderState.items.isEmpty,
+                  !renderState.canLoadNewerItems,
+                  renderState.indexPathOfUnreadIndicator == nil,
+                  !renderState.disappearingMessagesConfiguration.isEnabled,
+                  CurrentAppContext().isAppForegroundAndActive() else {
+                return
+            }
+
+            if !self.isObservingDatabase {
+                self.isObservingDatabase = true
+                SDSDatabaseStorage.shared.appendUIDatabaseSnapshotDelegate(self)
+            }
+
+            self.snapshots.append((threadUniqueId: threadUniqueId, renderState: renderState))
+            if self.snapshots.count > Self.maxSnapshotCount {
+                self.snapshots.removeFirst()
+            }
+        }
+    }
+
+    func takeSnapshot(threadUniqueId: String) -> CVRenderState? {
+        AssertIsOnMainThread()
+
+        guard let index = snapshots.firstIndex(where: { $0.threadUniqueId == threadUniqueId }) else {
+            return nil
+        }
+        return snapshots.remove(at: index).renderState
+    }
+
+    func removeSnapshot(threadUniqueId: String) {
+        AssertIsOnMainThread()
+
+        snapshots.removeAll { $0.threadUniqueId == threadUniqueId }
+    }
+
+    @objc
+    private func removeAllSnapshots() {
+        AssertIsOnMainThread()
+
+        snapshots.removeAll()
+    }
+}
+
+// MARK: -
+
+extension CVRenderStateSnapshotCache: UIDatabaseSnapshotDelegate {
+
+    func uiDatabaseSnapshotWillUpdate() {}
+
+    func uiDatabaseSnapshotDidUpdate(databaseChanges: UIDatabaseChanges) {
+        AssertIsOnMainThread()
+
+        let threadUniqueIds = databaseChanges.threadUniqueIds
+        snapshots.removeAll { threadUniqueIds.contains($0.threadUniqueId) }
+    }
+
+    func uiDatabaseSnapshotDidUpdateExternally() {
+        removeAllSnapshots()
+    }
+
+    func uiDatabaseSnapshotDidReset() {
+        removeAllSnapshots()
+    }
+}
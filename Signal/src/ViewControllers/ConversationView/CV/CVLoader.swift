@@ -54,6 +54,9 @@ public class CVLoader: NSObject {
         }
 
         return firstly(on: CVUtils.workQueue) { () -> CVUpdate in
+            let signpostId = Signposts.begin(.conversationLoad, threadUniqueId)
+            defer { Signposts.end(.conversationLoad, signpostId) }
+
             // To ensure coherency, the entire load should be done with a single transaction.
             let loadState: LoadState = try Self.databaseStorage.read { transaction in
 
@@ -76,6 +79,9 @@ public class CVLoader: NSObject {
 
                 self.benchSteps.step("threadViewModel")
 
+                messageMapping.updateInteractionIdIndex(deletedInteractionIds: loadRequest.deletedInteractionIds,
+                                                        didReset: loadRequest.didReset)
+
                 if loadRequest.shouldClearOldestUnreadInteraction {
                     messageMapping.oldestUnreadInteraction = nil
                 }
@@ -107,8 +113,10 @@ public class CVLoader: NSObject {
                     updatedInteractionIds.insert(prevFirstRenderItem.interactionUniqueId)
                 }
 
+                // The initial load may land on top of a snapshot restored by
+                // CVLoadCoordinator, whose models may be stale.
                 var reusableInteractions = [String: TSInteraction]()
-                if canReuseInteractions {
+                if canReuseInteractions, !loadRequest.isInitialLoad {
                     for renderItem in prevRenderState.items {
                         let interaction = renderItem.interaction
                         let interactionId = interaction.uniqueId
@@ -206,8 +214,9 @@ public class CVLoader: NSObject {
 
         let conversationStyle = loadContext.conversationStyle
 
-        // Don't cache in the reset() case.
+        // Don't cache in the reset() case, or against a restored snapshot.
         let canReuseState = (loadRequest.canReuseComponentStates &&
+                                !loadRequest.isInitialLoad &&
                                 conversationStyle.isEqualForCellRendering(prevRenderState.conversationStyle))
 
         var itemModelBuilder = CVItemModelBuilder(loadContext: loadContext)
@@ -224,22 +233,51 @@ public class CVLoader: NSObject {
         }
         let itemModels: [CVItemModel] = itemModelBuilder.buildItems()
 
+        // Item models are cheap to build, but root components and their
+        // measurements are not. If an item's state hasn't changed, we reuse
+        // the previous render item as is. Item models are always rebuilt for
+        // the whole window, so neighbours whose clustering, sender name or
+        // date header depend on an updated interaction are still detected:
+        // their item view state won't match.
+        var reusableRenderItems = [String: CVRenderItem]()
+        if canReuseState {
+            for renderItem in prevRenderState.items {
+                guard !updatedInteractionIds.contains(renderItem.interactionUniqueId) else {
+                    continue
+                }
+                reusableRenderItems[renderItem.interactionUniqueId] = renderItem
+            }
+        }
+
         var renderItems = [CVRenderItem]()
+        var reusedItemCount = 0
         for itemModel in itemModels {
+            if let prevRenderItem = reusableRenderItems[itemModel.interaction.uniqueId],
+               prevRenderItem.componentState == itemModel.componentState,
+               prevRenderItem.itemViewState == itemModel.itemViewState {
+                renderItems.append(prevRenderItem)
+                reusedItemCount += 1
+                continue
+            }
             guard let renderItem = buildRenderItem(itemBuildingContext: loadContext,
-                                                   itemModel: itemModel) else {
+                                                   itemModel: itemModel,
+                                                   measurementCache: .shared) else {
                 continue
             }
             renderItems.append(renderItem)
         }
 
+        Logger.verbose("Reused \(reusedItemCount) of \(renderItems.count) render items.")
+
         return renderItems
     }
 
     private func buildRenderItem(itemBuildingContext: CVItemBuildingContext,
-                                 itemModel: CVItemModel) -> CVRenderItem? {
+                                 itemModel: CVItemModel,
+                                 measurementCache: CVMeasurementCache) -> CVRenderItem? {
         Self.buildRenderItem(itemBuildingContext: itemBuildingContext,
-                             itemModel: itemModel)
+                             itemModel: itemModel,
+                             measurementCache: measurementCache)
     }
 
     @objc
@@ -280,11 +318,13 @@ public class CVLoader: NSObject {
             return nil
         }
         return Self.buildRenderItem(itemBuildingContext: itemBuildingContext,
-                                    itemModel: itemModel)
+                                    itemModel: itemModel,
+                                    measurementCache: nil)
     }
 
     private static func buildRenderItem(itemBuildingContext: CVItemBuildingContext,
-                                        itemModel: CVItemModel) -> CVRenderItem? {
+                                        itemModel: CVItemModel,
+                                        measurementCache: CVMeasurementCache?) -> CVRenderItem? {
 
         let conversationStyle = itemBuildingContext.conversationStyle
 
@@ -328,8 +368,19 @@ public class CVLoader: NSObject {
             return nil
         }
 
-        let cellMeasurement = buildCellMeasurement(rootComponent: rootComponent,
+        let cellMeasurement: CVCellMeasurement
+        if let measurementCache = measurementCache {
+            if let cachedMeasurement = measurementCache.cellMeasurement(itemModel: itemModel) {
+                cellMeasurement = cachedMeasurement
+            } else {
+                cellMeasurement = buildCellMeasurement(rootComponent: rootComponent,
+                                                       conversationStyle: conversationStyle)
+                measurementCache.setCellMeasurement(cellMeasurement, itemModel: itemModel)
+            }
+        } else {
+            cellMeasurement = buildCellMeasurement(rootComponent: rootComponent,
                                                    conversationStyle: conversationStyle)
+        }
 
         return CVRenderItem(itemModel: itemModel,
                             rootComponent: rootComponent,
@@ -342,6 +393,9 @@ public class CVLoader: NSObject {
 
     private static func buildCellMeasurement(rootComponent: CVRootComponent,
                                              conversationStyle: ConversationStyle) -> CVCellMeasurement {
+        let signpostId = Signposts.begin(.conversationMeasure)
+        defer { Signposts.end(.conversationMeasure, signpostId) }
+
         let measurementBuilder = CVCellMeasurement.Builder()
         measurementBuilder.cellSize = rootComponent.measure(maxWidth: conversationStyle.viewWidth,
                                                             measurementBuilder: measurementBuilder)
@@ -350,3 +404,96 @@ public class CVLoader: NSObject {
         return cellMeasurement
     }
 }
+
+// MARK: -
+
+// Measuring cells is the most expensive part of building render items,
+// and most loads (and re-opens of a conversation) measure cells whose
+// state hasn't changed since they were last measured.
+//
+// A measurement can be reused if the item's component state, item view
+// state and conversation style (which captures the view width and the
+// dynamic type size) are all equal to those it was measured with.
+// These are the same values CVRenderItem.updateMode() uses to decide
+// that two items are equal.
+//
+// The cache is shared by all conversations and is bounded by entry count.
+class CVMeasurementCache: NSObject {
+
+    static let shared = CVMeasurementCache()
+
+    static let maxEntryCount = 1024
+
+    private struct Entry {
+        let componentState: CVComponentState
+        let itemViewState: CVItemViewState
+        let conversationStyle: ConversationStyle
+        let cellMeasurement: CVCellMeasurement
+        var lastAccess: UInt64
+    }
+
+    private let unfairLock = UnfairLock()
+    // Keyed by interaction unique id.
+    private var entries = [String: Entry]()
+    private var accessCounter: UInt64 = 0
+
+    override init() {
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveMemoryWarning),
+                                               name: UIApplication.didReceiveMemoryWarningNotification,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        unfairLock.withLock {
+            entries.removeAll()
+        }
+    }
+
+    func cellMeasurement(itemModel: CVItemModel) -> CVCellMeasurement? {
+        let interactionId = itemModel.interaction.uniqueId
+        return unfairLock.withLock { () -> CVCellMeasurement? in
+            guard var entry = entries[interactionId] else {
+                return nil
+            }
+            guard entry.componentState == itemModel.componentState,
+                  entry.itemViewState == itemModel.itemViewState,
+                  entry.conversationStyle.isEqualForCellRendering(itemModel.conversationStyle) else {
+                return nil
+            }
+            accessCounter += 1
+            entry.lastAccess = accessCounter
+            entries[interactionId] = entry
+            return entry.cellMeasurement
+        }
+    }
+
+    func setCellMeasurement(_ cellMeasurement: CVCellMeasurement, itemModel: CVItemModel) {
+        let interactionId = itemModel.interaction.uniqueId
+        unfairLock.withLock {
+            accessCounter += 1
+            entries[interactionId] = Entry(componentState: itemModel.componentState,
+                                           itemViewState: itemModel.itemViewState,
+                                           conversationStyle: itemModel.conversationStyle,
+                                           cellMeasurement: cellMeasurement,
+                                           lastAccess: accessCounter)
+            if entries.count > Self.maxEntryCount {
+                // Evict the least recently used half in one pass, so that
+                // eviction is rare.
+                let evictedIds = entries.sorted { $0.value.lastAccess < $1.value.lastAccess }
+                    .prefix(entries.count - Self.maxEntryCount / 2)
+                    .map { $0.key }
+                for evictedId in evictedIds {
+                    entries.removeValue(forKey: evictedId)
+                }
+            }
+        }
+    }
+}
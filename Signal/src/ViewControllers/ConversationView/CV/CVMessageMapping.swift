@@ -16,6 +16,10 @@ public class CVMessageMapping: NSObject {
 
     private let interactionFinder: InteractionFinder
 
+    // The ordered ids of the thread's interactions, which we keep between
+    // loads so that we don't need to query for them. Only used with GRDB.
+    private let interactionIdIndex: ThreadInteractionIdIndex
+
     public var loadedUniqueIds: [String] {
         return loadedInteractions.map { $0.uniqueId }
     }
@@ -31,6 +35,16 @@ public class CVMessageMapping: NSObject {
     public required init(thread: TSThread) {
         self.thread = thread
         self.interactionFinder = InteractionFinder(threadUniqueId: thread.uniqueId)
+        self.interactionIdIndex = ThreadInteractionIdIndex(threadUniqueId: thread.uniqueId)
+    }
+
+    // This should be called before each load with the changes which prompted it.
+    public func updateInteractionIdIndex(deletedInteractionIds: Set<String>, didReset: Bool) {
+        if didReset {
+            interactionIdIndex.reset()
+        } else {
+            interactionIdIndex.didDeleteInteractions(uniqueIds: deletedInteractionIds)
+        }
     }
 
     // The smaller this number is, the faster the conversation can display.
@@ -171,8 +185,23 @@ public class CVMessageMapping: NSObject {
         owsAssertDebug(count > 0)
         let count = max(1, min(count, maxInteractionCount))
 
+        let interactionIdIndex: ThreadInteractionIdIndex? = try {
+            switch transaction.readTransaction {
+            case .yapRead:
+                return nil
+            case .grdbRead(let grdbRead):
+                try self.interactionIdIndex.update(transaction: grdbRead)
+                return self.interactionIdIndex
+            }
+        }()
+
         // The number of interactions currently in the conversation.
-        let conversationSize = interactionFinder.count(transaction: transaction)
+        let conversationSize: UInt
+        if let interactionIdIndex = interactionIdIndex {
+            conversationSize = UInt(interactionIdIndex.count)
+        } else {
+            conversationSize = interactionFinder.count(transaction: transaction)
+        }
         guard conversationSize > 0 else {
             self.loadedInteractions = []
             updateCanLoadMore(fetchIndexSet: IndexSet(), conversationSize: conversationSize)
@@ -192,6 +221,13 @@ public class CVMessageMapping: NSObject {
         // conversation. These "sort indices" have nothing to do with "sortIds"
         // which are auto-incremented database indices.
         let getSortIndex = { (interactionUniqueId: String) throws -> Int in
+            if let interactionIdIndex = interactionIdIndex {
+                guard let sortIndex = interactionIdIndex.sortIndex(interactionUniqueId: interactionUniqueId) else {
+                    throw OWSAssertionError("sortIndex was unexpectedly nil")
+                }
+                return sortIndex
+            }
+
             // To calculate the sort index, we figure out how far we are from the newest
             // message, and then subtract that from the conversation size. In the most
             // common cases, this will be *substantially* faster than trying to calculate
@@ -451,6 +487,7 @@ public class CVMessageMapping: NSObject {
         Logger.debug("fetching range: \(range)")
         let fetchedInteractions = try fetchInteractions(nsRange: range,
                                                         reusableInteractions: reusableInteractions,
+                                                        interactionIdIndex: interactionIdIndex,
                                                         transaction: transaction)
         owsAssertDebug(fetchedInteractions.count == fetchCount)
 
@@ -473,6 +510,7 @@ public class CVMessageMapping: NSObject {
 
     private func fetchInteractions(nsRange: NSRange,
                                    reusableInteractions: [String: TSInteraction],
+                                   interactionIdIndex: ThreadInteractionIdIndex?,
                                    transaction: SDSAnyReadTransaction) throws -> [TSInteraction] {
 
         // This method is a perf hotspot. To improve perf, we try to leverage
@@ -491,7 +529,12 @@ public class CVMessageMapping: NSObject {
         // Loading the mapping from the cache has the following steps:
         //
         // 1. Fetch the uniqueIds for the interactions in the load window/mapping.
-        let interactionIds = try interactionFinder.interactionIds(inRange: nsRange, transaction: transaction)
+        let interactionIds: [String]
+        if let interactionIdIndex = interactionIdIndex {
+            interactionIds = interactionIdIndex.interactionIds(inRange: nsRange)
+        } else {
+            interactionIds = try interactionFinder.interactionIds(inRange: nsRange, transaction: transaction)
+        }
         guard !interactionIds.isEmpty else {
             return []
         }
@@ -123,6 +123,16 @@ extension CVUpdate {
         let oldItemIdSet = Set(oldItemIdList)
         let newItemIdSet = Set(newItemIdList)
 
+        func buildIndexMap(itemIdList: [ItemId]) -> [ItemId: Int] {
+            var indexMap = [ItemId: Int]()
+            for (index, itemId) in itemIdList.enumerated() {
+                indexMap[itemId] = index
+            }
+            return indexMap
+        }
+        let oldIndexMap = buildIndexMap(itemIdList: oldItemIdList)
+        let newIndexMap = buildIndexMap(itemIdList: newItemIdList)
+
         // We use sets and dictionaries here to ensure perf.
         // We use NSMutableOrderedSet to preserve item ordering.
         var deletedItemIdSet = OrderedSet<ItemId>(oldItemIdList)
@@ -146,7 +156,7 @@ extension CVUpdate {
             owsAssertDebug(oldItemIdSet.contains(itemId))
             owsAssertDebug(!newItemIdSet.contains(itemId))
 
-            guard let oldIndex = oldItemIdList.firstIndex(of: itemId) else {
+            guard let oldIndex = oldIndexMap[itemId] else {
                 owsFailDebug("Can't find index of item.")
                 return buildUpdate(type: .reloadAll)
             }
@@ -166,7 +176,7 @@ extension CVUpdate {
             owsAssertDebug(!oldItemIdSet.contains(itemId))
             owsAssertDebug(newItemIdSet.contains(itemId))
 
-            guard let newIndex = newItemIdList.firstIndex(of: itemId) else {
+            guard let newIndex = newIndexMap[itemId] else {
                 owsFailDebug("Can't find index of item.")
                 return buildUpdate(type: .reloadAll)
             }
@@ -211,11 +221,11 @@ extension CVUpdate {
                 owsFailDebug("Can't find renderItem.")
                 return buildUpdate(type: .reloadAll)
             }
-            guard let oldIndex = oldItemIdList.firstIndex(of: itemId) else {
+            guard let oldIndex = oldIndexMap[itemId] else {
                 owsFailDebug("Can't find index of item.")
                 return buildUpdate(type: .reloadAll)
             }
-            guard let newIndex = newItemIdList.firstIndex(of: itemId) else {
+            guard let newIndex = newIndexMap[itemId] else {
                 owsFailDebug("Can't find index of item.")
                 return buildUpdate(type: .reloadAll)
             }
@@ -227,6 +237,11 @@ extension CVUpdate {
                 continue
             }
 
+            // CVLoader reuses render items whose state hasn't changed.
+            if newRenderItem === oldRenderItem {
+                continue
+            }
+
             switch newRenderItem.updateMode(other: oldRenderItem) {
             case .equal:
                 continue
@@ -68,6 +68,8 @@ public class CVViewState: NSObject {
     @objc
     public var isUserScrolling = false
     @objc
+    public let scrollHitchMonitor = ScrollHitchMonitor(name: "Conversation")
+    @objc
     public var scrollingAnimationCompletionTimer: Timer?
     @objc
     public var hasScrollingAnimation: Bool { scrollingAnimationCompletionTimer != nil }
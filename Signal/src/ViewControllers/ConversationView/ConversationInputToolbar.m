@@ -93,6 +93,7 @@ const CGFloat kMaxIPadTextViewHeight = 142;
 @property (nonatomic) UIEdgeInsets receivedSafeAreaInsets;
 @property (nonatomic, nullable) InputLinkPreview *inputLinkPreview;
 @property (nonatomic) BOOL wasLinkPreviewCancelled;
+@property (nonatomic, readonly) DebouncedEvent *updateInputLinkPreviewEvent;
 @property (nonatomic, nullable, weak) LinkPreviewView *linkPreviewView;
 @property (nonatomic, nullable, weak) UIView *stickerTooltip;
 @property (nonatomic) BOOL isConfigurationComplete;
@@ -125,6 +126,13 @@ const CGFloat kMaxIPadTextViewHeight = 142;
 
     self.inputToolbarDelegate = inputToolbarDelegate;
 
+    __weak ConversationInputToolbar *weakSelf = self;
+    _updateInputLinkPreviewEvent = [[DebouncedEvent alloc] initWithMaxFrequencySeconds:0.3
+                                                                               onQueue:dispatch_get_main_queue()
+                                                                           notifyBlock:^{
+                                                                               [weakSelf updateInputLinkPreview];
+                                                                           }];
+
     if (self) {
         [self createContentsWithMessageDraft:messageDraft
                        inputTextViewDelegate:inputTextViewDelegate
@@ -1318,12 +1326,13 @@ const CGFloat kMaxIPadTextViewHeight = 142;
 
     [self ensureButtonVisibilityWithIsAnimated:YES doLayout:YES];
     [self updateHeightWithTextView:textView];
-    [self updateInputLinkPreview];
+    // Don't look for links after every keystroke.
+    [self.updateInputLinkPreviewEvent requestNotify];
 }
 
 - (void)textViewDidChangeSelection:(UITextView *)textView
 {
-    [self updateInputLinkPreview];
+    [self.updateInputLinkPreviewEvent requestNotify];
 }
 
 - (void)updateHeightWithTextView:(UITextView *)textView
@@ -1389,7 +1398,36 @@ const CGFloat kMaxIPadTextViewHeight = 142;
         return;
     }
 
-    NSURL *previewUrl = [self.linkPreviewManager findFirstValidUrlInSearchString:self.inputTextView.text];
+    // Link detection and the link preview setting's read are too slow to do
+    // on the main thread while the user is typing.
+    NSString *inputText = self.inputTextView.text;
+    OWSLinkPreviewManager *linkPreviewManager = self.linkPreviewManager;
+    __weak ConversationInputToolbar *weakSelf = self;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        NSURL *_Nullable previewUrl = [linkPreviewManager findFirstValidUrlInSearchString:inputText];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            ConversationInputToolbar *_Nullable strongSelf = weakSelf;
+            if (!strongSelf) {
+                return;
+            }
+            if (![strongSelf.inputTextView.text isEqualToString:inputText]) {
+                // Obsolete; the text has changed again and will be checked again.
+                return;
+            }
+            [strongSelf updateInputLinkPreviewWithPreviewUrl:previewUrl];
+        });
+    });
+}
+
+- (void)updateInputLinkPreviewWithPreviewUrl:(nullable NSURL *)previewUrl
+{
+    OWSAssertIsOnMainThread();
+
+    if (self.wasLinkPreviewCancelled) {
+        [self clearLinkPreviewStateAndView];
+        return;
+    }
+
     if (!previewUrl.absoluteString.length) {
         [self clearLinkPreviewStateAndView];
         return;
@@ -1400,6 +1438,8 @@ const CGFloat kMaxIPadTextViewHeight = 142;
         return;
     }
 
+    [self cancelPendingLinkPreviewFetch];
+
     InputLinkPreview *inputLinkPreview = [InputLinkPreview new];
     self.inputLinkPreview = inputLinkPreview;
     self.inputLinkPreview.previewUrl = previewUrl;
@@ -1422,8 +1462,16 @@ const CGFloat kMaxIPadTextViewHeight = 142;
             [strongSelf ensureLinkPreviewViewWithState:viewState];
         })
         .catch(^(id error) {
+            ConversationInputToolbar *_Nullable strongSelf = weakSelf;
+            if (!strongSelf) {
+                return;
+            }
+            if (strongSelf.inputLinkPreview != inputLinkPreview) {
+                // Obsolete callback, e.g. a fetch we cancelled.
+                return;
+            }
             // The link preview could not be loaded.
-            [weakSelf clearLinkPreviewView];
+            [strongSelf clearLinkPreviewView];
         });
 }
 
@@ -1444,10 +1492,23 @@ const CGFloat kMaxIPadTextViewHeight = 142;
     [self.linkPreviewWrapper layoutIfNeeded];
 }
 
+- (void)cancelPendingLinkPreviewFetch
+{
+    OWSAssertIsOnMainThread();
+
+    // The draft no longer needs the preview it was fetching.
+    NSURL *_Nullable previewUrl = self.inputLinkPreview.previewUrl;
+    if (previewUrl != nil && self.inputLinkPreview.linkPreviewDraft == nil) {
+        [self.linkPreviewManager cancelLinkPreviewFetchForUrl:previewUrl];
+    }
+}
+
 - (void)clearLinkPreviewStateAndView
 {
     OWSAssertIsOnMainThread();
 
+    [self cancelPendingLinkPreviewFetch];
+
     self.inputLinkPreview = nil;
     self.linkPreviewView = nil;
 
@@ -1493,7 +1554,6 @@ const CGFloat kMaxIPadTextViewHeight = 142;
 
     self.wasLinkPreviewCancelled = YES;
 
-    self.inputLinkPreview = nil;
     [self clearLinkPreviewStateAndView];
 }
 
@@ -101,6 +101,9 @@ extension ConversationViewController: CVLoadCoordinatorDelegate {
                                   updateToken: CVUpdateToken) {
         AssertIsOnMainThread()
 
+        let signpostId = Signposts.begin(.conversationRender, "\(update.renderState.items.count) items")
+        defer { Signposts.end(.conversationRender, signpostId) }
+
         owsAssertDebug(self.viewState.scrollContinuityMap != nil)
 
         guard hasViewWillAppearEverBegun else {
@@ -404,6 +407,7 @@ extension ConversationViewController: CVLoadCoordinatorDelegate {
         }
         viewState.hasAppliedFirstLoad = true
         clearInitialScrollState()
+        LaunchTimer.shared.end(.firstConversationRender)
     }
 
     private func updateReloadingAll(renderState: CVRenderState,
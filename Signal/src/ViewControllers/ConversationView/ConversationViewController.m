@@ -72,6 +72,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 static const CGFloat kToastInset = 10;
+static const NSTimeInterval kDraftSaveDelaySeconds = 2.0;
 
 typedef enum : NSUInteger {
     kMediaTypePicture,
@@ -124,6 +125,8 @@ typedef enum : NSUInteger {
 @property (nonatomic) uint64_t lastSortIdMarkedRead;
 
 @property (nonatomic) BOOL isWaitingForDeceleration;
+// The content offset at which the current deceleration will come to rest, if any.
+@property (nonatomic, nullable) NSNumber *decelerationTargetContentOffsetY;
 
 @property (nonatomic) ConversationScrollButton *scrollDownButton;
 @property (nonatomic) BOOL isHidingScrollDownButton;
@@ -165,6 +168,8 @@ typedef enum : NSUInteger {
 
     OWSLogVerbose(@"");
 
+    [LaunchTimer.shared beginPhase:LaunchPhaseFirstConversationRender];
+
     ConversationStyle *conversationStyle = [[ConversationStyle alloc] initWithType:ConversationStyleTypeInitial
                                                                             thread:threadViewModel.threadRecord
                                                                          viewWidth:0];
@@ -574,6 +579,7 @@ typedef enum : NSUInteger {
     [self cancelVoiceMemo];
     self.isUserScrolling = NO;
     self.isWaitingForDeceleration = NO;
+    self.decelerationTargetContentOffsetY = nil;
     [self saveDraft];
     [self markVisibleMessagesAsRead];
     [self.cellMediaCache removeAllObjects];
@@ -966,6 +972,9 @@ typedef enum : NSUInteger {
     [self setNeedsStatusBarAppearanceUpdate];
 
     [self.bulkProfileFetch fetchProfilesWithThread:self.thread];
+    if (self.canCall) {
+        [self.callService.individualCallService prewarmCallSetupForThread:self.thread];
+    }
     [self markVisibleMessagesAsRead];
     [self startReadTimer];
     [self updateNavigationBarSubtitleLabel];
@@ -1067,6 +1076,7 @@ typedef enum : NSUInteger {
 
     self.isUserScrolling = NO;
     self.isWaitingForDeceleration = NO;
+    self.decelerationTargetContentOffsetY = nil;
 }
 
 - (void)viewDidLayoutSubviews
@@ -1560,10 +1570,27 @@ typedef enum : NSUInteger {
     [self.navigationController.view layoutIfNeeded];
     CGSize navControllerSize = self.navigationController.view.frame.size;
     CGFloat loadThreshold = MAX(navControllerSize.width, navControllerSize.height) * 3;
-    CGFloat distanceFromTop = self.collectionView.contentOffset.y;
+    CGFloat contentOffsetY = self.collectionView.contentOffset.y;
+    // While decelerating, load for where the scroll view will come to rest
+    // so that pages are fetched before a fling reaches the edge of the
+    // load window.
+    CGFloat targetContentOffsetY = contentOffsetY;
+    BOOL isDecelerating = (self.isWaitingForDeceleration && self.decelerationTargetContentOffsetY != nil);
+    if (isDecelerating) {
+        targetContentOffsetY = self.decelerationTargetContentOffsetY.floatValue;
+    }
+    CGFloat distanceFromTop = MIN(contentOffsetY, targetContentOffsetY);
     BOOL closeToTop = distanceFromTop < loadThreshold;
+    // A fast fling can outrun the load throttle. We let each fling bypass it once.
+    BOOL isFlingingTowardTop = isDecelerating && targetContentOffsetY < contentOffsetY;
     if (self.showLoadOlderHeader && closeToTop) {
 
+        if (isFlingingTowardTop && !self.loadCoordinator.hasLoadInFlight) {
+            self.decelerationTargetContentOffsetY = nil;
+            [self.loadCoordinator loadOlderItems];
+            return YES;
+        }
+
         if (self.loadCoordinator.didLoadOlderRecently) {
             __weak typeof(self) weakSelf = self;
             dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)1.f * NSEC_PER_SEC), dispatch_get_main_queue(), ^{
@@ -1577,10 +1604,17 @@ typedef enum : NSUInteger {
     }
 
     CGFloat distanceFromBottom = self.collectionView.contentSize.height - self.collectionView.bounds.size.height
-        - self.collectionView.contentOffset.y;
+        - MAX(contentOffsetY, targetContentOffsetY);
     BOOL closeToBottom = distanceFromBottom < loadThreshold;
+    BOOL isFlingingTowardBottom = isDecelerating && targetContentOffsetY > contentOffsetY;
     if (self.showLoadNewerHeader && closeToBottom) {
 
+        if (isFlingingTowardBottom && !self.loadCoordinator.hasLoadInFlight) {
+            self.decelerationTargetContentOffsetY = nil;
+            [self.loadCoordinator loadNewerItems];
+            return YES;
+        }
+
         if (self.loadCoordinator.didLoadNewerRecently) {
             __weak typeof(self) weakSelf = self;
             dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)1.f * NSEC_PER_SEC), dispatch_get_main_queue(), ^{
@@ -2227,9 +2261,9 @@ typedef enum : NSUInteger {
     OWSAssertDebug(type);
     OWSAssertDebug(filename);
     NSError *error;
-    _Nullable id<DataSource> dataSource = [DataSourcePath dataSourceWithURL:url
-                                                 shouldDeleteOnDeallocation:NO
-                                                                      error:&error];
+    _Nullable id<DataSource> dataSource = [DataSourceMappedPath dataSourceWithURL:url
+                                                       shouldDeleteOnDeallocation:NO
+                                                                            error:&error];
     if (dataSource == nil) {
         OWSFailDebug(@"error: %@", error);
 
@@ -2429,9 +2463,9 @@ typedef enum : NSUInteger {
                         canCancel:YES
                   backgroundBlock:^(ModalActivityIndicatorViewController *modalActivityIndicator) {
                       NSError *dataSourceError;
-                      id<DataSource> dataSource = [DataSourcePath dataSourceWithURL:movieURL
-                                                         shouldDeleteOnDeallocation:NO
-                                                                              error:&dataSourceError];
+                      id<DataSource> dataSource = [DataSourceMappedPath dataSourceWithURL:movieURL
+                                                               shouldDeleteOnDeallocation:NO
+                                                                                    error:&dataSourceError];
                       if (dataSourceError != nil) {
                           [self showErrorAlertForAttachment:nil];
                           return;
@@ -2777,8 +2811,18 @@ typedef enum : NSUInteger {
 
 #pragma mark - Drafts
 
+// Saves the draft once the user pauses typing, so that it survives the app
+// being terminated, without a write per keystroke.
+- (void)scheduleDraftSave
+{
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(saveDraft) object:nil];
+    [self performSelector:@selector(saveDraft) withObject:nil afterDelay:kDraftSaveDelaySeconds];
+}
+
 - (void)saveDraft
 {
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(saveDraft) object:nil];
+
     if (!self.hasViewWillAppearEverBegun) {
         OWSFailDebug(@"InputToolbar not yet ready.");
         return;
@@ -2820,6 +2864,7 @@ typedef enum : NSUInteger {
     if (textView.text.length > 0) {
         [self.typingIndicators didStartTypingOutgoingInputInThread:self.thread];
     }
+    [self scheduleDraftSave];
 }
 
 - (void)inputTextViewSendMessagePressed
@@ -3141,12 +3186,25 @@ typedef enum : NSUInteger {
     self.userHasScrolled = YES;
     self.isUserScrolling = YES;
     [self scrollingAnimationDidStart];
+    [self.viewState.scrollHitchMonitor didBeginScrolling];
+}
+
+- (void)scrollViewWillEndDragging:(UIScrollView *)scrollView
+                     withVelocity:(CGPoint)velocity
+              targetContentOffset:(inout CGPoint *)targetContentOffset
+{
+    if (fabs(velocity.y) > 0) {
+        self.decelerationTargetContentOffsetY = @(targetContentOffset->y);
+    } else {
+        self.decelerationTargetContentOffsetY = nil;
+    }
 }
 
 - (void)scrollViewDidEndDragging:(UIScrollView *)scrollView willDecelerate:(BOOL)willDecelerate
 {
     if (!willDecelerate) {
         [self scrollingAnimationDidComplete];
+        [self.viewState.scrollHitchMonitor didEndScrolling];
     }
 
     if (!self.isUserScrolling) {
@@ -3157,6 +3215,8 @@ typedef enum : NSUInteger {
 
     if (willDecelerate) {
         self.isWaitingForDeceleration = willDecelerate;
+        // Don't wait for the scroll update timer to prefetch.
+        [self autoLoadMoreIfNecessary];
     } else {
         [self scheduleScrollUpdateTimer];
     }
@@ -3165,12 +3225,14 @@ typedef enum : NSUInteger {
 - (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView
 {
     [self scrollingAnimationDidComplete];
+    [self.viewState.scrollHitchMonitor didEndScrolling];
 
     if (!self.isWaitingForDeceleration) {
         return;
     }
 
     self.isWaitingForDeceleration = NO;
+    self.decelerationTargetContentOffsetY = nil;
 
     [self scheduleScrollUpdateTimer];
 }
@@ -3431,6 +3493,9 @@ typedef enum : NSUInteger {
         [BenchManager completeEventWithEventId:@"fromSendUntil_toggleDefaultKeyboard"];
     });
 
+    // The draft is cleared below.
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(saveDraft) object:nil];
+
     TSThread *thread = self.thread;
     DatabaseStorageAsyncWrite(self.databaseStorage,
         ^(SDSAnyWriteTransaction *transaction) { [thread updateWithDraft:nil transaction:transaction]; });
@@ -9,7 +9,6 @@ public class InteractionReactionState: NSObject {
     @objc
     var hasReactions: Bool { return !emojiCounts.isEmpty }
 
-    let reactionsByEmoji: [Emoji: [OWSReaction]]
     let emojiCounts: [(emoji: String, count: Int)]
     let localUserEmoji: String?
 
@@ -23,39 +22,46 @@ public class InteractionReactionState: NSObject {
             return nil
         }
 
+        // Ordered by the most recent reaction with each emoji.
+        let exactEmojiCounts = MessageReactionCounts.emojiCounts(uniqueMessageId: message.uniqueId,
+                                                                 transaction: transaction.unwrapGrdbRead)
+        guard !exactEmojiCounts.isEmpty else {
+            emojiCounts = []
+            localUserEmoji = nil
+            return
+        }
+
         let finder = ReactionFinder(uniqueMessageId: message.uniqueId)
-        let allReactions = finder.allReactions(transaction: transaction.unwrapGrdbRead)
         let localUserReaction = finder.reaction(for: localAddress, transaction: transaction.unwrapGrdbRead)
+        let localUserBaseEmoji = localUserReaction.flatMap { Emoji($0.emoji) }
 
-        reactionsByEmoji = allReactions.reduce(
-            into: [Emoji: [OWSReaction]]()
-        ) { result, reaction in
-            guard let emoji = Emoji(reaction.emoji) else {
-                return owsFailDebug("Skipping reaction with unknown emoji \(reaction.emoji)")
+        var emojiCountsByBaseEmoji = [Emoji: (emoji: String, count: Int, recency: Int)]()
+        for (recency, exactEmojiCount) in exactEmojiCounts.enumerated() {
+            guard let emoji = Emoji(exactEmojiCount.emoji) else {
+                owsFailDebug("Skipping reaction with unknown emoji \(exactEmojiCount.emoji)")
+                continue
             }
 
-            var reactions = result[emoji] ?? []
-            reactions.append(reaction)
-            result[emoji] = reactions
-        }
-
-        emojiCounts = reactionsByEmoji.values.compactMap { reactions in
-            guard let mostRecentEmoji = reactions.first?.emoji else {
-                owsFailDebug("unexpectedly missing reactions")
-                return nil
+            if var emojiCount = emojiCountsByBaseEmoji[emoji] {
+                emojiCount.count += exactEmojiCount.count
+                emojiCountsByBaseEmoji[emoji] = emojiCount
+                continue
             }
 
             // We show your own skintone (if you’ve reacted), or the most
             // recent skintone (if you haven’t reacted).
             let emojiToRender: String
-            if let localUserReaction = localUserReaction, reactions.contains(localUserReaction) {
+            if let localUserReaction = localUserReaction, localUserBaseEmoji == emoji {
                 emojiToRender = localUserReaction.emoji
             } else {
-                emojiToRender = mostRecentEmoji
+                emojiToRender = exactEmojiCount.emoji
             }
+            emojiCountsByBaseEmoji[emoji] = (emoji: emojiToRender, count: exactEmojiCount.count, recency: recency)
+        }
 
-            return (emoji: emojiToRender, count: reactions.count)
-        }.sorted { $0.count > $1.count }
+        emojiCounts = emojiCountsByBaseEmoji.values.sorted { lhs, rhs in
+            lhs.count != rhs.count ? lhs.count > rhs.count : lhs.recency < rhs.recency
+        }.map { (emoji: $0.emoji, count: $0.count) }
 
         localUserEmoji = localUserReaction?.emoji
     }
@@ -428,15 +428,15 @@ class ReactionsDetailSheet: UIViewController {
     }
 
     private func reactions(for emoji: Emoji?, transaction: SDSAnyReadTransaction) -> [OWSReaction] {
+        let allReactions = reactionFinder.allReactions(transaction: transaction.unwrapGrdbRead)
         guard let emoji = emoji else {
-            return reactionFinder.allReactions(transaction: transaction.unwrapGrdbRead)
+            return allReactions
         }
 
-        guard let reactions = reactionState.reactionsByEmoji[emoji] else {
+        let reactions = allReactions.filter { Emoji($0.emoji) == emoji }
+        if reactions.isEmpty {
             owsFailDebug("missing reactions for emoji \(emoji)")
-            return []
         }
-
         return reactions
     }
 
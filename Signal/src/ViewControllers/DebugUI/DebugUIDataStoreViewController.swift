@@ -36,6 +36,16 @@ class DebugUIReportsViewController: OWSTableViewController {
                         self.currentReport = report
                         Logger.debug("report: \(report.title), text:\n \(report.text)")
                     }
+                },
+                OWSTableItem.init(title: "Main Thread Transactions") { [weak self] in
+                    guard let self = self else { return }
+                    let report = Report(title: "Main Thread Transactions",
+                                        text: MainThreadReadMonitor.shared.offendersReport)
+                    self.currentReport = report
+                    Logger.debug("report: \(report.title), text:\n \(report.text)")
+                },
+                OWSTableItem.init(title: "Reset Main Thread Transactions") {
+                    MainThreadReadMonitor.shared.resetOffenders()
                 }
             ])
         )
@@ -242,6 +242,9 @@ NS_ASSUME_NONNULL_BEGIN
     [items addObject:[OWSTableItem itemWithTitle:@"Discard All Profile Keys"
                                      actionBlock:^() { [DebugUIMisc discardAllProfileKeys]; }]];
 
+    [items addObject:[OWSTableItem itemWithTitle:@"Rebuild Search Index"
+                                     actionBlock:^() { [FullTextSearchIndexer rebuildIndexWithCompletion:nil]; }]];
+
     [items addObject:[OWSTableItem itemWithTitle:@"Log all sticker suggestions"
                                      actionBlock:^() { [DebugUIMisc logStickerSuggestions]; }]];
 
@@ -0,0 +1,95 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Shows a PerformanceSnapshot, refreshed every second.
+@objc
+class DebugUIPerformanceViewController: OWSTableViewController {
+
+    private var refreshTimer: Timer?
+
+    private var snapshot: PerformanceSnapshot?
+
+    public override func viewDidLoad() {
+        super.viewDidLoad()
+
+        title = "Performance"
+        navigationItem.rightBarButtonItem = UIBarButtonItem(barButtonSystemItem: .action,
+                                                            target: self,
+                                                            action: #selector(didTapShare))
+        refresh()
+    }
+
+    public override func viewWillAppear(_ animated: Bool) {
+        super.viewWillAppear(animated)
+
+        refreshTimer?.invalidate()
+        refreshTimer = WeakTimer.scheduledTimer(timeInterval: 1, target: self, userInfo: nil, repeats: true) { [weak self] _ in
+            self?.refresh()
+        }
+    }
+
+    public override func viewWillDisappear(_ animated: Bool) {
+        super.viewWillDisappear(animated)
+
+        refreshTimer?.invalidate()
+        refreshTimer = nil
+    }
+
+    private func refresh() {
+        snapshot = PerformanceSnapshot.capture()
+        updateTableContents()
+    }
+
+    @objc
+    private func didTapShare() {
+        guard let snapshot = snapshot else {
+            return
+        }
+        Logger.info("\(snapshot.reportText)")
+        UIPasteboard.general.string = snapshot.reportText
+        OWSActionSheets.showActionSheet(title: "Copied to pasteboard.")
+    }
+
+    public func updateTableContents() {
+        guard let snapshot = snapshot else {
+            return
+        }
+
+        let contents = OWSTableContents()
+
+        contents.addSection(OWSTableSection(title: "Queues", items: [
+            OWSTableItem.label(withText: "Decrypt", accessoryText: "\(snapshot.decryptQueueDepth)"),
+            OWSTableItem.label(withText: "Content", accessoryText: "\(snapshot.contentQueueDepth)"),
+            OWSTableItem.label(withText: "Send", accessoryText: "\(snapshot.sendQueueDepth)"),
+            OWSTableItem.label(withText: "Downloads",
+                               accessoryText: "\(snapshot.activeDownloadCount) + \(snapshot.queuedDownloadCount) queued")
+        ]))
+
+        contents.addSection(OWSTableSection(title: "Database", items: [
+            OWSTableItem.label(withText: "Commits/s", accessoryText: String(format: "%.1f", snapshot.commitsPerSecond)),
+            OWSTableItem.label(withText: "p95 write duration",
+                               accessoryText: PerformanceSnapshot.format(duration: snapshot.p95CommitDuration)),
+            OWSTableItem.label(withText: "Main thread reads",
+                               accessoryText: "\(snapshot.mainThreadReadCount) (\(snapshot.mainThreadSlowReadCount) slow)")
+        ]))
+
+        let cacheSection = OWSTableSection()
+        cacheSection.headerTitle = "Model Read Caches"
+        for cache in snapshot.caches {
+            let hitRate = PerformanceSnapshot.format(hitRate: cache.hitRate)
+            let cost = PerformanceSnapshot.format(byteCount: cache.cost)
+            cacheSection.add(OWSTableItem.label(withText: cache.cacheName, accessoryText: "\(hitRate), \(cost)"))
+        }
+        contents.addSection(cacheSection)
+
+        contents.addSection(OWSTableSection(title: "Process", items: [
+            OWSTableItem.label(withText: "Memory footprint", accessoryText: snapshot.memoryFootprintDescription),
+            OWSTableItem.label(withText: "Websocket", accessoryText: snapshot.socketStateDescription)
+        ]))
+
+        self.contents = contents
+    }
+}
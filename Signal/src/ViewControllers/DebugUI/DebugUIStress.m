@@ -509,6 +509,15 @@ NS_ASSUME_NONNULL_BEGIN
                                          [DebugUIStress makeUnregisteredGroup];
                                      }]];
 
+    [items addObject:[OWSTableItem itemWithTitle:@"Run message pipeline load (100)"
+                                     actionBlock:^{
+                                         [DebugUIStress runMessagePipelineLoadWithEnvelopeCount:100];
+                                     }]];
+    [items addObject:[OWSTableItem itemWithTitle:@"Run message pipeline load (1000)"
+                                     actionBlock:^{
+                                         [DebugUIStress runMessagePipelineLoadWithEnvelopeCount:1000];
+                                     }]];
+
     __weak DebugUIStress *weakSelf = self;
     [items addObject:[OWSTableItem itemWithTitle:@"Thrash writes 10/second"
                                      actionBlock:^{
@@ -270,6 +270,25 @@ public extension DebugUIStress {
             owsFailDebug("Error: \(error)")
         }
     }
+
+    // Pushes a synthetic load of incoming messages from fake senders
+    // through the message pipeline and reports its throughput.
+    class func runMessagePipelineLoad(envelopeCount: Int) {
+        let loadGenerator = MessagePipelineLoadGenerator()
+        firstly(on: .global()) { () throws -> [Data] in
+            try self.databaseStorage.write { transaction in
+                try loadGenerator.prepare(transaction: transaction)
+                return try loadGenerator.buildEnvelopeDatas(count: envelopeCount, transaction: transaction)
+            }
+        }.then(on: .global()) { envelopeDatas in
+            loadGenerator.run(envelopeDatas: envelopeDatas)
+        }.done { report in
+            Logger.info(report.logDescription)
+            OWSActionSheets.showActionSheet(title: "Message Pipeline Load", message: report.logDescription)
+        }.catch { error in
+            owsFailDebug("Error: \(error)")
+        }
+    }
 }
 
 // MARK: -
@@ -66,6 +66,19 @@ NS_ASSUME_NONNULL_BEGIN
                                     }];
 }
 
++ (OWSTableItem *)performanceItemWithViewController:(DebugUITableViewController *)viewController
+{
+    OWSAssertDebug(viewController);
+
+    __weak DebugUITableViewController *weakSelf = viewController;
+    return [OWSTableItem disclosureItemWithText:@"Performance"
+                                    actionBlock:^{
+                                        [weakSelf.navigationController
+                                            pushViewController:[DebugUIPerformanceViewController new]
+                                                      animated:YES];
+                                    }];
+}
+
 + (void)presentDebugUIForThread:(TSThread *)thread fromViewController:(UIViewController *)fromViewController
 {
     OWSAssertDebug(thread);
@@ -126,6 +139,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                                              animated:YES];
                                                            }];
     [subsectionItems addObject:dataStoreItem];
+    [subsectionItems addObject:[self performanceItemWithViewController:viewController]];
     [subsectionItems
         addObject:[self itemForSubsection:[DebugUIBackup new] viewController:viewController thread:thread]];
     [subsectionItems addObject:[self itemForSubsection:[DebugUIGroupsV2 new]
@@ -162,6 +176,7 @@ NS_ASSUME_NONNULL_BEGIN
                                         viewController:viewController
                                                 thread:nil]];
     [subsectionItems addObject:[self itemForSubsection:[DebugUIMisc new] viewController:viewController thread:nil]];
+    [subsectionItems addObject:[self performanceItemWithViewController:viewController]];
     [contents addSection:[OWSTableSection sectionWithTitle:@"Sections" items:subsectionItems]];
 
     viewController.contents = contents;
@@ -4,14 +4,26 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class SDSAnyReadTransaction;
+@class TSThread;
 @class ThreadViewModel;
 
 @interface ConversationListCell : UITableViewCell
 
 + (NSString *)cellReuseIdentifier;
 
+@property (class, nonatomic, readonly) NSUInteger avatarSize;
+
++ (nullable UIImage *)buildAvatarForThread:(TSThread *)thread transaction:(SDSAnyReadTransaction *)transaction;
+
 - (void)configureWithThread:(ThreadViewModel *)thread isBlocked:(BOOL)isBlocked;
 
+// The avatar may be prepared ahead of display, e.g. while prefetching rows,
+// so that configuring the cell doesn't need a database read.
+- (void)configureWithThread:(ThreadViewModel *)thread
+                  isBlocked:(BOOL)isBlocked
+             preparedAvatar:(nullable UIImage *)preparedAvatar;
+
 - (void)configureWithThread:(ThreadViewModel *)thread
                   isBlocked:(BOOL)isBlocked
             overrideSnippet:(nullable NSAttributedString *)overrideSnippet
@@ -172,13 +172,37 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)configureWithThread:(ThreadViewModel *)thread isBlocked:(BOOL)isBlocked
 {
-    [self configureWithThread:thread isBlocked:isBlocked overrideSnippet:nil overrideDate:nil];
+    [self configureWithThread:thread isBlocked:isBlocked preparedAvatar:nil];
+}
+
+- (void)configureWithThread:(ThreadViewModel *)thread
+                  isBlocked:(BOOL)isBlocked
+             preparedAvatar:(nullable UIImage *)preparedAvatar
+{
+    [self configureWithThread:thread
+                    isBlocked:isBlocked
+              overrideSnippet:nil
+                 overrideDate:nil
+               preparedAvatar:preparedAvatar];
+}
+
+- (void)configureWithThread:(ThreadViewModel *)thread
+                  isBlocked:(BOOL)isBlocked
+            overrideSnippet:(nullable NSAttributedString *)overrideSnippet
+               overrideDate:(nullable NSDate *)overrideDate
+{
+    [self configureWithThread:thread
+                    isBlocked:isBlocked
+              overrideSnippet:overrideSnippet
+                 overrideDate:overrideDate
+               preparedAvatar:nil];
 }
 
 - (void)configureWithThread:(ThreadViewModel *)thread
                   isBlocked:(BOOL)isBlocked
             overrideSnippet:(nullable NSAttributedString *)overrideSnippet
                overrideDate:(nullable NSDate *)overrideDate
+             preparedAvatar:(nullable UIImage *)preparedAvatar
 {
     OWSAssertIsOnMainThread();
     OWSAssertDebug(thread);
@@ -200,7 +224,11 @@ NS_ASSUME_NONNULL_BEGIN
                                                  name:[OWSTypingIndicatorsImpl typingIndicatorStateDidChange]
                                                object:nil];
     [self updateNameLabel];
-    [self updateAvatarView];
+    if (preparedAvatar != nil) {
+        self.avatarView.image = preparedAvatar;
+    } else {
+        [self updateAvatarView];
+    }
 
     // We update the fonts every time this cell is configured to ensure that
     // changes to the dynamic type settings are reflected.
@@ -343,6 +371,11 @@ NS_ASSUME_NONNULL_BEGIN
     self.avatarView.image = [OWSAvatarBuilder buildImageForThread:thread.threadRecord diameter:self.avatarSize];
 }
 
++ (nullable UIImage *)buildAvatarForThread:(TSThread *)thread transaction:(SDSAnyReadTransaction *)transaction
+{
+    return [OWSAvatarBuilder buildImageForThread:thread diameter:self.avatarSize transaction:transaction];
+}
+
 - (NSAttributedString *)attributedSnippetForThread:(ThreadViewModel *)thread isBlocked:(BOOL)isBlocked
 {
     OWSAssertDebug(thread);
@@ -450,12 +483,17 @@ NS_ASSUME_NONNULL_BEGIN
     return [UIFont ows_dynamicTypeBodyFont].ows_italic;
 }
 
-- (NSUInteger)avatarSize
++ (NSUInteger)avatarSize
 {
     // This value is now larger than kStandardAvatarSize.
     return 56;
 }
 
+- (NSUInteger)avatarSize
+{
+    return ConversationListCell.avatarSize;
+}
+
 - (NSUInteger)avatarHSpacing
 {
     return 12.f;
@@ -21,6 +21,7 @@
 #import <SignalMessaging/SignalMessaging-Swift.h>
 #import <SignalMessaging/Theme.h>
 #import <SignalMessaging/UIUtil.h>
+#import <SignalServiceKit/AppReadiness.h>
 #import <SignalServiceKit/MessageSender.h>
 #import <SignalServiceKit/OWSFormat.h>
 #import <SignalServiceKit/OWSMessageUtils.h>
@@ -51,6 +52,7 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 
 @interface ConversationListViewController () <UITableViewDelegate,
     UITableViewDataSource,
+    UITableViewDataSourcePrefetching,
     UIViewControllerPreviewingDelegate,
     UISearchBarDelegate,
     ConversationSearchViewDelegate,
@@ -68,6 +70,12 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 @property (nonatomic, readonly) ThreadMapping *threadMapping;
 @property (nonatomic) ConversationListMode conversationListMode;
 @property (nonatomic, readonly) NSCache<NSString *, ThreadViewModel *> *threadViewModelCache;
+// Avatars of rows prepared ahead of display, keyed by thread id.
+@property (nonatomic, readonly) NSCache<NSString *, UIImage *> *preparedAvatarCache;
+// Incremented whenever cached rows are invalidated, so that rows prefetched
+// off the main thread can be discarded if they might be stale.
+@property (nonatomic) NSUInteger rowCacheGeneration;
+@property (nonatomic, readonly) ScrollHitchMonitor *scrollHitchMonitor;
 @property (nonatomic) BOOL isViewVisible;
 @property (nonatomic) BOOL shouldObserveDBModifications;
 @property (nonatomic) BOOL hasEverAppeared;
@@ -123,6 +131,8 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     _blocklistCache = [OWSBlockListCache new];
     [_blocklistCache startObservingAndSyncStateWithDelegate:self];
     _threadViewModelCache = [NSCache new];
+    _preparedAvatarCache = [NSCache new];
+    _scrollHitchMonitor = [[ScrollHitchMonitor alloc] initWithName:@"Conversation List"];
     _threadMapping = [ThreadMapping new];
 }
 
@@ -177,6 +187,10 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
                                              selector:@selector(updateAvatars)
                                                  name:SSKPreferences.preferContactAvatarsPreferenceDidChange
                                                object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(otherUsersProfileDidChange:)
+                                                 name:kNSNotificationNameOtherUsersProfileDidChange
+                                               object:nil];
 }
 
 - (void)dealloc
@@ -188,9 +202,20 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 
 - (void)updateAvatars
 {
+    self.rowCacheGeneration++;
+    [self.preparedAvatarCache removeAllObjects];
     [self.tableView reloadData];
 }
 
+- (void)otherUsersProfileDidChange:(NSNotification *)notification
+{
+    OWSAssertIsOnMainThread();
+
+    // Visible cells update their own avatars.
+    self.rowCacheGeneration++;
+    [self.preparedAvatarCache removeAllObjects];
+}
+
 - (void)signalAccountsDidChange:(NSNotification *)notification
 {
     OWSAssertIsOnMainThread();
@@ -237,6 +262,8 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     OWSAssertIsOnMainThread();
 
     [self applyTheme];
+    self.rowCacheGeneration++;
+    [self.preparedAvatarCache removeAllObjects];
     [self.tableView reloadData];
 
     self.hasThemeChanged = YES;
@@ -358,6 +385,7 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     self.tableView = [[UITableView alloc] initWithFrame:CGRectZero style:UITableViewStyleGrouped];
     self.tableView.delegate = self;
     self.tableView.dataSource = self;
+    self.tableView.prefetchDataSource = self;
     self.tableView.separatorStyle = UITableViewCellSeparatorStyleNone;
     self.tableView.separatorColor = Theme.cellSeparatorColor;
     [self.tableView registerClass:[ConversationListCell class]
@@ -696,6 +724,9 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 {
     [super viewDidAppear:animated];
 
+    [LaunchTimer.shared endPhase:LaunchPhaseFirstConversationListRender];
+    [AppReadiness setFirstFrameDidRender];
+
     if (!self.hasEverAppeared && ![ExperienceUpgradeManager presentNextFromViewController:self]) {
         [OWSActionSheets showIOSUpgradeNagIfNecessary];
         [self presentGetStartedBannerIfNecessary];
@@ -1044,7 +1075,12 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 - (void)reloadTableViewData
 {
     // PERF: come up with a more nuanced cache clearing scheme
+    self.rowCacheGeneration++;
     [self.threadViewModelCache removeAllObjects];
+    [self.preparedAvatarCache removeAllObjects];
+    // Rebuild the view models of the visible rows in a single transaction,
+    // rather than one transaction per cell.
+    [self ensureThreadViewModelsForIndexPaths:self.tableView.indexPathsForVisibleRows ?: @[]];
     [self.tableView reloadData];
 }
 
@@ -1151,6 +1187,114 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     return newThreadViewModel;
 }
 
+- (NSArray<TSThread *> *)threadsToLoadForIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    OWSAssertIsOnMainThread();
+
+    NSMutableArray<TSThread *> *threadsToLoad = [NSMutableArray new];
+    for (NSIndexPath *indexPath in indexPaths) {
+        switch (indexPath.section) {
+            case ConversationListViewControllerSectionPinned:
+            case ConversationListViewControllerSectionUnpinned:
+                break;
+            default:
+                continue;
+        }
+        // Index paths may be stale, e.g. if the mapping was just reset.
+        if (indexPath.row < 0 || indexPath.row >= [self.threadMapping numberOfItemsInSection:indexPath.section]) {
+            continue;
+        }
+        TSThread *_Nullable threadRecord = [self threadForIndexPath:indexPath];
+        if (threadRecord == nil) {
+            continue;
+        }
+        if ([self.threadViewModelCache objectForKey:threadRecord.uniqueId] != nil
+            && [self.preparedAvatarCache objectForKey:threadRecord.uniqueId] != nil) {
+            continue;
+        }
+        [threadsToLoad addObject:threadRecord];
+    }
+    return threadsToLoad;
+}
+
+- (void)ensureThreadViewModelsForIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    OWSAssertIsOnMainThread();
+
+    NSArray<TSThread *> *threadsToLoad = [self threadsToLoadForIndexPaths:indexPaths];
+    if (threadsToLoad.count < 1) {
+        return;
+    }
+
+    [self.databaseStorage uiReadWithBlock:^(SDSAnyReadTransaction *transaction) {
+        for (TSThread *threadRecord in threadsToLoad) {
+            if ([self.threadViewModelCache objectForKey:threadRecord.uniqueId] == nil) {
+                ThreadViewModel *threadViewModel = [[ThreadViewModel alloc] initWithThread:threadRecord
+                                                                               transaction:transaction];
+                [self.threadViewModelCache setObject:threadViewModel forKey:threadRecord.uniqueId];
+            }
+            if ([self.preparedAvatarCache objectForKey:threadRecord.uniqueId] == nil) {
+                UIImage *_Nullable avatar = [ConversationListCell buildAvatarForThread:threadRecord
+                                                                           transaction:transaction];
+                if (avatar != nil) {
+                    [self.preparedAvatarCache setObject:avatar forKey:threadRecord.uniqueId];
+                }
+            }
+        }
+    }];
+}
+
+#pragma mark - UITableViewDataSourcePrefetching
+
+- (void)tableView:(UITableView *)tableView prefetchRowsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    OWSAssertIsOnMainThread();
+
+    NSArray<TSThread *> *threadsToLoad = [self threadsToLoadForIndexPaths:indexPaths];
+    if (threadsToLoad.count < 1) {
+        return;
+    }
+
+    // Prefetched rows aren't on screen yet, so we can load them off the main
+    // thread rather than stalling the scroll.
+    NSUInteger rowCacheGeneration = self.rowCacheGeneration;
+    NSMutableDictionary<NSString *, ThreadViewModel *> *threadViewModels = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, UIImage *> *avatars = [NSMutableDictionary new];
+    [self.databaseStorage concurrentReadWithItems:threadsToLoad
+        block:^(TSThread *threadRecord, SDSAnyReadTransaction *transaction) {
+            ThreadViewModel *threadViewModel = [[ThreadViewModel alloc] initWithThread:threadRecord
+                                                                           transaction:transaction];
+            UIImage *_Nullable avatar = [ConversationListCell buildAvatarForThread:threadRecord
+                                                                       transaction:transaction];
+            @synchronized(threadViewModels) {
+                threadViewModels[threadRecord.uniqueId] = threadViewModel;
+                avatars[threadRecord.uniqueId] = avatar;
+            }
+        }
+        completion:^{
+            OWSAssertIsOnMainThread();
+
+            // Rows which changed while we were loading will be rebuilt on demand.
+            if (self.rowCacheGeneration != rowCacheGeneration) {
+                return;
+            }
+            [threadViewModels enumerateKeysAndObjectsUsingBlock:^(NSString *uniqueId,
+                ThreadViewModel *threadViewModel,
+                BOOL *stop) {
+                if ([self.threadViewModelCache objectForKey:uniqueId] == nil) {
+                    [self.threadViewModelCache setObject:threadViewModel forKey:uniqueId];
+                }
+            }];
+            [avatars enumerateKeysAndObjectsUsingBlock:^(NSString *uniqueId, UIImage *avatar, BOOL *stop) {
+                if ([self.preparedAvatarCache objectForKey:uniqueId] == nil) {
+                    [self.preparedAvatarCache setObject:avatar forKey:uniqueId];
+                }
+            }];
+        }];
+}
+
+#pragma mark -
+
 - (nullable UIView *)tableView:(UITableView *)tableView viewForHeaderInSection:(NSInteger)section
 {
     switch (section) {
@@ -1252,9 +1396,10 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     OWSAssertDebug(cell);
 
     ThreadViewModel *thread = [self threadViewModelForIndexPath:indexPath];
+    UIImage *_Nullable preparedAvatar = [self.preparedAvatarCache objectForKey:thread.threadRecord.uniqueId];
 
     BOOL isBlocked = [self.blocklistCache isThreadBlocked:thread.threadRecord];
-    [cell configureWithThread:thread isBlocked:isBlocked];
+    [cell configureWithThread:thread isBlocked:isBlocked preparedAvatar:preparedAvatar];
 
     NSString *cellName;
     if (thread.threadRecord.isGroupThread) {
@@ -1678,6 +1823,19 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
 - (void)scrollViewWillBeginDragging:(UIScrollView *)scrollView
 {
     [self dismissSearchKeyboard];
+    [self.scrollHitchMonitor didBeginScrolling];
+}
+
+- (void)scrollViewDidEndDragging:(UIScrollView *)scrollView willDecelerate:(BOOL)willDecelerate
+{
+    if (!willDecelerate) {
+        [self.scrollHitchMonitor didEndScrolling];
+    }
+}
+
+- (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView
+{
+    [self.scrollHitchMonitor didEndScrolling];
 }
 
 #pragma mark - ConversationSearchViewDelegate
@@ -2155,7 +2313,9 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
     for (ThreadMappingRowChange *rowChange in mappingDiff.rowChanges) {
         NSString *key = rowChange.uniqueRowId;
         OWSAssertDebug(key);
+        self.rowCacheGeneration++;
         [self.threadViewModelCache removeObjectForKey:key];
+        [self.preparedAvatarCache removeObjectForKey:key];
 
         switch (rowChange.type) {
             case ThreadMappingChangeDelete: {
@@ -2195,6 +2355,10 @@ NSString *const kArchiveButtonPseudoGroup = @"kArchiveButtonPseudoGroup";
         }
     }
 
+    // Rebuild the view models of changed rows in a single transaction,
+    // rather than one transaction per cell.
+    [self ensureThreadViewModelsForIndexPaths:self.tableView.indexPathsForVisibleRows ?: @[]];
+
     [self.tableView endUpdates];
     [BenchManager completeEventWithEventId:@"uiDatabaseUpdate"];
 }
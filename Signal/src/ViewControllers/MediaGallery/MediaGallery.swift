@@ -284,13 +284,16 @@ class MediaGallery {
     var hasFetchedOldest = false
     var hasFetchedMostRecent = false
 
-    func buildGalleryItem(attachment: TSAttachment, transaction: SDSAnyReadTransaction) -> MediaGalleryItem? {
+    func buildGalleryItem(attachment: TSAttachment,
+                          albumMessages: [String: TSMessage] = [:],
+                          transaction: SDSAnyReadTransaction) -> MediaGalleryItem? {
         guard let attachmentStream = attachment as? TSAttachmentStream else {
             owsFailDebug("gallery doesn't yet support showing undownloaded attachments")
             return nil
         }
 
-        guard let message = attachmentStream.fetchAlbumMessage(transaction: transaction) else {
+        let albumMessage = attachmentStream.albumMessageId.flatMap { albumMessages[$0] }
+        guard let message = albumMessage ?? attachmentStream.fetchAlbumMessage(transaction: transaction) else {
             owsFailDebug("message was unexpectedly nil")
             return nil
         }
@@ -301,6 +304,28 @@ class MediaGallery {
         return galleryItem
     }
 
+    // Fetches the album messages of the attachments with a single query,
+    // keyed by unique id.
+    private func fetchAlbumMessages(attachments: [TSAttachment],
+                                    transaction: SDSAnyReadTransaction) -> [String: TSMessage] {
+        guard case .grdbRead = transaction.readTransaction else {
+            return [:]
+        }
+        let albumMessageIds = Set(attachments.compactMap { $0.albumMessageId })
+        guard !albumMessageIds.isEmpty else {
+            return [:]
+        }
+        var result = [String: TSMessage]()
+        for interaction in InteractionFinder.interactions(withInteractionIds: albumMessageIds, transaction: transaction) {
+            guard let message = interaction as? TSMessage else {
+                owsFailDebug("unexpected interaction: \(type(of: interaction))")
+                continue
+            }
+            result[message.uniqueId] = message
+        }
+        return result
+    }
+
     var galleryAlbums: [String: MediaGalleryAlbum] = [:]
     func getAlbum(item: MediaGalleryItem) -> MediaGalleryAlbum? {
         guard let albumMessageId = item.attachmentStream.albumMessageId else {
@@ -412,16 +437,22 @@ class MediaGallery {
                     let highestUnfetchedIndex = unfetchedSet.max()!
                     let nsRange: NSRange = NSRange(location: firstUnfetchedIndex, length: highestUnfetchedIndex - firstUnfetchedIndex + 1)
                     Logger.debug("fetching set: \(unfetchedSet), range: \(nsRange)")
+                    var attachments = [TSAttachment]()
                     self.mediaGalleryFinder.enumerateMediaAttachments(range: nsRange, transaction: transaction) { (attachment: TSAttachment) in
-
                         guard !self.deletedAttachments.contains(attachment) else {
                             Logger.debug("skipping \(attachment) which has been deleted.")
                             return
                         }
+                        attachments.append(attachment)
+                    }
+                    let albumMessages = self.fetchAlbumMessages(attachments: attachments, transaction: transaction)
 
-                        guard let item: MediaGalleryItem = self.buildGalleryItem(attachment: attachment, transaction: transaction) else {
+                    for attachment in attachments {
+                        guard let item: MediaGalleryItem = self.buildGalleryItem(attachment: attachment,
+                                                                                 albumMessages: albumMessages,
+                                                                                 transaction: transaction) else {
                             owsFailDebug("unexpectedly failed to buildGalleryItem")
-                            return
+                            continue
                         }
 
                         guard direction != .around || !galleryItems.contains(item) else {
@@ -429,7 +460,7 @@ class MediaGallery {
                             // the middle items. It's faster to skip them rather than doing two
                             // separate `before` and `after` queries.
                             Logger.debug("skipping redundant gallery item")
-                            return
+                            continue
                         }
 
                         let date = item.galleryDate
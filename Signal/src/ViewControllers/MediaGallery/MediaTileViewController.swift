@@ -5,7 +5,7 @@
 import Foundation
 
 @objc
-public class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate, UICollectionViewDelegateFlowLayout {
+public class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate, UICollectionViewDelegateFlowLayout, UICollectionViewDataSourcePrefetching {
 
     private var galleryItems: [GalleryDate: [MediaGalleryItem]] { return mediaGallery.sections }
     private var galleryDates: [GalleryDate] { return mediaGallery.sectionDates }
@@ -18,6 +18,7 @@ public class MediaTileViewController: UICollectionViewController, MediaGalleryDe
         return mediaGallery
     }()
     fileprivate let mediaTileViewLayout: MediaTileViewLayout
+    private let thumbnailLoader = MediaTileThumbnailLoader()
 
     @objc
     public init(thread: TSThread) {
@@ -71,6 +72,7 @@ public class MediaTileViewController: UICollectionViewController, MediaGalleryDe
         collectionView.register(MediaGalleryStaticHeader.self, forSupplementaryViewOfKind: UICollectionView.elementKindSectionHeader, withReuseIdentifier: MediaGalleryStaticHeader.reuseIdentifier)
 
         collectionView.delegate = self
+        collectionView.prefetchDataSource = self
 
         // feels a bit weird to have content smashed all the way to the bottom edge.
         collectionView.contentInset = UIEdgeInsets(top: 0, left: 0, bottom: 20, right: 0)
@@ -370,7 +372,7 @@ public class MediaTileViewController: UICollectionViewController, MediaGalleryDe
                 return defaultCell
             }
 
-            let gridCellItem = GalleryGridCellItem(galleryItem: galleryItem)
+            let gridCellItem = GalleryGridCellItem(galleryItem: galleryItem, thumbnailLoader: thumbnailLoader)
             cell.configure(item: gridCellItem)
 
             return cell
@@ -386,6 +388,35 @@ public class MediaTileViewController: UICollectionViewController, MediaGalleryDe
         photoGridViewCell.allowsMultipleSelection = collectionView.allowsMultipleSelection
     }
 
+    // MARK: UICollectionViewDataSourcePrefetching
+
+    public func collectionView(_ collectionView: UICollectionView, prefetchItemsAt indexPaths: [IndexPath]) {
+        for indexPath in indexPaths {
+            guard let galleryItem = prefetchableGalleryItem(at: indexPath) else {
+                continue
+            }
+            thumbnailLoader.prefetch(galleryItem: galleryItem)
+        }
+    }
+
+    public func collectionView(_ collectionView: UICollectionView, cancelPrefetchingForItemsAt indexPaths: [IndexPath]) {
+        for indexPath in indexPaths {
+            guard let galleryItem = prefetchableGalleryItem(at: indexPath) else {
+                continue
+            }
+            thumbnailLoader.cancelPrefetch(galleryItem: galleryItem)
+        }
+    }
+
+    // Unlike galleryItem(at:), tolerates index paths that are out of date,
+    // since prefetching can race with loading and deleting.
+    private func prefetchableGalleryItem(at indexPath: IndexPath) -> MediaGalleryItem? {
+        guard let sectionDate = galleryDates[safe: indexPath.section - 1] else {
+            return nil
+        }
+        return galleryItems[sectionDate]?[safe: indexPath.row]
+    }
+
     func galleryItem(at indexPath: IndexPath) -> MediaGalleryItem? {
         guard let sectionDate = self.galleryDates[safe: indexPath.section - 1] else {
             owsFailDebug("unknown section: \(indexPath.section)")
@@ -869,9 +900,11 @@ private class MediaGalleryStaticHeader: UICollectionViewCell {
 
 class GalleryGridCellItem: PhotoGridItem {
     let galleryItem: MediaGalleryItem
+    private let thumbnailLoader: MediaTileThumbnailLoader
 
-    init(galleryItem: MediaGalleryItem) {
+    fileprivate init(galleryItem: MediaGalleryItem, thumbnailLoader: MediaTileThumbnailLoader) {
         self.galleryItem = galleryItem
+        self.thumbnailLoader = thumbnailLoader
     }
 
     var type: PhotoGridItemType {
@@ -885,6 +918,136 @@ class GalleryGridCellItem: PhotoGridItem {
     }
 
     func asyncThumbnail(completion: @escaping (UIImage?) -> Void) -> UIImage? {
-        return galleryItem.thumbnailImage(async: completion)
+        return thumbnailLoader.thumbnail(galleryItem: galleryItem, completion: completion)
+    }
+}
+
+// MARK: -
+
+// Loads and decodes tile thumbnails off the main thread.
+//
+// UIImage decodes lazily, on the main thread, the first time an image is
+// drawn. We decode thumbnails on a background queue instead, and keep the
+// decoded images in a cache bounded by their size in memory. Tiles that
+// are about to scroll into view are prefetched; prefetches for tiles that
+// scroll away before they are loaded are cancelled.
+private class MediaTileThumbnailLoader {
+
+    private static let decodeQueue = DispatchQueue(label: "org.signal.media-tile-thumbnails",
+                                                   qos: .userInitiated)
+
+    // Bounded by the bytes of decoded bitmaps.
+    private static let maxCacheCost = 48 * 1024 * 1024
+
+    private let cache: NSCache<NSString, UIImage> = {
+        let cache = NSCache<NSString, UIImage>()
+        cache.totalCostLimit = MediaTileThumbnailLoader.maxCacheCost
+        return cache
+    }()
+
+    // This property should only be accessed on the main thread.
+    private var pendingCompletions = [String: [(UIImage?) -> Void]]()
+
+    // Prefetches may be cancelled from the main thread while they wait on
+    // the decode queue.
+    private let unfairLock = UnfairLock()
+    private var cancelledPrefetchIds = Set<String>()
+
+    func thumbnail(galleryItem: MediaGalleryItem, completion: @escaping (UIImage?) -> Void) -> UIImage? {
+        AssertIsOnMainThread()
+
+        let attachmentId = galleryItem.attachmentStream.uniqueId
+        if let image = cache.object(forKey: attachmentId as NSString) {
+            return image
+        }
+        load(galleryItem: galleryItem, completion: completion)
+        return nil
+    }
+
+    func prefetch(galleryItem: MediaGalleryItem) {
+        AssertIsOnMainThread()
+
+        let attachmentId = galleryItem.attachmentStream.uniqueId
+        guard cache.object(forKey: attachmentId as NSString) == nil else {
+            return
+        }
+        load(galleryItem: galleryItem, completion: nil)
+    }
+
+    func cancelPrefetch(galleryItem: MediaGalleryItem) {
+        AssertIsOnMainThread()
+
+        let attachmentId = galleryItem.attachmentStream.uniqueId
+        // Loads that a cell is waiting for are never cancelled.
+        guard let completions = pendingCompletions[attachmentId], completions.isEmpty else {
+            return
+        }
+        unfairLock.withLock {
+            _ = cancelledPrefetchIds.insert(attachmentId)
+        }
+    }
+
+    private func load(galleryItem: MediaGalleryItem, completion: ((UIImage?) -> Void)?) {
+        AssertIsOnMainThread()
+
+        let attachmentId = galleryItem.attachmentStream.uniqueId
+
+        if pendingCompletions[attachmentId] != nil {
+            // Already loading.
+            if let completion = completion {
+                pendingCompletions[attachmentId]?.append(completion)
+                unfairLock.withLock {
+                    _ = cancelledPrefetchIds.remove(attachmentId)
+                }
+            }
+            return
+        }
+        pendingCompletions[attachmentId] = completion.map { [$0] } ?? []
+
+        Self.decodeQueue.async { [weak self] in
+            guard let self = self else {
+                return
+            }
+            let isCancelled = self.unfairLock.withLock {
+                self.cancelledPrefetchIds.remove(attachmentId) != nil
+            }
+            let image: UIImage?
+            if isCancelled {
+                image = nil
+            } else {
+                image = galleryItem.thumbnailImageSync().map { Self.decoded(image: $0) }
+            }
+
+            DispatchQueue.main.async {
+                let completions = self.pendingCompletions.removeValue(forKey: attachmentId) ?? []
+                if isCancelled {
+                    // A cell may have asked for the thumbnail after the
+                    // prefetch was cancelled.
+                    for completion in completions {
+                        self.load(galleryItem: galleryItem, completion: completion)
+                    }
+                    return
+                }
+                if let image = image {
+                    self.cache.setObject(image, forKey: attachmentId as NSString, cost: Self.cost(image: image))
+                }
+                for completion in completions {
+                    completion(image)
+                }
+            }
+        }
+    }
+
+    private static func decoded(image: UIImage) -> UIImage {
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = image.scale
+        let renderer = UIGraphicsImageRenderer(size: image.size, format: format)
+        return renderer.image { _ in
+            image.draw(at: .zero)
+        }
+    }
+
+    private static func cost(image: UIImage) -> Int {
+        Int(image.size.width * image.scale * image.size.height * image.scale * 4)
     }
 }
@@ -636,7 +636,7 @@ extension PhotoCapture: CaptureOutputDelegate {
         case .failure(let error):
             delegate.photoCapture(self, processingDidError: error)
         case .success(let movieUrl):
-            guard let dataSource = try? DataSourcePath.dataSource(with: movieUrl, shouldDeleteOnDeallocation: true) else {
+            guard let dataSource = try? DataSourceMappedPath.dataSource(with: movieUrl, shouldDeleteOnDeallocation: true) else {
                 delegate.photoCapture(self, processingDidError: PhotoCaptureError.captureFailed)
                 return
             }
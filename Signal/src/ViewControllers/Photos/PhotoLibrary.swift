@@ -214,8 +214,13 @@ class PhotoCollectionContents {
     func outgoingAttachment(for asset: PHAsset, imageQuality: TSImageQuality) -> Promise<SignalAttachment> {
         switch asset.mediaType {
         case .image:
-            return requestImageDataSource(for: asset).map(on: .global()) { (dataSource: DataSource, dataUTI: String) in
-                return SignalAttachment.attachment(dataSource: dataSource, dataUTI: dataUTI, imageQuality: imageQuality)
+            // Reselecting an unmodified asset reuses the earlier conversion.
+            let modificationTimestamp = asset.modificationDate?.ows_millisecondsSince1970 ?? 0
+            let cacheKey = "\(asset.localIdentifier).\(modificationTimestamp).\(imageQuality.rawValue)"
+            return SignalAttachment.preparedAttachment(cacheKey: cacheKey) {
+                self.requestImageDataSource(for: asset).map(on: .global()) { (dataSource: DataSource, dataUTI: String) in
+                    return SignalAttachment.attachment(dataSource: dataSource, dataUTI: dataUTI, imageQuality: imageQuality)
+                }
             }
         case .video:
             return requestVideoDataSource(for: asset)
@@ -604,7 +604,7 @@ extension ConversationSettingsViewController {
 
         // "Add Members" cell.
         if canEditConversationMembership {
-            section.add(OWSTableItem(customCellBlock: { [weak self] in
+            let addMembersItem = OWSTableItem(customCellBlock: { [weak self] in
                 guard let self = self else {
                     owsFailDebug("Missing self")
                     return OWSTableItem.newCell()
@@ -633,7 +633,9 @@ extension ConversationSettingsViewController {
                 return cell
                 }) { [weak self] in
                                         self?.showAddMembersView()
-            })
+            }
+            addMembersItem.identifier = "addMembers"
+            section.add(addMembersItem)
         }
 
         let groupMembership = groupModel.groupMembership
@@ -687,7 +689,7 @@ extension ConversationSettingsViewController {
             }
 
             let isLocalUser = memberAddress == localAddress
-            section.add(OWSTableItem(customCellBlock: { [weak self] in
+            let memberItem = OWSTableItem(customCellBlock: { [weak self] in
                 guard let self = self else {
                     owsFailDebug("Missing self")
                     return OWSTableItem.newCell()
@@ -734,11 +736,13 @@ extension ConversationSettingsViewController {
                 return cell
                 }) { [weak self] in
                                         self?.didSelectGroupMember(memberAddress)
-            })
+            }
+            memberItem.identifier = "member.\(memberAddress.serviceIdentifier ?? memberAddress.stringForDisplay)"
+            section.add(memberItem)
         }
 
         if hasMoreMembers {
-            section.add(OWSTableItem(customCellBlock: { [weak self] in
+            let showAllMembersItem = OWSTableItem(customCellBlock: { [weak self] in
                 guard let self = self else {
                     owsFailDebug("Missing self")
                     return OWSTableItem.newCell()
@@ -768,7 +772,9 @@ extension ConversationSettingsViewController {
                 return cell
                 }) { [weak self] in
                                         self?.showAllGroupMembers()
-            })
+            }
+            showAllMembersItem.identifier = "showAllMembers"
+            section.add(showAllMembersItem)
         }
 
         return section
@@ -333,6 +333,7 @@ NSString *const kNSUserDefaults_DidTerminateKey = @"kNSUserDefaults_DidTerminate
         if (self.backup.hasPendingRestoreDecision) {
             [self showBackupRestoreView];
         } else {
+            [LaunchTimer.shared beginPhase:LaunchPhaseFirstConversationListRender];
             [self showConversationSplitView];
         }
     } else {
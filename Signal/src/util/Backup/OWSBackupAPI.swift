@@ -24,6 +24,19 @@ import PromiseKit
     static let payloadKey = "payload"
     static let maxRetries = 5
 
+    // CloudKit's internal limit is 400, but I haven't found a constant for this.
+    static let maxSaveBatchSize = 100
+    // Large requests are slow to retry and more likely to exceed CloudKit's
+    // request size limit, so batches are also limited by their asset sizes.
+    static let maxSaveBatchByteCount: UInt64 = 32 * 1024 * 1024
+    static let maxConcurrentSaveOperations = 3
+
+    // When CloudKit rate limits us, no new requests are made until this date.
+    //
+    // This property should only be accessed while holding the lock.
+    private static var rateLimitedUntil: Date?
+    private static let rateLimitLock = UnfairLock()
+
     private class func database() -> CKDatabase {
         let myContainer = CKContainer.default()
         let privateDatabase = myContainer.privateCloudDatabase
@@ -133,16 +146,70 @@ import PromiseKit
         return AnyPromise(saveRecordsToCloud(records: records))
     }
 
+    // Batches are saved by several concurrent operations.
     public class func saveRecordsToCloud(records: [CKRecord]) -> Promise<Void> {
-
-        // CloudKit's internal limit is 400, but I haven't found a constant for this.
-        let kMaxBatchSize = 100
-        return records.chunked(by: kMaxBatchSize).reduce(Promise.value(())) { (promise, batch) -> Promise<Void> in
-            return promise.then(on: .global()) {
-                saveRecordsToCloud(records: batch, remainingRetries: maxRetries)
+        let workQueue = BoundedWorkQueue(label: "org.signal.backup.saveRecords",
+                                         maxConcurrentCount: maxConcurrentSaveOperations,
+                                         qos: .utility)
+        let promises = saveBatches(records: records).map { batch in
+            workQueue.enqueue {
+                waitForRateLimit().then(on: .global()) {
+                    saveRecordsToCloud(records: batch, remainingRetries: maxRetries)
                 }.done {
                     Logger.verbose("Saved batch: \(batch.count)")
+                }
+            }
+        }
+        return when(fulfilled: promises)
+    }
+
+    private class func saveBatches(records: [CKRecord]) -> [[CKRecord]] {
+        var batches = [[CKRecord]]()
+        var batch = [CKRecord]()
+        var batchByteCount: UInt64 = 0
+        for record in records {
+            let recordByteCount = assetByteCount(record: record)
+            if !batch.isEmpty,
+               batch.count >= maxSaveBatchSize || batchByteCount + recordByteCount > maxSaveBatchByteCount {
+                batches.append(batch)
+                batch = []
+                batchByteCount = 0
+            }
+            batch.append(record)
+            batchByteCount += recordByteCount
+        }
+        if !batch.isEmpty {
+            batches.append(batch)
+        }
+        return batches
+    }
+
+    private class func assetByteCount(record: CKRecord) -> UInt64 {
+        guard let asset = record[payloadKey] as? CKAsset,
+              let fileUrl = asset.fileURL else {
+            return 0
+        }
+        return OWSFileSystem.fileSize(ofPath: fileUrl.path)?.uint64Value ?? 0
+    }
+
+    private class func waitForRateLimit() -> Guarantee<Void> {
+        let delay = rateLimitLock.withLock {
+            rateLimitedUntil?.timeIntervalSinceNow ?? 0
+        }
+        guard delay > 0 else {
+            return Guarantee.value(())
+        }
+        Logger.verbose("Waiting for rate limit: \(delay).")
+        return after(seconds: delay)
+    }
+
+    private class func didRateLimit(retryDelay: TimeInterval) {
+        let retryDate = Date(timeIntervalSinceNow: retryDelay)
+        rateLimitLock.withLock {
+            if let rateLimitedUntil = rateLimitedUntil, rateLimitedUntil > retryDate {
+                return
             }
+            rateLimitedUntil = retryDate
         }
     }
 
@@ -152,12 +219,32 @@ import PromiseKit
         let recordNames = records.map { (record) in
             return record.recordID.recordName
         }
-        Logger.verbose("recordNames[\(recordNames.count)] \(recordNames[0..<10])...")
+        Logger.verbose("recordNames[\(recordNames.count)] \(recordNames.prefix(10))...")
 
         return Promise { resolver in
             let saveOperation = CKModifyRecordsOperation(recordsToSave: records, recordIDsToDelete: nil)
             saveOperation.modifyRecordsCompletionBlock = { (savedRecords: [CKRecord]?, _, error) in
 
+                if let error = error as? CKError,
+                   error.code == CKError.limitExceeded,
+                   records.count > 1 {
+                    // The request was too large, so save the records in
+                    // smaller batches.
+                    Logger.verbose("Splitting batch: \(records.count).")
+                    let halfCount = records.count / 2
+                    let firstHalf = Array(records.prefix(halfCount))
+                    let secondHalf = Array(records.suffix(from: halfCount))
+                    saveRecordsToCloud(records: firstHalf, remainingRetries: remainingRetries)
+                        .then(on: .global()) {
+                            saveRecordsToCloud(records: secondHalf, remainingRetries: remainingRetries)
+                        }.done {
+                            resolver.fulfill(())
+                        }.catch { error in
+                            resolver.reject(error)
+                        }
+                    return
+                }
+
                 let retry = {
                     // Only retry records which didn't already succeed.
                     var savedRecordNames = [String]()
@@ -671,10 +758,26 @@ import PromiseKit
                 return .failureRetryWithoutDelay
             }
 
+            if error.code == CKError.partialFailure,
+               let partialErrors = error.partialErrorsByItemID?.values {
+                // Records which failed only because others in their batch
+                // did report batchRequestFailed, so use the underlying error.
+                let partialError = partialErrors.first { partialError in
+                    (partialError as? CKError)?.code != CKError.batchRequestFailed
+                } ?? partialErrors.first
+                if let partialError = partialError as? CKError,
+                   partialError.code != CKError.unknownItem {
+                    return outcomeForCloudKitError(error: partialError,
+                                                   remainingRetries: remainingRetries,
+                                                   label: label)
+                }
+            }
+
             switch error {
             case CKError.requestRateLimited, CKError.serviceUnavailable, CKError.zoneBusy:
                 let retryDelay = error.retryAfterSeconds ?? 3.0
                 Logger.verbose("\(label) retry with delay: \(retryDelay).")
+                didRateLimit(retryDelay: retryDelay)
                 return .failureRetryAfterDelay(retryDelay:retryDelay)
             case CKError.networkFailure:
                 Logger.verbose("\(label) retry without delay.")
@@ -8,10 +8,12 @@
 #import "Signal-Swift.h"
 #import <CloudKit/CloudKit.h>
 #import <PromiseKit/AnyPromise.h>
+#import <SignalCoreKit/Cryptography.h>
 #import <SignalCoreKit/NSData+OWS.h>
 #import <SignalCoreKit/NSDate+OWS.h>
 #import <SignalCoreKit/Threading.h>
 #import <SignalServiceKit/OWSBackgroundTask.h>
+#import <SignalServiceKit/OWSBackupFragment.h>
 #import <SignalServiceKit/OWSError.h>
 #import <SignalServiceKit/OWSFileSystem.h>
 #import <SignalServiceKit/TSAttachment.h>
@@ -37,6 +39,11 @@ NS_ASSUME_NONNULL_BEGIN
 // See comments in `OWSBackupIO`.
 @property (nonatomic, nullable) NSNumber *uncompressedDataLength;
 
+// This property is optional and is only used for database snapshots.
+//
+// The SHA-256 digest of the uncompressed snapshot fragment.
+@property (nonatomic, nullable) NSData *contentDigest;
+
 + (instancetype)new NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
 
@@ -63,6 +70,24 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark -
 
+typedef OWSBackupExportItem *_Nullable (^OWSBackupRecycleItemBlock)(NSData *contentDigest);
+
+// A snapshot fragment's place in the backup. Its export item is set
+// once the fragment has been compressed and encrypted.
+@interface OWSDBExportFragment : NSObject
+
+@property (atomic, nullable) OWSBackupExportItem *exportItem;
+
+@end
+
+#pragma mark -
+
+@implementation OWSDBExportFragment
+
+@end
+
+#pragma mark -
+
 // Used to serialize database snapshot contents.
 // Writes db entities using protobufs into snapshot fragments.
 // Snapshot fragments are compressed (they compress _very well_,
@@ -74,13 +99,40 @@ NS_ASSUME_NONNULL_BEGIN
 //
 // This stream is used to write entities one at a time and takes
 // care of sharding them into fragments, compressing and encrypting
-// those fragments.  Fragment size is fixed to reduce worst case
+// those fragments.  Fragment size is bounded to reduce worst case
 // memory usage.
+//
+// Fragment boundaries are chosen by the keys of the entities, not
+// their position, so that an insertion or deletion only changes the
+// fragment which contains it.  Unchanged fragments have the same
+// contents as in the last backup and can be recycled, much like
+// attachments.  Every backup is still a full snapshot, so there are
+// no deltas to apply on import or to compact.
+//
+// Fragments are compressed and encrypted on a concurrent queue while
+// the next fragments are serialized.  Only a few fragments may be in
+// flight at once; once that many are, serialization waits.
 @interface OWSDBExportStream : NSObject
 
 @property (nonatomic) OWSBackupIO *backupIO;
 
-@property (nonatomic) NSMutableArray<OWSBackupExportItem *> *exportItems;
+// Returns an already saved export item with the same contents, if any.
+@property (nonatomic, nullable) OWSBackupRecycleItemBlock recycleItemBlock;
+
+// Only set once the stream has finished.
+@property (nonatomic) NSArray<OWSBackupExportItem *> *exportItems;
+
+// In the order they were written.
+@property (nonatomic) NSMutableArray<OWSDBExportFragment *> *fragments;
+
+@property (nonatomic) dispatch_queue_t fragmentQueue;
+
+@property (nonatomic) dispatch_group_t fragmentGroup;
+
+// Bounds the number of fragments in flight.
+@property (nonatomic) dispatch_semaphore_t fragmentSemaphore;
+
+@property (atomic) BOOL hasFragmentFailure;
 
 @property (nonatomic, nullable) SignalIOSProtoBackupSnapshotBuilder *backupSnapshotBuilder;
 
@@ -88,6 +140,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic) NSUInteger totalItemCount;
 
+@property (nonatomic) NSUInteger recycledFragmentCount;
+
 + (instancetype)new NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
 
@@ -105,9 +159,16 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSAssertDebug(backupIO);
 
-    self.exportItems = [NSMutableArray new];
+    self.exportItems = @[];
+    self.fragments = [NSMutableArray new];
     self.backupIO = backupIO;
 
+    // Each fragment in flight holds its uncompressed and compressed data.
+    NSUInteger maxFragmentsInFlight = MAX(1, MIN(NSProcessInfo.processInfo.activeProcessorCount, 4));
+    self.fragmentQueue = dispatch_queue_create("org.signal.backup.export-fragments", DISPATCH_QUEUE_CONCURRENT);
+    self.fragmentGroup = dispatch_group_create();
+    self.fragmentSemaphore = dispatch_semaphore_create((long)maxFragmentsInFlight);
+
     return self;
 }
 
@@ -150,8 +211,10 @@ NS_ASSUME_NONNULL_BEGIN
     self.cachedItemCount = self.cachedItemCount + 1;
     self.totalItemCount = self.totalItemCount + 1;
 
+    static const int kMinDBSnapshotSize = 100;
     static const int kMaxDBSnapshotSize = 1000;
-    if (self.cachedItemCount > kMaxDBSnapshotSize) {
+    if (self.cachedItemCount > kMaxDBSnapshotSize
+        || (self.cachedItemCount > kMinDBSnapshotSize && [self isFragmentBoundaryKey:key])) {
         @autoreleasepool {
             return [self flush];
         }
@@ -160,11 +223,35 @@ NS_ASSUME_NONNULL_BEGIN
     return YES;
 }
 
+// Roughly one in every 400 keys ends a fragment, so fragments
+// hold ~500 entities on average.
+- (BOOL)isFragmentBoundaryKey:(NSString *)key
+{
+    uint32_t hashValue = 0;
+    NSData *_Nullable keyData = [key dataUsingEncoding:NSUTF8StringEncoding];
+    if (!keyData) {
+        OWSFailDebug(@"could not get data from key.");
+        return NO;
+    }
+    NSData *_Nullable hashData = [Cryptography computeSHA256Digest:keyData truncatedToBytes:sizeof(hashValue)];
+    if (!hashData) {
+        OWSFailDebug(@"could not hash key.");
+        return NO;
+    }
+    [hashData getBytes:&hashValue length:sizeof(hashValue)];
+    return (hashValue % 400) == 0;
+}
+
 // Write cached data to disk, if necessary.
 //
+// The data is written asynchronously; see `finish`.
+//
 // Returns YES on success.
 - (BOOL)flush
 {
+    if (self.hasFragmentFailure) {
+        return NO;
+    }
     if (!self.backupSnapshotBuilder) {
         // No data to flush to disk.
         return YES;
@@ -187,22 +274,75 @@ NS_ASSUME_NONNULL_BEGIN
             return NO;
         }
 
-        NSData *compressedData = [self.backupIO compressData:uncompressedData];
-
-        OWSBackupEncryptedItem *_Nullable encryptedItem = [self.backupIO encryptDataAsTempFile:compressedData];
-        if (!encryptedItem) {
-            OWSFailDebug(@"couldn't encrypt database snapshot.");
-            return NO;
+        NSData *_Nullable contentDigest = [Cryptography computeSHA256Digest:uncompressedData];
+        if (contentDigest && self.recycleItemBlock) {
+            OWSBackupExportItem *_Nullable recycledItem = self.recycleItemBlock(contentDigest);
+            if (recycledItem) {
+                // No need to compress, encrypt or upload this fragment again.
+                OWSDBExportFragment *fragment = [OWSDBExportFragment new];
+                fragment.exportItem = recycledItem;
+                [self.fragments addObject:fragment];
+                self.recycledFragmentCount = self.recycledFragmentCount + 1;
+                return YES;
+            }
         }
 
-        OWSBackupExportItem *exportItem = [[OWSBackupExportItem alloc] initWithEncryptedItem:encryptedItem];
-        exportItem.uncompressedDataLength = @(uncompressedDataLength);
-        [self.exportItems addObject:exportItem];
+        OWSDBExportFragment *fragment = [OWSDBExportFragment new];
+        [self.fragments addObject:fragment];
+
+        dispatch_semaphore_wait(self.fragmentSemaphore, DISPATCH_TIME_FOREVER);
+        OWSBackupIO *backupIO = self.backupIO;
+        dispatch_group_async(self.fragmentGroup, self.fragmentQueue, ^{
+            @autoreleasepool {
+                NSData *compressedData = [backupIO compressData:uncompressedData];
+
+                OWSBackupEncryptedItem *_Nullable encryptedItem = [backupIO encryptDataAsTempFile:compressedData];
+                if (!encryptedItem) {
+                    OWSFailDebug(@"couldn't encrypt database snapshot.");
+                    self.hasFragmentFailure = YES;
+                } else {
+                    OWSBackupExportItem *exportItem = [[OWSBackupExportItem alloc] initWithEncryptedItem:encryptedItem];
+                    exportItem.uncompressedDataLength = @(uncompressedDataLength);
+                    exportItem.contentDigest = contentDigest;
+                    fragment.exportItem = exportItem;
+                }
+            }
+            dispatch_semaphore_signal(self.fragmentSemaphore);
+        });
     }
 
     return YES;
 }
 
+// Write any cached data and wait for all fragments to be written,
+// then set `exportItems`.
+//
+// Returns YES on success.
+- (BOOL)finish
+{
+    BOOL didFlush = [self flush];
+    [self waitForFragments];
+    if (!didFlush || self.hasFragmentFailure) {
+        return NO;
+    }
+
+    NSMutableArray<OWSBackupExportItem *> *exportItems = [NSMutableArray new];
+    for (OWSDBExportFragment *fragment in self.fragments) {
+        if (!fragment.exportItem) {
+            OWSFailDebug(@"Missing export item.");
+            return NO;
+        }
+        [exportItems addObject:fragment.exportItem];
+    }
+    self.exportItems = [exportItems copy];
+    return YES;
+}
+
+- (void)waitForFragments
+{
+    dispatch_group_wait(self.fragmentGroup, DISPATCH_TIME_FOREVER);
+}
+
 @end
 
 #pragma mark -
@@ -317,6 +457,10 @@ NS_ASSUME_NONNULL_BEGIN
 // If we are replacing an existing backup, we use some of its contents for continuity.
 @property (nonatomic, nullable) NSSet<NSString *> *lastValidRecordNames;
 
+// Metadata for the database fragments of past backups, keyed by the hex
+// of their content digests.
+@property (nonatomic, nullable) NSDictionary<NSString *, OWSBackupFragment *> *recyclableDatabaseFragments;
+
 @end
 
 #pragma mark -
@@ -344,6 +488,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark -
 
+// Maps the hex of each saved database fragment's content digest
+// to its record name.
++ (SDSKeyValueStore *)databaseFragmentStore
+{
+    static SDSKeyValueStore *keyValueStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        keyValueStore = [[SDSKeyValueStore alloc] initWithCollection:@"OWSBackupExportJob.databaseFragments"];
+    });
+    return keyValueStore;
+}
+
+#pragma mark -
+
 - (void)start
 {
     OWSAssertIsOnMainThread();
@@ -477,7 +635,12 @@ NS_ASSUME_NONNULL_BEGIN
                                             @"Indicates that the database data is being exported.")
                                progress:nil];
 
+    [self loadRecyclableDatabaseFragments];
+
     OWSDBExportStream *exportStream = [[OWSDBExportStream alloc] initWithBackupIO:self.backupIO];
+    exportStream.recycleItemBlock = ^(NSData *contentDigest) {
+        return [self tryToRecycleDatabaseItemWithContentDigest:contentDigest];
+    };
 
     __block BOOL aborted = NO;
     typedef BOOL (^EntityFilter)(id object);
@@ -492,7 +655,9 @@ NS_ASSUME_NONNULL_BEGIN
     __block NSUInteger copiedAttachments = 0;
     __block NSUInteger copiedMisc = 0;
     self.unsavedAttachmentExports = [NSMutableArray new];
-    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+    // Export from a copy of the database, so that message processing can keep
+    // writing, and the WAL can be checkpointed, while we serialize everything.
+    BOOL didReadCopy = [self.databaseStorage bulkScanReadCopyWithBlock:^(SDSAnyReadTransaction *transaction) {
         [TSThread anyEnumerateWithTransaction:transaction
                                       batched:YES
                                         block:^(TSThread *object, BOOL *stop) {
@@ -514,99 +679,103 @@ NS_ASSUME_NONNULL_BEGIN
                                                 return;
                                             }
                                         }];
-        if (aborted) {
+        // End the fragment, so that changes to threads don't
+        // change the fragments of the next collection.
+        if (aborted || ![exportStream flush]) {
+            aborted = YES;
             return;
         }
         [TSAttachment
-            anyEnumerateWithTransaction:transaction
-                                batched:YES
-                                  block:^(TSAttachment *object, BOOL *stop) {
-                                      NSString *collection = TSAttachment.collection;
-                                      SignalIOSProtoBackupSnapshotBackupEntityType entityType
-                                          = SignalIOSProtoBackupSnapshotBackupEntityTypeAttachment;
-
-                                      if (self.isComplete) {
-                                          *stop = YES;
-                                          return;
-                                      }
-
-                                      TSYapDatabaseObject *objectToWrite = object;
-                                      // No need to backup the contents (e.g. the file on disk)
-                                      // of attachment pointers.
-                                      // After a restore, users will be able "tap to retry".
-                                      if ([object isKindOfClass:[TSAttachmentStream class]]) {
-                                          TSAttachmentStream *attachmentStream = (TSAttachmentStream *)object;
-                                          NSString *_Nullable filePath = attachmentStream.originalFilePath;
-                                          if (!filePath || ![NSFileManager.defaultManager fileExistsAtPath:filePath]) {
-                                              OWSFailDebug(@"attachment is missing file.");
-                                              return;
-                                          }
-
-                                          // OWSAttachmentExport is used to lazily write an encrypted copy of the
-                                          // attachment to disk.
-                                          OWSAttachmentExport *attachmentExport =
-                                              [[OWSAttachmentExport alloc] initWithBackupIO:self.backupIO
-                                                                               attachmentId:attachmentStream.uniqueId
-                                                                         attachmentFilePath:filePath];
-                                          [self.unsavedAttachmentExports addObject:attachmentExport];
-
-
-                                          // Convert attachment streams to pointers,
-                                          // since we'll need to restore them.
-                                          objectToWrite = [[TSAttachmentPointer alloc]
-                                              initForRestoreWithAttachmentStream:attachmentStream];
-                                      }
-
-                                      copiedAttachments++;
-                                      if (![exportStream writeObject:objectToWrite
-                                                          collection:collection
-                                                                 key:object.uniqueId
-                                                          entityType:entityType]) {
-                                          *stop = YES;
-                                          aborted = YES;
-                                          return;
-                                      }
-                                  }];
-        if (aborted) {
+            anyEnumerateInParallelWithTransaction:transaction
+                                            block:^(TSAttachment *object, BOOL *stop) {
+                                                NSString *collection = TSAttachment.collection;
+                                                SignalIOSProtoBackupSnapshotBackupEntityType entityType
+                                                    = SignalIOSProtoBackupSnapshotBackupEntityTypeAttachment;
+
+                                                if (self.isComplete) {
+                                                    *stop = YES;
+                                                    return;
+                                                }
+
+                                                TSYapDatabaseObject *objectToWrite = object;
+                                                // No need to backup the contents (e.g. the file on disk)
+                                                // of attachment pointers.
+                                                // After a restore, users will be able "tap to retry".
+                                                if ([object isKindOfClass:[TSAttachmentStream class]]) {
+                                                    TSAttachmentStream *attachmentStream = (TSAttachmentStream *)object;
+                                                    NSString *_Nullable filePath = attachmentStream.originalFilePath;
+                                                    if (!filePath ||
+                                                        ![NSFileManager.defaultManager fileExistsAtPath:filePath]) {
+                                                        OWSFailDebug(@"attachment is missing file.");
+                                                        return;
+                                                    }
+
+                                                    // OWSAttachmentExport is used to lazily write an encrypted copy
+                                                    // of the attachment to disk.
+                                                    OWSAttachmentExport *attachmentExport = [[OWSAttachmentExport alloc]
+                                                          initWithBackupIO:self.backupIO
+                                                              attachmentId:attachmentStream.uniqueId
+                                                        attachmentFilePath:filePath];
+                                                    [self.unsavedAttachmentExports addObject:attachmentExport];
+
+
+                                                    // Convert attachment streams to pointers,
+                                                    // since we'll need to restore them.
+                                                    objectToWrite = [[TSAttachmentPointer alloc]
+                                                        initForRestoreWithAttachmentStream:attachmentStream];
+                                                }
+
+                                                copiedAttachments++;
+                                                if (![exportStream writeObject:objectToWrite
+                                                                    collection:collection
+                                                                           key:object.uniqueId
+                                                                    entityType:entityType]) {
+                                                    *stop = YES;
+                                                    aborted = YES;
+                                                    return;
+                                                }
+                                            }];
+        if (aborted || ![exportStream flush]) {
+            aborted = YES;
             return;
         }
 
         // Interactions refer to threads and attachments, so copy after them.
         [TSInteraction
-            anyEnumerateWithTransaction:transaction
-                                batched:YES
-                                  block:^(TSInteraction *object, BOOL *stop) {
-                                      NSString *collection = TSInteraction.collection;
-                                      SignalIOSProtoBackupSnapshotBackupEntityType entityType
-                                          = SignalIOSProtoBackupSnapshotBackupEntityTypeInteraction;
-
-                                      if (self.isComplete) {
-                                          *stop = YES;
-                                          return;
-                                      }
-
-                                      // Ignore both kinds of disappearing messages.
-                                      if ([object isKindOfClass:[TSMessage class]]) {
-                                          TSMessage *message = (TSMessage *)object;
-                                          if (message.hasPerConversationExpiration || message.isViewOnceMessage) {
-                                              return;
-                                          }
-                                      }
-                                      // Ignore dynamic interactions.
-                                      if (object.isDynamicInteraction) {
-                                          return;
-                                      }
-
-                                      copiedInteractions++;
-                                      if (![exportStream writeObject:object
-                                                          collection:collection
-                                                                 key:object.uniqueId
-                                                          entityType:entityType]) {
-                                          *stop = YES;
-                                          aborted = YES;
-                                          return;
-                                      }
-                                  }];
+            anyEnumerateInParallelWithTransaction:transaction
+                                            block:^(TSInteraction *object, BOOL *stop) {
+                                                NSString *collection = TSInteraction.collection;
+                                                SignalIOSProtoBackupSnapshotBackupEntityType entityType
+                                                    = SignalIOSProtoBackupSnapshotBackupEntityTypeInteraction;
+
+                                                if (self.isComplete) {
+                                                    *stop = YES;
+                                                    return;
+                                                }
+
+                                                // Ignore both kinds of disappearing messages.
+                                                if ([object isKindOfClass:[TSMessage class]]) {
+                                                    TSMessage *message = (TSMessage *)object;
+                                                    if (message.hasPerConversationExpiration
+                                                        || message.isViewOnceMessage) {
+                                                        return;
+                                                    }
+                                                }
+                                                // Ignore dynamic interactions.
+                                                if (object.isDynamicInteraction) {
+                                                    return;
+                                                }
+
+                                                copiedInteractions++;
+                                                if (![exportStream writeObject:object
+                                                                    collection:collection
+                                                                           key:object.uniqueId
+                                                                    entityType:entityType]) {
+                                                    *stop = YES;
+                                                    aborted = YES;
+                                                    return;
+                                                }
+                                            }];
         if (aborted) {
             return;
         }
@@ -614,12 +783,14 @@ NS_ASSUME_NONNULL_BEGIN
         // POST GRDB TODO: After GRDB migration, backup MiscCollectionsToBackup().
     }];
 
-    if (aborted || self.isComplete) {
+    if (!didReadCopy || aborted || self.isComplete) {
+        // Don't write fragments after the job has cleaned up.
+        [exportStream waitForFragments];
         return NO;
     }
 
     @autoreleasepool {
-        if (![exportStream flush]) {
+        if (![exportStream finish]) {
             OWSFailDebug(@"Could not flush database snapshots.");
             return NO;
         }
@@ -634,10 +805,56 @@ NS_ASSUME_NONNULL_BEGIN
     OWSLogInfo(@"copiedAttachments: %zd", copiedAttachments);
     OWSLogInfo(@"copiedMisc: %zd", copiedMisc);
     OWSLogInfo(@"copiedEntities: %zd", exportStream.totalItemCount);
+    OWSLogInfo(@"recycledFragments: %zd of %zd", exportStream.recycledFragmentCount, exportStream.exportItems.count);
 
     return YES;
 }
 
+- (void)loadRecyclableDatabaseFragments
+{
+    NSMutableDictionary<NSString *, OWSBackupFragment *> *fragments = [NSMutableDictionary new];
+    if (self.lastValidRecordNames) {
+        [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+            NSDictionary<NSString *, id> *recordNames =
+                [OWSBackupExportJob.databaseFragmentStore allKeysAndObjectsWithTransaction:transaction];
+            [recordNames enumerateKeysAndObjectsUsingBlock:^(NSString *digestHex, id recordName, BOOL *stop) {
+                if (![recordName isKindOfClass:[NSString class]]) {
+                    OWSFailDebug(@"Invalid record name.");
+                    return;
+                }
+                OWSBackupFragment *_Nullable fragment = [OWSBackupFragment anyFetchWithUniqueId:recordName
+                                                                                    transaction:transaction];
+                if (fragment) {
+                    fragments[digestHex] = fragment;
+                }
+            }];
+        }];
+    }
+    self.recyclableDatabaseFragments = fragments;
+}
+
+// Like tryToSkipAttachmentUpload:, reuses a database fragment of the last
+// backup if it has the same contents and is still in our CloudKit database.
+- (nullable OWSBackupExportItem *)tryToRecycleDatabaseItemWithContentDigest:(NSData *)contentDigest
+{
+    OWSAssertDebug(contentDigest.length > 0);
+
+    OWSBackupFragment *_Nullable lastBackupFragment = self.recyclableDatabaseFragments[contentDigest.hexadecimalString];
+    if (!lastBackupFragment || ![self.lastValidRecordNames containsObject:lastBackupFragment.recordName]) {
+        return nil;
+    }
+    OWSAssertDebug(lastBackupFragment.encryptionKey.length > 0);
+
+    OWSBackupEncryptedItem *encryptedItem = [OWSBackupEncryptedItem new];
+    encryptedItem.encryptionKey = lastBackupFragment.encryptionKey;
+
+    OWSBackupExportItem *exportItem = [[OWSBackupExportItem alloc] initWithEncryptedItem:encryptedItem];
+    exportItem.recordName = lastBackupFragment.recordName;
+    exportItem.uncompressedDataLength = lastBackupFragment.uncompressedDataLength;
+    exportItem.contentDigest = contentDigest;
+    return exportItem;
+}
+
 - (AnyPromise *)saveToCloud
 {
     OWSLogVerbose(@"");
@@ -654,6 +871,10 @@ NS_ASSUME_NONNULL_BEGIN
     {
         unsigned long long databaseFileSize = 0;
         for (OWSBackupExportItem *item in self.unsavedDatabaseItems) {
+            if (item.encryptedItem.filePath.length < 1) {
+                // Recycled items aren't uploaded again.
+                continue;
+            }
             unsigned long long fileSize =
                 [OWSFileSystem fileSizeOfPath:item.encryptedItem.filePath].unsignedLongLongValue;
             ows_add_overflow(databaseFileSize, fileSize, &databaseFileSize);
@@ -712,9 +933,15 @@ NS_ASSUME_NONNULL_BEGIN
         return [AnyPromise promiseWithValue:OWSBackupErrorWithDescription(@"Backup export no longer active.")];
     }
 
+    // Recycled items are already saved, but the manifest must list
+    // all items in the order they were exported.
     NSArray<OWSBackupExportItem *> *items = [self.unsavedDatabaseItems copy];
+    NSMutableArray<OWSBackupExportItem *> *uploadItems = [NSMutableArray new];
     NSMutableArray<CKRecord *> *records = [NSMutableArray new];
     for (OWSBackupExportItem *item in items) {
+        if (item.recordName.length > 0) {
+            continue;
+        }
         OWSAssertDebug(item.encryptedItem.filePath.length > 0);
 
         NSString *recordName =
@@ -722,20 +949,39 @@ NS_ASSUME_NONNULL_BEGIN
         CKRecord *record =
             [OWSBackupAPI recordForFileUrl:[NSURL fileURLWithPath:item.encryptedItem.filePath] recordName:recordName];
         [records addObject:record];
+        [uploadItems addObject:item];
     }
 
     // TODO: Expose progress.
     return [OWSBackupAPI saveRecordsToCloudObjcWithRecords:records].thenInBackground(^{
-        OWSAssertDebug(items.count == records.count);
-        NSUInteger count = MIN(items.count, records.count);
+        OWSAssertDebug(uploadItems.count == records.count);
+        NSUInteger count = MIN(uploadItems.count, records.count);
         for (NSUInteger i = 0; i < count; i++) {
-            OWSBackupExportItem *item = items[i];
+            OWSBackupExportItem *item = uploadItems[i];
             CKRecord *record = records[i];
 
             OWSAssertDebug(record.recordID.recordName.length > 0);
             item.recordName = record.recordID.recordName;
         }
 
+        // Save the record metadata so that later backups can recycle these items.
+        DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+            for (NSUInteger i = 0; i < count; i++) {
+                OWSBackupExportItem *item = uploadItems[i];
+                if (!item.contentDigest) {
+                    continue;
+                }
+                OWSBackupFragment *backupFragment = [[OWSBackupFragment alloc] initWithUniqueId:item.recordName];
+                backupFragment.recordName = item.recordName;
+                backupFragment.encryptionKey = item.encryptedItem.encryptionKey;
+                backupFragment.uncompressedDataLength = item.uncompressedDataLength;
+                [backupFragment anyUpsertWithTransaction:transaction];
+                [OWSBackupExportJob.databaseFragmentStore setString:item.recordName
+                                                                key:item.contentDigest.hexadecimalString
+                                                        transaction:transaction];
+            }
+        });
+
         [self.savedDatabaseItems addObjectsFromArray:items];
         [self.unsavedDatabaseItems removeObjectsInArray:items];
     });
@@ -981,11 +1227,14 @@ NS_ASSUME_NONNULL_BEGIN
         json[kOWSBackup_ManifestKey_LocalProfileAvatar] = [self jsonForItems:@[ self.localProfileAvatarItem ]];
     }
 
-    OWSLogVerbose(@"json: %@", json);
+    // The manifest lists every attachment, so it can be large. Write it compactly
+    // and don't log its contents.
+    OWSLogVerbose(@"databaseItems: %lu, attachmentItems: %lu",
+        (unsigned long)self.savedDatabaseItems.count,
+        (unsigned long)self.savedAttachmentItems.count);
 
     NSError *error;
-    NSData *_Nullable jsonData =
-        [NSJSONSerialization dataWithJSONObject:json options:NSJSONWritingPrettyPrinted error:&error];
+    NSData *_Nullable jsonData = [NSJSONSerialization dataWithJSONObject:json options:0 error:&error];
     if (!jsonData || error) {
         OWSFailDebug(@"error encoding manifest file: %@", error);
         return nil;
@@ -1084,11 +1333,10 @@ NS_ASSUME_NONNULL_BEGIN
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
         NSArray<NSString *> *allRecordNames = [OWSBackupFragment anyAllUniqueIdsWithTransaction:transaction];
 
-        NSMutableSet<NSString *> *obsoleteRecordNames = [NSMutableSet new];
-        [obsoleteRecordNames addObjectsFromArray:allRecordNames];
-        [obsoleteRecordNames minusSet:activeRecordNames];
-
-        for (NSString *uniqueId in obsoleteRecordNames) {
+        for (NSString *uniqueId in allRecordNames) {
+            if ([activeRecordNames containsObject:uniqueId]) {
+                continue;
+            }
             OWSBackupFragment *_Nullable instance =
                 [OWSBackupFragment anyFetchWithUniqueId:uniqueId transaction:transaction];
             if (instance == nil) {
@@ -1097,6 +1345,16 @@ NS_ASSUME_NONNULL_BEGIN
             }
             [instance anyRemoveWithTransaction:transaction];
         }
+
+        SDSKeyValueStore *databaseFragmentStore = OWSBackupExportJob.databaseFragmentStore;
+        NSDictionary<NSString *, id> *databaseFragmentRecordNames =
+            [databaseFragmentStore allKeysAndObjectsWithTransaction:transaction];
+        [databaseFragmentRecordNames enumerateKeysAndObjectsUsingBlock:^(
+            NSString *digestHex, id recordName, BOOL *stop) {
+            if (![activeRecordNames containsObject:recordName]) {
+                [databaseFragmentStore removeValueForKey:digestHex transaction:transaction];
+            }
+        }];
     });
 }
 
@@ -1112,16 +1370,21 @@ NS_ASSUME_NONNULL_BEGIN
     return [AnyPromise promiseWithResolverBlock:^(PMKResolver resolve) {
         [OWSBackupAPI fetchAllRecordNamesWithRecipientId:self.recipientId
             success:^(NSArray<NSString *> *recordNames) {
-                NSMutableSet<NSString *> *obsoleteRecordNames = [NSMutableSet new];
-                [obsoleteRecordNames addObjectsFromArray:recordNames];
-                [obsoleteRecordNames minusSet:activeRecordNames];
+                // Diff against the active record names in a single pass, rather
+                // than copying every record name into another set.
+                NSMutableArray<NSString *> *obsoleteRecordNames = [NSMutableArray new];
+                for (NSString *recordName in recordNames) {
+                    if (![activeRecordNames containsObject:recordName]) {
+                        [obsoleteRecordNames addObject:recordName];
+                    }
+                }
 
                 OWSLogVerbose(@"recordNames: %zd - activeRecordNames: %zd = obsoleteRecordNames: %zd",
                     recordNames.count,
                     activeRecordNames.count,
                     obsoleteRecordNames.count);
 
-                [self deleteRecordsFromCloud:[obsoleteRecordNames.allObjects mutableCopy]
+                [self deleteRecordsFromCloud:obsoleteRecordNames
                                 deletedCount:0
                                   completion:^(NSError *_Nullable error) {
                                       // Cloud cleanup is non-critical so any error is recoverable.
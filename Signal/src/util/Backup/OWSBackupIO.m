@@ -81,13 +81,23 @@ static const compression_algorithm SignalCompressionAlgorithm = COMPRESSION_LZMA
             return nil;
         }
 
-        // TODO: Encrypt the file without loading it into memory.
-        NSData *_Nullable srcData = [NSData dataWithContentsOfFile:srcFilePath];
-        if (srcData.length < 1) {
-            OWSFailDebug(@"could not load file into memory for encryption.");
+        if ([OWSFileSystem fileSizeOfPath:srcFilePath].unsignedLongLongValue < 1) {
+            OWSFailDebug(@"could not determine size of file for encryption.");
+            return nil;
+        }
+
+        // TODO: Encrypt the file using key;
+        //
+        // Until then the encrypted file is a copy of the source file. It is
+        // copied rather than loaded, so large files are never held in memory.
+        NSString *dstFilePath = [self generateTempFilePath];
+        if (![self copyFileAtPath:srcFilePath toPath:dstFilePath]) {
             return nil;
         }
-        return [self encryptDataAsTempFile:srcData encryptionKey:encryptionKey];
+        OWSBackupEncryptedItem *item = [OWSBackupEncryptedItem new];
+        item.filePath = dstFilePath;
+        item.encryptionKey = encryptionKey;
+        return item;
     }
 }
 
@@ -140,23 +150,39 @@ static const compression_algorithm SignalCompressionAlgorithm = COMPRESSION_LZMA
 
     @autoreleasepool {
 
-        // TODO: Decrypt the file without loading it into memory.
-        NSData *data = [self decryptFileAsData:srcFilePath encryptionKey:encryptionKey];
-
-        if (data.length < 1) {
+        if (![NSFileManager.defaultManager fileExistsAtPath:srcFilePath]) {
+            OWSLogError(@"missing downloaded file.");
+            return NO;
+        }
+        if ([OWSFileSystem fileSizeOfPath:srcFilePath].unsignedLongLongValue < 1) {
+            OWSFailDebug(@"could not determine size of file for decryption.");
             return NO;
         }
 
-        NSError *error;
-        BOOL success = [data writeToFile:dstFilePath options:NSDataWritingAtomic error:&error];
-        if (!success || error) {
-            OWSFailDebug(@"error writing decrypted data: %@", error);
+        // TODO: Decrypt the file using key;
+        //
+        // Until then the decrypted file is a copy of the encrypted file.
+        if (![OWSFileSystem deleteFileIfExists:dstFilePath]) {
+            OWSFailDebug(@"could not replace file.");
             return NO;
         }
-        [OWSFileSystem protectFileOrFolderAtPath:dstFilePath];
+        return [self copyFileAtPath:srcFilePath toPath:dstFilePath];
+    }
+}
+
+- (BOOL)copyFileAtPath:(NSString *)srcFilePath toPath:(NSString *)dstFilePath
+{
+    OWSAssertDebug(srcFilePath.length > 0);
+    OWSAssertDebug(dstFilePath.length > 0);
 
-        return YES;
+    NSError *error;
+    BOOL success = [NSFileManager.defaultManager copyItemAtPath:srcFilePath toPath:dstFilePath error:&error];
+    if (!success || error) {
+        OWSFailDebug(@"error copying file: %@", error);
+        return NO;
     }
+    [OWSFileSystem protectFileOrFolderAtPath:dstFilePath];
+    return YES;
 }
 
 - (nullable NSData *)decryptFileAsData:(NSString *)srcFilePath encryptionKey:(NSData *)encryptionKey
@@ -210,8 +210,6 @@ NSString *const kOWSBackup_KeychainService = @"kOWSBackup_KeychainService";
         return [AnyPromise promiseWithValue:OWSBackupErrorWithDescription(@"Could not download manifest.")];
     }
 
-    OWSLogVerbose(@"json: %@", json);
-
     NSArray<OWSBackupFragment *> *_Nullable databaseItems =
         [self parseManifestItems:json key:kOWSBackup_ManifestKey_DatabaseFiles];
     if (!databaseItems) {
@@ -233,6 +231,10 @@ NSString *const kOWSBackup_KeychainService = @"kOWSBackup_KeychainService";
     NSString *_Nullable localProfileFamilyName = [self parseManifestItem:json
                                                                      key:kOWSBackup_ManifestKey_LocalProfileFamilyName];
 
+    OWSLogVerbose(@"databaseItems: %lu, attachmentsItems: %lu",
+        (unsigned long)databaseItems.count,
+        (unsigned long)attachmentsItems.count);
+
     OWSBackupManifestContents *contents = [OWSBackupManifestContents new];
     contents.databaseItems = databaseItems;
     contents.attachmentsItems = attachmentsItems;
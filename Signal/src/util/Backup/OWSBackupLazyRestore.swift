@@ -28,6 +28,18 @@ public class BackupLazyRestore: NSObject {
     private var isRunning = false
     private var isComplete = false
 
+    // Attachments are restored most recent first, except that attachments
+    // the user has just scrolled past jump the queue.
+    //
+    // These properties should only be accessed while holding the lock.
+    private let unfairLock = UnfairLock()
+    // Oldest first, so that the most recent is popped next.
+    private var pendingAttachmentIds = [String]()
+    // Most recently displayed last.
+    private var prioritizedAttachmentIds = [String]()
+    // The attachments in this run that haven't been attempted yet.
+    private var unattemptedAttachmentIds = Set<String>()
+
     @objc
     public required override init() {
         super.init()
@@ -119,18 +131,49 @@ public class BackupLazyRestore: NSObject {
             return
         }
         Logger.info("Lazy restoring \(attachmentIds.count) attachments.")
-        tryToRestoreNextAttachment(attachmentIds: attachmentIds, errorCount: 0, backupIO: backupIO)
+        unfairLock.withLock {
+            pendingAttachmentIds = attachmentIds
+            prioritizedAttachmentIds = []
+            unattemptedAttachmentIds = Set(attachmentIds)
+        }
+        tryToRestoreNextAttachment(errorCount: 0, backupIO: backupIO)
+    }
+
+    // Restores these attachments next, if they are waiting to be restored.
+    //
+    // This can be called whenever attachments are displayed.
+    @objc
+    public func prioritizeAttachments(attachmentIds: [String]) {
+        guard !attachmentIds.isEmpty else {
+            return
+        }
+        unfairLock.withLock {
+            for attachmentId in attachmentIds where unattemptedAttachmentIds.contains(attachmentId) {
+                prioritizedAttachmentIds.append(attachmentId)
+            }
+        }
+    }
+
+    private func popNextAttachmentId() -> String? {
+        unfairLock.withLock {
+            while let attachmentId = prioritizedAttachmentIds.popLast() ?? pendingAttachmentIds.popLast() {
+                // Prioritized attachments are also still pending.
+                if unattemptedAttachmentIds.remove(attachmentId) != nil {
+                    return attachmentId
+                }
+            }
+            return nil
+        }
     }
 
-    private func tryToRestoreNextAttachment(attachmentIds: [String], errorCount: UInt, backupIO: OWSBackupIO) {
+    private func tryToRestoreNextAttachment(errorCount: UInt, backupIO: OWSBackupIO) {
         guard !isBackupImportInProgress() else {
             Logger.verbose("A backup import is in progress; abort.")
             complete(errorCount: errorCount + 1)
             return
         }
 
-        var attachmentIdsCopy = attachmentIds
-        guard let attachmentId = attachmentIdsCopy.popLast() else {
+        guard let attachmentId = popNextAttachmentId() else {
             // This job is done.
             Logger.verbose("job is done.")
             complete(errorCount: errorCount)
@@ -144,7 +187,7 @@ public class BackupLazyRestore: NSObject {
             // Not necessarily an error.
             // The attachment might have been deleted since the job began.
             // Continue trying to restore the other attachments.
-            tryToRestoreNextAttachment(attachmentIds: attachmentIds, errorCount: errorCount + 1, backupIO: backupIO)
+            tryToRestoreNextAttachment(errorCount: errorCount + 1, backupIO: backupIO)
             return
         }
         backup.lazyRestoreAttachment(attachmentPointer,
@@ -153,12 +196,12 @@ public class BackupLazyRestore: NSObject {
                 Logger.info("Restored attachment.")
 
                 // Continue trying to restore the other attachments.
-                self.tryToRestoreNextAttachment(attachmentIds: attachmentIdsCopy, errorCount: errorCount, backupIO: backupIO)
+                self.tryToRestoreNextAttachment(errorCount: errorCount, backupIO: backupIO)
             }.catch(on: self.backgroundQueue) { (error) in
                 Logger.error("Could not restore attachment: \(error)")
 
                 // Continue trying to restore the other attachments.
-                self.tryToRestoreNextAttachment(attachmentIds: attachmentIdsCopy, errorCount: errorCount + 1, backupIO: backupIO)
+                self.tryToRestoreNextAttachment(errorCount: errorCount + 1, backupIO: backupIO)
             }
     }
 
@@ -16,6 +16,7 @@ class DeviceTransferOperation: OWSOperation {
 
     class func scheduleTransfer(file: DeviceTransferProtoFile, priority: Operation.QueuePriority = .normal) -> Promise<Void> {
         let operation = DeviceTransferOperation(file: file)
+        operation.queuePriority = priority
         operationQueue.addOperation(operation)
         return operation.promise
     }
@@ -93,6 +94,22 @@ class DeviceTransferOperation: OWSOperation {
             return reportError(OWSAssertionError("Failed to calculate sha256 for file"))
         }
 
+        if deviceTransferService.resumableFileDigests[file.identifier] == sha256Digest.hexadecimalString {
+            Logger.info("New device already has file, sending resumed file placeholder.")
+
+            url = URL(
+                fileURLWithPath: UUID().uuidString,
+                relativeTo: URL(fileURLWithPath: OWSTemporaryDirectory(), isDirectory: true)
+            )
+            guard FileManager.default.createFile(
+                atPath: url.path,
+                contents: DeviceTransferService.resumedFileData,
+                attributes: nil
+            ) else {
+                return reportError(OWSAssertionError("Failed to create temp file for resumed file \(url)"))
+            }
+        }
+
         guard let session = deviceTransferService.session else {
             return reportError(OWSAssertionError("Tried to transfer file with no active session"))
         }
@@ -169,7 +169,7 @@ extension DeviceTransferService {
             return owsFailDebug("Ignoring incoming transfer to a registered device")
         }
 
-        resetTransferDirectory()
+        let resumedFileDigests = resetTransferDirectory(resumingWith: manifest)
 
         guard OWSFileSystem.moveFilePath(
             localURL.path,
@@ -214,6 +214,15 @@ extension DeviceTransferService {
         guard let freeSpaceInBytes = fileSystemAttributes[.systemFreeSize] as? UInt64, freeSpaceInBytes > manifest.estimatedTotalSize else {
             return self.failTransfer(.notEnoughSpace, "not enough free space to receive transfer")
         }
+
+        // Let the old device know which files we kept from an earlier transfer,
+        // so it only sends the ones we're missing.
+        resumableFileDigests = resumedFileDigests
+        do {
+            try sendResumeMessage(fileDigests: resumedFileDigests, to: peerId)
+        } catch {
+            return self.failTransfer(.assertion, "failed to send resume message \(error)")
+        }
     }
 
     func sendManifest() throws -> Promise<Void> {
@@ -53,7 +53,12 @@ extension DeviceTransferService: MCSessionDelegate {
                 guard !transferredFiles.contains(DeviceTransferService.manifestIdentifier) else { return }
 
                 do {
-                    try sendManifest().done {
+                    // Wait for the new device to tell us which files it already has
+                    // from an earlier, interrupted transfer before sending any files.
+                    let resumePromise = receiveResumeMessage()
+                    try sendManifest().then {
+                        resumePromise
+                    }.done {
                         try self.sendAllFiles()
                     }.catch { error in
                         self.failTransfer(.assertion, "Failed to send manifest to new device \(error)")
@@ -87,6 +92,10 @@ extension DeviceTransferService: MCSessionDelegate {
                 return owsFailDebug("Ignoring data from unexpected peer \(peerId)")
             }
 
+            if data.starts(with: DeviceTransferService.resumeMessagePrefix) {
+                return handleResumeMessage(data)
+            }
+
             guard data == DeviceTransferService.doneMessage else {
                 return failTransfer(.assertion, "Received unexpected data")
             }
@@ -271,12 +280,30 @@ extension DeviceTransferService: MCSessionDelegate {
                     return failTransfer(.assertion, "Failed to compute hash for \(file.identifier)")
                 }
 
+                if computedHash == DeviceTransferService.resumedFileHash {
+                    // The old device didn't send the file again, since it hasn't
+                    // changed since we received it in an earlier transfer.
+                    guard resumableFileDigests[file.identifier] == fileHash else {
+                        return failTransfer(.assertion, "Received unexpected resumed file \(file.identifier)")
+                    }
+                    Logger.info("Resumed file: \(file.identifier)")
+                    transferState = transferState.appendingFileId(file.identifier)
+                    return
+                }
+
                 guard computedHash.hexadecimalString == fileHash else {
                     return failTransfer(.assertion, "Received file with incorrect hash \(file.identifier)")
                 }
 
                 guard computedHash != DeviceTransferService.missingFileHash else {
                     Logger.warn("Received notification of missing file: \(file.identifier), skipping.")
+                    // Don't restore a copy of the file kept from an earlier transfer.
+                    OWSFileSystem.deleteFileIfExists(
+                        URL(
+                            fileURLWithPath: file.identifier,
+                            relativeTo: DeviceTransferService.pendingTransferFilesDirectory
+                        ).path
+                    )
                     transferState = transferState.appendingSkippedFileId(file.identifier)
                     return
                 }
@@ -292,6 +319,7 @@ extension DeviceTransferService: MCSessionDelegate {
                 }
 
                 Logger.info("Received file: \(file.identifier)")
+                recordCheckpoint(file: file, digest: fileHash)
                 transferState = transferState.appendingFileId(file.identifier)
             } else {
                 owsFailDebug("Unexpectedly completed transfer of resource with no URL or error")
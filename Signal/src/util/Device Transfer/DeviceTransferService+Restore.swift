@@ -233,6 +233,113 @@ extension DeviceTransferService {
         hasPendingRestore = false
     }
 
+    // MARK: - Checkpoints
+
+    // As each file is received and verified, the new device appends a
+    // checkpoint to this log. If the transfer is interrupted, the files
+    // are kept, and the next transfer sends only what is missing or changed.
+    private static let checkpointsURL = URL(fileURLWithPath: "checkpoints", relativeTo: pendingTransferDirectory)
+    private static let checkpointsQueue = DispatchQueue(label: "DeviceTransferService.checkpoints")
+
+    private struct Checkpoint: Codable {
+        let identifier: String
+        let relativePath: String
+        let estimatedSize: UInt64
+        let digest: String
+    }
+
+    func recordCheckpoint(file: DeviceTransferProtoFile, digest: String) {
+        let checkpoint = Checkpoint(
+            identifier: file.identifier,
+            relativePath: file.relativePath,
+            estimatedSize: file.estimatedSize,
+            digest: digest
+        )
+        guard var line = try? JSONEncoder().encode(checkpoint) else {
+            return owsFailDebug("Failed to encode checkpoint for \(file.identifier)")
+        }
+        line.append(UInt8(ascii: "\n"))
+
+        DeviceTransferService.checkpointsQueue.sync {
+            let path = DeviceTransferService.checkpointsURL.path
+            if !OWSFileSystem.fileOrFolderExists(atPath: path) {
+                FileManager.default.createFile(atPath: path, contents: nil, attributes: nil)
+            }
+            guard let fileHandle = FileHandle(forWritingAtPath: path) else {
+                return owsFailDebug("Failed to open checkpoints")
+            }
+            fileHandle.seekToEndOfFile()
+            fileHandle.write(line)
+            fileHandle.closeFile()
+        }
+    }
+
+    // Keyed by relative path, since the old device assigns new identifiers
+    // each time it builds a manifest.
+    private func readCheckpoints() -> [String: Checkpoint] {
+        guard let data = try? Data(contentsOf: DeviceTransferService.checkpointsURL) else { return [:] }
+
+        var checkpoints = [String: Checkpoint]()
+        for line in data.split(separator: UInt8(ascii: "\n")) {
+            // The last line may be truncated if we were interrupted while writing it.
+            guard let checkpoint = try? JSONDecoder().decode(Checkpoint.self, from: line) else { continue }
+            checkpoints[checkpoint.relativePath] = checkpoint
+        }
+        return checkpoints
+    }
+
+    /// Resets the transfer directory for a new transfer, keeping the files
+    /// received by an earlier transfer that are of the same size in the new
+    /// manifest. The old device verifies their digests before skipping them.
+    ///
+    /// - Returns: The digests of the kept files, by their identifier in the new manifest.
+    func resetTransferDirectory(resumingWith manifest: DeviceTransferProtoManifest) -> [String: String] {
+        let checkpoints = readCheckpoints()
+
+        let keptFilesDirectory = URL(
+            fileURLWithPath: UUID().uuidString,
+            isDirectory: true,
+            relativeTo: URL(fileURLWithPath: OWSTemporaryDirectory(), isDirectory: true)
+        )
+        let canResume = !checkpoints.isEmpty && OWSFileSystem.moveFilePath(
+            DeviceTransferService.pendingTransferFilesDirectory.path,
+            toFilePath: keptFilesDirectory.path
+        )
+
+        resetTransferDirectory()
+
+        guard canResume else { return [:] }
+
+        defer { OWSFileSystem.deleteFileIfExists(keptFilesDirectory.path) }
+
+        OWSFileSystem.ensureDirectoryExists(DeviceTransferService.pendingTransferFilesDirectory.path)
+
+        var resumedFileDigests = [String: String]()
+        var allFiles = manifest.files
+        if let database = manifest.database {
+            allFiles += [database.database, database.wal]
+        }
+        for file in allFiles {
+            guard let checkpoint = checkpoints[file.relativePath],
+                  checkpoint.estimatedSize == file.estimatedSize else { continue }
+
+            guard OWSFileSystem.moveFilePath(
+                URL(fileURLWithPath: checkpoint.identifier, relativeTo: keptFilesDirectory).path,
+                toFilePath: URL(
+                    fileURLWithPath: file.identifier,
+                    relativeTo: DeviceTransferService.pendingTransferFilesDirectory
+                ).path
+            ) else { continue }
+
+            recordCheckpoint(file: file, digest: checkpoint.digest)
+            resumedFileDigests[file.identifier] = checkpoint.digest
+        }
+
+        Logger.info("Kept \(resumedFileDigests.count) files from an earlier transfer")
+
+        return resumedFileDigests
+    }
+
     @objc
     func launchCleanup() -> Bool {
         Logger.info("hasBeenRestored: \(hasBeenRestored)")
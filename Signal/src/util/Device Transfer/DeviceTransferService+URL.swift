@@ -6,7 +6,7 @@ import Foundation
 import MultipeerConnectivity
 
 extension DeviceTransferService {
-    private static let currentTransferVersion = 1
+    private static let currentTransferVersion = 2
 
     private static let versionKey = "version"
     private static let peerIdKey = "peerId"
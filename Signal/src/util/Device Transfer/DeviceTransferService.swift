@@ -86,6 +86,9 @@ class DeviceTransferService: NSObject {
     static let missingFileData = "Missing File".data(using: .utf8)!
     static let missingFileHash = Cryptography.computeSHA256Digest(missingFileData)!
 
+    static let resumedFileData = "Resumed File".data(using: .utf8)!
+    static let resumedFileHash = Cryptography.computeSHA256Digest(resumedFileData)!
+
     // This must also be updated in the info.plist
     private static let newDeviceServiceIdentifier = "sgnl-new-device"
 
@@ -96,6 +99,15 @@ class DeviceTransferService: NSObject {
         get { serialQueue.sync { _transferState } }
     }
 
+    // The digests of the files the new device kept from an interrupted
+    // transfer, by their identifier in the current manifest.
+    private var _resumableFileDigests = [String: String]()
+    var resumableFileDigests: [String: String] {
+        set { serialQueue.sync { _resumableFileDigests = newValue } }
+        get { serialQueue.sync { _resumableFileDigests } }
+    }
+    private var resumeMessageResolver: Resolver<Void>?
+
     private(set) var identity: SecIdentity?
     private(set) var session: MCSession? {
         didSet {
@@ -271,6 +283,8 @@ class DeviceTransferService: NSObject {
 
         tsAccountManager.isTransferInProgress = false
         transferState = .idle
+        resumableFileDigests = [:]
+        serialQueue.sync { resumeMessageResolver = nil }
 
         stopThroughputCalculation()
     }
@@ -320,7 +334,11 @@ class DeviceTransferService: NSObject {
             }
         }
 
-        for file in manifest.files {
+        // Send the largest files first, so the smaller files fill the remaining
+        // streams around them. Otherwise a large file scheduled last keeps the
+        // transfer going on a single stream long after the others are done.
+        let files = manifest.files.sorted { $0.estimatedSize > $1.estimatedSize }
+        for file in files {
             promises.append(DeviceTransferOperation.scheduleTransfer(file: file))
         }
 
@@ -334,6 +352,48 @@ class DeviceTransferService: NSObject {
         }
     }
 
+    // MARK: - Resume
+
+    // After receiving the manifest, the new device tells us which files it
+    // already has. These are only sent again if they've changed.
+    static let resumeMessagePrefix = "Resume Transfer ".data(using: .utf8)!
+
+    func receiveResumeMessage() -> Promise<Void> {
+        let (promise, resolver) = Promise<Void>.pending()
+        serialQueue.sync { resumeMessageResolver = resolver }
+        return promise
+    }
+
+    func handleResumeMessage(_ data: Data) {
+        let payload = data.suffix(from: data.startIndex + DeviceTransferService.resumeMessagePrefix.count)
+        guard let fileDigests = try? JSONDecoder().decode([String: String].self, from: payload) else {
+            return failTransfer(.assertion, "Received malformed resume message")
+        }
+
+        let resolver: Resolver<Void>? = serialQueue.sync {
+            defer { resumeMessageResolver = nil }
+            return resumeMessageResolver
+        }
+        guard let resumeResolver = resolver else {
+            return failTransfer(.assertion, "Received unexpected resume message")
+        }
+
+        Logger.info("New device already has \(fileDigests.count) files")
+        resumableFileDigests = fileDigests
+        resumeResolver.fulfill(())
+    }
+
+    func sendResumeMessage(fileDigests: [String: String], to peerId: MCPeerID) throws {
+        Logger.info("Sending resume message, \(fileDigests.count) files already received")
+
+        guard let session = session else {
+            throw OWSAssertionError("attempted to send resume message without an available session")
+        }
+
+        let message = DeviceTransferService.resumeMessagePrefix + (try JSONEncoder().encode(fileDigests))
+        try session.send(message, toPeers: [peerId], with: .reliable)
+    }
+
     static let doneMessage = "Transfer Complete".data(using: .utf8)!
     func sendDoneMessage(to peerId: MCPeerID) throws {
         Logger.info("Sending done message")
@@ -350,6 +410,8 @@ class DeviceTransferService: NSObject {
     private var previouslyCompletedBytes: Double = 0
     private var lastWholeNumberProgress = 0
     private var throughputTimer: Timer?
+    private var throughputStartDate: Date?
+    private var throughputStartBytes: Double = 0
     func startThroughputCalculation() {
         guard Thread.isMainThread else {
             DispatchQueue.main.async { self.startThroughputCalculation() }
@@ -373,6 +435,8 @@ class DeviceTransferService: NSObject {
         }
 
         previouslyCompletedBytes = Double(progress.totalUnitCount) * progress.fractionCompleted
+        throughputStartDate = Date()
+        throughputStartBytes = previouslyCompletedBytes
 
         throughputTimer = WeakTimer.scheduledTimer(timeInterval: 1, target: self, userInfo: nil, repeats: true) { _ in
             let completedBytes = Double(progress.totalUnitCount) * progress.fractionCompleted
@@ -453,8 +517,22 @@ class DeviceTransferService: NSObject {
     }
 
     func stopThroughputCalculation() {
+        if let throughputStartDate = throughputStartDate {
+            // Log the average over the whole transfer, which unlike the smoothed
+            // throughput isn't skewed by the speed of the last few seconds.
+            let elapsedTime = -throughputStartDate.timeIntervalSinceNow
+            let transferredBytes = previouslyCompletedBytes - throughputStartBytes
+            if elapsedTime > 0 {
+                let averageSpeed = transferredBytes / elapsedTime / 1024 / 1024
+                Logger.info(String(format: "Transferred %0.2f Mb in %0.0f seconds / %0.2f Mbps average",
+                                   transferredBytes / 1024 / 1024, elapsedTime, averageSpeed))
+            }
+        }
+
         throughputTimer?.invalidate()
         throughputTimer = nil
+        throughputStartDate = nil
+        throughputStartBytes = 0
         previouslyCompletedBytes = 0
         lastWholeNumberProgress = 0
     }
@@ -19,21 +19,62 @@ public struct EmojiWithSkinTones: Hashable {
         }
     }
 
+    init?(rawValue: String) {
+        guard rawValue.isSingleEmoji else { return nil }
+        guard let emoji = EmojiLookupTable.shared.emojiByRawValue[rawValue] else { return nil }
+        self = emoji
+    }
+
     var rawValue: String {
         if let skinTones = skinTones {
-            return baseEmoji.emojiPerSkinTonePermutation?[skinTones] ?? baseEmoji.rawValue
+            return EmojiLookupTable.shared.emojiPerSkinTonePermutation[baseEmoji]?[skinTones] ?? baseEmoji.rawValue
         } else {
             return baseEmoji.rawValue
         }
     }
 }
 
+// The generated emoji properties are switches which build a new array or
+// dictionary each time they're evaluated. The lookups we make while
+// rendering reactions and the emoji picker are instead answered by these
+// tables, which are built once, when first used.
+private class EmojiLookupTable {
+    static let shared = EmojiLookupTable()
+
+    let emojiByRawValue: [String: EmojiWithSkinTones]
+    let emojiPerSkinTonePermutation: [Emoji: [[Emoji.SkinTone]: String]]
+    let emojiPerCategory: [Emoji.Category: [Emoji]]
+
+    private init() {
+        var emojiByRawValue = [String: EmojiWithSkinTones]()
+        var emojiPerSkinTonePermutation = [Emoji: [[Emoji.SkinTone]: String]]()
+        for emoji in Emoji.allCases {
+            emojiByRawValue[emoji.rawValue] = EmojiWithSkinTones(baseEmoji: emoji, skinTones: nil)
+
+            guard let permutations = emoji.emojiPerSkinTonePermutation else { continue }
+            emojiPerSkinTonePermutation[emoji] = permutations
+            for (skinTones, rawValue) in permutations {
+                emojiByRawValue[rawValue] = EmojiWithSkinTones(baseEmoji: emoji, skinTones: skinTones)
+            }
+        }
+        self.emojiByRawValue = emojiByRawValue
+        self.emojiPerSkinTonePermutation = emojiPerSkinTonePermutation
+
+        var emojiPerCategory = [Emoji.Category: [Emoji]]()
+        for category in Emoji.Category.allCases {
+            emojiPerCategory[category] = category.emoji
+        }
+        self.emojiPerCategory = emojiPerCategory
+    }
+}
+
 extension Emoji {
     private static let keyValueStore = SDSKeyValueStore(collection: "Emoji+PreferredSkinTonePermutation")
 
     static func allAvailableEmojiByCategoryWithPreferredSkinTones(transaction: SDSAnyReadTransaction) -> [Category: [EmojiWithSkinTones]] {
         return Category.allCases.reduce(into: [Category: [EmojiWithSkinTones]]()) { result, category in
-            result[category] = category.emoji.filter { $0.available }.map { $0.withPreferredSkinTones(transaction: transaction) }
+            let emoji = EmojiLookupTable.shared.emojiPerCategory[category] ?? []
+            result[category] = emoji.filter { $0.available }.map { $0.withPreferredSkinTones(transaction: transaction) }
         }
     }
 
@@ -467,6 +467,23 @@ typedef void (^DebugLogUploadFailure)(DebugLogUploader *uploader, NSError *error
         [OWSFileSystem protectFileOrFolderAtPath:copyFilePath];
     }
 
+    // Include a snapshot of the app's queues, caches and memory use.
+    __block NSString *performanceReport;
+    DispatchSyncMainThreadSafe(^{
+        performanceReport = [PerformanceSnapshot capture].reportText;
+    });
+    NSString *performanceReportPath = [zipDirPath stringByAppendingPathComponent:@"performance.txt"];
+    NSError *performanceReportError;
+    if ([performanceReport writeToFile:performanceReportPath
+                            atomically:YES
+                              encoding:NSUTF8StringEncoding
+                                 error:&performanceReportError]) {
+        [OWSFileSystem protectFileOrFolderAtPath:performanceReportPath];
+    } else {
+        // The logs are still worth uploading without the snapshot.
+        OWSLogWarn(@"Could not write performance snapshot: %@", performanceReportError);
+    }
+
     // Phase 2. Zip up the log files.
     BOOL zipSuccess = [SSZipArchive createZipFileAtPath:zipFilePath
                                 withContentsOfDirectory:zipDirPath
@@ -0,0 +1,310 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import Signal
+@testable import SignalServiceKit
+import SignalMessaging
+
+// Measures opening and scrolling the conversation view and the conversation
+// list. The tests run in the app host, so the views are laid out and
+// rendered for real in a window.
+//
+// Each measurement reports wall time, memory and the scroll hitch ratio.
+// Baselines are recorded per device in the scheme's xcbaselines.
+@available(iOS 13.0, *)
+class ConversationViewPerformanceTest: PerformanceBaseTest {
+
+    let messageCount: UInt = DebugFlags.fastPerfTests ? 100 : 10 * 1000
+    let threadCount: UInt = DebugFlags.fastPerfTests ? 10 : 500
+    let messagesPerThread: UInt = DebugFlags.fastPerfTests ? 2 : 10
+
+    // How far each scroll measurement travels, in screen heights.
+    let scrollScreenCount: CGFloat = DebugFlags.fastPerfTests ? 5 : 50
+
+    private var window: UIWindow!
+
+    private lazy var imageData = ImageFactory().buildPNGData()
+
+    // MARK: - Hooks
+
+    override func setUp() {
+        super.setUp()
+
+        MockEnvironment.activate()
+        storageCoordinator.useGRDBForTests()
+
+        // Use a fixed size, so that results are comparable across runs.
+        window = UIWindow(frame: CGRect(x: 0, y: 0, width: 375, height: 812))
+        window.makeKeyAndVisible()
+    }
+
+    override func tearDown() {
+        window.rootViewController = nil
+        window.isHidden = true
+        window = nil
+
+        super.tearDown()
+    }
+
+    private var metrics: [XCTMetric] {
+        [XCTClockMetric(), XCTMemoryMetric(), ScrollHitchMetric()]
+    }
+
+    // MARK: - Conversation View
+
+    func testPerf_openConversation() {
+        let thread = createConversation()
+
+        measure(metrics: metrics) {
+            _ = openConversation(thread)
+            window.rootViewController = nil
+        }
+    }
+
+    func testPerf_scrollConversation() {
+        let thread = createConversation()
+
+        let conversationViewController = openConversation(thread)
+        let collectionView = conversationViewController.collectionView
+
+        // Scroll up from the bottom, which loads older messages, then back
+        // down over the now loaded messages.
+        measure(metrics: metrics) {
+            scroll(collectionView, screenCount: scrollScreenCount, isUpwards: true)
+            scroll(collectionView, screenCount: scrollScreenCount, isUpwards: false)
+        }
+    }
+
+    // MARK: - Conversation List
+
+    func testPerf_openConversationList() {
+        createConversations()
+
+        measure(metrics: metrics) {
+            _ = openConversationList()
+            window.rootViewController = nil
+        }
+    }
+
+    func testPerf_scrollConversationList() {
+        createConversations()
+
+        let tableView = openConversationList()
+
+        measure(metrics: metrics) {
+            scroll(tableView, screenCount: scrollScreenCount, isUpwards: false)
+            scroll(tableView, screenCount: scrollScreenCount, isUpwards: true)
+        }
+    }
+
+    // MARK: - Fixtures
+
+    private func createConversation() -> TSContactThread {
+        var thread: TSContactThread!
+        write { transaction in
+            thread = self.createConversation(messageCount: self.messageCount, transaction: transaction)
+        }
+        return thread
+    }
+
+    private func createConversations() {
+        write { transaction in
+            for _ in 0..<self.threadCount {
+                _ = self.createConversation(messageCount: self.messagesPerThread, transaction: transaction)
+            }
+        }
+    }
+
+    // Creates a mix of incoming and outgoing messages, with short and long
+    // text and albums, much like the Debug UI's fake messages.
+    private func createConversation(messageCount: UInt, transaction: SDSAnyWriteTransaction) -> TSContactThread {
+        let thread = ContactThreadFactory().create(transaction: transaction)
+
+        let incomingMessageFactory = IncomingMessageFactory()
+        incomingMessageFactory.threadCreator = { _ in thread }
+        let outgoingMessageFactory = OutgoingMessageFactory()
+        outgoingMessageFactory.threadCreator = { _ in thread }
+
+        for index in 0..<messageCount {
+            let isIncoming = index % 2 == 0
+            var messageBody: String? = CommonGenerator.sentence
+            var attachmentIds = [String]()
+            switch index % 10 {
+            case 3:
+                messageBody = CommonGenerator.paragraph(sentenceCount: 12)
+            case 7:
+                messageBody = Bool.random() ? CommonGenerator.sentence : nil
+                attachmentIds = (0..<(1 + index % 4)).map { _ in
+                    createImageAttachment(transaction: transaction).uniqueId
+                }
+            default:
+                break
+            }
+
+            if isIncoming {
+                incomingMessageFactory.messageBodyBuilder = { messageBody }
+                incomingMessageFactory.attachmentIdsBuilder = { attachmentIds }
+                _ = incomingMessageFactory.create(transaction: transaction)
+            } else {
+                outgoingMessageFactory.messageBodyBuilder = { messageBody ?? "" }
+                outgoingMessageFactory.attachmentIdsBuilder = { attachmentIds }
+                let message = outgoingMessageFactory.create(transaction: transaction)
+                message.update(withFakeMessageState: .sent, transaction: transaction)
+            }
+        }
+
+        return thread
+    }
+
+    private func createImageAttachment(transaction: SDSAnyWriteTransaction) -> TSAttachmentStream {
+        let dataSource = DataSourceValue.dataSource(with: imageData, fileExtension: "png")!
+        return AttachmentStreamFactory.create(contentType: OWSMimeTypeImagePng,
+                                              dataSource: dataSource,
+                                              transaction: transaction)
+    }
+
+    // MARK: - Helpers
+
+    // Returns once the initial load has been rendered.
+    private func openConversation(_ thread: TSThread) -> ConversationViewController {
+        // Measure a cold open, not the restored snapshot of the last open.
+        CVRenderStateSnapshotCache.shared.removeSnapshot(threadUniqueId: thread.uniqueId)
+
+        var threadViewModel: ThreadViewModel!
+        read { transaction in
+            threadViewModel = ThreadViewModel(thread: thread, transaction: transaction)
+        }
+        let conversationViewController = ConversationViewController(threadViewModel: threadViewModel,
+                                                                    action: .none,
+                                                                    focusMessageId: nil)
+        window.rootViewController = OWSNavigationController(rootViewController: conversationViewController)
+
+        waitUntil {
+            conversationViewController.loadCoordinator.hasRenderState &&
+                !conversationViewController.collectionView.visibleCells.isEmpty
+        }
+        return conversationViewController
+    }
+
+    // Returns the list's table view once it shows the conversations.
+    private func openConversationList() -> UITableView {
+        let conversationListViewController = ConversationListViewController()
+        window.rootViewController = OWSNavigationController(rootViewController: conversationListViewController)
+
+        var tableView: UITableView?
+        waitUntil {
+            tableView = tableView ?? self.firstSubview(of: conversationListViewController.view,
+                                                       ofType: UITableView.self)
+            return !(tableView?.visibleCells.isEmpty ?? true)
+        }
+        return tableView!
+    }
+
+    private func firstSubview<T: UIView>(of view: UIView, ofType type: T.Type) -> T? {
+        if let view = view as? T {
+            return view
+        }
+        for subview in view.subviews {
+            if let result = firstSubview(of: subview, ofType: type) {
+                return result
+            }
+        }
+        return nil
+    }
+
+    // Scrolls at a constant speed, one step per frame, letting the run loop
+    // lay out and render each frame.
+    private func scroll(_ scrollView: UIScrollView, screenCount: CGFloat, isUpwards: Bool) {
+        let pointsPerFrame: CGFloat = 40
+        var remainingDistance = scrollView.bounds.height * screenCount
+        while remainingDistance > 0 {
+            let minOffsetY = -scrollView.adjustedContentInset.top
+            let maxOffsetY = max(minOffsetY,
+                                 scrollView.contentSize.height
+                                    + scrollView.adjustedContentInset.bottom
+                                    - scrollView.bounds.height)
+            let step = min(pointsPerFrame, remainingDistance)
+            var contentOffset = scrollView.contentOffset
+            contentOffset.y = isUpwards ? contentOffset.y - step : contentOffset.y + step
+            contentOffset.y = min(max(contentOffset.y, minOffsetY), maxOffsetY)
+            if contentOffset == scrollView.contentOffset {
+                // Reached the end of the content.
+                break
+            }
+            scrollView.contentOffset = contentOffset
+            remainingDistance -= step
+
+            RunLoop.main.run(until: Date(timeIntervalSinceNow: 1 / 60))
+        }
+    }
+
+    // Spins the main run loop, rather than waiting on an expectation, whose
+    // polling interval would dominate the measured times.
+    private func waitUntil(timeout: TimeInterval = 30, _ condition: () -> Bool) {
+        let deadline = Date(timeIntervalSinceNow: timeout)
+        while !condition() {
+            guard Date() < deadline else {
+                XCTFail("Timed out.")
+                return
+            }
+            RunLoop.main.run(until: Date(timeIntervalSinceNow: 0.001))
+        }
+    }
+}
+
+// MARK: -
+
+// Reports the hitch time ratio: the milliseconds per second of measurement
+// by which frames missed their deadlines. Signpost-based scroll metrics
+// need a UI test target; this observes frames from within the app instead.
+@available(iOS 13.0, *)
+class ScrollHitchMetric: NSObject, XCTMetric {
+
+    private var displayLink: CADisplayLink?
+    private var lastTargetTimestamp: CFTimeInterval?
+    private var hitchDuration: CFTimeInterval = 0
+    private var startTime: CFTimeInterval = 0
+    private var endTime: CFTimeInterval = 0
+
+    func copy(with zone: NSZone? = nil) -> Any {
+        ScrollHitchMetric()
+    }
+
+    func willBeginMeasuring() {
+        hitchDuration = 0
+        lastTargetTimestamp = nil
+        startTime = CACurrentMediaTime()
+
+        let displayLink = CADisplayLink(target: self, selector: #selector(displayLinkDidFire))
+        displayLink.add(to: .main, forMode: .common)
+        self.displayLink = displayLink
+    }
+
+    func didStopMeasuring() {
+        endTime = CACurrentMediaTime()
+        displayLink?.invalidate()
+        displayLink = nil
+    }
+
+    @objc
+    private func displayLinkDidFire(_ displayLink: CADisplayLink) {
+        // A frame is late by however long after its deadline it appeared.
+        if let lastTargetTimestamp = lastTargetTimestamp {
+            hitchDuration += max(0, displayLink.timestamp - lastTargetTimestamp)
+        }
+        lastTargetTimestamp = displayLink.targetTimestamp
+    }
+
+    func reportMeasurements(from startTime: XCTPerformanceMeasurementTimestamp,
+                            to endTime: XCTPerformanceMeasurementTimestamp) throws -> [XCTPerformanceMeasurement] {
+        let measuredDuration = max(self.endTime - self.startTime, 0.001)
+        let hitchRatio = (hitchDuration * 1000) / measuredDuration
+        return [XCTPerformanceMeasurement(identifier: "org.signal.scroll-hitch-ratio",
+                                          displayName: "Scroll Hitch Ratio",
+                                          doubleValue: hitchRatio,
+                                          unitSymbol: "ms/s")]
+    }
+}
@@ -0,0 +1,135 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import Signal
+@testable import SignalServiceKit
+@testable import SignalMessaging
+
+// Benchmarks of whole-database work, against a large DatabaseFixture.
+//
+// Each measurement reports wall time and peak memory.
+@available(iOS 13.0, *)
+class DatabaseFixturePerformanceTest: PerformanceBaseTest {
+
+    // MARK: - Hooks
+
+    override func setUp() {
+        super.setUp()
+
+        MockEnvironment.activate()
+    }
+
+    private var metrics: [XCTMetric] {
+        [XCTClockMetric(), XCTMemoryMetric()]
+    }
+
+    private func buildFixture() -> DatabaseFixture {
+        let fixture = DatabaseFixture()
+        if DebugFlags.fastPerfTests {
+            fixture.threadCount = 20
+            fixture.interactionCount = 2000
+            fixture.attachmentCount = 300
+            fixture.reactionCount = 200
+            fixture.largeGroupCount = 1
+            fixture.largeGroupMemberCount = 100
+        }
+        return fixture
+    }
+
+    // MARK: - Backup
+
+    // The import half of the backup is compiled out (see GRDB_BACKUP), so
+    // only the export's database phase is measured: copying the database,
+    // then archiving each model into a backup entity, as
+    // OWSBackupExportJob does.
+    func testPerf_backupExportDatabase() {
+        storageCoordinator.useGRDBForTests()
+        buildFixture().create()
+
+        measure(metrics: metrics) {
+            var entityCount = 0
+            let didReadCopy = databaseStorage.bulkScanReadCopy { transaction in
+                func export(_ object: TSYapDatabaseObject, collection: String) {
+                    autoreleasepool {
+                        let entityData = NSKeyedArchiver.archivedData(withRootObject: object)
+                        let entityBuilder = SignalIOSProtoBackupSnapshotBackupEntity.builder(entityData: entityData,
+                                                                                            collection: collection,
+                                                                                            key: object.uniqueId)
+                        _ = try! entityBuilder.buildSerializedData()
+                        entityCount += 1
+                    }
+                }
+                TSThread.anyEnumerate(transaction: transaction, batched: true) { thread, _ in
+                    export(thread, collection: TSThread.collection())
+                }
+                TSAttachment.anyEnumerate(transaction: transaction, batched: true) { attachment, _ in
+                    export(attachment, collection: TSAttachment.collection())
+                }
+                TSInteraction.anyEnumerate(transaction: transaction, batched: true) { interaction, _ in
+                    export(interaction, collection: TSInteraction.collection())
+                }
+            }
+            XCTAssertTrue(didReadCopy)
+            XCTAssertGreaterThan(entityCount, 0)
+        }
+    }
+
+    // MARK: - Device Transfer
+
+    func testPerf_buildDeviceTransferManifest() {
+        storageCoordinator.useGRDBForTests()
+        let fixture = buildFixture()
+        fixture.create()
+
+        let deviceTransferService = DeviceTransferService()
+        measure(metrics: metrics) {
+            let manifest = try! deviceTransferService.buildManifest()
+            XCTAssertGreaterThanOrEqual(UInt(manifest.files.count), fixture.attachmentCount)
+        }
+    }
+
+    // MARK: - YDB to GRDB Migration
+
+    func testPerf_migrateYDBToGRDB() {
+        storageCoordinator.useYDBForTests()
+        let fixture = buildFixture()
+        fixture.create()
+        storageCoordinator.useGRDBForTests()
+
+        let migratorGroups = [
+            GRDBMigratorGroup { ydbTransaction in
+                return [
+                    GRDBUnorderedRecordMigrator<TSAttachment>(label: "attachments", ydbTransaction: ydbTransaction),
+                    GRDBUnorderedRecordMigrator<TSThread>(label: "threads", ydbTransaction: ydbTransaction)
+                ]
+            },
+            GRDBMigratorGroup { ydbTransaction in
+                return [
+                    GRDBInteractionMigrator(ydbTransaction: ydbTransaction)
+                ]
+            }
+        ]
+
+        let options = XCTMeasureOptions()
+        options.invocationOptions = [.manuallyStart, .manuallyStop]
+        measure(metrics: metrics, options: options) {
+            // Each iteration migrates into an empty database.
+            write { transaction in
+                TSInteraction.anyRemoveAllWithoutInstantation(transaction: transaction)
+                TSAttachment.anyRemoveAllWithoutInstantation(transaction: transaction)
+                TSThread.anyRemoveAllWithoutInstantation(transaction: transaction)
+            }
+
+            startMeasuring()
+            try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+            stopMeasuring()
+
+            read { transaction in
+                XCTAssertEqual(UInt(TSThread.anyCount(transaction: transaction)), fixture.threadCount)
+            }
+        }
+    }
+}
@@ -5,6 +5,7 @@
 import XCTest
 @testable import SignalServiceKit
 import GRDB
+import PromiseKit
 
 class MessageProcessingPerformanceTest: PerformanceBaseTest {
 
@@ -71,6 +72,29 @@ class MessageProcessingPerformanceTest: PerformanceBaseTest {
         databaseStorage.grdbStorage.testing_tearDownUIDatabase()
     }
 
+    func testGRDBPerf_messagePipelineLoad() {
+        identityManager.generateNewIdentityKey()
+        tsAccountManager.registerForTests(withLocalNumber: localE164Identifier, uuid: localUUID)
+
+        let loadGenerator = MessagePipelineLoadGenerator()
+        let envelopeCount: Int = DebugFlags.fastPerfTests ? 8 : 400
+        var envelopeDatas = [Data]()
+        write { transaction in
+            try! loadGenerator.prepare(transaction: transaction)
+            envelopeDatas = try! loadGenerator.buildEnvelopeDatas(count: envelopeCount, transaction: transaction)
+        }
+
+        let expectReport = expectation(description: "load report")
+        loadGenerator.run(envelopeDatas: envelopeDatas, timeout: 30).done { report in
+            Logger.info(report.logDescription)
+            XCTAssertEqual(report.visibleEnvelopeCount, envelopeCount)
+            expectReport.fulfill()
+        }.cauterize()
+        waitForExpectations(timeout: 35)
+
+        databaseStorage.grdbStorage.testing_tearDownUIDatabase()
+    }
+
     func processIncomingMessages() {
         // ensure local client has necessary "registered" state
         identityManager.generateNewIdentityKey()
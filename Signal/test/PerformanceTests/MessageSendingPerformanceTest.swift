@@ -81,13 +81,103 @@ class MessageSendingPerformanceTest: PerformanceBaseTest {
         databaseStorage.grdbStorage.testing_tearDownUIDatabase()
     }
 
-    func sendMessages_groupThread() {
+    // MARK: - Throughput
+
+    func testGRDBPerf_messageSending_largeGroupThread() {
+        storageCoordinator.useGRDBForTests()
+        try! databaseStorage.grdbStorage.setupUIDatabase()
+        measureMetrics(XCTestCase.defaultPerformanceMetrics, automaticallyStartMeasuring: false) {
+            sendMessages_groupThread(memberCount: DebugFlags.fastPerfTests ? 10 : 100)
+        }
+        databaseStorage.grdbStorage.testing_tearDownUIDatabase()
+    }
+
+    func testGRDBPerf_messageSending_manyContactThreads() {
+        storageCoordinator.useGRDBForTests()
+        try! databaseStorage.grdbStorage.setupUIDatabase()
+        measureMetrics(XCTestCase.defaultPerformanceMetrics, automaticallyStartMeasuring: false) {
+            sendMessages_contactThreads(threadCount: 10)
+        }
+        databaseStorage.grdbStorage.testing_tearDownUIDatabase()
+    }
+
+    func testGRDBPerf_messageSending_slowLossyNetwork() {
+        storageCoordinator.useGRDBForTests()
+        try! databaseStorage.grdbStorage.setupUIDatabase()
+        stubbableNetworkManager.latency = .milliseconds(100)
+        // Lost requests are retried by the message sender.
+        stubbableNetworkManager.lossInterval = 10
+        measureMetrics(XCTestCase.defaultPerformanceMetrics, automaticallyStartMeasuring: false) {
+            sendMessages_contactThreads(threadCount: 10)
+        }
+        databaseStorage.grdbStorage.testing_tearDownUIDatabase()
+    }
+
+    func testGRDBPerf_messageSending_deviceMismatchRetries() {
+        storageCoordinator.useGRDBForTests()
+        try! databaseStorage.grdbStorage.setupUIDatabase()
+        stubbableNetworkManager.block = deviceMismatchBlock()
+        measureMetrics(XCTestCase.defaultPerformanceMetrics, automaticallyStartMeasuring: false) {
+            sendMessages_groupThread()
+        }
+        databaseStorage.grdbStorage.testing_tearDownUIDatabase()
+    }
+
+    // Fails the first attempt of each message send with a 409 (mismatched
+    // devices) or 410 (stale devices) response, alternately.
+    //
+    // The responses name a device which the recipient doesn't have, so
+    // that handling them doesn't require any prekey fetches; the retry
+    // then succeeds.
+    private func deviceMismatchBlock() -> (TSRequest, TSNetworkManagerSuccess, TSNetworkManagerFailure) -> Void {
+        let unfairLock = UnfairLock()
+        var failedSends = Set<String>()
+        return { request, success, failure in
+            let fakeTask = URLSessionDataTask()
+            guard request.httpMethod == "PUT",
+                let path = request.url?.path,
+                path.hasPrefix("v1/messages/"),
+                let timestamp = request.parameters["timestamp"] else {
+                    success(fakeTask, nil)
+                    return
+            }
+            // Identify the send by its recipient and message.
+            let sendKey = "\(path) \(timestamp)"
+            let failureCount: Int? = unfairLock.withLock {
+                guard !failedSends.contains(sendKey) else {
+                    return nil
+                }
+                failedSends.insert(sendKey)
+                return failedSends.count
+            }
+            guard let count = failureCount else {
+                success(fakeTask, nil)
+                return
+            }
+
+            let statusCode: Int
+            let response: [String: Any]
+            if count % 2 == 0 {
+                statusCode = 409
+                response = ["extraDevices": [2], "missingDevices": []]
+            } else {
+                statusCode = 410
+                response = ["staleDevices": [2]]
+            }
+            let responseData = try! JSONSerialization.data(withJSONObject: response)
+            failure(fakeTask, StubbableNetworkManager.responseError(statusCode: statusCode, responseData: responseData))
+        }
+    }
+
+    // MARK: -
+
+    func sendMessages_groupThread(memberCount: Int = 5) {
         // ensure local client has necessary "registered" state
         identityManager.generateNewIdentityKey()
         tsAccountManager.registerForTests(withLocalNumber: localE164Identifier, uuid: localUUID)
 
         // Session setup
-        let groupMemberClients: [FakeSignalClient] = (0..<5).map { _ in
+        let groupMemberClients: [FakeSignalClient] = (0..<memberCount).map { _ in
             return FakeSignalClient.generate(e164Identifier: CommonGenerator.e164())
         }
 
@@ -137,7 +227,42 @@ class MessageSendingPerformanceTest: PerformanceBaseTest {
         sendMessages(thread: thread)
     }
 
+    func sendMessages_contactThreads(threadCount: Int) {
+        // ensure local client has necessary "registered" state
+        identityManager.generateNewIdentityKey()
+        tsAccountManager.registerForTests(withLocalNumber: localE164Identifier, uuid: localUUID)
+
+        // Session setup
+        let clients: [FakeSignalClient] = (0..<threadCount).map { _ in
+            return FakeSignalClient.generate(e164Identifier: CommonGenerator.e164())
+        }
+
+        write { transaction in
+            XCTAssertEqual(0, TSMessage.anyCount(transaction: transaction))
+            XCTAssertEqual(0, TSThread.anyCount(transaction: transaction))
+
+            for client in clients {
+                try! self.runner.initialize(senderClient: self.localClient,
+                                            recipientClient: client,
+                                            transaction: transaction)
+            }
+        }
+
+        let threads: [TSThread] = clients.map { client in
+            let threadFactory = ContactThreadFactory()
+            threadFactory.contactAddressBuilder = { client.address }
+            return threadFactory.create()
+        }
+
+        sendMessages(threads: threads)
+    }
+
     func sendMessages(thread: TSThread) {
+        sendMessages(threads: [thread])
+    }
+
+    // Sends the messages to the threads in turn.
+    func sendMessages(threads: [TSThread]) {
         let totalNumberToSend = DebugFlags.fastPerfTests ? 5 : 50
         let expectMessagesSent = expectation(description: "messages sent")
         let hasFulfilled = AtomicBool(false)
@@ -154,30 +279,38 @@ class MessageSendingPerformanceTest: PerformanceBaseTest {
                 return (messageCount, attemptingOutCount)
             }
 
-            if messageCount == totalNumberToSend && attemptingOutCount == 0 {
+            if messageCount == UInt(totalNumberToSend) * UInt(threads.count) && attemptingOutCount == 0 {
                 fulfillOnce()
             }
         }
 
         startMeasuring()
+        let startTime = Date()
 
         for _ in (0..<totalNumberToSend) {
-            // Each is intentionally in a separate transaction, to be closer to the app experience
-            // of sending each message
-            self.read { transaction in
-                let messageBody = MessageBody(text: CommonGenerator.paragraph,
-                                              ranges: MessageBodyRanges.empty)
-                ThreadUtil.enqueueMessage(with: messageBody,
-                                          thread: thread,
-                                          quotedReplyModel: nil,
-                                          linkPreviewDraft: nil,
-                                          transaction: transaction)
+            for thread in threads {
+                // Each is intentionally in a separate transaction, to be closer to the app experience
+                // of sending each message
+                self.read { transaction in
+                    let messageBody = MessageBody(text: CommonGenerator.paragraph,
+                                                  ranges: MessageBodyRanges.empty)
+                    ThreadUtil.enqueueMessage(with: messageBody,
+                                              thread: thread,
+                                              quotedReplyModel: nil,
+                                              linkPreviewDraft: nil,
+                                              transaction: transaction)
+                }
             }
         }
 
-        waitForExpectations(timeout: 20.0) { _ in
+        waitForExpectations(timeout: 60.0) { _ in
             self.stopMeasuring()
 
+            let messageCount = totalNumberToSend * threads.count
+            let duration = abs(startTime.timeIntervalSinceNow)
+            Logger.info("Sent \(messageCount) messages in \(String(format: "%.2f", duration))s (\(String(format: "%.1f", Double(messageCount) / duration)) messages/s), \(self.stubbableNetworkManager.requestCount.get()) requests.")
+            self.stubbableNetworkManager.requestCount.set(0)
+
             self.dbObserverBlock = nil
             // There's some async stuff that happens in message sender that will explode if
             // we delete these models too early - e.g. sending a sync message, which we can't
@@ -223,15 +356,47 @@ class StubbableNetworkManager: TSNetworkManager {
         success(fakeTask, nil)
     }
 
-    override func makeRequest(_ request: TSRequest, completionQueue: DispatchQueue, success: @escaping TSNetworkManagerSuccess, failure: @escaping TSNetworkManagerFailure) {
+    // This latency is optimistic because I didn't want to slow
+    // the tests down too much. But I did want to introduce some
+    // non-trivial latency to make any interactions with the various
+    // async's a little more realistic.
+    var latency = DispatchTimeInterval.milliseconds(25)
+
+    // If set, every nth request fails as though the connection was lost,
+    // so that runs are comparable.
+    var lossInterval: Int?
 
-        // This latency is optimistic because I didn't want to slow
-        // the tests down too much. But I did want to introduce some
-        // non-trivial latency to make any interactions with the various
-        // async's a little more realistic.
-        let fakeNetworkLatency = DispatchTimeInterval.milliseconds(25)
-        completionQueue.asyncAfter(deadline: .now() + fakeNetworkLatency) {
+    let requestCount = AtomicUInt(0)
+
+    override func makeRequest(_ request: TSRequest, completionQueue: DispatchQueue, success: @escaping TSNetworkManagerSuccess, failure: @escaping TSNetworkManagerFailure) {
+        let requestIndex = requestCount.increment()
+        let isLost = lossInterval.map { requestIndex % UInt($0) == 0 } ?? false
+
+        completionQueue.asyncAfter(deadline: .now() + latency) {
+            guard !isLost else {
+                Logger.info("faking lost connection for request: \(request)")
+                let connectionError = NSError(domain: NSURLErrorDomain, code: NSURLErrorNetworkConnectionLost)
+                failure(URLSessionDataTask(),
+                        NSError(domain: TSNetworkManagerErrorDomain,
+                                code: TSNetworkManagerError.failedConnection.rawValue,
+                                userInfo: [NSUnderlyingErrorKey: connectionError]))
+                return
+            }
             self.block(request, success, failure)
         }
     }
+
+    // An error like those with which TSNetworkManager fails requests
+    // that receive an error response.
+    static func responseError(statusCode: Int, responseData: Data?) -> NSError {
+        var underlyingUserInfo = [String: Any]()
+        if let responseData = responseData {
+            // AFNetworkingOperationFailingURLResponseDataErrorKey
+            underlyingUserInfo["com.alamofire.serialization.response.error.data"] = responseData
+        }
+        let underlyingError = NSError(domain: NSURLErrorDomain, code: NSURLErrorBadServerResponse, userInfo: underlyingUserInfo)
+        return NSError(domain: TSNetworkManagerErrorDomain,
+                       code: statusCode,
+                       userInfo: [NSUnderlyingErrorKey: underlyingError])
+    }
 }
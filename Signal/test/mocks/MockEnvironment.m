@@ -41,7 +41,7 @@ NS_ASSUME_NONNULL_BEGIN
                             launchJobs:launchJobs
                            preferences:preferences
             proximityMonitoringManager:proximityMonitoringManager
-                                sounds:sounds
+                           soundsBlock:^{ return sounds; }
                          windowManager:windowManager
                     contactsViewHelper:contactsViewHelper
          broadcastMediaMessageJobQueue:broadcastMediaMessageJobQueue];
@@ -16,6 +16,22 @@ class ByteParserTest: SignalBaseTest {
         super.tearDown()
     }
 
+    func testGetByte() {
+        let data = Data([0x01, 0xff])
+        let parser = ByteParser(data: data, littleEndian: true)
+        XCTAssertNotNil(parser)
+        XCTAssertFalse(parser.hasError)
+
+        XCTAssertEqual(1, parser.nextByte())
+        XCTAssertFalse(parser.hasError)
+
+        XCTAssertEqual(255, parser.nextByte())
+        XCTAssertFalse(parser.hasError)
+
+        XCTAssertEqual(0, parser.nextByte())
+        XCTAssertTrue(parser.hasError)
+    }
+
     func testGetShort_Empty() {
         let parser = ByteParser(data: Data(), littleEndian: true)
         XCTAssertNotNil(parser)
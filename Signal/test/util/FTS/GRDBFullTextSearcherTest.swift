@@ -335,6 +335,19 @@ class GRDBFullTextSearcherTest: SignalBaseTest {
         AssertEqualThreadLists([aliceThread, bookClubThread], resultSet.messages.map { $0.thread })
     }
 
+    func testSearchWithinConversation() {
+        XCTAssertEqual(1, getConversationResultSet(thread: aliceThread, searchText: "Hello").messages.count)
+        XCTAssertEqual(0, getConversationResultSet(thread: bobEmptyThread, searchText: "Hello").messages.count)
+
+        let resultSet = getConversationResultSet(thread: bookClubThread, searchText: "Club")
+        XCTAssertEqual(2, resultSet.messages.count)
+
+        // Limited results are the most recent matches.
+        let limitedResultSet = getConversationResultSet(thread: bookClubThread, searchText: "Club", maxResults: 1)
+        XCTAssertEqual(1, limitedResultSet.messages.count)
+        XCTAssertEqual(resultSet.messages.first?.messageId, limitedResultSet.messages.first?.messageId)
+    }
+
     func testSearchEdgeCases() {
         var resultSet: HomeScreenSearchResultSet = .empty
 
@@ -664,4 +677,17 @@ class GRDBFullTextSearcherTest: SignalBaseTest {
         }
         return results
     }
+
+    private func getConversationResultSet(thread: ThreadViewModel,
+                                          searchText: String,
+                                          maxResults: UInt = FullTextSearcher.kDefaultMaxResults) -> ConversationScreenSearchResultSet {
+        var results: ConversationScreenSearchResultSet!
+        self.read { transaction in
+            results = self.searcher.searchWithinConversation(thread: thread.threadRecord,
+                                                             searchText: searchText,
+                                                             maxResults: maxResults,
+                                                             transaction: transaction)
+        }
+        return results
+    }
 }
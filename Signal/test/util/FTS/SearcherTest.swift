@@ -85,6 +85,43 @@ class SearcherTest: SignalBaseTest {
         }
     }
 
+    func testIndexedSearcher() {
+        let indexedSearcher = IndexedSearcher<String>()
+        let characters = [smerdyakov, stinkingLizaveta, regularLizaveta]
+        read { transaction in
+            for character in characters {
+                indexedSearcher.index(key: character.name, indexingString: self.indexer(character, transaction))
+            }
+        }
+        let keys = characters.map { $0.name }
+
+        XCTAssertEqual(indexedSearcher.search(query: "pavel", among: keys), [smerdyakov.name])
+        XCTAssertEqual(indexedSearcher.search(query: "Liza 323", among: keys), [stinkingLizaveta.name])
+        XCTAssertEqual(indexedSearcher.search(query: "1-323-555-5555", among: keys), [stinkingLizaveta.name])
+        XCTAssertEqual(indexedSearcher.search(query: "asdf", among: keys), [])
+        XCTAssertEqual(indexedSearcher.search(query: "", among: keys), [])
+
+        XCTAssertEqual(indexedSearcher.search(query: "ing", among: keys), [stinkingLizaveta.name])
+        XCTAssertEqual(indexedSearcher.search(query: "s", among: keys), [smerdyakov.name, stinkingLizaveta.name])
+
+        // Word prefix matches come first.
+        XCTAssertEqual(indexedSearcher.search(query: "o", among: keys), [stinkingLizaveta.name, smerdyakov.name])
+        XCTAssertEqual(indexedSearcher.search(query: "liza", among: keys.reversed()),
+                       [regularLizaveta.name, stinkingLizaveta.name])
+
+        // Only the given keys are searched.
+        XCTAssertEqual(indexedSearcher.search(query: "liza", among: [regularLizaveta.name]), [regularLizaveta.name])
+
+        // Re-indexing replaces the old indexing string.
+        indexedSearcher.index(key: regularLizaveta.name, indexingString: "Alyosha")
+        XCTAssertEqual(indexedSearcher.search(query: "liza", among: keys), [stinkingLizaveta.name])
+        XCTAssertEqual(indexedSearcher.search(query: "alyosha", among: keys), [regularLizaveta.name])
+
+        indexedSearcher.removeFromIndex(key: regularLizaveta.name)
+        XCTAssertFalse(indexedSearcher.isIndexed(key: regularLizaveta.name))
+        XCTAssertEqual(indexedSearcher.search(query: "alyosha", among: keys), [])
+    }
+
     func testSearchQuery() {
         XCTAssertEqual(FullTextSearchFinder.query(searchText: "Liza"), "\"Liza\"*")
         XCTAssertEqual(FullTextSearchFinder.query(searchText: "Liza +1-323"), "\"1323\"* \"Liza\"*")
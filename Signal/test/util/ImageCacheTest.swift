@@ -59,4 +59,16 @@ class ImageCacheTest: SignalBaseTest {
         XCTAssertNil(imageCache.image(forKey: cacheKey1, diameter: 200))
         XCTAssertNil(imageCache.image(forKey: cacheKey2, diameter: 100))
     }
+
+    func testByteCountLimit() {
+        // Every image exceeds the limit, so each shard holds at most one key.
+        let imageCache = ImageCache(maxSize: 256, maxByteCount: 1)
+        let keys = (0..<100).map { "cache-key-\($0)" as NSString }
+        for key in keys {
+            imageCache.setImage(firstVariation, forKey: key, diameter: 100)
+        }
+        let cachedCount = keys.filter { imageCache.image(forKey: $0, diameter: 100) != nil }.count
+        XCTAssertGreaterThan(cachedCount, 0)
+        XCTAssertLessThanOrEqual(cachedCount, 8)
+    }
 }
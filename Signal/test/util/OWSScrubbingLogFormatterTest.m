@@ -305,6 +305,41 @@ NS_ASSUME_NONNULL_BEGIN
     XCTAssertEqual(NSNotFound, uuidRange.location, "Failed to redact UUID string: %@", uuidString);
 }
 
+- (void)testMixedValuesScrubbed
+{
+    OWSScrubbingLogFormatter *formatter = [OWSScrubbingLogFormatter new];
+    NSString *messageText = @"Sent 🎉 to +13331231234 (BAF1768C-2A25-4D8F-83B7-A89C59C98748) via 10.0.0.42 with <01234567 89ab>";
+    NSString *actual = [formatter formatLogMessage:[self messageWithString:messageText]];
+    NSString *expected = @"Sent 🎉 to [ REDACTED_PHONE_NUMBER:xxx234 ] "
+                         @"([ REDACTED_UUID:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxx48 ]) "
+                         @"via [ REDACTED_IPV4_ADDRESS:...42 ] with [ REDACTED_DATA:01... ]";
+    XCTAssertTrue([actual hasSuffix:expected], @"Unexpected scrubbed string: %@", actual);
+}
+
+- (void)testValuesAfterNULScrubbed
+{
+    OWSScrubbingLogFormatter *formatter = [OWSScrubbingLogFormatter new];
+    NSString *messageText = [NSString stringWithFormat:@"Before NUL%Cafter NUL +13331231234", (unichar)0];
+    NSString *actual = [formatter formatLogMessage:[self messageWithString:messageText]];
+    XCTAssertTrue([actual hasSuffix:@"after NUL [ REDACTED_PHONE_NUMBER:xxx234 ]"], @"Unexpected scrubbed string: %@", actual);
+}
+
+- (void)testValuesAfterLongDigitRunsScrubbed
+{
+    OWSScrubbingLogFormatter *formatter = [OWSScrubbingLogFormatter new];
+    NSString *digits = [@"" stringByPaddingToLength:100000 withString:@"1234567890" startingIndex:0];
+    NSString *messageText = [NSString stringWithFormat:@"%@ %@.0.0.42 %@BAF1768C-2A25-4D8F-83B7-A89C59C98748",
+                                      digits,
+                                      digits,
+                                      digits];
+    NSString *actual = [formatter formatLogMessage:[self messageWithString:messageText]];
+    NSString *expected = [NSString stringWithFormat:@"%@ [ REDACTED_IPV4_ADDRESS:...42 ] "
+                                                    @"%@[ REDACTED_UUID:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxx48 ]",
+                                  digits,
+                                  digits];
+    XCTAssertTrue([actual hasSuffix:expected], @"Unexpected scrubbed string.");
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -561,4 +561,91 @@ class YDBToGRDBMigrationKeyValueTest: SignalBaseTest {
             XCTAssertNil(store3.getObject(forKey: "key1", transaction: transaction))
         }
     }
+
+    func testResumesFromCheckpoints() {
+        storageCoordinator.useGRDBForTests()
+
+        let store1 = SDSKeyValueStore(collection: "store1")
+        let store2 = SDSKeyValueStore(collection: "store2")
+
+        self.yapWrite { transaction in
+            store1.setString("a", key: "key0", transaction: transaction.asAnyWrite)
+            store1.setString("b", key: "key1", transaction: transaction.asAnyWrite)
+            store2.setString("c", key: "key0", transaction: transaction.asAnyWrite)
+        }
+
+        let migratorGroups = [
+            GRDBMigratorGroup(isConcurrent: true) { ydbTransaction in
+                return [
+                    GRDBKeyValueStoreMigrator<Any>(label: "store1", keyStore: store1, ydbTransaction: ydbTransaction),
+                    GRDBKeyValueStoreMigrator<Any>(label: "store2", keyStore: store2, ydbTransaction: ydbTransaction)
+                ]
+            }
+        ]
+
+        try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+
+        // If YDB hasn't changed, a resumed migration skips the records
+        // which were already migrated.
+        self.write { transaction in
+            store1.setString("x", key: "key0", transaction: transaction)
+        }
+        try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+        self.read { transaction in
+            XCTAssertEqual("x", store1.getString("key0", transaction: transaction))
+        }
+
+        // If YDB changes before the migration resumes, the migration
+        // discards its partial copy rather than keep stale records.
+        self.yapWrite { transaction in
+            store1.setString("d", key: "key0", transaction: transaction.asAnyWrite)
+            store1.setString("e", key: "key2", transaction: transaction.asAnyWrite)
+        }
+
+        try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+
+        self.read { transaction in
+            XCTAssertEqual(3, store1.numberOfKeys(transaction: transaction))
+            XCTAssertEqual(1, store2.numberOfKeys(transaction: transaction))
+
+            XCTAssertEqual("d", store1.getString("key0", transaction: transaction))
+            XCTAssertEqual("b", store1.getString("key1", transaction: transaction))
+            XCTAssertEqual("e", store1.getString("key2", transaction: transaction))
+            XCTAssertEqual("c", store2.getString("key0", transaction: transaction))
+        }
+    }
+
+    func testDiscardsRemovedKeysIfYdbChanged() {
+        storageCoordinator.useGRDBForTests()
+
+        let store = SDSKeyValueStore(collection: "store")
+
+        self.yapWrite { transaction in
+            store.setString("a", key: "key1", transaction: transaction.asAnyWrite)
+            store.setString("b", key: "key3", transaction: transaction.asAnyWrite)
+        }
+
+        let migratorGroups = [
+            GRDBMigratorGroup { ydbTransaction in
+                return [GRDBKeyValueStoreMigrator<Any>(label: "store", keyStore: store, ydbTransaction: ydbTransaction)]
+            }
+        ]
+
+        try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+
+        // A key removed from YDB after it was migrated must not stay in GRDB.
+        self.yapWrite { transaction in
+            store.removeValue(forKey: "key1", transaction: transaction.asAnyWrite)
+            store.setString("c", key: "key4", transaction: transaction.asAnyWrite)
+        }
+
+        try! YDBToGRDBMigration().migrate(migratorGroups: migratorGroups)
+
+        self.read { transaction in
+            XCTAssertEqual(2, store.numberOfKeys(transaction: transaction))
+            XCTAssertNil(store.getString("key1", transaction: transaction))
+            XCTAssertEqual("b", store.getString("key3", transaction: transaction))
+            XCTAssertEqual("c", store.getString("key4", transaction: transaction))
+        }
+    }
 }
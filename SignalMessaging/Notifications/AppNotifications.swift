@@ -154,6 +154,10 @@ let kNotificationDelayForRemoteRead: TimeInterval = 5
 let kAudioNotificationsThrottleCount = 2
 let kAudioNotificationsThrottleInterval: TimeInterval = 5
 
+// Notifications for incoming messages to the same thread which arrive within
+// this interval are coalesced into one notification.
+let kIncomingMessageNotificationBatchInterval: TimeInterval = 0.5
+
 protocol NotificationPresenterAdaptee: class {
 
     func registerNotificationSettings() -> Promise<Void>
@@ -182,6 +186,8 @@ extension NotificationPresenterAdaptee {
 public class NotificationPresenter: NSObject, NotificationsProtocol {
     private let adaptee: NotificationPresenterAdaptee
 
+    private let incomingMessageBatcher = IncomingMessageNotificationBatcher()
+
     @objc
     public override init() {
         self.adaptee = UserNotificationPresenterAdaptee()
@@ -420,7 +426,13 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
 
         let messageText = rawMessageText.filterStringForDisplay()
 
-        let senderName = contactsManager.displayName(for: incomingMessage.authorAddress, transaction: transaction)
+        // Reuse the metadata resolved for any notification which is already
+        // pending for this thread.
+        let threadMetadata = incomingMessageBatcher.metadata(forThreadId: thread.uniqueId)
+
+        let senderAddress = incomingMessage.authorAddress
+        let senderName = threadMetadata?.senderNames[senderAddress]
+            ?? contactsManager.displayName(for: senderAddress, transaction: transaction)
 
         let notificationTitle: String?
         let threadIdentifier: String?
@@ -455,12 +467,13 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
 
         // Don't reply from lockscreen if anyone in this conversation is
         // "no longer verified".
-        var didIdentityChange = false
-        for address in thread.recipientAddresses {
-            if self.identityManager.verificationState(for: address,
-                                                      transaction: transaction) == .noLongerVerified {
-                didIdentityChange = true
-                break
+        let didIdentityChange: Bool
+        if let threadMetadata = threadMetadata {
+            didIdentityChange = threadMetadata.didIdentityChange
+        } else {
+            didIdentityChange = thread.recipientAddresses.contains { address in
+                self.identityManager.verificationState(for: address,
+                                                       transaction: transaction) == .noLongerVerified
             }
         }
 
@@ -479,13 +492,56 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
             AppNotificationUserInfoKey.messageId: incomingMessage.uniqueId
         ]
 
-        DispatchQueue.main.async {
-            let sound = self.requestSound(thread: thread)
-            self.adaptee.notify(category: category,
-                                title: notificationTitle,
-                                body: notificationBody ?? "",
-                                threadIdentifier: threadIdentifier,
-                                userInfo: userInfo,
+        let notification = IncomingMessageNotificationBatcher.NotificationContent(
+            category: category,
+            title: notificationTitle,
+            body: notificationBody ?? "",
+            threadIdentifier: threadIdentifier,
+            userInfo: userInfo
+        )
+        let isFirstPendingNotification = incomingMessageBatcher.enqueue(notification,
+                                                                        thread: thread,
+                                                                        messageId: incomingMessage.uniqueId,
+                                                                        senderAddress: senderAddress,
+                                                                        senderName: senderName,
+                                                                        didIdentityChange: didIdentityChange)
+        if isFirstPendingNotification {
+            scheduleIncomingMessageNotifications()
+        }
+    }
+
+    private func scheduleIncomingMessageNotifications() {
+        // Extensions may be terminated soon after they finish processing
+        // messages, so they only coalesce the notifications which are
+        // requested before the main queue gets to them.
+        if CurrentAppContext().isMainApp {
+            DispatchQueue.main.asyncAfter(deadline: .now() + kIncomingMessageNotificationBatchInterval) {
+                self.presentPendingIncomingMessageNotifications()
+            }
+        } else {
+            DispatchQueue.main.async {
+                self.presentPendingIncomingMessageNotifications()
+            }
+        }
+    }
+
+    private func presentPendingIncomingMessageNotifications() {
+        AssertIsOnMainThread()
+
+        let pendingNotifications = incomingMessageBatcher.dequeueAll()
+        if pendingNotifications.count > 1 {
+            Logger.verbose("Presenting coalesced notifications for \(pendingNotifications.count) threads.")
+        }
+        for pendingNotification in pendingNotifications {
+            // Only the latest message to each thread is presented; it replaces
+            // the notifications for any earlier messages in the batch.
+            let notification = pendingNotification.notification
+            let sound = self.requestSound(thread: pendingNotification.thread)
+            self.adaptee.notify(category: notification.category,
+                                title: notification.title,
+                                body: notification.body,
+                                threadIdentifier: notification.threadIdentifier,
+                                userInfo: notification.userInfo,
                                 sound: sound)
         }
     }
@@ -728,11 +784,13 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
 
     @objc
     public func cancelNotifications(threadId: String) {
+        incomingMessageBatcher.cancel(threadId: threadId)
         adaptee.cancelNotifications(threadId: threadId)
     }
 
     @objc
     public func cancelNotifications(messageId: String) {
+        incomingMessageBatcher.cancel(messageId: messageId)
         adaptee.cancelNotifications(messageId: messageId)
     }
 
@@ -743,6 +801,7 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
 
     @objc
     public func clearAllNotifications() {
+        incomingMessageBatcher.cancelAll()
         adaptee.clearAllNotifications()
     }
 
@@ -788,6 +847,129 @@ public class NotificationPresenter: NSObject, NotificationsProtocol {
     }
 }
 
+// MARK: -
+
+// Holds the notifications for incoming messages until they are presented,
+// one per thread, along with the metadata resolved for each thread so that
+// the notifications for subsequent messages needn't resolve it again.
+//
+// This class is thread-safe.
+private class IncomingMessageNotificationBatcher {
+
+    struct NotificationContent {
+        let category: AppNotificationCategory
+        let title: String?
+        let body: String
+        let threadIdentifier: String?
+        let userInfo: [AnyHashable: Any]
+    }
+
+    struct ThreadMetadata {
+        let didIdentityChange: Bool
+        var senderNames: [SignalServiceAddress: String]
+    }
+
+    struct PendingNotification {
+        let thread: TSThread
+        var notification: NotificationContent
+        // The message whose content the notification presents.
+        var messageId: String
+        var metadata: ThreadMetadata
+        // The messages which this notification represents.
+        var messageIds: Set<String>
+    }
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var pendingNotifications = [String: PendingNotification]()
+    // Preserves the order in which threads were first notified.
+    private var pendingThreadIds = [String]()
+
+    func metadata(forThreadId threadId: String) -> ThreadMetadata? {
+        unfairLock.withLock {
+            pendingNotifications[threadId]?.metadata
+        }
+    }
+
+    // Replaces any notification which is pending for the thread.
+    //
+    // Returns true if no notifications were pending, in which case the
+    // caller should schedule their presentation.
+    func enqueue(_ notification: NotificationContent,
+                 thread: TSThread,
+                 messageId: String,
+                 senderAddress: SignalServiceAddress,
+                 senderName: String,
+                 didIdentityChange: Bool) -> Bool {
+        unfairLock.withLock {
+            let threadId = thread.uniqueId
+            let wasEmpty = pendingNotifications.isEmpty
+            if var pendingNotification = pendingNotifications[threadId] {
+                pendingNotification.notification = notification
+                pendingNotification.messageId = messageId
+                pendingNotification.metadata.senderNames[senderAddress] = senderName
+                pendingNotification.messageIds.insert(messageId)
+                pendingNotifications[threadId] = pendingNotification
+            } else {
+                let metadata = ThreadMetadata(didIdentityChange: didIdentityChange,
+                                              senderNames: [senderAddress: senderName])
+                pendingNotifications[threadId] = PendingNotification(thread: thread,
+                                                                     notification: notification,
+                                                                     messageId: messageId,
+                                                                     metadata: metadata,
+                                                                     messageIds: [messageId])
+                pendingThreadIds.append(threadId)
+            }
+            return wasEmpty
+        }
+    }
+
+    func dequeueAll() -> [PendingNotification] {
+        unfairLock.withLock {
+            let result = pendingThreadIds.compactMap { pendingNotifications[$0] }
+            pendingNotifications.removeAll()
+            pendingThreadIds.removeAll()
+            return result
+        }
+    }
+
+    func cancel(threadId: String) {
+        unfairLock.withLock {
+            guard pendingNotifications.removeValue(forKey: threadId) != nil else {
+                return
+            }
+            pendingThreadIds.removeAll { $0 == threadId }
+        }
+    }
+
+    func cancel(messageId: String) {
+        unfairLock.withLock {
+            guard let threadId = pendingNotifications.first(where: {
+                $0.value.messageIds.contains(messageId)
+            })?.key else {
+                return
+            }
+            // If the message which the notification presents was read, so
+            // were any earlier messages it represents.
+            guard pendingNotifications[threadId]?.messageId != messageId else {
+                pendingNotifications.removeValue(forKey: threadId)
+                pendingThreadIds.removeAll { $0 == threadId }
+                return
+            }
+            pendingNotifications[threadId]?.messageIds.remove(messageId)
+        }
+    }
+
+    func cancelAll() {
+        unfairLock.withLock {
+            pendingNotifications.removeAll()
+            pendingThreadIds.removeAll()
+        }
+    }
+}
+
+// MARK: -
+
 struct TruncatedList<Element> {
     let maxLength: Int
     private var contents: [Element] = []
@@ -187,24 +187,41 @@ public class StorageServiceManager: NSObject, StorageServiceManagerProtocol {
     // MARK: - Backup Scheduling
 
     private static var backupDebounceInterval: TimeInterval = 0.2
+    private static var maxBackupDebounceInterval: TimeInterval = 2
     private var backupTimer: Timer?
+    private var firstPendingBackupDate: Date?
 
-    // Schedule a one time backup. By default, this will happen `backupDebounceInterval`
-    // seconds after the first pending change is recorded.
+    // Schedule a one time backup. This will happen once no further changes
+    // have been recorded for `backupDebounceInterval` seconds, so that a burst
+    // of changes is sent in a single manifest update. To avoid deferring the
+    // backup indefinitely, it will never happen later than
+    // `maxBackupDebounceInterval` seconds after the first pending change.
     private func scheduleBackupIfNecessary() {
         DispatchQueue.main.async {
-            // If we already have a backup scheduled, do nothing
-            guard self.backupTimer == nil else { return }
+            let now = Date()
+            let firstPendingBackupDate = self.firstPendingBackupDate ?? now
+            self.firstPendingBackupDate = firstPendingBackupDate
+
+            let latestBackupDate = firstPendingBackupDate.addingTimeInterval(StorageServiceManager.maxBackupDebounceInterval)
+            let backupDate = min(now.addingTimeInterval(StorageServiceManager.backupDebounceInterval), latestBackupDate)
+
+            if let backupTimer = self.backupTimer {
+                backupTimer.fireDate = backupDate
+                return
+            }
 
             Logger.info("")
 
-            self.backupTimer = Timer.scheduledTimer(
-                timeInterval: StorageServiceManager.backupDebounceInterval,
+            let backupTimer = Timer(
+                fireAt: backupDate,
+                interval: 0,
                 target: self,
                 selector: #selector(self.backupTimerFired),
                 userInfo: nil,
                 repeats: false
             )
+            RunLoop.main.add(backupTimer, forMode: .default)
+            self.backupTimer = backupTimer
         }
     }
 
@@ -215,6 +232,7 @@ public class StorageServiceManager: NSObject, StorageServiceManagerProtocol {
 
         backupTimer?.invalidate()
         backupTimer = nil
+        firstPendingBackupDate = nil
 
         backupPendingChanges()
     }
@@ -675,48 +675,52 @@ public class AttachmentApprovalViewController: UIPageViewController, UIPageViewC
     func editedAttachmentPromise(imageEditorModel: ImageEditorModel,
                                  attachmentApprovalItem: AttachmentApprovalItem) -> Promise<SignalAttachment> {
         assert(imageEditorModel.isDirty())
-        return DispatchQueue.main.async(.promise) { () -> UIImage in
-            guard let dstImage = imageEditorModel.renderOutput() else {
-                throw OWSAssertionError("Could not render for output.")
-            }
-            return dstImage
-        }.map(on: .global()) { (dstImage: UIImage) -> SignalAttachment in
-            var dataUTI = kUTTypeImage as String
-            guard let dstData: Data = {
-                let isLossy: Bool = attachmentApprovalItem.attachment.mimeType.caseInsensitiveCompare(OWSMimeTypeImageJpeg) == .orderedSame
-                if isLossy {
-                    dataUTI = kUTTypeJPEG as String
-                    return dstImage.jpegData(compressionQuality: 0.9)
-                } else {
-                    dataUTI = kUTTypePNG as String
-                    return dstImage.pngData()
+        // Rendering and encoding hold full-size images, so they share the
+        // bounded attachment preparation queue.
+        return SignalAttachment.preparationQueue.enqueue {
+            return DispatchQueue.main.async(.promise) { () -> UIImage in
+                guard let dstImage = imageEditorModel.renderOutput() else {
+                    throw OWSAssertionError("Could not render for output.")
+                }
+                return dstImage
+            }.map(on: .global()) { (dstImage: UIImage) -> SignalAttachment in
+                var dataUTI = kUTTypeImage as String
+                guard let dstData: Data = {
+                    let isLossy: Bool = attachmentApprovalItem.attachment.mimeType.caseInsensitiveCompare(OWSMimeTypeImageJpeg) == .orderedSame
+                    if isLossy {
+                        dataUTI = kUTTypeJPEG as String
+                        return dstImage.jpegData(compressionQuality: 0.9)
+                    } else {
+                        dataUTI = kUTTypePNG as String
+                        return dstImage.pngData()
+                    }
+                    }() else {
+                        owsFailDebug("Could not export for output.")
+                        return attachmentApprovalItem.attachment
                 }
-                }() else {
-                    owsFailDebug("Could not export for output.")
+                guard let dataSource = DataSourceValue.dataSource(with: dstData, utiType: dataUTI) else {
+                    owsFailDebug("Could not prepare data source for output.")
                     return attachmentApprovalItem.attachment
-            }
-            guard let dataSource = DataSourceValue.dataSource(with: dstData, utiType: dataUTI) else {
-                owsFailDebug("Could not prepare data source for output.")
-                return attachmentApprovalItem.attachment
-            }
+                }
 
-            // Rewrite the filename's extension to reflect the output file format.
-            var filename: String? = attachmentApprovalItem.attachment.sourceFilename
-            if let sourceFilename = attachmentApprovalItem.attachment.sourceFilename {
-                if let fileExtension: String = MIMETypeUtil.fileExtension(forUTIType: dataUTI) {
-                    filename = (sourceFilename as NSString).deletingPathExtension.appendingFileExtension(fileExtension)
+                // Rewrite the filename's extension to reflect the output file format.
+                var filename: String? = attachmentApprovalItem.attachment.sourceFilename
+                if let sourceFilename = attachmentApprovalItem.attachment.sourceFilename {
+                    if let fileExtension: String = MIMETypeUtil.fileExtension(forUTIType: dataUTI) {
+                        filename = (sourceFilename as NSString).deletingPathExtension.appendingFileExtension(fileExtension)
+                    }
                 }
-            }
-            dataSource.sourceFilename = filename
+                dataSource.sourceFilename = filename
 
-            let dstAttachment = SignalAttachment.attachment(dataSource: dataSource, dataUTI: dataUTI, imageQuality: .original)
-            if let attachmentError = dstAttachment.error {
-                owsFailDebug("Could not prepare attachment for output: \(attachmentError).")
-                return attachmentApprovalItem.attachment
+                let dstAttachment = SignalAttachment.attachment(dataSource: dataSource, dataUTI: dataUTI, imageQuality: .original)
+                if let attachmentError = dstAttachment.error {
+                    owsFailDebug("Could not prepare attachment for output: \(attachmentError).")
+                    return attachmentApprovalItem.attachment
+                }
+                // Preserve caption text.
+                dstAttachment.captionText = attachmentApprovalItem.captionText
+                return dstAttachment
             }
-            // Preserve caption text.
-            dstAttachment.captionText = attachmentApprovalItem.captionText
-            return dstAttachment
         }
     }
 
@@ -71,6 +71,12 @@ typedef BOOL (^OWSTableSwitchBlock)(void);
 @property (nonatomic, nullable) OWSTableItemEditAction *deleteAction;
 @property (nonatomic, nullable) NSNumber *customRowHeight;
 
+// If every item of a section has an identifier, unique within the section,
+// OWSTableViewController animates changes to that section when its contents
+// are replaced, and only rebuilds the cells of visible and inserted rows.
+// The row's cell height is also remembered, for estimates, by identifier.
+@property (nonatomic, nullable) NSString *identifier;
+
 + (UITableViewCell *)newCell;
 + (void)configureCell:(UITableViewCell *)cell;
 
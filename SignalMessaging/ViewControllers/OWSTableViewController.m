@@ -13,6 +13,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 const CGFloat kOWSTable_DefaultCellHeight = 45.f;
 
+static BOOL OWSTableObjectsAreEqual(id _Nullable left, id _Nullable right)
+{
+    return left == right || [left isEqual:right];
+}
+
 @interface OWSTableContents ()
 
 @property (nonatomic) NSMutableArray<OWSTableSection *> *sections;
@@ -556,6 +561,8 @@ const CGFloat kOWSTable_DefaultCellHeight = 45.f;
 
 @property (nonatomic) UITableView *tableView;
 
+@property (nonatomic, readonly) NSMutableDictionary<NSString *, NSNumber *> *cellHeightCache;
+
 @end
 
 #pragma mark -
@@ -579,6 +586,7 @@ NSString *const kOWSTableCellIdentifier = @"kOWSTableCellIdentifier";
 - (void)owsTableCommonInit
 {
     _contents = [OWSTableContents new];
+    _cellHeightCache = [NSMutableDictionary new];
     self.tableViewStyle = UITableViewStyleGrouped;
 }
 
@@ -660,17 +668,162 @@ NSString *const kOWSTableCellIdentifier = @"kOWSTableCellIdentifier";
     OWSAssertIsOnMainThread();
 
     if (contents != _contents) {
+        OWSTableContents *oldContents = _contents;
         _contents = contents;
-        [self applyContents];
+        [self applyContentsReplacingContents:oldContents];
     }
 }
 
 - (void)applyContents
+{
+    [self applyContentsReplacingContents:nil];
+}
+
+- (void)applyContentsReplacingContents:(nullable OWSTableContents *)oldContents
 {
     if (self.contents.title.length > 0) {
         self.title = self.contents.title;
     }
-    [self.tableView reloadData];
+
+    if (oldContents == nil || ![self canUpdateTableViewFromContents:oldContents]) {
+        [self.tableView reloadData];
+        return;
+    }
+
+    NSMutableIndexSet *reloadedSections = [NSMutableIndexSet new];
+    NSMutableArray<NSIndexPath *> *deletedIndexPaths = [NSMutableArray new];
+    NSMutableArray<NSIndexPath *> *insertedIndexPaths = [NSMutableArray new];
+    for (NSUInteger sectionIndex = 0; sectionIndex < self.contents.sections.count; sectionIndex++) {
+        OWSTableSection *oldSection = oldContents.sections[sectionIndex];
+        OWSTableSection *newSection = self.contents.sections[sectionIndex];
+        if (![self updateRowsFromSection:oldSection
+                                toSection:newSection
+                             sectionIndex:(NSInteger)sectionIndex
+                        deletedIndexPaths:deletedIndexPaths
+                       insertedIndexPaths:insertedIndexPaths]) {
+            [reloadedSections addIndex:sectionIndex];
+        }
+    }
+
+    // Rows which are in both contents keep their place, but their cells
+    // may have changed, so we rebuild those that are visible.
+    NSMutableArray<NSIndexPath *> *reloadedIndexPaths = [NSMutableArray new];
+    NSSet<NSIndexPath *> *deletedIndexPathSet = [NSSet setWithArray:deletedIndexPaths];
+    for (NSIndexPath *indexPath in self.tableView.indexPathsForVisibleRows) {
+        if (![reloadedSections containsIndex:(NSUInteger)indexPath.section]
+            && ![deletedIndexPathSet containsObject:indexPath]) {
+            [reloadedIndexPaths addObject:indexPath];
+        }
+    }
+
+    [self.tableView beginUpdates];
+    [self.tableView reloadSections:reloadedSections withRowAnimation:UITableViewRowAnimationNone];
+    [self.tableView reloadRowsAtIndexPaths:reloadedIndexPaths withRowAnimation:UITableViewRowAnimationNone];
+    [self.tableView deleteRowsAtIndexPaths:deletedIndexPaths withRowAnimation:UITableViewRowAnimationFade];
+    [self.tableView insertRowsAtIndexPaths:insertedIndexPaths withRowAnimation:UITableViewRowAnimationFade];
+    [self.tableView endUpdates];
+}
+
+// Replacing the contents reloads the whole table unless the sections line
+// up and the table is on screen.
+- (BOOL)canUpdateTableViewFromContents:(OWSTableContents *)oldContents
+{
+    if (!self.isViewLoaded || self.tableView.window == nil) {
+        return NO;
+    }
+    if (oldContents.sections.count != self.contents.sections.count) {
+        return NO;
+    }
+    if (self.contents.sectionForSectionIndexTitleBlock != nil
+        || self.contents.sectionIndexTitlesForTableViewBlock != nil) {
+        return NO;
+    }
+    // The old contents may have been modified since they were applied.
+    if (self.tableView.numberOfSections != (NSInteger)oldContents.sections.count) {
+        return NO;
+    }
+    for (NSUInteger sectionIndex = 0; sectionIndex < oldContents.sections.count; sectionIndex++) {
+        if ([self.tableView numberOfRowsInSection:(NSInteger)sectionIndex]
+            != (NSInteger)oldContents.sections[sectionIndex].items.count) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Returns NO if the section should be reloaded instead.
+//
+// Rebuilding the rows of a section only rebuilds its visible cells, so we
+// don't try to express moves, or changes to headers and footers, as row
+// updates.
+- (BOOL)updateRowsFromSection:(OWSTableSection *)oldSection
+                    toSection:(OWSTableSection *)newSection
+                 sectionIndex:(NSInteger)sectionIndex
+            deletedIndexPaths:(NSMutableArray<NSIndexPath *> *)deletedIndexPaths
+           insertedIndexPaths:(NSMutableArray<NSIndexPath *> *)insertedIndexPaths
+{
+    if (!OWSTableObjectsAreEqual(oldSection.headerTitle, newSection.headerTitle)
+        || !OWSTableObjectsAreEqual(oldSection.footerTitle, newSection.footerTitle)
+        || !OWSTableObjectsAreEqual(oldSection.headerAttributedTitle, newSection.headerAttributedTitle)
+        || !OWSTableObjectsAreEqual(oldSection.footerAttributedTitle, newSection.footerAttributedTitle)
+        || oldSection.customHeaderView != newSection.customHeaderView
+        || oldSection.customFooterView != newSection.customFooterView
+        || !OWSTableObjectsAreEqual(oldSection.customHeaderHeight, newSection.customHeaderHeight)
+        || !OWSTableObjectsAreEqual(oldSection.customFooterHeight, newSection.customFooterHeight)) {
+        return NO;
+    }
+
+    NSArray<NSString *> *_Nullable oldIdentifiers = [self identifiersForSection:oldSection];
+    NSArray<NSString *> *_Nullable newIdentifiers = [self identifiersForSection:newSection];
+    if (oldIdentifiers == nil || newIdentifiers == nil) {
+        return NO;
+    }
+
+    NSSet<NSString *> *oldIdentifierSet = [NSSet setWithArray:oldIdentifiers];
+    NSSet<NSString *> *newIdentifierSet = [NSSet setWithArray:newIdentifiers];
+
+    NSMutableArray<NSString *> *oldRetainedIdentifiers = [NSMutableArray new];
+    NSMutableArray<NSIndexPath *> *sectionDeletedIndexPaths = [NSMutableArray new];
+    [oldIdentifiers enumerateObjectsUsingBlock:^(NSString *identifier, NSUInteger index, BOOL *stop) {
+        if ([newIdentifierSet containsObject:identifier]) {
+            [oldRetainedIdentifiers addObject:identifier];
+        } else {
+            [sectionDeletedIndexPaths addObject:[NSIndexPath indexPathForRow:(NSInteger)index inSection:sectionIndex]];
+        }
+    }];
+
+    NSMutableArray<NSString *> *newRetainedIdentifiers = [NSMutableArray new];
+    NSMutableArray<NSIndexPath *> *sectionInsertedIndexPaths = [NSMutableArray new];
+    [newIdentifiers enumerateObjectsUsingBlock:^(NSString *identifier, NSUInteger index, BOOL *stop) {
+        if ([oldIdentifierSet containsObject:identifier]) {
+            [newRetainedIdentifiers addObject:identifier];
+        } else {
+            [sectionInsertedIndexPaths addObject:[NSIndexPath indexPathForRow:(NSInteger)index inSection:sectionIndex]];
+        }
+    }];
+
+    if (![oldRetainedIdentifiers isEqualToArray:newRetainedIdentifiers]) {
+        return NO;
+    }
+
+    [deletedIndexPaths addObjectsFromArray:sectionDeletedIndexPaths];
+    [insertedIndexPaths addObjectsFromArray:sectionInsertedIndexPaths];
+    return YES;
+}
+
+// Returns nil unless every item has a unique identifier.
+- (nullable NSArray<NSString *> *)identifiersForSection:(OWSTableSection *)section
+{
+    NSMutableArray<NSString *> *identifiers = [NSMutableArray new];
+    NSMutableSet<NSString *> *identifierSet = [NSMutableSet new];
+    for (OWSTableItem *item in section.items) {
+        if (item.identifier == nil || [identifierSet containsObject:item.identifier]) {
+            return nil;
+        }
+        [identifiers addObject:item.identifier];
+        [identifierSet addObject:item.identifier];
+    }
+    return identifiers;
 }
 
 #pragma mark - Table view data source
@@ -724,6 +877,31 @@ NSString *const kOWSTableCellIdentifier = @"kOWSTableCellIdentifier";
     return kOWSTable_DefaultCellHeight;
 }
 
+- (CGFloat)tableView:(UITableView *)tableView estimatedHeightForRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    OWSTableItem *item = [self itemForIndexPath:indexPath];
+    if (item.customRowHeight != nil && item.customRowHeight.floatValue != UITableViewAutomaticDimension) {
+        return [item.customRowHeight floatValue];
+    }
+    if (item.identifier != nil) {
+        NSNumber *_Nullable cachedHeight = self.cellHeightCache[item.identifier];
+        if (cachedHeight != nil) {
+            return [cachedHeight floatValue];
+        }
+    }
+    return tableView.estimatedRowHeight;
+}
+
+- (void)tableView:(UITableView *)tableView
+      willDisplayCell:(UITableViewCell *)cell
+    forRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    OWSTableItem *item = [self itemForIndexPath:indexPath];
+    if (item.identifier != nil && cell.frame.size.height > 0) {
+        self.cellHeightCache[item.identifier] = @(cell.frame.size.height);
+    }
+}
+
 - (nullable UIView *)tableView:(UITableView *)tableView viewForHeaderInSection:(NSInteger)sectionIndex
 {
     OWSTableSection *section = [self sectionForIndex:sectionIndex];
@@ -902,6 +1080,7 @@ NSString *const kOWSTableCellIdentifier = @"kOWSTableCellIdentifier";
     OWSAssertIsOnMainThread();
 
     [self applyTheme];
+    [self.cellHeightCache removeAllObjects];
     [self.tableView reloadData];
 }
 
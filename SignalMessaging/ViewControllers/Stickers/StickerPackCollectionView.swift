@@ -211,12 +211,14 @@ public class StickerPackCollectionView: UICollectionView {
         stickerView.autoPinEdge(toSuperviewEdge: .trailing, withInset: hMargin, relation: .greaterThanOrEqual)
     }
 
-    private func imageView(forStickerInfo stickerInfo: StickerInfo) -> UIView? {
+    private func imageView(forStickerInfo stickerInfo: StickerInfo, displaySize: CGFloat? = nil) -> UIView? {
         guard let stickerPackDataSource = stickerPackDataSource else {
             owsFailDebug("Missing stickerPackDataSource.")
             return nil
         }
-        return StickerView.stickerView(forStickerInfo: stickerInfo, dataSource: stickerPackDataSource)
+        return StickerView.stickerView(forStickerInfo: stickerInfo,
+                                       dataSource: stickerPackDataSource,
+                                       displaySize: displaySize)
     }
 }
 
@@ -260,7 +262,8 @@ extension StickerPackCollectionView: UICollectionViewDataSource {
             owsFailDebug("Invalid index path: \(indexPath)")
             return cell
         }
-        guard let stickerView = imageView(forStickerInfo: stickerInfo) else {
+        let cellSize = (collectionViewLayout as? UICollectionViewFlowLayout)?.itemSize.width
+        guard let stickerView = imageView(forStickerInfo: stickerInfo, displaySize: cellSize) else {
             owsFailDebug("Couldn't load sticker for display")
             return cell
         }
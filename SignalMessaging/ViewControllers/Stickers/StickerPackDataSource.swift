@@ -331,7 +331,8 @@ public class TransientStickerPackDataSource: BaseStickerPackDataSource {
         }
 
         // Try to download sticker data, if necessary.
-        if ensureStickerDownload(stickerPack: stickerPack, stickerInfo: stickerPack.coverInfo) {
+        // The cover is shown first, so it jumps ahead of the pack's stickers.
+        if ensureStickerDownload(stickerPack: stickerPack, stickerInfo: stickerPack.coverInfo, priority: .high) {
             self.coverInfo = stickerPack.coverInfo
         } else {
             self.coverInfo = nil
@@ -394,7 +395,8 @@ public class TransientStickerPackDataSource: BaseStickerPackDataSource {
     // Returns true if sticker is already downloaded.
     // If not, kicks off the download.
     private func ensureStickerDownload(stickerPack: StickerPack,
-                                       stickerInfo: StickerInfo) -> Bool {
+                                       stickerInfo: StickerInfo,
+                                       priority: Operation.QueuePriority = .normal) -> Bool {
         AssertIsOnMainThread()
 
         guard let stickerPackItem = stickerPack.stickerPackItem(forStickerInfo: stickerInfo) else {
@@ -416,7 +418,7 @@ public class TransientStickerPackDataSource: BaseStickerPackDataSource {
 
         // This sticker is not downloaded; try to download now.
         firstly(on: .global()) {
-            StickerManager.tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo)
+            StickerManager.tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo, priority: priority)
         }.map(on: .global()) { (stickerData: Data) -> URL in
             let temporaryFileUrl = OWSFileSystem.temporaryFileUrl(fileExtension: stickerPackItem.stickerType.fileExtension)
             try stickerData.write(to: temporaryFileUrl)
@@ -12,14 +12,20 @@ public class StickerView: NSObject {
     // Never instantiate this class.
     private override init() {}
 
+    // If size is nil, the caller is responsible for the view's layout;
+    // displaySize should then be the size the view will have, if known.
     static func stickerView(forStickerInfo stickerInfo: StickerInfo,
                             dataSource: StickerPackDataSource,
-                            size: CGFloat? = nil) -> UIView? {
+                            size: CGFloat? = nil,
+                            displaySize: CGFloat? = nil) -> UIView? {
         guard let stickerMetadata = dataSource.metadata(forSticker: stickerInfo) else {
             Logger.warn("Missing sticker metadata.")
             return nil
         }
-        return stickerView(stickerInfo: stickerInfo, stickerMetadata: stickerMetadata, size: size)
+        return stickerView(stickerInfo: stickerInfo,
+                           stickerMetadata: stickerMetadata,
+                           size: size,
+                           displaySize: displaySize ?? size)
     }
 
     static func stickerView(forInstalledStickerInfo stickerInfo: StickerInfo,
@@ -29,18 +35,20 @@ public class StickerView: NSObject {
             Logger.warn("Missing sticker metadata.")
             return nil
         }
-        return stickerView(stickerInfo: stickerInfo, stickerMetadata: stickerMetadata, size: size)
+        return stickerView(stickerInfo: stickerInfo, stickerMetadata: stickerMetadata, size: size, displaySize: size)
     }
 
     private static func stickerView(stickerInfo: StickerInfo,
                                     stickerMetadata: StickerMetadata,
-                                    size: CGFloat? = nil) -> UIView? {
+                                    size: CGFloat?,
+                                    displaySize: CGFloat?) -> UIView? {
 
         let stickerDataUrl = stickerMetadata.stickerDataUrl
 
         guard let stickerView = self.stickerView(stickerInfo: stickerInfo,
                                                  stickerType: stickerMetadata.stickerType,
-                                                 stickerDataUrl: stickerDataUrl) else {
+                                                 stickerDataUrl: stickerDataUrl,
+                                                 displaySize: displaySize) else {
                                             owsFailDebug("Could not load sticker for display.")
                                             return nil
         }
@@ -50,9 +58,11 @@ public class StickerView: NSObject {
         return stickerView
     }
 
+    // If displaySize is nil, animated stickers are decoded at their original size.
     static func stickerView(stickerInfo: StickerInfo,
                             stickerType: StickerType,
-                            stickerDataUrl: URL) -> UIView? {
+                            stickerDataUrl: URL,
+                            displaySize: CGFloat? = nil) -> UIView? {
 
         guard NSData.ows_isValidImage(at: stickerDataUrl, mimeType: stickerType.contentType) else {
             owsFailDebug("Invalid sticker.")
@@ -62,7 +72,11 @@ public class StickerView: NSObject {
         let stickerView: UIView
         switch stickerType {
         case .webp, .apng, .gif:
-            guard let stickerImage = YYImage(contentsOfFile: stickerDataUrl.path) else {
+            // Share decoded frames with other views showing the same sticker.
+            let pixelSize = displaySize.map { CGSize(square: $0 * UIScreen.main.scale) } ?? .zero
+            guard let stickerImage = StickerFrameCache.shared.animatedImage(stickerInfo: stickerInfo,
+                                                                            stickerDataUrl: stickerDataUrl,
+                                                                            pixelSize: pixelSize) else {
                 owsFailDebug("Sticker could not be parsed.")
                 return nil
             }
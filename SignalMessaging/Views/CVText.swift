@@ -51,9 +51,36 @@ public enum CVTextValue: Equatable, Hashable {
         case .text(let text):
             return "t\(text)"
         case .attributedText(let attributedText):
-            return "a\(attributedText.description)"
+            return "a\(Self.layoutCacheKey(attributedText: attributedText))"
         }
     }
+
+    // These attributes don't affect layout, so changing them (e.g. when
+    // the theme changes) shouldn't invalidate cached measurements.
+    private static let nonLayoutAttributes: Set<NSAttributedString.Key> = [
+        .foregroundColor,
+        .backgroundColor,
+        .underlineColor,
+        .strikethroughColor,
+        .strokeColor
+    ]
+
+    private static func layoutCacheKey(attributedText: NSAttributedString) -> CacheKey {
+        var result = attributedText.string
+        attributedText.enumerateAttributes(in: attributedText.entireRange,
+                                           options: []) { (attributes, range, _) in
+            result.append("{\(range.location),\(range.length)")
+            for key in attributes.keys.sorted(by: { $0.rawValue < $1.rawValue }) {
+                guard !nonLayoutAttributes.contains(key),
+                      let value = attributes[key] else {
+                    continue
+                }
+                result.append(",\(key.rawValue)=\(value)")
+            }
+            result.append("}")
+        }
+        return result
+    }
 }
 
 // MARK: - UILabel
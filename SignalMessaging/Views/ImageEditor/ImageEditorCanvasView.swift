@@ -2,6 +2,7 @@
 //  Copyright (c) 2020 Open Whisper Systems. All rights reserved.
 //
 
+import Metal
 import UIKit
 
 public class EditorTextLayer: CATextLayer {
@@ -73,6 +74,14 @@ public class ImageEditorCanvasView: UIView {
 
     private var imageLayer = CALayer()
 
+    // Brush strokes are hosted in a container which Core Animation rasterizes
+    // and caches, so that it doesn't redraw every stroke on every frame.
+    //
+    // The stroke being drawn lives in activeStrokesLayer until another item
+    // changes, so that each new sample only redraws that one stroke.
+    private let strokesLayer = CALayer()
+    private let activeStrokesLayer = CALayer()
+
     @objc
     public func configureSubviews() {
         self.backgroundColor = .clear
@@ -99,6 +108,14 @@ public class ImageEditorCanvasView: UIView {
         contentView.backgroundColor = .clear
         contentView.isOpaque = false
         contentView.layer.addSublayer(imageLayer)
+
+        strokesLayer.zPosition = ImageEditorCanvasView.brushLayerZ
+        strokesLayer.shouldRasterize = true
+        contentView.layer.addSublayer(strokesLayer)
+        // The active stroke is always the top-most stroke.
+        activeStrokesLayer.zPosition = ImageEditorCanvasView.brushLayerZ + 0.5
+        contentView.layer.addSublayer(activeStrokesLayer)
+
         contentView.layoutCallback = { [weak self] (_) in
             guard let strongSelf = self else {
                 return
@@ -148,8 +165,50 @@ public class ImageEditorCanvasView: UIView {
         return ImageEditorCanvasView.loadSrcImage(model: model)
     }
 
+    // Decoding a large photo is expensive, and the canvas, the blur and
+    // the output rendering all need the source image, so we cache it.
+    private static let srcImageCache: NSCache<NSString, UIImage> = {
+        let cache = NSCache<NSString, UIImage>()
+        cache.countLimit = 2
+        return cache
+    }()
+
     @objc
     public class func loadSrcImage(model: ImageEditorModel) -> UIImage? {
+        let cacheKey = model.srcImagePath as NSString
+        if let srcImage = srcImageCache.object(forKey: cacheKey) {
+            return srcImage
+        }
+        guard let srcImage = (decodeSrcImage(model: model) ?? loadSrcImageData(model: model)) else {
+            return nil
+        }
+        srcImageCache.setObject(srcImage, forKey: cacheKey)
+        return srcImage
+    }
+
+    private class func decodeSrcImage(model: ImageEditorModel) -> UIImage? {
+        let sourceOptions = [kCGImageSourceShouldCache: false] as CFDictionary
+        guard let imageSource = CGImageSourceCreateWithURL(URL(fileURLWithPath: model.srcImagePath) as CFURL,
+                                                           sourceOptions) else {
+            return nil
+        }
+        // Let ImageIO apply the orientation as it decodes the image, rather
+        // than decoding it and then redrawing it to normalize the orientation.
+        let maxPixelSize = max(model.srcImageSizePixels.width, model.srcImageSizePixels.height)
+        let options = [
+            kCGImageSourceCreateThumbnailFromImageAlways: true,
+            kCGImageSourceCreateThumbnailWithTransform: true,
+            kCGImageSourceShouldCacheImmediately: true,
+            kCGImageSourceThumbnailMaxPixelSize: maxPixelSize
+        ] as CFDictionary
+        guard let cgImage = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, options) else {
+            return nil
+        }
+        return UIImage(cgImage: cgImage, scale: 1.0, orientation: .up)
+    }
+
+    // Fallback for images ImageIO can't decode.
+    private class func loadSrcImageData(model: ImageEditorModel) -> UIImage? {
         let srcImageData: Data
         do {
             let srcImagePath = model.srcImagePath
@@ -198,6 +257,8 @@ public class ImageEditorCanvasView: UIView {
 
             updateImageLayer()
 
+            updateStrokesLayers()
+
             for item in model.items() {
                 guard !itemIdsToIgnore.contains(item.itemId) else {
                     // Ignore this item.
@@ -211,8 +272,7 @@ public class ImageEditorCanvasView: UIView {
                                                                         continue
                 }
 
-                contentView.layer.addSublayer(layer)
-                contentLayerMap[item.itemId] = layer
+                addContentLayer(layer, forItem: item, isActive: false)
             }
         }
 
@@ -249,6 +309,20 @@ public class ImageEditorCanvasView: UIView {
 
             updateImageLayer()
 
+            updateStrokesLayers()
+
+            // Strokes which are no longer being drawn move into the rasterized layer.
+            for layer in contentLayerMap.values where layer.superlayer == activeStrokesLayer {
+                strokesLayer.addSublayer(layer)
+            }
+
+            let topStrokeItemId = model.items().last(where: { item in
+                guard let strokeItem = item as? ImageEditorStrokeItem else {
+                    return false
+                }
+                return !strokeItem.isBlur
+            })?.itemId
+
             // Create layers for inserted and updated items.
             for itemId in changedItemIds {
                 guard let item = model.item(forId: itemId) else {
@@ -264,14 +338,36 @@ public class ImageEditorCanvasView: UIView {
                                                                         continue
                 }
 
-                contentView.layer.addSublayer(layer)
-                contentLayerMap[item.itemId] = layer
+                addContentLayer(layer, forItem: item, isActive: itemId == topStrokeItemId)
             }
         }
 
         CATransaction.commit()
     }
 
+    private func addContentLayer(_ layer: CALayer, forItem item: ImageEditorItem, isActive: Bool) {
+        if let strokeItem = item as? ImageEditorStrokeItem, !strokeItem.isBlur {
+            (isActive ? activeStrokesLayer : strokesLayer).addSublayer(layer)
+        } else {
+            contentView.layer.addSublayer(layer)
+        }
+        contentLayerMap[item.itemId] = layer
+    }
+
+    private func updateStrokesLayers() {
+        let viewSize = clipView.bounds.size
+        let frame = CGRect(origin: .zero, size: viewSize)
+        strokesLayer.frame = frame
+        activeStrokesLayer.frame = frame
+
+        // Rasterize at the zoomed-in resolution so that strokes stay sharp,
+        // within the limits of what the GPU can cache.
+        let maxRasterizationDimension: CGFloat = 4096
+        let rasterizationScale = UIScreen.main.scale * model.currentTransform().scaling
+        strokesLayer.rasterizationScale = min(rasterizationScale,
+                                              maxRasterizationDimension / max(1, viewSize.largerAxis))
+    }
+
     private func applyTransform() {
         let viewSize = clipView.bounds.size
         contentView.layer.setAffineTransform(model.currentTransform().affineTransform(viewSize: viewSize))
@@ -825,10 +921,96 @@ public class ImageEditorCanvasView: UIView {
 
         CATransaction.commit()
 
+        if let image = renderWithMetal(layer: view.layer, sizePixels: dstSizePixels, hasAlpha: hasAlpha) {
+            return image
+        }
         let image = view.renderAsImage(opaque: !hasAlpha, scale: dstScale)
         return image
     }
 
+    // Core Animation can composite the layer tree on the GPU into a Metal
+    // texture, which is much faster than CALayer.render(in:) for a large
+    // image with many strokes.
+    //
+    // Returns nil if the GPU can't be used; callers should fall back to
+    // rendering on the CPU.
+    private class func renderWithMetal(layer: CALayer, sizePixels: CGSize, hasAlpha: Bool) -> UIImage? {
+        guard #available(iOS 12, *) else {
+            return nil
+        }
+        let width = Int(sizePixels.width.rounded())
+        let height = Int(sizePixels.height.rounded())
+        // Every GPU we support can use textures up to 8192 pixels on a side.
+        let maxTextureDimension = 8192
+        guard width > 0, height > 0, width <= maxTextureDimension, height <= maxTextureDimension else {
+            return nil
+        }
+        guard let device = MTLCreateSystemDefaultDevice(),
+              let commandQueue = device.makeCommandQueue() else {
+            return nil
+        }
+
+        let textureDescriptor = MTLTextureDescriptor.texture2DDescriptor(pixelFormat: .bgra8Unorm,
+                                                                         width: width,
+                                                                         height: height,
+                                                                         mipmapped: false)
+        textureDescriptor.usage = [.renderTarget, .shaderRead]
+        textureDescriptor.storageMode = .shared
+        guard let texture = device.makeTexture(descriptor: textureDescriptor) else {
+            owsFailDebug("Could not create texture.")
+            return nil
+        }
+
+        let colorSpace = CGColorSpaceCreateDeviceRGB()
+        let renderer = CARenderer(mtlTexture: texture, options: [
+            kCARendererColorSpace: colorSpace,
+            kCARendererMetalCommandQueue: commandQueue
+        ])
+        renderer.layer = layer
+        renderer.bounds = CGRect(x: 0, y: 0, width: width, height: height)
+        renderer.beginFrame(atTime: CACurrentMediaTime(), timeStamp: nil)
+        renderer.addUpdate(renderer.bounds)
+        renderer.render()
+        renderer.endFrame()
+
+        // Command buffers complete in the order they are committed,
+        // so once this one completes, so has the rendering.
+        guard let commandBuffer = commandQueue.makeCommandBuffer() else {
+            owsFailDebug("Could not create command buffer.")
+            return nil
+        }
+        commandBuffer.commit()
+        commandBuffer.waitUntilCompleted()
+
+        let bytesPerRow = width * 4
+        var pixelData = Data(count: bytesPerRow * height)
+        pixelData.withUnsafeMutableBytes { (pixels: UnsafeMutableRawBufferPointer) in
+            texture.getBytes(pixels.baseAddress!,
+                             bytesPerRow: bytesPerRow,
+                             from: MTLRegionMake2D(0, 0, width, height),
+                             mipmapLevel: 0)
+        }
+
+        let alphaInfo: CGImageAlphaInfo = hasAlpha ? .premultipliedFirst : .noneSkipFirst
+        let bitmapInfo = CGBitmapInfo(rawValue: CGBitmapInfo.byteOrder32Little.rawValue | alphaInfo.rawValue)
+        guard let dataProvider = CGDataProvider(data: pixelData as CFData),
+              let cgImage = CGImage(width: width,
+                                    height: height,
+                                    bitsPerComponent: 8,
+                                    bitsPerPixel: 32,
+                                    bytesPerRow: bytesPerRow,
+                                    space: colorSpace,
+                                    bitmapInfo: bitmapInfo,
+                                    provider: dataProvider,
+                                    decode: nil,
+                                    shouldInterpolate: false,
+                                    intent: .defaultIntent) else {
+            owsFailDebug("Could not create image.")
+            return nil
+        }
+        return UIImage(cgImage: cgImage, scale: 1.0, orientation: .up)
+    }
+
     // MARK: -
 
     public func textLayer(forLocation point: CGPoint) -> EditorTextLayer? {
@@ -120,67 +120,23 @@ public class VideoEditorView: UIView {
         timelineView.updateContents()
 
         ensureSeekReflectsTrimming()
-
-        generateThumbnailsAsync()
     }
 
     // MARK: -
 
-    internal var videoThumbnails: [UIImage]?
-
-    private func generateThumbnailsAsync() {
-        let model = self.model
-        let displaySize = self.displaySize
-        let timelineHeight = self.timelineHeight
-        let untrimmedDurationSeconds = self.untrimmedDurationSeconds
-
-        firstly {
-            VideoEditorView.thumbnails(forVideoAtPath: model.srcVideoPath,
-                                       displaySize: displaySize,
-                                       timelineHeight: timelineHeight,
-                                       untrimmedDurationSeconds: untrimmedDurationSeconds)
-        }.done { [weak self] (thumbnails: [UIImage]) -> Void in
-            guard let self = self else {
-                return
-            }
-            self.videoThumbnails = thumbnails
-            self.timelineView.updateThumbnailView()
-        }.catch { error in
-            owsFailDebug("Error: \(error)")
+    private lazy var thumbnailStrip: VideoThumbnailStrip = {
+        let asset = AVURLAsset(url: URL(fileURLWithPath: model.srcVideoPath), options: nil)
+        // We generate square thumbnails at the timeline's pixel size.
+        let thumbnailStrip = VideoThumbnailStrip(asset: asset,
+                                                 maximumSize: CGSize(square: timelineHeight * UIScreen.main.scale))
+        thumbnailStrip.thumbnailsDidLoad = { [weak self] in
+            self?.timelineView.updateThumbnailView()
         }
-    }
-
-    private class func thumbnails(forVideoAtPath videoPath: String,
-                                  displaySize: CGSize,
-                                  timelineHeight: CGFloat,
-                                  untrimmedDurationSeconds: TimeInterval) -> Promise<[UIImage]> {
-        AssertIsOnMainThread()
+        return thumbnailStrip
+    }()
 
-        let contextSize = CurrentAppContext().frame.size
-
-        return DispatchQueue.global().async(.promise) {
-            // We generate enough thumbnails for the worst case (full-screen landscape)
-            // to avoid the complexity of regeneration.
-            let contextMaxDimension = max(contextSize.width, contextSize.height)
-            let thumbnailCount = UInt(ceil(contextMaxDimension / timelineHeight))
-
-            let url = URL(fileURLWithPath: videoPath)
-            let asset = AVURLAsset(url: url, options: nil)
-            let generator = AVAssetImageGenerator(asset: asset)
-            // We generate square thumbnails.
-            generator.maximumSize = CGSize(square: timelineHeight)
-            generator.appliesPreferredTrackTransform = true
-            var thumbnails = [UIImage]()
-            for index in 0..<thumbnailCount {
-                let thumbnailAlpha = Double(index) / Double(thumbnailCount - 1)
-                let thumbnailTimeSeconds = thumbnailAlpha * untrimmedDurationSeconds
-                let thumbnailCMTime = CMTime(seconds: thumbnailTimeSeconds, preferredTimescale: 1000)
-                let cgImage = try generator.copyCGImage(at: thumbnailCMTime, actualTime: nil)
-                let thumbnail = UIImage(cgImage: cgImage, scale: 1, orientation: .up)
-                thumbnails.append(thumbnail)
-            }
-            return thumbnails
-        }
+    internal func videoThumbnails(forTimes times: [TimeInterval], toleranceSeconds: TimeInterval) -> [UIImage?] {
+        thumbnailStrip.thumbnails(forTimes: times, toleranceSeconds: toleranceSeconds)
     }
 
     private func addSubviewWithScaleAspectFitLayout(view: UIView, aspectRatio: CGFloat) {
@@ -460,7 +416,9 @@ protocol TrimVideoTimelineViewDelegate: class {
     var canBeTrimmed: Bool { get }
     var isTrimmed: Bool { get }
 
-    var videoThumbnails: [UIImage]? { get }
+    // Returns the thumbnails which have already been generated, and starts
+    // generating the rest.
+    func videoThumbnails(forTimes times: [TimeInterval], toleranceSeconds: TimeInterval) -> [UIImage?]
 
     func setTrimStart(_ seconds: TimeInterval)
     func setTrimEnd(_ seconds: TimeInterval)
@@ -470,6 +428,108 @@ protocol TrimVideoTimelineViewDelegate: class {
 
 // MARK: -
 
+// Generates the timeline's thumbnails on demand.
+//
+// Only the thumbnails for the timeline's current slots are decoded; when the
+// slots change (e.g. on rotation) work for the old slots is cancelled and
+// their thumbnails are discarded.
+class VideoThumbnailStrip {
+
+    private let generator: AVAssetImageGenerator
+
+    // Keyed by time in milliseconds.
+    //
+    // These properties should only be accessed on the main thread.
+    private var thumbnails = [Int64: UIImage]()
+    private var pendingTimes = Set<Int64>()
+    private var requestId: UInt = 0
+
+    var thumbnailsDidLoad: (() -> Void)?
+
+    init(asset: AVAsset, maximumSize: CGSize) {
+        generator = AVAssetImageGenerator(asset: asset)
+        generator.maximumSize = maximumSize
+        generator.appliesPreferredTrackTransform = true
+    }
+
+    deinit {
+        generator.cancelAllCGImageGeneration()
+    }
+
+    private static let timescale: CMTimeScale = 1000
+
+    private static func key(forTime seconds: TimeInterval) -> Int64 {
+        Int64(round(seconds * Double(timescale)))
+    }
+
+    func thumbnails(forTimes times: [TimeInterval], toleranceSeconds: TimeInterval) -> [UIImage?] {
+        AssertIsOnMainThread()
+
+        let keys = times.map { Self.key(forTime: $0) }
+        let keySet = Set(keys)
+
+        // Discard thumbnails for slots which are no longer shown.
+        thumbnails = thumbnails.filter { keySet.contains($0.key) }
+
+        let missingKeys = keySet.subtracting(thumbnails.keys)
+        if missingKeys != pendingTimes {
+            generate(keys: keys.filter { missingKeys.contains($0) }, toleranceSeconds: toleranceSeconds)
+        }
+
+        return keys.map { thumbnails[$0] }
+    }
+
+    private func generate(keys: [Int64], toleranceSeconds: TimeInterval) {
+        AssertIsOnMainThread()
+
+        // Cancel any work for slots which are no longer shown.
+        generator.cancelAllCGImageGeneration()
+        requestId += 1
+        pendingTimes = Set(keys)
+
+        guard !keys.isEmpty else {
+            return
+        }
+
+        // Each thumbnail only needs to be accurate to within its slot;
+        // a tolerance lets the generator avoid decoding from the previous
+        // sync frame for every slot.
+        let tolerance = CMTime(seconds: max(0, toleranceSeconds), preferredTimescale: Self.timescale)
+        generator.requestedTimeToleranceBefore = tolerance
+        generator.requestedTimeToleranceAfter = tolerance
+
+        let requestId = self.requestId
+        let times = keys.map { NSValue(time: CMTime(value: $0, timescale: Self.timescale)) }
+        generator.generateCGImagesAsynchronously(forTimes: times) { [weak self] requestedTime, cgImage, _, result, error in
+            switch result {
+            case .succeeded:
+                guard let cgImage = cgImage else {
+                    owsFailDebug("Missing image.")
+                    return
+                }
+                let thumbnail = UIImage(cgImage: cgImage, scale: 1, orientation: .up)
+                let key = requestedTime.convertScale(Self.timescale, method: .roundHalfAwayFromZero).value
+                DispatchQueue.main.async {
+                    guard let self = self, self.requestId == requestId else {
+                        return
+                    }
+                    self.pendingTimes.remove(key)
+                    self.thumbnails[key] = thumbnail
+                    self.thumbnailsDidLoad?()
+                }
+            case .failed:
+                Logger.warn("Could not generate thumbnail: \(String(describing: error))")
+            case .cancelled:
+                break
+            @unknown default:
+                owsFailDebug("Unknown result: \(result)")
+            }
+        }
+    }
+}
+
+// MARK: -
+
 class TrimVideoTimelineView: UIView {
     fileprivate weak var delegate: TrimVideoTimelineViewDelegate?
 
@@ -586,40 +646,52 @@ class TrimVideoTimelineView: UIView {
         addGestureRecognizer(PermissiveGestureRecognizer(target: self, action: #selector(gestureDidChange)))
     }
 
+    private var thumbnailLayers = [CALayer]()
+
     fileprivate func updateThumbnailView() {
-        if let sublayers = thumbnailLayerView.layer.sublayers {
-            for sublayer in sublayers {
-                sublayer.removeFromSuperlayer()
-            }
-        }
         guard let delegate = delegate else {
             return
         }
-        guard let videoThumbnails = delegate.videoThumbnails else {
-            return
-        }
 
         let thumbnailSize: CGFloat = height
         guard thumbnailSize > 0 else {
             return
         }
 
-        let thumbnailCount = UInt(ceil(width / thumbnailSize))
+        let thumbnailCount = Int(ceil(width / thumbnailSize))
+        guard thumbnailCount > 0 else {
+            return
+        }
+
+        // The timeline shows a series of thumbnails reflecting the video
+        // content at the point.   It's ambiguous whether each thumbnail
+        // should reflect the content at the thumbnail's left edge or
+        // center. I've chosen to use the center.
+        let slotDurationSeconds = delegate.untrimmedDurationSeconds / Double(thumbnailCount)
+        let thumbnailTimes = (0..<thumbnailCount).map { index in
+            (Double(index) + 0.5) * slotDurationSeconds
+        }
+        let thumbnails = delegate.videoThumbnails(forTimes: thumbnailTimes,
+                                                  toleranceSeconds: slotDurationSeconds * 0.5)
 
-        for index in 0..<thumbnailCount {
-            // The timeline shows a series of thumbnails reflecting the video
-            // content at the point.   It's ambiguous whether each thumbnail
-            // should reflect the content at the thumbnail's left edge or
-            // center. I've chosen to use the center.
-            let thumbnailAlpha = (Double(index) + 0.5) / Double(thumbnailCount - 1)
-            let thumbnailIndex = Int(round(thumbnailAlpha * Double(videoThumbnails.count))).clamp(0, videoThumbnails.count - 1)
-            let thumbnail: UIImage = videoThumbnails[thumbnailIndex]
+        // Reuse the existing thumbnail layers where possible.
+        while thumbnailLayers.count > thumbnailCount {
+            thumbnailLayers.removeLast().removeFromSuperlayer()
+        }
+        while thumbnailLayers.count < thumbnailCount {
             let imageLayer = CALayer()
-            imageLayer.contents = thumbnail.cgImage
+            thumbnailLayerView.layer.addSublayer(imageLayer)
+            thumbnailLayers.append(imageLayer)
+        }
+
+        CATransaction.begin()
+        CATransaction.setDisableActions(true)
+        for (index, imageLayer) in thumbnailLayers.enumerated() {
+            imageLayer.contents = thumbnails[index]?.cgImage
             let x: CGFloat = CGFloat(index) * thumbnailSize
             imageLayer.frame = CGRect(x: x, y: 0, width: thumbnailSize, height: thumbnailSize)
-            thumbnailLayerView.layer.addSublayer(imageLayer)
         }
+        CATransaction.commit()
     }
 
     private let extraHotArea: CGFloat = 10
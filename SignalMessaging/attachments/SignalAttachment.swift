@@ -1082,7 +1082,7 @@ public class SignalAttachment: NSObject {
         return videoDir
     }
 
-    public class func compressVideoAsMp4(dataSource: DataSource, dataUTI: String) -> (Promise<SignalAttachment>, AVAssetExportSession?) {
+    public class func compressVideoAsMp4(dataSource: DataSource, dataUTI: String) -> (Promise<SignalAttachment>, VideoTranscoder?) {
         Logger.debug("")
 
         guard let url = dataSource.dataUrl else {
@@ -1094,45 +1094,37 @@ public class SignalAttachment: NSObject {
         return compressVideoAsMp4(asset: AVAsset(url: url), baseFilename: dataSource.sourceFilename, dataUTI: dataUTI)
     }
 
-    public class func compressVideoAsMp4(asset: AVAsset, baseFilename: String?, dataUTI: String) -> (Promise<SignalAttachment>, AVAssetExportSession?) {
+    public class func compressVideoAsMp4(asset: AVAsset, baseFilename: String?, dataUTI: String) -> (Promise<SignalAttachment>, VideoTranscoder?) {
         Logger.debug("")
-        guard let exportSession = AVAssetExportSession(asset: asset, presetName: AVAssetExportPreset640x480) else {
-            let attachment = SignalAttachment(dataSource: DataSourceValue.emptyDataSource(), dataUTI: dataUTI)
-            attachment.error = .couldNotConvertToMpeg4
-            return (Promise.value(attachment), nil)
-        }
-
-        exportSession.shouldOptimizeForNetworkUse = true
-        exportSession.outputFileType = AVFileType.mp4
-        exportSession.metadataItemFilter = AVMetadataItemFilter.forSharing()
 
         let exportURL = videoTempPath.appendingPathComponent(UUID().uuidString).appendingPathExtension("mp4")
-        exportSession.outputURL = exportURL
 
-        let (promise, resolver) = Promise<SignalAttachment>.pending()
+        var configuration = VideoTranscoder.Configuration()
+        configuration.targetFileSize = UInt64(kMaxFileSizeVideo)
+        let transcoder = VideoTranscoder(asset: asset, outputUrl: exportURL, configuration: configuration)
 
         Logger.debug("starting video export")
-        exportSession.exportAsynchronously {
+        let promise: Promise<SignalAttachment> = transcoder.transcode().map(on: .global()) {
             Logger.debug("Completed video export")
             let mp4Filename = baseFilename?.filenameWithoutExtension.appendingFileExtension("mp4")
 
-            do {
-                let dataSource = try DataSourcePath.dataSource(with: exportURL,
-                                                               shouldDeleteOnDeallocation: true)
-                dataSource.sourceFilename = mp4Filename
-
-                let attachment = SignalAttachment(dataSource: dataSource, dataUTI: kUTTypeMPEG4 as String)
-                resolver.fulfill(attachment)
-            } catch {
-                owsFailDebug("Failed to build data source for exported video URL")
-                let attachment = SignalAttachment(dataSource: DataSourceValue.emptyDataSource(), dataUTI: dataUTI)
-                attachment.error = .couldNotConvertToMpeg4
-                resolver.fulfill(attachment)
-                return
+            let dataSource = try DataSourceMappedPath.dataSource(with: exportURL,
+                                                                 shouldDeleteOnDeallocation: true)
+            dataSource.sourceFilename = mp4Filename
+
+            return SignalAttachment(dataSource: dataSource, dataUTI: kUTTypeMPEG4 as String)
+        }.recover(on: .global()) { error -> Promise<SignalAttachment> in
+            if case VideoTranscoderError.cancelled = error {
+                Logger.info("Video export was cancelled.")
+            } else {
+                owsFailDebug("Video export failed: \(error)")
             }
+            let attachment = SignalAttachment(dataSource: DataSourceValue.emptyDataSource(), dataUTI: dataUTI)
+            attachment.error = .couldNotConvertToMpeg4
+            return Promise.value(attachment)
         }
 
-        return (promise, exportSession)
+        return (promise, transcoder)
     }
 
     @objc
@@ -1141,19 +1133,19 @@ public class SignalAttachment: NSObject {
         public let attachmentPromise: AnyPromise
 
         @objc
-        public let exportSession: AVAssetExportSession?
+        public let transcoder: VideoTranscoder?
 
-        fileprivate init(attachmentPromise: Promise<SignalAttachment>, exportSession: AVAssetExportSession?) {
+        fileprivate init(attachmentPromise: Promise<SignalAttachment>, transcoder: VideoTranscoder?) {
             self.attachmentPromise = AnyPromise(attachmentPromise)
-            self.exportSession = exportSession
+            self.transcoder = transcoder
             super.init()
         }
     }
 
     @objc
     public class func compressVideoAsMp4(dataSource: DataSource, dataUTI: String) -> VideoCompressionResult {
-        let (attachmentPromise, exportSession) = compressVideoAsMp4(dataSource: dataSource, dataUTI: dataUTI)
-        return VideoCompressionResult(attachmentPromise: attachmentPromise, exportSession: exportSession)
+        let (attachmentPromise, transcoder) = compressVideoAsMp4(dataSource: dataSource, dataUTI: dataUTI)
+        return VideoCompressionResult(attachmentPromise: attachmentPromise, transcoder: transcoder)
     }
 
     @objc
@@ -1273,6 +1265,65 @@ public class SignalAttachment: NSObject {
                                            imageQuality: .original)
     }
 
+    // MARK: Preparation
+
+    // Converting and resizing a full-resolution image needs the source data,
+    // the decoded bitmap and the re-encoded output in memory at once.
+    private static let estimatedPreparationBytes: UInt64 = 160 * 1024 * 1024
+
+    // Attachment preparation (e.g. HEIC to JPEG conversion) is bounded by the
+    // device's cores and memory, so that selecting many items at once doesn't
+    // decode all of them at the same time.
+    public static let preparationQueue = BoundedWorkQueue(label: "org.signal.attachmentPreparation",
+                                                          maxConcurrentCount: BoundedWorkQueue.maxConcurrentCount(bytesPerItem: estimatedPreparationBytes))
+
+    private static let preparedAttachmentsLock = UnfairLock()
+    private static let preparedAttachments: NSCache<NSString, Promise<SignalAttachment>> = {
+        let cache = NSCache<NSString, Promise<SignalAttachment>>()
+        cache.countLimit = maxAttachmentsAllowed
+        return cache
+    }()
+
+    // Prepares an attachment on the preparation queue.
+    //
+    // Preparing the same cacheKey again (e.g. if the user deselects and
+    // reselects an item) reuses the earlier work. Each caller receives its
+    // own attachment, so per-message state like captions isn't shared.
+    public class func preparedAttachment(cacheKey: String,
+                                         prepare: @escaping () throws -> Promise<SignalAttachment>) -> Promise<SignalAttachment> {
+        let promise: Promise<SignalAttachment> = preparedAttachmentsLock.withLock {
+            if let promise = preparedAttachments.object(forKey: cacheKey as NSString) {
+                return promise
+            }
+            let promise = preparationQueue.enqueue(prepare)
+            preparedAttachments.setObject(promise, forKey: cacheKey as NSString)
+            return promise
+        }
+        return promise.map(on: .global()) { (attachment: SignalAttachment) -> SignalAttachment in
+            guard !attachment.hasError else {
+                // Don't reuse invalid attachments.
+                preparedAttachments.removeObject(forKey: cacheKey as NSString)
+                return attachment
+            }
+            return attachment.replicate()
+        }.recover(on: .global()) { (error: Error) -> Promise<SignalAttachment> in
+            preparedAttachments.removeObject(forKey: cacheKey as NSString)
+            throw error
+        }
+    }
+
+    // Returns a new attachment with the same content.
+    private func replicate() -> SignalAttachment {
+        let attachment = SignalAttachment(dataSource: dataSource, dataUTI: dataUTI)
+        attachment.isConvertibleToTextMessage = isConvertibleToTextMessage
+        attachment.isConvertibleToContactShare = isConvertibleToContactShare
+        attachment.isVoiceMessage = isVoiceMessage
+        attachment.isBorderless = isBorderless
+        attachment.cachedImage = cachedImage
+        attachment.cachedVideoPreview = cachedVideoPreview
+        return attachment
+    }
+
     // MARK: Helper Methods
 
     private class func newAttachment(dataSource: DataSource?,
@@ -47,15 +47,9 @@ public class IncomingContactSyncJobQueue: NSObject, JobQueue {
         // no special handling
     }
 
-    let defaultQueue: OperationQueue = {
-        let operationQueue = OperationQueue()
-        operationQueue.name = "IncomingContactSyncJobQueue"
-        operationQueue.maxConcurrentOperationCount = 1
-        return operationQueue
-    }()
-
     public func operationQueue(jobRecord: OWSIncomingContactSyncJobRecord) -> OperationQueue {
-        return defaultQueue
+        // Syncs are applied in write transactions, so they share the serial database queue.
+        return JobQueueExecutor.shared.operationQueue(concurrencyClass: .database)
     }
 
     public func buildOperation(jobRecord: OWSIncomingContactSyncJobRecord, transaction: SDSAnyReadTransaction) throws -> IncomingContactSyncOperation {
@@ -160,6 +154,7 @@ public class IncomingContactSyncOperation: OWSOperation, DurableOperation {
         Logger.error("failed with error: \(error)")
 
         self.databaseStorage.write { transaction in
+            IncomingSyncBatchProcessor(jobRecord: self.jobRecord).discardResumeOffset(transaction: transaction)
             self.durableOperationDelegate?.durableOperation(self, didFailWithError: error, transaction: transaction)
         }
     }
@@ -230,21 +225,31 @@ public class IncomingContactSyncOperation: OWSOperation, DurableOperation {
         try Data(contentsOf: fileUrl, options: .mappedIfSafe).withUnsafeBytes { bufferPtr in
             if let baseAddress = bufferPtr.baseAddress, bufferPtr.count > 0 {
                 let pointer = baseAddress.assumingMemoryBound(to: UInt8.self)
-                let inputStream = ChunkedInputStream(forReadingFrom: pointer, count: bufferPtr.count)
+                var inputStream = ChunkedInputStream(forReadingFrom: pointer, count: bufferPtr.count)
+
+                // Resume after the contacts applied by an earlier attempt, if any.
+                let batchProcessor = IncomingSyncBatchProcessor(jobRecord: jobRecord, databaseStorage: databaseStorage)
+                let resumeOffset = batchProcessor.resumeOffset()
+                if resumeOffset > 0 {
+                    Logger.info("Resuming at offset: \(resumeOffset)")
+                    try inputStream.skip(toOffset: resumeOffset)
+                }
                 let contactStream = ContactsInputStream(inputStream: inputStream)
 
-                try databaseStorage.write { transaction in
-                    while let nextContact = try contactStream.decodeContact() {
-                        try autoreleasepool {
-                            try self.process(contactDetails: nextContact, transaction: transaction)
-                        }
+                try batchProcessor.processRecords(offset: {
+                    contactStream.offset
+                }, processNextRecord: { transaction in
+                    guard let nextContact = try contactStream.decodeContact() else {
+                        return false
                     }
-
+                    try self.process(contactDetails: nextContact, transaction: transaction)
+                    return true
+                }, didProcessAllRecords: { transaction in
                     // Always fire just one identity change notification, rather than potentially
                     // once per contact. It's possible that *no* identities actually changed,
                     // but we have no convenient way to track that.
                     self.identityManager.fireIdentityStateChangeNotification(after: transaction)
-                }
+                })
             }
         }
     }
@@ -34,6 +34,7 @@ extern NSString *const OWSContactsManagerSignalAccountsDidChangeNotification;
 @property (atomic, readonly) NSDictionary<NSString *, Contact *> *allContactsMap;
 
 // order of the signalAccounts array respects the systems contact sorting preference
+// (in processes with UI; see updateSignalAccounts:)
 @property (atomic, readonly) NSArray<SignalAccount *> *signalAccounts;
 
 // This will return an instance of SignalAccount for _known_ signal accounts.
@@ -99,6 +100,12 @@ extern NSString *const OWSContactsManagerSignalAccountsDidChangeNotification;
 - (nullable UIImage *)imageForAddress:(nullable SignalServiceAddress *)address
                           transaction:(SDSAnyReadTransaction *)transaction;
 - (nullable UIImage *)imageForAddressWithSneakyTransaction:(nullable SignalServiceAddress *)address;
+// Profile avatars are decoded at the given diameter, rather than at their full size.
+- (nullable UIImage *)imageForAddress:(nullable SignalServiceAddress *)address
+                             diameter:(CGFloat)diameter
+                          transaction:(SDSAnyReadTransaction *)transaction;
+- (nullable UIImage *)imageForAddressWithSneakyTransaction:(nullable SignalServiceAddress *)address
+                                                  diameter:(CGFloat)diameter;
 
 - (void)clearColorNameCache;
 
@@ -4,6 +4,7 @@
 
 #import "OWSContactsManager.h"
 #import "Environment.h"
+#import "OWSContactAvatarBuilder.h"
 #import "OWSFormat.h"
 #import "OWSProfileManager.h"
 #import "ViewControllerUtils.h"
@@ -14,7 +15,6 @@
 #import <SignalCoreKit/iOSVersions.h>
 #import <SignalMessaging/SignalMessaging-Swift.h>
 #import <SignalMessaging/UIFont+OWS.h>
-#import <SignalServiceKit/NSNotificationCenter+OWS.h>
 #import <SignalServiceKit/OWSError.h>
 #import <SignalServiceKit/PhoneNumber.h>
 #import <SignalServiceKit/SignalAccount.h>
@@ -40,9 +40,17 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
 @property (atomic) NSArray<SignalAccount *> *signalAccounts;
 
 @property (nonatomic, readonly) SystemContactsFetcher *systemContactsFetcher;
-@property (nonatomic, readonly) NSCache<NSString *, CNContact *> *cnContactCache;
-@property (nonatomic, readonly) NSCache<NSString *, UIImage *> *cnContactAvatarCache;
-@property (nonatomic, readonly) NSCache<SignalServiceAddress *, NSString *> *colorNameCache;
+// These caches are thread-safe.
+@property (nonatomic, readonly) AnyShardedLRUCache *cnContactCache;
+@property (nonatomic, readonly) AnyShardedLRUCache *cnContactAvatarCache;
+@property (nonatomic, readonly) AnyShardedLRUCache *colorNameCache;
+// Maps addresses to their comparable names, which are used as sort keys and for
+// collation. Building them merges system contacts, profile names and phone
+// numbers, so they're precomputed whenever the signal accounts are sorted and
+// evicted when any of their inputs change.
+@property (nonatomic, readonly) AnyShardedLRUCache *comparableNameCache;
+// The sort order with which the comparable names were built.
+@property (atomic) BOOL comparableNameCacheSortsByGivenName;
 @property (atomic) BOOL isSetup;
 
 @end
@@ -80,18 +88,19 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
     _keyValueStore = [[SDSKeyValueStore alloc] initWithCollection:OWSContactsManagerCollection];
 
     // TODO: We need to configure the limits of this cache.
-    _avatarCachePrivate = [ImageCache new];
-    _colorNameCache = [NSCache new];
+    _avatarCachePrivate = [[ImageCache alloc] initWithName:@"Contact avatars"];
+    _colorNameCache = [[AnyShardedLRUCache alloc] initWithMaxSize:1024];
+    // Large enough to hold every signal account in most address books.
+    _comparableNameCache = [[AnyShardedLRUCache alloc] initWithMaxSize:8192];
+    _comparableNameCacheSortsByGivenName = self.shouldSortByGivenName;
 
     _allContacts = @[];
     _allContactsMap = @{};
     _signalAccounts = @[];
     _systemContactsFetcher = [SystemContactsFetcher new];
     _systemContactsFetcher.delegate = self;
-    _cnContactCache = [NSCache new];
-    _cnContactCache.countLimit = 50;
-    _cnContactAvatarCache = [NSCache new];
-    _cnContactAvatarCache.countLimit = 25;
+    _cnContactCache = [[AnyShardedLRUCache alloc] initWithMaxSize:50];
+    _cnContactAvatarCache = [[AnyShardedLRUCache alloc] initWithMaxSize:25];
 
     OWSSingletonAssert();
 
@@ -191,14 +200,12 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         return nil;
     }
 
-    CNContact *_Nullable cnContact;
-    @synchronized(self.cnContactCache) {
-        cnContact = [self.cnContactCache objectForKey:contactId];
-        if (!cnContact) {
-            cnContact = [self.systemContactsFetcher fetchCNContactWithContactId:contactId];
-            if (cnContact) {
-                [self.cnContactCache setObject:cnContact forKey:contactId];
-            }
+    // Two threads may both miss and fetch the contact; that's harmless.
+    CNContact *_Nullable cnContact = (CNContact *)[self.cnContactCache getWithKey:contactId];
+    if (!cnContact) {
+        cnContact = [self.systemContactsFetcher fetchCNContactWithContactId:contactId];
+        if (cnContact) {
+            [self.cnContactCache setWithKey:contactId value:cnContact];
         }
     }
 
@@ -220,17 +227,14 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         return nil;
     }
 
-    UIImage *_Nullable avatarImage;
-    @synchronized(self.cnContactAvatarCache) {
-        avatarImage = [self.cnContactAvatarCache objectForKey:contactId];
-        if (!avatarImage) {
-            NSData *_Nullable avatarData = [self avatarDataForCNContactId:contactId];
-            if (avatarData && [avatarData ows_isValidImage]) {
-                avatarImage = [UIImage imageWithData:avatarData];
-            }
-            if (avatarImage) {
-                [self.cnContactAvatarCache setObject:avatarImage forKey:contactId];
-            }
+    UIImage *_Nullable avatarImage = (UIImage *)[self.cnContactAvatarCache getWithKey:contactId];
+    if (!avatarImage) {
+        NSData *_Nullable avatarData = [self avatarDataForCNContactId:contactId];
+        if (avatarData && [avatarData ows_isValidImage]) {
+            avatarImage = [UIImage imageWithData:avatarData];
+        }
+        if (avatarImage) {
+            [self.cnContactAvatarCache setWithKey:contactId value:avatarImage];
         }
     }
 
@@ -504,6 +508,14 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
                                              selector:@selector(otherUsersProfileWillChange:)
                                                  name:kNSNotificationNameOtherUsersProfileWillChange
                                                object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(otherUsersProfileDidChange:)
+                                                 name:kNSNotificationNameOtherUsersProfileDidChange
+                                               object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(localProfileDidChange:)
+                                                 name:kNSNotificationNameLocalProfileDidChange
+                                               object:nil];
 }
 
 - (void)otherUsersProfileWillChange:(NSNotification *)notification
@@ -514,10 +526,32 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         SignalServiceAddress *address = notification.userInfo[kNSNotificationKey_ProfileAddress];
         OWSAssertDebug(address.isValid);
 
-        [self removeAllFromAvatarCacheWithKey:address.stringForDisplay];
+        for (NSString *cacheKey in [OWSContactAvatarBuilder avatarCacheKeysForAddress:address]) {
+            [self removeAllFromAvatarCacheWithKey:cacheKey];
+        }
     }];
 }
 
+- (void)otherUsersProfileDidChange:(NSNotification *)notification
+{
+    OWSAssertIsOnMainThread();
+
+    SignalServiceAddress *address = notification.userInfo[kNSNotificationKey_ProfileAddress];
+    OWSAssertDebug(address.isValid);
+
+    [self.comparableNameCache removeWithKey:address];
+}
+
+- (void)localProfileDidChange:(NSNotification *)notification
+{
+    OWSAssertIsOnMainThread();
+
+    SignalServiceAddress *_Nullable localAddress = TSAccountManager.localAddress;
+    if (localAddress != nil) {
+        [self.comparableNameCache removeWithKey:localAddress];
+    }
+}
+
 - (void)updateWithContacts:(NSArray<Contact *> *)contacts
                    didLoad:(BOOL)didLoad
            isUserRequested:(BOOL)isUserRequested
@@ -550,8 +584,9 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         dispatch_async(dispatch_get_main_queue(), ^{
             self.allContacts = sortedContacts;
             self.allContactsMap = [allContactsMap copy];
-            [self.cnContactCache removeAllObjects];
-            [self.cnContactAvatarCache removeAllObjects];
+            [self.cnContactCache clear];
+            [self.comparableNameCache clear];
+            [self.cnContactAvatarCache clear];
 
             [self removeAllFromAvatarCache];
 
@@ -728,9 +763,11 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         self.isSetup = YES;
 
         if (hadLoadedContacts != self.hasLoadedContacts) {
-            [[NSNotificationCenter defaultCenter]
-                postNotificationNameAsync:OWSContactsManagerSignalAccountsDidChangeNotification
-                                   object:nil];
+            [GroupUpdateCopyCache.shared invalidate];
+            [CoalescingNotificationCenter.shared
+                postNotificationName:OWSContactsManagerSignalAccountsDidChangeNotification
+                              object:nil
+                            userInfo:nil];
         }
 
         return;
@@ -741,15 +778,27 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
         [allAddresses addObject:signalAccount.recipientAddress];
     }
 
-    self.signalAccounts = [self sortSignalAccountsWithSneakyTransaction:signalAccounts];
+    if (CurrentAppContext().hasUI) {
+        // The signal accounts may have new contacts, so rebuild their comparable names
+        // while sorting.
+        [self.comparableNameCache clear];
+        self.signalAccounts = [self sortSignalAccountsWithSneakyTransaction:signalAccounts];
+    } else {
+        // Without UI (i.e. in the NSE), nothing needs the sort order, and sorting
+        // loads the comparable name (and thus the profile) of every account.
+        self.signalAccounts = [signalAccounts copy];
+    }
 
     [self.profileManager setContactAddresses:allAddresses];
 
     self.isSetup = YES;
 
-    [[NSNotificationCenter defaultCenter]
-        postNotificationNameAsync:OWSContactsManagerSignalAccountsDidChangeNotification
-                           object:nil];
+    // The group update copy embeds display names.
+    [GroupUpdateCopyCache.shared invalidate];
+
+    [CoalescingNotificationCenter.shared postNotificationName:OWSContactsManagerSignalAccountsDidChangeNotification
+                                                       object:nil
+                                                     userInfo:nil];
 }
 
 - (nullable NSString *)cachedContactNameForAddress:(SignalServiceAddress *)address
@@ -944,20 +993,20 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
 
 - (void)clearColorNameCache
 {
-    [self.colorNameCache removeAllObjects];
+    [self.colorNameCache clear];
 }
 
 - (ConversationColorName)conversationColorNameForAddress:(SignalServiceAddress *)address
                                              transaction:(SDSAnyReadTransaction *)transaction
 {
-    _Nullable ConversationColorName cachedColorName = [self.colorNameCache objectForKey:address];
+    _Nullable ConversationColorName cachedColorName = (NSString *)[self.colorNameCache getWithKey:address];
     if (cachedColorName != nil) {
         return cachedColorName;
     }
 
     ConversationColorName colorName = [TSContactThread conversationColorNameForContactAddress:address
                                                                                   transaction:transaction];
-    [self.colorNameCache setObject:colorName forKey:address];
+    [self.colorNameCache setWithKey:address value:colorName];
 
     return colorName;
 }
@@ -1318,6 +1367,47 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
     return image;
 }
 
+- (nullable UIImage *)imageForAddressWithSneakyTransaction:(nullable SignalServiceAddress *)address
+                                                  diameter:(CGFloat)diameter
+{
+    if (address == nil) {
+        OWSFailDebug(@"address was unexpectedly nil");
+        return nil;
+    }
+
+    __block UIImage *_Nullable image;
+    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+        image = [self imageForAddress:address diameter:diameter transaction:transaction];
+    }];
+    return image;
+}
+
+- (nullable UIImage *)imageForAddress:(nullable SignalServiceAddress *)address
+                             diameter:(CGFloat)diameter
+                          transaction:(SDSAnyReadTransaction *)transaction
+{
+    if (address == nil) {
+        OWSFailDebug(@"address was unexpectedly nil");
+        return nil;
+    }
+
+    // System contact avatars are already thumbnails, so only the profile
+    // avatar is decoded at the requested size.
+    UIImage *_Nullable image = nil;
+    if ([SSKPreferences preferContactAvatarsWithTransaction:transaction]) {
+        image = image ?: [self systemContactOrSyncedImageForAddress:address transaction:transaction];
+        image = image ?: [self.profileManager profileAvatarForAddress:address
+                                                             diameter:diameter
+                                                          transaction:transaction];
+    } else {
+        image = image ?: [self.profileManager profileAvatarForAddress:address
+                                                             diameter:diameter
+                                                          transaction:transaction];
+        image = image ?: [self systemContactOrSyncedImageForAddress:address transaction:transaction];
+    }
+    return image;
+}
+
 - (BOOL)shouldSortByGivenName
 {
     return [[CNContactsUserDefaults sharedDefaults] sortOrder] == CNContactSortOrderGivenName;
@@ -1346,7 +1436,42 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
     return contact.comparableNameLastFirst;
 }
 
+- (nullable NSString *)cachedComparableNameForAddress:(SignalServiceAddress *)address
+{
+    // The user can change the sort order in the system settings.
+    BOOL shouldSortByGivenName = self.shouldSortByGivenName;
+    if (shouldSortByGivenName != self.comparableNameCacheSortsByGivenName) {
+        [self.comparableNameCache clear];
+        self.comparableNameCacheSortsByGivenName = shouldSortByGivenName;
+        return nil;
+    }
+    return (NSString *)[self.comparableNameCache getWithKey:address];
+}
+
 - (NSString *)comparableNameForSignalAccount:(SignalAccount *)signalAccount
+{
+    NSString *_Nullable cachedName = [self cachedComparableNameForAddress:signalAccount.recipientAddress];
+    if (cachedName != nil) {
+        return cachedName;
+    }
+    NSString *name = [self buildComparableNameForSignalAccount:signalAccount];
+    [self.comparableNameCache setWithKey:signalAccount.recipientAddress value:name];
+    return name;
+}
+
+- (NSString *)comparableNameForSignalAccount:(SignalAccount *)signalAccount
+                                 transaction:(SDSAnyReadTransaction *)transaction
+{
+    NSString *_Nullable cachedName = [self cachedComparableNameForAddress:signalAccount.recipientAddress];
+    if (cachedName != nil) {
+        return cachedName;
+    }
+    NSString *name = [self buildComparableNameForSignalAccount:signalAccount transaction:transaction];
+    [self.comparableNameCache setWithKey:signalAccount.recipientAddress value:name];
+    return name;
+}
+
+- (NSString *)buildComparableNameForSignalAccount:(SignalAccount *)signalAccount
 {
     NSString *_Nullable name = [self comparableNameForContact:signalAccount.contact];
 
@@ -1378,8 +1503,8 @@ NSString *const OWSContactsManagerKeyNextFullIntersectionDate = @"OWSContactsMan
     return [self displayNameForSignalAccount:signalAccount];
 }
 
-- (NSString *)comparableNameForSignalAccount:(SignalAccount *)signalAccount
-                                 transaction:(SDSAnyReadTransaction *)transaction
+- (NSString *)buildComparableNameForSignalAccount:(SignalAccount *)signalAccount
+                                      transaction:(SDSAnyReadTransaction *)transaction
 {
     NSString *_Nullable name = [self comparableNameForContact:signalAccount.contact];
 
@@ -15,30 +15,22 @@ public extension OWSContactsManager {
 
     // MARK: - Avatar Cache
 
-    private static let unfairLock = UnfairLock()
+    // The avatar cache is thread-safe.
 
     func getImageFromAvatarCache(key: String, diameter: CGFloat) -> UIImage? {
-        Self.unfairLock.withLock {
-            self.avatarCachePrivate.image(forKey: key as NSString, diameter: diameter)
-        }
+        self.avatarCachePrivate.image(forKey: key as NSString, diameter: diameter)
     }
 
     func setImageForAvatarCache(_ image: UIImage, forKey key: String, diameter: CGFloat) {
-        Self.unfairLock.withLock {
-            self.avatarCachePrivate.setImage(image, forKey: key as NSString, diameter: diameter)
-        }
+        self.avatarCachePrivate.setImage(image, forKey: key as NSString, diameter: diameter)
     }
 
     func removeAllFromAvatarCacheWithKey(_ key: String) {
-        Self.unfairLock.withLock {
-            self.avatarCachePrivate.removeAllImages(forKey: key as NSString)
-        }
+        self.avatarCachePrivate.removeAllImages(forKey: key as NSString)
     }
 
     func removeAllFromAvatarCache() {
-        Self.unfairLock.withLock {
-            self.avatarCachePrivate.removeAllImages()
-        }
+        self.avatarCachePrivate.removeAllImages()
     }
 
     // MARK: -
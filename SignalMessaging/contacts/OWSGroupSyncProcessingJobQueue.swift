@@ -42,15 +42,9 @@ public class IncomingGroupSyncJobQueue: NSObject, JobQueue {
         // no special handling
     }
 
-    let defaultQueue: OperationQueue = {
-        let operationQueue = OperationQueue()
-        operationQueue.name = "IncomingGroupSyncJobQueue"
-        operationQueue.maxConcurrentOperationCount = 1
-        return operationQueue
-    }()
-
     public func operationQueue(jobRecord: OWSIncomingGroupSyncJobRecord) -> OperationQueue {
-        return defaultQueue
+        // Syncs are applied in write transactions, so they share the serial database queue.
+        return JobQueueExecutor.shared.operationQueue(concurrencyClass: .database)
     }
 
     public func buildOperation(jobRecord: OWSIncomingGroupSyncJobRecord, transaction: SDSAnyReadTransaction) throws -> IncomingGroupSyncOperation {
@@ -138,6 +132,7 @@ public class IncomingGroupSyncOperation: OWSOperation, DurableOperation {
         Logger.error("failed with error: \(error)")
 
         self.databaseStorage.write { transaction in
+            IncomingSyncBatchProcessor(jobRecord: self.jobRecord).discardResumeOffset(transaction: transaction)
             self.durableOperationDelegate?.durableOperation(self, didFailWithError: error, transaction: transaction)
         }
     }
@@ -172,24 +167,34 @@ public class IncomingGroupSyncOperation: OWSOperation, DurableOperation {
         try Data(contentsOf: fileUrl, options: .mappedIfSafe).withUnsafeBytes { bufferPtr in
             if let baseAddress = bufferPtr.baseAddress, bufferPtr.count > 0 {
                 let pointer = baseAddress.assumingMemoryBound(to: UInt8.self)
-                let inputStream = ChunkedInputStream(forReadingFrom: pointer, count: bufferPtr.count)
+                var inputStream = ChunkedInputStream(forReadingFrom: pointer, count: bufferPtr.count)
+
+                // Resume after the groups applied by an earlier attempt, if any.
+                let batchProcessor = IncomingSyncBatchProcessor(jobRecord: jobRecord, databaseStorage: databaseStorage)
+                let resumeOffset = batchProcessor.resumeOffset()
+                if resumeOffset > 0 {
+                    Logger.info("Resuming at offset: \(resumeOffset)")
+                    try inputStream.skip(toOffset: resumeOffset)
+                }
                 let groupStream = GroupsInputStream(inputStream: inputStream)
 
-                try databaseStorage.write { transaction in
-                    while let nextGroup = try groupStream.decodeGroup() {
-                        autoreleasepool {
-                            do {
-                                try self.process(groupDetails: nextGroup, transaction: transaction)
-                            } catch {
-                                if case GroupsV2Error.groupDowngradeNotAllowed = error {
-                                    Logger.warn("Error: \(error)")
-                                } else {
-                                    owsFailDebug("Error: \(error)")
-                                }
-                            }
+                try batchProcessor.processRecords(offset: {
+                    groupStream.offset
+                }, processNextRecord: { transaction in
+                    guard let nextGroup = try groupStream.decodeGroup() else {
+                        return false
+                    }
+                    do {
+                        try self.process(groupDetails: nextGroup, transaction: transaction)
+                    } catch {
+                        if case GroupsV2Error.groupDowngradeNotAllowed = error {
+                            Logger.warn("Error: \(error)")
+                        } else {
+                            owsFailDebug("Error: \(error)")
                         }
                     }
-                }
+                    return true
+                }, didProcessAllRecords: { _ in })
             }
         }
     }
@@ -309,15 +309,27 @@ NSString *const kSyncManagerLastContactSyncKey = @"kTSStorageManagerOWSSyncManag
         OWSFailDebug(@"Missing thread.");
         return;
     }
-    OWSSyncGroupsMessage *syncGroupsMessage = [[OWSSyncGroupsMessage alloc] initWithThread:thread];
-    NSData *_Nullable syncData = [syncGroupsMessage buildPlainTextAttachmentDataWithTransaction:transaction];
-    if (!syncData) {
-        OWSFailDebug(@"Failed to serialize groups sync message.");
-        return;
-    }
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+
+    // Serializing every group can take a while, so we don't do it in the
+    // caller's write transaction, which is usually processing incoming
+    // messages. A newly linked device requests contacts and groups together;
+    // this lets the groups be serialized and uploaded in parallel with the
+    // contacts, which are synced on serialQueue.
+    [transaction addAsyncCompletionOffMain:^{
+        OWSSyncGroupsMessage *syncGroupsMessage = [[OWSSyncGroupsMessage alloc] initWithThread:thread];
+        __block NSURL *_Nullable syncFileUrl;
+        [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *readTransaction) {
+            syncFileUrl = [syncGroupsMessage buildPlainTextAttachmentFileWithTransaction:readTransaction];
+        }];
+        if (!syncFileUrl) {
+            OWSFailDebug(@"Failed to serialize groups sync message.");
+            return;
+        }
+
         NSError *error;
-        id<DataSource> dataSource = [DataSourcePath dataSourceWritingSyncMessageData:syncData error:&error];
+        id<DataSource> dataSource = [DataSourcePath dataSourceWithURL:syncFileUrl
+                                           shouldDeleteOnDeallocation:YES
+                                                                error:&error];
         OWSAssertDebug(error == nil);
         [self.messageSenderJobQueue addMediaMessage:syncGroupsMessage
                                          dataSource:dataSource
@@ -326,7 +338,7 @@ NSString *const kSyncManagerLastContactSyncKey = @"kTSStorageManagerOWSSyncManag
                                             caption:nil
                                      albumMessageId:nil
                               isTemporaryAttachment:YES];
-    });
+    }];
 }
 
 #pragma mark - Local Sync
@@ -416,22 +428,34 @@ NSString *const kSyncManagerLastContactSyncKey = @"kTSStorageManagerOWSSyncManag
                                                 signalAccounts:signalAccounts
                                                identityManager:self.identityManager
                                                 profileManager:self.profileManager];
-                __block NSData *_Nullable messageData;
+                // The attachment is streamed to a file and uploaded from there,
+                // so it is never held in memory in its entirety.
+                __block NSURL *_Nullable messageFileUrl;
                 __block NSData *_Nullable lastMessageHash;
                 [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
-                    messageData = [syncContactsMessage buildPlainTextAttachmentDataWithTransaction:transaction];
+                    messageFileUrl = [syncContactsMessage buildPlainTextAttachmentFileWithTransaction:transaction];
                     lastMessageHash =
                     [OWSSyncManager.keyValueStore getData:kSyncManagerLastContactSyncKey transaction:transaction];
                 }];
 
-                if (!messageData) {
+                if (!messageFileUrl) {
                     OWSFailDebug(@"Failed to serialize contacts sync message.");
                     NSError *error
                     = OWSErrorWithCodeDescription(OWSErrorCodeContactSyncFailed, @"Could not sync contacts.");
                     return resolve(error);
                 }
-                
-                NSData *_Nullable messageHash = [self hashForMessageData:messageData];
+
+                // The data source deletes the file once it is no longer needed.
+                NSError *writeError;
+                id<DataSource> dataSource = [DataSourceMappedPath dataSourceWithURL:messageFileUrl
+                                                         shouldDeleteOnDeallocation:YES
+                                                                              error:&writeError];
+                if (writeError != nil) {
+                    resolve(writeError);
+                    return;
+                }
+
+                NSData *_Nullable messageHash = [self hashForMessageData:dataSource.data];
                 if (skipIfRedundant && messageHash != nil && lastMessageHash != nil &&
                     [lastMessageHash isEqual:messageHash]) {
                     // Ignore redundant contacts sync message.
@@ -444,14 +468,6 @@ NSString *const kSyncManagerLastContactSyncKey = @"kTSStorageManagerOWSSyncManag
 
                 // DURABLE CLEANUP - we could replace the custom durability logic in this class
                 // with a durable JobQueue.
-                NSError *writeError;
-                id<DataSource> dataSource = [DataSourcePath dataSourceWritingSyncMessageData:messageData
-                                                                                       error:&writeError];
-                if (writeError != nil) {
-                    resolve(writeError);
-                    return;
-                }
-
                 [self.messageSender sendTemporaryAttachment:dataSource
                                                 contentType:OWSMimeTypeApplicationOctetStream
                                                   inMessage:syncContactsMessage
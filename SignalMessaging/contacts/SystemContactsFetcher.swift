@@ -29,6 +29,21 @@ class ContactsFrameworkContactStoreAdaptee: NSObject, ContactStoreAdaptee {
     private var initializedObserver = false
     private var lastSortOrder: CNContactSortOrder?
 
+    // Every change to the system contacts makes us re-fetch all of them, but
+    // building a Contact (and parsing its phone numbers) is much more expensive
+    // than the fetch. We keep the Contacts built by the last fetch, keyed by
+    // contact identifier, and only rebuild those whose fingerprint has changed.
+    //
+    // This should only be accessed from fetchContacts(), which is only called
+    // on SystemContactsFetcher's serial queue.
+    private struct BuiltContact {
+        let fingerprint: Int
+        let contact: Contact
+    }
+    private var builtContactCache = [String: BuiltContact]()
+    // Phone numbers are parsed relative to the local number.
+    private var builtContactCacheLocalNumber: String?
+
     let supportsContactEditing = true
 
     public static let allowedContactKeys: [CNKeyDescriptor] = [
@@ -114,10 +129,71 @@ class ContactsFrameworkContactStoreAdaptee: NSObject, ContactStoreAdaptee {
             return .error(error)
         }
 
-        let contacts = systemContacts.map { Contact(systemContact: $0) }
+        let localNumber = TSAccountManager.localNumber
+        if localNumber != builtContactCacheLocalNumber {
+            builtContactCache.removeAll()
+            builtContactCacheLocalNumber = localNumber
+        }
+
+        let fingerprints = systemContacts.map { Self.fingerprint(for: $0) }
+        var existingOrBuiltContacts: [Contact?] = systemContacts.enumerated().map { (index, systemContact) in
+            guard let builtContact = builtContactCache[systemContact.identifier],
+                  builtContact.fingerprint == fingerprints[index] else {
+                return nil
+            }
+            return builtContact.contact
+        }
+
+        // Build the new and changed contacts across all cores; each thread
+        // parses phone numbers with its own PhoneNumberUtil.
+        let indicesToBuild = existingOrBuiltContacts.indices.filter { existingOrBuiltContacts[$0] == nil }
+        let builtContacts = AtomicArray<(Int, Contact)>()
+        DispatchQueue.concurrentPerform(iterations: indicesToBuild.count) { iteration in
+            let index = indicesToBuild[iteration]
+            builtContacts.append((index, Contact(systemContact: systemContacts[index])))
+        }
+        for (index, contact) in builtContacts.get() {
+            existingOrBuiltContacts[index] = contact
+        }
+
+        var newBuiltContactCache = [String: BuiltContact]()
+        let contacts: [Contact] = existingOrBuiltContacts.enumerated().compactMap { (index, contact) in
+            guard let contact = contact else {
+                owsFailDebug("Missing contact.")
+                return nil
+            }
+            newBuiltContactCache[systemContacts[index].identifier] = BuiltContact(fingerprint: fingerprints[index],
+                                                                                 contact: contact)
+            return contact
+        }
+        // This also drops contacts that were deleted.
+        builtContactCache = newBuiltContactCache
+        Logger.info("Built \(indicesToBuild.count) of \(contacts.count) contacts.")
+
         return .success(contacts)
     }
 
+    // Covers every field of CNContact that Contact(systemContact:) reads.
+    private static func fingerprint(for systemContact: CNContact) -> Int {
+        var hasher = Hasher()
+        hasher.combine(systemContact.namePrefix)
+        hasher.combine(systemContact.givenName)
+        hasher.combine(systemContact.middleName)
+        hasher.combine(systemContact.familyName)
+        hasher.combine(systemContact.nameSuffix)
+        hasher.combine(systemContact.nickname)
+        hasher.combine(systemContact.organizationName)
+        for phoneNumber in systemContact.phoneNumbers {
+            hasher.combine(phoneNumber.label)
+            hasher.combine(phoneNumber.value.stringValue)
+        }
+        for emailAddress in systemContact.emailAddresses {
+            hasher.combine(emailAddress.value as String)
+        }
+        hasher.combine(systemContact.thumbnailImageData)
+        return hasher.finalize()
+    }
+
     func fetchCNContact(contactId: String) -> CNContact? {
         var result: CNContact?
         do {
@@ -4,6 +4,7 @@
 
 #import "AppSetup.h"
 #import "Environment.h"
+#import "OWSSounds.h"
 #import "Theme.h"
 #import "VersionMigrations.h"
 #import <AxolotlKit/SessionCipher.h>
@@ -11,6 +12,7 @@
 #import <SignalMessaging/OWSProfileManager.h>
 #import <SignalMessaging/SignalMessaging-Swift.h>
 #import <SignalMetadataKit/SignalMetadataKit-Swift.h>
+#import <SignalServiceKit/AppReadiness.h>
 #import <SignalServiceKit/OWS2FAManager.h>
 #import <SignalServiceKit/OWSAttachmentDownloads.h>
 #import <SignalServiceKit/OWSBackgroundTask.h>
@@ -30,6 +32,18 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+// Constructs one of the environments' singletons, recording its construction
+// time and its dependencies in the SingletonRegistry.
+static id ConstructSingletonWithDependencies(NSString *name, NSArray<NSString *> *dependencies, id (^block)(void))
+{
+    return [SingletonRegistry.shared constructSingletonNamed:name dependencies:dependencies block:block];
+}
+
+static id ConstructSingleton(NSString *name, id (^block)(void))
+{
+    return ConstructSingletonWithDependencies(name, @[], block);
+}
+
 @implementation AppSetup
 
 + (void)setupEnvironmentWithAppSpecificSingletonBlock:(dispatch_block_t)appSpecificSingletonBlock
@@ -50,6 +64,8 @@ NS_ASSUME_NONNULL_BEGIN
         // All of these "singletons" should have any dependencies used in their
         // initializers injected.
         [[OWSBackgroundTaskManager shared] observeNotifications];
+        [MemoryAccountant.shared start];
+        [LaunchTimer.shared beginPhase:LaunchPhaseAppSetup];
 
         StorageCoordinator *storageCoordinator = [StorageCoordinator new];
         SDSDatabaseStorage *databaseStorage = storageCoordinator.databaseStorage;
@@ -65,65 +81,112 @@ NS_ASSUME_NONNULL_BEGIN
                                              fileProtectionType:NSFileProtectionCompleteUntilFirstUserAuthentication];
         OWSAssert(success);
 
-        OWSPreferences *preferences = [OWSPreferences new];
-
-        TSNetworkManager *networkManager = [[TSNetworkManager alloc] initDefault];
-        OWSContactsManager *contactsManager = [OWSContactsManager new];
-        OWSLinkPreviewManager *linkPreviewManager = [OWSLinkPreviewManager new];
-        MessageSender *messageSender = [MessageSender new];
-        MessageSenderJobQueue *messageSenderJobQueue = [MessageSenderJobQueue new];
-        id<PendingReadReceiptRecorder> pendingReadReceiptRecorder = [MessageRequestReadReceipts new];
-        OWSProfileManager *profileManager = [[OWSProfileManager alloc] initWithDatabaseStorage:databaseStorage];
-        OWSMessageManager *messageManager = [OWSMessageManager new];
-        OWSBlockingManager *blockingManager = [OWSBlockingManager new];
-        OWSIdentityManager *identityManager = [[OWSIdentityManager alloc] initWithDatabaseStorage:databaseStorage];
-        id<RemoteConfigManager> remoteConfigManager = [ServiceRemoteConfigManager new];
-        SSKSessionStore *sessionStore = [SSKSessionStore new];
-        SSKSignedPreKeyStore *signedPreKeyStore = [SSKSignedPreKeyStore new];
-        SSKPreKeyStore *preKeyStore = [SSKPreKeyStore new];
-        id<OWSUDManager> udManager = [OWSUDManagerImpl new];
-        OWSMessageDecrypter *messageDecrypter = [OWSMessageDecrypter new];
-        SSKMessageDecryptJobQueue *messageDecryptJobQueue = [SSKMessageDecryptJobQueue new];
-        OWSBatchMessageProcessor *batchMessageProcessor = [OWSBatchMessageProcessor new];
-        OWSMessageReceiver *messageReceiver = [OWSMessageReceiver new];
-        GroupsV2MessageProcessor *groupsV2MessageProcessor = [GroupsV2MessageProcessor new];
-        TSSocketManager *socketManager = [[TSSocketManager alloc] init];
-        TSAccountManager *tsAccountManager = [TSAccountManager new];
-        OWS2FAManager *ows2FAManager = [OWS2FAManager new];
-        OWSDisappearingMessagesJob *disappearingMessagesJob = [OWSDisappearingMessagesJob new];
-        OWSReadReceiptManager *readReceiptManager = [OWSReadReceiptManager new];
-        OWSOutgoingReceiptManager *outgoingReceiptManager = [OWSOutgoingReceiptManager new];
-        id<SyncManagerProtocol> syncManager = (id<SyncManagerProtocol>)[[OWSSyncManager alloc] initDefault];
-        id<SSKReachabilityManager> reachabilityManager = [SSKReachabilityManagerImpl new];
-        id<OWSTypingIndicators> typingIndicators = [[OWSTypingIndicatorsImpl alloc] init];
-        OWSAttachmentDownloads *attachmentDownloads = [[OWSAttachmentDownloads alloc] init];
-        StickerManager *stickerManager = [[StickerManager alloc] init];
-        SignalServiceAddressCache *signalServiceAddressCache = [SignalServiceAddressCache new];
-        AccountServiceClient *accountServiceClient = [AccountServiceClient new];
-        OWSStorageServiceManager *storageServiceManager = OWSStorageServiceManager.shared;
-        SSKPreferences *sskPreferences = [SSKPreferences new];
-        id<GroupsV2> groupsV2 = [GroupsV2Impl new];
-        id<GroupV2Updates> groupV2Updates = [[GroupV2UpdatesImpl alloc] init];
-
-        OWSAudioSession *audioSession = [OWSAudioSession new];
-        OWSIncomingContactSyncJobQueue *incomingContactSyncJobQueue = [OWSIncomingContactSyncJobQueue new];
-        OWSIncomingGroupSyncJobQueue *incomingGroupSyncJobQueue = [OWSIncomingGroupSyncJobQueue new];
-        LaunchJobs *launchJobs = [LaunchJobs new];
-        OWSSounds *sounds = [OWSSounds new];
-        id<OWSProximityMonitoringManager> proximityMonitoringManager = [OWSProximityMonitoringManagerImpl new];
-        OWSWindowManager *windowManager = [[OWSWindowManager alloc] initDefault];
-        MessageProcessing *messageProcessing = [MessageProcessing new];
-        MessageFetcherJob *messageFetcherJob = [MessageFetcherJob new];
-        BulkProfileFetch *bulkProfileFetch = [BulkProfileFetch new];
-        BulkUUIDLookup *bulkUUIDLookup = [BulkUUIDLookup new];
-        id<VersionedProfiles> versionedProfiles = [VersionedProfilesImpl new];
-        ModelReadCaches *modelReadCaches = [ModelReadCaches new];
-        EarlyMessageManager *earlyMessageManager = [EarlyMessageManager new];
-        OWSMessagePipelineSupervisor *messagePipelineSupervisor =
-            [OWSMessagePipelineSupervisor createStandardSupervisor];
-        ContactsViewHelper *contactsViewHelper = [ContactsViewHelper new];
-        AppExpiry *appExpiry = [AppExpiry new];
-        BroadcastMediaMessageJobQueue *broadcastMediaMessageJobQueue = [BroadcastMediaMessageJobQueue new];
+        OWSPreferences *preferences = ConstructSingleton(@"preferences", ^{ return [OWSPreferences new]; });
+
+        TSNetworkManager *networkManager =
+            ConstructSingleton(@"networkManager", ^{ return [[TSNetworkManager alloc] initDefault]; });
+        OWSContactsManager *contactsManager =
+            ConstructSingleton(@"contactsManager", ^{ return [OWSContactsManager new]; });
+        MessageSender *messageSender = ConstructSingleton(@"messageSender", ^{ return [MessageSender new]; });
+        MessageSenderJobQueue *messageSenderJobQueue =
+            ConstructSingleton(@"messageSenderJobQueue", ^{ return [MessageSenderJobQueue new]; });
+        id<PendingReadReceiptRecorder> pendingReadReceiptRecorder =
+            ConstructSingleton(@"pendingReadReceiptRecorder", ^{ return [MessageRequestReadReceipts new]; });
+        OWSProfileManager *profileManager =
+            ConstructSingletonWithDependencies(@"profileManager", @[ @"databaseStorage" ], ^{
+                return [[OWSProfileManager alloc] initWithDatabaseStorage:databaseStorage];
+            });
+        OWSMessageManager *messageManager = ConstructSingleton(@"messageManager", ^{ return [OWSMessageManager new]; });
+        OWSBlockingManager *blockingManager =
+            ConstructSingleton(@"blockingManager", ^{ return [OWSBlockingManager new]; });
+        OWSIdentityManager *identityManager =
+            ConstructSingletonWithDependencies(@"identityManager", @[ @"databaseStorage" ], ^{
+                return [[OWSIdentityManager alloc] initWithDatabaseStorage:databaseStorage];
+            });
+        id<RemoteConfigManager> remoteConfigManager =
+            ConstructSingleton(@"remoteConfigManager", ^{ return [ServiceRemoteConfigManager new]; });
+        SSKSessionStore *sessionStore = ConstructSingleton(@"sessionStore", ^{ return [SSKSessionStore new]; });
+        SSKSignedPreKeyStore *signedPreKeyStore =
+            ConstructSingleton(@"signedPreKeyStore", ^{ return [SSKSignedPreKeyStore new]; });
+        SSKPreKeyStore *preKeyStore = ConstructSingleton(@"preKeyStore", ^{ return [SSKPreKeyStore new]; });
+        id<OWSUDManager> udManager = ConstructSingleton(@"udManager", ^{ return [OWSUDManagerImpl new]; });
+        OWSMessageDecrypter *messageDecrypter =
+            ConstructSingleton(@"messageDecrypter", ^{ return [OWSMessageDecrypter new]; });
+        SSKMessageDecryptJobQueue *messageDecryptJobQueue =
+            ConstructSingleton(@"messageDecryptJobQueue", ^{ return [SSKMessageDecryptJobQueue new]; });
+        OWSBatchMessageProcessor *batchMessageProcessor =
+            ConstructSingleton(@"batchMessageProcessor", ^{ return [OWSBatchMessageProcessor new]; });
+        OWSMessageReceiver *messageReceiver =
+            ConstructSingleton(@"messageReceiver", ^{ return [OWSMessageReceiver new]; });
+        GroupsV2MessageProcessor *groupsV2MessageProcessor =
+            ConstructSingleton(@"groupsV2MessageProcessor", ^{ return [GroupsV2MessageProcessor new]; });
+        TSSocketManager *socketManager =
+            ConstructSingleton(@"socketManager", ^{ return [[TSSocketManager alloc] init]; });
+        TSAccountManager *tsAccountManager =
+            ConstructSingleton(@"tsAccountManager", ^{ return [TSAccountManager new]; });
+        OWS2FAManager *ows2FAManager = ConstructSingleton(@"ows2FAManager", ^{ return [OWS2FAManager new]; });
+        OWSDisappearingMessagesJob *disappearingMessagesJob =
+            ConstructSingleton(@"disappearingMessagesJob", ^{ return [OWSDisappearingMessagesJob new]; });
+        OWSReadReceiptManager *readReceiptManager =
+            ConstructSingleton(@"readReceiptManager", ^{ return [OWSReadReceiptManager new]; });
+        OWSOutgoingReceiptManager *outgoingReceiptManager =
+            ConstructSingleton(@"outgoingReceiptManager", ^{ return [OWSOutgoingReceiptManager new]; });
+        id<SyncManagerProtocol> syncManager = ConstructSingleton(@"syncManager", ^{
+            return (id<SyncManagerProtocol>)[[OWSSyncManager alloc] initDefault];
+        });
+        id<SSKReachabilityManager> reachabilityManager =
+            ConstructSingleton(@"reachabilityManager", ^{ return [SSKReachabilityManagerImpl new]; });
+        id<OWSTypingIndicators> typingIndicators =
+            ConstructSingleton(@"typingIndicators", ^{ return [[OWSTypingIndicatorsImpl alloc] init]; });
+        OWSAttachmentDownloads *attachmentDownloads =
+            ConstructSingleton(@"attachmentDownloads", ^{ return [[OWSAttachmentDownloads alloc] init]; });
+        StickerManager *stickerManager =
+            ConstructSingleton(@"stickerManager", ^{ return [[StickerManager alloc] init]; });
+        SignalServiceAddressCache *signalServiceAddressCache =
+            ConstructSingleton(@"signalServiceAddressCache", ^{ return [SignalServiceAddressCache new]; });
+        AccountServiceClient *accountServiceClient =
+            ConstructSingleton(@"accountServiceClient", ^{ return [AccountServiceClient new]; });
+        OWSStorageServiceManager *storageServiceManager =
+            ConstructSingleton(@"storageServiceManager", ^{ return OWSStorageServiceManager.shared; });
+        SSKPreferences *sskPreferences = ConstructSingleton(@"sskPreferences", ^{ return [SSKPreferences new]; });
+        id<GroupsV2> groupsV2 = ConstructSingleton(@"groupsV2", ^{ return [GroupsV2Impl new]; });
+        id<GroupV2Updates> groupV2Updates =
+            ConstructSingleton(@"groupV2Updates", ^{ return [[GroupV2UpdatesImpl alloc] init]; });
+
+        OWSAudioSession *audioSession = ConstructSingleton(@"audioSession", ^{ return [OWSAudioSession new]; });
+        OWSIncomingContactSyncJobQueue *incomingContactSyncJobQueue =
+            ConstructSingleton(@"incomingContactSyncJobQueue", ^{ return [OWSIncomingContactSyncJobQueue new]; });
+        OWSIncomingGroupSyncJobQueue *incomingGroupSyncJobQueue =
+            ConstructSingleton(@"incomingGroupSyncJobQueue", ^{ return [OWSIncomingGroupSyncJobQueue new]; });
+        LaunchJobs *launchJobs = ConstructSingleton(@"launchJobs", ^{ return [LaunchJobs new]; });
+        id<OWSProximityMonitoringManager> proximityMonitoringManager =
+            ConstructSingleton(@"proximityMonitoringManager", ^{ return [OWSProximityMonitoringManagerImpl new]; });
+        OWSWindowManager *windowManager =
+            ConstructSingleton(@"windowManager", ^{ return [[OWSWindowManager alloc] initDefault]; });
+        MessageProcessing *messageProcessing =
+            ConstructSingleton(@"messageProcessing", ^{ return [MessageProcessing new]; });
+        MessageFetcherJob *messageFetcherJob =
+            ConstructSingleton(@"messageFetcherJob", ^{ return [MessageFetcherJob new]; });
+        BulkProfileFetch *bulkProfileFetch =
+            ConstructSingleton(@"bulkProfileFetch", ^{ return [BulkProfileFetch new]; });
+        ModelReadCaches *modelReadCaches = ConstructSingleton(@"modelReadCaches", ^{ return [ModelReadCaches new]; });
+        EarlyMessageManager *earlyMessageManager =
+            ConstructSingleton(@"earlyMessageManager", ^{ return [EarlyMessageManager new]; });
+        OWSMessagePipelineSupervisor *messagePipelineSupervisor = ConstructSingleton(@"messagePipelineSupervisor", ^{
+            return [OWSMessagePipelineSupervisor createStandardSupervisor];
+        });
+        ContactsViewHelper *contactsViewHelper =
+            ConstructSingleton(@"contactsViewHelper", ^{ return [ContactsViewHelper new]; });
+        AppExpiry *appExpiry = ConstructSingleton(@"appExpiry", ^{ return [AppExpiry new]; });
+        BroadcastMediaMessageJobQueue *broadcastMediaMessageJobQueue =
+            ConstructSingleton(@"broadcastMediaMessageJobQueue", ^{ return [BroadcastMediaMessageJobQueue new]; });
+
+        // These singletons aren't needed before the first frame, so they are
+        // constructed when they are first accessed.
+        OWSLinkPreviewManager * (^linkPreviewManagerBlock)(void) = ^{ return [OWSLinkPreviewManager new]; };
+        BulkUUIDLookup * (^bulkUUIDLookupBlock)(void) = ^{ return [BulkUUIDLookup new]; };
+        id<VersionedProfiles> (^versionedProfilesBlock)(void) = ^{ return [VersionedProfilesImpl new]; };
+        OWSSounds * (^soundsBlock)(void) = ^{ return [OWSSounds new]; };
 
         [Environment setShared:[[Environment alloc] initWithAudioSession:audioSession
                                              incomingContactSyncJobQueue:incomingContactSyncJobQueue
@@ -131,7 +194,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                               launchJobs:launchJobs
                                                              preferences:preferences
                                               proximityMonitoringManager:proximityMonitoringManager
-                                                                  sounds:sounds
+                                                             soundsBlock:soundsBlock
                                                            windowManager:windowManager
                                                       contactsViewHelper:contactsViewHelper
                                            broadcastMediaMessageJobQueue:broadcastMediaMessageJobQueue]];
@@ -139,7 +202,7 @@ NS_ASSUME_NONNULL_BEGIN
         [SMKEnvironment setShared:[[SMKEnvironment alloc] initWithAccountIdFinder:[OWSAccountIdFinder new]]];
 
         [SSKEnvironment setShared:[[SSKEnvironment alloc] initWithContactsManager:contactsManager
-                                                               linkPreviewManager:linkPreviewManager
+                                                          linkPreviewManagerBlock:linkPreviewManagerBlock
                                                                     messageSender:messageSender
                                                             messageSenderJobQueue:messageSenderJobQueue
                                                        pendingReadReceiptRecorder:pendingReadReceiptRecorder
@@ -181,8 +244,8 @@ NS_ASSUME_NONNULL_BEGIN
                                                                 messageProcessing:messageProcessing
                                                                 messageFetcherJob:messageFetcherJob
                                                                  bulkProfileFetch:bulkProfileFetch
-                                                                   bulkUUIDLookup:bulkUUIDLookup
-                                                                versionedProfiles:versionedProfiles
+                                                              bulkUUIDLookupBlock:bulkUUIDLookupBlock
+                                                           versionedProfilesBlock:versionedProfilesBlock
                                                                   modelReadCaches:modelReadCaches
                                                               earlyMessageManager:earlyMessageManager
                                                         messagePipelineSupervisor:messagePipelineSupervisor
@@ -192,6 +255,10 @@ NS_ASSUME_NONNULL_BEGIN
 
         OWSAssertDebug(SSKEnvironment.shared.isComplete);
 
+        [SingletonRegistry.shared logReport];
+
+        [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{ [OWSSounds cleanupOrphanedSounds]; }];
+
         // Register renamed classes.
         [NSKeyedUnarchiver setClass:[OWSUserProfile class] forClassName:[OWSUserProfile collection]];
         [NSKeyedUnarchiver setClass:[OWSDatabaseMigration class] forClassName:[OWSDatabaseMigration collection]];
@@ -209,6 +276,8 @@ NS_ASSUME_NONNULL_BEGIN
         [DeviceSleepManager.shared addBlockWithBlockObject:sleepBlockObject];
 
         dispatch_block_t completionBlock = ^{
+            [LaunchTimer.shared endPhase:LaunchPhaseExtensionRegistration];
+
             dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
                 if (AppSetup.shouldTruncateGrdbWal) {
                     // Try to truncate GRDB WAL before any readers or writers are
@@ -224,9 +293,12 @@ NS_ASSUME_NONNULL_BEGIN
                     [storageCoordinator markStorageSetupAsComplete];
 
                     // Don't start database migrations until storage is ready.
+                    [LaunchTimer.shared beginPhase:LaunchPhaseVersionMigrations];
                     [VersionMigrations performUpdateCheckWithCompletion:^() {
                         OWSAssertIsOnMainThread();
 
+                        [LaunchTimer.shared endPhase:LaunchPhaseVersionMigrations];
+
                         [DeviceSleepManager.shared removeBlockWithBlockObject:sleepBlockObject];
 
                         if (StorageCoordinator.dataStoreForUI == DataStoreGrdb) {
@@ -241,7 +313,10 @@ NS_ASSUME_NONNULL_BEGIN
             });
         };
 
+        [LaunchTimer.shared endPhase:LaunchPhaseAppSetup];
+
         if (databaseStorage.canLoadYdb) {
+            [LaunchTimer.shared beginPhase:LaunchPhaseExtensionRegistration];
             [OWSStorage registerExtensionsWithCompletionBlock:completionBlock];
         } else {
             completionBlock();
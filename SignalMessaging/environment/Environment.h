@@ -30,13 +30,15 @@
 + (instancetype)new NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
 
+// Singletons which aren't needed before the first frame are passed as blocks,
+// and constructed when they are first accessed; see LazySingleton.
 - (instancetype)initWithAudioSession:(OWSAudioSession *)audioSession
          incomingContactSyncJobQueue:(OWSIncomingContactSyncJobQueue *)incomingContactSyncJobQueue
            incomingGroupSyncJobQueue:(OWSIncomingGroupSyncJobQueue *)incomingGroupSyncJobQueue
                           launchJobs:(LaunchJobs *)launchJobs
                          preferences:(OWSPreferences *)preferences
           proximityMonitoringManager:(id<OWSProximityMonitoringManager>)proximityMonitoringManager
-                              sounds:(OWSSounds *)sounds
+                         soundsBlock:(OWSSounds * (^)(void))soundsBlock
                        windowManager:(OWSWindowManager *)windowManager
                   contactsViewHelper:(ContactsViewHelper *)contactsViewHelper
        broadcastMediaMessageJobQueue:(BroadcastMediaMessageJobQueue *)broadcastMediaMessageJobQueue;
@@ -6,6 +6,7 @@
 #import "OWSPreferences.h"
 #import <SignalServiceKit/AppContext.h>
 #import <SignalServiceKit/SSKEnvironment.h>
+#import <SignalServiceKit/SignalServiceKit-Swift.h>
 
 static Environment *sharedEnvironment = nil;
 
@@ -15,7 +16,7 @@ static Environment *sharedEnvironment = nil;
 @property (nonatomic) OWSContactsManager *contactsManager;
 @property (nonatomic) OWSPreferences *preferences;
 @property (nonatomic) id<OWSProximityMonitoringManager> proximityMonitoringManager;
-@property (nonatomic) OWSSounds *sounds;
+@property (nonatomic, readonly) LazySingleton *lazySounds;
 @property (nonatomic) OWSWindowManager *windowManager;
 @property (nonatomic) LaunchJobs *launchJobs;
 @property (nonatomic) ContactsViewHelper *contactsViewHelper;
@@ -57,7 +58,7 @@ static Environment *sharedEnvironment = nil;
                           launchJobs:(LaunchJobs *)launchJobs
                          preferences:(OWSPreferences *)preferences
           proximityMonitoringManager:(id<OWSProximityMonitoringManager>)proximityMonitoringManager
-                              sounds:(OWSSounds *)sounds
+                         soundsBlock:(OWSSounds * (^)(void))soundsBlock
                        windowManager:(OWSWindowManager *)windowManager
                   contactsViewHelper:(ContactsViewHelper *)contactsViewHelper
        broadcastMediaMessageJobQueue:(BroadcastMediaMessageJobQueue *)broadcastMediaMessageJobQueue
@@ -73,7 +74,7 @@ static Environment *sharedEnvironment = nil;
     OWSAssertDebug(launchJobs);
     OWSAssertDebug(preferences);
     OWSAssertDebug(proximityMonitoringManager);
-    OWSAssertDebug(sounds);
+    OWSAssertDebug(soundsBlock);
     OWSAssertDebug(windowManager);
     OWSAssertDebug(contactsViewHelper);
     OWSAssertDebug(broadcastMediaMessageJobQueue);
@@ -84,7 +85,7 @@ static Environment *sharedEnvironment = nil;
     _launchJobs = launchJobs;
     _preferences = preferences;
     _proximityMonitoringManager = proximityMonitoringManager;
-    _sounds = sounds;
+    _lazySounds = [[LazySingleton alloc] initWithName:@"sounds" block:soundsBlock];
     _windowManager = windowManager;
     _contactsViewHelper = contactsViewHelper;
     _broadcastMediaMessageJobQueue = broadcastMediaMessageJobQueue;
@@ -99,4 +100,9 @@ static Environment *sharedEnvironment = nil;
     return (OWSContactsManager *)SSKEnvironment.shared.contactsManager;
 }
 
+- (OWSSounds *)sounds
+{
+    return (OWSSounds *)[self.lazySounds get];
+}
+
 @end
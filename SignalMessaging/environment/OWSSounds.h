@@ -65,6 +65,7 @@ typedef NS_ENUM(NSUInteger, OWSStandardSound) {
 + (nullable NSString *)filenameForSound:(OWSSound)sound quiet:(BOOL)quiet;
 
 + (void)importSoundsAtURLs:(NSArray<NSURL *> *)urls;
++ (void)cleanupOrphanedSounds;
 + (NSString *)soundsDirectory;
 
 #pragma mark - Notifications
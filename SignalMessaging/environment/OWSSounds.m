@@ -105,8 +105,6 @@ const NSUInteger OWSCustomSoundShift = 16;
 
     OWSSingletonAssert();
 
-    [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{ [OWSSounds cleanupOrphanedSounds]; }];
-
     return self;
 }
 
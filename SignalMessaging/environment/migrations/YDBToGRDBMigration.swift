@@ -43,10 +43,16 @@ public class GRDBMigratorGroup: NSObject {
 
     fileprivate let completionBlock: CompletionBlock?
 
+    // If set, the group's migrators don't depend on each other
+    // and can run concurrently.
+    fileprivate let isConcurrent: Bool
+
     @objc
-    public required init(completionBlock: CompletionBlock? = nil,
+    public required init(isConcurrent: Bool = false,
+                         completionBlock: CompletionBlock? = nil,
                          block: @escaping MigratorBlock) {
         self.block = block
+        self.isConcurrent = isConcurrent
         self.completionBlock = completionBlock
     }
 
@@ -131,7 +137,7 @@ extension YDBToGRDBMigration {
             // Migrate the key-value and unordered records first;
             // The later migrations may use these values in
             // "sneaky" transactions.
-            GRDBMigratorGroup { ydbTransaction in
+            GRDBMigratorGroup(isConcurrent: true) { ydbTransaction in
                 return self.allKeyValueMigrators(ydbTransaction: ydbTransaction)
             },
             // We need to migrate the user profiles before other models since they
@@ -144,12 +150,15 @@ extension YDBToGRDBMigration {
             GRDBMigratorGroup { ydbTransaction in
                 return self.allUnorderedRecordMigrators(ydbTransaction: ydbTransaction)
             },
-            GRDBMigratorGroup { ydbTransaction in
-                return [GRDBJobRecordMigrator(ydbTransaction: ydbTransaction)]
-            },
-            GRDBMigratorGroup { ydbTransaction in
-                return [GRDBInteractionMigrator(ydbTransaction: ydbTransaction)]
+            // The job records and interactions don't depend on each other,
+            // so we can copy them concurrently.
+            GRDBMigratorGroup(isConcurrent: true) { ydbTransaction in
+                return [
+                    GRDBJobRecordMigrator(ydbTransaction: ydbTransaction),
+                    GRDBInteractionMigrator(ydbTransaction: ydbTransaction)
+                ]
             },
+            // The legacy decrypt jobs must be enqueued after the job records.
             GRDBMigratorGroup { ydbTransaction in
                 return [GRDBDecryptJobMigrator(ydbTransaction: ydbTransaction)]
             }
@@ -160,15 +169,26 @@ extension YDBToGRDBMigration {
         try self.migrate(migratorGroups: migratorGroups)
 
         try storage.write { transaction in
+            // A resumed migration may have already created these.
+            let label = "createInitialGalleryRecords"
+            guard YDBToGRDBMigrationCheckpoints.migratedCount(label: label, transaction: transaction) == 0 else {
+                return
+            }
             do {
                 try createInitialGalleryRecords(transaction: transaction)
             } catch {
                 owsFail("error: \(error)")
             }
+            YDBToGRDBMigrationCheckpoints.setMigratedCount(1, label: label, transaction: transaction)
         }
 
         removeYdb()
 
+        try storage.write { transaction in
+            YDBToGRDBMigrationCheckpoints.removeAll(transaction: transaction)
+        }
+        SSKPreferences.setHasYdbMigrationCheckpoints(false)
+
         let migrationDuration = abs(startDate.timeIntervalSinceNow)
         Logger.info("Migration duration: \(OWSFormat.formatDurationSeconds(Int(migrationDuration))) (\(migrationDuration))")
     }
@@ -223,9 +243,29 @@ extension YDBToGRDBMigration {
         guard let primaryStorage = primaryStorage else {
             owsFail("Missing primaryStorage.")
         }
-        let ydbReadConnection = primaryStorage.newDatabaseConnection()
-        ydbReadConnection.ignoreQueues = true
-        ydbReadConnection.beginLongLivedReadTransaction()
+        let ydbReadConnection = newYdbReadConnection(primaryStorage: primaryStorage)
+        defer {
+            ydbReadConnection.endLongLivedReadTransaction()
+        }
+
+        // A resumed migration skips the records it already copied, so
+        // it can only resume from a copy of the YDB snapshot it is reading.
+        // If YDB was written since the checkpoints were written, records
+        // may have changed or been removed, so we discard the partial copy
+        // and start over.
+        let ydbSnapshot = ydbReadConnection.snapshot
+        try storage.write { transaction in
+            if let checkpointSnapshot = YDBToGRDBMigrationCheckpoints.ydbSnapshot(transaction: transaction),
+                checkpointSnapshot != ydbSnapshot {
+                Logger.warn("YDB has changed since the migration's checkpoints, starting over.")
+                try Self.removeAllRecords(transaction: transaction)
+            }
+            YDBToGRDBMigrationCheckpoints.setYdbSnapshot(ydbSnapshot, transaction: transaction)
+        }
+
+        // From here on, the GRDB database holds checkpoints that an
+        // interrupted migration can resume from.
+        SSKPreferences.setHasYdbMigrationCheckpoints(true)
 
         UIDatabaseObserver.serializedSync {
             UIDatabaseObserver.skipTouchObservations = true
@@ -233,7 +273,8 @@ extension YDBToGRDBMigration {
 
         for migratorGroup in migratorGroups {
             try migrate(migratorGroup: migratorGroup,
-                        ydbReadConnection: ydbReadConnection)
+                        ydbReadConnection: ydbReadConnection,
+                        primaryStorage: primaryStorage)
         }
 
         UIDatabaseObserver.serializedSync {
@@ -241,23 +282,74 @@ extension YDBToGRDBMigration {
         }
     }
 
+    // Empties every table, including the checkpoints, but leaves the schema.
+    private static func removeAllRecords(transaction: GRDBWriteTransaction) throws {
+        let database = transaction.database
+        let tables = try Row.fetchAll(database, sql: """
+            SELECT name, sql FROM sqlite_master
+            WHERE type = 'table'
+            AND name NOT LIKE 'sqlite_%'
+            AND name != 'grdb_migrations'
+            """).map { row -> (name: String, sql: String) in
+                (name: row["name"], sql: row["sql"] ?? "")
+            }
+        let virtualTableNames = tables.filter { $0.sql.hasPrefix("CREATE VIRTUAL TABLE") }.map { $0.name }
+        for table in tables {
+            // The shadow tables of virtual tables are emptied through their virtual table.
+            let isShadowTable = virtualTableNames.contains { table.name.hasPrefix($0 + "_") }
+            guard !isShadowTable else {
+                continue
+            }
+            try database.execute(sql: "DELETE FROM \"\(table.name)\"")
+        }
+    }
+
+    private func newYdbReadConnection(primaryStorage: OWSPrimaryStorage) -> YapDatabaseConnection {
+        let ydbReadConnection = primaryStorage.newDatabaseConnection()
+        ydbReadConnection.ignoreQueues = true
+        ydbReadConnection.beginLongLivedReadTransaction()
+        return ydbReadConnection
+    }
+
     private func migrate(migratorGroup: GRDBMigratorGroup,
-                         ydbReadConnection: YapDatabaseConnection) throws {
+                         ydbReadConnection: YapDatabaseConnection,
+                         primaryStorage: OWSPrimaryStorage) throws {
         Logger.info("")
 
         // Logging queries is helpful for normal debugging, but expensive during a migration
         SDSDatabaseStorage.shouldLogDBQueries = false
 
+        var migrators = [GRDBMigrator]()
         try ydbReadConnection.read { ydbTransaction in
-            let migrators = migratorGroup.migrators(ydbTransaction: ydbTransaction)
-            // Migrate migrators.
-            for migrator in migrators {
-                try autoreleasepool {
-                    try self.storage.write { grdbTransaction in
-                        try! migrator.migrate(grdbTransaction: grdbTransaction)
+            migrators = migratorGroup.migrators(ydbTransaction: ydbTransaction)
+        }
+
+        if migratorGroup.isConcurrent {
+            // Each migrator reads from YDB on its own connection, so that
+            // unarchiving the legacy records happens in parallel. GRDB
+            // serializes the writes.
+            let unfairLock = UnfairLock()
+            var firstError: Error?
+            DispatchQueue.concurrentPerform(iterations: migrators.count) { index in
+                let migratorReadConnection = self.newYdbReadConnection(primaryStorage: primaryStorage)
+                defer {
+                    migratorReadConnection.endLongLivedReadTransaction()
+                }
+                do {
+                    try self.migrate(migrator: migrators[index], ydbReadConnection: migratorReadConnection)
+                } catch {
+                    unfairLock.withLock {
+                        firstError = firstError ?? error
                     }
                 }
             }
+            if let error = firstError {
+                throw error
+            }
+        } else {
+            for migrator in migrators {
+                try migrate(migrator: migrator, ydbReadConnection: ydbReadConnection)
+            }
         }
 
         if let completionBlock = migratorGroup.completionBlock {
@@ -267,6 +359,12 @@ extension YDBToGRDBMigration {
         SDSDatabaseStorage.shouldLogDBQueries = DebugFlags.logSQLQueries
     }
 
+    private func migrate(migrator: GRDBMigrator, ydbReadConnection: YapDatabaseConnection) throws {
+        try ydbReadConnection.read { ydbTransaction in
+            try migrator.migrate(ydbTransaction: ydbTransaction, storage: self.storage)
+        }
+    }
+
     private func allKeyValueMigrators(ydbTransaction: YapDatabaseReadTransaction) -> [GRDBMigrator] {
         var result: [GRDBMigrator] = [
             GRDBKeyValueStoreMigrator<PreKeyRecord>(label: "preKey Store", keyStore: preKeyStore.keyStore, ydbTransaction: ydbTransaction),
@@ -359,33 +457,50 @@ extension YDBToGRDBMigration {
 private class LegacyObjectFinder<T> {
     let collection: String
 
-    let transaction: YapDatabaseReadTransaction
+    // The keys are sorted so that a resumed migration can skip
+    // the keys up to the last one that was migrated.
+    let keys: [String]
 
     init(collection: String, transaction: YapDatabaseReadTransaction) {
         self.collection = collection
-        self.transaction = transaction
+        // Ignore duplicates in YDB enumerations.
+        self.keys = Set(transaction.allKeys(inCollection: collection)).sorted()
     }
 
     public var count: UInt {
-        return transaction.numberOfKeys(inCollection: collection)
+        return UInt(keys.count)
+    }
+
+    // The index of the first key which sorts after the given key.
+    public func startIndex(afterKey key: String) -> Int {
+        var lowerBound = 0
+        var upperBound = keys.count
+        while lowerBound < upperBound {
+            let middle = (lowerBound + upperBound) / 2
+            if keys[middle] <= key {
+                lowerBound = middle + 1
+            } else {
+                upperBound = middle
+            }
+        }
+        return lowerBound
     }
 
-    public func enumerateLegacyKeysAndObjects(block: @escaping (String, T) throws -> Void ) throws {
-        var knownCollectionKeys = Set<String>()
-        try transaction.enumerateKeysAndObjects(inCollection: collection) { (collectionKey: String, collectionObj: Any, _: UnsafeMutablePointer<ObjCBool>) throws -> Void in
+    public func enumerateLegacyKeysAndObjects(range: Range<Int>,
+                                              transaction: YapDatabaseReadTransaction,
+                                              block: (String, T) throws -> Void) throws {
+        for collectionKey in keys[range] {
+            guard let collectionObj = transaction.object(forKey: collectionKey, inCollection: collection) else {
+                owsFailDebug("Missing collectionObj for collectionKey: \(collectionKey)")
+                continue
+            }
             guard let legacyObj = collectionObj as? T else {
                 owsFailDebug("unexpected collectionObj: \(type(of: collectionObj)) collectionKey: \(collectionKey)")
-                return
+                continue
             }
-
-            // Ignore duplicates in YDB enumerations.
-            guard !knownCollectionKeys.contains(collectionKey) else {
-                owsFailDebug("Ignoring duplicate collectionKey: \(collectionKey)")
-                return
+            try autoreleasepool {
+                try block(collectionKey, legacyObj)
             }
-            knownCollectionKeys.insert(collectionKey)
-
-            try block(collectionKey, legacyObj)
         }
     }
 }
@@ -412,39 +527,52 @@ private class LegacyUnorderedFinder<RecordType>: LegacyObjectFinder<RecordType>
 // MARK: -
 
 private class LegacyInteractionFinder {
-    let transaction: YapDatabaseReadTransaction
+    let count: UInt
 
     init(transaction: YapDatabaseReadTransaction) {
-        self.transaction = transaction
+        guard let view = transaction.safeAutoViewTransaction(TSInteractionsBySortIdDatabaseViewExtensionName) else {
+            owsFail("Missing interaction view.")
+        }
+        self.count = view.numberOfItems(inGroup: TSInteractionsBySortIdGroup)
     }
 
-    public var count: UInt {
-        let collection = TSInteraction.collection()
-        return transaction.numberOfKeys(inCollection: collection)
+    // The position after the given interaction in the view, if it is still there.
+    public func startIndex(afterKey key: String, transaction: YapDatabaseReadTransaction) -> Int? {
+        guard let view = transaction.safeAutoViewTransaction(TSInteractionsBySortIdDatabaseViewExtensionName) else {
+            owsFail("Missing interaction view.")
+        }
+        var index: UInt = 0
+        var group: NSString?
+        let wasFound = view.getGroup(&group,
+                                     index: &index,
+                                     forKey: key,
+                                     inCollection: TSInteraction.collection())
+        guard wasFound, group as String? == TSInteractionsBySortIdGroup else {
+            return nil
+        }
+        return Int(index) + 1
     }
 
-    // We need to enumerate in ascending order of sort id.
-    public func enumerateLegacyKeysAndObjects(block: @escaping (String, TSInteraction) -> Void ) throws {
+    // We need to enumerate in ascending order of sort id, so we
+    // enumerate the positions in the interaction view.
+    public func enumerateLegacyKeysAndObjects(range: Range<Int>,
+                                              transaction: YapDatabaseReadTransaction,
+                                              block: (String, TSInteraction) throws -> Void) throws {
         guard let view = transaction.safeAutoViewTransaction(TSInteractionsBySortIdDatabaseViewExtensionName) else {
             owsFail("Missing interaction view.")
         }
-        var knownUniqueIds = Set<String>()
-        view.safe_enumerateKeysAndObjects(inGroup: TSInteractionsBySortIdGroup,
-                                          extensionName: TSInteractionsBySortIdDatabaseViewExtensionName) { (_, _, object, _, _) in
-                                            guard let interaction = object as? TSInteraction else {
-                                                owsFailDebug("unexpected interaction: \(type(of: object))")
-                                                return
-                                            }
-
-                                            // Ignore duplicates in YDB enumerations.
-                                            let uniqueId = interaction.uniqueId
-                                            guard !knownUniqueIds.contains(uniqueId) else {
-                                                owsFailDebug("Ignoring duplicate uniqueId: \(uniqueId)")
-                                                return
-                                            }
-                                            knownUniqueIds.insert(uniqueId)
-
-                                            block(uniqueId, interaction)
+        for index in range {
+            guard let object = view.object(at: UInt(index), inGroup: TSInteractionsBySortIdGroup) else {
+                owsFailDebug("Missing interaction: \(index)")
+                continue
+            }
+            guard let interaction = object as? TSInteraction else {
+                owsFailDebug("unexpected interaction: \(type(of: object))")
+                continue
+            }
+            try autoreleasepool {
+                try block(interaction.uniqueId, interaction)
+            }
         }
     }
 }
@@ -455,55 +583,42 @@ private class LegacyJobRecordFinder {
 
     let extensionName = YAPDBJobRecordFinder.dbExtensionName
 
-    var ext: YapDatabaseSecondaryIndexTransaction?
+    // In order of sort id.
+    let keys: [String]
 
     init(transaction: YapDatabaseReadTransaction) {
-        self.ext = transaction.safeSecondaryIndexTransaction(extensionName)
-    }
-
-    public var count: UInt {
-        guard let ext = ext else {
-            owsFailDebug("Missing view transcation.")
-            return 0
+        var keys = [String]()
+        if let ext = transaction.safeSecondaryIndexTransaction(extensionName) {
+            let queryFormat = String(format: "ORDER BY %@", "sortId")
+            let query = YapDatabaseQuery(string: queryFormat, parameters: [])
+            ext.enumerateKeys(matching: query) { _, key, _ in
+                keys.append(key)
+            }
+        } else {
+            owsFailDebug("Missing ext.")
         }
-        var count: UInt = 0
-        ext.getNumberOfRows(&count, matching: query)
-        return count
+        self.keys = keys
     }
 
-    private var query: YapDatabaseQuery {
-        let queryFormat = String(format: "ORDER BY %@", "sortId")
-        return YapDatabaseQuery(string: queryFormat, parameters: [])
+    public var count: UInt {
+        return UInt(keys.count)
     }
 
-    public func enumerateJobRecords(block: @escaping (SSKJobRecord) throws -> Void) throws {
-        try enumerateJobRecords(ext: ext, block: block)
+    // The position after the given job record, if it is still there.
+    public func startIndex(afterKey key: String) -> Int? {
+        return keys.firstIndex(of: key).map { $0 + 1 }
     }
 
-    func enumerateJobRecords(ext: YapDatabaseSecondaryIndexTransaction?, block: @escaping (SSKJobRecord) throws -> Void) throws {
-        guard let ext = ext else {
-            owsFailDebug("Missing ext.")
-            return
-        }
-
-        var errorToRaise: Error?
-
-        ext.enumerateKeysAndObjects(matching: query) { _, _, object, stopPtr in
-            do {
-                guard let jobRecord = object as? SSKJobRecord else {
-                    owsFailDebug("expecting jobRecord but found: \(object)")
-                    return
-                }
-                try block(jobRecord)
-            } catch {
-                owsFailDebug("error: \(error)")
-                errorToRaise = error
-                stopPtr.pointee = true
+    public func enumerateJobRecords(range: Range<Int>,
+                                    transaction: YapDatabaseReadTransaction,
+                                    block: (SSKJobRecord) throws -> Void) throws {
+        for key in keys[range] {
+            let object = transaction.object(forKey: key, inCollection: SSKJobRecord.collection())
+            guard let jobRecord = object as? SSKJobRecord else {
+                owsFailDebug("expecting jobRecord but found: \(String(describing: object))")
+                continue
             }
-        }
-
-        if let errorToRaise = errorToRaise {
-            throw errorToRaise
+            try block(jobRecord)
         }
     }
 }
@@ -512,22 +627,18 @@ private class LegacyJobRecordFinder {
 
 private class LegacyDecryptJobFinder {
 
-    let ydbTransaction: YapDatabaseReadTransaction
+    let count: UInt
 
     init(transaction: YapDatabaseReadTransaction) {
-        ydbTransaction = transaction
-    }
-
-    var count: UInt {
-
         let legacyFinder = OWSMessageDecryptJobFinder()
-        return legacyFinder.queuedJobCount(with: ydbTransaction.asAnyRead)
+        count = legacyFinder.queuedJobCount(with: transaction.asAnyRead)
     }
 
-    func enumerateJobRecords(block: @escaping (OWSMessageDecryptJob) throws -> Void) throws {
+    func enumerateJobRecords(transaction: YapDatabaseReadTransaction,
+                             block: @escaping (OWSMessageDecryptJob) throws -> Void) throws {
         var errorToRaise: Error?
         let legacyFinder = OWSMessageDecryptJobFinder()
-        try legacyFinder.enumerateJobs(transaction: ydbTransaction.asAnyRead) { (job, stop) in
+        try legacyFinder.enumerateJobs(transaction: transaction.asAnyRead) { (job, stop) in
             do {
                 try block(job)
             } catch {
@@ -543,6 +654,57 @@ private class LegacyDecryptJobFinder {
     }
 }
 
+// MARK: - Checkpoints
+
+// Records the last key each migrator has copied, or how many records it
+// has copied if its records have no stable keys, so that a migration which
+// is interrupted, e.g. because the app is killed, can resume rather than
+// start over.
+//
+// The checkpoints live in the GRDB database and are written in the same
+// transaction as the records they count, so they can't disagree.
+private class YDBToGRDBMigrationCheckpoints {
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "YDBToGRDBMigration.checkpoints")
+
+    static func lastMigratedKey(label: String, transaction: GRDBReadTransaction) -> String? {
+        return keyValueStore.getString(label + ".lastKey", transaction: transaction.asAnyRead)
+    }
+
+    static func setLastMigratedKey(_ value: String, label: String, transaction: GRDBWriteTransaction) {
+        keyValueStore.setString(value, key: label + ".lastKey", transaction: transaction.asAnyWrite)
+    }
+
+    static func migratedCount(label: String, transaction: GRDBReadTransaction) -> Int {
+        return keyValueStore.getInt(label, defaultValue: 0, transaction: transaction.asAnyRead)
+    }
+
+    static func setMigratedCount(_ value: Int, label: String, transaction: GRDBWriteTransaction) {
+        keyValueStore.setInt(value, key: label, transaction: transaction.asAnyWrite)
+    }
+
+    static func lastSortId(label: String, transaction: GRDBReadTransaction) -> UInt64? {
+        return keyValueStore.getUInt64(label + ".lastSortId", transaction: transaction.asAnyRead)
+    }
+
+    static func setLastSortId(_ value: UInt64, label: String, transaction: GRDBWriteTransaction) {
+        keyValueStore.setUInt64(value, key: label + ".lastSortId", transaction: transaction.asAnyWrite)
+    }
+
+    // The YDB snapshot that the checkpoints were written from.
+    static func ydbSnapshot(transaction: GRDBReadTransaction) -> UInt64? {
+        return keyValueStore.getUInt64("ydbSnapshot", transaction: transaction.asAnyRead)
+    }
+
+    static func setYdbSnapshot(_ value: UInt64, transaction: GRDBWriteTransaction) {
+        keyValueStore.setUInt64(value, key: "ydbSnapshot", transaction: transaction.asAnyWrite)
+    }
+
+    static func removeAll(transaction: GRDBWriteTransaction) {
+        keyValueStore.removeAll(transaction: transaction.asAnyWrite)
+    }
+}
+
 // MARK: -
 
 @objc
@@ -551,7 +713,8 @@ public protocol GRDBMigrator {
 
     var count: UInt { get }
 
-    func migrate(grdbTransaction: GRDBWriteTransaction) throws
+    // Copies the records which haven't been migrated yet, a chunk at a time.
+    func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws
 }
 
 extension GRDBMigrator {
@@ -565,6 +728,78 @@ extension GRDBMigrator {
         }
         return maxSampleCount / count
     }
+
+    // The index of the first record to migrate.
+    //
+    // Migrators whose records have keys pass startIndexAfterKey, which
+    // finds the record after the last migrated key. YDB may have changed
+    // since that checkpoint was written, so positions aren't stable. If the
+    // last migrated key is gone, we start over; the records which were
+    // already migrated are then skipped (see recordExists()). Migrators
+    // whose records have no keys resume after the count they migrated.
+    func startIndex(storage: GRDBDatabaseStorageAdapter,
+                    startIndexAfterKey: ((String) -> Int?)?) throws -> Int {
+        let count = Int(self.count)
+        let (lastMigratedKey, migratedCount) = try storage.read { transaction in
+            return (YDBToGRDBMigrationCheckpoints.lastMigratedKey(label: self.label, transaction: transaction),
+                    YDBToGRDBMigrationCheckpoints.migratedCount(label: self.label, transaction: transaction))
+        }
+        guard let startIndexAfterKey = startIndexAfterKey else {
+            return min(count, migratedCount)
+        }
+        guard let lastKey = lastMigratedKey else {
+            return 0
+        }
+        guard let startIndex = startIndexAfterKey(lastKey) else {
+            Logger.warn("\(label): last migrated key is missing, starting over.")
+            return 0
+        }
+        return min(count, startIndex)
+    }
+
+    // Calls the block with successive ranges of the migrator's records,
+    // starting after its checkpoint. Each range is migrated in its own
+    // write transaction, which also advances the checkpoint.
+    //
+    // The block returns the key of the last record in the range, if any.
+    func migrateInChunks(chunkSize: Int = 1000,
+                         storage: GRDBDatabaseStorageAdapter,
+                         startIndexAfterKey: ((String) -> Int?)?,
+                         block: @escaping (Range<Int>, GRDBWriteTransaction) throws -> String?) throws {
+        let count = Int(self.count)
+        var startIndex = try self.startIndex(storage: storage, startIndexAfterKey: startIndexAfterKey)
+        if startIndex > 0 {
+            Logger.info("\(label): resuming after \(startIndex) of \(count)")
+        }
+        while startIndex < count {
+            let range = startIndex..<min(count, startIndex + chunkSize)
+            try storage.write { grdbTransaction in
+                let lastKey = try! block(range, grdbTransaction)
+                if let lastKey = lastKey {
+                    YDBToGRDBMigrationCheckpoints.setLastMigratedKey(lastKey,
+                                                                     label: self.label,
+                                                                     transaction: grdbTransaction)
+                }
+                YDBToGRDBMigrationCheckpoints.setMigratedCount(range.upperBound,
+                                                               label: self.label,
+                                                               transaction: grdbTransaction)
+            }
+            startIndex = range.upperBound
+        }
+    }
+
+    // A resumed migration can revisit records it already migrated,
+    // so it skips records that are already in GRDB rather than
+    // violating the uniqueness constraint on uniqueId.
+    func recordExists(_ model: SDSModel, transaction: GRDBReadTransaction) -> Bool {
+        let sql = "SELECT EXISTS ( SELECT 1 FROM \(model.sdsTableName) WHERE uniqueId = ? )"
+        do {
+            return try Bool.fetchOne(transaction.database, sql: sql, arguments: [model.uniqueId]) ?? false
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return false
+        }
+    }
 }
 
 // MARK: -
@@ -584,19 +819,24 @@ public class GRDBKeyValueStoreMigrator<T>: GRDBMigrator {
         return finder.count
     }
 
-    public func migrate(grdbTransaction: GRDBWriteTransaction) throws {
+    public func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws {
         let count = self.count
         Logger.info("\(label): \(count)")
         try Bench(title: label, memorySamplerRatio: memorySamplerRatio(count: count), logInProduction: true) { memorySampler in
             var recordCount = 0
-            try finder.enumerateLegacyKeysAndObjects { legacyKey, legacyObject in
-                recordCount += 1
-                if let legacyData = legacyObject as? Data {
-                    self.finder.store.setData(legacyData, key: legacyKey, transaction: grdbTransaction.asAnyWrite)
-                } else {
-                    self.finder.store.setObject(legacyObject, key: legacyKey, transaction: grdbTransaction.asAnyWrite)
+            // Setting a value replaces any earlier value, so revisiting keys is harmless.
+            try migrateInChunks(storage: storage,
+                                startIndexAfterKey: { self.finder.startIndex(afterKey: $0) }) { range, grdbTransaction in
+                try self.finder.enumerateLegacyKeysAndObjects(range: range, transaction: ydbTransaction) { legacyKey, legacyObject in
+                    recordCount += 1
+                    if let legacyData = legacyObject as? Data {
+                        self.finder.store.setData(legacyData, key: legacyKey, transaction: grdbTransaction.asAnyWrite)
+                    } else {
+                        self.finder.store.setObject(legacyObject, key: legacyKey, transaction: grdbTransaction.asAnyWrite)
+                    }
+                    memorySampler.sample()
                 }
-                memorySampler.sample()
+                return self.finder.keys[range].last
             }
             Logger.info("Completed with recordCount: \(recordCount)")
         }
@@ -609,6 +849,9 @@ public class GRDBUnorderedRecordMigrator<T>: GRDBMigrator where T: SDSModel {
     public let label: String
     private let finder: LegacyUnorderedFinder<T>
 
+    private var signalRecipientUuids = Set<String>()
+    private var signalRecipientPhoneNumbers = Set<String>()
+
     init(label: String, ydbTransaction: YapDatabaseReadTransaction) {
         self.label = "Migrate \(label)"
         self.finder = LegacyUnorderedFinder(transaction: ydbTransaction)
@@ -618,54 +861,78 @@ public class GRDBUnorderedRecordMigrator<T>: GRDBMigrator where T: SDSModel {
         return finder.count
     }
 
-    public func migrate(grdbTransaction: GRDBWriteTransaction) throws {
+    public func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws {
         let count = self.count
         Logger.info("\(label): \(count)")
 
-        var signalRecipientUuids = Set<String>()
-        var signalRecipientPhoneNumbers = Set<String>()
+        if T.self == SignalRecipient.self {
+            // If we're resuming, we need to know which recipients
+            // were already migrated in order to de-duplicate.
+            let startIndex = try self.startIndex(storage: storage,
+                                                 startIndexAfterKey: { self.finder.startIndex(afterKey: $0) })
+            try finder.enumerateLegacyKeysAndObjects(range: 0..<startIndex, transaction: ydbTransaction) { (_, legacyRecord) in
+                _ = self.shouldMigrate(legacyRecord: legacyRecord)
+            }
+        }
+
         try Bench(title: label, memorySamplerRatio: memorySamplerRatio(count: count), logInProduction: true) { memorySampler in
             var recordCount = 0
-            try finder.enumerateLegacyKeysAndObjects { (_, legacyRecord) in
-
-                // SignalRecipients have GRDB uniqueness constraints on the
-                // phone number and uuid columns. Therefore we need to
-                // de-duplicate during the migration or migration will fail.
-                if let signalRecipient = legacyRecord as? SignalRecipient {
-                    if let uuidString = signalRecipient.recipientUUID,
-                        signalRecipientUuids.contains(uuidString) {
-                        // If YDB contains two recipients with the same UUID, discard one.
-                        Logger.warn("Discarding duplicate SignalRecipient: \(uuidString)")
+            try migrateInChunks(storage: storage,
+                                startIndexAfterKey: { self.finder.startIndex(afterKey: $0) }) { range, grdbTransaction in
+                try self.finder.enumerateLegacyKeysAndObjects(range: range, transaction: ydbTransaction) { (_, legacyRecord) in
+                    guard !self.recordExists(legacyRecord, transaction: grdbTransaction) else {
+                        // Already migrated records still count towards de-duplication.
+                        _ = self.shouldMigrate(legacyRecord: legacyRecord)
                         return
                     }
-                    if let phoneNumber = signalRecipient.recipientPhoneNumber,
-                        signalRecipientPhoneNumbers.contains(phoneNumber) {
-                        // If YDB contains two recipients with the same phone, try to
-                        // discard just the phone number. If the recipient has a uuid,
-                        // we can preserve it. If not, discard the recipient.
-                        if signalRecipient.recipientUUID == nil {
-                            Logger.warn("Discarding duplicate SignalRecipient: \(phoneNumber)")
-                            return
-                        } else {
-                            Logger.warn("Discarding duplicate SignalRecipient phone number: \(phoneNumber)")
-                            signalRecipient.removePhoneNumberForDatabaseMigration()
-                        }
-                    }
-                    if let uuidString = signalRecipient.recipientUUID {
-                        signalRecipientUuids.insert(uuidString)
-                    }
-                    if let phoneNumber = signalRecipient.recipientPhoneNumber {
-                        signalRecipientPhoneNumbers.insert(phoneNumber)
+                    guard self.shouldMigrate(legacyRecord: legacyRecord) else {
+                        return
                     }
-                }
 
-                recordCount += 1
-                legacyRecord.anyInsert(transaction: grdbTransaction.asAnyWrite)
-                memorySampler.sample()
+                    recordCount += 1
+                    legacyRecord.anyInsert(transaction: grdbTransaction.asAnyWrite)
+                    memorySampler.sample()
+                }
+                return self.finder.keys[range].last
             }
             Logger.info("Completed with recordCount: \(recordCount)")
         }
     }
+
+    private func shouldMigrate(legacyRecord: T) -> Bool {
+        // SignalRecipients have GRDB uniqueness constraints on the
+        // phone number and uuid columns. Therefore we need to
+        // de-duplicate during the migration or migration will fail.
+        guard let signalRecipient = legacyRecord as? SignalRecipient else {
+            return true
+        }
+        if let uuidString = signalRecipient.recipientUUID,
+            signalRecipientUuids.contains(uuidString) {
+            // If YDB contains two recipients with the same UUID, discard one.
+            Logger.warn("Discarding duplicate SignalRecipient: \(uuidString)")
+            return false
+        }
+        if let phoneNumber = signalRecipient.recipientPhoneNumber,
+            signalRecipientPhoneNumbers.contains(phoneNumber) {
+            // If YDB contains two recipients with the same phone, try to
+            // discard just the phone number. If the recipient has a uuid,
+            // we can preserve it. If not, discard the recipient.
+            if signalRecipient.recipientUUID == nil {
+                Logger.warn("Discarding duplicate SignalRecipient: \(phoneNumber)")
+                return false
+            } else {
+                Logger.warn("Discarding duplicate SignalRecipient phone number: \(phoneNumber)")
+                signalRecipient.removePhoneNumberForDatabaseMigration()
+            }
+        }
+        if let uuidString = signalRecipient.recipientUUID {
+            signalRecipientUuids.insert(uuidString)
+        }
+        if let phoneNumber = signalRecipient.recipientPhoneNumber {
+            signalRecipientPhoneNumbers.insert(phoneNumber)
+        }
+        return true
+    }
 }
 
 // MARK: -
@@ -683,15 +950,22 @@ public class GRDBJobRecordMigrator: GRDBMigrator {
         return finder.count
     }
 
-    public func migrate(grdbTransaction: GRDBWriteTransaction) throws {
+    public func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws {
         let count = self.count
         Logger.info("\(label): \(count)")
         try Bench(title: label, memorySamplerRatio: memorySamplerRatio(count: count), logInProduction: true) { memorySampler in
             var recordCount = 0
-            try finder.enumerateJobRecords { legacyRecord in
-                recordCount += 1
-                legacyRecord.anyInsert(transaction: grdbTransaction.asAnyWrite)
-                memorySampler.sample()
+            try migrateInChunks(storage: storage,
+                                startIndexAfterKey: { self.finder.startIndex(afterKey: $0) }) { range, grdbTransaction in
+                try self.finder.enumerateJobRecords(range: range, transaction: ydbTransaction) { legacyRecord in
+                    guard !self.recordExists(legacyRecord, transaction: grdbTransaction) else {
+                        return
+                    }
+                    recordCount += 1
+                    legacyRecord.anyInsert(transaction: grdbTransaction.asAnyWrite)
+                    memorySampler.sample()
+                }
+                return self.finder.keys[range].last
             }
             Logger.info("Completed with recordCount: \(recordCount)")
         }
@@ -713,41 +987,58 @@ public class GRDBInteractionMigrator: GRDBMigrator {
         return finder.count
     }
 
-    public func migrate(grdbTransaction: GRDBWriteTransaction) throws {
+    public func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws {
         let count = self.count
         Logger.info("\(label): \(count)")
-        var prevSortId: UInt64?
+        // If we're resuming, continue from the last sort id we assigned.
+        var prevSortId: UInt64? = try storage.read { transaction in
+            return YDBToGRDBMigrationCheckpoints.lastSortId(label: self.label, transaction: transaction)
+        }
         try Bench(title: label, memorySamplerRatio: memorySamplerRatio(count: count), logInProduction: true) { memorySampler in
             var recordCount = 0
             // This must enumerate the interactions in ascending order of sort id.
-            try finder.enumerateLegacyKeysAndObjects { (_, interaction) in
-
-                // Ensure all interactions have valid, monotonically increasing sort ids.
-                let minSortId: UInt64
-                if let previousSortId = prevSortId {
-                    minSortId = previousSortId + 1
-                } else {
-                    minSortId = 1
-                }
-                let sortId: UInt64
-                if interaction.sortId >= minSortId {
-                    // Interaction already has valid sort id.
-                    sortId = interaction.sortId
-                } else {
-                    if interaction.sortId > 0 {
-                        owsFailDebug("Replacing invalid sort id: \(interaction.sortId) -> \(minSortId)")
+            var lastKey: String?
+            try migrateInChunks(storage: storage,
+                                startIndexAfterKey: { key in
+                                    self.finder.startIndex(afterKey: key, transaction: ydbTransaction)
+                                }) { range, grdbTransaction in
+                try self.finder.enumerateLegacyKeysAndObjects(range: range, transaction: ydbTransaction) { (uniqueId, interaction) in
+                    lastKey = uniqueId
+                    guard !self.recordExists(interaction, transaction: grdbTransaction) else {
+                        return
+                    }
+
+                    // Ensure all interactions have valid, monotonically increasing sort ids.
+                    let minSortId: UInt64
+                    if let previousSortId = prevSortId {
+                        minSortId = previousSortId + 1
                     } else {
-                        owsFailDebug("Setting missing sort id: \(minSortId)")
+                        minSortId = 1
                     }
-                    // NOTE: "replaced" sort ids will not be written to YDB.
-                    interaction.replaceSortId(minSortId)
-                    sortId = minSortId
-                }
-                prevSortId = sortId
+                    let sortId: UInt64
+                    if interaction.sortId >= minSortId {
+                        // Interaction already has valid sort id.
+                        sortId = interaction.sortId
+                    } else {
+                        if interaction.sortId > 0 {
+                            owsFailDebug("Replacing invalid sort id: \(interaction.sortId) -> \(minSortId)")
+                        } else {
+                            owsFailDebug("Setting missing sort id: \(minSortId)")
+                        }
+                        // NOTE: "replaced" sort ids will not be written to YDB.
+                        interaction.replaceSortId(minSortId)
+                        sortId = minSortId
+                    }
+                    prevSortId = sortId
 
-                interaction.anyInsert(transaction: grdbTransaction.asAnyWrite)
-                recordCount += 1
-                memorySampler.sample()
+                    interaction.anyInsert(transaction: grdbTransaction.asAnyWrite)
+                    recordCount += 1
+                    memorySampler.sample()
+                }
+                if let prevSortId = prevSortId {
+                    YDBToGRDBMigrationCheckpoints.setLastSortId(prevSortId, label: self.label, transaction: grdbTransaction)
+                }
+                return lastKey
             }
             Logger.info("Completed with recordCount: \(recordCount)")
         }
@@ -769,20 +1060,27 @@ public class GRDBDecryptJobMigrator: GRDBMigrator {
         return finder.count
     }
 
-    public func migrate(grdbTransaction: GRDBWriteTransaction) throws {
+    public func migrate(ydbTransaction: YapDatabaseReadTransaction, storage: GRDBDatabaseStorageAdapter) throws {
         let count = self.count
         Logger.info("\(label): \(count)")
         try Bench(title: label, memorySamplerRatio: memorySamplerRatio(count: count), logInProduction: true) { memorySampler in
             var recordCount = 0
-            try finder.enumerateJobRecords { legacyJob in
-                let newJob = SSKMessageDecryptJobRecord(
-                    envelopeData: legacyJob.envelopeData,
-                    serverDeliveryTimestamp: 0,
-                    label: SSKMessageDecryptJobQueue.jobRecordLabel
-                )
-                newJob.anyInsert(transaction: grdbTransaction.asAnyWrite)
-                recordCount += 1
-                memorySampler.sample()
+            // The legacy finder can't enumerate a range of the jobs,
+            // so they're migrated in a single chunk.
+            try migrateInChunks(chunkSize: Int(count),
+                                storage: storage,
+                                startIndexAfterKey: nil) { _, grdbTransaction in
+                try self.finder.enumerateJobRecords(transaction: ydbTransaction) { legacyJob in
+                    let newJob = SSKMessageDecryptJobRecord(
+                        envelopeData: legacyJob.envelopeData,
+                        serverDeliveryTimestamp: 0,
+                        label: SSKMessageDecryptJobQueue.jobRecordLabel
+                    )
+                    newJob.anyInsert(transaction: grdbTransaction.asAnyWrite)
+                    recordCount += 1
+                    memorySampler.sample()
+                }
+                return nil
             }
             Logger.info("Completed with recordCount: \(recordCount)")
         }
@@ -66,7 +66,11 @@ public extension GroupV2Params {
         return ciphertext
     }
 
-    private static let decryptedBlobCache = NSCache<NSData, NSData>()
+    private static let decryptedBlobCache: NSCache<NSData, NSData> = {
+        let cache = NSCache<NSData, NSData>()
+        cache.countLimit = 1024
+        return cache
+    }()
     private static let decryptedBlobCacheMaxItemSize: UInt = 4 * 1024
 
     fileprivate func decryptBlob(_ ciphertext: Data) throws -> Data {
@@ -90,7 +94,16 @@ public extension GroupV2Params {
         return try uuid(forUuidCiphertext: uuidCiphertext)
     }
 
-    private static let decryptedUuidCache = NSCache<NSData, NSUUID>()
+    // These caches are keyed by the group secret params and the ciphertext.
+    // Unchanged members have the same ciphertexts in every snapshot of a
+    // group, so only new members are decrypted when we refetch its state.
+    //
+    // Large groups can have thousands of members.
+    private static let decryptedUuidCache: NSCache<NSData, NSUUID> = {
+        let cache = NSCache<NSData, NSUUID>()
+        cache.countLimit = 8 * 1024
+        return cache
+    }()
 
     func uuid(forUuidCiphertext uuidCiphertext: UuidCiphertext) throws -> UUID {
         let cacheKey = (groupSecretParamsData + uuidCiphertext.serialize().asData) as NSData
@@ -117,7 +130,11 @@ public extension GroupV2Params {
         return userId
     }
 
-    private static let decryptedProfileKeyCache = NSCache<NSData, NSData>()
+    private static let decryptedProfileKeyCache: NSCache<NSData, NSData> = {
+        let cache = NSCache<NSData, NSData>()
+        cache.countLimit = 8 * 1024
+        return cache
+    }()
 
     func profileKey(forProfileKeyCiphertext profileKeyCiphertext: ProfileKeyCiphertext,
                     uuid: UUID) throws -> Data {
@@ -136,6 +153,33 @@ public extension GroupV2Params {
         Self.decryptedProfileKeyCache.setObject(plaintext as NSData, forKey: cacheKey)
         return plaintext
     }
+
+    struct MemberCiphertexts {
+        let userId: Data
+        let profileKeyCiphertext: Data?
+    }
+
+    // Decrypting each member's ciphertexts takes about a millisecond, which
+    // adds up to seconds for large groups. This decrypts them across all
+    // cores, filling the caches so that callers can then decrypt each member
+    // in order, with their usual error handling, without waiting.
+    //
+    // Errors are ignored; callers will encounter them again.
+    func prefetchDecryptedMembers(_ members: [MemberCiphertexts]) {
+        // Small groups aren't worth dispatching.
+        guard members.count >= 16 else {
+            return
+        }
+        DispatchQueue.concurrentPerform(iterations: members.count) { index in
+            let member = members[index]
+            guard let uuid = try? self.uuid(forUserId: member.userId),
+                  let profileKeyCiphertextData = member.profileKeyCiphertext,
+                  let profileKeyCiphertext = try? ProfileKeyCiphertext(contents: [UInt8](profileKeyCiphertextData)) else {
+                return
+            }
+            _ = try? self.profileKey(forProfileKeyCiphertext: profileKeyCiphertext, uuid: uuid)
+        }
+    }
 }
 
 // MARK: -
@@ -357,7 +357,7 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
         guard groupThread.groupModel.groupsVersion == .V2 else {
             throw OWSAssertionError("Invalid groupsVersion.")
         }
-        let changedGroupModel = try GroupsV2Changes.applyChangesToGroupModel(groupThread: groupThread,
+        let changedGroupModel = try GroupsV2Changes.applyChangesToGroupModel(groupThread.groupModel,
                                                                              changeActionsProto: changeActionsProto,
                                                                              downloadedAvatars: downloadedAvatars,
                                                                              transaction: transaction)
@@ -560,13 +560,17 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
             }
             let groupV2Params = try oldGroupModel.groupV2Params()
 
-            var groupThread = oldGroupThread
-
             if groupChanges.count < 1 {
                 Logger.verbose("No group changes.")
-                return groupThread
+                return oldGroupThread
             }
 
+            // Catching up can involve hundreds of changes. Rather than writing
+            // the group model for each, we apply them in memory and write the
+            // result once, along with each change's info message.
+            var groupModel = oldGroupModel
+            var groupThreadUpdates = [GroupManager.GroupThreadUpdate]()
+
             var shouldUpdateProfileKeyInGroup = false
             var profileKeysByUuid = [UUID: Data]()
             for (index, groupChange) in groupChanges.enumerated() {
@@ -577,7 +581,7 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
                         Logger.info("Ignoring group change: \(changeRevision); only updating to revision: \(upToRevision)")
 
                         // Enqueue an update to latest.
-                        self.tryToRefreshV2GroupUpToCurrentRevisionAfterMessageProcessingWithThrottling(groupThread)
+                        self.tryToRefreshV2GroupUpToCurrentRevisionAfterMessageProcessingWithThrottling(oldGroupThread)
 
                         break
                     }
@@ -591,9 +595,7 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
                     throw OWSAssertionError("Missing changeAuthorUuid.")
                 }
 
-                guard let oldGroupModel = groupThread.groupModel as? TSGroupModelV2 else {
-                    throw OWSAssertionError("Invalid group model.")
-                }
+                let oldGroupModel = groupModel
 
                 let isSingleRevisionUpdate = oldGroupModel.revision + 1 == changeRevision
                 var groupUpdateSourceAddress: SignalServiceAddress?
@@ -629,18 +631,20 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
                     }
                 }
 
-                let newGroupModel: TSGroupModel
+                let newGroupModel: TSGroupModelV2
                 let newDisappearingMessageToken: DisappearingMessageToken?
                 let newProfileKeys: [UUID: Data]
 
                 if let snapshot = groupChange.snapshot {
-                    let builder = try TSGroupModelBuilder.builderForSnapshot(groupV2Snapshot: snapshot,
+                    var builder = try TSGroupModelBuilder.builderForSnapshot(groupV2Snapshot: snapshot,
                                                                              transaction: transaction)
-                    newGroupModel = try builder.build(transaction: transaction)
+                    // The database doesn't reflect the changes applied so far.
+                    builder.droppedMembers = oldGroupModel.droppedMembers
+                    newGroupModel = try builder.buildAsV2(transaction: transaction)
                     newDisappearingMessageToken = snapshot.disappearingMessageToken
                     newProfileKeys = snapshot.profileKeys
                 } else {
-                    let changedGroupModel = try GroupsV2Changes.applyChangesToGroupModel(groupThread: groupThread,
+                    let changedGroupModel = try GroupsV2Changes.applyChangesToGroupModel(oldGroupModel,
                                                                                          changeActionsProto: changeActionsProto,
                                                                                          downloadedAvatars: diff.downloadedAvatars,
                                                                                          transaction: transaction)
@@ -673,10 +677,13 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
                     }
                 }
 
-                groupThread = try GroupManager.updateExistingGroupThreadInDatabaseAndCreateInfoMessage(newGroupModel: newGroupModel,
-                                                                                                       newDisappearingMessageToken: newDisappearingMessageToken,
-                                                                                                       groupUpdateSourceAddress: groupUpdateSourceAddress,
-                                                                                                       transaction: transaction).groupThread
+                groupThreadUpdates.append(GroupManager.GroupThreadUpdate(newGroupModel: newGroupModel,
+                                                                         newDisappearingMessageToken: newDisappearingMessageToken,
+                                                                         groupUpdateSourceAddress: groupUpdateSourceAddress))
+                // Stale changes are skipped when the updates are written.
+                if newGroupModel.revision >= groupModel.revision {
+                    groupModel = newGroupModel
+                }
 
                 // If the group state includes a stale profile key for the
                 // local user, schedule an update to fix that.
@@ -689,6 +696,12 @@ public class GroupV2UpdatesImpl: NSObject, GroupV2UpdatesSwift {
                 profileKeysByUuid = profileKeysByUuid.merging(newProfileKeys) { (_, latest) in latest }
             }
 
+            var groupThread = oldGroupThread
+            if !groupThreadUpdates.isEmpty {
+                groupThread = try GroupManager.updateExistingGroupThreadInDatabaseAndCreateInfoMessages(updates: groupThreadUpdates,
+                                                                                                        transaction: transaction).groupThread
+            }
+
             if shouldUpdateProfileKeyInGroup {
                 self.groupsV2.updateLocalProfileKeyInGroup(groupId: groupId, transaction: transaction)
             }
@@ -0,0 +1,256 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+import SignalServiceKit
+import ZKGroup
+
+// Every group service request is authenticated with a "temporal" auth
+// credential, which is only valid on its redemption day. The service
+// issues a window of them in a single request.
+//
+// This class serves credentials from memory, backed by the (encrypted)
+// database, so group requests usually needn't make a network request or
+// even a database read. It refreshes the window in the background before
+// it runs low, so that the first group request of a day, or after a
+// reinstall, doesn't stall on a credential request.
+//
+// This class is thread-safe.
+class GroupsV2AuthCredentialManager: NSObject {
+
+    typealias AuthCredentialMap = [UInt32: AuthCredential]
+
+    // MARK: - Dependencies
+
+    private var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    private var networkManager: TSNetworkManager {
+        return SSKEnvironment.shared.networkManager
+    }
+
+    private var tsAccountManager: TSAccountManager {
+        return .shared()
+    }
+
+    // MARK: -
+
+    // The service issues at most a week of credentials after today.
+    private static let daysToFetch: UInt32 = 7
+    // Refresh the window in the background once it covers fewer days.
+    private static let minDaysRemaining: UInt32 = 3
+
+    private let authCredentialStore = SDSKeyValueStore(collection: "GroupsV2Impl.authCredentialStoreStore")
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    // nil until the credentials are loaded from the database.
+    private var authCredentialMap: AuthCredentialMap?
+    // Concurrent requests share a single fetch.
+    private var fetchPromise: Promise<AuthCredentialMap>?
+
+    override init() {
+        super.init()
+
+        AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+            self.prefetchCredentialsIfNecessary()
+        }
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(registrationStateDidChange),
+                                               name: .registrationStateDidChange,
+                                               object: nil)
+    }
+
+    @objc
+    private func registrationStateDidChange() {
+        AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+            self.prefetchCredentialsIfNecessary()
+        }
+    }
+
+    // MARK: -
+
+    func authCredential(localUuid: UUID) -> Promise<AuthCredential> {
+        let redemptionTime = Self.daysSinceEpoch
+        return firstly(on: .global()) { () -> Promise<AuthCredentialMap> in
+            let authCredentialMap = self.loadedAuthCredentialMap()
+            if authCredentialMap[redemptionTime] != nil {
+                self.prefetchCredentialsIfNecessary(authCredentialMap: authCredentialMap, localUuid: localUuid)
+                return Promise.value(authCredentialMap)
+            }
+            return self.fetchCredentials(localUuid: localUuid)
+        }.map(on: .global()) { (authCredentialMap: AuthCredentialMap) throws -> AuthCredential in
+            guard let authCredential = authCredentialMap[redemptionTime] else {
+                throw OWSAssertionError("No auth credential for redemption time.")
+            }
+            return authCredential
+        }
+    }
+
+    func clearCredentials(transaction: SDSAnyWriteTransaction) {
+        authCredentialStore.removeAll(transaction: transaction)
+        unfairLock.withLock {
+            authCredentialMap = [:]
+        }
+    }
+
+    private func prefetchCredentialsIfNecessary() {
+        guard tsAccountManager.isRegisteredAndReady,
+              let localUuid = tsAccountManager.localUuid else {
+            return
+        }
+        DispatchQueue.global().async {
+            self.prefetchCredentialsIfNecessary(authCredentialMap: self.loadedAuthCredentialMap(),
+                                                localUuid: localUuid)
+        }
+    }
+
+    private func prefetchCredentialsIfNecessary(authCredentialMap: AuthCredentialMap, localUuid: UUID) {
+        let today = Self.daysSinceEpoch
+        let daysRemaining = (today..<today + Self.minDaysRemaining).filter { authCredentialMap[$0] != nil }.count
+        guard daysRemaining < Self.minDaysRemaining else {
+            return
+        }
+        Logger.info("Prefetching auth credentials; days remaining: \(daysRemaining).")
+        fetchCredentials(localUuid: localUuid).catch { error in
+            Logger.warn("Could not prefetch auth credentials: \(error)")
+        }
+    }
+
+    // MARK: - Storage
+
+    private func loadedAuthCredentialMap() -> AuthCredentialMap {
+        if let authCredentialMap = unfairLock.withLock({ self.authCredentialMap }) {
+            return authCredentialMap
+        }
+
+        var authCredentialMap = AuthCredentialMap()
+        databaseStorage.read { transaction in
+            for key in self.authCredentialStore.allKeys(transaction: transaction) {
+                guard let redemptionTime = UInt32(key),
+                      let authCredentialData = self.authCredentialStore.getData(key, transaction: transaction) else {
+                    owsFailDebug("Invalid auth credential: \(key)")
+                    continue
+                }
+                do {
+                    authCredentialMap[redemptionTime] = try AuthCredential(contents: [UInt8](authCredentialData))
+                } catch {
+                    owsFailDebug("Error retrieving cached auth credential: \(error)")
+                }
+            }
+        }
+
+        return unfairLock.withLock {
+            // A fetch may have completed while we were loading.
+            if let existingMap = self.authCredentialMap {
+                return existingMap
+            }
+            self.authCredentialMap = authCredentialMap
+            return authCredentialMap
+        }
+    }
+
+    private func fetchCredentials(localUuid: UUID) -> Promise<AuthCredentialMap> {
+        let (promise, isNewFetch): (Promise<AuthCredentialMap>, Bool) = unfairLock.withLock {
+            if let fetchPromise = self.fetchPromise {
+                return (fetchPromise, false)
+            }
+            let fetchPromise = firstly {
+                self.retrieveCredentialsFromService(localUuid: localUuid)
+            }.map(on: .global()) { (authCredentialMap: AuthCredentialMap) -> AuthCredentialMap in
+                // Drop expired credentials.
+                let today = Self.daysSinceEpoch
+                let authCredentialMap = authCredentialMap.filter { $0.key >= today }
+                self.databaseStorage.write { transaction in
+                    self.authCredentialStore.removeAll(transaction: transaction)
+                    for (redemptionTime, authCredential) in authCredentialMap {
+                        self.authCredentialStore.setData(authCredential.serialize().asData,
+                                                         key: "\(redemptionTime)",
+                                                         transaction: transaction)
+                    }
+                }
+                self.unfairLock.withLock {
+                    self.authCredentialMap = authCredentialMap
+                }
+                return authCredentialMap
+            }
+            self.fetchPromise = fetchPromise
+            return (fetchPromise, true)
+        }
+        if isNewFetch {
+            promise.ensure(on: .global()) {
+                self.unfairLock.withLock {
+                    self.fetchPromise = nil
+                }
+            }.cauterize()
+        }
+        return promise
+    }
+
+    // MARK: - Network
+
+    private func retrieveCredentialsFromService(localUuid: UUID) -> Promise<AuthCredentialMap> {
+        let today = Self.daysSinceEpoch
+        let request = OWSRequestFactory.groupAuthenticationCredentialRequest(fromRedemptionDays: today,
+                                                                             toRedemptionDays: today + Self.daysToFetch)
+        return firstly {
+            networkManager.makePromise(request: request)
+        }.map(on: .global()) { (_: URLSessionDataTask, responseObject: Any?) -> AuthCredentialMap in
+            let temporalCredentials = try Self.parseCredentialResponse(responseObject: responseObject)
+            let localZKGUuid = try localUuid.asZKGUuid()
+            let serverPublicParams = try GroupsV2Protos.serverPublicParams()
+            let clientZkAuthOperations = ClientZkAuthOperations(serverPublicParams: serverPublicParams)
+            var credentialMap = AuthCredentialMap()
+            for temporalCredential in temporalCredentials {
+                // Verify the credentials.
+                let authCredential: AuthCredential = try clientZkAuthOperations.receiveAuthCredential(uuid: localZKGUuid,
+                                                                                                      redemptionTime: temporalCredential.redemptionTime,
+                                                                                                      authCredentialResponse: temporalCredential.authCredentialResponse)
+                credentialMap[temporalCredential.redemptionTime] = authCredential
+            }
+            return credentialMap
+        }
+    }
+
+    private struct TemporalCredential {
+        let redemptionTime: UInt32
+        let authCredentialResponse: AuthCredentialResponse
+    }
+
+    private static func parseCredentialResponse(responseObject: Any?) throws -> [TemporalCredential] {
+        guard let responseObject = responseObject else {
+            throw OWSAssertionError("Missing response.")
+        }
+
+        guard let params = ParamParser(responseObject: responseObject) else {
+            throw OWSAssertionError("invalid response: \(String(describing: responseObject))")
+        }
+        guard let credentials: [Any] = try params.required(key: "credentials") else {
+            throw OWSAssertionError("Missing or invalid credentials.")
+        }
+        var temporalCredentials = [TemporalCredential]()
+        for credential in credentials {
+            guard let credentialParser = ParamParser(responseObject: credential) else {
+                throw OWSAssertionError("invalid credential: \(String(describing: credential))")
+            }
+            guard let redemptionTime: UInt32 = try credentialParser.required(key: "redemptionTime") else {
+                throw OWSAssertionError("Missing or invalid redemptionTime.")
+            }
+            let responseData: Data = try credentialParser.requiredBase64EncodedData(key: "credential")
+            let response = try AuthCredentialResponse(contents: [UInt8](responseData))
+
+            temporalCredentials.append(TemporalCredential(redemptionTime: redemptionTime, authCredentialResponse: response))
+        }
+        return temporalCredentials
+    }
+
+    // MARK: -
+
+    private static var daysSinceEpoch: UInt32 {
+        let msSinceEpoch = NSDate.ows_millisecondTimeStamp()
+        return UInt32(msSinceEpoch / kDayInMs)
+    }
+}
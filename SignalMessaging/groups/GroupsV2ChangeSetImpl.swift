@@ -358,10 +358,16 @@ public class GroupsV2ChangeSetImpl: NSObject, GroupsV2ChangeSet {
         uuidsForProfileKeyCredentials.insert(localUuid)
         let addressesForProfileKeyCredentials: [SignalServiceAddress] = uuidsForProfileKeyCredentials.map { SignalServiceAddress(uuid: $0) }
 
+        // We fetch any missing credentials once, then use the credentials we
+        // have. Members we still lack a credential for are invited instead of
+        // added (see below), so that one member can't fail a bulk add.
         return firstly {
             groupsV2Impl.tryToEnsureProfileKeyCredentials(for: addressesForProfileKeyCredentials)
-        }.then(on: .global()) { (_) -> Promise<ProfileKeyCredentialMap> in
-            groupsV2Impl.loadProfileKeyCredentialData(for: Array(uuidsForProfileKeyCredentials))
+        }.recover(on: .global()) { (error: Error) -> Guarantee<Void> in
+            Logger.warn("Could not fetch profile key credentials: \(error)")
+            return Guarantee.value(())
+        }.map(on: .global()) { () -> ProfileKeyCredentialMap in
+            groupsV2Impl.loadKnownProfileKeyCredentials(for: Array(uuidsForProfileKeyCredentials))
         }.map(on: .global()) { (profileKeyCredentialMap: ProfileKeyCredentialMap) throws -> GroupsProtoGroupChangeActions in
             try self.buildGroupChangeProto(currentGroupModel: currentGroupModel,
                                            currentDisappearingMessageToken: currentDisappearingMessageToken,
@@ -506,10 +512,7 @@ public class GroupsV2ChangeSetImpl: NSObject, GroupsV2ChangeSet {
                 if role == .administrator {
                     remainingAdminUuids.insert(uuid)
                 }
-            } else {
-                guard let profileKeyCredential = profileKeyCredentialMap[uuid] else {
-                    throw OWSAssertionError("Missing profile key credential: \(uuid)")
-                }
+            } else if let profileKeyCredential = profileKeyCredentialMap[uuid] {
                 var actionBuilder = GroupsProtoGroupChangeActionsAddMemberAction.builder()
                 actionBuilder.setAdded(try GroupsV2Protos.buildMemberProto(profileKeyCredential: profileKeyCredential,
                                                                            role: role.asProtoRole,
@@ -521,6 +524,26 @@ public class GroupsV2ChangeSetImpl: NSObject, GroupsV2ChangeSet {
                 if role == .administrator {
                     remainingAdminUuids.insert(uuid)
                 }
+            } else if currentGroupMembership.isInvitedMember(uuid) {
+                // We couldn't get a profile key credential, so we can't
+                // promote this member; they remain invited.
+                Logger.warn("Missing profile key credential; leaving member invited: \(uuid)")
+                continue
+            } else {
+                // We couldn't get a profile key credential, e.g. because the
+                // user's profile key changed. Invite them instead.
+                Logger.warn("Missing profile key credential; inviting member: \(uuid)")
+                var actionBuilder = GroupsProtoGroupChangeActionsAddPendingMemberAction.builder()
+                actionBuilder.setAdded(try GroupsV2Protos.buildPendingMemberProto(uuid: uuid,
+                                                                                  role: role.asProtoRole,
+                                                                                  localUuid: localUuid,
+                                                                                  groupV2Params: groupV2Params))
+                actionsBuilder.addAddPendingMembers(try actionBuilder.build())
+
+                remainingMemberOfAnyKindUuids.insert(uuid)
+                if role == .administrator {
+                    remainingAdminUuids.insert(uuid)
+                }
             }
             didChange = true
         }
@@ -48,11 +48,14 @@ public class GroupsV2Changes {
     // This method applies a single set of "change actions" to a group
     // model, thereby deriving a new group model whose revision is
     // exactly 1 higher.
-    class func applyChangesToGroupModel(groupThread: TSGroupThread,
+    //
+    // The group model needn't be the one in the database, so that we
+    // can apply a sequence of changes before writing the result.
+    class func applyChangesToGroupModel(_ groupModel: TSGroupModel,
                                         changeActionsProto: GroupsProtoGroupChangeActions,
                                         downloadedAvatars: GroupV2DownloadedAvatars,
                                         transaction: SDSAnyReadTransaction) throws -> ChangedGroupModel {
-        guard let oldGroupModel = groupThread.groupModel as? TSGroupModelV2 else {
+        guard let oldGroupModel = groupModel as? TSGroupModelV2 else {
             throw OWSAssertionError("Invalid group model.")
         }
         guard !oldGroupModel.isPlaceholderModel else {
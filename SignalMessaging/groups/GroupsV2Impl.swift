@@ -841,7 +841,6 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
 
     // MARK: - Perform Request
 
-    private typealias AuthCredentialMap = [UInt32: AuthCredential]
     private typealias RequestBuilder = (AuthCredential) throws -> Promise<GroupsV2Request>
 
     // Represents how we should respond to 403 status codes.
@@ -1071,25 +1070,9 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
     public func loadProfileKeyCredentialData(for uuids: [UUID]) -> Promise<ProfileKeyCredentialMap> {
 
         // 1. Use known credentials, where possible.
-        var credentialMap = ProfileKeyCredentialMap()
+        var credentialMap = loadKnownProfileKeyCredentials(for: uuids)
 
-        var uuidsWithoutCredentials = [UUID]()
-        databaseStorage.read { transaction in
-            // Skip duplicates.
-            for uuid in Set(uuids) {
-                do {
-                    let address = SignalServiceAddress(uuid: uuid)
-                    if let credential = try self.versionedProfiles.profileKeyCredential(for: address,
-                                                                                        transaction: transaction) {
-                        credentialMap[uuid] = credential
-                        continue
-                    }
-                } catch {
-                    owsFailDebug("Error: \(error)")
-                }
-                uuidsWithoutCredentials.append(uuid)
-            }
-        }
+        let uuidsWithoutCredentials = Set(uuids).subtracting(credentialMap.keys)
 
         // If we already have credentials for all members, no need to fetch.
         guard uuidsWithoutCredentials.count > 0 else {
@@ -1097,22 +1080,15 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
         }
 
         // 2. Fetch missing credentials.
-        var promises = [Promise<UUID>]()
-        for uuid in uuidsWithoutCredentials {
-            let address = SignalServiceAddress(uuid: uuid)
-            let promise = ProfileFetcherJob.fetchProfilePromise(address: address,
-                                                                mainAppOnly: false,
-                                                                ignoreThrottling: true,
-                                                                fetchType: .versioned)
-                .map(on: .global()) { (_: SignalServiceProfile) -> (UUID) in
-                    // Ideally we'd pull the credential off of SignalServiceProfile here,
-                    // but the credential response needs to be parsed and verified
-                    // which requires the VersionedProfileRequest.
-                    return uuid
-            }
-            promises.append(promise)
-        }
-        return when(fulfilled: promises)
+        //
+        // Ideally we'd pull the credentials off of the SignalServiceProfiles here,
+        // but the credential response needs to be parsed and verified
+        // which requires the VersionedProfileRequest.
+        let addresses = uuidsWithoutCredentials.map { SignalServiceAddress(uuid: $0) }
+        return ProfileFetchScheduler.shared.fetchProfiles(addresses: addresses,
+                                                          mainAppOnly: false,
+                                                          ignoreThrottling: true,
+                                                          fetchType: .versioned)
             .map(on: .global()) { _ in
                 // Since we've just successfully fetched versioned profiles
                 // for all of the UUIDs without credentials, we _should_ be
@@ -1135,6 +1111,27 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
         }
     }
 
+    // Unlike loadProfileKeyCredentialData(), this doesn't fetch missing
+    // credentials. Members without a credential are omitted.
+    public func loadKnownProfileKeyCredentials(for uuids: [UUID]) -> ProfileKeyCredentialMap {
+        var credentialMap = ProfileKeyCredentialMap()
+        databaseStorage.read { transaction in
+            // Skip duplicates.
+            for uuid in Set(uuids) {
+                do {
+                    let address = SignalServiceAddress(uuid: uuid)
+                    if let credential = try self.versionedProfiles.profileKeyCredential(for: address,
+                                                                                        transaction: transaction) {
+                        credentialMap[uuid] = credential
+                    }
+                } catch {
+                    owsFailDebug("Error: \(error)")
+                }
+            }
+        }
+        return credentialMap
+    }
+
     public func hasProfileKeyCredential(for address: SignalServiceAddress,
                                         transaction: SDSAnyReadTransaction) -> Bool {
         do {
@@ -1181,127 +1178,23 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
             return Promise.value(())
         }
 
-        var promises = [Promise<SignalServiceProfile>]()
-        for uuid in uuidsWithoutProfileKeyCredentials {
-            let address = SignalServiceAddress(uuid: uuid)
-            promises.append(ProfileFetcherJob.fetchProfilePromise(address: address,
-                                                                  mainAppOnly: false,
-                                                                  ignoreThrottling: true,
-                                                                  fetchType: .versioned))
-        }
-        return when(fulfilled: promises).asVoid()
+        let addressesWithoutCredentials = uuidsWithoutProfileKeyCredentials.map { SignalServiceAddress(uuid: $0) }
+        return ProfileFetchScheduler.shared.fetchProfiles(addresses: addressesWithoutCredentials,
+                                                          mainAppOnly: false,
+                                                          ignoreThrottling: true,
+                                                          fetchType: .versioned)
     }
 
     // MARK: - Auth Credentials
 
-    private let authCredentialStore = SDSKeyValueStore(collection: "GroupsV2Impl.authCredentialStoreStore")
+    private let authCredentialManager = GroupsV2AuthCredentialManager()
 
     private func ensureTemporalCredentials(localUuid: UUID) -> Promise<AuthCredential> {
-        let redemptionTime = self.daysSinceEpoch
-
-        let authCredentialCacheKey = { (redemptionTime: UInt32) -> String in
-            return "\(redemptionTime)"
-        }
-
-        return firstly(on: .global()) { () -> AuthCredential? in
-            do {
-                let data = self.databaseStorage.read { (transaction) -> Data? in
-                    let key = authCredentialCacheKey(redemptionTime)
-                    return self.authCredentialStore.getData(key, transaction: transaction)
-                }
-                guard let authCredentialData = data else {
-                    return nil
-                }
-                return try AuthCredential(contents: [UInt8](authCredentialData))
-            } catch {
-                owsFailDebug("Error retrieving cached auth credential: \(error)")
-                return nil
-            }
-        }.then(on: .global()) { (cachedAuthCredential: AuthCredential?) throws -> Promise<AuthCredential> in
-            if let cachedAuthCredential = cachedAuthCredential {
-                return Promise.value(cachedAuthCredential)
-            }
-            return firstly {
-                self.retrieveTemporalCredentialsFromService(localUuid: localUuid)
-            }.map(on: .global()) { (authCredentialMap: AuthCredentialMap) throws -> AuthCredential in
-                self.databaseStorage.write { transaction in
-                    // Remove stale auth credentials.
-                    self.authCredentialStore.removeAll(transaction: transaction)
-                    // Store new auth credentials.
-                    for (authTime, authCredential) in authCredentialMap {
-                        let key = authCredentialCacheKey(authTime)
-                        let value = authCredential.serialize().asData
-                        self.authCredentialStore.setData(value, key: key, transaction: transaction)
-                    }
-                }
-                guard let authCredential = authCredentialMap[redemptionTime] else {
-                    throw OWSAssertionError("No auth credential for redemption time.")
-                }
-                return authCredential
-            }
-        }
+        authCredentialManager.authCredential(localUuid: localUuid)
     }
 
     private func clearTemporalCredentials(transaction: SDSAnyWriteTransaction) {
-        // Remove stale auth credentials.
-        self.authCredentialStore.removeAll(transaction: transaction)
-    }
-
-    private func retrieveTemporalCredentialsFromService(localUuid: UUID) -> Promise<AuthCredentialMap> {
-
-        let today = self.daysSinceEpoch
-        let todayPlus7 = today + 7
-        let request = OWSRequestFactory.groupAuthenticationCredentialRequest(fromRedemptionDays: today,
-                                                                             toRedemptionDays: todayPlus7)
-        return firstly {
-            networkManager.makePromise(request: request)
-        }.map(on: .global()) { (_: URLSessionDataTask, responseObject: Any?) -> AuthCredentialMap in
-            let temporalCredentials = try self.parseCredentialResponse(responseObject: responseObject)
-            let localZKGUuid = try localUuid.asZKGUuid()
-            let serverPublicParams = try GroupsV2Protos.serverPublicParams()
-            let clientZkAuthOperations = ClientZkAuthOperations(serverPublicParams: serverPublicParams)
-            var credentialMap = AuthCredentialMap()
-            for temporalCredential in temporalCredentials {
-                // Verify the credentials.
-                let authCredential: AuthCredential = try clientZkAuthOperations.receiveAuthCredential(uuid: localZKGUuid,
-                                                                                                      redemptionTime: temporalCredential.redemptionTime,
-                                                                                                      authCredentialResponse: temporalCredential.authCredentialResponse)
-                credentialMap[temporalCredential.redemptionTime] = authCredential
-            }
-            return credentialMap
-        }
-    }
-
-    private struct TemporalCredential {
-        let redemptionTime: UInt32
-        let authCredentialResponse: AuthCredentialResponse
-    }
-
-    private func parseCredentialResponse(responseObject: Any?) throws -> [TemporalCredential] {
-        guard let responseObject = responseObject else {
-            throw OWSAssertionError("Missing response.")
-        }
-
-        guard let params = ParamParser(responseObject: responseObject) else {
-            throw OWSAssertionError("invalid response: \(String(describing: responseObject))")
-        }
-        guard let credentials: [Any] = try params.required(key: "credentials") else {
-            throw OWSAssertionError("Missing or invalid credentials.")
-        }
-        var temporalCredentials = [TemporalCredential]()
-        for credential in credentials {
-            guard let credentialParser = ParamParser(responseObject: credential) else {
-                throw OWSAssertionError("invalid credential: \(String(describing: credential))")
-            }
-            guard let redemptionTime: UInt32 = try credentialParser.required(key: "redemptionTime") else {
-                throw OWSAssertionError("Missing or invalid redemptionTime.")
-            }
-            let responseData: Data = try credentialParser.requiredBase64EncodedData(key: "credential")
-            let response = try AuthCredentialResponse(contents: [UInt8](responseData))
-
-            temporalCredentials.append(TemporalCredential(redemptionTime: redemptionTime, authCredentialResponse: response))
-        }
-        return temporalCredentials
+        authCredentialManager.clearCredentials(transaction: transaction)
     }
 
     // MARK: - Change Set
@@ -2172,12 +2065,6 @@ public class GroupsV2Impl: NSObject, GroupsV2Swift {
 
     // MARK: - Utils
 
-    private var daysSinceEpoch: UInt32 {
-        let msSinceEpoch = NSDate.ows_millisecondTimeStamp()
-        let daysSinceEpoch = UInt32(msSinceEpoch / kDayInMs)
-        return daysSinceEpoch
-    }
-
     private func uuids(for addresses: [SignalServiceAddress]) -> [UUID] {
         var uuids = [UUID]()
         for address in addresses {
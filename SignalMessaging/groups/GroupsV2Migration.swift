@@ -176,88 +176,17 @@ public extension GroupsV2Migration {
             return
         }
 
-        DispatchQueue.global().async {
-            var groupThreads = [TSGroupThread]()
-            Self.databaseStorage.read { transaction in
-                TSGroupThread.anyEnumerate(transaction: transaction) { (thread, _) in
-                    guard let groupThread = thread as? TSGroupThread else {
-                        return
-                    }
-                    guard groupThread.isGroupV1Thread else {
-                        return
-                    }
-                    groupThreads.append(groupThread)
-                }
-            }
-
-            var phoneNumbersWithoutUuids = Set<String>()
-            for groupThread in groupThreads {
-                // We want to fill in missing UUIDs for all members including
-                // "dropped" members.
-                let groupMembers = (groupThread.groupModel.groupMembership.allMembersOfAnyKind +
-                                        groupThread.groupModel.getDroppedMembers)
-                for address in groupMembers {
-                    guard address.uuid == nil else {
-                        continue
-                    }
-                    guard let phoneNumber = address.phoneNumber else {
-                        owsFailDebug("Missing phone number.")
-                        continue
-                    }
-                    phoneNumbersWithoutUuids.insert(phoneNumber)
-                }
-            }
-
-            let migrationMode: GroupsV2MigrationMode = (GroupManager.canAutoMigrate
-                                                            ? self.autoMigrationMode
-                                                            : .possiblyAlreadyMigratedOnService)
-
-            // Check up to N groups on every launch.
-            let maxCheckCount: Int = 50
-            if shouldLimitBatchSize, groupThreads.count > maxCheckCount {
-                groupThreads.shuffle()
-                groupThreads = Array(groupThreads.prefix(upTo: maxCheckCount))
-            }
-
-            firstly(on: .global()) { () -> Promise<Void> in
-                guard !phoneNumbersWithoutUuids.isEmpty else {
-                    return Promise.value(())
-                }
-                return ContactDiscoveryTask(phoneNumbers: phoneNumbersWithoutUuids).perform().asVoid()
-            }.recover(on: .global()) { (error: Error) -> Promise<Void> in
-                owsFailDebugUnlessNetworkFailure(error)
-                return Promise.value(())
-            }.map(on: .global()) { _ in
-                Logger.verbose("")
-
-                for groupThread in groupThreads {
-                    firstly {
-                        Self.tryToMigrate(groupThread: groupThread, migrationMode: migrationMode)
-                    }.done(on: .global()) { _ in
-                        Logger.verbose("")
-                    }.catch(on: .global()) { error in
-                        if case GroupsV2Error.groupDoesNotExistOnService = error {
-                            if migrationMode != .possiblyAlreadyMigratedOnService {
-                                Logger.warn("Error: \(error)")
-                            }
-                        } else if case GroupsV2Error.localUserNotInGroup = error {
-                            if !migrationMode.isAutoMigration {
-                                Logger.warn("Error: \(error)")
-                            }
-                        } else if case GroupsV2Error.groupCannotBeMigrated = error {
-                            if !migrationMode.isAutoMigration {
-                                Logger.warn("Error: \(error)")
-                            }
-                        } else if case GroupsV2Error.timeout = error {
-                            Logger.warn("Error: \(error)")
-                        } else {
-                            owsFailDebug("Error: \(error)")
-                        }
-                    }
-                }
-            }.catch(on: .global()) { error in
-                owsFailDebugUnlessNetworkFailure(error)
-            }
+        let migrationMode: GroupsV2MigrationMode = (GroupManager.canAutoMigrate
+                                                        ? self.autoMigrationMode
+                                                        : .possiblyAlreadyMigratedOnService)
+
+        firstly(on: .global()) { () -> Promise<BatchMigrationReport> in
+            Self.migrateAllGroups(migrationMode: migrationMode,
+                                  shouldLimitBatchSize: shouldLimitBatchSize)
+        }.done(on: .global()) { report in
+            Logger.info("Batch migration complete: \(report.logDescription)")
+        }.catch(on: .global()) { error in
+            owsFailDebugUnlessNetworkFailure(error)
         }
     }
 
@@ -296,21 +225,288 @@ public extension GroupsV2Migration {
     }
 }
 
+// MARK: - Batch Migrations
+
+fileprivate struct BatchMigrationReport {
+    var groupCount: Int = 0
+    var migratedCount: Int = 0
+    var profileFetchCount: Int = 0
+    // Errors are counted by category, e.g. "groupCannotBeMigrated".
+    var failureCounts = [String: Int]()
+
+    var failureCount: Int {
+        failureCounts.values.reduce(0, +)
+    }
+
+    var logDescription: String {
+        let failures = failureCounts.sorted { $0.key < $1.key }.map { "\($0.key): \($0.value)" }
+        return ("migrated \(migratedCount) of \(groupCount) groups, "
+                    + "fetched \(profileFetchCount) profiles, "
+                    + "failures: \(failureCount) [\(failures.joined(separator: ", "))]")
+    }
+}
+
 // MARK: -
 
 fileprivate extension GroupsV2Migration {
 
+    // Check up to N groups on every launch.
+    static let maxCheckCount: Int = 50
+    // Groups are migrated in batches. We prefetch the profiles (and hence
+    // the capabilities and profile key credentials) of all members of a batch
+    // before migrating it, so that members who belong to many groups are
+    // only fetched once.
+    static let batchSize: Int = 12
+
+    // Tries to migrate every v1 group, most active first.
+    static func migrateAllGroups(migrationMode: GroupsV2MigrationMode,
+                                 shouldLimitBatchSize: Bool) -> Promise<BatchMigrationReport> {
+        var groupThreads = loadGroupThreadsToMigrate(shouldLimitBatchSize: shouldLimitBatchSize)
+        var report = BatchMigrationReport()
+        report.groupCount = groupThreads.count
+        guard !groupThreads.isEmpty else {
+            return Promise.value(report)
+        }
+
+        Logger.info("Trying to migrate \(groupThreads.count) groups, mode: \(migrationMode).")
+
+        return firstly(on: .global()) { () -> Promise<Void> in
+            Self.discoverMissingUuids(groupThreads: groupThreads)
+        }.then(on: .global()) { () -> Promise<Void> in
+            guard !migrationMode.isOnlyUpdatingIfAlreadyMigrated else {
+                return Promise.value(())
+            }
+            // Every migration needs a profile key commitment for the local
+            // user. Ensure it once, up front, rather than letting the
+            // concurrent migrations race to do so.
+            return GroupManager.ensureLocalProfileHasCommitmentIfNecessary()
+        }.then(on: .global()) { () -> Promise<BatchMigrationReport> in
+            // Refresh the threads, which may have changed while
+            // discovering uuids.
+            groupThreads = Self.databaseStorage.read { transaction in
+                groupThreads.compactMap { groupThread in
+                    TSGroupThread.anyFetchGroupThread(uniqueId: groupThread.uniqueId, transaction: transaction)
+                }
+            }
+            return Self.migrateBatches(groupThreads: groupThreads[...],
+                                       migrationMode: migrationMode,
+                                       fetchedAddresses: Set(),
+                                       report: report)
+        }
+    }
+
+    private static func loadGroupThreadsToMigrate(shouldLimitBatchSize: Bool) -> [TSGroupThread] {
+        var groupThreads = [TSGroupThread]()
+        databaseStorage.read { transaction in
+            TSGroupThread.anyEnumerate(transaction: transaction) { (thread, _) in
+                guard let groupThread = thread as? TSGroupThread else {
+                    return
+                }
+                guard groupThread.isGroupV1Thread else {
+                    return
+                }
+                groupThreads.append(groupThread)
+            }
+        }
+
+        // Migrate the most recently active groups first.
+        groupThreads.sort { $0.lastInteractionRowId > $1.lastInteractionRowId }
+
+        guard shouldLimitBatchSize, groupThreads.count > maxCheckCount else {
+            return groupThreads
+        }
+        // Check the most active groups, and a random sample of the rest
+        // so that every group is eventually checked.
+        let activeCount = maxCheckCount / 2
+        let activeGroupThreads = groupThreads.prefix(activeCount)
+        let sampledGroupThreads = groupThreads.suffix(from: activeCount).shuffled().prefix(maxCheckCount - activeCount)
+        return Array(activeGroupThreads) + sampledGroupThreads.sorted {
+            $0.lastInteractionRowId > $1.lastInteractionRowId
+        }
+    }
+
+    private static func discoverMissingUuids(groupThreads: [TSGroupThread]) -> Promise<Void> {
+        var phoneNumbersWithoutUuids = Set<String>()
+        for groupThread in groupThreads {
+            // We want to fill in missing UUIDs for all members including
+            // "dropped" members.
+            let groupMembers = (groupThread.groupModel.groupMembership.allMembersOfAnyKind +
+                                    groupThread.groupModel.getDroppedMembers)
+            for address in groupMembers {
+                guard address.uuid == nil else {
+                    continue
+                }
+                guard let phoneNumber = address.phoneNumber else {
+                    owsFailDebug("Missing phone number.")
+                    continue
+                }
+                phoneNumbersWithoutUuids.insert(phoneNumber)
+            }
+        }
+        guard !phoneNumbersWithoutUuids.isEmpty else {
+            return Promise.value(())
+        }
+        return firstly {
+            ContactDiscoveryTask(phoneNumbers: phoneNumbersWithoutUuids).perform().asVoid()
+        }.recover(on: .global()) { (error: Error) -> Promise<Void> in
+            owsFailDebugUnlessNetworkFailure(error)
+            return Promise.value(())
+        }
+    }
+
+    private static func migrateBatches(groupThreads: ArraySlice<TSGroupThread>,
+                                       migrationMode: GroupsV2MigrationMode,
+                                       fetchedAddresses: Set<SignalServiceAddress>,
+                                       report: BatchMigrationReport) -> Promise<BatchMigrationReport> {
+        guard !groupThreads.isEmpty else {
+            return Promise.value(report)
+        }
+        guard tsAccountManager.isRegisteredAndReady else {
+            Logger.warn("No longer registered.")
+            return Promise.value(report)
+        }
+        let batch = Array(groupThreads.prefix(batchSize))
+        let remainder = groupThreads.dropFirst(batchSize)
+
+        var report = report
+        var fetchedAddresses = fetchedAddresses
+        return firstly(on: .global()) { () -> Promise<Void> in
+            guard !migrationMode.isOnlyUpdatingIfAlreadyMigrated else {
+                return Promise.value(())
+            }
+            let addresses = Self.addressesToFetchProfiles(groupThreads: batch).subtracting(fetchedAddresses)
+            guard !addresses.isEmpty else {
+                return Promise.value(())
+            }
+            fetchedAddresses.formUnion(addresses)
+            report.profileFetchCount += addresses.count
+            Logger.info("Fetching profiles for batch: \(addresses.count)")
+            // See tryToPrepareMembersForMigration().
+            return fetchProfiles(addresses: Array(addresses), profileFetchMode: .serialWithThrottling)
+        }.then(on: .global()) { () -> Guarantee<[PromiseKit.Result<TSGroupThread>]> in
+            // The migration queue bounds the concurrency.
+            let promises = batch.map { groupThread in
+                Self.tryToMigrate(groupThread: groupThread, migrationMode: migrationMode)
+            }
+            return when(resolved: promises)
+        }.then(on: .global()) { (results: [PromiseKit.Result<TSGroupThread>]) -> Promise<BatchMigrationReport> in
+            for result in results {
+                switch result {
+                case .fulfilled:
+                    report.migratedCount += 1
+                case .rejected(let error):
+                    let category = Self.logBatchMigrationError(error, migrationMode: migrationMode)
+                    report.failureCounts[category, default: 0] += 1
+                }
+            }
+            Logger.info("Batch migration progress: \(report.logDescription)")
+
+            return Self.migrateBatches(groupThreads: remainder,
+                                       migrationMode: migrationMode,
+                                       fetchedAddresses: fetchedAddresses,
+                                       report: report)
+        }
+    }
+
+    // Members whose capabilities or profile key credentials we lack.
+    private static func addressesToFetchProfiles(groupThreads: [TSGroupThread]) -> Set<SignalServiceAddress> {
+        var addresses = Set<SignalServiceAddress>()
+        databaseStorage.read { transaction in
+            for groupThread in groupThreads {
+                let membersToMigrate = membersToTryToMigrate(groupMembership: groupThread.groupModel.groupMembership)
+                for address in membersToMigrate where !addresses.contains(address) {
+                    if !doesUserHaveBothCapabilities(address: address, transaction: transaction) {
+                        addresses.insert(address)
+                    } else if !groupsV2.hasProfileKeyCredential(for: address, transaction: transaction) {
+                        addresses.insert(address)
+                    }
+                }
+            }
+        }
+        return addresses
+    }
+
+    // Returns the category of the error for the report.
+    private static func logBatchMigrationError(_ error: Error,
+                                               migrationMode: GroupsV2MigrationMode) -> String {
+        if case GroupsV2Error.groupDoesNotExistOnService = error {
+            if migrationMode != .possiblyAlreadyMigratedOnService {
+                Logger.warn("Error: \(error)")
+            }
+            return "groupDoesNotExistOnService"
+        } else if case GroupsV2Error.localUserNotInGroup = error {
+            if !migrationMode.isAutoMigration {
+                Logger.warn("Error: \(error)")
+            }
+            return "localUserNotInGroup"
+        } else if case GroupsV2Error.groupCannotBeMigrated = error {
+            if !migrationMode.isAutoMigration {
+                Logger.warn("Error: \(error)")
+            }
+            return "groupCannotBeMigrated"
+        } else if case GroupsV2Error.timeout = error {
+            Logger.warn("Error: \(error)")
+            return "timeout"
+        } else if IsNetworkConnectivityFailure(error) {
+            Logger.warn("Error: \(error)")
+            return "network"
+        } else {
+            owsFailDebug("Error: \(error)")
+            return "other"
+        }
+    }
+}
+
+// MARK: -
+
+fileprivate extension GroupsV2Migration {
+
+    // Migrations are mostly spent waiting on the service, so we let a few
+    // groups migrate at a time.
+    static let maxConcurrentMigrations = 3
+
     private static let migrationQueue: OperationQueue = {
         let operationQueue = OperationQueue()
         operationQueue.name = "GroupsV2MigrationQueue"
-        operationQueue.maxConcurrentOperationCount = 1
+        operationQueue.maxConcurrentOperationCount = maxConcurrentMigrations
         return operationQueue
     }()
 
-    // Ensure only one migration is in flight at a time.
+    // The property below should only be accessed with migrationQueueLock.
+    private static let migrationQueueLock = UnfairLock()
+    // Keyed by v2 group id.
+    private static var lastOperationByGroupId = [Data: MigrateGroupOperation]()
+
+    // Ensure only one migration per group is in flight at a time.
     static func enqueueMigration(groupId: Data,
                                  migrationMode: GroupsV2MigrationMode) -> Promise<TSGroupThread> {
         let operation = MigrateGroupOperation(groupId: groupId, migrationMode: migrationMode)
+
+        // groupId might be the v1 or v2 group id.
+        let v2GroupId: Data
+        if GroupManager.isV1GroupId(groupId) {
+            guard let migratedGroupId = try? Self.v2GroupId(forV1GroupId: groupId) else {
+                return Promise(error: OWSAssertionError("Could not derive v2 group id."))
+            }
+            v2GroupId = migratedGroupId
+        } else {
+            v2GroupId = groupId
+        }
+
+        migrationQueueLock.withLock {
+            if let lastOperation = lastOperationByGroupId[v2GroupId] {
+                operation.addDependency(lastOperation)
+            }
+            lastOperationByGroupId[v2GroupId] = operation
+        }
+        operation.promise.ensure(on: .global()) {
+            migrationQueueLock.withLock {
+                if lastOperationByGroupId[v2GroupId] === operation {
+                    lastOperationByGroupId[v2GroupId] = nil
+                }
+            }
+        }.cauterize()
+
         migrationQueue.addOperation(operation)
         return operation.promise
     }
@@ -435,7 +631,7 @@ fileprivate extension GroupsV2Migration {
                                       profileFetchMode: ProfileFetchMode) -> Promise<Void> {
         func fetchProfilePromise(address: SignalServiceAddress) -> Promise<Void> {
             firstly {
-                ProfileFetcherJob.fetchProfilePromise(address: address, ignoreThrottling: false).asVoid()
+                ProfileFetchScheduler.shared.fetchProfile(address: address, ignoreThrottling: false).asVoid()
             }.recover(on: .global()) { error -> Promise<Void> in
                 if case ProfileFetchError.throttled = error {
                     // Ignore throttling errors.
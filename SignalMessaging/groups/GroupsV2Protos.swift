@@ -249,6 +249,34 @@ public class GroupsV2Protos {
 
     // MARK: -
 
+    private class func prefetchDecryptedMembers(groupProto: GroupsProtoGroup,
+                                                groupV2Params: GroupV2Params) {
+        var members = [GroupV2Params.MemberCiphertexts]()
+        for memberProto in groupProto.members {
+            guard let userId = memberProto.userID else {
+                continue
+            }
+            members.append(GroupV2Params.MemberCiphertexts(userId: userId,
+                                                           profileKeyCiphertext: memberProto.profileKey))
+        }
+        for pendingMemberProto in groupProto.pendingMembers {
+            if let userId = pendingMemberProto.member?.userID {
+                members.append(GroupV2Params.MemberCiphertexts(userId: userId, profileKeyCiphertext: nil))
+            }
+            if let addedByUserId = pendingMemberProto.addedByUserID {
+                members.append(GroupV2Params.MemberCiphertexts(userId: addedByUserId, profileKeyCiphertext: nil))
+            }
+        }
+        for requestingMemberProto in groupProto.requestingMembers {
+            guard let userId = requestingMemberProto.userID else {
+                continue
+            }
+            members.append(GroupV2Params.MemberCiphertexts(userId: userId,
+                                                           profileKeyCiphertext: requestingMemberProto.profileKey))
+        }
+        groupV2Params.prefetchDecryptedMembers(members)
+    }
+
     public class func parse(groupProto: GroupsProtoGroup,
                             downloadedAvatars: GroupV2DownloadedAvatars,
                             groupV2Params: GroupV2Params) throws -> GroupV2Snapshot {
@@ -276,6 +304,8 @@ public class GroupsV2Protos {
 
         var groupMembershipBuilder = GroupMembership.Builder()
 
+        prefetchDecryptedMembers(groupProto: groupProto, groupV2Params: groupV2Params)
+
         for memberProto in groupProto.members {
             guard let userID = memberProto.userID else {
                 throw OWSAssertionError("Group member missing userID.")
@@ -119,6 +119,11 @@ typedef void (^ProfileManagerFailureBlock)(NSError *error);
 - (nullable UIImage *)profileAvatarForAddress:(SignalServiceAddress *)address
                                   transaction:(SDSAnyReadTransaction *)transaction;
 
+// Decodes the avatar at the given diameter (in points), rather than at its full size.
+- (nullable UIImage *)profileAvatarForAddress:(SignalServiceAddress *)address
+                                     diameter:(CGFloat)diameter
+                                  transaction:(SDSAnyReadTransaction *)transaction;
+
 - (nullable NSString *)usernameForAddress:(SignalServiceAddress *)address
                               transaction:(SDSAnyReadTransaction *)transaction;
 
@@ -46,6 +46,12 @@ const NSString *kNSNotificationKey_WasLocallyInitiated = @"kNSNotificationKey_Wa
 // This property can be accessed on any thread, while synchronized on self.
 @property (atomic, readonly) NSCache<NSString *, UIImage *> *profileAvatarImageCache;
 
+// Avatars decoded at display size, keyed by avatar filename. Each avatar
+// file is immutable, so entries never need to be invalidated.
+//
+// This cache is thread-safe.
+@property (nonatomic, readonly) ImageCache *profileAvatarThumbnailCache;
+
 @end
 
 #pragma mark -
@@ -109,10 +115,16 @@ const NSString *kNSNotificationKey_WasLocallyInitiated = @"kNSNotificationKey_Wa
         [[SDSKeyValueStore alloc] initWithCollection:@"kOWSProfileManager_GroupWhitelistCollection"];
 
     _profileAvatarImageCache = [NSCache new];
+    _profileAvatarThumbnailCache = [[ImageCache alloc] initWithName:@"Profile avatar thumbnails"];
 
     OWSSingletonAssert();
 
     [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{
+        // Leave profile maintenance to the main app, so that app extensions
+        // (especially the NSE, with its small memory limit) start quickly.
+        if (!CurrentAppContext().isMainApp) {
+            return;
+        }
         if (TSAccountManager.shared.isRegistered) {
             [self rotateLocalProfileKeyIfNecessary];
             [OWSProfileManager updateProfileOnServiceIfNecessaryObjc];
@@ -1560,6 +1572,27 @@ const NSString *kNSNotificationKey_WasLocallyInitiated = @"kNSNotificationKey_Wa
     return nil;
 }
 
+- (nullable UIImage *)profileAvatarForAddress:(SignalServiceAddress *)address
+                                     diameter:(CGFloat)diameter
+                                  transaction:(SDSAnyReadTransaction *)transaction
+{
+    OWSAssertDebug(address.isValid);
+    OWSAssertDebug(diameter > 0);
+
+    OWSUserProfile *_Nullable userProfile = [self getUserProfileForAddress:address transaction:transaction];
+
+    if (userProfile.avatarFileName.length > 0) {
+        return [self loadProfileAvatarWithFilename:userProfile.avatarFileName diameter:diameter];
+    }
+
+    if (userProfile.avatarUrlPath.length > 0) {
+        // Try to fill in missing avatar.
+        [self downloadAvatarForUserProfile:userProfile];
+    }
+
+    return nil;
+}
+
 - (BOOL)hasProfileAvatarData:(SignalServiceAddress *)address transaction:(SDSAnyReadTransaction *)transaction
 {
     OWSUserProfile *_Nullable userProfile = [self getUserProfileForAddress:address transaction:transaction];
@@ -1886,6 +1919,32 @@ const NSString *kNSNotificationKey_WasLocallyInitiated = @"kNSNotificationKey_Wa
     return image;
 }
 
+- (nullable UIImage *)loadProfileAvatarWithFilename:(NSString *)filename diameter:(CGFloat)diameter
+{
+    if (filename.length == 0) {
+        return nil;
+    }
+
+    UIImage *_Nullable image = [self.profileAvatarThumbnailCache imageForKey:filename diameter:diameter];
+    if (image) {
+        return image;
+    }
+
+    // Let ImageIO decode the avatar at the display size. Avatars are mostly
+    // shown in lists, far smaller than the stored image.
+    NSString *filePath = [OWSUserProfile profileAvatarFilepathWithFilename:filename];
+    NSError *_Nullable error;
+    image = [OWSMediaUtils thumbnailForImageAtPath:filePath
+                                      maxDimension:diameter * UIScreen.mainScreen.scale
+                                             error:&error];
+    if (image == nil) {
+        OWSLogWarn(@"Could not thumbnail avatar: %@", error);
+        return [self loadProfileAvatarWithFilename:filename];
+    }
+    [self.profileAvatarThumbnailCache setImage:image forKey:filename diameter:diameter];
+    return image;
+}
+
 - (void)updateProfileAvatarCache:(nullable UIImage *)image filename:(NSString *)filename
 {
     OWSAssertDebug(filename.length > 0);
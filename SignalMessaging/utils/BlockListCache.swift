@@ -11,9 +11,9 @@ public protocol BlockListCacheDelegate: class {
 
 /// A performant cache for which contacts/groups are blocked.
 ///
-/// The source of truth for which contacts and groups are blocked is the `blockingManager`, but because
-/// those accessors are made to be thread safe, they can be slow in tight loops, e.g. when rendering table
-/// view cells.
+/// The source of truth for which contacts and groups are blocked is the `blockingManager`. Lookups are done
+/// against its immutable `blockListSnapshot`, so they're cheap enough for tight loops, e.g. when rendering
+/// table view cells.
 ///
 /// Typically you'll want to create a Cache, update it to the latest state while simultaneously being informed
 /// of any future changes to block list state.
@@ -38,10 +38,6 @@ public protocol BlockListCacheDelegate: class {
 @objc(OWSBlockListCache)
 public class BlockListCache: NSObject {
 
-    private var blockedPhoneNumbers: Set<String> = Set()
-    private var blockedUUIDs: Set<String> = Set()
-    private var blockedGroupIds: Set<Data> = Set()
-    private let serialQueue: DispatchQueue = DispatchQueue(label: "BlockListCache")
     weak var delegate: BlockListCacheDelegate?
 
     private var blockingManager: OWSBlockingManager {
@@ -60,7 +56,6 @@ public class BlockListCache: NSObject {
                                                selector: #selector(blockListDidChange),
                                                name: .blockListDidChange,
                                                object: nil)
-        updateWithoutNotifyingDelegate()
     }
 
     // MARK: -
@@ -72,59 +67,24 @@ public class BlockListCache: NSObject {
 
     @objc(isAddressBlocked:)
     public func isBlocked(address: SignalServiceAddress) -> Bool {
-        return serialQueue.sync {
-            var blocked = false
-            if let phoneNumber = address.phoneNumber {
-                blocked = blockedPhoneNumbers.contains(phoneNumber)
-            }
-            if !blocked, let uuidString = address.uuidString {
-                blocked = blockedUUIDs.contains(uuidString)
-            }
-            return blocked
-        }
+        return blockingManager.blockListSnapshot.isAddressBlocked(address)
     }
 
     @objc(isGroupIdBlocked:)
     public func isBlocked(groupId: Data) -> Bool {
-        return serialQueue.sync {
-            blockedGroupIds.contains(groupId)
-        }
+        return blockingManager.blockListSnapshot.isGroupIdBlocked(groupId)
     }
 
     @objc(isThreadBlocked:)
     public func isBlocked(thread: TSThread) -> Bool {
-        switch thread {
-        case let contactThread as TSContactThread:
-            return isBlocked(address: contactThread.contactAddress)
-        case let groupThread as TSGroupThread:
-            return isBlocked(groupId: groupThread.groupModel.groupId)
-        default:
-            owsFailDebug("\(self.logTag) in \(#function) unexpected thread type: \(type(of: thread))")
-            return false
-        }
+        return blockingManager.blockListSnapshot.isThreadBlocked(thread)
     }
 
     // MARK: -
 
     public func update() {
-        updateWithoutNotifyingDelegate()
         DispatchQueue.main.async {
             self.delegate?.blockListCacheDidUpdate(self)
         }
     }
-
-    private func updateWithoutNotifyingDelegate() {
-        let blockedPhoneNumbers = Set(blockingManager.blockedPhoneNumbers)
-        let blockedUUIDs = Set(blockingManager.blockedUUIDs)
-        let blockedGroupIds = Set(blockingManager.blockedGroupIds)
-        update(blockedPhoneNumbers: blockedPhoneNumbers, blockedUUIDs: blockedUUIDs, blockedGroupIds: blockedGroupIds)
-    }
-
-    private func update(blockedPhoneNumbers: Set<String>, blockedUUIDs: Set<String>, blockedGroupIds: Set<Data>) {
-        serialQueue.sync {
-            self.blockedPhoneNumbers = blockedPhoneNumbers
-            self.blockedUUIDs = blockedUUIDs
-            self.blockedGroupIds = blockedGroupIds
-        }
-    }
 }
@@ -6,6 +6,7 @@
 #import "OWSPreferences.h"
 #import "OWSScrubbingLogFormatter.h"
 #import <AudioToolbox/AudioServices.h>
+#import <CocoaLumberjack/DDFileLogger+Buffering.h>
 #import <CocoaLumberjack/DDTTYLogger.h>
 #import <SignalCoreKit/NSDate+OWS.h>
 #import <SignalServiceKit/AppContext.h>
@@ -21,6 +22,11 @@ const NSUInteger kMaxDebugLogFileSize = 1024 * 1024 * 3;
 
 @property (nonatomic, nullable) DDFileLogger *fileLogger;
 
+// Wraps fileLogger, so that log lines are written to the file in batches
+// rather than one write per line. The buffer is written out whenever it
+// fills and when the logs are flushed.
+@property (nonatomic, nullable) id<DDLogger> bufferedFileLogger;
+
 @end
 
 #pragma mark -
@@ -103,12 +109,15 @@ const NSUInteger kMaxDebugLogFileSize = 1024 * 1024 * 3;
     self.fileLogger.maximumFileSize = kMaxDebugLogFileSize;
     self.fileLogger.logFormatter = [OWSScrubbingLogFormatter new];
 
-    [DDLog addLogger:self.fileLogger];
+    self.bufferedFileLogger = [self.fileLogger wrapWithBuffer];
+    [DDLog addLogger:self.bufferedFileLogger];
 }
 
 - (void)disableFileLogging
 {
-    [DDLog removeLogger:self.fileLogger];
+    // Removing the buffered logger writes out its buffer.
+    [DDLog removeLogger:self.bufferedFileLogger];
+    self.bufferedFileLogger = nil;
     self.fileLogger = nil;
 }
 
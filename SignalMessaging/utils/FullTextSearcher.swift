@@ -264,6 +264,44 @@ public class FullTextSearcher: NSObject {
     override private init() {
         finder = FullTextSearchFinder()
         super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(otherUsersProfileDidChange(notification:)),
+                                               name: .otherUsersProfileDidChange,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(localProfileDidChange),
+                                               name: .localProfileDidChange,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(signalAccountsDidChange),
+                                               name: .OWSContactsManagerSignalAccountsDidChange,
+                                               object: nil)
+    }
+
+    // MARK: - Notifications
+
+    @objc
+    private func otherUsersProfileDidChange(notification: Notification) {
+        guard let address = notification.userInfo?[kNSNotificationKey_ProfileAddress] as? SignalServiceAddress else {
+            owsFailDebug("Missing address.")
+            return
+        }
+        signalAccountSearchIndex.removeFromIndex(key: address)
+    }
+
+    @objc
+    private func localProfileDidChange() {
+        guard let localAddress = TSAccountManager.localAddress else {
+            return
+        }
+        signalAccountSearchIndex.removeFromIndex(key: localAddress)
+    }
+
+    @objc
+    private func signalAccountsDidChange() {
+        // System contact names may have changed.
+        signalAccountSearchIndex.removeAll()
     }
 
     @objc
@@ -427,7 +465,7 @@ public class FullTextSearcher: NSObject {
         }
 
         var count: UInt = 0
-        self.finder.enumerateObjects(searchText: searchText, transaction: transaction) { (match: Any, snippet: String?, stop: UnsafeMutablePointer<ObjCBool>) in
+        self.finder.enumerateObjects(searchText: searchText, limit: maxResults, transaction: transaction) { (match: Any, snippet: String?, stop: UnsafeMutablePointer<ObjCBool>) in
 
             count += 1
             guard count < maxResults else {
@@ -529,38 +567,39 @@ public class FullTextSearcher: NSObject {
 
         var messages: [UInt64: MessageSearchResult] = [:]
 
-        var count: UInt = 0
-        self.finder.enumerateObjects(searchText: searchText, transaction: transaction) { (match: Any, _: String?, stop: UnsafeMutablePointer<ObjCBool>) in
+        func appendMessage(_ message: TSMessage) {
+            let messageId = message.uniqueId
+            let searchResult = MessageSearchResult(messageId: messageId, sortId: message.sortId)
+            messages[message.sortId] = searchResult
+        }
 
-            count += 1
-            guard count < maxResults else {
-                stop.pointee = true
-                return
-            }
+        // Matching messages are filtered by thread in the query, so we
+        // needn't load them or the matches from other threads.
+        self.finder.enumerateMessageMatches(searchText: searchText,
+                                            threadUniqueId: thread.uniqueId,
+                                            limit: maxResults,
+                                            transaction: transaction) { (uniqueId: String, sortId: UInt64, _: UnsafeMutablePointer<ObjCBool>) in
+            messages[sortId] = MessageSearchResult(messageId: uniqueId, sortId: sortId)
+        }
 
-            func appendMessage(_ message: TSMessage) {
-                let messageId = message.uniqueId
-                let searchResult = MessageSearchResult(messageId: messageId, sortId: message.sortId)
-                messages[message.sortId] = searchResult
+        // Messages which mention a matching member are matches too.
+        self.finder.enumerateObjects(searchText: searchText,
+                                     collections: [SignalRecipient.collection()],
+                                     limit: maxResults,
+                                     transaction: transaction) { (match: Any, _: String?, _: UnsafeMutablePointer<ObjCBool>) in
+            guard let recipient = match as? SignalRecipient else {
+                owsFailDebug("unexpected match: \(type(of: match))")
+                return
             }
-
-            if let message = match as? TSMessage {
-                guard message.uniqueThreadId == thread.uniqueId else {
-                    return
-                }
-
-                appendMessage(message)
-            } else if let recipient = match as? SignalRecipient {
-                guard thread.recipientAddresses.contains(recipient.address) || recipient.address.isLocalAddress else {
-                    return
-                }
-                let messagesMentioningAccount = MentionFinder.messagesMentioning(
-                    address: recipient.address,
-                    in: thread,
-                    transaction: transaction.unwrapGrdbRead
-                )
-                messagesMentioningAccount.forEach { appendMessage($0) }
+            guard thread.recipientAddresses.contains(recipient.address) || recipient.address.isLocalAddress else {
+                return
             }
+            let messagesMentioningAccount = MentionFinder.messagesMentioning(
+                address: recipient.address,
+                in: thread,
+                transaction: transaction.unwrapGrdbRead
+            )
+            messagesMentioningAccount.forEach { appendMessage($0) }
         }
 
         // We want most recent first
@@ -605,9 +644,25 @@ public class FullTextSearcher: NSObject {
             return signalAccounts
         }
 
-        return signalAccounts.filter { signalAccount in
-            self.signalAccountSearcher.matches(item: signalAccount, query: searchText, transaction: transaction)
+        // Index any accounts we haven't seen yet, or whose names have
+        // changed since they were indexed.
+        var signalAccountMap = [SignalServiceAddress: SignalAccount]()
+        var addresses = [SignalServiceAddress]()
+        for signalAccount in signalAccounts {
+            let address = signalAccount.recipientAddress
+            guard signalAccountMap[address] == nil else {
+                continue
+            }
+            signalAccountMap[address] = signalAccount
+            addresses.append(address)
+            if !signalAccountSearchIndex.isIndexed(key: address) {
+                signalAccountSearchIndex.index(key: address,
+                                               indexingString: conversationIndexingString(address: address,
+                                                                                          transaction: transaction))
+            }
         }
+
+        return signalAccountSearchIndex.search(query: searchText, among: addresses).compactMap { signalAccountMap[$0] }
     }
 
     // MARK: Searchers
@@ -626,10 +681,7 @@ public class FullTextSearcher: NSObject {
         return self.conversationIndexingString(address: recipientAddress, transaction: transaction)
     }
 
-    private lazy var signalAccountSearcher: Searcher<SignalAccount> = Searcher { (signalAccount: SignalAccount, transaction: SDSAnyReadTransaction) in
-        let recipientAddress = signalAccount.recipientAddress
-        return self.conversationIndexingString(address: recipientAddress, transaction: transaction)
-    }
+    private let signalAccountSearchIndex = IndexedSearcher<SignalServiceAddress>()
 
     private func conversationIndexingString(address: SignalServiceAddress, transaction: SDSAnyReadTransaction) -> String {
         var result = self.indexingString(address: address, transaction: transaction)
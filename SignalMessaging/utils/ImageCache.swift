@@ -1,57 +1,93 @@
 //
-//  Copyright (c) 2017 Open Whisper Systems. All rights reserved.
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
 //
 
 import Foundation
 import UIKit
 
-class ImageCacheRecord: NSObject {
-    var variations: [CGFloat: UIImage]
-    init(variations: [CGFloat: UIImage]) {
-        self.variations = variations
-    }
-}
-
 /**
  * A two dimensional hash, allowing you to store variations under a single key.
  * This is useful because we generate multiple diameters of an image, but when we
  * want to clear out the images for a key we want to clear out *all* variations.
+ *
+ * The cache is thread-safe.
  */
 @objc
 public class ImageCache: NSObject {
 
-    let backingCache: NSCache<AnyObject, ImageCacheRecord>
+    let backingCache: ShardedLRUCache<NSObject, [CGFloat: UIImage]>
+
+    @objc
+    public static let defaultMaxSize = 256
+
+    // The decoded bitmaps of the cached images, across all keys and diameters.
+    @objc
+    public static let defaultMaxByteCount = 16 * 1024 * 1024
 
-    public override init() {
-        self.backingCache = NSCache()
+    // If the cache has a name, it reports its memory use to the
+    // MemoryAccountant under that name.
+    @objc
+    public init(name: String?, maxSize: Int, maxByteCount: Int) {
+        self.backingCache = ShardedLRUCache(maxSize: maxSize, maxCost: maxByteCount) { variations in
+            variations.values.reduce(0) { $0 + ImageCache.byteCount(of: $1) }
+        }
+
+        super.init()
+
+        if let name = name {
+            // Decoded images are cheap to rebuild from their files.
+            MemoryAccountant.shared.register(backingCache, name: name, sheddingPriority: .first)
+        }
     }
 
     @objc
-    public func image(forKey key: AnyObject, diameter: CGFloat) -> UIImage? {
-        guard let record = backingCache.object(forKey: key) else {
-            return nil
+    public convenience init(maxSize: Int, maxByteCount: Int) {
+        self.init(name: nil, maxSize: maxSize, maxByteCount: maxByteCount)
+    }
+
+    @objc
+    public convenience init(name: String) {
+        self.init(name: name, maxSize: ImageCache.defaultMaxSize, maxByteCount: ImageCache.defaultMaxByteCount)
+    }
+
+    @objc
+    public convenience init(maxSize: Int) {
+        self.init(maxSize: maxSize, maxByteCount: ImageCache.defaultMaxByteCount)
+    }
+
+    public override convenience init() {
+        self.init(maxSize: ImageCache.defaultMaxSize)
+    }
+
+    static func byteCount(of image: UIImage) -> Int {
+        if let cgImage = image.cgImage {
+            return cgImage.bytesPerRow * cgImage.height
         }
-        return record.variations[diameter]
+        let pixelSize = image.size.width * image.scale * image.size.height * image.scale
+        return Int(pixelSize) * 4
+    }
+
+    @objc
+    public func image(forKey key: NSObject, diameter: CGFloat) -> UIImage? {
+        return backingCache.get(key: key)?[diameter]
     }
 
     @objc
-    public func setImage(_ image: UIImage, forKey key: AnyObject, diameter: CGFloat) {
-        if let existingRecord = backingCache.object(forKey: key) {
-            existingRecord.variations[diameter] = image
-            backingCache.setObject(existingRecord, forKey: key)
-        } else {
-            let newRecord = ImageCacheRecord(variations: [diameter: image])
-            backingCache.setObject(newRecord, forKey: key)
+    public func setImage(_ image: UIImage, forKey key: NSObject, diameter: CGFloat) {
+        backingCache.update(key: key) { variations in
+            var variations = variations ?? [:]
+            variations[diameter] = image
+            return variations
         }
     }
 
     @objc
     public func removeAllImages() {
-        backingCache.removeAllObjects()
+        backingCache.clear()
     }
 
     @objc
-    public func removeAllImages(forKey key: AnyObject) {
-        backingCache.removeObject(forKey: key)
+    public func removeAllImages(forKey key: NSObject) {
+        backingCache.remove(key: key)
     }
 }
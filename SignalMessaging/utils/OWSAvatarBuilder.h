@@ -34,6 +34,12 @@ extern const NSUInteger kLargeAvatarSize;
                               backgroundColor:(UIColor *)backgroundColor
                                      diameter:(NSUInteger)diameter;
 
++ (nullable UIImage *)avatarImageWithInitials:(NSString *)initials
+                              backgroundColor:(UIColor *)backgroundColor
+                                    textColor:(UIColor *)textColor
+                                         font:(UIFont *)font
+                                     diameter:(NSUInteger)diameter;
+
 + (nullable UIImage *)avatarImageWithIcon:(UIImage *)icon
                                  iconSize:(CGSize)iconSize
                           backgroundColor:(UIColor *)backgroundColor
@@ -46,6 +52,7 @@ extern const NSUInteger kLargeAvatarSize;
                                  diameter:(NSUInteger)diameter;
 
 + (UIColor *)avatarForegroundColor;
++ (UIFont *)avatarTextFontForDiameter:(NSUInteger)diameter;
 
 @end
 
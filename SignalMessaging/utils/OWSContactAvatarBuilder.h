@@ -38,6 +38,11 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initForLocalUserWithDiameter:(NSUInteger)diameter;
 - (instancetype)initForLocalUserWithDiameter:(NSUInteger)diameter transaction:(SDSAnyReadTransaction *)transaction;
 
+/**
+ * The keys under which default avatars for this address are kept in the avatar cache.
+ */
++ (NSArray<NSString *> *)avatarCacheKeysForAddress:(SignalServiceAddress *)address;
+
 @end
 
 NS_ASSUME_NONNULL_END
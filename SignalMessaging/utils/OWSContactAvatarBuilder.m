@@ -146,7 +146,8 @@ NS_ASSUME_NONNULL_BEGIN
         return self.buildImageForLocalUser;
     }
 
-    return [OWSContactAvatarBuilder.contactsManager imageForAddressWithSneakyTransaction:self.address];
+    return [OWSContactAvatarBuilder.contactsManager imageForAddressWithSneakyTransaction:self.address
+                                                                               diameter:(CGFloat)self.diameter];
 }
 
 - (nullable UIImage *)buildSavedImageWithTransaction:(SDSAnyReadTransaction *)transaction
@@ -159,7 +160,9 @@ NS_ASSUME_NONNULL_BEGIN
         return self.buildImageForLocalUser;
     }
 
-    return [OWSContactAvatarBuilder.contactsManager imageForAddress:self.address transaction:transaction];
+    return [OWSContactAvatarBuilder.contactsManager imageForAddress:self.address
+                                                           diameter:(CGFloat)self.diameter
+                                                        transaction:transaction];
 }
 
 - (nullable UIImage *)buildImageForLocalUser
@@ -185,10 +188,24 @@ NS_ASSUME_NONNULL_BEGIN
     return image;
 }
 
++ (NSString *)avatarCacheKeyForAddress:(SignalServiceAddress *)address isDarkThemeEnabled:(BOOL)isDarkThemeEnabled
+{
+    return [NSString stringWithFormat:@"%@-%d", address.stringForDisplay, isDarkThemeEnabled];
+}
+
++ (NSArray<NSString *> *)avatarCacheKeysForAddress:(SignalServiceAddress *)address
+{
+    return @[
+        [self avatarCacheKeyForAddress:address isDarkThemeEnabled:NO],
+        [self avatarCacheKeyForAddress:address isDarkThemeEnabled:YES],
+    ];
+}
+
 - (id)cacheKey
 {
     if (self.address.isValid) {
-        return [NSString stringWithFormat:@"%@-%d", self.address.stringForDisplay, Theme.isDarkThemeEnabled];
+        return [OWSContactAvatarBuilder avatarCacheKeyForAddress:self.address
+                                              isDarkThemeEnabled:Theme.isDarkThemeEnabled];
     } else {
         return [NSString stringWithFormat:@"%@-%d", self.contactInitials, Theme.isDarkThemeEnabled];
     }
@@ -216,22 +233,82 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable UIImage *)buildDefaultImage
 {
+    NSString *cacheKey = self.cacheKey;
     UIImage *_Nullable cachedAvatar =
-        [OWSContactAvatarBuilder.contactsManager getImageFromAvatarCacheWithKey:self.cacheKey
+        [OWSContactAvatarBuilder.contactsManager getImageFromAvatarCacheWithKey:cacheKey
                                                                        diameter:(CGFloat)self.diameter];
     if (cachedAvatar) {
         return cachedAvatar;
     }
 
+    // Resolve the theme-dependent colors here, so that rendering doesn't
+    // depend on the current thread.
     UIColor *color = [OWSConversationColor conversationColorOrDefaultForColorName:self.colorName].themeColor;
     OWSAssertDebug(color);
+    UIColor *foregroundColor = OWSAvatarBuilder.avatarForegroundColor;
+
+    UIImage *_Nullable image = [self renderDefaultImageWithBackgroundColor:color
+                                                           foregroundColor:foregroundColor
+                                                                  diameter:self.diameter];
+    if (!image) {
+        OWSFailDebug(@"Could not generate avatar.");
+        return nil;
+    }
+
+    [OWSContactAvatarBuilder.contactsManager setImageForAvatarCache:image forKey:cacheKey diameter:self.diameter];
+
+    [self prerenderDefaultImagesWithCacheKey:cacheKey backgroundColor:color foregroundColor:foregroundColor];
+
+    return image;
+}
+
+// The same contact is usually shown at several of the standard sizes, e.g.
+// in the conversation list and then in the conversation settings. Once we
+// have rendered one of them, render the others off the main thread.
+- (void)prerenderDefaultImagesWithCacheKey:(NSString *)cacheKey
+                           backgroundColor:(UIColor *)backgroundColor
+                           foregroundColor:(UIColor *)foregroundColor
+{
+    NSArray<NSNumber *> *standardDiameters = @[
+        @(kSmallAvatarSize),
+        @(kStandardAvatarSize),
+        @(kMediumAvatarSize),
+        @(kLargeAvatarSize),
+    ];
+    if (![standardDiameters containsObject:@(self.diameter)]) {
+        return;
+    }
 
-    UIImage *_Nullable image;
-    if (self.contactInitials.length == 0) {
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^{
+        for (NSNumber *diameterValue in standardDiameters) {
+            NSUInteger diameter = diameterValue.unsignedIntegerValue;
+            if ([OWSContactAvatarBuilder.contactsManager getImageFromAvatarCacheWithKey:cacheKey
+                                                                               diameter:(CGFloat)diameter]
+                != nil) {
+                continue;
+            }
+            UIImage *_Nullable image = [self renderDefaultImageWithBackgroundColor:backgroundColor
+                                                                   foregroundColor:foregroundColor
+                                                                          diameter:diameter];
+            if (image != nil) {
+                [OWSContactAvatarBuilder.contactsManager setImageForAvatarCache:image
+                                                                         forKey:cacheKey
+                                                                       diameter:diameter];
+            }
+        }
+    });
+}
+
+- (nullable UIImage *)renderDefaultImageWithBackgroundColor:(UIColor *)backgroundColor
+                                            foregroundColor:(UIColor *)foregroundColor
+                                                   diameter:(NSUInteger)diameter
+{
+    NSString *_Nullable contactInitials = self.contactInitials;
+    if (contactInitials.length == 0) {
         // We don't have a name for this contact, so we can't make an "initials" image.
 
         UIImage *icon;
-        if (self.diameter > kStandardAvatarSize) {
+        if (diameter > kStandardAvatarSize) {
             icon = [UIImage imageNamed:@"contact-avatar-1024"];
         } else {
             icon = [UIImage imageNamed:@"contact-avatar-84"];
@@ -240,26 +317,21 @@ NS_ASSUME_NONNULL_BEGIN
         // The contact-avatar asset is designed to be 28pt if the avatar is kStandardAvatarSize.
         // Adjust its size to reflect the actual output diameter.
         // We use an oversize 1024px version of the asset to ensure quality results for larger avatars.
-        CGFloat scaling = (self.diameter / (CGFloat)kStandardAvatarSize) * (28 / assetWidthPixels);
+        CGFloat scaling = (diameter / (CGFloat)kStandardAvatarSize) * (28 / assetWidthPixels);
 
         CGSize iconSize = CGSizeScale(icon.size, scaling);
-        image = [OWSAvatarBuilder avatarImageWithIcon:icon
-                                             iconSize:iconSize
-                                      backgroundColor:color
-                                             diameter:self.diameter];
+        return [OWSAvatarBuilder avatarImageWithIcon:icon
+                                            iconSize:iconSize
+                                           iconColor:foregroundColor
+                                     backgroundColor:backgroundColor
+                                            diameter:diameter];
     } else {
-        image = [OWSAvatarBuilder avatarImageWithInitials:self.contactInitials
-                                          backgroundColor:color
-                                                 diameter:self.diameter];
+        return [OWSAvatarBuilder avatarImageWithInitials:contactInitials
+                                         backgroundColor:backgroundColor
+                                               textColor:foregroundColor
+                                                    font:[OWSAvatarBuilder avatarTextFontForDiameter:diameter]
+                                                diameter:diameter];
     }
-
-    if (!image) {
-        OWSFailDebug(@"Could not generate avatar.");
-        return nil;
-    }
-
-    [OWSContactAvatarBuilder.contactsManager setImageForAvatarCache:image forKey:self.cacheKey diameter:self.diameter];
-    return image;
 }
 
 - (nullable UIImage *)noteToSelfImageWithConversationColorName:(ConversationColorName)conversationColorName
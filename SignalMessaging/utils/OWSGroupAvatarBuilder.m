@@ -5,7 +5,6 @@
 #import "OWSGroupAvatarBuilder.h"
 #import "OWSContactsManager.h"
 #import "TSGroupThread.h"
-#import <SignalCoreKit/NSData+OWS.h>
 #import <SignalMessaging/SignalMessaging-Swift.h>
 #import <SignalServiceKit/SSKEnvironment.h>
 
@@ -63,8 +62,14 @@ NS_ASSUME_NONNULL_BEGIN
                         conversationColorName:(NSString *)conversationColorName
                                      diameter:(NSUInteger)diameter
 {
-    NSString *cacheKey = [NSString
-        stringWithFormat:@"%@-%d-%lu", groupId.hexadecimalString, Theme.isDarkThemeEnabled, (unsigned long)diameter];
+    // The default avatar doesn't depend on the group itself, so it's
+    // rendered once per color and shared by all groups.
+#ifdef SHOW_COLOR_PICKER
+    NSString *colorKey = conversationColorName;
+#else
+    NSString *colorKey = @"steel";
+#endif
+    NSString *cacheKey = [NSString stringWithFormat:@"group-default-%@-%d", colorKey, Theme.isDarkThemeEnabled];
 
     UIImage *_Nullable cachedAvatar =
         [OWSGroupAvatarBuilder.contactsManager getImageFromAvatarCacheWithKey:cacheKey diameter:(CGFloat)diameter];
@@ -32,14 +32,25 @@ NS_ASSUME_NONNULL_BEGIN
 
 NSString *const OWSOrphanDataCleaner_LastCleaningVersionKey = @"OWSOrphanDataCleaner_LastCleaningVersionKey";
 NSString *const OWSOrphanDataCleaner_LastCleaningDateKey = @"OWSOrphanDataCleaner_LastCleaningDateKey";
+NSString *const OWSOrphanDataCleaner_InteractionCursorKey = @"OWSOrphanDataCleaner_InteractionCursorKey";
+NSString *const OWSOrphanDataCleaner_ReactionCursorKey = @"OWSOrphanDataCleaner_ReactionCursorKey";
+NSString *const OWSOrphanDataCleaner_MentionCursorKey = @"OWSOrphanDataCleaner_MentionCursorKey";
+
+// Orphan records are found and removed in slices of this many rows.
+static const NSUInteger kOrphanRecordSliceSize = 1000;
+// On launch, we process at most this many slices of each record type.
+static const NSUInteger kMaxOrphanRecordSlicesPerLaunch = 10;
+
+typedef NS_ENUM(NSUInteger, OWSOrphanRecordType) {
+    OWSOrphanRecordType_Interaction,
+    OWSOrphanRecordType_Reaction,
+    OWSOrphanRecordType_Mention,
+};
 
 @interface OWSOrphanData : NSObject
 
-@property (nonatomic) NSSet<NSString *> *interactionIds;
 @property (nonatomic) NSSet<NSString *> *attachmentIds;
-@property (nonatomic) NSSet<NSString *> *filePaths;
-@property (nonatomic) NSSet<NSString *> *reactionIds;
-@property (nonatomic) NSSet<NSString *> *mentionIds;
+@property (nonatomic) NSArray<NSString *> *filePaths;
 
 @end
 
@@ -119,9 +130,18 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 
 + (nullable NSSet<NSString *> *)filePathsInDirectorySafe:(NSString *)dirPath
 {
-    NSMutableSet *filePaths = [NSMutableSet new];
+    NSMutableArray<NSString *> *filePaths = [NSMutableArray new];
+    if (![self addFilePathsInDirectorySafe:dirPath toArray:filePaths]) {
+        return nil;
+    }
+    return [NSSet setWithArray:filePaths];
+}
+
+// Returns NO if the app resigned active before the directory was crawled.
++ (BOOL)addFilePathsInDirectorySafe:(NSString *)dirPath toArray:(NSMutableArray<NSString *> *)filePaths
+{
     if (![[NSFileManager defaultManager] fileExistsAtPath:dirPath]) {
-        return filePaths;
+        return YES;
     }
     NSError *error;
     NSArray<NSString *> *fileNames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:dirPath error:&error];
@@ -132,31 +152,67 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
         } else {
             OWSFailDebug(@"Error: %@", error);
         }
-        return [NSSet new];
+        return YES;
     }
     for (NSString *fileName in fileNames) {
         if (!self.isMainAppAndActive) {
-            return nil;
+            return NO;
         }
         NSString *filePath = [dirPath stringByAppendingPathComponent:fileName];
         BOOL isDirectory;
         [[NSFileManager defaultManager] fileExistsAtPath:filePath isDirectory:&isDirectory];
         if (isDirectory) {
-            NSSet<NSString *> *_Nullable dirPaths = [self filePathsInDirectorySafe:filePath];
-            if (!dirPaths) {
-                return nil;
+            if (![self addFilePathsInDirectorySafe:filePath toArray:filePaths]) {
+                return NO;
             }
-            [filePaths unionSet:dirPaths];
         } else {
             [filePaths addObject:filePath];
         }
     }
-    return filePaths;
+    return YES;
+}
+
+#pragma mark - Sorted Paths
+
+// Rather than building sets of every path, we reconcile file system
+// listings against sorted arrays of paths with a single merge pass.
++ (NSArray<NSString *> *)sortedUniqueStrings:(NSArray<NSString *> *)strings
+{
+    NSArray<NSString *> *sortedStrings = [strings sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableArray<NSString *> *result = [NSMutableArray arrayWithCapacity:sortedStrings.count];
+    for (NSString *string in sortedStrings) {
+        if (![result.lastObject isEqualToString:string]) {
+            [result addObject:string];
+        }
+    }
+    return result;
+}
+
+// Both arrays must be sorted with sortedUniqueStrings:.
++ (NSArray<NSString *> *)sortedStrings:(NSArray<NSString *> *)strings
+                    minusSortedStrings:(NSArray<NSString *> *)stringsToRemove
+{
+    NSMutableArray<NSString *> *result = [NSMutableArray new];
+    NSUInteger removeIndex = 0;
+    for (NSString *string in strings) {
+        NSComparisonResult comparison = NSOrderedAscending;
+        while (removeIndex < stringsToRemove.count) {
+            comparison = [stringsToRemove[removeIndex] compare:string];
+            if (comparison != NSOrderedAscending) {
+                break;
+            }
+            removeIndex++;
+        }
+        if (removeIndex < stringsToRemove.count && comparison == NSOrderedSame) {
+            continue;
+        }
+        [result addObject:string];
+    }
+    return result;
 }
 
 // This method finds (but does not delete):
 //
-// * Orphan TSInteractions (with no thread).
 // * Orphan TSAttachments (with no message).
 // * Orphan attachment files (with no corresponding TSAttachment).
 // * Orphan profile avatars.
@@ -265,68 +321,54 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
     }
 #endif
 
-    NSString *legacyAttachmentsDirPath = TSAttachmentStream.legacyAttachmentsDirPath;
-    NSString *sharedDataAttachmentsDirPath = TSAttachmentStream.sharedDataAttachmentsDirPath;
-    NSSet<NSString *> *_Nullable legacyAttachmentFilePaths = [self filePathsInDirectorySafe:legacyAttachmentsDirPath];
-    if (!legacyAttachmentFilePaths || !self.isMainAppAndActive) {
-        return nil;
-    }
-    NSSet<NSString *> *_Nullable sharedDataAttachmentFilePaths =
-        [self filePathsInDirectorySafe:sharedDataAttachmentsDirPath];
-    if (!sharedDataAttachmentFilePaths || !self.isMainAppAndActive) {
-        return nil;
-    }
-
-    NSString *legacyProfileAvatarsDirPath = OWSUserProfile.legacyProfileAvatarsDirPath;
-    NSString *sharedDataProfileAvatarsDirPath = OWSUserProfile.sharedDataProfileAvatarsDirPath;
-    NSSet<NSString *> *_Nullable legacyProfileAvatarsFilePaths =
-        [self filePathsInDirectorySafe:legacyProfileAvatarsDirPath];
-    if (!legacyProfileAvatarsFilePaths || !self.isMainAppAndActive) {
-        return nil;
-    }
-    NSSet<NSString *> *_Nullable sharedDataProfileAvatarFilePaths =
-        [self filePathsInDirectorySafe:sharedDataProfileAvatarsDirPath];
-    if (!sharedDataProfileAvatarFilePaths || !self.isMainAppAndActive) {
-        return nil;
-    }
-
-    NSString *stickersDirPath = StickerManager.cacheDirUrl.path;
-    NSSet<NSString *> *_Nullable allStickerFilePaths = [self filePathsInDirectorySafe:stickersDirPath];
-    if (!allStickerFilePaths || !self.isMainAppAndActive) {
-        return nil;
+    NSMutableArray<NSString *> *onDiskFilePaths = [tempFilePaths mutableCopy];
+    NSArray<NSString *> *dirPaths = @[
+        TSAttachmentStream.legacyAttachmentsDirPath,
+        TSAttachmentStream.sharedDataAttachmentsDirPath,
+        OWSUserProfile.legacyProfileAvatarsDirPath,
+        OWSUserProfile.sharedDataProfileAvatarsDirPath,
+        StickerManager.cacheDirUrl.path,
+    ];
+    for (NSString *dirPath in dirPaths) {
+        if (![self addFilePathsInDirectorySafe:dirPath toArray:onDiskFilePaths] || !self.isMainAppAndActive) {
+            return nil;
+        }
     }
 
-    NSMutableSet<NSString *> *allOnDiskFilePaths = [NSMutableSet new];
-    [allOnDiskFilePaths unionSet:legacyAttachmentFilePaths];
-    [allOnDiskFilePaths unionSet:sharedDataAttachmentFilePaths];
-    [allOnDiskFilePaths unionSet:legacyProfileAvatarsFilePaths];
-    [allOnDiskFilePaths unionSet:sharedDataProfileAvatarFilePaths];
-    [allOnDiskFilePaths unionSet:allStickerFilePaths];
-    [allOnDiskFilePaths addObjectsFromArray:tempFilePaths];
-
     // This should be redundant, but this will future-proof us against
     // ever accidentally removing the YDB or GRDB databases during
     // orphan clean up.
     NSString *grdbDirectoryPath = [SDSDatabaseStorage grdbDatabaseDirUrl].path;
     NSString *ydbDirectoryPath = [OWSPrimaryStorage sharedDataDatabaseDirPath];
-    NSMutableSet<NSString *> *databaseFilePaths = [NSMutableSet new];
-    for (NSString *filePath in allOnDiskFilePaths) {
+    NSMutableArray<NSString *> *nonDatabaseFilePaths = [NSMutableArray arrayWithCapacity:onDiskFilePaths.count];
+    NSMutableArray<NSString *> *unreferencedBlobFilePaths = [NSMutableArray new];
+    NSUInteger databaseFileCount = 0;
+    for (NSString *filePath in onDiskFilePaths) {
         if ([filePath hasPrefix:grdbDirectoryPath] || [filePath hasPrefix:ydbDirectoryPath]) {
             OWSLogInfo(@"Protecting database file: %@", filePath);
-            [databaseFilePaths addObject:filePath];
+            databaseFileCount++;
+            continue;
+        }
+        // Blobs aren't referenced by path, but by the attachment files linked to them.
+        if ([AttachmentBlobStore isBlobFilePath:filePath]) {
+            if ([AttachmentBlobStore isUnreferencedBlobAtPath:filePath]) {
+                [unreferencedBlobFilePaths addObject:filePath];
+            }
+            continue;
         }
+        [nonDatabaseFilePaths addObject:filePath];
     }
-    [allOnDiskFilePaths minusSet:databaseFilePaths];
+    NSArray<NSString *> *allOnDiskFilePaths = [self sortedUniqueStrings:nonDatabaseFilePaths];
     OWSLogVerbose(
         @"grdbDirectoryPath: %@ (%d)", grdbDirectoryPath, [OWSFileSystem fileOrFolderExistsAtPath:grdbDirectoryPath]);
     OWSLogVerbose(
         @"ydbDirectoryPath: %@ (%d)", ydbDirectoryPath, [OWSFileSystem fileOrFolderExistsAtPath:ydbDirectoryPath]);
-    OWSLogVerbose(@"databaseFilePaths: %lu", (unsigned long)databaseFilePaths.count);
+    OWSLogVerbose(@"databaseFilePaths: %lu", (unsigned long)databaseFileCount);
 
     OWSLogVerbose(@"allOnDiskFilePaths: %lu", (unsigned long)allOnDiskFilePaths.count);
 
     __block NSSet<NSString *> *profileAvatarFilePaths;
-    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+    [self.databaseStorage bulkScanReadWithBlock:^(SDSAnyReadTransaction *transaction) {
         profileAvatarFilePaths = [OWSProfileManager allProfileAvatarFilePathsWithTransaction:transaction];
     }];
 
@@ -334,7 +376,7 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
         return nil;
     }
 
-    NSNumber *_Nullable totalFileSize = [self fileSizeOfFilePathsSafe:allOnDiskFilePaths.allObjects];
+    NSNumber *_Nullable totalFileSize = [self fileSizeOfFilePathsSafe:allOnDiskFilePaths];
 
     if (!totalFileSize || !self.isMainAppAndActive) {
         return nil;
@@ -344,119 +386,55 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 
     // Attachments
     __block int attachmentStreamCount = 0;
-    NSMutableSet<NSString *> *allAttachmentFilePaths = [NSMutableSet new];
+    NSMutableArray<NSString *> *attachmentFilePaths = [NSMutableArray new];
     NSMutableSet<NSString *> *allAttachmentIds = [NSMutableSet new];
-    // Reactions
-    NSMutableSet<NSString *> *allReactionIds = [NSMutableSet new];
-    // Mentions
-    NSMutableSet<NSString *> *allMentionIds = [NSMutableSet new];
-    // Threads
-    __block NSSet *threadIds;
     // Messages
-    NSMutableSet<NSString *> *orphanInteractionIds = [NSMutableSet new];
     NSMutableSet<NSString *> *allMessageAttachmentIds = [NSMutableSet new];
-    NSMutableSet<NSString *> *allMessageReactionIds = [NSMutableSet new];
-    NSMutableSet<NSString *> *allMessageMentionIds = [NSMutableSet new];
     // Stickers
-    NSMutableSet<NSString *> *activeStickerFilePaths = [NSMutableSet new];
-    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
-        [TSAttachmentStream
-            anyEnumerateWithTransaction:transaction
-                                batched:YES
-                                  block:^(TSAttachment *attachment, BOOL *stop) {
-                                      if (!self.isMainAppAndActive) {
-                                          shouldAbort = YES;
-                                          *stop = YES;
-                                          return;
-                                      }
-                                      if (![attachment isKindOfClass:[TSAttachmentStream class]]) {
-                                          return;
-                                      }
-                                      [allAttachmentIds addObject:attachment.uniqueId];
-
-                                      TSAttachmentStream *attachmentStream = (TSAttachmentStream *)attachment;
-                                      attachmentStreamCount++;
-                                      NSString *_Nullable filePath = [attachmentStream originalFilePath];
-                                      if (filePath) {
-                                          [allAttachmentFilePaths addObject:filePath];
-                                      } else {
-                                          OWSFailDebug(@"attachment has no file path.");
-                                      }
-
-                                      [allAttachmentFilePaths
-                                          addObjectsFromArray:attachmentStream.allSecondaryFilePaths];
-                                  }];
-
-        if (shouldAbort) {
-            return;
-        }
-
-        threadIds = [NSSet setWithArray:[TSThread anyAllUniqueIdsWithTransaction:transaction]];
-
-        NSMutableSet<NSString *> *allInteractionIds = [NSMutableSet new];
-        [TSInteraction anyEnumerateWithTransaction:transaction
-                                           batched:YES
-                                             block:^(TSInteraction *interaction, BOOL *stop) {
-                                                 if (!self.isMainAppAndActive) {
-                                                     shouldAbort = YES;
-                                                     *stop = YES;
-                                                     return;
-                                                 }
-                                                 if (interaction.uniqueThreadId.length < 1
-                                                     || ![threadIds containsObject:interaction.uniqueThreadId]) {
-                                                     [orphanInteractionIds addObject:interaction.uniqueId];
-                                                 }
-
-                                                 [allInteractionIds addObject:interaction.uniqueId];
-                                                 if (![interaction isKindOfClass:[TSMessage class]]) {
-                                                     return;
-                                                 }
-
-                                                 TSMessage *message = (TSMessage *)interaction;
-                                                 [allMessageAttachmentIds addObjectsFromArray:message.allAttachmentIds];
-                                             }];
-
-        if (shouldAbort) {
-            return;
-        }
-
-        [OWSReaction anyEnumerateWithTransaction:transaction
-                                         batched:YES
-                                           block:^(OWSReaction *reaction, BOOL *stop) {
-                                               if (!self.isMainAppAndActive) {
-                                                   shouldAbort = YES;
-                                                   *stop = YES;
-                                                   return;
-                                               }
-                                               if (![reaction isKindOfClass:[OWSReaction class]]) {
-                                                   return;
-                                               }
-                                               [allReactionIds addObject:reaction.uniqueId];
-                                               if ([allInteractionIds containsObject:reaction.uniqueMessageId]) {
-                                                   [allMessageReactionIds addObject:reaction.uniqueId];
-                                               }
-                                           }];
+    NSMutableArray<NSString *> *activeStickerFilePaths = [NSMutableArray new];
+    [self.databaseStorage bulkScanReadWithBlock:^(SDSAnyReadTransaction *transaction) {
+        [TSAttachment
+            anyEnumerateInParallelWithTransaction:transaction
+                                            block:^(TSAttachment *attachment, BOOL *stop) {
+                                                if (!self.isMainAppAndActive) {
+                                                    shouldAbort = YES;
+                                                    *stop = YES;
+                                                    return;
+                                                }
+                                                if (![attachment isKindOfClass:[TSAttachmentStream class]]) {
+                                                    return;
+                                                }
+                                                [allAttachmentIds addObject:attachment.uniqueId];
+
+                                                TSAttachmentStream *attachmentStream = (TSAttachmentStream *)attachment;
+                                                attachmentStreamCount++;
+                                                NSString *_Nullable filePath = [attachmentStream originalFilePath];
+                                                if (filePath) {
+                                                    [attachmentFilePaths addObject:filePath];
+                                                } else {
+                                                    OWSFailDebug(@"attachment has no file path.");
+                                                }
+
+                                                [attachmentFilePaths
+                                                    addObjectsFromArray:attachmentStream.allSecondaryFilePaths];
+                                            }];
 
         if (shouldAbort) {
             return;
         }
 
-        [TSMention anyEnumerateWithTransaction:transaction
-                                       batched:YES
-                                         block:^(TSMention *mention, BOOL *stop) {
-                                             if (!self.isMainAppAndActive) {
-                                                 shouldAbort = YES;
-                                                 *stop = YES;
-                                                 return;
-                                             }
-                                             if (![mention isKindOfClass:[TSMention class]]) {
-                                                 return;
-                                             }
-                                             [allMentionIds addObject:mention.uniqueId];
-                                             if ([allInteractionIds containsObject:mention.uniqueMessageId]) {
-                                                 [allMessageMentionIds addObject:mention.uniqueId];
-                                             }
-                                         }];
+        // Orphan interactions, reactions and mentions are cleaned up
+        // incrementally; see cleanOrphanRecordsSync.
+        [InteractionFinder
+            enumerateAllMessageAttachmentIdsWithTransaction:transaction
+                                                      block:^(NSArray<NSString *> *attachmentIds, BOOL *stop) {
+                                                          if (!self.isMainAppAndActive) {
+                                                              shouldAbort = YES;
+                                                              *stop = YES;
+                                                              return;
+                                                          }
+                                                          [allMessageAttachmentIds addObjectsFromArray:attachmentIds];
+                                                      }];
 
         if (shouldAbort) {
             return;
@@ -529,23 +507,28 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
         return nil;
     }
 
+    NSArray<NSString *> *allAttachmentFilePaths = [self sortedUniqueStrings:attachmentFilePaths];
+
     OWSLogDebug(@"fileCount: %zu", fileCount);
     OWSLogDebug(@"totalFileSize: %lld", totalFileSize.longLongValue);
     OWSLogDebug(@"attachmentStreams: %d", attachmentStreamCount);
     OWSLogDebug(@"attachmentStreams with file paths: %zu", allAttachmentFilePaths.count);
 
-    NSMutableSet<NSString *> *orphanFilePaths = [allOnDiskFilePaths mutableCopy];
-    [orphanFilePaths minusSet:allAttachmentFilePaths];
-    [orphanFilePaths minusSet:profileAvatarFilePaths];
-    [orphanFilePaths minusSet:activeStickerFilePaths];
-    NSMutableSet<NSString *> *missingAttachmentFilePaths = [allAttachmentFilePaths mutableCopy];
-    [missingAttachmentFilePaths minusSet:allOnDiskFilePaths];
+    NSMutableArray<NSString *> *knownFilePaths = [attachmentFilePaths mutableCopy];
+    [knownFilePaths addObjectsFromArray:profileAvatarFilePaths.allObjects];
+    [knownFilePaths addObjectsFromArray:activeStickerFilePaths];
+    NSArray<NSString *> *orphanFilePaths = [[self sortedStrings:allOnDiskFilePaths
+                                             minusSortedStrings:[self sortedUniqueStrings:knownFilePaths]]
+        arrayByAddingObjectsFromArray:unreferencedBlobFilePaths];
+    NSArray<NSString *> *missingAttachmentFilePaths = [self sortedStrings:allAttachmentFilePaths
+                                                       minusSortedStrings:allOnDiskFilePaths];
 
     OWSLogDebug(@"orphan file paths: %zu", orphanFilePaths.count);
+    OWSLogDebug(@"unreferenced blob file paths: %zu", unreferencedBlobFilePaths.count);
     OWSLogDebug(@"missing attachment file paths: %zu", missingAttachmentFilePaths.count);
 
-    [self printPaths:orphanFilePaths.allObjects label:@"orphan file paths"];
-    [self printPaths:missingAttachmentFilePaths.allObjects label:@"missing attachment file paths"];
+    [self printPaths:orphanFilePaths label:@"orphan file paths"];
+    [self printPaths:missingAttachmentFilePaths label:@"missing attachment file paths"];
 
     OWSLogDebug(@"attachmentIds: %zu", allAttachmentIds.count);
     OWSLogDebug(@"allMessageAttachmentIds: %zu", allMessageAttachmentIds.count);
@@ -557,30 +540,10 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 
     OWSLogDebug(@"orphan attachmentIds: %zu", orphanAttachmentIds.count);
     OWSLogDebug(@"missing attachmentIds: %zu", missingAttachmentIds.count);
-    OWSLogDebug(@"orphan interactions: %zu", orphanInteractionIds.count);
-
-    NSMutableSet<NSString *> *orphanReactionIds = [allReactionIds mutableCopy];
-    [orphanReactionIds minusSet:allMessageReactionIds];
-    NSMutableSet<NSString *> *missingReactionIds = [allMessageReactionIds mutableCopy];
-    [missingReactionIds minusSet:allReactionIds];
-
-    OWSLogDebug(@"orphan reactionIds: %zu", orphanReactionIds.count);
-    OWSLogDebug(@"missing reactionIds: %zu", missingReactionIds.count);
-
-    NSMutableSet<NSString *> *orphanMentionIds = [allMentionIds mutableCopy];
-    [orphanMentionIds minusSet:allMessageMentionIds];
-    NSMutableSet<NSString *> *missingMentionIds = [allMessageMentionIds mutableCopy];
-    [missingMentionIds minusSet:allMentionIds];
-
-    OWSLogDebug(@"orphan mentionIds: %zu", orphanMentionIds.count);
-    OWSLogDebug(@"missing mentionIds: %zu", missingMentionIds.count);
 
     OWSOrphanData *result = [OWSOrphanData new];
-    result.interactionIds = [orphanInteractionIds copy];
     result.attachmentIds = [orphanAttachmentIds copy];
-    result.filePaths = [orphanFilePaths copy];
-    result.reactionIds = [orphanReactionIds copy];
-    result.mentionIds = [orphanMentionIds copy];
+    result.filePaths = orphanFilePaths;
     return result;
 }
 
@@ -630,14 +593,24 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 {
     OWSAssertIsOnMainThread();
 
-    if (![self shouldAuditOnLaunch]) {
+    if (!SSKFeatureFlags.useOrphanDataCleaner) {
+        return;
+    }
+
+    // Orphan records are cleaned up a bounded number of slices per launch,
+    // so we resume any scan that a previous launch didn't finish.
+    BOOL shouldAuditFiles = [self shouldAuditOnLaunch];
+    if (!shouldAuditFiles && ![self hasOrphanRecordScanInProgress]) {
         return;
     }
 
     // If we want to be cautious, we can disable orphan deletion using
     // flag - the cleanup will just be a dry run with logging.
     BOOL shouldRemoveOrphans = YES;
-    [self auditAndCleanup:shouldRemoveOrphans completion:nil];
+    [self auditAndCleanup:shouldRemoveOrphans
+        maxOrphanRecordSliceCount:kMaxOrphanRecordSlicesPerLaunch
+                 shouldAuditFiles:shouldAuditFiles
+                       completion:nil];
 }
 
 + (void)auditAndCleanup:(BOOL)shouldRemoveOrphans
@@ -655,6 +628,17 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 
 + (void)auditAndCleanup:(BOOL)shouldRemoveOrphans
              completion:(nullable dispatch_block_t)completion
+{
+    [self auditAndCleanup:shouldRemoveOrphans
+        maxOrphanRecordSliceCount:NSUIntegerMax
+                 shouldAuditFiles:YES
+                       completion:completion];
+}
+
++ (void)auditAndCleanup:(BOOL)shouldRemoveOrphans
+    maxOrphanRecordSliceCount:(NSUInteger)maxOrphanRecordSliceCount
+             shouldAuditFiles:(BOOL)shouldAuditFiles
+                   completion:(nullable dispatch_block_t)completion
 {
     OWSAssertIsOnMainThread();
 
@@ -701,6 +685,28 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
     //   _before_ when the app launched.  This prevents any stray data
     //   currently in use by the app from being accidentally cleaned
     //   up.
+    //
+    // Orphan interactions, reactions and mentions are found and removed
+    // in bounded slices.  Attachments and files are then audited in a
+    // single pass, since whether they're orphaned depends on every message.
+    [self cleanOrphanRecordsWithMaxSliceCount:maxOrphanRecordSliceCount
+                          shouldRemoveOrphans:shouldRemoveOrphans
+                                   completion:^(BOOL didComplete) {
+                                       if (!didComplete) {
+                                           OWSLogInfo(@"Paused orphan record cleanup.");
+                                       }
+                                       if (!shouldAuditFiles) {
+                                           if (completion) {
+                                               completion();
+                                           }
+                                           return;
+                                       }
+                                       [self auditFilesAndCleanup:shouldRemoveOrphans completion:completion];
+                                   }];
+}
+
++ (void)auditFilesAndCleanup:(BOOL)shouldRemoveOrphans completion:(nullable dispatch_block_t)completion
+{
     const NSInteger kMaxRetries = 3;
     [self findOrphanDataWithRetries:kMaxRetries
         success:^(OWSOrphanData *orphanData) {
@@ -718,6 +724,12 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
                         [self.keyValueStore setDate:[NSDate new]
                                                 key:OWSOrphanDataCleaner_LastCleaningDateKey
                                         transaction:transaction];
+
+                        // The per-thread counters are maintained incrementally;
+                        // check them for drift as part of the periodic audit.
+                        if (!transaction.transitional_yapWriteTransaction) {
+                            [ThreadInteractionCounters verifyAndRepairWithTransaction:transaction.unwrapGrdbWrite];
+                        }
                     });
 
                     if (completion) {
@@ -787,41 +799,8 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
 
     __block BOOL shouldAbort = NO;
 
-    // We need to avoid cleaning up new files that are still in the process of
-    // being created/written, so we don't clean up anything recent.
-    const NSTimeInterval kMinimumOrphanAgeSeconds = CurrentAppContext().isRunningTests ? 0.f : 15 * kMinuteInterval;
-    NSDate *appLaunchTime = CurrentAppContext().appLaunchTime;
-    NSTimeInterval thresholdTimestamp = appLaunchTime.timeIntervalSince1970 - kMinimumOrphanAgeSeconds;
-    NSDate *thresholdDate = [NSDate dateWithTimeIntervalSince1970:thresholdTimestamp];
+    NSDate *thresholdDate = [self orphanThresholdDate];
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-        NSUInteger interactionsRemoved = 0;
-        for (NSString *interactionId in orphanData.interactionIds) {
-            if (!self.isMainAppAndActive) {
-                shouldAbort = YES;
-                return;
-            }
-            TSInteraction *_Nullable interaction =
-                [TSInteraction anyFetchWithUniqueId:interactionId transaction:transaction];
-            if (!interaction) {
-                // This could just be a race condition, but it should be very unlikely.
-                OWSLogWarn(@"Could not load interaction: %@", interactionId);
-                continue;
-            }
-            // Don't delete interactions which were created in the last N minutes.
-            NSDate *creationDate = [NSDate ows_dateWithMillisecondsSince1970:interaction.timestamp];
-            if ([creationDate isAfterDate:thresholdDate]) {
-                OWSLogInfo(@"Skipping orphan interaction due to age: %f", fabs(creationDate.timeIntervalSinceNow));
-                continue;
-            }
-            OWSLogInfo(@"Removing orphan message: %@", interaction.uniqueId);
-            interactionsRemoved++;
-            if (!shouldRemoveOrphans) {
-                continue;
-            }
-            [interaction anyRemoveWithTransaction:transaction];
-        }
-        OWSLogInfo(@"Deleted orphan interactions: %zu", interactionsRemoved);
-
         NSUInteger attachmentsRemoved = 0;
         for (NSString *attachmentId in orphanData.attachmentIds) {
             if (!self.isMainAppAndActive) {
@@ -854,61 +833,6 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
             [attachmentStream anyRemoveWithTransaction:transaction];
         }
         OWSLogInfo(@"Deleted orphan attachments: %zu", attachmentsRemoved);
-
-        NSUInteger reactionsRemoved = 0;
-        for (NSString *reactionId in orphanData.reactionIds) {
-            if (!self.isMainAppAndActive) {
-                shouldAbort = YES;
-                return;
-            }
-            OWSReaction *_Nullable reaction =
-                [OWSReaction anyFetchWithUniqueId:reactionId transaction:transaction];
-            if (!reaction) {
-                // This could just be a race condition, but it should be very unlikely.
-                OWSLogWarn(@"Could not load reaction: %@", reactionId);
-                continue;
-            }
-            // Don't delete reactions which were created in the last N minutes.
-            NSDate *creationDate = [NSDate ows_dateWithMillisecondsSince1970:reaction.sentAtTimestamp];
-            if ([creationDate isAfterDate:thresholdDate]) {
-                OWSLogInfo(@"Skipping orphan reaction due to age: %f", fabs(creationDate.timeIntervalSinceNow));
-                continue;
-            }
-            OWSLogInfo(@"Removing orphan reaction: %@", reaction.uniqueId);
-            reactionsRemoved++;
-            if (!shouldRemoveOrphans) {
-                continue;
-            }
-            [reaction anyRemoveWithTransaction:transaction];
-        }
-        OWSLogInfo(@"Deleted orphan reactions: %zu", reactionsRemoved);
-
-        NSUInteger mentionsRemoved = 0;
-        for (NSString *mentionId in orphanData.mentionIds) {
-            if (!self.isMainAppAndActive) {
-                shouldAbort = YES;
-                return;
-            }
-            TSMention *_Nullable mention = [TSMention anyFetchWithUniqueId:mentionId transaction:transaction];
-            if (!mention) {
-                // This could just be a race condition, but it should be very unlikely.
-                OWSLogWarn(@"Could not load mention: %@", mentionId);
-                continue;
-            }
-            // Don't delete mentions which were created in the last N minutes.
-            NSDate *creationDate = mention.creationTimestamp;
-            if ([creationDate isAfterDate:thresholdDate]) {
-                OWSLogInfo(@"Skipping orphan mention due to age: %f", fabs(creationDate.timeIntervalSinceNow));
-                continue;
-            }
-            OWSLogInfo(@"Removing orphan mention: %@", mention.uniqueId);
-            mentionsRemoved++;
-            if (!shouldRemoveOrphans) {
-                continue;
-            }
-            [mention anyRemoveWithTransaction:transaction];
-        }
-        OWSLogInfo(@"Deleted orphan mentions: %zu", mentionsRemoved);
     });
 
     if (shouldAbort) {
@@ -916,8 +840,7 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
     }
 
     NSUInteger filesRemoved = 0;
-    NSArray<NSString *> *filePaths = [orphanData.filePaths.allObjects sortedArrayUsingSelector:@selector(compare:)];
-    for (NSString *filePath in filePaths) {
+    for (NSString *filePath in orphanData.filePaths) {
         if (!self.isMainAppAndActive) {
             return NO;
         }
@@ -954,19 +877,230 @@ typedef void (^OrphanDataBlock)(OWSOrphanData *);
     return YES;
 }
 
-+ (nullable NSArray<NSString *> *)getTempFilePaths
+#pragma mark - Orphan Records
+
++ (NSString *)cursorKeyForRecordType:(OWSOrphanRecordType)recordType
 {
-    NSString *dir1 = OWSTemporaryDirectory();
-    NSArray<NSString *> *_Nullable paths1 = [[self filePathsInDirectorySafe:dir1].allObjects mutableCopy];
+    switch (recordType) {
+        case OWSOrphanRecordType_Interaction:
+            return OWSOrphanDataCleaner_InteractionCursorKey;
+        case OWSOrphanRecordType_Reaction:
+            return OWSOrphanDataCleaner_ReactionCursorKey;
+        case OWSOrphanRecordType_Mention:
+            return OWSOrphanDataCleaner_MentionCursorKey;
+    }
+}
 
-    NSString *dir2 = OWSTemporaryDirectoryAccessibleAfterFirstAuth();
-    NSArray<NSString *> *_Nullable paths2 = [[self filePathsInDirectorySafe:dir2].allObjects mutableCopy];
++ (BOOL)hasOrphanRecordScanInProgress
+{
+    __block BOOL result = NO;
+    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+        for (NSNumber *recordType in @[
+                 @(OWSOrphanRecordType_Interaction),
+                 @(OWSOrphanRecordType_Reaction),
+                 @(OWSOrphanRecordType_Mention),
+             ]) {
+            NSString *cursorKey = [self cursorKeyForRecordType:recordType.unsignedIntegerValue];
+            if ([self.keyValueStore getUInt64:cursorKey defaultValue:0 transaction:transaction] > 0) {
+                result = YES;
+            }
+        }
+    }];
+    return result;
+}
 
-    if (paths1 && paths2) {
-        return [paths1 arrayByAddingObjectsFromArray:paths2];
-    } else {
++ (OrphanRecordSlice *)orphanRecordSliceForRecordType:(OWSOrphanRecordType)recordType
+                                           afterRowId:(uint64_t)afterRowId
+                                          transaction:(SDSAnyReadTransaction *)transaction
+{
+    switch (recordType) {
+        case OWSOrphanRecordType_Interaction:
+            return [OrphanRecordFinder orphanInteractionSliceAfterRowId:(int64_t)afterRowId
+                                                                  limit:kOrphanRecordSliceSize
+                                                            transaction:transaction.unwrapGrdbRead];
+        case OWSOrphanRecordType_Reaction:
+            return [OrphanRecordFinder orphanReactionSliceAfterRowId:(int64_t)afterRowId
+                                                               limit:kOrphanRecordSliceSize
+                                                         transaction:transaction.unwrapGrdbRead];
+        case OWSOrphanRecordType_Mention:
+            return [OrphanRecordFinder orphanMentionSliceAfterRowId:(int64_t)afterRowId
+                                                              limit:kOrphanRecordSliceSize
+                                                        transaction:transaction.unwrapGrdbRead];
+    }
+}
+
+// Returns YES if the record was removed (or would have been, on a dry run).
++ (BOOL)removeOrphanRecordWithUniqueId:(NSString *)uniqueId
+                            recordType:(OWSOrphanRecordType)recordType
+                         thresholdDate:(NSDate *)thresholdDate
+                   shouldRemoveOrphans:(BOOL)shouldRemoveOrphans
+                           transaction:(SDSAnyWriteTransaction *)transaction
+{
+    switch (recordType) {
+        case OWSOrphanRecordType_Interaction: {
+            TSInteraction *_Nullable interaction = [TSInteraction anyFetchWithUniqueId:uniqueId
+                                                                           transaction:transaction];
+            if (!interaction) {
+                // This could just be a race condition, but it should be very unlikely.
+                OWSLogWarn(@"Could not load interaction: %@", uniqueId);
+                return NO;
+            }
+            // Don't delete interactions which were created in the last N minutes.
+            NSDate *creationDate = [NSDate ows_dateWithMillisecondsSince1970:interaction.timestamp];
+            if ([creationDate isAfterDate:thresholdDate]) {
+                OWSLogInfo(@"Skipping orphan interaction due to age: %f", fabs(creationDate.timeIntervalSinceNow));
+                return NO;
+            }
+            OWSLogInfo(@"Removing orphan message: %@", interaction.uniqueId);
+            if (shouldRemoveOrphans) {
+                [interaction anyRemoveWithTransaction:transaction];
+            }
+            return YES;
+        }
+        case OWSOrphanRecordType_Reaction: {
+            OWSReaction *_Nullable reaction = [OWSReaction anyFetchWithUniqueId:uniqueId transaction:transaction];
+            if (!reaction) {
+                // This could just be a race condition, but it should be very unlikely.
+                OWSLogWarn(@"Could not load reaction: %@", uniqueId);
+                return NO;
+            }
+            // Don't delete reactions which were created in the last N minutes.
+            NSDate *creationDate = [NSDate ows_dateWithMillisecondsSince1970:reaction.sentAtTimestamp];
+            if ([creationDate isAfterDate:thresholdDate]) {
+                OWSLogInfo(@"Skipping orphan reaction due to age: %f", fabs(creationDate.timeIntervalSinceNow));
+                return NO;
+            }
+            OWSLogInfo(@"Removing orphan reaction: %@", reaction.uniqueId);
+            if (shouldRemoveOrphans) {
+                [reaction anyRemoveWithTransaction:transaction];
+            }
+            return YES;
+        }
+        case OWSOrphanRecordType_Mention: {
+            TSMention *_Nullable mention = [TSMention anyFetchWithUniqueId:uniqueId transaction:transaction];
+            if (!mention) {
+                // This could just be a race condition, but it should be very unlikely.
+                OWSLogWarn(@"Could not load mention: %@", uniqueId);
+                return NO;
+            }
+            // Don't delete mentions which were created in the last N minutes.
+            NSDate *creationDate = mention.creationTimestamp;
+            if ([creationDate isAfterDate:thresholdDate]) {
+                OWSLogInfo(@"Skipping orphan mention due to age: %f", fabs(creationDate.timeIntervalSinceNow));
+                return NO;
+            }
+            OWSLogInfo(@"Removing orphan mention: %@", mention.uniqueId);
+            if (shouldRemoveOrphans) {
+                [mention anyRemoveWithTransaction:transaction];
+            }
+            return YES;
+        }
+    }
+}
+
+// Finds and removes orphan interactions (with no thread), reactions and mentions
+// (with no message), a slice at a time. Each slice is found and removed in a
+// single write transaction, and the cursor for its record type is persisted in
+// the same transaction, so an aborted scan resumes where it left off.
+//
+// Processes at most maxSliceCount slices of each record type.
+//
+// Returns NO on failure, usually indicating that the scan aborted due to the
+// app resigning active.
++ (BOOL)cleanOrphanRecordsSyncWithMaxSliceCount:(NSUInteger)maxSliceCount
+                            shouldRemoveOrphans:(BOOL)shouldRemoveOrphans
+{
+    NSDate *thresholdDate = [self orphanThresholdDate];
+    for (NSNumber *recordTypeValue in @[
+             @(OWSOrphanRecordType_Interaction),
+             @(OWSOrphanRecordType_Reaction),
+             @(OWSOrphanRecordType_Mention),
+         ]) {
+        OWSOrphanRecordType recordType = recordTypeValue.unsignedIntegerValue;
+        NSString *cursorKey = [self cursorKeyForRecordType:recordType];
+        __block uint64_t cursor = 0;
+        if (shouldRemoveOrphans) {
+            [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+                cursor = [self.keyValueStore getUInt64:cursorKey defaultValue:0 transaction:transaction];
+            }];
+        }
+        __block NSUInteger recordsRemoved = 0;
+        __block BOOL isLapComplete = NO;
+        for (NSUInteger sliceCount = 0; sliceCount < maxSliceCount && !isLapComplete; sliceCount++) {
+            if (!self.isMainAppAndActive) {
+                return NO;
+            }
+            DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+                OrphanRecordSlice *slice = [self orphanRecordSliceForRecordType:recordType
+                                                                     afterRowId:cursor
+                                                                    transaction:transaction];
+                for (NSString *uniqueId in slice.orphanUniqueIds) {
+                    if ([self removeOrphanRecordWithUniqueId:uniqueId
+                                                  recordType:recordType
+                                               thresholdDate:thresholdDate
+                                         shouldRemoveOrphans:shouldRemoveOrphans
+                                                 transaction:transaction]) {
+                        recordsRemoved++;
+                    }
+                }
+
+                // Dry runs don't persist their cursor.
+                if (slice.lastRowId == nil) {
+                    // We've reached the end of the table; the next scan starts over.
+                    isLapComplete = YES;
+                    if (shouldRemoveOrphans) {
+                        [self.keyValueStore removeValueForKey:cursorKey transaction:transaction];
+                    }
+                } else {
+                    cursor = slice.lastRowId.unsignedLongLongValue;
+                    if (shouldRemoveOrphans) {
+                        [self.keyValueStore setUInt64:cursor key:cursorKey transaction:transaction];
+                    }
+                }
+            });
+        }
+        OWSLogInfo(@"Deleted orphan records (%lu): %zu", (unsigned long)recordType, recordsRemoved);
+    }
+    return YES;
+}
+
++ (void)cleanOrphanRecordsWithMaxSliceCount:(NSUInteger)maxSliceCount
+                        shouldRemoveOrphans:(BOOL)shouldRemoveOrphans
+                                 completion:(void (^)(BOOL didComplete))completion
+{
+    // Wait until the app is active...
+    [CurrentAppContext() runNowOrWhenMainAppIsActive:^{
+        // ...but perform the work off the main thread.
+        dispatch_async(self.workQueue, ^{
+            // If we abort, the persisted cursors let the next run resume
+            // where we left off, so we don't retry.
+            BOOL didComplete = [self cleanOrphanRecordsSyncWithMaxSliceCount:maxSliceCount
+                                                         shouldRemoveOrphans:shouldRemoveOrphans];
+            completion(didComplete);
+        });
+    }];
+}
+
++ (nullable NSArray<NSString *> *)getTempFilePaths
+{
+    NSMutableArray<NSString *> *filePaths = [NSMutableArray new];
+    if (![self addFilePathsInDirectorySafe:OWSTemporaryDirectory() toArray:filePaths]) {
         return nil;
     }
+    if (![self addFilePathsInDirectorySafe:OWSTemporaryDirectoryAccessibleAfterFirstAuth() toArray:filePaths]) {
+        return nil;
+    }
+    return filePaths;
+}
+
++ (NSDate *)orphanThresholdDate
+{
+    // We need to avoid cleaning up new files that are still in the process of
+    // being created/written, so we don't clean up anything recent.
+    const NSTimeInterval kMinimumOrphanAgeSeconds = CurrentAppContext().isRunningTests ? 0.f : 15 * kMinuteInterval;
+    NSDate *appLaunchTime = CurrentAppContext().appLaunchTime;
+    NSTimeInterval thresholdTimestamp = appLaunchTime.timeIntervalSince1970 - kMinimumOrphanAgeSeconds;
+    return [NSDate dateWithTimeIntervalSince1970:thresholdTimestamp];
 }
 
 @end
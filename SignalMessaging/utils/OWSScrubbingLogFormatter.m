@@ -6,135 +6,310 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-@implementation OWSScrubbingLogFormatter
+// The scrubber makes a single pass over the UTF-8 bytes of each log line,
+// trying each of the patterns below at each position. The patterns only
+// contain ASCII, so a match never starts or ends inside a multi-byte
+// character.
+//
+// Phone numbers:  \+\d{7,12}(\d{3})
+// UUIDs:          [\da-f]{8}\-[\da-f]{4}\-[\da-f]{4}\-[\da-f]{4}\-[\da-f]{10}([\da-f]{2})
+// Data:           <([\da-f]{2})[\da-f]{0,6}( [\da-f]{2,8})*>
+// iOS 13 data:    \{length = \d+, bytes = 0x([\da-f]{2})([\da-f]{2})*\}
+// IPv4 addresses: \d+\.\d+\.\d+\.(\d+)
+//
+// All are case insensitive. Each match is replaced by a redaction which
+// keeps the captured characters.
 
-- (NSRegularExpression *)phoneRegex
+typedef struct {
+    // The length of the match, or zero if there's no match.
+    size_t length;
+    // The captured characters, which are kept in the redaction.
+    size_t captureOffset;
+    size_t captureLength;
+} OWSScrubMatch;
+
+static inline BOOL OWSScrubIsDigit(uint8_t c)
 {
-    static NSRegularExpression *regex = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        NSError *error;
-        regex = [NSRegularExpression regularExpressionWithPattern:@"\\+\\d{7,12}(\\d{3})"
-                                                          options:NSRegularExpressionCaseInsensitive
-                                                            error:&error];
-        if (error || !regex) {
-            OWSFail(@"could not compile regular expression: %@", error);
-        }
-    });
-    return regex;
+    return c >= '0' && c <= '9';
 }
 
-- (NSRegularExpression *)uuidRegex
+static inline BOOL OWSScrubIsHex(uint8_t c)
 {
-    static NSRegularExpression *regex = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        // Example: AF112388-9F3D-4EBA-A321-CCE01BA2C85D
-        NSError *error;
-        regex = [NSRegularExpression
-            regularExpressionWithPattern:
-                @"[\\da-f]{8}\\-[\\da-f]{4}\\-[\\da-f]{4}\\-[\\da-f]{4}\\-[\\da-f]{10}([\\da-f]{2})"
-                                 options:NSRegularExpressionCaseInsensitive
-                                   error:&error];
-        if (error || !regex) {
-            OWSFail(@"could not compile regular expression: %@", error);
-        }
-    });
-    return regex;
+    return OWSScrubIsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static inline size_t OWSScrubDigitRunLength(const uint8_t *bytes, size_t length)
+{
+    size_t result = 0;
+    while (result < length && OWSScrubIsDigit(bytes[result])) {
+        result++;
+    }
+    return result;
+}
+
+static inline size_t OWSScrubHexRunLength(const uint8_t *bytes, size_t length)
+{
+    size_t result = 0;
+    while (result < length && OWSScrubIsHex(bytes[result])) {
+        result++;
+    }
+    return result;
 }
 
-- (NSRegularExpression *)dataRegex
+static inline BOOL OWSScrubHasPrefix(const uint8_t *bytes, size_t length, const char *prefix)
 {
-    static NSRegularExpression *regex = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        NSError *error;
-        regex = [NSRegularExpression regularExpressionWithPattern:@"<([\\da-f]{2})[\\da-f]{0,6}( [\\da-f]{2,8})*>"
-                                                          options:NSRegularExpressionCaseInsensitive
-                                                            error:&error];
-        if (error || !regex) {
-            OWSFail(@"could not compile regular expression: %@", error);
+    size_t prefixLength = strlen(prefix);
+    return length >= prefixLength && strncasecmp((const char *)bytes, prefix, prefixLength) == 0;
+}
+
+static OWSScrubMatch OWSScrubMatchPhoneNumber(const uint8_t *bytes, size_t length)
+{
+    OWSScrubMatch match = { 0 };
+    if (bytes[0] != '+') {
+        return match;
+    }
+    size_t digitCount = OWSScrubDigitRunLength(bytes + 1, length - 1);
+    if (digitCount < 10) {
+        return match;
+    }
+    digitCount = MIN(digitCount, (size_t)15);
+    match.length = 1 + digitCount;
+    match.captureOffset = match.length - 3;
+    match.captureLength = 3;
+    return match;
+}
+
+static OWSScrubMatch OWSScrubMatchUUID(const uint8_t *bytes, size_t length)
+{
+    static const size_t groupLengths[] = { 8, 4, 4, 4, 12 };
+
+    OWSScrubMatch match = { 0 };
+    size_t offset = 0;
+    for (size_t group = 0; group < 5; group++) {
+        if (group > 0) {
+            if (offset >= length || bytes[offset] != '-') {
+                return match;
+            }
+            offset++;
+        }
+        size_t groupLength = groupLengths[group];
+        if (OWSScrubHexRunLength(bytes + offset, MIN(groupLength, length - offset)) != groupLength) {
+            return match;
         }
-    });
-    return regex;
+        offset += groupLength;
+    }
+    match.length = offset;
+    match.captureOffset = offset - 2;
+    match.captureLength = 2;
+    return match;
 }
 
-- (NSRegularExpression *)ios13DataRegex
+static OWSScrubMatch OWSScrubMatchData(const uint8_t *bytes, size_t length)
 {
-    static NSRegularExpression *regex = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        NSError *error;
-        regex = [NSRegularExpression
-            regularExpressionWithPattern:@"\\{length = \\d+, bytes = 0x([\\da-f]{2})([\\da-f]{2})*\\}"
-                                 options:NSRegularExpressionCaseInsensitive
-                                   error:&error];
-        if (error || !regex) {
-            OWSFail(@"could not compile regular expression: %@", error);
+    OWSScrubMatch match = { 0 };
+    if (bytes[0] != '<') {
+        return match;
+    }
+    size_t offset = 1;
+    BOOL isFirstWord = YES;
+    while (YES) {
+        size_t wordLength = OWSScrubHexRunLength(bytes + offset, length - offset);
+        if (wordLength < 2 || wordLength > 8) {
+            return match;
+        }
+        if (isFirstWord) {
+            match.captureOffset = offset;
+            match.captureLength = 2;
+            isFirstWord = NO;
+        }
+        offset += wordLength;
+        if (offset >= length) {
+            return (OWSScrubMatch) { 0 };
+        }
+        if (bytes[offset] == '>') {
+            match.length = offset + 1;
+            return match;
+        }
+        if (bytes[offset] != ' ') {
+            return (OWSScrubMatch) { 0 };
         }
-    });
-    return regex;
+        offset++;
+    }
 }
 
-- (NSRegularExpression *)ipV4AddressRegex
+static OWSScrubMatch OWSScrubMatchIOS13Data(const uint8_t *bytes, size_t length)
 {
-    static NSRegularExpression *regex = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        // NOTE: The group matches the last quad of the IPv4 address.
-        NSError *error;
-        regex = [NSRegularExpression regularExpressionWithPattern:@"\\d+\\.\\d+\\.\\d+\\.(\\d+)"
-                                                          options:NSRegularExpressionCaseInsensitive
-                                                            error:&error];
-        if (error || !regex) {
-            OWSFail(@"could not compile regular expression: %@", error);
+    OWSScrubMatch match = { 0 };
+    if (!OWSScrubHasPrefix(bytes, length, "{length = ")) {
+        return match;
+    }
+    size_t offset = strlen("{length = ");
+    size_t digitCount = OWSScrubDigitRunLength(bytes + offset, length - offset);
+    if (digitCount < 1) {
+        return match;
+    }
+    offset += digitCount;
+    if (!OWSScrubHasPrefix(bytes + offset, length - offset, ", bytes = 0x")) {
+        return match;
+    }
+    offset += strlen(", bytes = 0x");
+    size_t hexCount = OWSScrubHexRunLength(bytes + offset, length - offset);
+    if (hexCount < 2 || hexCount % 2 != 0 || offset + hexCount >= length || bytes[offset + hexCount] != '}') {
+        return match;
+    }
+    match.length = offset + hexCount + 1;
+    match.captureOffset = offset;
+    match.captureLength = 2;
+    return match;
+}
+
+static OWSScrubMatch OWSScrubMatchIPv4Address(const uint8_t *bytes, size_t length)
+{
+    OWSScrubMatch match = { 0 };
+    size_t offset = 0;
+    for (int quad = 0; quad < 4; quad++) {
+        if (quad > 0) {
+            if (offset >= length || bytes[offset] != '.') {
+                return match;
+            }
+            offset++;
         }
-    });
-    return regex;
+        size_t digitCount = OWSScrubDigitRunLength(bytes + offset, length - offset);
+        if (digitCount < 1) {
+            return match;
+        }
+        if (quad == 3) {
+            match.captureOffset = offset;
+            match.captureLength = digitCount;
+        }
+        offset += digitCount;
+    }
+    match.length = offset;
+    return match;
 }
 
+#pragma mark -
+
+@implementation OWSScrubbingLogFormatter
+
 - (NSString *__nullable)formatLogMessage:(DDLogMessage *)logMessage
 {
-    NSString *logString = [super formatLogMessage:logMessage];
-
-    NSRegularExpression *phoneRegex = self.phoneRegex;
-    logString = [phoneRegex stringByReplacingMatchesInString:logString
-                                                     options:0
-                                                       range:NSMakeRange(0, [logString length])
-                                                withTemplate:@"[ REDACTED_PHONE_NUMBER:xxx$1 ]"];
-
-    NSRegularExpression *uuidRegex = self.uuidRegex;
-    logString = [uuidRegex stringByReplacingMatchesInString:logString
-                                                    options:0
-                                                      range:NSMakeRange(0, [logString length])
-                                               withTemplate:@"[ REDACTED_UUID:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxx$1 ]"];
-
-    // We capture only the first two characters of the hex string for logging.
-    // example log line: "Called someFunction with nsData: <01234567 89abcdef>"
-    //  scrubbed output: "Called someFunction with nsData: [ REDACTED_DATA:01 ]"
-    NSRegularExpression *dataRegex = self.dataRegex;
-    logString = [dataRegex stringByReplacingMatchesInString:logString
-                                                    options:0
-                                                      range:NSMakeRange(0, [logString length])
-                                               withTemplate:@"[ REDACTED_DATA:$1... ]"];
-
-    // On iOS 13, when built with the 13 SDK, NSData's description has changed
-    // and needs to be scrubbed specifically.
-    // example log line: "Called someFunction with nsData: {length = 8, bytes = 0x0123456789abcdef}"
-    //  scrubbed output: "Called someFunction with nsData: [ REDACTED_DATA:96 ]"
-    NSRegularExpression *ios13DataRegex = self.ios13DataRegex;
-    logString = [ios13DataRegex stringByReplacingMatchesInString:logString
-                                                         options:0
-                                                           range:NSMakeRange(0, [logString length])
-                                                    withTemplate:@"[ REDACTED_DATA:$1... ]"];
-
-    NSRegularExpression *ipV4AddressRegex = self.ipV4AddressRegex;
-    logString = [ipV4AddressRegex stringByReplacingMatchesInString:logString
-                                                           options:0
-                                                             range:NSMakeRange(0, [logString length])
-                                                      withTemplate:@"[ REDACTED_IPV4_ADDRESS:...$1 ]"];
-
-    return logString;
+    NSString *_Nullable logString = [super formatLogMessage:logMessage];
+    if (logString == nil) {
+        return nil;
+    }
+    return [[self class] scrubbedLogString:logString];
+}
+
++ (NSString *)scrubbedLogString:(NSString *)logString
+{
+    // Log strings may contain NUL characters, so we can't use a C string.
+    NSData *_Nullable utf8Data = [logString dataUsingEncoding:NSUTF8StringEncoding];
+    if (utf8Data == nil) {
+        return logString;
+    }
+    const uint8_t *bytes = (const uint8_t *)utf8Data.bytes;
+    size_t length = utf8Data.length;
+
+    // Every pattern needs a digit, a '<' or, for UUIDs made only of
+    // letters, a '-'. Most lines can be returned as is.
+    BOOL mightMatch = NO;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t c = bytes[i];
+        if (OWSScrubIsDigit(c) || c == '<' || c == '-') {
+            mightMatch = YES;
+            break;
+        }
+    }
+    if (!mightMatch) {
+        return logString;
+    }
+
+    NSMutableData *_Nullable output = nil;
+    size_t unscrubbedOffset = 0;
+    size_t offset = 0;
+    while (offset < length) {
+        const uint8_t *position = bytes + offset;
+        size_t remainingLength = length - offset;
+        const char *_Nullable redactionPrefix = NULL;
+        const char *redactionSuffix = " ]";
+
+        OWSScrubMatch match = { 0 };
+        uint8_t c = position[0];
+        if (c == '+') {
+            match = OWSScrubMatchPhoneNumber(position, remainingLength);
+            redactionPrefix = "[ REDACTED_PHONE_NUMBER:xxx";
+        } else if (c == '<') {
+            // We capture only the first two characters of the hex string for logging.
+            // example log line: "Called someFunction with nsData: <01234567 89abcdef>"
+            //  scrubbed output: "Called someFunction with nsData: [ REDACTED_DATA:01... ]"
+            match = OWSScrubMatchData(position, remainingLength);
+            redactionPrefix = "[ REDACTED_DATA:";
+            redactionSuffix = "... ]";
+        } else if (c == '{') {
+            // On iOS 13, when built with the 13 SDK, NSData's description has changed
+            // and needs to be scrubbed specifically.
+            // example log line: "Called someFunction with nsData: {length = 8, bytes = 0x0123456789abcdef}"
+            //  scrubbed output: "Called someFunction with nsData: [ REDACTED_DATA:01... ]"
+            match = OWSScrubMatchIOS13Data(position, remainingLength);
+            redactionPrefix = "[ REDACTED_DATA:";
+            redactionSuffix = "... ]";
+        } else if (OWSScrubIsHex(c)) {
+            // Each run of hex characters is only scanned once, so that long
+            // runs aren't rescanned from every position within them. A UUID's
+            // first group is followed by a '-', so within the run a UUID can
+            // only start 8 characters from its end. Likewise, an IPv4 address
+            // can only start where the run's trailing digits start.
+            size_t runLength = OWSScrubHexRunLength(position, remainingLength);
+            size_t candidateOffset = runLength;
+            uint8_t terminator = runLength < remainingLength ? position[runLength] : 0;
+            if (terminator == '-' && runLength >= 8) {
+                candidateOffset = runLength - 8;
+                match = OWSScrubMatchUUID(position + candidateOffset, remainingLength - candidateOffset);
+                redactionPrefix = "[ REDACTED_UUID:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxx";
+            } else if (terminator == '.') {
+                while (candidateOffset > 0 && OWSScrubIsDigit(position[candidateOffset - 1])) {
+                    candidateOffset--;
+                }
+                if (candidateOffset < runLength) {
+                    match = OWSScrubMatchIPv4Address(position + candidateOffset, remainingLength - candidateOffset);
+                    redactionPrefix = "[ REDACTED_IPV4_ADDRESS:...";
+                }
+            }
+
+            if (match.length == 0) {
+                offset += runLength;
+                continue;
+            }
+            offset += candidateOffset;
+            position = bytes + offset;
+        }
+
+        if (match.length == 0) {
+            offset++;
+            continue;
+        }
+
+        if (output == nil) {
+            output = [NSMutableData dataWithCapacity:length + 64];
+        }
+        [output appendBytes:bytes + unscrubbedOffset length:offset - unscrubbedOffset];
+        [output appendBytes:redactionPrefix length:strlen(redactionPrefix)];
+        [output appendBytes:position + match.captureOffset length:match.captureLength];
+        [output appendBytes:redactionSuffix length:strlen(redactionSuffix)];
+
+        offset += match.length;
+        unscrubbedOffset = offset;
+    }
+
+    if (output == nil) {
+        return logString;
+    }
+    [output appendBytes:bytes + unscrubbedOffset length:length - unscrubbedOffset];
+
+    // Don't log from within the log formatter if this fails.
+    NSString *_Nullable result = [[NSString alloc] initWithData:output encoding:NSUTF8StringEncoding];
+    return result ?: logString;
 }
 
 @end
@@ -0,0 +1,130 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Measures the hitch time ratio of a scroll view while it scrolls: the
+/// total time by which frames were late, in milliseconds per second of
+/// scrolling. Apple considers a ratio under 5 ms/s good, and over
+/// 10 ms/s critical.
+///
+/// The owner should call didBeginScrolling() and didEndScrolling() from
+/// its scroll view delegate methods.
+@objc
+public class ScrollHitchMonitor: NSObject {
+
+    private static let warningHitchRatio: Double = 5
+    // Shorter scrolls have too few frames to be meaningful.
+    private static let minScrollDuration: TimeInterval = 0.5
+
+    private let name: String
+
+    // The properties below should only be accessed on the main thread.
+    private var displayLink: CADisplayLink?
+    private var scrollStartTimestamp: CFTimeInterval?
+    private var lastTargetTimestamp: CFTimeInterval?
+    private var scrollHitchTime: TimeInterval = 0
+    private var totalScrollDuration: TimeInterval = 0
+    private var totalHitchTime: TimeInterval = 0
+
+    @objc
+    public init(name: String) {
+        self.name = name
+
+        super.init()
+    }
+
+    deinit {
+        displayLink?.invalidate()
+    }
+
+    /// The hitch time ratio, in ms/s, of all scrolling so far.
+    @objc
+    public var hitchRatio: Double {
+        AssertIsOnMainThread()
+
+        guard totalScrollDuration > 0 else {
+            return 0
+        }
+        return totalHitchTime * 1000 / totalScrollDuration
+    }
+
+    @objc
+    public func didBeginScrolling() {
+        AssertIsOnMainThread()
+
+        guard displayLink == nil else {
+            return
+        }
+        scrollStartTimestamp = nil
+        lastTargetTimestamp = nil
+        scrollHitchTime = 0
+
+        // The display link retains its target until it is invalidated.
+        let link = CADisplayLink(target: WeakDisplayLinkTarget(self), selector: #selector(WeakDisplayLinkTarget.displayLinkDidFire))
+        link.add(to: .main, forMode: .common)
+        displayLink = link
+    }
+
+    @objc
+    public func didEndScrolling() {
+        AssertIsOnMainThread()
+
+        guard let displayLink = displayLink else {
+            return
+        }
+        displayLink.invalidate()
+        self.displayLink = nil
+
+        guard let scrollStartTimestamp = scrollStartTimestamp,
+              let lastTargetTimestamp = lastTargetTimestamp else {
+            return
+        }
+        let scrollDuration = lastTargetTimestamp - scrollStartTimestamp
+        guard scrollDuration >= Self.minScrollDuration else {
+            return
+        }
+        totalScrollDuration += scrollDuration
+        totalHitchTime += scrollHitchTime
+
+        let scrollHitchRatio = scrollHitchTime * 1000 / scrollDuration
+        let message = String(format: "%@ scroll hitch ratio: %0.1f ms/s over %0.1fs (%0.1f ms/s overall).",
+                             name,
+                             scrollHitchRatio,
+                             scrollDuration,
+                             hitchRatio)
+        if scrollHitchRatio > Self.warningHitchRatio {
+            Logger.info(message)
+        } else {
+            Logger.verbose(message)
+        }
+    }
+
+    fileprivate func displayLinkDidFire(_ displayLink: CADisplayLink) {
+        AssertIsOnMainThread()
+
+        // A frame is late by however long after its target it was presented.
+        if let lastTargetTimestamp = lastTargetTimestamp {
+            scrollHitchTime += max(0, displayLink.timestamp - lastTargetTimestamp)
+        } else {
+            scrollStartTimestamp = displayLink.timestamp
+        }
+        lastTargetTimestamp = displayLink.targetTimestamp
+    }
+}
+
+// MARK: -
+
+private class WeakDisplayLinkTarget: NSObject {
+    private weak var monitor: ScrollHitchMonitor?
+
+    init(_ monitor: ScrollHitchMonitor) {
+        self.monitor = monitor
+    }
+
+    @objc
+    func displayLinkDidFire(_ displayLink: CADisplayLink) {
+        monitor?.displayLinkDidFire(displayLink)
+    }
+}
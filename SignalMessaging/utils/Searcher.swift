@@ -29,13 +29,18 @@ public class Searcher<T> {
     }
 
     public func matches(item: T, query: String, transaction: SDSAnyReadTransaction) -> Bool {
-        let itemString = normalize(string: indexer(item, transaction))
-        return stem(string: query).map { queryStem in
+        let itemString = SearchNormalization.normalize(string: indexer(item, transaction))
+        return SearchNormalization.stem(string: query).map { queryStem in
             return itemString.contains(queryStem)
         }.reduce(true) { $0 && $1 }
     }
+}
+
+// MARK: -
+
+fileprivate enum SearchNormalization {
 
-    private func stem(string: String) -> [String] {
+    static func stem(string: String) -> [String] {
         var normalized = normalize(string: string)
 
         // Remove any phone number formatting from the search terms
@@ -48,7 +53,135 @@ public class Searcher<T> {
         return normalized.components(separatedBy: .whitespacesAndNewlines)
     }
 
-    private func normalize(string: String) -> String {
+    static func normalize(string: String) -> String {
         return string.lowercased().trimmingCharacters(in: .whitespacesAndNewlines)
     }
 }
+
+// MARK: -
+
+// Matches queries the same way as Searcher, but against indexing strings
+// which are built once per item and kept, rather than rebuilt for every
+// item on every query.
+//
+// A trigram index over the indexing strings narrows down the candidates for
+// any query term of three or more characters, so that each keystroke only
+// has to check the items which can possibly match.
+//
+// This class is thread-safe.
+public class IndexedSearcher<Key: Hashable> {
+
+    private let lock = UnfairLock()
+
+    // Guarded by lock.
+    private var indexedStrings = [Key: String]()
+    private var trigramIndex = [String: Set<Key>]()
+
+    public init() {}
+
+    public func isIndexed(key: Key) -> Bool {
+        lock.withLock { indexedStrings[key] != nil }
+    }
+
+    public func index(key: Key, indexingString: String) {
+        let normalized = SearchNormalization.normalize(string: indexingString)
+        lock.withLock {
+            removeFromIndexLocked(key: key)
+            indexedStrings[key] = normalized
+            for trigram in Self.trigrams(of: normalized) {
+                trigramIndex[trigram, default: []].insert(key)
+            }
+        }
+    }
+
+    public func removeFromIndex(key: Key) {
+        lock.withLock { removeFromIndexLocked(key: key) }
+    }
+
+    public func removeAll() {
+        lock.withLock {
+            indexedStrings.removeAll()
+            trigramIndex.removeAll()
+        }
+    }
+
+    /// Returns those of `keys` whose indexing string contains every term of
+    /// the query. Items matching every term at the start of a word come
+    /// first; otherwise, the order of `keys` is preserved.
+    ///
+    /// Keys which haven't been indexed never match.
+    public func search(query: String, among keys: [Key]) -> [Key] {
+        let terms = SearchNormalization.stem(string: query).filter { !$0.isEmpty }
+        guard !terms.isEmpty else {
+            return []
+        }
+
+        return lock.withLock {
+            // Every match must contain every trigram of every term, so the
+            // smallest of their postings bounds the candidates.
+            var candidates: Set<Key>?
+            for term in terms {
+                for trigram in Self.trigrams(of: term) {
+                    let posting = trigramIndex[trigram] ?? []
+                    if candidates == nil || posting.count < candidates!.count {
+                        candidates = posting
+                    }
+                }
+            }
+            if let candidates = candidates, candidates.isEmpty {
+                return []
+            }
+
+            var wordPrefixMatches = [Key]()
+            var otherMatches = [Key]()
+            for key in keys {
+                if let candidates = candidates, !candidates.contains(key) {
+                    continue
+                }
+                guard let indexedString = indexedStrings[key] else {
+                    continue
+                }
+                var isMatch = true
+                var isWordPrefixMatch = true
+                for term in terms {
+                    guard indexedString.contains(term) else {
+                        isMatch = false
+                        break
+                    }
+                    if isWordPrefixMatch, !indexedString.hasPrefix(term), !indexedString.contains(" " + term) {
+                        isWordPrefixMatch = false
+                    }
+                }
+                guard isMatch else {
+                    continue
+                }
+                if isWordPrefixMatch {
+                    wordPrefixMatches.append(key)
+                } else {
+                    otherMatches.append(key)
+                }
+            }
+            return wordPrefixMatches + otherMatches
+        }
+    }
+
+    private func removeFromIndexLocked(key: Key) {
+        guard let indexedString = indexedStrings.removeValue(forKey: key) else {
+            return
+        }
+        for trigram in Self.trigrams(of: indexedString) {
+            trigramIndex[trigram]?.remove(key)
+            if trigramIndex[trigram]?.isEmpty == true {
+                trigramIndex.removeValue(forKey: trigram)
+            }
+        }
+    }
+
+    private static func trigrams(of string: String) -> Set<String> {
+        let characters = Array(string)
+        guard characters.count >= 3 else {
+            return []
+        }
+        return Set((0...(characters.count - 3)).map { String(characters[$0..<($0 + 3)]) })
+    }
+}
@@ -401,13 +401,6 @@ CREATE
 )
 ;
 
-CREATE
-    INDEX "index_interactions_on_threadUniqueId_and_id"
-        ON "model_TSInteraction"("uniqueThreadId"
-    ,"id"
-)
-;
-
 CREATE
     INDEX "index_jobs_on_label_and_id"
         ON "model_SSKJobRecord"("label"
@@ -955,3 +948,215 @@ CREATE
     ,"recordType"
 )
 ;
+
+CREATE
+    INDEX "index_attachments_on_interrupted_download"
+        ON "model_TSAttachment"("uniqueId"
+)
+WHERE recordType = 3
+AND state IN (0, 1)
+;
+
+CREATE
+    TABLE
+        IF NOT EXISTS "early_message_envelopes" (
+            "id" INTEGER PRIMARY KEY AUTOINCREMENT
+            ,"associatedMessageTimestamp" INTEGER NOT NULL
+            ,"associatedMessageAuthorUuid" TEXT
+            ,"associatedMessageAuthorPhoneNumber" TEXT
+            ,"envelopeData" BLOB NOT NULL
+            ,"plainTextData" BLOB
+            ,"wasReceivedByUD" BOOLEAN NOT NULL
+            ,"serverDeliveryTimestamp" INTEGER NOT NULL
+            ,"recordedAt" INTEGER NOT NULL
+        )
+;
+
+CREATE
+    INDEX "index_early_message_envelopes_on_associatedMessageTimestamp"
+        ON "early_message_envelopes"("associatedMessageTimestamp"
+)
+;
+
+CREATE
+    TABLE
+        thread_interaction_counters (
+            threadUniqueId TEXT PRIMARY KEY NOT NULL
+            ,interactionCount INTEGER NOT NULL DEFAULT 0
+            ,unreadCount INTEGER NOT NULL DEFAULT 0
+        )
+;
+
+CREATE
+    TRIGGER thread_interaction_counters_on_insert
+        AFTER INSERT ON model_TSInteraction
+        BEGIN
+            INSERT OR IGNORE INTO thread_interaction_counters (threadUniqueId)
+            VALUES (NEW.uniqueThreadId);
+            UPDATE thread_interaction_counters
+            SET interactionCount = interactionCount + 1,
+                unreadCount = unreadCount + (NEW.read IS 0 AND (NEW.recordType IN (19, 20) OR (NEW.recordType IS 10 AND NEW.messageType IS 11)))
+            WHERE threadUniqueId = NEW.uniqueThreadId;
+        END
+;
+
+CREATE
+    TRIGGER thread_interaction_counters_on_delete
+        AFTER DELETE ON model_TSInteraction
+        BEGIN
+            UPDATE thread_interaction_counters
+            SET interactionCount = interactionCount - 1,
+                unreadCount = unreadCount - (OLD.read IS 0 AND (OLD.recordType IN (19, 20) OR (OLD.recordType IS 10 AND OLD.messageType IS 11)))
+            WHERE threadUniqueId = OLD.uniqueThreadId;
+        END
+;
+
+CREATE
+    TRIGGER thread_interaction_counters_on_update
+        AFTER UPDATE OF uniqueThreadId, read, recordType, messageType ON model_TSInteraction
+        WHEN OLD.uniqueThreadId IS NOT NEW.uniqueThreadId
+        OR OLD.read IS NOT NEW.read
+        OR OLD.recordType IS NOT NEW.recordType
+        OR OLD.messageType IS NOT NEW.messageType
+        BEGIN
+            UPDATE thread_interaction_counters
+            SET interactionCount = interactionCount - 1,
+                unreadCount = unreadCount - (OLD.read IS 0 AND (OLD.recordType IN (19, 20) OR (OLD.recordType IS 10 AND OLD.messageType IS 11)))
+            WHERE threadUniqueId = OLD.uniqueThreadId;
+            INSERT OR IGNORE INTO thread_interaction_counters (threadUniqueId)
+            VALUES (NEW.uniqueThreadId);
+            UPDATE thread_interaction_counters
+            SET interactionCount = interactionCount + 1,
+                unreadCount = unreadCount + (NEW.read IS 0 AND (NEW.recordType IN (19, 20) OR (NEW.recordType IS 10 AND NEW.messageType IS 11)))
+            WHERE threadUniqueId = NEW.uniqueThreadId;
+        END
+;
+
+CREATE
+    INDEX "index_interactions_on_threadUniqueId_and_id_and_uniqueId"
+        ON "model_TSInteraction"("uniqueThreadId"
+    ,"id"
+    ,"uniqueId"
+)
+;
+
+CREATE
+    INDEX "index_interactions_which_failed_to_start_expiring"
+        ON "model_TSInteraction"("uniqueId"
+)
+WHERE storedShouldStartExpireTimer IS TRUE
+AND (expiresAt IS 0 OR expireStartedAt IS 0)
+;
+
+CREATE
+    INDEX "index_attachments_with_lazy_restore_fragments"
+        ON "model_TSAttachment"("lazyRestoreFragmentId"
+)
+WHERE recordType = 3
+AND lazyRestoreFragmentId IS NOT NULL
+;
+
+CREATE
+    TABLE
+        message_reaction_counts (
+            uniqueMessageId TEXT NOT NULL
+            ,emoji TEXT NOT NULL
+            ,reactionCount INTEGER NOT NULL DEFAULT 0
+            ,mostRecentReactionId INTEGER NOT NULL DEFAULT 0
+            ,PRIMARY KEY (uniqueMessageId, emoji)
+        )
+;
+
+CREATE
+    TRIGGER message_reaction_counts_on_insert
+        AFTER INSERT ON model_OWSReaction
+        BEGIN
+            INSERT OR IGNORE INTO message_reaction_counts (uniqueMessageId, emoji)
+            VALUES (NEW.uniqueMessageId, NEW.emoji);
+            UPDATE message_reaction_counts
+            SET reactionCount = reactionCount + 1,
+                mostRecentReactionId = MAX(mostRecentReactionId, NEW.id)
+            WHERE uniqueMessageId = NEW.uniqueMessageId
+            AND emoji = NEW.emoji;
+        END
+;
+
+CREATE
+    TRIGGER message_reaction_counts_on_delete
+        AFTER DELETE ON model_OWSReaction
+        BEGIN
+            UPDATE message_reaction_counts
+            SET reactionCount = reactionCount - 1,
+                mostRecentReactionId = COALESCE((
+                    SELECT MAX(reaction.id)
+                    FROM model_OWSReaction AS reaction
+                    WHERE reaction.uniqueMessageId = OLD.uniqueMessageId
+                    AND reaction.emoji = OLD.emoji
+                ), 0)
+            WHERE uniqueMessageId = OLD.uniqueMessageId
+            AND emoji = OLD.emoji;
+            DELETE FROM message_reaction_counts
+            WHERE uniqueMessageId = OLD.uniqueMessageId
+            AND emoji = OLD.emoji
+            AND reactionCount <= 0;
+        END
+;
+
+CREATE
+    TRIGGER message_reaction_counts_on_update
+        AFTER UPDATE OF uniqueMessageId, emoji ON model_OWSReaction
+        WHEN OLD.uniqueMessageId IS NOT NEW.uniqueMessageId
+        OR OLD.emoji IS NOT NEW.emoji
+        BEGIN
+            UPDATE message_reaction_counts
+            SET reactionCount = reactionCount - 1,
+                mostRecentReactionId = COALESCE((
+                    SELECT MAX(reaction.id)
+                    FROM model_OWSReaction AS reaction
+                    WHERE reaction.uniqueMessageId = OLD.uniqueMessageId
+                    AND reaction.emoji = OLD.emoji
+                ), 0)
+            WHERE uniqueMessageId = OLD.uniqueMessageId
+            AND emoji = OLD.emoji;
+            DELETE FROM message_reaction_counts
+            WHERE uniqueMessageId = OLD.uniqueMessageId
+            AND emoji = OLD.emoji
+            AND reactionCount <= 0;
+            INSERT OR IGNORE INTO message_reaction_counts (uniqueMessageId, emoji)
+            VALUES (NEW.uniqueMessageId, NEW.emoji);
+            UPDATE message_reaction_counts
+            SET reactionCount = reactionCount + 1,
+                mostRecentReactionId = MAX(mostRecentReactionId, NEW.id)
+            WHERE uniqueMessageId = NEW.uniqueMessageId
+            AND emoji = NEW.emoji;
+        END
+;
+
+CREATE
+    TABLE
+        indexable_text_pending (
+            id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL
+            ,collection TEXT NOT NULL
+            ,uniqueId TEXT NOT NULL
+        )
+;
+
+CREATE
+    UNIQUE INDEX index_indexable_text_pending_on_collection_and_uniqueId
+        ON indexable_text_pending(collection
+    ,uniqueId
+)
+;
+
+CREATE
+    TABLE
+        attachment_purge_pending (
+            id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL
+            ,uniqueId TEXT NOT NULL
+        )
+;
+
+CREATE
+    UNIQUE INDEX index_attachment_purge_pending_on_uniqueId
+        ON attachment_purge_pending(uniqueId)
+;
@@ -54,8 +54,8 @@ public class CreatePreKeysOperation: OWSOperation {
             self.signedPreKeyStore.storeSignedPreKey(signedPreKeyRecord.id,
                                                      signedPreKeyRecord: signedPreKeyRecord,
                                                      transaction: transaction)
+            self.preKeyStore.storePreKeyRecords(preKeyRecords, transaction: transaction)
         }
-        self.preKeyStore.storePreKeyRecords(preKeyRecords)
 
         firstly(on: .global()) { () -> Promise<Void> in
             guard self.tsAccountManager.isRegisteredAndReady else {
@@ -9,6 +9,10 @@ import PromiseKit
 // whenever ~2/3 of them have been consumed.
 let kEphemeralPreKeysMinimumCount: UInt = 35
 
+// Once this few remain, we generate the next batch's key pairs in the
+// background, ahead of the refresh that will need them.
+let kEphemeralPreKeysPregenerationCount: UInt = 2 * kEphemeralPreKeysMinimumCount
+
 @objc(SSKRefreshPreKeysOperation)
 public class RefreshPreKeysOperation: OWSOperation {
 
@@ -58,6 +62,9 @@ public class RefreshPreKeysOperation: OWSOperation {
             self.accountServiceClient.getPreKeysCount()
         }.then(on: .global()) { (preKeysCount: Int) -> Promise<Void> in
             Logger.info("preKeysCount: \(preKeysCount)")
+            if preKeysCount < kEphemeralPreKeysPregenerationCount {
+                self.preKeyStore.pregeneratePreKeysIfNecessary()
+            }
             guard preKeysCount < kEphemeralPreKeysMinimumCount || self.signedPreKeyStore.currentSignedPrekeyId() == nil else {
                 Logger.debug("Available keys sufficient: \(preKeysCount)")
                 return Promise.value(())
@@ -71,8 +78,8 @@ public class RefreshPreKeysOperation: OWSOperation {
                 self.signedPreKeyStore.storeSignedPreKey(signedPreKeyRecord.id,
                                                          signedPreKeyRecord: signedPreKeyRecord,
                                                          transaction: transaction)
+                self.preKeyStore.storePreKeyRecords(preKeyRecords, transaction: transaction)
             }
-            self.preKeyStore.storePreKeyRecords(preKeyRecords)
 
             return firstly(on: .global()) { () -> Promise<Void> in
                 self.accountServiceClient.setPreKeys(identityKey: identityKey, signedPreKeyRecord: signedPreKeyRecord, preKeyRecords: preKeyRecords)
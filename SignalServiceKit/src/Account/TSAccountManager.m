@@ -8,6 +8,7 @@
 #import "NSNotificationCenter+OWS.h"
 #import "NSURLSessionDataTask+OWS_HTTP.h"
 #import "OWSError.h"
+#import "OWSReadWriteLock.h"
 #import "OWSRequestFactory.h"
 #import "ProfileManagerProtocol.h"
 #import "RemoteAttestation.h"
@@ -74,6 +75,10 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 // This cache changes all of its properties in lockstep, which
 // helps ensure consistency.  e.g. isRegistered is true IFF
 // localNumber is non-nil.
+//
+// The local identity is checked for almost every message processed and
+// sent, so the registration state is derived once, when the state is
+// loaded, and the local address is built at most once per instance.
 @interface TSAccountState : NSObject
 
 @property (nonatomic, readonly, nullable) NSString *localNumber;
@@ -95,6 +100,20 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 @property (nonatomic, readonly, nullable) NSString *deviceName;
 @property (nonatomic, readonly) UInt32 deviceId;
 
+@property (nonatomic, readonly) OWSRegistrationState registrationState;
+@property (nonatomic, readonly, nullable) SignalServiceAddress *localAddress;
+
+@end
+
+#pragma mark -
+
+@interface TSAccountState ()
+
+// Built lazily, since the address cache may not be ready when the account
+// state is first loaded. Racing threads may each build an address, which is
+// harmless: the addresses are equal.
+@property (atomic, nullable) SignalServiceAddress *cachedLocalAddress;
+
 @end
 
 #pragma mark -
@@ -153,9 +172,44 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
                                 defaultValue:NO
                                  transaction:transaction];
 
+    _registrationState = [self loadRegistrationState];
+
     return self;
 }
 
+- (OWSRegistrationState)loadRegistrationState
+{
+    // An in progress transfer is treated as being deregistered.
+    BOOL isDeregistered = self.isTransferInProgress || self.wasTransferred || self.isDeregistered;
+
+    if (!self.isRegistered) {
+        return OWSRegistrationState_Unregistered;
+    } else if (isDeregistered) {
+        if (self.isReregistering) {
+            return OWSRegistrationState_Reregistering;
+        } else {
+            return OWSRegistrationState_Deregistered;
+        }
+    } else {
+        return OWSRegistrationState_Registered;
+    }
+}
+
+- (nullable SignalServiceAddress *)localAddress
+{
+    if (self.localUuid == nil && self.localNumber == nil) {
+        return nil;
+    }
+
+    SignalServiceAddress *_Nullable localAddress = self.cachedLocalAddress;
+    if (localAddress == nil) {
+        localAddress = [[SignalServiceAddress alloc] initWithUuidString:self.localUuid.UUIDString
+                                                            phoneNumber:self.localNumber];
+        self.cachedLocalAddress = localAddress;
+    }
+    return localAddress;
+}
+
 - (BOOL)isRegistered
 {
     return nil != self.localNumber;
@@ -187,9 +241,18 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 //   _Never_ open a transaction within a @synchronized(self) block.
 // * If you update any account state in the database, reload the cache
 //   immediately.
+//
+// The account state is read far more often than it changes, so readers
+// don't @synchronize at all. The cached account state and the values
+// awaiting verification are instead guarded by stateLock, which readers
+// share. Writers still @synchronize on self and only take stateLock to
+// publish a new value; stateLock is never held while doing anything else.
 @interface TSAccountManager () <UIDatabaseSnapshotDelegate>
 
-// This property should only be accessed while @synchronized on self.
+@property (nonatomic, readonly) OWSReadWriteLock *stateLock;
+
+// This property is guarded by stateLock. It should only be set while
+// @synchronized on self.
 //
 // Generally, it will nil until loaded for the first time (while warming
 // the caches) and non-nil after.
@@ -206,6 +269,7 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 @synthesize phoneNumberAwaitingVerification = _phoneNumberAwaitingVerification;
 @synthesize uuidAwaitingVerification = _uuidAwaitingVerification;
+@synthesize cachedAccountState = _cachedAccountState;
 
 - (instancetype)init
 {
@@ -215,6 +279,7 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
     }
 
     _keyValueStore = [[SDSKeyValueStore alloc] initWithCollection:TSAccountManager_UserAccountCollection];
+    _stateLock = [OWSReadWriteLock new];
 
     OWSSingletonAssert();
 
@@ -288,23 +353,25 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (nullable NSString *)phoneNumberAwaitingVerification
 {
-    @synchronized(self) {
-        return _phoneNumberAwaitingVerification;
-    }
+    [self.stateLock readLock];
+    NSString *_Nullable result = _phoneNumberAwaitingVerification;
+    [self.stateLock unlock];
+    return result;
 }
 
 - (nullable NSUUID *)uuidAwaitingVerification
 {
-    @synchronized(self) {
-        return _uuidAwaitingVerification;
-    }
+    [self.stateLock readLock];
+    NSUUID *_Nullable result = _uuidAwaitingVerification;
+    [self.stateLock unlock];
+    return result;
 }
 
 - (void)setPhoneNumberAwaitingVerification:(NSString *_Nullable)phoneNumberAwaitingVerification
 {
-    @synchronized(self) {
-        _phoneNumberAwaitingVerification = phoneNumberAwaitingVerification;
-    }
+    [self.stateLock writeLock];
+    _phoneNumberAwaitingVerification = phoneNumberAwaitingVerification;
+    [self.stateLock unlock];
 
     [[NSNotificationCenter defaultCenter] postNotificationNameAsync:kNSNotificationName_LocalNumberDidChange
                                                              object:nil
@@ -313,24 +380,29 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (void)setUuidAwaitingVerification:(NSUUID *_Nullable)uuidAwaitingVerification
 {
-    @synchronized(self) {
-        _uuidAwaitingVerification = uuidAwaitingVerification;
-    }
+    [self.stateLock writeLock];
+    _uuidAwaitingVerification = uuidAwaitingVerification;
+    [self.stateLock unlock];
+}
+
+- (nullable TSAccountState *)cachedAccountState
+{
+    [self.stateLock readLock];
+    TSAccountState *_Nullable result = _cachedAccountState;
+    [self.stateLock unlock];
+    return result;
+}
+
+- (void)setCachedAccountState:(nullable TSAccountState *)cachedAccountState
+{
+    [self.stateLock writeLock];
+    _cachedAccountState = cachedAccountState;
+    [self.stateLock unlock];
 }
 
 - (OWSRegistrationState)registrationState
 {
-    if (!self.isRegistered) {
-        return OWSRegistrationState_Unregistered;
-    } else if (self.isDeregistered) {
-        if (self.isReregistering) {
-            return OWSRegistrationState_Reregistering;
-        } else {
-            return OWSRegistrationState_Deregistered;
-        }
-    } else {
-        return OWSRegistrationState_Registered;
-    }
+    return [self getOrLoadAccountStateWithSneakyTransaction].registrationState;
 }
 
 - (TSAccountState *)loadAccountStateWithTransaction:(SDSAnyReadTransaction *)transaction
@@ -346,10 +418,9 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (TSAccountState *)getOrLoadAccountStateWithSneakyTransaction
 {
-    @synchronized (self) {
-        if (self.cachedAccountState != nil) {
-            return self.cachedAccountState;
-        }
+    TSAccountState *_Nullable accountState = self.cachedAccountState;
+    if (accountState != nil) {
+        return accountState;
     }
 
     return [self loadAccountStateWithSneakyTransaction];
@@ -371,16 +442,23 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (TSAccountState *)getOrLoadAccountStateWithTransaction:(SDSAnyReadTransaction *)transaction
 {
+    TSAccountState *_Nullable cachedAccountState = self.cachedAccountState;
+    if (cachedAccountState != nil) {
+        return cachedAccountState;
+    }
+
     @synchronized(self) {
-        if (self.cachedAccountState != nil) {
-            return self.cachedAccountState;
+        // Another thread may have loaded the account state in the meantime.
+        cachedAccountState = self.cachedAccountState;
+        if (cachedAccountState != nil) {
+            return cachedAccountState;
         }
 
-        [self loadAccountStateWithTransaction:transaction];
+        TSAccountState *accountState = [self loadAccountStateWithTransaction:transaction];
 
-        OWSAssertDebug(self.cachedAccountState != nil);
+        OWSAssertDebug(accountState != nil);
 
-        return self.cachedAccountState;
+        return accountState;
     }
 }
 
@@ -402,12 +480,8 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 - (void)didRegister
 {
     OWSLogInfo(@"");
-    NSString *phoneNumber;
-    NSUUID *uuid;
-    @synchronized(self) {
-        phoneNumber = self.phoneNumberAwaitingVerification;
-        uuid = self.uuidAwaitingVerification;
-    }
+    NSString *phoneNumber = self.phoneNumberAwaitingVerification;
+    NSUUID *uuid = self.uuidAwaitingVerification;
 
     if (!phoneNumber) {
         OWSFail(@"phoneNumber was unexpectedly nil");
@@ -456,12 +530,9 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (nullable NSString *)localNumberWithAccountState:(TSAccountState *)accountState
 {
-    @synchronized(self)
-    {
-        NSString *awaitingVerif = self.phoneNumberAwaitingVerification;
-        if (awaitingVerif) {
-            return awaitingVerif;
-        }
+    NSString *_Nullable awaitingVerif = self.phoneNumberAwaitingVerification;
+    if (awaitingVerif) {
+        return awaitingVerif;
     }
 
     return accountState.localNumber;
@@ -479,11 +550,9 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (nullable NSUUID *)localUuidWithAccountState:(TSAccountState *)accountState
 {
-    @synchronized(self) {
-        NSUUID *awaitingVerif = self.uuidAwaitingVerification;
-        if (awaitingVerif) {
-            return awaitingVerif;
-        }
+    NSUUID *_Nullable awaitingVerif = self.uuidAwaitingVerification;
+    if (awaitingVerif) {
+        return awaitingVerif;
     }
 
     return accountState.localUuid;
@@ -496,14 +565,7 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
 
 - (nullable SignalServiceAddress *)localAddressWithTransaction:(SDSAnyReadTransaction *)transaction
 {
-    TSAccountState *accountState = [self getOrLoadAccountStateWithTransaction:transaction];
-
-    if (accountState.localUuid == nil && accountState.localNumber == nil) {
-        return nil;
-    } else {
-        return [[SignalServiceAddress alloc] initWithUuidString:accountState.localUuid.UUIDString
-                                                    phoneNumber:accountState.localNumber];
-    }
+    return [self getOrLoadAccountStateWithTransaction:transaction].localAddress;
 }
 
 + (nullable SignalServiceAddress *)localAddress
@@ -516,6 +578,13 @@ NSString *NSStringForOWSRegistrationState(OWSRegistrationState value)
     // We extract uuid and local number from a single instance of accountState
     // to avoid races.
     TSAccountState *accountState = [self getOrLoadAccountStateWithSneakyTransaction];
+
+    // Only while registering does the local address differ from the
+    // account state's.
+    if (self.phoneNumberAwaitingVerification == nil && self.uuidAwaitingVerification == nil) {
+        return accountState.localAddress;
+    }
+
     NSUUID *_Nullable localUuid = [self localUuidWithAccountState:accountState];
     NSString *_Nullable localNumber = [self localNumberWithAccountState:accountState];
 
@@ -301,6 +301,7 @@ static const NSUInteger kMaxPrekeyUpdateFailureCount = 5;
         (unsigned long)oldAcceptedSignedPreKeyCount);
 
     // Iterate the signed prekeys in ascending order so that we try to delete older keys first.
+    NSMutableArray<SignedPreKeyRecord *> *signedPrekeysToRemove = [NSMutableArray new];
     for (SignedPreKeyRecord *signedPrekey in oldSignedPrekeys) {
 
         OWSLogInfo(@"Considering signed prekey id: %lu., generatedAt: %@, createdAt: %@, wasAcceptedByService: %d",
@@ -336,10 +337,18 @@ static const NSUInteger kMaxPrekeyUpdateFailureCount = 5;
 
         oldSignedPreKeyCount--;
 
-        DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-            [self.signedPreKeyStore removeSignedPreKey:signedPrekey.Id transaction:transaction];
-        });
+        [signedPrekeysToRemove addObject:signedPrekey];
+    }
+
+    if (signedPrekeysToRemove.count < 1) {
+        return;
     }
+    OWSLogInfo(@"Removing signed prekeys: %lu", (unsigned long)signedPrekeysToRemove.count);
+    DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+        for (SignedPreKeyRecord *signedPrekey in signedPrekeysToRemove) {
+            [self.signedPreKeyStore removeSignedPreKey:signedPrekey.Id transaction:transaction];
+        }
+    });
 }
 
 + (void)cullPreKeyRecords {
@@ -216,10 +216,12 @@ NS_ASSUME_NONNULL_BEGIN
     NSMutableDictionary<NSString *, NSString *> *parsedPhoneNumberNameMap = [NSMutableDictionary new];
     NSMutableArray<PhoneNumber *> *parsedPhoneNumbers = [NSMutableArray new];
 
-    for (NSString *phoneNumberString in userTextPhoneNumbers) {
-        for (PhoneNumber *phoneNumber in
-            [PhoneNumber tryParsePhoneNumbersFromUserSpecifiedText:phoneNumberString
-                                                  clientPhoneNumber:[TSAccountManager localNumber]]) {
+    NSArray<NSArray<PhoneNumber *> *> *phoneNumbersForUserTextPhoneNumbers =
+        [PhoneNumber tryParsePhoneNumbersFromUserSpecifiedTexts:userTextPhoneNumbers
+                                              clientPhoneNumber:[TSAccountManager localNumber]];
+    for (NSUInteger index = 0; index < userTextPhoneNumbers.count; index++) {
+        NSString *phoneNumberString = userTextPhoneNumbers[index];
+        for (PhoneNumber *phoneNumber in phoneNumbersForUserTextPhoneNumbers[index]) {
             [parsedPhoneNumbers addObject:phoneNumber];
             NSString *phoneNumberName = phoneNumberNameMap[phoneNumberString];
             if (phoneNumberName) {
@@ -22,11 +22,16 @@ class ModernContactDiscoveryOperation: ContactDiscovering {
     }
 
     func perform(on queue: DispatchQueue) -> Promise<Set<DiscoveredContactInfo>> {
-        firstly { () -> Promise<[Set<CDSRegisteredContact>]> in
+        firstly { () -> Promise<RemoteAttestationAuth> in
+            // Each batch needs its own attestation, since the enclave's request ids
+            // are single-use. But the batches can share one set of auth credentials.
+            RemoteAttestation.getAuthForCDS()
+
+        }.then(on: queue) { (auth: RemoteAttestationAuth) -> Promise<[Set<CDSRegisteredContact>]> in
             // First, build a bunch of batch Promises
-            let batchOperationPromises = Array(e164sToLookup)
+            let batchOperationPromises = Array(self.e164sToLookup)
                 .chunked(by: Self.batchSize)
-                .map { makeContactDiscoveryRequest(e164sToLookup: $0) }
+                .map { self.makeContactDiscoveryRequest(e164sToLookup: $0, auth: auth) }
 
             // Then, wait for them all to be fulfilled before joining the subsets together
             return when(fulfilled: batchOperationPromises)
@@ -45,9 +50,10 @@ class ModernContactDiscoveryOperation: ContactDiscovering {
     // Below, we have a bunch of then blocks being performed on a global concurrent queue
     // It might be worthwhile to audit and see if we can move these onto the queue passed into `perform(on:)`
 
-    private func makeContactDiscoveryRequest(e164sToLookup: [String]) -> Promise<Set<CDSRegisteredContact>> {
+    private func makeContactDiscoveryRequest(e164sToLookup: [String],
+                                             auth: RemoteAttestationAuth) -> Promise<Set<CDSRegisteredContact>> {
         firstly { () -> Promise<RemoteAttestation.CDSAttestation> in
-            RemoteAttestation.performForCDS()
+            RemoteAttestation.performForCDS(auth: auth)
 
         }.then(on: .global()) { (attestation: RemoteAttestation.CDSAttestation) -> Promise<(RemoteAttestation.CDSAttestation, ContactDiscoveryService.IntersectionResponse)> in
             let service = ContactDiscoveryService()
@@ -28,6 +28,11 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSArray<PhoneNumber *> *)tryParsePhoneNumbersFromUserSpecifiedText:(NSString *)text
                                                      clientPhoneNumber:(NSString *)clientPhoneNumber;
 
+// Parses many texts at once, e.g. for a contacts import, fanning the work out
+// across cores. The results are in the same order as the texts.
++ (NSArray<NSArray<PhoneNumber *> *> *)tryParsePhoneNumbersFromUserSpecifiedTexts:(NSArray<NSString *> *)texts
+                                                                   clientPhoneNumber:(NSString *)clientPhoneNumber;
+
 + (NSString *)removeFormattingCharacters:(NSString *)inputString;
 + (NSString *)bestEffortFormatPartialUserSpecifiedTextToLookLikeAPhoneNumber:(NSString *)input;
 + (NSString *)bestEffortFormatPartialUserSpecifiedTextToLookLikeAPhoneNumber:(NSString *)input
@@ -39,10 +39,36 @@ static NSString *const RPDefaultsKeyPhoneNumberCanonical = @"RPDefaultsKeyPhoneN
     return self;
 }
 
+// Contact ingestion, search and indexing parse the same strings over and
+// over on many threads, so the results are shared across threads.
++ (AnyShardedLRUCache *)phoneNumberCache
+{
+    static AnyShardedLRUCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [[AnyShardedLRUCache alloc] initWithMaxSize:8192];
+    });
+    return cache;
+}
+
 + (nullable PhoneNumber *)phoneNumberFromText:(NSString *)text andRegion:(NSString *)regionCode {
     OWSAssertDebug(text != nil);
     OWSAssertDebug(regionCode != nil);
 
+    NSString *cacheKey = [NSString stringWithFormat:@"%@\n%@", regionCode, text];
+    id _Nullable cachedResult = [self.phoneNumberCache getWithKey:cacheKey];
+    if ([cachedResult isKindOfClass:[PhoneNumber class]]) {
+        return (PhoneNumber *)cachedResult;
+    } else if (cachedResult != nil) {
+        return nil;
+    }
+
+    PhoneNumber *_Nullable result = [self parsePhoneNumberFromText:text andRegion:regionCode];
+    [self.phoneNumberCache setWithKey:cacheKey value:result ?: [NSNull null]];
+    return result;
+}
+
++ (nullable PhoneNumber *)parsePhoneNumberFromText:(NSString *)text andRegion:(NSString *)regionCode {
     PhoneNumberUtil *phoneUtil = [PhoneNumberUtil sharedThreadLocal];
 
     NSError *parseError   = nil;
@@ -311,6 +337,40 @@ static NSString *const RPDefaultsKeyPhoneNumberCanonical = @"RPDefaultsKeyPhoneN
     return [result copy];
 }
 
++ (NSArray<NSArray<PhoneNumber *> *> *)tryParsePhoneNumbersFromUserSpecifiedTexts:(NSArray<NSString *> *)texts
+                                                                   clientPhoneNumber:(NSString *)clientPhoneNumber
+{
+    // Below this, fanning out costs more than it saves.
+    const NSUInteger kMinConcurrentCount = 16;
+    if (texts.count < kMinConcurrentCount) {
+        NSMutableArray<NSArray<PhoneNumber *> *> *result = [NSMutableArray new];
+        for (NSString *text in texts) {
+            [result addObject:[self tryParsePhoneNumbersFromUserSpecifiedText:text
+                                                            clientPhoneNumber:clientPhoneNumber]
+                                  ?: @[]];
+        }
+        return [result copy];
+    }
+
+    // Each worker thread uses its own PhoneNumberUtil (and libPhoneNumber
+    // instance), so the workers don't contend.
+    NSUInteger count = texts.count;
+    __strong NSArray<PhoneNumber *> **results
+        = (__strong NSArray<PhoneNumber *> **)calloc(count, sizeof(NSArray<PhoneNumber *> *));
+    dispatch_apply(count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t index) {
+        results[index] = [self tryParsePhoneNumbersFromUserSpecifiedText:texts[index]
+                                                       clientPhoneNumber:clientPhoneNumber];
+    });
+
+    NSMutableArray<NSArray<PhoneNumber *> *> *result = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        [result addObject:results[index] ?: @[]];
+        results[index] = nil;
+    }
+    free(results);
+    return [result copy];
+}
+
 + (NSArray<PhoneNumber *> *)tryParsePhoneNumbersFromNormalizedText:(NSString *)text
                                                  clientPhoneNumber:(NSString *)clientPhoneNumber
 {
@@ -38,6 +38,8 @@ NS_ASSUME_NONNULL_BEGIN
         _nbPhoneNumberUtil = [[NBPhoneNumberUtil alloc] init];
         _countryCodesFromCallingCodeCache = [NSMutableDictionary new];
         _parsedPhoneNumberCache = [NSCache new];
+        // There is one instance per thread, so keep each cache small.
+        _parsedPhoneNumberCache.countLimit = 1024;
     }
 
     return self;
@@ -49,29 +51,41 @@ NS_ASSUME_NONNULL_BEGIN
 {
     NSString *hashKey = [NSString stringWithFormat:@"numberToParse:%@defaultRegion:%@", numberToParse, defaultRegion];
 
-    NBPhoneNumber *result = [self.parsedPhoneNumberCache objectForKey:hashKey];
-
-    if (!result) {
-        result = [self.nbPhoneNumberUtil parse:numberToParse defaultRegion:defaultRegion error:error];
-        if (error && *error) {
-            OWSAssertDebug(!result);
-            return nil;
+    // Failures are cached too, as the same unparseable strings (e.g. short codes
+    // or email addresses in phone number fields) are parsed repeatedly.
+    id _Nullable cachedResult = [self.parsedPhoneNumberCache objectForKey:hashKey];
+    if ([cachedResult isKindOfClass:[NBPhoneNumber class]]) {
+        return (NBPhoneNumber *)cachedResult;
+    } else if ([cachedResult isKindOfClass:[NSError class]]) {
+        if (error) {
+            *error = (NSError *)cachedResult;
         }
+        return nil;
+    } else if (cachedResult != nil) {
+        return nil;
+    }
 
-        OWSAssertDebug(result);
-
-        if (result) {
-            [self.parsedPhoneNumberCache setObject:result forKey:hashKey];
-        } else {
-            [self.parsedPhoneNumberCache setObject:[NSNull null] forKey:hashKey];
+    NSError *_Nullable parseError;
+    NBPhoneNumber *_Nullable result = [self.nbPhoneNumberUtil parse:numberToParse
+                                                      defaultRegion:defaultRegion
+                                                              error:&parseError];
+    if (parseError) {
+        OWSAssertDebug(!result);
+        [self.parsedPhoneNumberCache setObject:parseError forKey:hashKey];
+        if (error) {
+            *error = parseError;
         }
+        return nil;
     }
 
-    if ([result class] == [NSNull class]) {
-        return nil;
+    OWSAssertDebug(result);
+
+    if (result) {
+        [self.parsedPhoneNumberCache setObject:result forKey:hashKey];
     } else {
-        return result;
+        [self.parsedPhoneNumberCache setObject:[NSNull null] forKey:hashKey];
     }
+    return result;
 }
 
 - (NSString *)format:(NBPhoneNumber *)phoneNumber
@@ -209,7 +209,8 @@ static NSString *kSignalPreferNicknamesPreference = @"NSPersonNameDefaultShouldP
 
 - (SignalServiceAddress *)recipientAddress
 {
-    return [[SignalServiceAddress alloc] initWithUuidString:self.recipientUUID phoneNumber:self.recipientPhoneNumber];
+    return [SignalServiceAddress canonicalAddressWithUuidString:self.recipientUUID
+                                                    phoneNumber:self.recipientPhoneNumber];
 }
 
 - (BOOL)hasSameContent:(SignalAccount *)other
@@ -311,7 +311,8 @@ const NSUInteger SignalRecipientSchemaVersion = 1;
 
 - (SignalServiceAddress *)address
 {
-    return [[SignalServiceAddress alloc] initWithUuidString:self.recipientUUID phoneNumber:self.recipientPhoneNumber];
+    return [SignalServiceAddress canonicalAddressWithUuidString:self.recipientUUID
+                                                    phoneNumber:self.recipientPhoneNumber];
 }
 
 #pragma mark -
@@ -655,6 +656,7 @@ const NSUInteger SignalRecipientSchemaVersion = 1;
     [super anyDidInsertWithTransaction:transaction];
 
     [self.signalRecipientReadCache didInsertOrUpdateSignalRecipient:self transaction:transaction];
+    [GroupRecipientDeviceCache.shared didChangeWithRecipient:self transaction:transaction];
 }
 
 - (void)anyDidUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
@@ -662,6 +664,7 @@ const NSUInteger SignalRecipientSchemaVersion = 1;
     [super anyDidUpdateWithTransaction:transaction];
 
     [self.signalRecipientReadCache didInsertOrUpdateSignalRecipient:self transaction:transaction];
+    [GroupRecipientDeviceCache.shared didChangeWithRecipient:self transaction:transaction];
 }
 
 - (void)anyDidRemoveWithTransaction:(SDSAnyWriteTransaction *)transaction
@@ -669,6 +672,7 @@ const NSUInteger SignalRecipientSchemaVersion = 1;
     [super anyDidRemoveWithTransaction:transaction];
 
     [self.signalRecipientReadCache didRemoveSignalRecipient:self transaction:transaction];
+    [GroupRecipientDeviceCache.shared didChangeWithRecipient:self transaction:transaction];
     [self.storageServiceManager recordPendingDeletionsWithDeletedAccountIds:@[ self.accountId ]];
 }
 
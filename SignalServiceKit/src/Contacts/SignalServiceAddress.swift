@@ -95,30 +95,20 @@ public class SignalServiceAddress: NSObject, NSCopying, NSSecureCoding, Codable
     }
 
     @objc
-    public init(uuid: UUID?, phoneNumber: String?, trustLevel: SignalRecipientTrustLevel) {
-        if phoneNumber == nil, let uuid = uuid,
-            let cachedPhoneNumber = SignalServiceAddress.cache.phoneNumber(forUuid: uuid) {
-            backingPhoneNumber = AtomicOptional(cachedPhoneNumber)
-        } else {
-            if let phoneNumber = phoneNumber, phoneNumber.isEmpty {
-                owsFailDebug("Unexpectedly initialized signal service address with invalid phone number")
-            }
-
-            backingPhoneNumber = AtomicOptional(phoneNumber)
+    public convenience init(uuid: UUID?, phoneNumber: String?, trustLevel: SignalRecipientTrustLevel) {
+        if let phoneNumber = phoneNumber, phoneNumber.isEmpty {
+            owsFailDebug("Unexpectedly initialized signal service address with invalid phone number")
         }
 
-        if uuid == nil, let phoneNumber = phoneNumber,
-            let cachedUuid = SignalServiceAddress.cache.uuid(forPhoneNumber: phoneNumber) {
-            backingUuid = AtomicOptional(cachedUuid)
-        } else {
-            backingUuid = AtomicOptional(uuid)
-        }
+        self.init(resolvedAddress: SignalServiceAddress.cache.resolve(uuid: uuid,
+                                                                      phoneNumber: phoneNumber,
+                                                                      trustLevel: trustLevel))
+    }
 
-        backingHashValue = SignalServiceAddress.cache.hashAndCache(
-            uuid: backingUuid.get(),
-            phoneNumber: backingPhoneNumber.get(),
-            trustLevel: trustLevel
-        )
+    fileprivate init(resolvedAddress: SignalServiceAddressCache.ResolvedAddress) {
+        backingUuid = AtomicOptional(resolvedAddress.uuid)
+        backingPhoneNumber = AtomicOptional(resolvedAddress.phoneNumber)
+        backingHashValue = resolvedAddress.hashValue
 
         super.init()
 
@@ -129,6 +119,44 @@ public class SignalServiceAddress: NSObject, NSCopying, NSSecureCoding, Codable
         observeMappingChanges()
     }
 
+    // Returns a shared instance for the given identifiers if one is in use,
+    // and otherwise creates one. Prefer this for addresses which are created
+    // over and over again with the same identifiers, e.g. the author of each
+    // message or the recipient of each thread; sharing instances avoids the
+    // cost of creating and observing an address each time.
+    @objc(canonicalAddressWithUuidString:phoneNumber:)
+    public class func canonicalAddress(uuidString: String?, phoneNumber: String?) -> SignalServiceAddress {
+        let uuid: UUID?
+        if let uuidString = uuidString {
+            uuid = UUID(uuidString: uuidString)
+            if uuid == nil {
+                owsFailDebug("Unexpectedly initialized signal service address with invalid uuid")
+            }
+        } else {
+            uuid = nil
+        }
+        return canonicalAddress(uuid: uuid, phoneNumber: phoneNumber)
+    }
+
+    public class func canonicalAddress(uuid: UUID?, phoneNumber: String?) -> SignalServiceAddress {
+        if let phoneNumber = phoneNumber, phoneNumber.isEmpty {
+            owsFailDebug("Unexpectedly initialized signal service address with invalid phone number")
+        }
+
+        let resolvedAddress = cache.resolve(uuid: uuid, phoneNumber: phoneNumber, trustLevel: .low)
+        return cache.canonicalAddress(for: resolvedAddress) {
+            SignalServiceAddress(resolvedAddress: resolvedAddress)
+        }
+    }
+
+    // A shared instance may only stand in for a new address if it has
+    // exactly the backing values that the new address would have.
+    fileprivate func hasBackingValues(of resolvedAddress: SignalServiceAddressCache.ResolvedAddress) -> Bool {
+        return (backingUuid.get() == resolvedAddress.uuid &&
+                    backingPhoneNumber.get() == resolvedAddress.phoneNumber &&
+                    backingHashValue == resolvedAddress.hashValue)
+    }
+
     // MARK: - Codable
 
     private enum CodingKeys: String, CodingKey {
@@ -213,6 +241,10 @@ public class SignalServiceAddress: NSObject, NSCopying, NSSecureCoding, Codable
             return false
         }
 
+        if otherAddress === self {
+            return true
+        }
+
         if let thisUuid = uuid,
             let otherUuid = otherAddress.uuid {
             return thisUuid == otherUuid
@@ -403,7 +435,7 @@ public extension Array where Element == SignalServiceAddress {
 
 @objc
 public class SignalServiceAddressCache: NSObject {
-    private let serialQueue = DispatchQueue(label: "SignalServiceAddressCache")
+    private let unfairLock = UnfairLock()
 
     private var uuidToPhoneNumberCache = [UUID: String]()
     private var phoneNumberToUUIDCache = [String: UUID]()
@@ -411,6 +443,20 @@ public class SignalServiceAddressCache: NSObject {
     private var uuidToHashValueCache = [UUID: Int]()
     private var phoneNumberToHashValueCache = [String: Int]()
 
+    // Shared address instances, by uuid or, for addresses without a uuid,
+    // by phone number. Addresses are only shared while they are in use.
+    private let canonicalAddressesByUuid = NSMapTable<NSUUID, SignalServiceAddress>(keyOptions: .strongMemory,
+                                                                                    valueOptions: .weakMemory)
+    private let canonicalAddressesByPhoneNumber = NSMapTable<NSString, SignalServiceAddress>(keyOptions: .strongMemory,
+                                                                                             valueOptions: .weakMemory)
+
+    // The backing values and hash of a new address.
+    struct ResolvedAddress {
+        let uuid: UUID?
+        let phoneNumber: String?
+        let hashValue: Int
+    }
+
     @objc
     func warmCaches() {
         let localNumber = TSAccountManager.shared().localNumber
@@ -438,61 +484,118 @@ public class SignalServiceAddressCache: NSObject {
     /// either of these values going forward for the lifetime of the cache.
     @discardableResult
     func hashAndCache(uuid: UUID? = nil, phoneNumber: String? = nil, trustLevel: SignalRecipientTrustLevel) -> Int {
+        return unfairLock.withLock {
+            hashAndCacheLocked(uuid: uuid, phoneNumber: phoneNumber, trustLevel: trustLevel)
+        }
+    }
+
+    /// Fills in whichever of the uuid and phone number is missing from the
+    /// cache, then hashes and caches the result as with `hashAndCache`, all
+    /// at once.
+    func resolve(uuid: UUID?, phoneNumber: String?, trustLevel: SignalRecipientTrustLevel) -> ResolvedAddress {
+        return unfairLock.withLock {
+            var resolvedPhoneNumber = phoneNumber
+            if phoneNumber == nil, let uuid = uuid {
+                resolvedPhoneNumber = uuidToPhoneNumberCache[uuid]
+            }
+            var resolvedUuid = uuid
+            if uuid == nil, let phoneNumber = phoneNumber {
+                resolvedUuid = phoneNumberToUUIDCache[phoneNumber]
+            }
+            let hashValue = hashAndCacheLocked(uuid: resolvedUuid,
+                                               phoneNumber: resolvedPhoneNumber,
+                                               trustLevel: trustLevel)
+            return ResolvedAddress(uuid: resolvedUuid, phoneNumber: resolvedPhoneNumber, hashValue: hashValue)
+        }
+    }
+
+    /// Returns the shared address for the given backing values, if there is
+    /// one. Otherwise, the address created by the given block becomes the
+    /// shared address.
+    func canonicalAddress(for resolvedAddress: ResolvedAddress,
+                          createAddress: () -> SignalServiceAddress) -> SignalServiceAddress {
+        let existingAddress = unfairLock.withLock { () -> SignalServiceAddress? in
+            if let uuid = resolvedAddress.uuid {
+                return canonicalAddressesByUuid.object(forKey: uuid as NSUUID)
+            } else if let phoneNumber = resolvedAddress.phoneNumber {
+                return canonicalAddressesByPhoneNumber.object(forKey: phoneNumber as NSString)
+            } else {
+                return nil
+            }
+        }
+        // The shared address may have been created with a different phone
+        // number, or before the mapping changed.
+        if let existingAddress = existingAddress, existingAddress.hasBackingValues(of: resolvedAddress) {
+            return existingAddress
+        }
+
+        // Creating an address uses the cache, so we can't hold the lock.
+        let address = createAddress()
+        unfairLock.withLock {
+            if let uuid = resolvedAddress.uuid {
+                canonicalAddressesByUuid.setObject(address, forKey: uuid as NSUUID)
+            } else if let phoneNumber = resolvedAddress.phoneNumber {
+                canonicalAddressesByPhoneNumber.setObject(address, forKey: phoneNumber as NSString)
+            }
+        }
+        return address
+    }
+
+    // This method should only be called while holding unfairLock.
+    private func hashAndCacheLocked(uuid: UUID?, phoneNumber: String?, trustLevel: SignalRecipientTrustLevel) -> Int {
         var phoneNumber = phoneNumber
 
         // If we have a UUID, don't trust the phone number for mapping
         // in low trust scenarios.
         if trustLevel == .low, uuid != nil { phoneNumber = nil }
 
-        return serialQueue.sync {
-            // If we have a UUID and a phone number, cache the mapping.
-            if let uuid = uuid, let phoneNumber = phoneNumber {
-                uuidToPhoneNumberCache[uuid] = phoneNumber
-                phoneNumberToUUIDCache[phoneNumber] = uuid
-            }
-
-            // Generate or fetch the unique hash value for this address.
+        // If we have a UUID and a phone number, cache the mapping.
+        if let uuid = uuid, let phoneNumber = phoneNumber {
+            uuidToPhoneNumberCache[uuid] = phoneNumber
+            phoneNumberToUUIDCache[phoneNumber] = uuid
+        }
 
-            let hash: Int
+        // Generate or fetch the unique hash value for this address.
 
-            // If we already have a hash for the UUID, use it.
-            if let uuid = uuid, let uuidHash = uuidToHashValueCache[uuid] {
-                hash = uuidHash
+        let hash: Int
 
-            // Otherwise, if we already have a hash for the phone number, use it.
-            } else if let phoneNumber = phoneNumber, let phoneNumberHash = phoneNumberToHashValueCache[phoneNumber] {
-                hash = phoneNumberHash
+        // If we already have a hash for the UUID, use it.
+        if let uuid = uuid, let uuidHash = uuidToHashValueCache[uuid] {
+            hash = uuidHash
 
-            // Else, create a fresh hash that will be used going forward.
-            } else {
-                hash = UUID().hashValue
-            }
+        // Otherwise, if we already have a hash for the phone number, use it.
+        } else if let phoneNumber = phoneNumber, let phoneNumberHash = phoneNumberToHashValueCache[phoneNumber] {
+            hash = phoneNumberHash
 
-            // Cache the hash we're using to ensure it remains constant across future addresses.
+        // Else, create a fresh hash that will be used going forward.
+        } else {
+            hash = UUID().hashValue
+        }
 
-            if let phoneNumber = phoneNumber {
-                phoneNumberToHashValueCache[phoneNumber] = hash
-            }
+        // Cache the hash we're using to ensure it remains constant across future addresses.
 
-            if let uuid = uuid {
-                uuidToHashValueCache[uuid] = hash
-            }
+        if let phoneNumber = phoneNumber {
+            phoneNumberToHashValueCache[phoneNumber] = hash
+        }
 
-            return hash
+        if let uuid = uuid {
+            uuidToHashValueCache[uuid] = hash
         }
+
+        return hash
     }
 
     func uuid(forPhoneNumber phoneNumber: String) -> UUID? {
-        return serialQueue.sync { phoneNumberToUUIDCache[phoneNumber] }
+        return unfairLock.withLock { phoneNumberToUUIDCache[phoneNumber] }
     }
 
     func phoneNumber(forUuid uuid: UUID) -> String? {
-        return serialQueue.sync { uuidToPhoneNumberCache[uuid] }
+        return unfairLock.withLock { uuidToPhoneNumberCache[uuid] }
     }
 
     @objc
     func updateMapping(uuid: UUID, phoneNumber: String?) {
-        serialQueue.sync {
+        unfairLock.withLock {
             // Maintain the existing hash value for the given UUID, or create
             // a new hash if one is yet to exist.
             let hashValue: Int = {
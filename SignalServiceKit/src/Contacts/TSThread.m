@@ -4,6 +4,7 @@
 
 #import "TSThread.h"
 #import "OWSDisappearingMessagesConfiguration.h"
+#import "OWSOutgoingReceiptManager.h"
 #import "OWSReadTracking.h"
 #import "SSKEnvironment.h"
 #import "TSAccountManager.h"
@@ -405,12 +406,20 @@ lastVisibleSortIdOnScreenPercentageObsolete:(double)lastVisibleSortIdOnScreenPer
 
     InteractionFinder *interactionFinder = [[InteractionFinder alloc] initWithThreadUniqueId:self.uniqueId];
 
-    for (id<OWSReadTracking> message in
-        [interactionFinder allUnreadMessagesWithTransaction:transaction.unwrapGrdbRead]) {
-        [message markAsReadAtTimestamp:[NSDate ows_millisecondTimeStamp]
-                                thread:self
-                          circumstance:circumstance
-                           transaction:transaction];
+    NSArray<id<OWSReadTracking>> *unreadMessages =
+        [interactionFinder allUnreadMessagesWithTransaction:transaction.unwrapGrdbRead];
+    if (unreadMessages.count > 0) {
+        uint64_t readTimestamp = [NSDate ows_millisecondTimeStamp];
+        [SSKEnvironment.shared.outgoingReceiptManager
+            batchReadReceiptsWithTransaction:transaction
+                                       block:^{
+                                           for (id<OWSReadTracking> message in unreadMessages) {
+                                               [message markAsReadAtTimestamp:readTimestamp
+                                                                       thread:self
+                                                                 circumstance:circumstance
+                                                                  transaction:transaction];
+                                           }
+                                       }];
     }
 
     [self clearMarkedAsUnreadAndUpdateStorageService:updateStorageService transaction:transaction];
@@ -167,7 +167,7 @@ lastVisibleSortIdOnScreenPercentageObsolete:lastVisibleSortIdOnScreenPercentageO
 
 - (SignalServiceAddress *)contactAddress
 {
-    return [[SignalServiceAddress alloc] initWithUuidString:self.contactUUID phoneNumber:self.contactPhoneNumber];
+    return [SignalServiceAddress canonicalAddressWithUuidString:self.contactUUID phoneNumber:self.contactPhoneNumber];
 }
 
 - (NSArray<SignalServiceAddress *> *)recipientAddresses
@@ -20,13 +20,35 @@ public struct ChunkedInputStream {
     /// Based on SwiftProtobuf.BinaryDecoder.available
     private var available: Int
 
+    private let start: UnsafePointer<UInt8>
+
     /// Based on SwiftProtobuf.BinaryDecoder.init
     public init(forReadingFrom pointer: UnsafePointer<UInt8>, count: Int) {
         p = pointer
         available = count
+        start = pointer
+    }
+
+    /// The number of bytes consumed so far.
+    ///
+    /// Between records, this can be persisted and later passed to
+    /// skip(toOffset:) to resume reading from the same input.
+    public var offset: Int {
+        return start.distance(to: p)
+    }
+
+    public mutating func skip(toOffset offset: Int) throws {
+        let length = offset - self.offset
+        guard length >= 0, length <= available else {
+            throw ChunkedInputStreamError.truncated
+        }
+        consume(length: length)
     }
 
     internal mutating func decodeData(value: inout Data, count: Int) throws {
+        guard count >= 0, count <= available else {
+            throw ChunkedInputStreamError.truncated
+        }
         value = Data(bytes: p, count: count)
         consume(length: count)
     }
@@ -24,6 +24,11 @@ public class ContactsInputStream {
         self.inputStream = inputStream
     }
 
+    /// The offset of the next contact in the input.
+    public var offset: Int {
+        return inputStream.offset
+    }
+
     public func decodeContact() throws -> ContactDetails? {
         guard !inputStream.isEmpty else {
             return nil
@@ -23,6 +23,11 @@ public class GroupsInputStream {
         self.inputStream = inputStream
     }
 
+    /// The offset of the next group in the input.
+    public var offset: Int {
+        return inputStream.offset
+    }
+
     public func decodeGroup() throws -> GroupDetails? {
         guard !inputStream.isEmpty else {
             return nil
@@ -0,0 +1,73 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Applies the records of an incoming contact or group sync blob a batch at a
+// time, rather than in one write transaction for the whole blob.
+//
+// The offset of the next record is committed along with each batch, keyed by
+// the job record. If the app is terminated mid-blob, the next attempt of the
+// same job resumes from that offset instead of starting over.
+public class IncomingSyncBatchProcessor {
+
+    public static let batchSize = 50
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "IncomingSyncBatchProcessor.resumeOffset")
+
+    private let jobRecord: SSKJobRecord
+    private let databaseStorage: SDSDatabaseStorage
+
+    public init(jobRecord: SSKJobRecord, databaseStorage: SDSDatabaseStorage = SDSDatabaseStorage.shared) {
+        self.jobRecord = jobRecord
+        self.databaseStorage = databaseStorage
+    }
+
+    /// The offset at which an earlier attempt of this job stopped, if any.
+    public func resumeOffset() -> Int {
+        databaseStorage.read { transaction in
+            Self.keyValueStore.getInt(self.jobRecord.uniqueId, defaultValue: 0, transaction: transaction)
+        }
+    }
+
+    /// Calls `processNextRecord` until it returns false, committing each
+    /// batch of records together with the `offset()` reached.
+    ///
+    /// `didProcessAllRecords` is called in the transaction of the last batch.
+    public func processRecords(offset: @escaping () -> Int,
+                               processNextRecord: @escaping (SDSAnyWriteTransaction) throws -> Bool,
+                               didProcessAllRecords: @escaping (SDSAnyWriteTransaction) -> Void) throws {
+        var hasMoreRecords = true
+        var batchCount = 0
+        while hasMoreRecords {
+            try databaseStorage.write { transaction in
+                var recordCount = 0
+                while recordCount < Self.batchSize {
+                    let didProcessRecord = try autoreleasepool {
+                        try processNextRecord(transaction)
+                    }
+                    guard didProcessRecord else {
+                        hasMoreRecords = false
+                        break
+                    }
+                    recordCount += 1
+                }
+
+                if hasMoreRecords {
+                    Self.keyValueStore.setInt(offset(), key: self.jobRecord.uniqueId, transaction: transaction)
+                } else {
+                    Self.keyValueStore.removeValue(forKey: self.jobRecord.uniqueId, transaction: transaction)
+                    didProcessAllRecords(transaction)
+                }
+            }
+            batchCount += 1
+        }
+        Logger.info("Processed sync records in \(batchCount) batches.")
+    }
+
+    /// Should be called if the job fails permanently.
+    public func discardResumeOffset(transaction: SDSAnyWriteTransaction) {
+        Self.keyValueStore.removeValue(forKey: jobRecord.uniqueId, transaction: transaction)
+    }
+}
@@ -14,6 +14,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithOutputStream:(NSOutputStream *)outputStream;
 
+// Writes to a new temporary file rather than holding everything in memory,
+// e.g. for sync messages with many contacts or groups. Call
+// finishTemporaryFile once everything has been written.
++ (instancetype)streamToTemporaryFileWithFileExtension:(NSString *)fileExtension;
+
+// Closes the temporary file and returns its URL, or deletes it and returns
+// nil if any write failed. The caller is responsible for deleting the file.
+- (nullable NSURL *)finishTemporaryFile;
+
 // Returns NO on error.
 - (BOOL)writeData:(NSData *)data;
 - (BOOL)writeVariableLengthUInt32:(UInt32)value;
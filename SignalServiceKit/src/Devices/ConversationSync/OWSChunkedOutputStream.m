@@ -3,7 +3,9 @@
 //
 
 #import "OWSChunkedOutputStream.h"
+#import "OWSFileSystem.h"
 #import <SignalCoreKit/NSData+OWS.h>
+#import <SignalServiceKit/SignalServiceKit-Swift.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -11,6 +13,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, readonly) NSOutputStream *outputStream;
 @property (nonatomic) BOOL hasError;
+@property (nonatomic, nullable) NSURL *temporaryFileUrl;
 
 @end
 
@@ -28,6 +31,47 @@ NS_ASSUME_NONNULL_BEGIN
     return self;
 }
 
++ (instancetype)streamToTemporaryFileWithFileExtension:(NSString *)fileExtension
+{
+    NSURL *fileUrl = [OWSFileSystem temporaryFileUrlWithFileExtension:fileExtension isAvailableWhileDeviceLocked:YES];
+    NSOutputStream *_Nullable fileOutputStream = [NSOutputStream outputStreamWithURL:fileUrl append:NO];
+    if (fileOutputStream == nil) {
+        OWSFailDebug(@"Could not create output stream.");
+        // Writes to an unopened memory stream fail, so the caller will see an error.
+        fileOutputStream = [NSOutputStream outputStreamToMemory];
+    } else {
+        [fileOutputStream open];
+    }
+
+    OWSChunkedOutputStream *stream = [[self alloc] initWithOutputStream:fileOutputStream];
+    stream.temporaryFileUrl = fileUrl;
+    return stream;
+}
+
+- (nullable NSURL *)finishTemporaryFile
+{
+    NSURL *_Nullable fileUrl = self.temporaryFileUrl;
+    if (fileUrl == nil) {
+        OWSFailDebug(@"Not writing to a temporary file.");
+        return nil;
+    }
+    self.temporaryFileUrl = nil;
+
+    [self.outputStream close];
+
+    if (self.hasError || ![OWSFileSystem fileOrFolderExistsAtPath:fileUrl.path]) {
+        [OWSFileSystem deleteFileIfExists:fileUrl.path];
+        return nil;
+    }
+    if (![OWSFileSystem protectFileOrFolderAtPath:fileUrl.path
+                               fileProtectionType:NSFileProtectionCompleteUntilFirstUserAuthentication]) {
+        OWSFailDebug(@"Could not protect temporary file.");
+        [OWSFileSystem deleteFileIfExists:fileUrl.path];
+        return nil;
+    }
+    return fileUrl;
+}
+
 - (BOOL)writeByte:(uint8_t)value
 {
     NSInteger written = [self.outputStream write:&value maxLength:sizeof(value)];
@@ -79,11 +79,8 @@ NS_ASSUME_NONNULL_BEGIN
         return nil;
     }
 
-    SSKProtoContentBuilder *contentBuilder = [SSKProtoContent builder];
-    [contentBuilder setReceiptMessage:receiptMessage];
-
     NSError *error;
-    NSData *_Nullable contentData = [contentBuilder buildSerializedDataAndReturnError:&error];
+    NSData *_Nullable contentData = [SSKProtoContent serializedDataWithReceiptMessage:receiptMessage error:&error];
     if (error || !contentData) {
         OWSFailDebug(@"could not serialize protobuf: %@", error);
         return nil;
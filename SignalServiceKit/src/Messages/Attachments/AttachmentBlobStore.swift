@@ -0,0 +1,350 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import CommonCrypto
+
+// Shares the files of attachment streams with identical contents,
+// e.g. the same image forwarded to several threads, or a sticker
+// that is sent repeatedly.
+//
+// The store keeps one file per distinct content, named after an
+// HMAC-SHA256 of the plaintext under a key that never leaves the
+// keychain, so that blob names don't reveal what the blobs contain.
+// Each stream's file is a hard link to its blob, so the file system
+// does the reference counting: the blob's link count is one more than
+// the number of streams using it. Readers of a stream's file are
+// unaware of the sharing.
+//
+// Stream files should be deleted with removeFile(atPath:), which also
+// deletes the blob once no other stream uses it.
+//
+// Since linked files share their contents, a shared file is replaced
+// with its own copy before it is written; see writeFile(atPath:block:).
+// On APFS the copy is a clone, so it is cheap.
+//
+// Files are hashed and linked on serialQueue after they are written,
+// off the write path.
+@objc
+public class AttachmentBlobStore: NSObject {
+
+    static let serialQueue = DispatchQueue(label: "org.whispersystems.signal.attachmentBlobStore",
+                                           qos: .utility,
+                                           autoreleaseFrequency: .workItem)
+
+    @objc
+    public static var blobsDirPath: String {
+        return (TSAttachmentStream.attachmentsFolder() as NSString).appendingPathComponent("Blobs")
+    }
+
+    @objc
+    public static func isBlobFilePath(_ filePath: String) -> Bool {
+        return filePath.hasPrefix(blobsDirPath + "/")
+    }
+
+    // Blobs which no stream links to can be removed. Removing a blob
+    // never loses data, since streams keep their own links.
+    @objc
+    public static func isUnreferencedBlob(atPath filePath: String) -> Bool {
+        owsAssertDebug(isBlobFilePath(filePath))
+
+        guard let linkCount = linkCount(ofPath: filePath) else {
+            return false
+        }
+        return linkCount <= 1
+    }
+
+    // Deletes an attachment's file, and its blob if no other file links to it.
+    @objc
+    @discardableResult
+    public static func removeFile(atPath filePath: String) -> Bool {
+        return withFileLock(forPath: filePath) {
+            // If the file has exactly one other link, it's the file's blob.
+            if linkCount(ofPath: filePath) == 2,
+                let blobName = blobName(ofFileAtPath: filePath) {
+                let blobPath = (blobsDirPath as NSString).appendingPathComponent(blobName)
+                withFileLock(forPath: blobPath) { () -> Void in
+                    // Another file may have been linked to the blob since we checked.
+                    guard linkCount(ofPath: filePath) == 2,
+                        let fileNumber = FileIdentity(path: filePath)?.fileNumber,
+                        FileIdentity(path: blobPath)?.fileNumber == fileNumber else {
+                            return
+                    }
+                    if !OWSFileSystem.deleteFileIfExists(blobPath) {
+                        Logger.warn("Could not remove blob.")
+                    }
+                }
+            }
+            return OWSFileSystem.deleteFileIfExists(filePath)
+        }
+    }
+
+    // Every write to an attachment's file should go through this method.
+    // If the file is shared, it is first replaced with a copy, so that
+    // writing it can't modify the other attachments' files. Once the block
+    // has written the file, it is deduplicated asynchronously.
+    @objc
+    public static func writeFile(atPath filePath: String, block: () -> Bool) -> Bool {
+        let success: Bool = withFileLock(forPath: filePath) {
+            unshareFile(atPath: filePath)
+            return block()
+        }
+        if success {
+            serialQueue.async {
+                deduplicateFile(atPath: filePath)
+            }
+        }
+        return success
+    }
+
+    // Replaces the file with a link to an existing blob with the same
+    // contents, or else adds the file to the store. Either way, the
+    // file's contents are unchanged.
+    private static func deduplicateFile(atPath filePath: String) {
+        assertOnQueue(serialQueue)
+
+        guard OWSFileSystem.ensureDirectoryExists(blobsDirPath) else {
+            owsFailDebug("Could not create blobs directory.")
+            return
+        }
+        guard let identity = FileIdentity(path: filePath),
+            identity.fileSize > 0 else {
+                return
+        }
+        guard let blobNameKey = self.blobNameKey else {
+            // e.g. the keychain isn't available before first unlock.
+            Logger.warn("Missing blob name key.")
+            return
+        }
+        guard let blobName = computeBlobName(ofFileAtPath: filePath, key: blobNameKey) else {
+            Logger.warn("Could not compute blob name.")
+            return
+        }
+        let blobPath = (blobsDirPath as NSString).appendingPathComponent(blobName)
+
+        withFileLock(forPath: filePath) { () -> Void in
+            // The file may have been written again while we hashed it.
+            guard FileIdentity(path: filePath) == identity else {
+                Logger.info("File changed while being deduplicated.")
+                return
+            }
+
+            withFileLock(forPath: blobPath) { () -> Void in
+                if let blobSize = OWSFileSystem.fileSize(ofPath: blobPath)?.uint64Value {
+                    guard blobSize == identity.fileSize else {
+                        owsFailDebug("Blob has unexpected size.")
+                        return
+                    }
+                    replaceFile(atPath: filePath, withLinkToBlobAtPath: blobPath)
+                } else {
+                    do {
+                        try FileManager.default.linkItem(atPath: filePath, toPath: blobPath)
+                    } catch {
+                        Logger.warn("Could not add blob: \(error)")
+                        return
+                    }
+                    setBlobName(blobName, ofFileAtPath: blobPath)
+                }
+            }
+        }
+    }
+
+    // MARK: - Blob Names
+
+    private static let blobNameKeyService = "OWSAttachmentBlobStore"
+    private static let blobNameKeyName = "blobNameKey"
+    private static let blobNameKeyLength: Int32 = 32
+
+    // This property should only be accessed on serialQueue.
+    private static var cachedBlobNameKey: Data?
+
+    private static var blobNameKey: Data? {
+        assertOnQueue(serialQueue)
+
+        if let blobNameKey = cachedBlobNameKey {
+            return blobNameKey
+        }
+        let keychainStorage = CurrentAppContext().keychainStorage()
+        do {
+            if let blobNameKey = try keychainStorage.optionalData(forService: blobNameKeyService,
+                                                                  key: blobNameKeyName) {
+                cachedBlobNameKey = blobNameKey
+                return blobNameKey
+            }
+            try keychainStorage.set(data: Randomness.generateRandomBytes(blobNameKeyLength),
+                                    service: blobNameKeyService,
+                                    key: blobNameKeyName)
+            // Re-read the key, in case another process stored one at the same time.
+            let blobNameKey = try keychainStorage.data(forService: blobNameKeyService, key: blobNameKeyName)
+            cachedBlobNameKey = blobNameKey
+            return blobNameKey
+        } catch {
+            Logger.warn("Could not load blob name key: \(error)")
+            return nil
+        }
+    }
+
+    private static func computeBlobName(ofFileAtPath filePath: String, key: Data) -> String? {
+        guard let fileHandle = FileHandle(forReadingAtPath: filePath) else {
+            return nil
+        }
+        defer { fileHandle.closeFile() }
+
+        var hmacContext = CCHmacContext()
+        key.withUnsafeBytes {
+            CCHmacInit(&hmacContext, CCHmacAlgorithm(kCCHmacAlgSHA256), $0.baseAddress, key.count)
+        }
+        while true {
+            let chunk: Data = autoreleasepool {
+                fileHandle.readData(ofLength: AttachmentStreamEncrypter.chunkSize)
+            }
+            guard !chunk.isEmpty else {
+                break
+            }
+            chunk.withUnsafeBytes {
+                CCHmacUpdate(&hmacContext, $0.baseAddress, chunk.count)
+            }
+        }
+        var hmac = Data(count: Int(CC_SHA256_DIGEST_LENGTH))
+        hmac.withUnsafeMutableBytes {
+            CCHmacFinal(&hmacContext, $0.baseAddress)
+        }
+        return hmac.hexadecimalString
+    }
+
+    // A blob's name is also stored in an extended attribute of its file.
+    // Attributes belong to the file rather than the path, so a stream's
+    // file can find its blob without hashing the file again.
+    private static let blobNameAttribute = "org.whispersystems.signal.blobName"
+
+    private static func setBlobName(_ blobName: String, ofFileAtPath filePath: String) {
+        let value = Data(blobName.utf8)
+        let result = value.withUnsafeBytes {
+            setxattr(filePath, blobNameAttribute, $0.baseAddress, value.count, 0, 0)
+        }
+        if result != 0 {
+            Logger.warn("Could not set blob name: \(errno)")
+        }
+    }
+
+    private static func blobName(ofFileAtPath filePath: String) -> String? {
+        let length = getxattr(filePath, blobNameAttribute, nil, 0, 0, 0)
+        guard length > 0 else {
+            return nil
+        }
+        var value = Data(count: length)
+        let result = value.withUnsafeMutableBytes {
+            getxattr(filePath, blobNameAttribute, $0.baseAddress, length, 0, 0)
+        }
+        guard result == length else {
+            return nil
+        }
+        return String(data: value, encoding: .utf8)
+    }
+
+    // If other paths link to the file, replace it with a copy of its own.
+    private static func unshareFile(atPath filePath: String) {
+        guard let linkCount = linkCount(ofPath: filePath), linkCount > 1 else {
+            return
+        }
+        let tempPath = temporaryPath(besidePath: filePath)
+        do {
+            try FileManager.default.copyItem(atPath: filePath, toPath: tempPath)
+        } catch {
+            owsFailDebug("Could not copy shared file: \(error)")
+            // Drop this path's link rather than write through it.
+            OWSFileSystem.deleteFileIfExists(filePath)
+            return
+        }
+        guard rename(tempPath, filePath) == 0 else {
+            owsFailDebug("Could not replace shared file: \(errno)")
+            OWSFileSystem.deleteFileIfExists(tempPath)
+            OWSFileSystem.deleteFileIfExists(filePath)
+            return
+        }
+    }
+
+    private static func replaceFile(atPath filePath: String, withLinkToBlobAtPath blobPath: String) {
+        // Link into the same directory, then rename over the file, so that
+        // the file is never missing or partially replaced.
+        let tempPath = temporaryPath(besidePath: filePath)
+        do {
+            try FileManager.default.linkItem(atPath: blobPath, toPath: tempPath)
+        } catch {
+            Logger.warn("Could not link blob: \(error)")
+            return
+        }
+        guard rename(tempPath, filePath) == 0 else {
+            owsFailDebug("Could not replace file: \(errno)")
+            OWSFileSystem.deleteFileIfExists(tempPath)
+            return
+        }
+    }
+
+    private static func temporaryPath(besidePath filePath: String) -> String {
+        return (filePath as NSString).deletingLastPathComponent + "/" + UUID().uuidString
+    }
+
+    private static func linkCount(ofPath filePath: String) -> Int? {
+        guard let attributes = try? FileManager.default.attributesOfItem(atPath: filePath),
+            let linkCount = attributes[.referenceCount] as? NSNumber else {
+                return nil
+        }
+        return linkCount.intValue
+    }
+
+    // Identifies the contents of a file, to detect that it was written.
+    private struct FileIdentity: Equatable {
+        let fileNumber: UInt64
+        let fileSize: UInt64
+        let modificationDate: Date
+
+        init?(path: String) {
+            guard let attributes = try? FileManager.default.attributesOfItem(atPath: path),
+                let fileNumber = attributes[.systemFileNumber] as? NSNumber,
+                let fileSize = attributes[.size] as? NSNumber,
+                let modificationDate = attributes[.modificationDate] as? Date else {
+                    return nil
+            }
+            self.fileNumber = fileNumber.uint64Value
+            self.fileSize = fileSize.uint64Value
+            self.modificationDate = modificationDate
+        }
+    }
+
+    // MARK: - File Locks
+
+    // Writes to a file and its deduplication are serialized by a lock for
+    // the file's path, so that deduplication never replaces newer contents.
+    private class FileLock {
+        let lock = NSLock()
+        var userCount = 0
+    }
+
+    private static let fileLocksLock = UnfairLock()
+    // This property should only be accessed with fileLocksLock.
+    private static var fileLocks = [String: FileLock]()
+
+    @discardableResult
+    private static func withFileLock<T>(forPath filePath: String, block: () -> T) -> T {
+        let fileLock: FileLock = fileLocksLock.withLock {
+            let fileLock = fileLocks[filePath] ?? FileLock()
+            fileLock.userCount += 1
+            fileLocks[filePath] = fileLock
+            return fileLock
+        }
+        defer {
+            fileLocksLock.withLock {
+                fileLock.userCount -= 1
+                if fileLock.userCount == 0 {
+                    fileLocks.removeValue(forKey: filePath)
+                }
+            }
+        }
+
+        fileLock.lock.lock()
+        defer { fileLock.lock.unlock() }
+        return block()
+    }
+}
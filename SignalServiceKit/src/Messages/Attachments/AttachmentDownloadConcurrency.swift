@@ -0,0 +1,114 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Decides how many attachment downloads may run at once.
+//
+// The limit is bounded by the kind of network we're on, and within those
+// bounds it hill-climbs on measured throughput: we try one more download
+// at a time while that increases aggregate throughput, and back off when
+// it decreases it.
+@objc
+public class AttachmentDownloadConcurrency: NSObject {
+
+    static let minLimit = 1
+    static let wifiMaxLimit = 8
+    static let cellularMaxLimit = 4
+    static let initialLimit = 4
+
+    // Weight of the latest sample in the moving average of each level's throughput.
+    private static let sampleWeight = 0.3
+    // How much more throughput a higher limit must yield to be worth keeping.
+    private static let improvementThreshold = 1.1
+
+    private let unfairLock = UnfairLock()
+
+    // These properties should only be accessed with unfairLock.
+    private var limit = initialLimit
+    // The average aggregate throughput, in bytes per second, at each limit.
+    private var throughputByLimit = [Int: Double]()
+
+    // Returns the most downloads that the current network should run at once.
+    private let networkMaxLimit: () -> Int
+
+    @objc
+    public convenience override init() {
+        self.init(networkMaxLimit: {
+            let reachabilityManager = SSKEnvironment.shared.reachabilityManager
+            if reachabilityManager.isReachable(via: .wifi) {
+                return AttachmentDownloadConcurrency.wifiMaxLimit
+            } else if reachabilityManager.isReachable(via: .cellular) {
+                return AttachmentDownloadConcurrency.cellularMaxLimit
+            } else {
+                return AttachmentDownloadConcurrency.minLimit
+            }
+        })
+    }
+
+    init(networkMaxLimit: @escaping () -> Int) {
+        self.networkMaxLimit = networkMaxLimit
+
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(reachabilityDidChange),
+                                               name: SSKReachability.owsReachabilityDidChange,
+                                               object: nil)
+    }
+
+    @objc
+    private func reachabilityDidChange() {
+        // Measurements from another network don't apply.
+        let maxLimit = networkMaxLimit()
+        unfairLock.withLock {
+            limit = min(Self.initialLimit, maxLimit)
+            throughputByLimit.removeAll()
+        }
+    }
+
+    @objc
+    public var maxConcurrentDownloads: Int {
+        let maxLimit = networkMaxLimit()
+        return unfairLock.withLock {
+            max(Self.minLimit, min(limit, maxLimit))
+        }
+    }
+
+    @objc
+    public func didCompleteDownload(byteCount: UInt,
+                                    duration: TimeInterval,
+                                    concurrentDownloadCount: Int) {
+        guard byteCount > 0, duration > 0, concurrentDownloadCount > 0 else {
+            return
+        }
+        // Downloads running alongside this one shared the bandwidth.
+        let throughput = Double(byteCount) / duration * Double(concurrentDownloadCount)
+        let maxLimit = networkMaxLimit()
+
+        unfairLock.withLock {
+            let level = min(concurrentDownloadCount, limit)
+            if let average = throughputByLimit[level] {
+                throughputByLimit[level] = average * (1 - Self.sampleWeight) + throughput * Self.sampleWeight
+            } else {
+                throughputByLimit[level] = throughput
+            }
+
+            // Only adjust once we're measuring at the current limit.
+            guard level == limit, let current = throughputByLimit[limit] else {
+                return
+            }
+            if let lower = throughputByLimit[limit - 1], current < lower {
+                limit = max(Self.minLimit, limit - 1)
+            } else if let higher = throughputByLimit[limit + 1] {
+                if higher > current * Self.improvementThreshold {
+                    limit = min(maxLimit, limit + 1)
+                }
+            } else if throughputByLimit[limit - 1].map({ current > $0 * Self.improvementThreshold }) ?? true {
+                // Probe the next level up.
+                limit = min(maxLimit, limit + 1)
+            }
+        }
+    }
+}
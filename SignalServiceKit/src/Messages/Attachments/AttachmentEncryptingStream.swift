@@ -0,0 +1,114 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// Provides the body of an attachment upload, encrypting the attachment
+// as the upload reads it. The ciphertext is never written to disk, and
+// at most a few chunks of it are in memory at once.
+//
+// Each body stream is one end of a bound stream pair. The encrypter
+// writes into the other end on its own queue, blocking while the buffer
+// is full.
+//
+// URLSession asks for a new body stream if it has to send the body
+// again, e.g. after a redirect or an authentication challenge. Since
+// encryption is deterministic given the key and IV, every stream
+// produces the same body.
+class AttachmentEncryptingStream {
+
+    private static let bufferSize = 2 * AttachmentStreamEncrypter.chunkSize
+
+    private static let writeQueue = DispatchQueue(label: "org.whispersystems.signal.attachmentEncryptingStream",
+                                                  qos: .utility,
+                                                  attributes: .concurrent,
+                                                  autoreleaseFrequency: .workItem)
+
+    private let makeEncrypter: () throws -> AttachmentStreamEncrypter
+    private let plaintextFileUrl: URL
+    private let skippedLength: Int
+
+    let bodyLength: Int
+
+    // Resolves with the digest of the encrypted attachment once any body
+    // stream has been written in full. Every stream produces the same body,
+    // so they all produce the same digest.
+    let digestPromise: Promise<Data>
+    private let digestResolver: Resolver<Data>
+
+    private let lock = UnfairLock()
+    // This property should only be accessed with lock.
+    private var latestWriteIsAbandoned: AtomicBool?
+
+    // The body is the encrypted attachment, less its first skippedLength bytes.
+    // Every body stream encrypts the attachment with a new encrypter, which
+    // must use the same key and IV.
+    init(encryptedLength: Int,
+         plaintextFileUrl: URL,
+         skippingLength skippedLength: Int = 0,
+         makeEncrypter: @escaping () throws -> AttachmentStreamEncrypter) {
+        self.makeEncrypter = makeEncrypter
+        self.plaintextFileUrl = plaintextFileUrl
+        self.skippedLength = skippedLength
+        self.bodyLength = encryptedLength - skippedLength
+
+        (digestPromise, digestResolver) = Promise<Data>.pending()
+    }
+
+    // Returns a new body stream and starts encrypting the attachment into
+    // it. Any previous body stream is abandoned.
+    func makeInputStream() -> InputStream? {
+        let encrypter: AttachmentStreamEncrypter
+        do {
+            encrypter = try makeEncrypter()
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return nil
+        }
+
+        var inputStream: InputStream?
+        var outputStream: OutputStream?
+        Stream.getBoundStreams(withBufferSize: Self.bufferSize,
+                               inputStream: &inputStream,
+                               outputStream: &outputStream)
+        guard let bodyStream = inputStream, let outputStream = outputStream else {
+            owsFailDebug("Could not create bound streams.")
+            return nil
+        }
+
+        let isAbandoned = AtomicBool(false)
+        lock.withLock {
+            latestWriteIsAbandoned?.set(true)
+            latestWriteIsAbandoned = isAbandoned
+        }
+
+        Self.writeQueue.async {
+            outputStream.open()
+            defer {
+                // Closing the stream ends the body.
+                outputStream.close()
+            }
+            do {
+                try encrypter.encryptFile(at: self.plaintextFileUrl,
+                                          skippingLength: self.skippedLength) { encrypted in
+                    guard !isAbandoned.get() else {
+                        throw OWSGenericError("Body stream was abandoned.")
+                    }
+                    // This fails once the upload stops reading, e.g. if it fails.
+                    try outputStream.writeChunk(encrypted)
+                }
+                guard let digest = encrypter.digest else {
+                    throw OWSAssertionError("Missing digest.")
+                }
+                self.digestResolver.fulfill(digest)
+            } catch {
+                // The upload stopped reading this stream, whether because it
+                // failed or because it asked for a new one.
+                Logger.warn("Body stream ended early: \(error)")
+            }
+        }
+        return bodyStream
+    }
+}
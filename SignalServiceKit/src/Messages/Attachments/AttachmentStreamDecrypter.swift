@@ -0,0 +1,227 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import CommonCrypto
+
+// Decrypts an encrypted attachment file into a plaintext file a chunk at
+// a time, so that memory use doesn't grow with the size of the attachment.
+//
+// This is equivalent to Cryptography.decryptAttachment(). The encrypted
+// file is laid out as:
+//
+//     IV (16 bytes) || AES-256-CBC ciphertext || HMAC-SHA256 (32 bytes)
+//
+// The key is the AES key followed by the HMAC key. The HMAC covers the IV
+// and ciphertext, and the digest is the SHA-256 of the whole file. The
+// plaintext is padded; unpaddedSize is the size of the attachment itself.
+//
+// Plaintext is written before the HMAC and digest can be checked, so the
+// output file must not be used unless decryption succeeds; it is deleted
+// if decryption fails.
+enum AttachmentStreamDecrypter {
+
+    private static let ivLength = 16
+    private static let hmacLength = Int(CC_SHA256_DIGEST_LENGTH)
+    private static let aesKeyLength = 32
+    private static let hmacKeyLength = 32
+
+    static let chunkSize = 64 * 1024
+
+    static func decrypt(encryptedFileUrl: URL,
+                        encryptionKey: Data,
+                        digest: Data?,
+                        unpaddedSize: UInt32,
+                        outputFileUrl: URL) throws {
+        do {
+            try decryptUnsafe(encryptedFileUrl: encryptedFileUrl,
+                              encryptionKey: encryptionKey,
+                              digest: digest,
+                              unpaddedSize: unpaddedSize,
+                              outputFileUrl: outputFileUrl)
+        } catch {
+            try? OWSFileSystem.deleteFileIfExists(url: outputFileUrl)
+            throw error
+        }
+    }
+
+    private static func decryptUnsafe(encryptedFileUrl: URL,
+                                      encryptionKey: Data,
+                                      digest: Data?,
+                                      unpaddedSize: UInt32,
+                                      outputFileUrl: URL) throws {
+        guard encryptionKey.count == aesKeyLength + hmacKeyLength else {
+            throw OWSAssertionError("Invalid key length: \(encryptionKey.count).")
+        }
+        guard let digest = digest, !digest.isEmpty else {
+            // This could happen with sufficiently outdated clients.
+            throw decryptionError("Refusing to decrypt attachment without a digest.")
+        }
+        guard let fileSize = OWSFileSystem.fileSize(ofPath: encryptedFileUrl.path)?.intValue else {
+            throw OWSAssertionError("Could not determine file size.")
+        }
+        let ciphertextLength = fileSize - ivLength - hmacLength
+        guard ciphertextLength > 0, ciphertextLength % kCCBlockSizeAES128 == 0 else {
+            throw decryptionError("Invalid attachment length: \(fileSize).")
+        }
+
+        guard let inputStream = InputStream(url: encryptedFileUrl) else {
+            throw OWSAssertionError("Could not open input stream.")
+        }
+        inputStream.open()
+        defer { inputStream.close() }
+        guard let outputStream = OutputStream(url: outputFileUrl, append: false) else {
+            throw OWSAssertionError("Could not open output stream.")
+        }
+        outputStream.open()
+        defer { outputStream.close() }
+
+        let aesKey = encryptionKey.prefix(aesKeyLength)
+        let hmacKey = encryptionKey.suffix(hmacKeyLength)
+
+        var hmacContext = CCHmacContext()
+        hmacKey.withUnsafeBytes {
+            CCHmacInit(&hmacContext, CCHmacAlgorithm(kCCHmacAlgSHA256), $0.baseAddress, hmacKey.count)
+        }
+        var digestContext = CC_SHA256_CTX()
+        CC_SHA256_Init(&digestContext)
+
+        let iv = try inputStream.readChunk(count: ivLength)
+        iv.withUnsafeBytes {
+            CCHmacUpdate(&hmacContext, $0.baseAddress, iv.count)
+            _ = CC_SHA256_Update(&digestContext, $0.baseAddress, CC_LONG(iv.count))
+        }
+
+        var cryptor: CCCryptorRef?
+        let createStatus = aesKey.withUnsafeBytes { aesKeyBytes in
+            iv.withUnsafeBytes { ivBytes in
+                CCCryptorCreate(CCOperation(kCCDecrypt),
+                                CCAlgorithm(kCCAlgorithmAES128),
+                                CCOptions(kCCOptionPKCS7Padding),
+                                aesKeyBytes.baseAddress,
+                                aesKey.count,
+                                ivBytes.baseAddress,
+                                &cryptor)
+            }
+        }
+        guard createStatus == kCCSuccess, let aesCryptor = cryptor else {
+            throw OWSAssertionError("Could not create cryptor: \(createStatus).")
+        }
+        defer { CCCryptorRelease(aesCryptor) }
+
+        // Anything past the unpadded size is padding.
+        var remainingUnpaddedLength = unpaddedSize > 0 ? Int(unpaddedSize) : Int.max
+        let writePlaintext = { (plaintext: Data) throws in
+            let plaintext = plaintext.prefix(remainingUnpaddedLength)
+            remainingUnpaddedLength -= plaintext.count
+            try outputStream.writeChunk(plaintext)
+        }
+
+        var remainingCiphertextLength = ciphertextLength
+        var plaintextBuffer = Data(count: chunkSize + kCCBlockSizeAES128)
+        while remainingCiphertextLength > 0 {
+            try autoreleasepool {
+                let ciphertext = try inputStream.readChunk(count: min(chunkSize, remainingCiphertextLength))
+                remainingCiphertextLength -= ciphertext.count
+
+                var plaintextLength = 0
+                let updateStatus = ciphertext.withUnsafeBytes { ciphertextBytes -> CCCryptorStatus in
+                    CCHmacUpdate(&hmacContext, ciphertextBytes.baseAddress, ciphertext.count)
+                    _ = CC_SHA256_Update(&digestContext, ciphertextBytes.baseAddress, CC_LONG(ciphertext.count))
+
+                    let plaintextBufferCount = plaintextBuffer.count
+                    return plaintextBuffer.withUnsafeMutableBytes { plaintextBytes in
+                        CCCryptorUpdate(aesCryptor,
+                                        ciphertextBytes.baseAddress,
+                                        ciphertext.count,
+                                        plaintextBytes.baseAddress,
+                                        plaintextBufferCount,
+                                        &plaintextLength)
+                    }
+                }
+                guard updateStatus == kCCSuccess else {
+                    throw decryptionError("Decryption failed: \(updateStatus).")
+                }
+                try writePlaintext(plaintextBuffer.prefix(plaintextLength))
+            }
+        }
+
+        let theirHmac = try inputStream.readChunk(count: hmacLength)
+        theirHmac.withUnsafeBytes {
+            _ = CC_SHA256_Update(&digestContext, $0.baseAddress, CC_LONG(theirHmac.count))
+        }
+        var ourHmac = Data(count: hmacLength)
+        ourHmac.withUnsafeMutableBytes {
+            CCHmacFinal(&hmacContext, $0.baseAddress)
+        }
+        guard ourHmac.ows_constantTimeIsEqual(to: theirHmac) else {
+            throw decryptionError("Bad HMAC on decrypting attachment.")
+        }
+        var ourDigest = Data(count: Int(CC_SHA256_DIGEST_LENGTH))
+        ourDigest.withUnsafeMutableBytes {
+            _ = CC_SHA256_Final($0.bindMemory(to: UInt8.self).baseAddress, &digestContext)
+        }
+        guard ourDigest.ows_constantTimeIsEqual(to: digest) else {
+            throw decryptionError("Bad digest on decrypting attachment.")
+        }
+
+        var finalLength = 0
+        let plaintextBufferCount = plaintextBuffer.count
+        let finalStatus = plaintextBuffer.withUnsafeMutableBytes {
+            CCCryptorFinal(aesCryptor, $0.baseAddress, plaintextBufferCount, &finalLength)
+        }
+        guard finalStatus == kCCSuccess else {
+            throw decryptionError("Decryption failed: \(finalStatus).")
+        }
+        try writePlaintext(plaintextBuffer.prefix(finalLength))
+
+        if unpaddedSize > 0, remainingUnpaddedLength > 0 {
+            throw decryptionError("Decrypted attachment is shorter than its unpadded size.")
+        }
+    }
+
+    // MARK: -
+
+    private static func decryptionError(_ description: String) -> Error {
+        Logger.error(description)
+        return OWSErrorWithCodeDescription(.failedToDecryptMessage, "Unable to decrypt attachment.")
+    }
+}
+
+// MARK: -
+
+extension InputStream {
+    // Reads exactly count bytes.
+    func readChunk(count: Int) throws -> Data {
+        var data = Data(count: count)
+        var offset = 0
+        while offset < count {
+            let bytesRead = data.withUnsafeMutableBytes {
+                read($0.bindMemory(to: UInt8.self).baseAddress! + offset, maxLength: count - offset)
+            }
+            guard bytesRead > 0 else {
+                throw OWSAssertionError("Could not read from input stream: \(String(describing: streamError)).")
+            }
+            offset += bytesRead
+        }
+        return data
+    }
+}
+
+// MARK: -
+
+extension OutputStream {
+    func writeChunk(_ data: Data) throws {
+        var offset = 0
+        while offset < data.count {
+            let bytesWritten = data.withUnsafeBytes {
+                write($0.bindMemory(to: UInt8.self).baseAddress! + offset, maxLength: data.count - offset)
+            }
+            guard bytesWritten > 0 else {
+                throw OWSAssertionError("Could not write to output stream: \(String(describing: streamError)).")
+            }
+            offset += bytesWritten
+        }
+    }
+}
@@ -0,0 +1,242 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import CommonCrypto
+
+// Encrypts an attachment a chunk at a time, so that memory use doesn't
+// grow with the size of the attachment.
+//
+// This is equivalent to Cryptography.encryptAttachmentData() with padding,
+// and produces the layout that AttachmentStreamDecrypter expects:
+//
+//     IV (16 bytes) || AES-256-CBC ciphertext || HMAC-SHA256 (32 bytes)
+//
+// Feed the plaintext to encrypt() in order, then call finalize(). The
+// padding is appended by finalize(), so callers only pass the attachment
+// itself. The encryption key and digest should be recorded once the
+// attachment has been encrypted.
+//
+// Encryption is deterministic given the key and IV, so an interrupted
+// upload can be resumed by encrypting the attachment again with the same
+// key and IV and skipping the bytes the server already has.
+class AttachmentStreamEncrypter {
+
+    private static let ivLength = 16
+    private static let hmacLength = Int(CC_SHA256_DIGEST_LENGTH)
+    private static let aesKeyLength = 32
+    private static let hmacKeyLength = 32
+
+    static let chunkSize = 64 * 1024
+
+    let encryptionKey: Data
+    let iv: Data
+    let plaintextLength: Int
+
+    private var cryptor: CCCryptorRef
+    private var hmacContext = CCHmacContext()
+    private var digestContext = CC_SHA256_CTX()
+
+    private var hasWrittenIV = false
+    private var plaintextBytesEncrypted = 0
+
+    // This property is set by finalize().
+    private(set) var digest: Data?
+
+    // The unpadded length of the plaintext must be known up front so that
+    // the length of the encrypted attachment is known before it is complete.
+    //
+    // A new key and IV are generated unless they are specified.
+    init(plaintextLength: Int, encryptionKey: Data? = nil, iv: Data? = nil) throws {
+        let encryptionKey = encryptionKey ?? Randomness.generateRandomBytes(Int32(Self.aesKeyLength + Self.hmacKeyLength))
+        let iv = iv ?? Randomness.generateRandomBytes(Int32(Self.ivLength))
+        guard encryptionKey.count == Self.aesKeyLength + Self.hmacKeyLength else {
+            throw OWSAssertionError("Invalid key length: \(encryptionKey.count).")
+        }
+        guard iv.count == Self.ivLength else {
+            throw OWSAssertionError("Invalid IV length: \(iv.count).")
+        }
+        let aesKey = encryptionKey.prefix(Self.aesKeyLength)
+        let hmacKey = encryptionKey.suffix(Self.hmacKeyLength)
+
+        var cryptor: CCCryptorRef?
+        let createStatus = aesKey.withUnsafeBytes { aesKeyBytes in
+            iv.withUnsafeBytes { ivBytes in
+                CCCryptorCreate(CCOperation(kCCEncrypt),
+                                CCAlgorithm(kCCAlgorithmAES128),
+                                CCOptions(kCCOptionPKCS7Padding),
+                                aesKeyBytes.baseAddress,
+                                aesKey.count,
+                                ivBytes.baseAddress,
+                                &cryptor)
+            }
+        }
+        guard createStatus == kCCSuccess, let aesCryptor = cryptor else {
+            throw OWSAssertionError("Could not create cryptor: \(createStatus).")
+        }
+
+        self.encryptionKey = encryptionKey
+        self.plaintextLength = plaintextLength
+        self.iv = iv
+        self.cryptor = aesCryptor
+
+        hmacKey.withUnsafeBytes {
+            CCHmacInit(&hmacContext, CCHmacAlgorithm(kCCHmacAlgSHA256), $0.baseAddress, hmacKey.count)
+        }
+        CC_SHA256_Init(&digestContext)
+    }
+
+    deinit {
+        CCCryptorRelease(cryptor)
+    }
+
+    private var paddedLength: Int {
+        Int(Cryptography.paddedSize(UInt(plaintextLength)))
+    }
+
+    // The length of the encrypted attachment.
+    var encryptedLength: Int {
+        // PKCS7 always adds at least one byte of padding.
+        let ciphertextLength = (paddedLength / kCCBlockSizeAES128 + 1) * kCCBlockSizeAES128
+        return Self.ivLength + ciphertextLength + Self.hmacLength
+    }
+
+    // Returns the encrypted bytes which follow those already returned.
+    func encrypt(_ plaintext: Data) throws -> Data {
+        guard digest == nil else {
+            throw OWSAssertionError("Encrypter is already finalized.")
+        }
+        plaintextBytesEncrypted += plaintext.count
+        guard plaintextBytesEncrypted <= plaintextLength else {
+            throw OWSAssertionError("Plaintext is longer than expected.")
+        }
+
+        var output = Data()
+        if !hasWrittenIV {
+            hasWrittenIV = true
+            output.append(authenticate(iv))
+        }
+        output.append(try update(plaintext))
+        return output
+    }
+
+    // Returns the rest of the encrypted attachment: the padding, the final
+    // block and the HMAC.
+    func finalize() throws -> Data {
+        guard digest == nil else {
+            throw OWSAssertionError("Encrypter is already finalized.")
+        }
+        guard plaintextBytesEncrypted == plaintextLength else {
+            throw OWSAssertionError("Plaintext is shorter than expected.")
+        }
+
+        var output = Data()
+        if !hasWrittenIV {
+            hasWrittenIV = true
+            output.append(authenticate(iv))
+        }
+
+        var remainingPaddingLength = paddedLength - plaintextLength
+        while remainingPaddingLength > 0 {
+            let paddingLength = min(Self.chunkSize, remainingPaddingLength)
+            output.append(try update(Data(count: paddingLength)))
+            remainingPaddingLength -= paddingLength
+        }
+
+        var finalBlock = Data(count: kCCBlockSizeAES128)
+        var finalLength = 0
+        let finalBlockCount = finalBlock.count
+        let finalStatus = finalBlock.withUnsafeMutableBytes {
+            CCCryptorFinal(cryptor, $0.baseAddress, finalBlockCount, &finalLength)
+        }
+        guard finalStatus == kCCSuccess else {
+            throw OWSAssertionError("Encryption failed: \(finalStatus).")
+        }
+        output.append(authenticate(finalBlock.prefix(finalLength)))
+
+        var hmac = Data(count: Self.hmacLength)
+        hmac.withUnsafeMutableBytes {
+            CCHmacFinal(&hmacContext, $0.baseAddress)
+        }
+        hmac.withUnsafeBytes {
+            _ = CC_SHA256_Update(&digestContext, $0.baseAddress, CC_LONG(hmac.count))
+        }
+        output.append(hmac)
+
+        var digest = Data(count: Int(CC_SHA256_DIGEST_LENGTH))
+        digest.withUnsafeMutableBytes {
+            _ = CC_SHA256_Final($0.bindMemory(to: UInt8.self).baseAddress, &digestContext)
+        }
+        self.digest = digest
+        return output
+    }
+
+    private func update(_ plaintext: Data) throws -> Data {
+        var ciphertext = Data(count: plaintext.count + kCCBlockSizeAES128)
+        var ciphertextLength = 0
+        let ciphertextCount = ciphertext.count
+        let updateStatus = plaintext.withUnsafeBytes { plaintextBytes in
+            ciphertext.withUnsafeMutableBytes { ciphertextBytes in
+                CCCryptorUpdate(cryptor,
+                                plaintextBytes.baseAddress,
+                                plaintext.count,
+                                ciphertextBytes.baseAddress,
+                                ciphertextCount,
+                                &ciphertextLength)
+            }
+        }
+        guard updateStatus == kCCSuccess else {
+            throw OWSAssertionError("Encryption failed: \(updateStatus).")
+        }
+        return authenticate(ciphertext.prefix(ciphertextLength))
+    }
+
+    // The HMAC covers the IV and ciphertext; the digest covers everything.
+    private func authenticate(_ data: Data) -> Data {
+        data.withUnsafeBytes {
+            CCHmacUpdate(&hmacContext, $0.baseAddress, data.count)
+            _ = CC_SHA256_Update(&digestContext, $0.baseAddress, CC_LONG(data.count))
+        }
+        return data
+    }
+
+    // MARK: -
+
+    // Encrypts a plaintext file a chunk at a time, passing the encrypted
+    // attachment to output() in order. The first skippedLength bytes of
+    // the encrypted attachment are encrypted but not output.
+    func encryptFile(at plaintextFileUrl: URL,
+                     skippingLength skippedLength: Int = 0,
+                     output: (Data) throws -> Void) throws {
+        guard OWSFileSystem.fileSize(ofPath: plaintextFileUrl.path)?.intValue == plaintextLength else {
+            throw OWSAssertionError("Unexpected plaintext length.")
+        }
+        guard let inputStream = InputStream(url: plaintextFileUrl) else {
+            throw OWSAssertionError("Could not open input stream.")
+        }
+        inputStream.open()
+        defer { inputStream.close() }
+
+        var remainingSkippedLength = skippedLength
+        var remainingLength = plaintextLength
+        while remainingLength > 0 {
+            try autoreleasepool {
+                let plaintext = try inputStream.readChunk(count: min(Self.chunkSize, remainingLength))
+                remainingLength -= plaintext.count
+                try Self.output(try self.encrypt(plaintext), skipping: &remainingSkippedLength, to: output)
+            }
+        }
+        try Self.output(try finalize(), skipping: &remainingSkippedLength, to: output)
+    }
+
+    private static func output(_ encrypted: Data,
+                               skipping remainingSkippedLength: inout Int,
+                               to output: (Data) throws -> Void) throws {
+        let skippedCount = min(remainingSkippedLength, encrypted.count)
+        remainingSkippedLength -= skippedCount
+        if skippedCount < encrypted.count {
+            try output(encrypted.dropFirst(skippedCount))
+        }
+    }
+}
@@ -70,15 +70,11 @@ public class BlurHash: NSObject {
                 resolver.reject(OWSAssertionError("Could not load small thumbnail."))
                 return
             }
-            guard let normalized = normalize(image: thumbnail, backgroundColor: .white) else {
-                resolver.reject(OWSAssertionError("Could not normalize thumbnail."))
-                return
-            }
             // blurHash uses a DCT transform, so these are AC and DC components.
             // We use 4x3.
             //
             // https://github.com/woltapp/blurhash/blob/master/Algorithm.md
-            guard let blurHash = normalized.blurHash(numberOfComponents: (4, 3)) else {
+            guard let blurHash = computeBlurHash(for: thumbnail, backgroundColor: .white) else {
                 resolver.reject(OWSAssertionError("Could not generate blurHash."))
                 return
             }
@@ -104,7 +100,9 @@ public class BlurHash: NSObject {
     @objc(imageForBlurHash:)
     public class func image(for blurHash: String) -> UIImage? {
         let thumbnailSize = imageSize(for: blurHash)
-        guard let image = UIImage(blurHash: blurHash, size: thumbnailSize) else {
+        guard let image = BlurHashCodec.image(for: blurHash,
+                                              width: Int(thumbnailSize.width),
+                                              height: Int(thumbnailSize.height)) else {
             owsFailDebug("Couldn't generate image for blurHash.")
             return nil
         }
@@ -115,15 +113,13 @@ public class BlurHash: NSObject {
         return CGSize(width: kDefaultSize, height: kDefaultSize)
     }
 
-    // BlurHashEncode only works with images in a very specific
-    // pixel format: RGBA8888.
-    private class func normalize(image: UIImage, backgroundColor: UIColor) -> UIImage? {
+    private class func computeBlurHash(for image: UIImage, backgroundColor: UIColor) -> String? {
         guard let cgImage = image.cgImage else {
             owsFailDebug("Invalid image.")
             return nil
         }
 
-        // As long as we're normalizing the image, reduce the size.
+        // Reduce the size of the image while normalizing it.
         // The blurHash algorithm doesn't need more data.
         // This also places an upper bound on blurHash perf cost.
         let srcSize = image.pixelSize()
@@ -136,23 +132,11 @@ public class BlurHash: NSObject {
         let scale: CGFloat = min(1.0, kDefaultSize / srcMinDimension)
         let dstWidth: Int = Int(round(srcSize.width * scale))
         let dstHeight: Int = Int(round(srcSize.height * scale))
-        let dstSize = CGSize(width: dstWidth, height: dstHeight)
-        let dstRect = CGRect(origin: .zero, size: dstSize)
-        let colorSpace = CGColorSpaceCreateDeviceRGB()
-        // RGBA8888 pixel format
-        let bitmapInfo = CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.premultipliedLast.rawValue
-        guard let context = CGContext(data: nil,
-                                      width: dstWidth,
-                                      height: dstHeight,
-                                      bitsPerComponent: 8,
-                                      bytesPerRow: dstWidth * 4,
-                                      space: colorSpace,
-                                      bitmapInfo: bitmapInfo) else {
-                                        return nil
-        }
-        context.setFillColor(backgroundColor.cgColor)
-        context.fill(dstRect)
-        context.draw(cgImage, in: dstRect)
-        return (context.makeImage().flatMap { UIImage(cgImage: $0) })
+        return BlurHashCodec.encode(cgImage: cgImage,
+                                    width: dstWidth,
+                                    height: dstHeight,
+                                    backgroundColor: backgroundColor.cgColor,
+                                    componentsX: 4,
+                                    componentsY: 3)
     }
 }
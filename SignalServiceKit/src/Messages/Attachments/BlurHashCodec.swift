@@ -0,0 +1,359 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import Accelerate
+
+// A vectorized implementation of the blurHash algorithm, which produces the
+// same results as the reference implementation.
+//
+// The reference implementation evaluates two cosines per pixel for every
+// component. Here the cosines are precomputed for each image dimension and
+// component count, and the transform is done with a pair of matrix
+// multiplications per color channel.
+//
+// See: https://github.com/woltapp/blurhash/blob/master/Algorithm.md
+enum BlurHashCodec {
+
+    // MARK: - Cosine Tables
+
+    // Row-major tables of cos(π * component * index / length).
+    private struct CosineTable {
+        // componentCount x length
+        let values: [Float]
+        // length x componentCount
+        let transposedValues: [Float]
+
+        init(length: Int, componentCount: Int) {
+            var values = [Float](repeating: 0, count: componentCount * length)
+            for component in 0..<componentCount {
+                for index in 0..<length {
+                    values[component * length + index] = cos(Float.pi * Float(component) * Float(index) / Float(length))
+                }
+            }
+            var transposedValues = [Float](repeating: 0, count: length * componentCount)
+            vDSP_mtrans(values, 1, &transposedValues, 1, vDSP_Length(length), vDSP_Length(componentCount))
+            self.values = values
+            self.transposedValues = transposedValues
+        }
+    }
+
+    private struct CosineTableKey: Hashable {
+        let length: Int
+        let componentCount: Int
+    }
+
+    private static let unfairLock = UnfairLock()
+    // This property should only be accessed with unfairLock.
+    private static var cosineTables = [CosineTableKey: CosineTable]()
+    private static let maxCosineTableCount = 64
+
+    private static func cosineTable(length: Int, componentCount: Int) -> CosineTable {
+        let key = CosineTableKey(length: length, componentCount: componentCount)
+        return unfairLock.withLock {
+            if let cosineTable = cosineTables[key] {
+                return cosineTable
+            }
+            // Images are nearly always one of a handful of sizes,
+            // but don't let the cache grow without bound.
+            if cosineTables.count >= maxCosineTableCount {
+                cosineTables.removeAll()
+            }
+            let cosineTable = CosineTable(length: length, componentCount: componentCount)
+            cosineTables[key] = cosineTable
+            return cosineTable
+        }
+    }
+
+    // MARK: - Color
+
+    private static let sRGBToLinearTable: [Float] = (0..<256).map { value in
+        let v = Float(value) / 255
+        if v <= 0.04045 {
+            return v / 12.92
+        } else {
+            return pow((v + 0.055) / 1.055, 2.4)
+        }
+    }
+
+    private static func linearToSRGB(_ value: Float) -> Int {
+        let v = max(0, min(1, value))
+        if v <= 0.0031308 {
+            return Int(v * 12.92 * 255 + 0.5)
+        } else {
+            return Int((1.055 * pow(v, 1 / 2.4) - 0.055) * 255 + 0.5)
+        }
+    }
+
+    private static func signPow(_ value: Float, _ exponent: Float) -> Float {
+        return copysign(pow(abs(value), exponent), value)
+    }
+
+    // MARK: - Base 83
+
+    private static let characters = Array("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~")
+
+    private static let characterValues: [Character: Int] = {
+        var characterValues = [Character: Int]()
+        for (index, character) in characters.enumerated() {
+            characterValues[character] = index
+        }
+        return characterValues
+    }()
+
+    private static func encode83(_ value: Int, length: Int) -> String {
+        var result = ""
+        for i in 1...length {
+            let digit = (value / Int(pow(83, Double(length - i)))) % 83
+            result.append(characters[digit])
+        }
+        return result
+    }
+
+    private static func decode83<S: Sequence>(_ characters: S) -> Int? where S.Element == Character {
+        var value = 0
+        for character in characters {
+            guard let digit = characterValues[character] else {
+                return nil
+            }
+            value = value * 83 + digit
+        }
+        return value
+    }
+
+    // MARK: - Encode
+
+    // Renders the image into an RGBA8888 bitmap of the given size over the
+    // background color, then encodes it.
+    static func encode(cgImage: CGImage,
+                       width: Int,
+                       height: Int,
+                       backgroundColor: CGColor,
+                       componentsX: Int,
+                       componentsY: Int) -> String? {
+        let bytesPerRow = width * 4
+        let bitmapInfo = CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.premultipliedLast.rawValue
+        guard width > 0,
+              height > 0,
+              let context = CGContext(data: nil,
+                                      width: width,
+                                      height: height,
+                                      bitsPerComponent: 8,
+                                      bytesPerRow: bytesPerRow,
+                                      space: CGColorSpaceCreateDeviceRGB(),
+                                      bitmapInfo: bitmapInfo) else {
+            owsFailDebug("Could not create context.")
+            return nil
+        }
+        let rect = CGRect(x: 0, y: 0, width: width, height: height)
+        context.setFillColor(backgroundColor)
+        context.fill(rect)
+        context.draw(cgImage, in: rect)
+        guard let data = context.data else {
+            owsFailDebug("Missing context data.")
+            return nil
+        }
+        return encode(rgbaPixels: data.assumingMemoryBound(to: UInt8.self),
+                      width: width,
+                      height: height,
+                      bytesPerRow: context.bytesPerRow,
+                      componentsX: componentsX,
+                      componentsY: componentsY)
+    }
+
+    // The alpha channel is ignored.
+    static func encode(rgbaPixels: UnsafePointer<UInt8>,
+                       width: Int,
+                       height: Int,
+                       bytesPerRow: Int,
+                       componentsX: Int,
+                       componentsY: Int) -> String? {
+        guard (1...9).contains(componentsX), (1...9).contains(componentsY) else {
+            owsFailDebug("Invalid component count.")
+            return nil
+        }
+        guard width > 0, height > 0 else {
+            owsFailDebug("Invalid size.")
+            return nil
+        }
+
+        // Split the pixels into planes of linear color values.
+        let pixelCount = width * height
+        var planes = [[Float]](repeating: [Float](repeating: 0, count: pixelCount), count: 3)
+        var sRGBValues = [Float](repeating: 0, count: width)
+        for channel in 0..<3 {
+            for y in 0..<height {
+                vDSP_vfltu8(rgbaPixels + y * bytesPerRow + channel, 4, &sRGBValues, 1, vDSP_Length(width))
+                planes[channel].withUnsafeMutableBufferPointer { plane in
+                    // sRGB values are integers, so this is an exact table lookup.
+                    var scale: Float = 1
+                    var offset: Float = 0
+                    vDSP_vtabi(sRGBValues, 1,
+                               &scale, &offset,
+                               sRGBToLinearTable, vDSP_Length(sRGBToLinearTable.count),
+                               plane.baseAddress! + y * width, 1,
+                               vDSP_Length(width))
+                }
+            }
+        }
+
+        // factors[j][i] = Σy Σx cosY[j][y] * cosX[i][x] * plane[y][x]
+        let cosX = cosineTable(length: width, componentCount: componentsX)
+        let cosY = cosineTable(length: height, componentCount: componentsY)
+        let componentCount = componentsX * componentsY
+        var factors = [[Float]]()
+        var rowFactors = [Float](repeating: 0, count: height * componentsX)
+        for channel in 0..<3 {
+            vDSP_mmul(planes[channel], 1,
+                      cosX.transposedValues, 1,
+                      &rowFactors, 1,
+                      vDSP_Length(height), vDSP_Length(componentsX), vDSP_Length(width))
+            var channelFactors = [Float](repeating: 0, count: componentCount)
+            vDSP_mmul(cosY.values, 1,
+                      rowFactors, 1,
+                      &channelFactors, 1,
+                      vDSP_Length(componentsY), vDSP_Length(componentsX), vDSP_Length(height))
+
+            // The DC component is normalized by 1, the AC components by 2.
+            var scale = 2 / Float(pixelCount)
+            channelFactors.withUnsafeMutableBufferPointer { channelFactors in
+                vDSP_vsmul(channelFactors.baseAddress!, 1, &scale, channelFactors.baseAddress!, 1, vDSP_Length(componentCount))
+            }
+            channelFactors[0] /= 2
+            factors.append(channelFactors)
+        }
+
+        var hash = ""
+        let sizeFlag = (componentsX - 1) + (componentsY - 1) * 9
+        hash += encode83(sizeFlag, length: 1)
+
+        let maximumValue: Float
+        if componentCount > 1 {
+            var actualMaximumValue: Float = 0
+            for channel in 0..<3 {
+                var channelMaximumValue: Float = 0
+                factors[channel].withUnsafeBufferPointer { channelFactors in
+                    vDSP_maxmgv(channelFactors.baseAddress! + 1, 1, &channelMaximumValue, vDSP_Length(componentCount - 1))
+                }
+                actualMaximumValue = max(actualMaximumValue, channelMaximumValue)
+            }
+            let quantisedMaximumValue = Int(max(0, min(82, floor(actualMaximumValue * 166 - 0.5))))
+            maximumValue = Float(quantisedMaximumValue + 1) / 166
+            hash += encode83(quantisedMaximumValue, length: 1)
+        } else {
+            maximumValue = 1
+            hash += encode83(0, length: 1)
+        }
+
+        let dcValue = (linearToSRGB(factors[0][0]) << 16) + (linearToSRGB(factors[1][0]) << 8) + linearToSRGB(factors[2][0])
+        hash += encode83(dcValue, length: 4)
+
+        for index in 1..<max(1, componentCount) {
+            let quantised = (0..<3).map { channel in
+                Int(max(0, min(18, floor(signPow(factors[channel][index] / maximumValue, 0.5) * 9 + 9.5))))
+            }
+            hash += encode83(quantised[0] * 19 * 19 + quantised[1] * 19 + quantised[2], length: 2)
+        }
+        return hash
+    }
+
+    // MARK: - Decode
+
+    static func image(for blurHash: String, width: Int, height: Int, punch: Float = 1) -> UIImage? {
+        let characters = Array(blurHash)
+        guard characters.count >= 6, width > 0, height > 0 else {
+            return nil
+        }
+        guard let sizeFlag = decode83(characters[0..<1]),
+              let quantisedMaximumValue = decode83(characters[1..<2]) else {
+            return nil
+        }
+        let componentsX = (sizeFlag % 9) + 1
+        let componentsY = (sizeFlag / 9) + 1
+        let componentCount = componentsX * componentsY
+        guard characters.count == 4 + 2 * componentCount else {
+            return nil
+        }
+        let maximumValue = Float(quantisedMaximumValue + 1) / 166 * punch
+
+        // colors[channel][j][i]
+        var colors = [[Float]](repeating: [Float](repeating: 0, count: componentCount), count: 3)
+        guard let dcValue = decode83(characters[2..<6]) else {
+            return nil
+        }
+        colors[0][0] = sRGBToLinearTable[(dcValue >> 16) & 255]
+        colors[1][0] = sRGBToLinearTable[(dcValue >> 8) & 255]
+        colors[2][0] = sRGBToLinearTable[dcValue & 255]
+        for index in 1..<max(1, componentCount) {
+            guard let acValue = decode83(characters[(4 + index * 2)..<(4 + index * 2 + 2)]) else {
+                return nil
+            }
+            let quantised = [acValue / (19 * 19), (acValue / 19) % 19, acValue % 19]
+            for channel in 0..<3 {
+                colors[channel][index] = signPow((Float(quantised[channel]) - 9) / 9, 2) * maximumValue
+            }
+        }
+
+        // plane[y][x] = Σj Σi cosY[j][y] * cosX[i][x] * colors[j][i]
+        let cosX = cosineTable(length: width, componentCount: componentsX)
+        let cosY = cosineTable(length: height, componentCount: componentsY)
+        let pixelCount = width * height
+        var rowColors = [Float](repeating: 0, count: height * componentsX)
+        var plane = [Float](repeating: 0, count: pixelCount)
+        var pixelCountValue = Int32(pixelCount)
+        var lowerBound: Float = 0
+        var upperBound: Float = 1
+        let gammaExponents = [Float](repeating: 1 / 2.4, count: pixelCount)
+        var gammaValues = [Float](repeating: 0, count: pixelCount)
+
+        let bytesPerRow = width * 4
+        var pixels = Data(count: bytesPerRow * height)
+        pixels.withUnsafeMutableBytes { pixelBytes in
+            let pixels = pixelBytes.bindMemory(to: UInt8.self)
+            for channel in 0..<3 {
+                vDSP_mmul(cosY.transposedValues, 1,
+                          colors[channel], 1,
+                          &rowColors, 1,
+                          vDSP_Length(height), vDSP_Length(componentsX), vDSP_Length(componentsY))
+                vDSP_mmul(rowColors, 1,
+                          cosX.values, 1,
+                          &plane, 1,
+                          vDSP_Length(height), vDSP_Length(width), vDSP_Length(componentsX))
+
+                // Convert to sRGB, as linearToSRGB() does.
+                plane.withUnsafeMutableBufferPointer { plane in
+                    vDSP_vclip(plane.baseAddress!, 1, &lowerBound, &upperBound, plane.baseAddress!, 1, vDSP_Length(pixelCount))
+                }
+                vvpowf(&gammaValues, gammaExponents, plane, &pixelCountValue)
+                for index in 0..<pixelCount {
+                    let v = plane[index]
+                    let value: Float
+                    if v <= 0.0031308 {
+                        value = v * 12.92 * 255 + 0.5
+                    } else {
+                        value = (1.055 * gammaValues[index] - 0.055) * 255 + 0.5
+                    }
+                    pixels[index * 4 + channel] = UInt8(value)
+                }
+            }
+        }
+
+        let bitmapInfo = CGBitmapInfo(rawValue: CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.noneSkipLast.rawValue)
+        guard let provider = CGDataProvider(data: pixels as CFData),
+              let cgImage = CGImage(width: width,
+                                    height: height,
+                                    bitsPerComponent: 8,
+                                    bitsPerPixel: 32,
+                                    bytesPerRow: bytesPerRow,
+                                    space: CGColorSpaceCreateDeviceRGB(),
+                                    bitmapInfo: bitmapInfo,
+                                    provider: provider,
+                                    decode: nil,
+                                    shouldInterpolate: true,
+                                    intent: .defaultIntent) else {
+            return nil
+        }
+        return UIImage(cgImage: cgImage)
+    }
+}
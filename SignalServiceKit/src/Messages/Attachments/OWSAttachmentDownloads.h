@@ -13,6 +13,18 @@ NS_ASSUME_NONNULL_BEGIN
 typedef void (^AttachmentDownloadSuccess)(TSAttachmentStream *attachmentStream);
 typedef void (^AttachmentDownloadFailure)(NSError *error);
 
+// Downloads are started in this order; earlier values come first.
+typedef NS_ENUM(NSUInteger, OWSAttachmentDownloadPriority) {
+    // Media the user asked for, or which is on screen.
+    OWSAttachmentDownloadPriorityVisible = 0,
+    // Small attachments like quoted reply thumbnails and stickers.
+    OWSAttachmentDownloadPriorityThumbnail,
+    // Media auto-downloaded as messages arrive.
+    OWSAttachmentDownloadPriorityAutoDownload,
+    // Media downloaded in bulk, e.g. once a message request is accepted.
+    OWSAttachmentDownloadPriorityBackfill,
+};
+
 @interface OWSAttachmentDownloadJob : NSObject
 
 @property (nonatomic, readonly) NSString *attachmentId;
@@ -21,6 +33,19 @@ typedef void (^AttachmentDownloadFailure)(NSError *error);
 @property (nonatomic, readonly) AttachmentDownloadFailure failure;
 @property (atomic) CGFloat progress;
 
+// The priority the job was enqueued with.
+@property (nonatomic, readonly) OWSAttachmentDownloadPriority basePriority;
+// This is raised to OWSAttachmentDownloadPriorityVisible while the
+// job's message is on screen.
+@property (atomic) OWSAttachmentDownloadPriority priority;
+
+// The task of an in-flight download, if any.
+@property (atomic, nullable) NSURLSessionTask *task;
+// Set when an in-flight download is cancelled so that it can be
+// resumed later, rather than failed.
+@property (atomic) BOOL isDeferred;
+@property (atomic, nullable) NSData *resumeData;
+
 @end
 
 #pragma mark -
@@ -35,11 +60,22 @@ typedef void (^AttachmentDownloadFailure)(NSError *error);
 
 - (nullable NSNumber *)downloadProgressForAttachmentId:(NSString *)attachmentId;
 
+// The number of downloads in flight and waiting to start, respectively.
+@property (nonatomic, readonly) NSUInteger activeDownloadCount;
+@property (nonatomic, readonly) NSUInteger queuedDownloadCount;
+
 - (void)enqueueJobForAttachmentId:(NSString *)attachmentId
                           message:(nullable TSMessage *)message
+                         priority:(OWSAttachmentDownloadPriority)priority
                           success:(void (^)(TSAttachmentStream *attachmentStream))success
                           failure:(void (^)(NSError *error))failure;
 
+// Raises the priority of downloads for messages while they are on screen.
+- (void)messageDidBecomeVisible:(NSString *)messageId;
+// Restores the priority of those downloads. In-flight downloads which no
+// longer have priority over queued downloads are deferred.
+- (void)messageDidBecomeHidden:(NSString *)messageId;
+
 @end
 
 NS_ASSUME_NONNULL_END
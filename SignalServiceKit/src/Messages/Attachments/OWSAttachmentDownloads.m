@@ -34,6 +34,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithAttachmentId:(NSString *)attachmentId
                              message:(nullable TSMessage *)message
+                            priority:(OWSAttachmentDownloadPriority)priority
                              success:(AttachmentDownloadSuccess)success
                              failure:(AttachmentDownloadFailure)failure
 {
@@ -44,6 +45,8 @@ NS_ASSUME_NONNULL_BEGIN
 
     _attachmentId = attachmentId;
     _message = message;
+    _basePriority = priority;
+    _priority = priority;
     _success = success;
     _failure = failure;
 
@@ -60,6 +63,10 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, readonly) NSMutableDictionary<NSString *, OWSAttachmentDownloadJob *> *downloadingJobMap;
 // This property should only be accessed while synchronized on this class.
 @property (nonatomic, readonly) NSMutableArray<OWSAttachmentDownloadJob *> *attachmentDownloadJobQueue;
+// This property should only be accessed while synchronized on this class.
+@property (nonatomic, readonly) NSMutableSet<NSString *> *visibleMessageIds;
+
+@property (nonatomic, readonly) AttachmentDownloadConcurrency *concurrency;
 
 @end
 
@@ -97,6 +104,8 @@ NS_ASSUME_NONNULL_BEGIN
 
     _downloadingJobMap = [NSMutableDictionary new];
     _attachmentDownloadJobQueue = [NSMutableArray new];
+    _visibleMessageIds = [NSMutableSet new];
+    _concurrency = [AttachmentDownloadConcurrency new];
 
     [[NSNotificationCenter defaultCenter] addObserver:self
                                              selector:@selector(profileWhitelistDidChange:)
@@ -150,8 +159,23 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+- (NSUInteger)activeDownloadCount
+{
+    @synchronized(self) {
+        return self.downloadingJobMap.count;
+    }
+}
+
+- (NSUInteger)queuedDownloadCount
+{
+    @synchronized(self) {
+        return self.attachmentDownloadJobQueue.count;
+    }
+}
+
 - (void)enqueueJobForAttachmentId:(NSString *)attachmentId
                           message:(nullable TSMessage *)message
+                         priority:(OWSAttachmentDownloadPriority)priority
                           success:(void (^)(TSAttachmentStream *attachmentStream))success
                           failure:(void (^)(NSError *error))failure
 {
@@ -159,27 +183,122 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSAttachmentDownloadJob *job = [[OWSAttachmentDownloadJob alloc] initWithAttachmentId:attachmentId
                                                                                    message:message
+                                                                                  priority:priority
                                                                                    success:success
                                                                                    failure:failure];
 
     @synchronized(self) {
+        if (message != nil && [self.visibleMessageIds containsObject:message.uniqueId]) {
+            job.priority = OWSAttachmentDownloadPriorityVisible;
+        }
         [self.attachmentDownloadJobQueue addObject:job];
     }
 
     [self tryToStartNextDownload];
 }
 
+#pragma mark - Visibility
+
+- (void)messageDidBecomeVisible:(NSString *)messageId
+{
+    OWSAssertDebug(messageId.length > 0);
+
+    @synchronized(self) {
+        [self.visibleMessageIds addObject:messageId];
+        [self updatePriorityOfJobsForMessageId:messageId];
+        [self deferPreemptedDownloads];
+    }
+
+    [self tryToStartNextDownload];
+}
+
+- (void)messageDidBecomeHidden:(NSString *)messageId
+{
+    OWSAssertDebug(messageId.length > 0);
+
+    @synchronized(self) {
+        [self.visibleMessageIds removeObject:messageId];
+        [self updatePriorityOfJobsForMessageId:messageId];
+        [self deferPreemptedDownloads];
+    }
+}
+
+// This method should only be called while synchronized on this class.
+- (void)updatePriorityOfJobsForMessageId:(NSString *)messageId
+{
+    BOOL isVisible = [self.visibleMessageIds containsObject:messageId];
+    NSMutableArray<OWSAttachmentDownloadJob *> *jobs = [self.attachmentDownloadJobQueue mutableCopy];
+    [jobs addObjectsFromArray:self.downloadingJobMap.allValues];
+    for (OWSAttachmentDownloadJob *job in jobs) {
+        if (![job.message.uniqueId isEqualToString:messageId]) {
+            continue;
+        }
+        job.priority = isVisible ? OWSAttachmentDownloadPriorityVisible : job.basePriority;
+    }
+}
+
+// If downloads are waiting on in-flight downloads of lower priority, e.g.
+// because the user scrolled away from the in-flight downloads, cancel the
+// in-flight downloads so that they can be resumed later.
+//
+// This method should only be called while synchronized on this class.
+- (void)deferPreemptedDownloads
+{
+    NSMutableArray<OWSAttachmentDownloadJob *> *preemptibleJobs = [NSMutableArray new];
+    for (OWSAttachmentDownloadJob *job in self.downloadingJobMap.allValues) {
+        if (job.task != nil && !job.isDeferred) {
+            [preemptibleJobs addObject:job];
+        }
+    }
+    // Lowest priority first.
+    [preemptibleJobs sortUsingComparator:^NSComparisonResult(OWSAttachmentDownloadJob *left,
+        OWSAttachmentDownloadJob *right) { return [@(right.priority) compare:@(left.priority)]; }];
+
+    NSInteger availableCount
+        = self.concurrency.maxConcurrentDownloads - (NSInteger)self.downloadingJobMap.count;
+    for (OWSAttachmentDownloadJob *waitingJob in [self sortedAttachmentDownloadJobQueue]) {
+        if (availableCount > 0) {
+            // This job can start without preempting anything.
+            availableCount--;
+            continue;
+        }
+        OWSAttachmentDownloadJob *_Nullable preemptedJob = preemptibleJobs.firstObject;
+        if (preemptedJob == nil || preemptedJob.priority <= waitingJob.priority) {
+            break;
+        }
+        OWSLogInfo(@"Deferring download: %@", preemptedJob.attachmentId);
+        [preemptibleJobs removeObjectAtIndex:0];
+        preemptedJob.isDeferred = YES;
+        [preemptedJob.task cancel];
+    }
+}
+
+// Returns the queue in the order that downloads should start: by
+// priority, and in the order they were enqueued within a priority.
+//
+// This method should only be called while synchronized on this class.
+- (NSArray<OWSAttachmentDownloadJob *> *)sortedAttachmentDownloadJobQueue
+{
+    // NSArray's sort is stable.
+    return [self.attachmentDownloadJobQueue
+        sortedArrayWithOptions:NSSortStable
+               usingComparator:^NSComparisonResult(OWSAttachmentDownloadJob *left, OWSAttachmentDownloadJob *right) {
+                   return [@(left.priority) compare:@(right.priority)];
+               }];
+}
+
+#pragma mark -
+
 - (void)tryToStartNextDownload
 {
     dispatch_async(OWSAttachmentDownloads.serialQueue, ^{
         OWSAttachmentDownloadJob *_Nullable job;
 
         @synchronized(self) {
-            const NSUInteger kMaxSimultaneousDownloads = 4;
-            if (self.downloadingJobMap.count >= kMaxSimultaneousDownloads) {
+            if ((NSInteger)self.downloadingJobMap.count >= self.concurrency.maxConcurrentDownloads) {
                 return;
             }
-            job = self.attachmentDownloadJobQueue.firstObject;
+            job = [self sortedAttachmentDownloadJobQueue].firstObject;
             if (!job) {
                 return;
             }
@@ -188,9 +307,10 @@ NS_ASSUME_NONNULL_BEGIN
                 OWSLogWarn(@"Ignoring duplicate download.");
                 return;
             }
-            [self.attachmentDownloadJobQueue removeObjectAtIndex:0];
+            [self.attachmentDownloadJobQueue removeObject:job];
             self.downloadingJobMap[job.attachmentId] = job;
         }
+        NSDate *startDate = [NSDate new];
 
         __block TSAttachmentPointer *_Nullable attachmentPointer;
         DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
@@ -256,12 +376,29 @@ NS_ASSUME_NONNULL_BEGIN
                 job.success(attachmentStream);
 
                 @synchronized(self) {
+                    [self.concurrency didCompleteDownloadWithByteCount:attachmentStream.byteCount
+                                                              duration:-startDate.timeIntervalSinceNow
+                                               concurrentDownloadCount:(NSInteger)self.downloadingJobMap.count];
                     [self.downloadingJobMap removeObjectForKey:job.attachmentId];
                 }
 
                 [self tryToStartNextDownload];
             }
             failure:^(NSError *error) {
+                if (job.isDeferred) {
+                    OWSLogInfo(@"Attachment download deferred.");
+
+                    @synchronized(self) {
+                        [self.downloadingJobMap removeObjectForKey:job.attachmentId];
+                        job.isDeferred = NO;
+                        job.task = nil;
+                        [self.attachmentDownloadJobQueue addObject:job];
+                    }
+
+                    [self tryToStartNextDownload];
+                    return;
+                }
+
                 OWSLogError(@"Attachment download failed with error: %@", error);
 
                 DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
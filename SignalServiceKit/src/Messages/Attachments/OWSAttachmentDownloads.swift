@@ -271,6 +271,7 @@ public extension OWSAttachmentDownloads {
                 self.downloadAttachments(forMessageId: message.uniqueId,
                                          attachmentGroup: .allAttachmentsIncoming,
                                          downloadBehavior: .default,
+                                         isBackfill: true,
                                          success: { downloadedAttachments in
                                             unfairLock.withLock {
                                                 attachmentStreams.append(contentsOf: downloadedAttachments)
@@ -289,10 +290,10 @@ public extension OWSAttachmentDownloads {
             // Block until _all_ promises have either succeeded or failed.
             _ = firstly(on: .global()) {
                 when(fulfilled: promises)
-            }.done(on: Self.serialQueue) { _ in
+            }.done(on: Self.taskQueue) { _ in
                 let attachmentStreamsCopy = unfairLock.withLock { attachmentStreams }
                 Logger.info("Successfully downloaded attachments for whitelisted thread: \(attachmentStreamsCopy.count).")
-            }.catch(on: Self.serialQueue) { error in
+            }.catch(on: Self.taskQueue) { error in
                 Logger.warn("Failed to download attachments for whitelisted thread.")
                 owsFailDebugUnlessNetworkFailure(error)
             }
@@ -471,6 +472,20 @@ public extension OWSAttachmentDownloads {
                              downloadBehavior: AttachmentDownloadBehavior,
                              success: @escaping ([TSAttachmentStream]) -> Void,
                              failure: @escaping (Error) -> Void) {
+        downloadAttachments(forMessageId: messageId,
+                            attachmentGroup: attachmentGroup,
+                            downloadBehavior: downloadBehavior,
+                            isBackfill: false,
+                            success: success,
+                            failure: failure)
+    }
+
+    private func downloadAttachments(forMessageId messageId: String,
+                                     attachmentGroup: AttachmentGroup,
+                                     downloadBehavior: AttachmentDownloadBehavior,
+                                     isBackfill: Bool,
+                                     success: @escaping ([TSAttachmentStream]) -> Void,
+                                     failure: @escaping (Error) -> Void) {
 
         Self.serialQueue.async {
             guard !CurrentAppContext().isRunningTests else {
@@ -493,6 +508,7 @@ public extension OWSAttachmentDownloads {
                     self.enqueueJobs(forAttachmentReferences: attachmentReferences,
                                      message: message,
                                      downloadBehavior: downloadBehavior,
+                                     isBackfill: isBackfill,
                                      success: { attachmentStreams in
                                         success(attachmentStreams)
 
@@ -533,9 +549,25 @@ public extension OWSAttachmentDownloads {
         }
     }
 
+    private class func priority(forCategory category: AttachmentCategory,
+                                downloadBehavior: AttachmentDownloadBehavior,
+                                isBackfill: Bool) -> OWSAttachmentDownloadPriority {
+        if case .bypassAll = downloadBehavior {
+            // The user asked for these downloads.
+            return .visible
+        }
+        switch category {
+        case .stickerSmall, .quotedReplyThumbnail, .linkedPreviewThumbnail, .contactShareAvatar:
+            return .thumbnail
+        default:
+            return isBackfill ? .backfill : .autoDownload
+        }
+    }
+
     private func enqueueJobs(forAttachmentReferences attachmentReferences: [AttachmentReference],
                              message: TSMessage?,
                              downloadBehavior: AttachmentDownloadBehavior,
+                             isBackfill: Bool = false,
                              success: @escaping ([TSAttachmentStream]) -> Void,
                              failure: @escaping (Error) -> Void) {
 
@@ -656,6 +688,9 @@ public extension OWSAttachmentDownloads {
                     promises.append(promise)
                     self.enqueueJob(forAttachmentId: attachmentPointer.uniqueId,
                                     message: message,
+                                    priority: Self.priority(forCategory: category,
+                                                            downloadBehavior: downloadBehavior,
+                                                            isBackfill: isBackfill),
                                     success: { attachmentStream in
                                         unfairLock.withLock {
                                             attachmentStreams.append(attachmentStream)
@@ -676,12 +711,12 @@ public extension OWSAttachmentDownloads {
             // Block until _all_ promises have either succeeded or failed.
             _ = firstly(on: .global()) {
                 when(fulfilled: promises)
-            }.done(on: Self.serialQueue) { _ in
+            }.done(on: Self.taskQueue) { _ in
                 let attachmentStreamsCopy = unfairLock.withLock { attachmentStreams }
                 Logger.info("Attachment downloads succeeded: \(attachmentStreamsCopy.count).")
 
                 success(attachmentStreamsCopy)
-            }.catch(on: Self.serialQueue) { error in
+            }.catch(on: Self.taskQueue) { error in
                 Logger.warn("Attachment downloads failed.")
                 owsFailDebugUnlessNetworkFailure(error)
 
@@ -699,12 +734,15 @@ public extension OWSAttachmentDownloads {
 
     // MARK: -
 
+    // Downloads are driven from this queue. Their promise chains use the
+    // TaskQueue so that steps which follow one another on the queue don't
+    // re-dispatch.
+    static let taskQueue = TaskQueue(label: "org.whispersystems.signal.download", qos: .utility)
+
     @objc
-    static let serialQueue: DispatchQueue = {
-        return DispatchQueue(label: "org.whispersystems.signal.download",
-                             qos: .utility,
-                             autoreleaseFrequency: .workItem)
-    }()
+    static var serialQueue: DispatchQueue {
+        return taskQueue.dispatchQueue
+    }
 
     // We want to avoid large downloads from a compromised or buggy service.
     private static let maxDownloadSize = 150 * 1024 * 1024
@@ -716,9 +754,9 @@ public extension OWSAttachmentDownloads {
                             failure: @escaping (Error) -> Void) {
         firstly {
             Self.retrieveAttachment(job: job, attachmentPointer: attachmentPointer)
-        }.done(on: Self.serialQueue) { (attachmentStream: TSAttachmentStream) in
+        }.done(on: Self.taskQueue) { (attachmentStream: TSAttachmentStream) in
             success(attachmentStream)
-        }.catch(on: Self.serialQueue) { (error: Error) in
+        }.catch(on: Self.taskQueue) { (error: Error) in
             failure(error)
         }
     }
@@ -728,12 +766,16 @@ public extension OWSAttachmentDownloads {
 
         var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "retrieveAttachment")
 
-        return firstly(on: Self.serialQueue) { () -> Promise<URL> in
+        let signpostId = Signposts.begin(.attachmentDownload, attachmentPointer.uniqueId)
+
+        return firstly(on: Self.taskQueue) { () -> Promise<URL> in
             Self.download(job: job, attachmentPointer: attachmentPointer)
-        }.then(on: Self.serialQueue) { (encryptedFileUrl: URL) -> Promise<TSAttachmentStream> in
+        }.ensure(on: Self.taskQueue) {
+            Signposts.end(.attachmentDownload, signpostId)
+        }.then(on: Self.taskQueue) { (encryptedFileUrl: URL) -> Promise<TSAttachmentStream> in
             Self.decrypt(encryptedFileUrl: encryptedFileUrl,
                          attachmentPointer: attachmentPointer)
-        }.ensure(on: Self.serialQueue) {
+        }.ensure(on: Self.taskQueue) {
             guard backgroundTask != nil else {
                 owsFailDebug("Missing backgroundTask.")
                 return
@@ -759,8 +801,11 @@ public extension OWSAttachmentDownloads {
 
         let downloadState = DownloadState(job: job, attachmentPointer: attachmentPointer)
 
-        return firstly(on: Self.serialQueue) { () -> Promise<URL> in
-            Self.downloadAttempt(downloadState: downloadState)
+        return firstly(on: Self.taskQueue) { () -> Promise<URL> in
+            // Resume deferred downloads where they left off.
+            let resumeData = job.resumeData
+            job.resumeData = nil
+            return Self.downloadAttempt(downloadState: downloadState, resumeData: resumeData)
         }
     }
 
@@ -768,7 +813,7 @@ public extension OWSAttachmentDownloads {
                                        resumeData: Data? = nil,
                                        attemptIndex: UInt = 0) -> Promise<URL> {
 
-        return firstly(on: Self.serialQueue) { () -> Promise<OWSUrlDownloadResponse> in
+        return firstly(on: Self.taskQueue) { () -> Promise<OWSUrlDownloadResponse> in
             let attachmentPointer = downloadState.attachmentPointer
             let urlSession = self.signalService.urlSessionForCdn(cdnNumber: attachmentPointer.cdnNumber)
             let urlPath = try Self.urlPath(for: downloadState)
@@ -791,7 +836,7 @@ public extension OWSAttachmentDownloads {
                                                          headers: headers,
                                                          progress: progress)
             }
-        }.map(on: Self.serialQueue) { (response: OWSUrlDownloadResponse) in
+        }.map(on: Self.taskQueue) { (response: OWSUrlDownloadResponse) in
             let downloadUrl = response.downloadUrl
             guard let fileSize = OWSFileSystem.fileSize(of: downloadUrl) else {
                 throw OWSAssertionError("Could not determine attachment file size.")
@@ -800,9 +845,17 @@ public extension OWSAttachmentDownloads {
                 throw OWSAssertionError("Attachment download length exceeds max size.")
             }
             return downloadUrl
-        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<URL> in
+        }.recover(on: Self.taskQueue) { (error: Error) -> Promise<URL> in
             Logger.warn("Error: \(error)")
 
+            let job = downloadState.job
+            job.task = nil
+            guard !job.isDeferred else {
+                // The download was cancelled in favor of more urgent downloads.
+                job.resumeData = (error as NSError).userInfo[NSURLSessionDownloadTaskResumeData] as? Data
+                throw error
+            }
+
             let maxAttemptCount = 16
             if IsNetworkConnectivityFailure(error),
                attemptIndex < maxAttemptCount {
@@ -810,7 +863,7 @@ public extension OWSAttachmentDownloads {
                 return firstly {
                     // Wait briefly before retrying.
                     after(seconds: 0.25)
-                }.then { () -> Promise<URL> in
+                }.then(on: Self.taskQueue) { () -> Promise<URL> in
                     if let resumeData = (error as NSError).userInfo[NSURLSessionDownloadTaskResumeData] as? Data,
                        !resumeData.isEmpty {
                         return self.downloadAttempt(downloadState: downloadState, resumeData: resumeData, attemptIndex: attemptIndex + 1)
@@ -859,6 +912,7 @@ public extension OWSAttachmentDownloads {
             return
         }
 
+        downloadState.job.task = task
         downloadState.job.progress = CGFloat(progress.fractionCompleted)
 
         // Use a slightly non-zero value to ensure that the progress
@@ -873,13 +927,14 @@ public extension OWSAttachmentDownloads {
     private class func decrypt(encryptedFileUrl: URL,
                                attachmentPointer: TSAttachmentPointer) -> Promise<TSAttachmentStream> {
 
-        // Use serialQueue to ensure that we only load into memory
-        // & decrypt a single attachment at a time.
-        return firstly(on: Self.serialQueue) { () -> TSAttachmentStream in
-            let cipherText = try Data(contentsOf: encryptedFileUrl)
-            return try Self.decrypt(cipherText: cipherText,
-                                    attachmentPointer: attachmentPointer)
-        }.ensure(on: Self.serialQueue) {
+        // Use taskQueue to ensure that we only decrypt a single
+        // attachment at a time. Decryption streams from file to file,
+        // so memory use doesn't depend on the size of the attachment.
+        return firstly(on: Self.taskQueue) { () -> TSAttachmentStream in
+            try Self.decrypt(encryptedFileUrl: encryptedFileUrl,
+                             attachmentPointer: attachmentPointer,
+                             outputFileUrl: OWSFileSystem.temporaryFileUrl())
+        }.ensure(on: Self.taskQueue) {
             do {
                 try OWSFileSystem.deleteFileIfExists(url: encryptedFileUrl)
             } catch {
@@ -888,24 +943,29 @@ public extension OWSAttachmentDownloads {
         }
     }
 
-    private class func decrypt(cipherText: Data,
-                               attachmentPointer: TSAttachmentPointer) throws -> TSAttachmentStream {
+    private class func decrypt(encryptedFileUrl: URL,
+                               attachmentPointer: TSAttachmentPointer,
+                               outputFileUrl: URL) throws -> TSAttachmentStream {
 
         guard let encryptionKey = attachmentPointer.encryptionKey else {
             throw OWSAssertionError("Missing encryptionKey.")
         }
-        return try autoreleasepool {
-            let plaintext: Data = try Cryptography.decryptAttachment(cipherText,
-                                                                     withKey: encryptionKey,
-                                                                     digest: attachmentPointer.digest,
-                                                                     unpaddedSize: attachmentPointer.byteCount)
 
-            let attachmentStream = databaseStorage.read { transaction in
-                TSAttachmentStream(pointer: attachmentPointer, transaction: transaction)
-            }
-            try attachmentStream.write(plaintext)
-            return attachmentStream
+        let signpostId = Signposts.begin(.attachmentDecrypt, attachmentPointer.uniqueId)
+        defer { Signposts.end(.attachmentDecrypt, signpostId) }
+
+        try AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encryptedFileUrl,
+                                              encryptionKey: encryptionKey,
+                                              digest: attachmentPointer.digest,
+                                              unpaddedSize: attachmentPointer.byteCount,
+                                              outputFileUrl: outputFileUrl)
+
+        let attachmentStream = databaseStorage.read { transaction in
+            TSAttachmentStream(pointer: attachmentPointer, transaction: transaction)
         }
+        let dataSource = try DataSourcePath.dataSource(with: outputFileUrl, shouldDeleteOnDeallocation: true)
+        try attachmentStream.writeConsumingDataSource(dataSource)
+        return attachmentStream
     }
 
     // MARK: -
@@ -26,13 +26,22 @@ public class OWSMediaUtils: NSObject {
         guard NSData.ows_isValidImage(atPath: path) else {
             throw OWSMediaError.failure(description: "Invalid image.")
         }
-        guard let originalImage = UIImage(contentsOfFile: path) else {
+        // Let ImageIO decode the image at the thumbnail size, rather than
+        // decoding the full-resolution image and then scaling it down.
+        let sourceOptions = [kCGImageSourceShouldCache: false] as CFDictionary
+        guard let imageSource = CGImageSourceCreateWithURL(URL(fileURLWithPath: path) as CFURL, sourceOptions) else {
             throw OWSMediaError.failure(description: "Could not load original image.")
         }
-        guard let thumbnailImage = originalImage.resized(withMaxDimensionPoints: maxDimension) else {
+        let thumbnailOptions = [
+            kCGImageSourceCreateThumbnailFromImageAlways: true,
+            kCGImageSourceCreateThumbnailWithTransform: true,
+            kCGImageSourceShouldCacheImmediately: true,
+            kCGImageSourceThumbnailMaxPixelSize: maxDimension
+        ] as CFDictionary
+        guard let thumbnailImage = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, thumbnailOptions) else {
             throw OWSMediaError.failure(description: "Could not thumbnail image.")
         }
-        return thumbnailImage
+        return UIImage(cgImage: thumbnailImage)
     }
 
     @objc
@@ -75,6 +75,13 @@ private struct OWSThumbnailRequest {
     // arrive so that we prioritize the most recent view state.
     private var thumbnailRequestStack = [OWSThumbnailRequest]()
 
+    // This property should only be accessed on the serialQueue.
+    //
+    // Attachments whose thumbnails should be generated ahead of time.
+    // These are processed in the order in which they arrive, and only
+    // when there are no pending thumbnail requests.
+    private var prewarmQueue = [TSAttachmentStream]()
+
     private override init() {
         super.init()
 
@@ -99,6 +106,21 @@ private struct OWSThumbnailRequest {
         }
     }
 
+    // Generates any missing thumbnails for an attachment in the background,
+    // e.g. once it has been downloaded, so that they are already on disk by
+    // the time the attachment is displayed.
+    @objc
+    public func prewarmThumbnails(forAttachment attachment: TSAttachmentStream) {
+        guard canThumbnailAttachment(attachment: attachment) else {
+            return
+        }
+        serialQueue.async {
+            self.prewarmQueue.append(attachment)
+
+            self.processNextRequestSync()
+        }
+    }
+
     private func processNextRequestAsync() {
         serialQueue.async {
             self.processNextRequestSync()
@@ -108,6 +130,7 @@ private struct OWSThumbnailRequest {
     // This should only be called on the serialQueue.
     private func processNextRequestSync() {
         guard let thumbnailRequest = thumbnailRequestStack.popLast() else {
+            processNextPrewarmSync()
             return
         }
 
@@ -125,20 +148,79 @@ private struct OWSThumbnailRequest {
         }
     }
 
+    // This should only be called on the serialQueue.
+    private func processNextPrewarmSync() {
+        guard !prewarmQueue.isEmpty else {
+            return
+        }
+        let attachment = prewarmQueue.removeFirst()
+
+        do {
+            guard attachment.isValidVisualMedia else {
+                Logger.warn("Not prewarming thumbnails of invalid media.")
+                return
+            }
+            _ = try generateThumbnails(forAttachment: attachment, requiredDimensionPoints: nil)
+        } catch {
+            Logger.warn("Could not prewarm thumbnails: \(error)")
+        }
+    }
+
+    // This should only be called on the serialQueue.
+    private func process(thumbnailRequest: OWSThumbnailRequest) throws -> OWSLoadedThumbnail {
+        let attachment = thumbnailRequest.attachment
+        let thumbnailDimensionPoints = thumbnailRequest.thumbnailDimensionPoints
+
+        let thumbnailPath = attachment.path(forThumbnailDimensionPoints: thumbnailDimensionPoints)
+        if FileManager.default.fileExists(atPath: thumbnailPath) {
+            guard let image = UIImage(contentsOfFile: thumbnailPath) else {
+                throw OWSThumbnailError.failure(description: "Could not load thumbnail.")
+            }
+            return OWSLoadedThumbnail(image: image, filePath: thumbnailPath)
+        }
+
+        let loadedThumbnails = try generateThumbnails(forAttachment: attachment,
+                                                      requiredDimensionPoints: thumbnailDimensionPoints)
+        guard let loadedThumbnail = loadedThumbnails[thumbnailDimensionPoints] else {
+            throw OWSThumbnailError.assertionFailure(description: "Missing thumbnail.")
+        }
+        return loadedThumbnail
+    }
+
     // This should only be called on the serialQueue.
     //
+    // Generates all of the attachment's missing thumbnails, as well as the
+    // required size if specified. The original is only decoded once, at the
+    // largest size; each smaller size is scaled down from the next larger one.
+    //
     // It should be safe to assume that an attachment will never end up with two thumbnails of
     // the same size since:
     //
     // * Thumbnails are only added by this method.
     // * This method checks for an existing thumbnail using the same connection.
     // * This method is performed on the serial queue.
-    private func process(thumbnailRequest: OWSThumbnailRequest) throws -> OWSLoadedThumbnail {
-        let attachment = thumbnailRequest.attachment
+    private func generateThumbnails(forAttachment attachment: TSAttachmentStream,
+                                    requiredDimensionPoints: UInt?) throws -> [UInt: OWSLoadedThumbnail] {
         guard canThumbnailAttachment(attachment: attachment) else {
             throw OWSThumbnailError.failure(description: "Cannot thumbnail attachment.")
         }
 
+        let signpostId = Signposts.begin(.attachmentThumbnail, attachment.uniqueId)
+        defer { Signposts.end(.attachmentThumbnail, signpostId) }
+
+        var dimensionPointsToGenerate = attachment.thumbnailDimensionPointsToGenerate().map { $0.uintValue }
+        if let requiredDimensionPoints = requiredDimensionPoints,
+           !dimensionPointsToGenerate.contains(requiredDimensionPoints) {
+            dimensionPointsToGenerate.append(requiredDimensionPoints)
+        }
+        dimensionPointsToGenerate = dimensionPointsToGenerate.filter { thumbnailDimensionPoints in
+            thumbnailDimensionPoints == requiredDimensionPoints ||
+                !FileManager.default.fileExists(atPath: attachment.path(forThumbnailDimensionPoints: thumbnailDimensionPoints))
+        }.sorted(by: >)
+        guard let largestDimensionPoints = dimensionPointsToGenerate.first else {
+            return [:]
+        }
+
         // Sticker type metadata isn't reliable and default to
         // a webp MIME type. Therefore for all nominally webp
         // image attachments, determine the MIME type by examining
@@ -155,25 +237,17 @@ private struct OWSThumbnailRequest {
         }
         let isWebp = contentType == OWSMimeTypeImageWebp
 
-        let thumbnailPath = attachment.path(forThumbnailDimensionPoints: thumbnailRequest.thumbnailDimensionPoints)
-        if FileManager.default.fileExists(atPath: thumbnailPath) {
-            guard let image = UIImage(contentsOfFile: thumbnailPath) else {
-                throw OWSThumbnailError.failure(description: "Could not load thumbnail.")
-            }
-            return OWSLoadedThumbnail(image: image, filePath: thumbnailPath)
-        }
-
-        Logger.verbose("Creating thumbnail of size: \(thumbnailRequest.thumbnailDimensionPoints)")
+        Logger.verbose("Creating thumbnails of sizes: \(dimensionPointsToGenerate)")
 
-        let thumbnailDirPath = (thumbnailPath as NSString).deletingLastPathComponent
+        let thumbnailDirPath = (attachment.path(forThumbnailDimensionPoints: largestDimensionPoints) as NSString).deletingLastPathComponent
         guard OWSFileSystem.ensureDirectoryExists(thumbnailDirPath) else {
             throw OWSThumbnailError.failure(description: "Could not create attachment's thumbnail directory.")
         }
         guard let originalFilePath = attachment.originalFilePath else {
             throw OWSThumbnailError.failure(description: "Missing original file path.")
         }
-        let maxDimension = CGFloat(thumbnailRequest.thumbnailDimensionPoints)
-        let thumbnailImage: UIImage
+        let maxDimension = CGFloat(largestDimensionPoints)
+        var thumbnailImage: UIImage
         if isWebp {
             thumbnailImage = try OWSMediaUtils.thumbnail(forWebpAtPath: originalFilePath, maxDimension: maxDimension)
         } else if attachment.isImage || attachment.isAnimated {
@@ -183,6 +257,23 @@ private struct OWSThumbnailRequest {
         } else {
             throw OWSThumbnailError.assertionFailure(description: "Invalid attachment type.")
         }
+
+        var loadedThumbnails = [UInt: OWSLoadedThumbnail]()
+        for thumbnailDimensionPoints in dimensionPointsToGenerate {
+            if thumbnailDimensionPoints != largestDimensionPoints {
+                guard let resizedImage = thumbnailImage.resized(withMaxDimensionPoints: CGFloat(thumbnailDimensionPoints)) else {
+                    throw OWSThumbnailError.failure(description: "Could not resize thumbnail.")
+                }
+                thumbnailImage = resizedImage
+            }
+            let thumbnailPath = attachment.path(forThumbnailDimensionPoints: thumbnailDimensionPoints)
+            let thumbnailData = try write(thumbnailImage: thumbnailImage, isWebp: isWebp, thumbnailPath: thumbnailPath)
+            loadedThumbnails[thumbnailDimensionPoints] = OWSLoadedThumbnail(image: thumbnailImage, data: thumbnailData)
+        }
+        return loadedThumbnails
+    }
+
+    private func write(thumbnailImage: UIImage, isWebp: Bool, thumbnailPath: String) throws -> Data {
         let thumbnailData: Data
         if isWebp {
             guard let pngThumbnailData = thumbnailImage.pngData() else {
@@ -201,7 +292,7 @@ private struct OWSThumbnailRequest {
             throw OWSThumbnailError.externalError(description: "File write failed: \(thumbnailPath), \(error)", underlyingError: error)
         }
         OWSFileSystem.protectFileOrFolder(atPath: thumbnailPath)
-        return OWSLoadedThumbnail(image: thumbnailImage, data: thumbnailData)
+        return thumbnailData
     }
 
     @objc
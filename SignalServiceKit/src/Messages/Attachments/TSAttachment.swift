@@ -27,3 +27,25 @@ public extension TSAttachment {
         return attachmentPointer.state == .pendingManualDownload
     }
 }
+
+// MARK: -
+
+public extension TSAttachment {
+    // Traverses all attachments, decoding them in parallel.
+    // Attachments are not visited in any particular order.
+    @objc
+    class func anyEnumerateInParallel(transaction: SDSAnyReadTransaction,
+                                      block: @escaping (TSAttachment, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead:
+            TSAttachment.anyEnumerate(transaction: transaction, batched: true, block: block)
+        case .grdbRead(let grdbTransaction):
+            TSAttachment.grdbEnumerateInParallel(recordType: AttachmentRecord.self,
+                                                 sql: "SELECT * FROM \(AttachmentRecord.databaseTableName)",
+                                                 transaction: grdbTransaction,
+                                                 order: .unordered,
+                                                 decode: { try TSAttachment.fromRecord($0) },
+                                                 block: block)
+        }
+    }
+}
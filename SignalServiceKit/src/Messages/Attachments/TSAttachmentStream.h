@@ -172,6 +172,13 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:albumMessageId:atta
 // This method should only be invoked by OWSThumbnailService.
 - (NSString *)pathForThumbnailDimensionPoints:(NSUInteger)thumbnailDimensionPoints;
 
+// The thumbnail sizes which OWSThumbnailService generates for this attachment.
+// Sizes which aren't smaller than the original are omitted, since the
+// original is used instead.
+//
+// This method should only be invoked by OWSThumbnailService.
+- (NSArray<NSNumber *> *)thumbnailDimensionPointsToGenerate;
+
 #pragma mark - Validation
 
 @property (nonatomic, readonly) BOOL isValidImage;
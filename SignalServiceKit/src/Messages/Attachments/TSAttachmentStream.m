@@ -287,7 +287,19 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
         return NO;
     }
     OWSLogDebug(@"Writing attachment to file: %@", filePath);
-    return [data writeToFile:filePath options:0 error:error];
+    // The file may be shared with other attachments; see AttachmentBlobStore.
+    __block NSError *_Nullable writeError;
+    BOOL success = [AttachmentBlobStore writeFileAtPath:filePath
+                                                  block:^{
+                                                      NSError *_Nullable blockError;
+                                                      BOOL blockSuccess = [data writeToFile:filePath
+                                                                                    options:NSDataWritingAtomic
+                                                                                      error:&blockError];
+                                                      writeError = blockError;
+                                                      return blockSuccess;
+                                                  }];
+    *error = writeError;
+    return success;
 }
 
 - (BOOL)writeCopyingDataSource:(id<DataSource>)dataSource error:(NSError **)error
@@ -300,8 +312,17 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
         return NO;
     }
     OWSLogDebug(@"Writing attachment to file: %@", originalMediaURL);
-    return [dataSource writeToUrl:originalMediaURL
-                            error:error];
+    __block NSError *_Nullable writeError;
+    BOOL success = [AttachmentBlobStore writeFileAtPath:originalMediaURL.path
+                                                  block:^{
+                                                      NSError *_Nullable blockError;
+                                                      BOOL blockSuccess = [dataSource writeToUrl:originalMediaURL
+                                                                                           error:&blockError];
+                                                      writeError = blockError;
+                                                      return blockSuccess;
+                                                  }];
+    *error = writeError;
+    return success;
 }
 
 - (BOOL)writeConsumingDataSource:(id<DataSource>)dataSource error:(NSError **)error
@@ -314,7 +335,17 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
         return NO;
     }
     OWSLogDebug(@"Writing attachment to file: %@", originalMediaURL);
-    return [dataSource moveToUrlAndConsume:originalMediaURL error:error];
+    __block NSError *_Nullable writeError;
+    BOOL success = [AttachmentBlobStore writeFileAtPath:originalMediaURL.path
+                                                  block:^{
+                                                      NSError *_Nullable blockError;
+                                                      BOOL blockSuccess = [dataSource moveToUrlAndConsume:originalMediaURL
+                                                                                                    error:&blockError];
+                                                      writeError = blockError;
+                                                      return blockSuccess;
+                                                  }];
+    *error = writeError;
+    return success;
 }
 
 + (NSString *)legacyAttachmentsDirPath
@@ -418,6 +449,26 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
     return [self.thumbnailsDirPath stringByAppendingPathComponent:filename];
 }
 
+- (NSArray<NSNumber *> *)thumbnailDimensionPointsToGenerate
+{
+    CGSize originalSize = self.imageSize;
+    NSMutableArray<NSNumber *> *result = [NSMutableArray new];
+    for (NSNumber *thumbnailDimensionPoints in @[
+             @(kThumbnailDimensionPointsSmall),
+             @(kThumbnailDimensionPointsMedium),
+             @(ThumbnailDimensionPointsLarge()),
+         ]) {
+        // Match loadedThumbnailWithThumbnailDimensionPoints:, which uses the
+        // original rather than a thumbnail that isn't smaller than it.
+        if (originalSize.width <= thumbnailDimensionPoints.unsignedIntegerValue
+            || originalSize.height <= thumbnailDimensionPoints.unsignedIntegerValue) {
+            continue;
+        }
+        [result addObject:thumbnailDimensionPoints];
+    }
+    return result;
+}
+
 - (nullable NSURL *)originalMediaURL
 {
     NSString *_Nullable filePath = self.originalFilePath;
@@ -451,7 +502,7 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
         OWSFailDebug(@"Missing path for attachment.");
         return;
     }
-    if (![OWSFileSystem deleteFileIfExists:filePath]) {
+    if (![AttachmentBlobStore removeFileAtPath:filePath]) {
         OWSLogError(@"remove file failed");
     }
 
@@ -466,6 +517,14 @@ typedef void (^OWSLoadedThumbnailSuccess)(OWSLoadedThumbnail *loadedThumbnail);
 {
     [super anyDidInsertWithTransaction:transaction];
     [AnyMediaGalleryFinder didInsertAttachmentStream:self transaction:transaction];
+
+    // Generate the thumbnails of new attachments, e.g. those which have just been
+    // downloaded, before they are displayed.
+    if ([TSAttachmentStream hasThumbnailForMimeType:self.contentType] && !CurrentAppContext().isRunningTests) {
+        [transaction addAsyncCompletionOffMain:^{
+            [OWSThumbnailService.shared prewarmThumbnailsForAttachment:self];
+        }];
+    }
 }
 
 - (void)anyDidRemoveWithTransaction:(SDSAnyWriteTransaction *)transaction
@@ -0,0 +1,468 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import AVFoundation
+import PromiseKit
+import UniformTypeIdentifiers
+import VideoToolbox
+
+public enum VideoTranscoderError: Error {
+    case invalidInput
+    case cancelled
+    case failed(underlyingError: Error?)
+}
+
+// MARK: -
+
+// Re-encodes videos with an AVAssetReader/AVAssetWriter pipeline.
+//
+// Unlike AVAssetExportSession presets, this lets us choose the codec and the
+// bitrate (e.g. to fit a file size limit). The writer encodes with VideoToolbox,
+// which uses the hardware encoder where there is one.
+@objc
+public class VideoTranscoder: NSObject {
+
+    public enum Codec {
+        case h264
+        // Not every client can decode HEVC, so it is opt-in
+        // and falls back to H.264 if there's no hardware encoder.
+        case hevc
+    }
+
+    public struct Configuration {
+        // The output is scaled down to fit within this size,
+        // in whichever orientation matches the video.
+        public var maxSize = CGSize(width: 640, height: 480)
+
+        public var codec: Codec = .h264
+
+        // If set, the video bitrate is lowered as needed for the
+        // output to fit within this many bytes.
+        public var targetFileSize: UInt64?
+
+        public var maxVideoBitRate = 1_500_000
+        public var minVideoBitRate = 200_000
+        public var audioBitRate = 96_000
+
+        // If set (on iOS 14 and later), the output is written as fragmented
+        // MPEG-4 segments of about this duration, and `segmentHandler` is
+        // called with each segment as soon as it has been written, so that
+        // consumers can start work before transcoding finishes.
+        public var segmentDuration: TimeInterval?
+
+        public init() {}
+    }
+
+    public let asset: AVAsset
+    public let outputUrl: URL
+    public let configuration: Configuration
+
+    // Called on an arbitrary queue with each segment, in order. The
+    // first segment is the initialization segment. The output file is
+    // the concatenation of the segments.
+    public var segmentHandler: ((_ segmentData: Data, _ isInitializationSegment: Bool) -> Void)?
+
+    private let queue = DispatchQueue(label: "org.signal.videoTranscoder")
+
+    private let unfairLock = UnfairLock()
+
+    // These properties should only be accessed with unfairLock acquired.
+    private var _progress: Float = 0
+    private var _isCancelled = false
+    private var resolver: Resolver<Void>?
+    private var reader: AVAssetReader?
+    private var writer: AVAssetWriter?
+
+    // The writer delivers segments on its own queue.
+    private let segmentQueue = DispatchQueue(label: "org.signal.videoTranscoder.segments")
+
+    // This property should only be accessed on segmentQueue.
+    private var segmentFileHandle: FileHandle?
+
+    public init(asset: AVAsset, outputUrl: URL, configuration: Configuration = Configuration()) {
+        self.asset = asset
+        self.outputUrl = outputUrl
+        self.configuration = configuration
+
+        super.init()
+    }
+
+    // The fraction of the video that has been transcoded, from 0 to 1.
+    @objc
+    public var progress: Float {
+        unfairLock.withLock { _progress }
+    }
+
+    @objc
+    public var isCancelled: Bool {
+        unfairLock.withLock { _isCancelled }
+    }
+
+    // Stops transcoding, deletes the output and rejects the
+    // promise with VideoTranscoderError.cancelled.
+    @objc
+    public func cancel() {
+        let reader: AVAssetReader? = unfairLock.withLock {
+            _isCancelled = true
+            return self.reader
+        }
+        reader?.cancelReading()
+    }
+
+    public func transcode() -> Promise<Void> {
+        let (promise, resolver) = Promise<Void>.pending()
+        let didStart: Bool = unfairLock.withLock {
+            guard self.resolver == nil else {
+                return false
+            }
+            self.resolver = resolver
+            return true
+        }
+        guard didStart else {
+            return Promise(error: OWSAssertionError("Transcoding has already started."))
+        }
+
+        queue.async {
+            do {
+                try self.startTranscoding()
+            } catch {
+                self.finish(error: error)
+            }
+        }
+        return promise
+    }
+
+    // MARK: -
+
+    private func startTranscoding() throws {
+        guard !isCancelled else {
+            throw VideoTranscoderError.cancelled
+        }
+        guard let videoTrack = asset.tracks(withMediaType: .video).first else {
+            throw VideoTranscoderError.invalidInput
+        }
+        let audioTrack = asset.tracks(withMediaType: .audio).first
+        let duration = asset.duration.seconds
+        guard duration.isFinite, duration > 0 else {
+            throw VideoTranscoderError.invalidInput
+        }
+
+        let reader = try AVAssetReader(asset: asset)
+
+        let videoOutput = AVAssetReaderTrackOutput(track: videoTrack, outputSettings: [
+            kCVPixelBufferPixelFormatTypeKey as String: kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange
+        ])
+        videoOutput.alwaysCopiesSampleData = false
+        guard reader.canAdd(videoOutput) else {
+            throw VideoTranscoderError.invalidInput
+        }
+        reader.add(videoOutput)
+
+        let audioChannelCount = audioTrack.map { Self.audioChannelCount(track: $0) } ?? 0
+        var audioOutput: AVAssetReaderTrackOutput?
+        if let audioTrack = audioTrack {
+            let output = AVAssetReaderTrackOutput(track: audioTrack, outputSettings: [
+                AVFormatIDKey: kAudioFormatLinearPCM,
+                AVSampleRateKey: 44_100,
+                AVNumberOfChannelsKey: audioChannelCount
+            ])
+            output.alwaysCopiesSampleData = false
+            if reader.canAdd(output) {
+                reader.add(output)
+                audioOutput = output
+            } else {
+                Logger.warn("Dropping audio track.")
+            }
+        }
+
+        let writer = try makeWriter()
+        writer.metadata = AVMetadataItem.metadataItems(from: asset.metadata, filteredBy: .forSharing())
+
+        let videoBitRate = Self.videoBitRate(configuration: configuration,
+                                             duration: duration,
+                                             hasAudio: audioOutput != nil)
+        let videoInput = AVAssetWriterInput(mediaType: .video,
+                                            outputSettings: videoSettings(track: videoTrack, bitRate: videoBitRate))
+        videoInput.transform = videoTrack.preferredTransform
+        videoInput.expectsMediaDataInRealTime = false
+        guard writer.canAdd(videoInput) else {
+            throw VideoTranscoderError.invalidInput
+        }
+        writer.add(videoInput)
+
+        var audioInput: AVAssetWriterInput?
+        if audioOutput != nil {
+            let input = AVAssetWriterInput(mediaType: .audio, outputSettings: [
+                AVFormatIDKey: kAudioFormatMPEG4AAC,
+                AVSampleRateKey: 44_100,
+                AVNumberOfChannelsKey: audioChannelCount,
+                AVEncoderBitRateKey: configuration.audioBitRate
+            ])
+            input.expectsMediaDataInRealTime = false
+            guard writer.canAdd(input) else {
+                throw VideoTranscoderError.invalidInput
+            }
+            writer.add(input)
+            audioInput = input
+        }
+
+        unfairLock.withLock {
+            self.reader = reader
+            self.writer = writer
+        }
+        // Cancellation may have raced with setup.
+        guard !isCancelled else {
+            throw VideoTranscoderError.cancelled
+        }
+
+        Logger.info("Transcoding \(Int(duration))s video at \(videoBitRate) bps.")
+
+        guard reader.startReading() else {
+            throw VideoTranscoderError.failed(underlyingError: reader.error)
+        }
+        guard writer.startWriting() else {
+            throw VideoTranscoderError.failed(underlyingError: writer.error)
+        }
+        writer.startSession(atSourceTime: .zero)
+
+        let group = DispatchGroup()
+        pump(output: videoOutput, input: videoInput, duration: duration, reportsProgress: true, group: group)
+        if let audioOutput = audioOutput, let audioInput = audioInput {
+            pump(output: audioOutput, input: audioInput, duration: duration, reportsProgress: false, group: group)
+        }
+        group.notify(queue: queue) {
+            self.finishTranscoding(reader: reader, writer: writer)
+        }
+    }
+
+    private func makeWriter() throws -> AVAssetWriter {
+        try OWSFileSystem.deleteFileIfExists(url: outputUrl)
+
+        if #available(iOS 14, *), let segmentDuration = configuration.segmentDuration {
+            guard FileManager.default.createFile(atPath: outputUrl.path, contents: nil) else {
+                throw OWSAssertionError("Could not create output file.")
+            }
+            let segmentFileHandle = try FileHandle(forWritingTo: outputUrl)
+            segmentQueue.sync {
+                self.segmentFileHandle = segmentFileHandle
+            }
+
+            let writer = AVAssetWriter(contentType: UTType(AVFileType.mp4.rawValue)!)
+            writer.outputFileTypeProfile = .mpeg4AppleHLS
+            writer.preferredOutputSegmentInterval = CMTime(seconds: segmentDuration, preferredTimescale: 600)
+            writer.initialSegmentStartTime = .zero
+            writer.delegate = self
+            return writer
+        }
+
+        let writer = try AVAssetWriter(outputURL: outputUrl, fileType: .mp4)
+        writer.shouldOptimizeForNetworkUse = true
+        return writer
+    }
+
+    private func videoSettings(track: AVAssetTrack, bitRate: Int) -> [String: Any] {
+        let outputSize = Self.outputSize(naturalSize: track.naturalSize,
+                                         preferredTransform: track.preferredTransform,
+                                         maxSize: configuration.maxSize)
+
+        let useHEVC = configuration.codec == .hevc && Self.hasHardwareHEVCEncoder
+        var compressionProperties: [String: Any] = [
+            AVVideoAverageBitRateKey: bitRate,
+            AVVideoMaxKeyFrameIntervalDurationKey: configuration.segmentDuration ?? 2
+        ]
+        if track.nominalFrameRate > 0 {
+            compressionProperties[AVVideoExpectedSourceFrameRateKey] = track.nominalFrameRate.rounded()
+        }
+        if useHEVC {
+            compressionProperties[AVVideoProfileLevelKey] = kVTProfileLevel_HEVC_Main_AutoLevel as String
+        } else {
+            compressionProperties[AVVideoProfileLevelKey] = AVVideoProfileLevelH264HighAutoLevel
+            compressionProperties[AVVideoH264EntropyModeKey] = AVVideoH264EntropyModeCABAC
+        }
+
+        return [
+            AVVideoCodecKey: useHEVC ? AVVideoCodecType.hevc : AVVideoCodecType.h264,
+            AVVideoWidthKey: outputSize.width,
+            AVVideoHeightKey: outputSize.height,
+            AVVideoScalingModeKey: AVVideoScalingModeResizeAspectFill,
+            AVVideoCompressionPropertiesKey: compressionProperties
+        ]
+    }
+
+    private func pump(output: AVAssetReaderOutput,
+                      input: AVAssetWriterInput,
+                      duration: TimeInterval,
+                      reportsProgress: Bool,
+                      group: DispatchGroup) {
+        group.enter()
+        var isDone = false
+        let pumpQueue = DispatchQueue(label: "org.signal.videoTranscoder.\(input.mediaType.rawValue)")
+        input.requestMediaDataWhenReady(on: pumpQueue) {
+            guard !isDone else {
+                return
+            }
+            func markAsFinished() {
+                isDone = true
+                input.markAsFinished()
+                group.leave()
+            }
+
+            while input.isReadyForMoreMediaData {
+                guard !self.isCancelled,
+                      let sampleBuffer = output.copyNextSampleBuffer() else {
+                    markAsFinished()
+                    return
+                }
+                guard input.append(sampleBuffer) else {
+                    // The writer has failed; finishTranscoding() will surface its error.
+                    markAsFinished()
+                    return
+                }
+                if reportsProgress {
+                    let sampleTime = CMSampleBufferGetPresentationTimeStamp(sampleBuffer).seconds
+                    if sampleTime.isFinite {
+                        let progress = Float(max(0, min(1, sampleTime / duration)))
+                        self.unfairLock.withLock { self._progress = progress }
+                    }
+                }
+            }
+        }
+    }
+
+    private func finishTranscoding(reader: AVAssetReader, writer: AVAssetWriter) {
+        guard !isCancelled else {
+            writer.cancelWriting()
+            finish(error: VideoTranscoderError.cancelled)
+            return
+        }
+        guard reader.status == .completed else {
+            writer.cancelWriting()
+            finish(error: VideoTranscoderError.failed(underlyingError: reader.error))
+            return
+        }
+        guard writer.status == .writing else {
+            writer.cancelWriting()
+            finish(error: VideoTranscoderError.failed(underlyingError: writer.error))
+            return
+        }
+
+        writer.finishWriting {
+            self.queue.async {
+                guard writer.status == .completed else {
+                    self.finish(error: VideoTranscoderError.failed(underlyingError: writer.error))
+                    return
+                }
+                self.finish(error: nil)
+            }
+        }
+    }
+
+    private func finish(error: Error?) {
+        let resolver: Resolver<Void>? = unfairLock.withLock {
+            if error == nil {
+                _progress = 1
+            }
+            self.reader = nil
+            self.writer = nil
+            return self.resolver
+        }
+
+        segmentQueue.async {
+            self.segmentFileHandle?.closeFile()
+            self.segmentFileHandle = nil
+
+            if let error = error {
+                OWSFileSystem.deleteFileIfExists(self.outputUrl.path)
+                resolver?.reject(error)
+            } else {
+                resolver?.fulfill(())
+            }
+        }
+    }
+
+    // MARK: - Settings
+
+    private static let hasHardwareHEVCEncoder: Bool = {
+        // AVFoundation only offers the HEVC presets on devices which
+        // can encode HEVC in hardware.
+        AVAssetExportSession.allExportPresets().contains(AVAssetExportPresetHEVCHighestQuality)
+    }()
+
+    private static func audioChannelCount(track: AVAssetTrack) -> Int {
+        for formatDescription in track.formatDescriptions {
+            // swiftlint:disable:next force_cast
+            let audioFormatDescription = formatDescription as! CMAudioFormatDescription
+            if let streamDescription = CMAudioFormatDescriptionGetStreamBasicDescription(audioFormatDescription) {
+                return streamDescription.pointee.mChannelsPerFrame == 1 ? 1 : 2
+            }
+        }
+        return 2
+    }
+
+    // Scales the video to fit within maxSize (in the orientation which matches
+    // how the video is displayed), without scaling it up.
+    //
+    // The result is in the video's natural (encoded) orientation, with even
+    // dimensions, as 4:2:0 chroma subsampling requires.
+    static func outputSize(naturalSize: CGSize, preferredTransform: CGAffineTransform, maxSize: CGSize) -> CGSize {
+        let naturalWidth = abs(naturalSize.width)
+        let naturalHeight = abs(naturalSize.height)
+        guard naturalWidth > 0, naturalHeight > 0 else {
+            return maxSize
+        }
+
+        let isRotated = abs(preferredTransform.b) > abs(preferredTransform.a)
+        let displayWidth = isRotated ? naturalHeight : naturalWidth
+        let displayHeight = isRotated ? naturalWidth : naturalHeight
+
+        let maxLongEdge = max(maxSize.width, maxSize.height)
+        let maxShortEdge = min(maxSize.width, maxSize.height)
+        let maxDisplayWidth = displayWidth >= displayHeight ? maxLongEdge : maxShortEdge
+        let maxDisplayHeight = displayWidth >= displayHeight ? maxShortEdge : maxLongEdge
+
+        let scale = min(1, maxDisplayWidth / displayWidth, maxDisplayHeight / displayHeight)
+        func evenDimension(_ value: CGFloat) -> CGFloat {
+            max(2, (value * scale / 2).rounded() * 2)
+        }
+        return CGSize(width: evenDimension(naturalWidth), height: evenDimension(naturalHeight))
+    }
+
+    // Chooses the highest video bitrate, up to maxVideoBitRate, which
+    // should still let the output fit within the target file size.
+    static func videoBitRate(configuration: Configuration, duration: TimeInterval, hasAudio: Bool) -> Int {
+        var bitRate = configuration.maxVideoBitRate
+        if let targetFileSize = configuration.targetFileSize, duration > 0 {
+            // Leave headroom for the container and for the encoder overshooting.
+            let availableBits = Double(targetFileSize) * 8 * 0.9
+            let audioBits = hasAudio ? Double(configuration.audioBitRate) * duration : 0
+            let availableBitRate = (availableBits - audioBits) / duration
+            if availableBitRate < Double(bitRate) {
+                bitRate = Int(max(0, availableBitRate))
+            }
+        }
+        // If even the minimum bitrate doesn't fit, the caller's
+        // file size validation will reject the output.
+        return max(bitRate, configuration.minVideoBitRate)
+    }
+}
+
+// MARK: -
+
+@available(iOS 14, *)
+extension VideoTranscoder: AVAssetWriterDelegate {
+    public func assetWriter(_ writer: AVAssetWriter,
+                            didOutputSegmentData segmentData: Data,
+                            segmentType: AVAssetSegmentType,
+                            segmentReport: AVAssetSegmentReport?) {
+        segmentQueue.sync {
+            guard let segmentFileHandle = segmentFileHandle else {
+                owsFailDebug("Missing segmentFileHandle.")
+                return
+            }
+            segmentFileHandle.write(segmentData)
+        }
+        segmentHandler?(segmentData, segmentType == .initialization)
+    }
+}
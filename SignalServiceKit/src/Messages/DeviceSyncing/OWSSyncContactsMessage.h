@@ -28,6 +28,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable NSData *)buildPlainTextAttachmentDataWithTransaction:(SDSAnyReadTransaction *)transaction;
 
+// Like buildPlainTextAttachmentDataWithTransaction:, but streams the attachment
+// to a temporary file so that memory use doesn't grow with the number of
+// contacts. The caller is responsible for deleting the file.
+- (nullable NSURL *)buildPlainTextAttachmentFileWithTransaction:(SDSAnyReadTransaction *)transaction;
+
 @end
 
 NS_ASSUME_NONNULL_END
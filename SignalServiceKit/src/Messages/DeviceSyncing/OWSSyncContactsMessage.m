@@ -5,6 +5,7 @@
 #import "OWSSyncContactsMessage.h"
 #import "Contact.h"
 #import "ContactsManagerProtocol.h"
+#import "MIMETypeUtil.h"
 #import "OWSContactsOutputStream.h"
 #import "OWSIdentityManager.h"
 #import "ProfileManagerProtocol.h"
@@ -93,6 +94,40 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (nullable NSData *)buildPlainTextAttachmentDataWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    NSOutputStream *dataOutputStream = [NSOutputStream outputStreamToMemory];
+    [dataOutputStream open];
+    OWSContactsOutputStream *contactsOutputStream =
+        [[OWSContactsOutputStream alloc] initWithOutputStream:dataOutputStream];
+
+    [self writeSignalAccountsToStream:contactsOutputStream transaction:transaction];
+
+    [dataOutputStream close];
+
+    if (contactsOutputStream.hasError) {
+        OWSFailDebug(@"Could not write contacts sync stream.");
+        return nil;
+    }
+
+    return [dataOutputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+}
+
+- (nullable NSURL *)buildPlainTextAttachmentFileWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    OWSContactsOutputStream *contactsOutputStream =
+        [OWSContactsOutputStream streamToTemporaryFileWithFileExtension:kSyncMessageFileExtension];
+
+    [self writeSignalAccountsToStream:contactsOutputStream transaction:transaction];
+
+    NSURL *_Nullable fileUrl = [contactsOutputStream finishTemporaryFile];
+    if (fileUrl == nil) {
+        OWSFailDebug(@"Could not write contacts sync stream.");
+    }
+    return fileUrl;
+}
+
+- (void)writeSignalAccountsToStream:(OWSContactsOutputStream *)contactsOutputStream
+                        transaction:(SDSAnyReadTransaction *)transaction
 {
     NSMutableArray<SignalAccount *> *signalAccounts = [self.signalAccounts mutableCopy];
 
@@ -113,14 +148,6 @@ NS_ASSUME_NONNULL_BEGIN
         }
     }
 
-    // TODO use temp file stream to avoid loading everything into memory at once
-    // First though, we need to re-engineer our attachment process to accept streams (encrypting with stream,
-    // and uploading with streams).
-    NSOutputStream *dataOutputStream = [NSOutputStream outputStreamToMemory];
-    [dataOutputStream open];
-    OWSContactsOutputStream *contactsOutputStream =
-        [[OWSContactsOutputStream alloc] initWithOutputStream:dataOutputStream];
-
     for (SignalAccount *signalAccount in signalAccounts) {
         OWSRecipientIdentity *_Nullable recipientIdentity =
             [self.identityManager recipientIdentityForAddress:signalAccount.recipientAddress transaction:transaction];
@@ -155,15 +182,6 @@ NS_ASSUME_NONNULL_BEGIN
                                       isArchived:isArchived
                                    inboxPosition:inboxPosition];
     }
-    
-    [dataOutputStream close];
-
-    if (contactsOutputStream.hasError) {
-        OWSFailDebug(@"Could not write contacts sync stream.");
-        return nil;
-    }
-
-    return [dataOutputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
 }
 
 @end
@@ -19,6 +19,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable NSData *)buildPlainTextAttachmentDataWithTransaction:(SDSAnyReadTransaction *)transaction;
 
+// Like buildPlainTextAttachmentDataWithTransaction:, but streams the attachment
+// to a temporary file. The caller is responsible for deleting the file.
+- (nullable NSURL *)buildPlainTextAttachmentFileWithTransaction:(SDSAnyReadTransaction *)transaction;
+
 @end
 
 NS_ASSUME_NONNULL_END
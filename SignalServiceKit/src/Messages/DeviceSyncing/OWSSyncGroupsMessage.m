@@ -3,6 +3,7 @@
 //
 
 #import "OWSSyncGroupsMessage.h"
+#import "MIMETypeUtil.h"
 #import "OWSGroupsOutputStream.h"
 #import "TSAttachment.h"
 #import "TSAttachmentStream.h"
@@ -58,13 +59,38 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable NSData *)buildPlainTextAttachmentDataWithTransaction:(SDSAnyReadTransaction *)transaction
 {
-    // TODO use temp file stream to avoid loading everything into memory at once
-    // First though, we need to re-engineer our attachment process to accept streams (encrypting with stream,
-    // and uploading with streams).
     NSOutputStream *dataOutputStream = [NSOutputStream outputStreamToMemory];
     [dataOutputStream open];
     OWSGroupsOutputStream *groupsOutputStream = [[OWSGroupsOutputStream alloc] initWithOutputStream:dataOutputStream];
 
+    [self writeGroupsToStream:groupsOutputStream transaction:transaction];
+
+    [dataOutputStream close];
+
+    if (groupsOutputStream.hasError) {
+        OWSFailDebug(@"Could not write groups sync stream.");
+        return nil;
+    }
+
+    return [dataOutputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+}
+
+- (nullable NSURL *)buildPlainTextAttachmentFileWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    OWSGroupsOutputStream *groupsOutputStream =
+        [OWSGroupsOutputStream streamToTemporaryFileWithFileExtension:kSyncMessageFileExtension];
+
+    [self writeGroupsToStream:groupsOutputStream transaction:transaction];
+
+    NSURL *_Nullable fileUrl = [groupsOutputStream finishTemporaryFile];
+    if (fileUrl == nil) {
+        OWSFailDebug(@"Could not write groups sync stream.");
+    }
+    return fileUrl;
+}
+
+- (void)writeGroupsToStream:(OWSGroupsOutputStream *)groupsOutputStream transaction:(SDSAnyReadTransaction *)transaction
+{
     [TSGroupThread
         anyEnumerateWithTransaction:transaction
                             batched:YES
@@ -83,15 +109,6 @@ NS_ASSUME_NONNULL_BEGIN
 
                                   [groupsOutputStream writeGroup:groupThread transaction:transaction];
                               }];
-
-    [dataOutputStream close];
-
-    if (groupsOutputStream.hasError) {
-        OWSFailDebug(@"Could not write groups sync stream.");
-        return nil;
-    }
-
-    return [dataOutputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
 }
 
 @end
@@ -0,0 +1,291 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+/// An in-memory timer wheel of the upcoming disappearing message expirations.
+///
+/// The wheel is filled from the `expiresAt` index with the messages expiring
+/// within the next `windowDurationMs`, bucketed into one-second slots. Later
+/// expirations stay in the database until the wheel reaches them. Messages
+/// whose expiration starts after the wheel is filled are added as their
+/// records are written.
+///
+/// This lets OWSDisappearingMessagesJob find the messages that are due, and its
+/// next expiration, without querying the database on every pass.
+@objc
+public class DisappearingMessagesExpirationWheel: NSObject {
+
+    // Each slot holds the messages expiring within this many milliseconds.
+    static let slotDurationMs: UInt64 = 1000
+
+    // We fill the wheel with the messages expiring within this window.
+    static let windowDurationMs: UInt64 = 10 * 60 * 1000
+
+    // The most messages we'll load from the index at once.
+    static let defaultMaxLoadedMessageCount = 2000
+
+    private let maxLoadedMessageCount: Int
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+
+    // Slot index -> message uniqueId -> expiresAt.
+    private var slots = [UInt64: [String: UInt64]]()
+    private var slotIndexMap = [String: UInt64]()
+
+    private var _isLoaded = false
+
+    // Every message that expires at or before this timestamp is in a slot.
+    private var loadedThroughTimestamp: UInt64 = 0
+
+    // The earliest expiration that is after loadedThroughTimestamp, if any.
+    private var nextUnloadedExpiration: UInt64?
+
+    // MARK: -
+
+    @objc
+    public override convenience init() {
+        self.init(maxLoadedMessageCount: Self.defaultMaxLoadedMessageCount)
+    }
+
+    init(maxLoadedMessageCount: Int) {
+        owsAssertDebug(maxLoadedMessageCount > 0)
+        self.maxLoadedMessageCount = maxLoadedMessageCount
+    }
+
+    // MARK: -
+
+    @objc
+    public var isLoaded: Bool {
+        unfairLock.withLock { _isLoaded }
+    }
+
+    @objc
+    public var trackedMessageCount: Int {
+        unfairLock.withLock { slotIndexMap.count }
+    }
+
+    @objc
+    public func needsLoad(nowMs: UInt64) -> Bool {
+        unfairLock.withLock {
+            !_isLoaded || nowMs >= loadedThroughTimestamp
+        }
+    }
+
+    /// Discards the wheel's contents so that the next pass refills it from the database.
+    @objc
+    public func reset() {
+        unfairLock.withLock {
+            slots.removeAll()
+            slotIndexMap.removeAll()
+            _isLoaded = false
+            loadedThroughTimestamp = 0
+            nextUnloadedExpiration = nil
+        }
+    }
+
+    /// Adds a message whose expiration has started.
+    ///
+    /// This can be called before the message's transaction commits; the caller
+    /// must tolerate messages that are missing or no longer due when popped.
+    @objc
+    public func trackMessage(uniqueId: String, expiresAt: UInt64) {
+        guard expiresAt > 0 else {
+            return
+        }
+        unfairLock.withLock {
+            insert(uniqueId: uniqueId, expiresAt: expiresAt)
+        }
+    }
+
+    // This method should only be called with unfairLock.
+    private func insert(uniqueId: String, expiresAt: UInt64) {
+        if _isLoaded, expiresAt > loadedThroughTimestamp {
+            // We'll load this message from the database when the wheel reaches it.
+            if let oldSlotIndex = slotIndexMap.removeValue(forKey: uniqueId) {
+                removeFromSlot(uniqueId: uniqueId, slotIndex: oldSlotIndex)
+            }
+            nextUnloadedExpiration = min(nextUnloadedExpiration ?? expiresAt, expiresAt)
+            return
+        }
+
+        let slotIndex = expiresAt / Self.slotDurationMs
+        if let oldSlotIndex = slotIndexMap[uniqueId], oldSlotIndex != slotIndex {
+            removeFromSlot(uniqueId: uniqueId, slotIndex: oldSlotIndex)
+        }
+        slotIndexMap[uniqueId] = slotIndex
+        slots[slotIndex, default: [:]][uniqueId] = expiresAt
+    }
+
+    // This method should only be called with unfairLock.
+    private func removeFromSlot(uniqueId: String, slotIndex: UInt64) {
+        slots[slotIndex]?.removeValue(forKey: uniqueId)
+        if slots[slotIndex]?.isEmpty == true {
+            slots.removeValue(forKey: slotIndex)
+        }
+    }
+
+    /// Fills the wheel with the messages expiring within the next window.
+    ///
+    /// Returns false if the wheel can't be filled from this transaction,
+    /// in which case the caller should fall back to querying the database.
+    @objc
+    @discardableResult
+    public func load(nowMs: UInt64, transaction: SDSAnyReadTransaction) -> Bool {
+        guard case .grdbRead(let grdbRead) = transaction.readTransaction else {
+            return false
+        }
+
+        let windowEnd = nowMs + Self.windowDurationMs
+        let newLoadedThroughTimestamp: UInt64
+        var entries = [(uniqueId: String, expiresAt: UInt64)]()
+        do {
+            let sql = """
+            SELECT \(interactionColumn: .id), \(interactionColumn: .uniqueId), \(interactionColumn: .expiresAt)
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .expiresAt) > 0
+            AND \(interactionColumn: .expiresAt) <= ?
+            ORDER BY \(interactionColumn: .expiresAt), \(interactionColumn: .id)
+            LIMIT ?
+            """
+            var lastRowId = try loadEntries(sql: sql,
+                                            arguments: [windowEnd, maxLoadedMessageCount],
+                                            into: &entries,
+                                            transaction: grdbRead)
+            if entries.count >= maxLoadedMessageCount, let lastExpiresAt = entries.last?.expiresAt {
+                // The page may end inside a run of messages that expire at the
+                // same time. loadedThroughTimestamp can only split the index
+                // between timestamps, so we page through the rest of the run
+                // by id. Otherwise a run longer than a page could never be
+                // loaded, and its messages would never be deleted.
+                let sql = """
+                SELECT \(interactionColumn: .id), \(interactionColumn: .uniqueId), \(interactionColumn: .expiresAt)
+                FROM \(InteractionRecord.databaseTableName)
+                WHERE \(interactionColumn: .expiresAt) = ?
+                AND \(interactionColumn: .id) > ?
+                ORDER BY \(interactionColumn: .id)
+                LIMIT ?
+                """
+                while let rowId = lastRowId {
+                    lastRowId = try loadEntries(sql: sql,
+                                                arguments: [lastExpiresAt, rowId, maxLoadedMessageCount],
+                                                into: &entries,
+                                                transaction: grdbRead)
+                }
+                newLoadedThroughTimestamp = lastExpiresAt
+            } else {
+                newLoadedThroughTimestamp = windowEnd
+            }
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return false
+        }
+
+        let newNextUnloadedExpiration: UInt64?
+        do {
+            let sql = """
+            SELECT MIN(\(interactionColumn: .expiresAt))
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .expiresAt) > ?
+            """
+            newNextUnloadedExpiration = try UInt64.fetchOne(grdbRead.database,
+                                                            sql: sql,
+                                                            arguments: [newLoadedThroughTimestamp])
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return false
+        }
+
+        unfairLock.withLock {
+            // Keep any messages that were tracked while we were loading.
+            if let oldNextUnloadedExpiration = nextUnloadedExpiration,
+               oldNextUnloadedExpiration > newLoadedThroughTimestamp {
+                nextUnloadedExpiration = min(newNextUnloadedExpiration ?? oldNextUnloadedExpiration,
+                                             oldNextUnloadedExpiration)
+            } else {
+                nextUnloadedExpiration = newNextUnloadedExpiration
+            }
+            loadedThroughTimestamp = newLoadedThroughTimestamp
+            _isLoaded = true
+            for entry in entries {
+                insert(uniqueId: entry.uniqueId, expiresAt: entry.expiresAt)
+            }
+        }
+
+        if DebugFlags.isMessageProcessingVerbose {
+            Logger.verbose("Loaded \(entries.count) expiring messages.")
+        }
+        return true
+    }
+
+    // Appends the (id, uniqueId, expiresAt) rows returned by sql to entries.
+    //
+    // Returns the id of the last row if the query returned a full page.
+    private func loadEntries(sql: String,
+                             arguments: StatementArguments,
+                             into entries: inout [(uniqueId: String, expiresAt: UInt64)],
+                             transaction: GRDBReadTransaction) throws -> Int64? {
+        let rows = try Row.fetchAll(transaction.database, sql: sql, arguments: arguments)
+        var lastRowId: Int64?
+        for row in rows {
+            let rowId: Int64 = row[0]
+            let uniqueId: String = row[1]
+            let expiresAt: Int64 = row[2]
+            entries.append((uniqueId: uniqueId, expiresAt: UInt64(expiresAt)))
+            lastRowId = rowId
+        }
+        return rows.count >= maxLoadedMessageCount ? lastRowId : nil
+    }
+
+    /// Removes and returns the ids of the messages that expire at or before nowMs.
+    @objc
+    public func popExpiredMessageIds(nowMs: UInt64) -> [String] {
+        unfairLock.withLock {
+            let currentSlotIndex = nowMs / Self.slotDurationMs
+            var expiredMessageIds = [String]()
+            for slotIndex in Array(slots.keys) where slotIndex <= currentSlotIndex {
+                guard let slot = slots[slotIndex] else {
+                    continue
+                }
+                var remainingSlot = [String: UInt64]()
+                for (uniqueId, expiresAt) in slot {
+                    if expiresAt <= nowMs {
+                        expiredMessageIds.append(uniqueId)
+                        slotIndexMap.removeValue(forKey: uniqueId)
+                    } else {
+                        remainingSlot[uniqueId] = expiresAt
+                    }
+                }
+                if remainingSlot.isEmpty {
+                    slots.removeValue(forKey: slotIndex)
+                } else {
+                    slots[slotIndex] = remainingSlot
+                }
+            }
+            return expiredMessageIds
+        }
+    }
+
+    /// The earliest expiration known to the wheel, if any.
+    ///
+    /// - Returns: uint64_t millisecond timestamp wrapped in a number,
+    ///            or nil if there are no upcoming expirations.
+    @objc
+    public var nextExpirationTimestamp: NSNumber? {
+        unfairLock.withLock {
+            var nextExpiration = nextUnloadedExpiration
+            if let firstSlotIndex = slots.keys.min(),
+               let firstSlotExpiration = slots[firstSlotIndex]?.values.min() {
+                nextExpiration = min(nextExpiration ?? firstSlotExpiration, firstSlotExpiration)
+            }
+            guard let result = nextExpiration else {
+                return nil
+            }
+            return NSNumber(value: result)
+        }
+    }
+}
@@ -3,7 +3,15 @@
 //
 
 import Foundation
+import GRDB
 
+/// Holds envelopes and receipts that reference messages we haven't received yet,
+/// and replays them when the target message arrives.
+///
+/// Envelopes for the most recently referenced messages are kept in memory. When
+/// there are too many of those, the envelopes of the least recently referenced
+/// messages overflow to the early_message_envelopes table, which is indexed by
+/// the target's timestamp.
 @objc
 public class EarlyMessageManager: NSObject {
     private struct MessageIdentifier: Hashable {
@@ -16,6 +24,7 @@ public class EarlyMessageManager: NSObject {
         let plainTextData: Data?
         let wasReceivedByUD: Bool
         let serverDeliveryTimestamp: UInt64
+        let recordedAt: UInt64
     }
 
     private enum EarlyReceipt {
@@ -33,12 +42,23 @@ public class EarlyMessageManager: NSObject {
 
     private static let maxQueuedPerMessage = 100
     private static let maxQueuedMessages = 100
+    private static let maxInMemoryEnvelopeMessages = 32
+    private static let maxOverflowEnvelopes = 5000
     private static let maxEarlyEnvelopeSize = 1024
 
     private let serialQueue = DispatchQueue(label: "EarlyMessageManager")
     private var pendingEnvelopes = OrderedDictionary<MessageIdentifier, [EarlyEnvelope]>()
     private var pendingReceipts =  OrderedDictionary<MessageIdentifier, [EarlyReceipt]>()
 
+    // The properties below should only be accessed on serialQueue.
+
+    // The timestamps of the messages with overflowed envelopes, or nil
+    // if we haven't loaded them from the database yet.
+    private var overflowTimestamps: Set<UInt64>?
+    private var overflowEnvelopeCount = 0
+    private var replayedEnvelopeCount: UInt64 = 0
+    private var totalReplayLatencyMs: UInt64 = 0
+
     public override init() {
         super.init()
 
@@ -55,13 +75,59 @@ public class EarlyMessageManager: NSObject {
 
     @objc
     func didReceiveMemoryWarning() {
-        Logger.error("Dropping all early messages due to memory warning.")
+        Logger.error("Dropping all early receipts and moving early envelopes to disk due to memory warning.")
+        var evictedEnvelopes = [(MessageIdentifier, [EarlyEnvelope])]()
         serialQueue.sync {
+            for identifier in pendingEnvelopes.orderedKeys {
+                if let envelopes = pendingEnvelopes[identifier] {
+                    evictedEnvelopes.append((identifier, envelopes))
+                }
+            }
             pendingEnvelopes = OrderedDictionary()
             pendingReceipts = OrderedDictionary()
         }
+        guard !evictedEnvelopes.isEmpty else {
+            return
+        }
+        SDSDatabaseStorage.shared.asyncWrite { transaction in
+            self.overflow(evictedEnvelopes: evictedEnvelopes, transaction: transaction)
+        }
+    }
+
+    // MARK: - Metrics
+
+    /// The number of early envelopes held in memory.
+    @objc
+    public var inMemoryEnvelopeCount: Int {
+        serialQueue.sync {
+            pendingEnvelopes.orderedKeys.reduce(0) { $0 + (pendingEnvelopes[$1]?.count ?? 0) }
+        }
     }
 
+    /// The number of early envelopes which have overflowed to disk, if known.
+    @objc
+    public var overflowedEnvelopeCount: Int {
+        serialQueue.sync { overflowEnvelopeCount }
+    }
+
+    /// The number of early receipts held in memory.
+    @objc
+    public var pendingReceiptCount: Int {
+        serialQueue.sync {
+            pendingReceipts.orderedKeys.reduce(0) { $0 + (pendingReceipts[$1]?.count ?? 0) }
+        }
+    }
+
+    /// The mean time between recording an early envelope and replaying it.
+    @objc
+    public var averageReplayLatencyMs: UInt64 {
+        serialQueue.sync {
+            replayedEnvelopeCount > 0 ? totalReplayLatencyMs / replayedEnvelopeCount : 0
+        }
+    }
+
+    // MARK: -
+
     @objc
     public func recordEarlyEnvelope(
         _ envelope: SSKProtoEnvelope,
@@ -69,13 +135,15 @@ public class EarlyMessageManager: NSObject {
         wasReceivedByUD: Bool,
         serverDeliveryTimestamp: UInt64,
         associatedMessageTimestamp: UInt64,
-        associatedMessageAuthor: SignalServiceAddress
+        associatedMessageAuthor: SignalServiceAddress,
+        transaction: SDSAnyWriteTransaction
     ) {
         guard plainTextData?.count ?? 0 <= Self.maxEarlyEnvelopeSize else {
             return owsFailDebug("unexpectedly tried to record an excessively large early envelope")
         }
 
         let identifier = MessageIdentifier(timestamp: associatedMessageTimestamp, author: associatedMessageAuthor)
+        var evictedEnvelopes = [(MessageIdentifier, [EarlyEnvelope])]()
         serialQueue.sync {
             var envelopes = pendingEnvelopes[identifier] ?? []
 
@@ -88,15 +156,25 @@ public class EarlyMessageManager: NSObject {
                 envelope: envelope,
                 plainTextData: plainTextData,
                 wasReceivedByUD: wasReceivedByUD,
-                serverDeliveryTimestamp: serverDeliveryTimestamp
+                serverDeliveryTimestamp: serverDeliveryTimestamp,
+                recordedAt: Date.ows_millisecondTimestamp()
             ))
+            // Setting the envelopes moves them to the end of the ordered keys,
+            // so the first key is always the least recently referenced message.
             pendingEnvelopes[identifier] = envelopes
 
-            while pendingEnvelopes.count >= Self.maxQueuedMessages, let droppedEarlyIdentifier = pendingEnvelopes.orderedKeys.first {
-                pendingEnvelopes.remove(key: droppedEarlyIdentifier)
-                owsFailDebug("Dropping all early envelopes for message \(droppedEarlyIdentifier) due to excessive early messages.")
+            while pendingEnvelopes.count > Self.maxInMemoryEnvelopeMessages,
+                  let evictedIdentifier = pendingEnvelopes.orderedKeys.first {
+                if let evicted = pendingEnvelopes[evictedIdentifier] {
+                    evictedEnvelopes.append((evictedIdentifier, evicted))
+                }
+                pendingEnvelopes.remove(key: evictedIdentifier)
             }
         }
+
+        if !evictedEnvelopes.isEmpty {
+            overflow(evictedEnvelopes: evictedEnvelopes, transaction: transaction)
+        }
     }
 
     @objc
@@ -180,6 +258,22 @@ public class EarlyMessageManager: NSObject {
             pendingEnvelopes[identifier] = nil
         }
 
+        // Envelopes on disk were recorded before the ones still in memory.
+        let overflowedEnvelopes = fetchAndRemoveOverflowedEnvelopes(identifier: identifier, transaction: transaction)
+        if !overflowedEnvelopes.isEmpty {
+            earlyEnvelopes = overflowedEnvelopes + (earlyEnvelopes ?? [])
+        }
+
+        if let earlyEnvelopes = earlyEnvelopes, !earlyEnvelopes.isEmpty {
+            let nowMs = Date.ows_millisecondTimestamp()
+            let latencyMs = earlyEnvelopes.reduce(UInt64(0)) { $0 + (nowMs - min(nowMs, $1.recordedAt)) }
+            serialQueue.sync {
+                replayedEnvelopeCount += UInt64(earlyEnvelopes.count)
+                totalReplayLatencyMs += latencyMs
+            }
+            Logger.info("Replaying \(earlyEnvelopes.count) early envelopes for message \(identifier.timestamp), mean latency: \(latencyMs / UInt64(earlyEnvelopes.count))ms.")
+        }
+
         // Apply any early receipts for this message
         for earlyReceipt in earlyReceipts ?? [] {
             switch earlyReceipt {
@@ -226,6 +320,163 @@ public class EarlyMessageManager: NSObject {
     }
 }
 
+// MARK: - Overflow
+
+extension EarlyMessageManager {
+
+    private static let overflowTableName = "early_message_envelopes"
+
+    // This method should only be called on serialQueue.
+    private func loadOverflowTimestampsIfNecessary(transaction: GRDBReadTransaction) -> Set<UInt64> {
+        if let overflowTimestamps = overflowTimestamps {
+            return overflowTimestamps
+        }
+        var timestamps = Set<UInt64>()
+        do {
+            let sql = "SELECT associatedMessageTimestamp FROM \(Self.overflowTableName)"
+            let cursor = try Int64.fetchCursor(transaction.database, sql: sql)
+            var count = 0
+            while let timestamp = try cursor.next() {
+                timestamps.insert(UInt64(timestamp))
+                count += 1
+            }
+            overflowEnvelopeCount = count
+        } catch {
+            owsFailDebug("Error: \(error)")
+        }
+        overflowTimestamps = timestamps
+        return timestamps
+    }
+
+    private func overflow(evictedEnvelopes: [(MessageIdentifier, [EarlyEnvelope])],
+                          transaction: SDSAnyWriteTransaction) {
+        guard case .grdbWrite(let grdbWrite) = transaction.writeTransaction else {
+            for (identifier, _) in evictedEnvelopes {
+                owsFailDebug("Dropping all early envelopes for message \(identifier) due to excessive early messages.")
+            }
+            return
+        }
+
+        let sql = """
+        INSERT INTO \(Self.overflowTableName) (
+            associatedMessageTimestamp,
+            associatedMessageAuthorUuid,
+            associatedMessageAuthorPhoneNumber,
+            envelopeData,
+            plainTextData,
+            wasReceivedByUD,
+            serverDeliveryTimestamp,
+            recordedAt
+        ) VALUES (?, ?, ?, ?, ?, ?, ?, ?)
+        """
+
+        serialQueue.sync {
+            var timestamps = loadOverflowTimestampsIfNecessary(transaction: grdbWrite)
+            do {
+                for (identifier, envelopes) in evictedEnvelopes {
+                    for earlyEnvelope in envelopes {
+                        let envelopeData = try earlyEnvelope.envelope.serializedData()
+                        try grdbWrite.database.execute(sql: sql, arguments: [
+                            identifier.timestamp,
+                            identifier.author.uuidString,
+                            identifier.author.phoneNumber,
+                            envelopeData,
+                            earlyEnvelope.plainTextData,
+                            earlyEnvelope.wasReceivedByUD,
+                            earlyEnvelope.serverDeliveryTimestamp,
+                            earlyEnvelope.recordedAt
+                        ])
+                        overflowEnvelopeCount += 1
+                    }
+                    timestamps.insert(identifier.timestamp)
+                }
+
+                if overflowEnvelopeCount > Self.maxOverflowEnvelopes {
+                    // Drop the oldest overflowed envelopes.
+                    try grdbWrite.database.execute(sql: """
+                        DELETE FROM \(Self.overflowTableName)
+                        WHERE id <= (SELECT MAX(id) FROM \(Self.overflowTableName)) - ?
+                        """, arguments: [Self.maxOverflowEnvelopes])
+                    let droppedCount = grdbWrite.database.changesCount
+                    owsFailDebug("Dropped \(droppedCount) overflowed early envelopes due to excessive early messages.")
+                    overflowEnvelopeCount -= droppedCount
+                }
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+            overflowTimestamps = timestamps
+        }
+    }
+
+    private func fetchAndRemoveOverflowedEnvelopes(identifier: MessageIdentifier,
+                                                   transaction: SDSAnyWriteTransaction) -> [EarlyEnvelope] {
+        guard case .grdbWrite(let grdbWrite) = transaction.writeTransaction else {
+            return []
+        }
+
+        return serialQueue.sync {
+            // Most messages have no early envelopes, so avoid querying for them.
+            var timestamps = loadOverflowTimestampsIfNecessary(transaction: grdbWrite)
+            guard timestamps.contains(identifier.timestamp) else {
+                return []
+            }
+
+            let authorClause = "(associatedMessageAuthorUuid = ? OR associatedMessageAuthorPhoneNumber = ?)"
+            let authorArguments: StatementArguments = [identifier.author.uuidString, identifier.author.phoneNumber]
+            var result = [EarlyEnvelope]()
+            do {
+                let sql = """
+                SELECT envelopeData, plainTextData, wasReceivedByUD, serverDeliveryTimestamp, recordedAt
+                FROM \(Self.overflowTableName)
+                WHERE associatedMessageTimestamp = ?
+                AND \(authorClause)
+                ORDER BY id
+                """
+                var arguments: StatementArguments = [identifier.timestamp]
+                arguments += authorArguments
+                let rows = try Row.fetchAll(grdbWrite.database, sql: sql, arguments: arguments)
+                for row in rows {
+                    let envelopeData: Data = row[0]
+                    do {
+                        result.append(EarlyEnvelope(
+                            envelope: try SSKProtoEnvelope(serializedData: envelopeData),
+                            plainTextData: row[1],
+                            wasReceivedByUD: row[2],
+                            serverDeliveryTimestamp: UInt64(row[3] as Int64),
+                            recordedAt: UInt64(row[4] as Int64)
+                        ))
+                    } catch {
+                        owsFailDebug("Could not parse overflowed early envelope: \(error)")
+                    }
+                }
+
+                try grdbWrite.database.execute(sql: """
+                    DELETE FROM \(Self.overflowTableName)
+                    WHERE associatedMessageTimestamp = ?
+                    AND \(authorClause)
+                    """, arguments: arguments)
+                overflowEnvelopeCount = max(0, overflowEnvelopeCount - grdbWrite.database.changesCount)
+
+                let hasOtherAuthors = try Bool.fetchOne(grdbWrite.database, sql: """
+                    SELECT EXISTS (
+                        SELECT 1 FROM \(Self.overflowTableName)
+                        WHERE associatedMessageTimestamp = ?
+                    )
+                    """, arguments: [identifier.timestamp]) ?? false
+                if !hasOtherAuthors {
+                    timestamps.remove(identifier.timestamp)
+                    overflowTimestamps = timestamps
+                }
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+            return result
+        }
+    }
+}
+
+// MARK: -
+
 extension OrderedDictionary {
     subscript(_ key: KeyType) -> ValueType? {
         set {
@@ -0,0 +1,141 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Carries an envelope's serialized bytes along with its parsed proto.
+///
+/// Envelopes are persisted between each stage of the receive pipeline
+/// (the decrypt queue and the content queue), so each stage only has the
+/// envelope's bytes. Stages register the handles they produce with
+/// EnvelopeHandleCache so that the next stage can reuse the parsed proto
+/// rather than parsing the same bytes again.
+@objc
+public class EnvelopeHandle: NSObject {
+
+    @objc
+    public let envelopeData: Data
+
+    @objc
+    public let envelope: SSKProtoEnvelope
+
+    @objc
+    public init(envelopeData: Data, envelope: SSKProtoEnvelope) {
+        self.envelopeData = envelopeData
+        self.envelope = envelope
+    }
+
+    @objc(handleWithEnvelopeData:error:)
+    public class func parse(envelopeData: Data) throws -> EnvelopeHandle {
+        let envelope = try SSKProtoEnvelope(serializedData: envelopeData)
+        return EnvelopeHandle(envelopeData: envelopeData, envelope: envelope)
+    }
+}
+
+// MARK: -
+
+/// A small, bounded, thread-safe cache of parsed envelopes keyed by their bytes.
+///
+/// Entries are an optimization only: if the process is restarted or an entry
+/// is evicted, consumers fall back to parsing the persisted bytes.
+@objc
+public class EnvelopeHandleCache: NSObject {
+
+    @objc
+    public static let shared = EnvelopeHandleCache()
+
+    private static let maxEntryCount = 256
+    private static let maxByteCount = 4 * 1024 * 1024
+
+    private let unfairLock = UnfairLock()
+    private var handles = [Data: EnvelopeHandle]()
+    // Oldest first.
+    private var insertionOrder = [Data]()
+    private var byteCount: Int = 0
+
+    @objc
+    public override init() {
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveMemoryWarning),
+                                               name: UIApplication.didReceiveMemoryWarningNotification,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        removeAll()
+    }
+
+    @objc
+    public func add(_ handle: EnvelopeHandle) {
+        let key = handle.envelopeData
+        unfairLock.withLock {
+            if handles[key] != nil {
+                return
+            }
+            handles[key] = handle
+            insertionOrder.append(key)
+            byteCount += key.count
+
+            while insertionOrder.count > Self.maxEntryCount || byteCount > Self.maxByteCount,
+                  !insertionOrder.isEmpty {
+                let evictedKey = insertionOrder.removeFirst()
+                if handles.removeValue(forKey: evictedKey) != nil {
+                    byteCount -= evictedKey.count
+                }
+            }
+        }
+    }
+
+    /// Returns the cached handle for these bytes, if any, without removing it.
+    @objc
+    public func cachedHandle(envelopeData: Data) -> EnvelopeHandle? {
+        unfairLock.withLock {
+            handles[envelopeData]
+        }
+    }
+
+    /// Returns the cached handle for these bytes or parses them.
+    ///
+    /// If `consume` is true, the handle is removed from the cache; stages
+    /// should consume the handle once they are done with that envelope.
+    /// Otherwise, a freshly parsed handle is cached for the next lookup.
+    @objc
+    public func handle(envelopeData: Data, consume: Bool) throws -> EnvelopeHandle {
+        let cachedHandle: EnvelopeHandle? = unfairLock.withLock {
+            guard let handle = handles[envelopeData] else {
+                return nil
+            }
+            if consume {
+                handles.removeValue(forKey: envelopeData)
+                byteCount -= envelopeData.count
+                insertionOrder.removeAll { $0 == envelopeData }
+            }
+            return handle
+        }
+        if let cachedHandle = cachedHandle {
+            return cachedHandle
+        }
+        let handle = try EnvelopeHandle.parse(envelopeData: envelopeData)
+        if !consume {
+            add(handle)
+        }
+        return handle
+    }
+
+    @objc
+    public func removeAll() {
+        unfairLock.withLock {
+            handles.removeAll()
+            insertionOrder.removeAll()
+            byteCount = 0
+        }
+    }
+}
@@ -0,0 +1,204 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+@objc
+public class RecipientDevices: NSObject {
+    @objc
+    public let accountId: AccountId
+    // In the order of SignalRecipient.devices.
+    @objc
+    public let deviceIds: [NSNumber]
+
+    init(recipient: SignalRecipient) {
+        self.accountId = recipient.accountId
+        self.deviceIds = recipient.devices.array.compactMap { value in
+            guard let deviceId = value as? NSNumber else {
+                owsFailDebug("Invalid device id: \(value)")
+                return nil
+            }
+            return deviceId
+        }
+    }
+}
+
+// MARK: -
+
+/// Each send to a group resolves the device list of every member, at least
+/// twice: once to ensure sessions and once to encrypt. This cache keeps a
+/// snapshot of the members' device lists for each recently used thread, so
+/// that resolving the devices of a large group doesn't read and copy a
+/// SignalRecipient per member.
+///
+/// An address is evicted from every snapshot whenever its SignalRecipient
+/// is inserted, updated or removed, e.g. after a 409 "mismatched devices"
+/// response. A snapshot drops members that are no longer requested, i.e.
+/// that have left the group.
+///
+/// This class is thread-safe.
+@objc
+public class GroupRecipientDeviceCache: NSObject {
+
+    @objc
+    public static let shared = GroupRecipientDeviceCache()
+
+    private static let maxSnapshotCount = 16
+
+    private class Snapshot {
+        // nil values indicate that there is no recipient for the address.
+        var devicesByAddress = [SignalServiceAddress: RecipientDevices?]()
+    }
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    // Keyed by thread uniqueId.
+    private var snapshots = [String: Snapshot]()
+    // The thread ids of the snapshots, least recently used first.
+    private var snapshotThreadIds = [String]()
+    // Bumped on every invalidation, so that device lists read from a
+    // transaction that predates a write aren't cached after the write.
+    private var generation: UInt64 = 0
+
+    private override init() {
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveCrossProcessNotification),
+                                               name: SDSDatabaseStorage.didReceiveCrossProcessNotification,
+                                               object: nil)
+    }
+
+    @objc
+    private func didReceiveCrossProcessNotification() {
+        // Another process may have changed any recipient.
+        unfairLock.withLock {
+            generation += 1
+            snapshots.removeAll()
+            snapshotThreadIds.removeAll()
+        }
+    }
+
+    // MARK: -
+
+    /// The result contains every address which has a recipient.
+    public func recipientDevices(for addresses: [SignalServiceAddress],
+                                 thread: TSThread,
+                                 transaction: SDSAnyReadTransaction) -> [SignalServiceAddress: RecipientDevices] {
+        let threadId = thread.uniqueId
+        let (cachedDevicesByAddress, generation) = unfairLock.withLock { () -> ([SignalServiceAddress: RecipientDevices?], UInt64) in
+            (snapshot(forThreadId: threadId)?.devicesByAddress ?? [:], self.generation)
+        }
+
+        var devicesByAddress = [SignalServiceAddress: RecipientDevices?]()
+        var missingDevicesByAddress = [SignalServiceAddress: RecipientDevices?]()
+        for address in addresses {
+            if let recipientDevices = cachedDevicesByAddress[address] {
+                // Note that assigning nil would remove the value.
+                devicesByAddress[address] = .some(recipientDevices)
+                continue
+            }
+            let recipientDevices = SignalRecipient.get(address: address,
+                                                       mustHaveDevices: false,
+                                                       transaction: transaction).map { RecipientDevices(recipient: $0) }
+            devicesByAddress[address] = .some(recipientDevices)
+            missingDevicesByAddress[address] = .some(recipientDevices)
+        }
+
+        // Members who have left the group are no longer requested.
+        let hasDepartedMembers = cachedDevicesByAddress.count > devicesByAddress.count - missingDevicesByAddress.count
+        if !missingDevicesByAddress.isEmpty || hasDepartedMembers {
+            unfairLock.withLock {
+                guard generation == self.generation else {
+                    // A recipient changed while we were reading.
+                    return
+                }
+                let snapshot = self.snapshot(forThreadId: threadId) ?? self.insertSnapshot(forThreadId: threadId)
+                if hasDepartedMembers {
+                    snapshot.devicesByAddress = devicesByAddress
+                } else {
+                    snapshot.devicesByAddress.merge(missingDevicesByAddress) { _, new in new }
+                }
+            }
+        }
+
+        return devicesByAddress.compactMapValues { $0 }
+    }
+
+    @objc
+    public func recipientDevices(for address: SignalServiceAddress,
+                                 thread: TSThread,
+                                 transaction: SDSAnyReadTransaction) -> RecipientDevices? {
+        let threadId = thread.uniqueId
+        let (cachedDevices, generation) = unfairLock.withLock { () -> (RecipientDevices??, UInt64) in
+            (snapshot(forThreadId: threadId)?.devicesByAddress[address], self.generation)
+        }
+        if let cachedDevices = cachedDevices {
+            return cachedDevices
+        }
+
+        let recipientDevices = SignalRecipient.get(address: address,
+                                                   mustHaveDevices: false,
+                                                   transaction: transaction).map { RecipientDevices(recipient: $0) }
+        unfairLock.withLock {
+            guard generation == self.generation else {
+                return
+            }
+            let snapshot = self.snapshot(forThreadId: threadId) ?? self.insertSnapshot(forThreadId: threadId)
+            snapshot.devicesByAddress[address] = .some(recipientDevices)
+        }
+        return recipientDevices
+    }
+
+    // This should be called whenever a recipient is inserted, updated or removed.
+    @objc
+    public func didChange(recipient: SignalRecipient, transaction: SDSAnyWriteTransaction) {
+        let address = recipient.address
+        invalidate(address: address)
+
+        // Readers may not see the write until it is committed.
+        switch transaction.writeTransaction {
+        case .grdbWrite:
+            transaction.addSyncCompletion {
+                self.invalidate(address: address)
+            }
+        case .yapWrite:
+            break
+        }
+    }
+
+    private func invalidate(address: SignalServiceAddress) {
+        unfairLock.withLock {
+            generation += 1
+            for snapshot in snapshots.values {
+                snapshot.devicesByAddress.removeValue(forKey: address)
+            }
+        }
+    }
+
+    // MARK: - Snapshots
+
+    // This method should only be called with unfairLock.
+    private func snapshot(forThreadId threadId: String) -> Snapshot? {
+        guard let snapshot = snapshots[threadId] else {
+            return nil
+        }
+        if snapshotThreadIds.last != threadId {
+            snapshotThreadIds.removeAll { $0 == threadId }
+            snapshotThreadIds.append(threadId)
+        }
+        return snapshot
+    }
+
+    // This method should only be called with unfairLock.
+    private func insertSnapshot(forThreadId threadId: String) -> Snapshot {
+        let snapshot = Snapshot()
+        snapshots[threadId] = snapshot
+        snapshotThreadIds.append(threadId)
+        while snapshotThreadIds.count > Self.maxSnapshotCount {
+            snapshots.removeValue(forKey: snapshotThreadIds.removeFirst())
+        }
+        return snapshot
+    }
+}
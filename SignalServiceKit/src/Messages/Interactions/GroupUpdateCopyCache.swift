@@ -0,0 +1,71 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Caches the copy of group update info messages, keyed by the info
+/// message's uniqueId.
+///
+/// Building the copy diffs the old and new group models and looks up the
+/// display name of every affected member. Info messages are rendered over
+/// and over (in the conversation view, as conversation list snippets, in
+/// notifications), but their group models never change after insertion,
+/// so the copy only changes when display names do (or the local user
+/// does). The cache is invalidated whenever they might have.
+///
+/// We don't persist the copy, since it is localized and embeds names.
+///
+/// This class is thread-safe.
+@objc
+public class GroupUpdateCopyCache: NSObject {
+
+    @objc
+    public static let shared = GroupUpdateCopyCache()
+
+    private struct Entry {
+        let items: [GroupUpdateCopyItem]
+        let generation: UInt
+    }
+
+    private let cache = ShardedLRUCache<String, Entry>(maxSize: 1024)
+
+    // Bumped on every invalidation, so that copy built with stale names
+    // isn't cached after the cache is cleared.
+    private let generation = AtomicUInt(0)
+
+    private override init() {
+        super.init()
+
+        for name: Notification.Name in [.localProfileDidChange,
+                                        .otherUsersProfileDidChange,
+                                        .registrationStateDidChange] {
+            NotificationCenter.default.addObserver(self,
+                                                   selector: #selector(invalidate),
+                                                   name: name,
+                                                   object: nil)
+        }
+    }
+
+    /// Display names may have changed; e.g. after contacts changes.
+    @objc
+    public func invalidate() {
+        generation.increment()
+        cache.clear()
+    }
+
+    func items(forInfoMessageId uniqueId: String,
+               block: () -> [GroupUpdateCopyItem]?) -> [GroupUpdateCopyItem]? {
+        let generation = self.generation.get()
+        if let entry = cache.get(key: uniqueId), entry.generation == generation {
+            return entry.items
+        }
+        guard let items = block() else {
+            return nil
+        }
+        if generation == self.generation.get() {
+            cache.set(key: uniqueId, value: Entry(items: items, generation: generation))
+        }
+        return items
+    }
+}
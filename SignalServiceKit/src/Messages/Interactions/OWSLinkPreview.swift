@@ -289,6 +289,37 @@ public class OWSLinkPreviewManager: NSObject {
         return SSKEnvironment.shared.groupsV2 as! GroupsV2Swift
     }
 
+    // MARK: -
+
+    // Previews of generic URLs are cached for a while, so retyping a URL or
+    // pasting it into another conversation doesn't fetch it again.
+    private static let cachedDraftLifetime: TimeInterval = 10 * kMinuteInterval
+
+    private class CachedDraft {
+        let draft: OWSLinkPreviewDraft
+        let fetchDate = Date()
+
+        init(draft: OWSLinkPreviewDraft) {
+            self.draft = draft
+        }
+    }
+
+    private let cachedDrafts: NSCache<NSString, CachedDraft> = {
+        let cache = NSCache<NSString, CachedDraft>()
+        cache.countLimit = 32
+        return cache
+    }()
+
+    private struct InFlightFetch {
+        let fetchState: LinkPreviewFetchState
+        let promise: Promise<OWSLinkPreviewDraft>
+        var waiterCount: Int
+    }
+
+    // Concurrent fetches of the same URL share a single fetch.
+    private let inFlightFetchesLock = UnfairLock()
+    private var inFlightFetches = [String: InFlightFetch]()
+
     // MARK: - Public
 
     @objc(findFirstValidUrlInSearchString:)
@@ -312,6 +343,30 @@ public class OWSLinkPreviewManager: NSObject {
         })?.url
     }
 
+    // Should be called when the caller no longer needs a preview it has
+    // fetched, e.g. because the URL was edited out of a draft. The fetch is
+    // cancelled once no caller needs it.
+    @objc(cancelLinkPreviewFetchForUrl:)
+    public func cancelLinkPreviewFetch(for url: URL) {
+        let cacheKey = url.absoluteString
+        let fetchState: LinkPreviewFetchState? = inFlightFetchesLock.withLock {
+            guard var inFlightFetch = inFlightFetches[cacheKey] else {
+                return nil
+            }
+            inFlightFetch.waiterCount -= 1
+            guard inFlightFetch.waiterCount <= 0 else {
+                inFlightFetches[cacheKey] = inFlightFetch
+                return nil
+            }
+            inFlightFetches[cacheKey] = nil
+            return inFlightFetch.fetchState
+        }
+        if let fetchState = fetchState {
+            Logger.verbose("Cancelling fetch.")
+            fetchState.cancel()
+        }
+    }
+
     @objc(fetchLinkPreviewForUrl:)
     @available(swift, obsoleted: 1.0)
     public func fetchLinkPreview(for url: URL) -> AnyPromise {
@@ -343,8 +398,45 @@ public class OWSLinkPreviewManager: NSObject {
     // MARK: - Private
 
     private func fetchLinkPreview(forGenericUrl url: URL) -> Promise<OWSLinkPreviewDraft> {
+        let cacheKey = url.absoluteString
+        if let cachedDraft = cachedDrafts.object(forKey: cacheKey as NSString) {
+            if -cachedDraft.fetchDate.timeIntervalSinceNow < Self.cachedDraftLifetime {
+                return Promise.value(cachedDraft.draft)
+            }
+            cachedDrafts.removeObject(forKey: cacheKey as NSString)
+        }
+
+        return inFlightFetchesLock.withLock { () -> Promise<OWSLinkPreviewDraft> in
+            if var inFlightFetch = inFlightFetches[cacheKey] {
+                inFlightFetch.waiterCount += 1
+                inFlightFetches[cacheKey] = inFlightFetch
+                return inFlightFetch.promise
+            }
+
+            let fetchState = LinkPreviewFetchState()
+            let promise = firstly(on: Self.workQueue) { () -> Promise<OWSLinkPreviewDraft> in
+                self.fetchLinkPreview(forGenericUrl: url, fetchState: fetchState)
+            }.map(on: Self.workQueue) { (draft: OWSLinkPreviewDraft) -> OWSLinkPreviewDraft in
+                if draft.isValid(), !fetchState.isCancelled {
+                    self.cachedDrafts.setObject(CachedDraft(draft: draft), forKey: cacheKey as NSString)
+                }
+                return draft
+            }.ensure(on: Self.workQueue) {
+                self.inFlightFetchesLock.withLock {
+                    if self.inFlightFetches[cacheKey]?.fetchState === fetchState {
+                        self.inFlightFetches[cacheKey] = nil
+                    }
+                }
+            }
+            inFlightFetches[cacheKey] = InFlightFetch(fetchState: fetchState, promise: promise, waiterCount: 1)
+            return promise
+        }
+    }
+
+    private func fetchLinkPreview(forGenericUrl url: URL,
+                                  fetchState: LinkPreviewFetchState) -> Promise<OWSLinkPreviewDraft> {
         firstly(on: Self.workQueue) { () -> Promise<(URL, String)> in
-            self.fetchStringResource(from: url)
+            self.fetchStringResource(from: url, fetchState: fetchState)
 
         }.then(on: Self.workQueue) { (respondingUrl, rawHTML) -> Promise<OWSLinkPreviewDraft> in
             let content = HTMLMetadata.construct(parsing: rawHTML)
@@ -363,9 +455,12 @@ public class OWSLinkPreviewManager: NSObject {
                   let imageUrl = URL(string: imageUrlString, relativeTo: respondingUrl) else {
                 return Promise.value(draft)
             }
+            guard !fetchState.isCancelled else {
+                throw LinkPreviewError.fetchFailure
+            }
 
             return firstly(on: Self.workQueue) { () -> Promise<Data> in
-                self.fetchImageResource(from: imageUrl)
+                self.fetchImageResource(from: imageUrl, fetchState: fetchState)
             }.then(on: Self.workQueue) { (imageData: Data) -> Promise<PreviewThumbnail?> in
                 Self.previewThumbnail(srcImageData: imageData, srcMimeType: nil)
             }.map(on: Self.workQueue) { (previewThumbnail: PreviewThumbnail?) -> OWSLinkPreviewDraft in
@@ -391,7 +486,8 @@ public class OWSLinkPreviewManager: NSObject {
 
     // MARK: - Private, Networking
 
-    private func createSessionManager() -> AFHTTPSessionManager {
+    private func createSessionManager(fetchState: LinkPreviewFetchState?,
+                                      headBuffer: HTMLHeadBuffer? = nil) -> AFHTTPSessionManager {
         let sessionConfig = URLSessionConfiguration.ephemeral
         sessionConfig.urlCache = nil
         sessionConfig.requestCachePolicy = .reloadIgnoringLocalCacheData
@@ -401,6 +497,9 @@ public class OWSLinkPreviewManager: NSObject {
         sessionManager.responseSerializer = AFHTTPResponseSerializer()
 
         sessionManager.setDataTaskDidReceiveResponseBlock { (_, _, response) -> URLSession.ResponseDisposition in
+            if fetchState?.isCancelled == true {
+                return .cancel
+            }
             let anticipatedSize = response.expectedContentLength
             if anticipatedSize == NSURLSessionTransferSizeUnknown || anticipatedSize < Self.maxFetchedContentSize {
                 return .allow
@@ -408,7 +507,18 @@ public class OWSLinkPreviewManager: NSObject {
                 return .cancel
             }
         }
-        sessionManager.setDataTaskDidReceiveDataBlock { (_, task, _) in
+        sessionManager.setDataTaskDidReceiveDataBlock { (_, task, data) in
+            if fetchState?.isCancelled == true {
+                task.cancel()
+                return
+            }
+            // Everything we parse lives in the <head>, so we can stop as soon
+            // as we've received all of it.
+            if let headBuffer = headBuffer,
+               headBuffer.append(data, response: task.response) {
+                task.cancel()
+                return
+            }
             let fetchedBytes = task.countOfBytesReceived
             if fetchedBytes >= Self.maxFetchedContentSize {
                 task.cancel()
@@ -422,25 +532,39 @@ public class OWSLinkPreviewManager: NSObject {
             }
         }
         sessionManager.requestSerializer.setValue(Self.userAgentString, forHTTPHeaderField: "User-Agent")
+        fetchState?.add(sessionManager)
         return sessionManager
 
     }
 
-    func fetchStringResource(from url: URL) -> Promise<(URL, String)> {
-        firstly(on: Self.workQueue) { () -> Promise<(task: URLSessionDataTask, responseObject: Any?)> in
-            self.createSessionManager()
+    func fetchStringResource(from url: URL,
+                             fetchState: LinkPreviewFetchState? = nil) -> Promise<(URL, String)> {
+        let headBuffer = HTMLHeadBuffer()
+        return firstly(on: Self.workQueue) { () -> Promise<(response: URLResponse?, data: Data?)> in
+            self.createSessionManager(fetchState: fetchState, headBuffer: headBuffer)
                 .getPromise(url.absoluteString)
-                .catchCancellation(andThrow: LinkPreviewError.invalidPreview)
+                .map(on: Self.workQueue) { (task: URLSessionDataTask,
+                                            responseObject: Any?) -> (response: URLResponse?, data: Data?) in
+                    (response: task.response, data: responseObject as? Data)
+                }.recover(on: Self.workQueue, policy: .allErrors) { (error: Error) -> Promise<(response: URLResponse?, data: Data?)> in
+                    // We may have cancelled the fetch ourselves after receiving the <head>.
+                    guard error.isCancelled,
+                          fetchState?.isCancelled != true,
+                          let head = headBuffer.completedHead else {
+                        throw error
+                    }
+                    return Promise.value((response: head.response, data: head.data))
+                }.catchCancellation(andThrow: LinkPreviewError.invalidPreview)
 
-        }.map(on: Self.workQueue) { (task: URLSessionDataTask, responseObject: Any?) -> (URL, String) in
-            guard let response = task.response as? HTTPURLResponse,
+        }.map(on: Self.workQueue) { (response: URLResponse?, data: Data?) -> (URL, String) in
+            guard let response = response as? HTTPURLResponse,
                   let respondingUrl = response.url,
                   response.statusCode >= 200 && response.statusCode < 300 else {
-                Logger.warn("Invalid response: \(type(of: task.response)).")
+                Logger.warn("Invalid response: \(type(of: response)).")
                 throw LinkPreviewError.fetchFailure
             }
 
-            guard let data = responseObject as? Data,
+            guard let data = data,
                   let string = String(data: data, urlResponse: response),
                   string.count > 0 else {
                 Logger.warn("Response object could not be parsed")
@@ -451,9 +575,9 @@ public class OWSLinkPreviewManager: NSObject {
         }
     }
 
-    private func fetchImageResource(from url: URL) -> Promise<Data> {
+    private func fetchImageResource(from url: URL, fetchState: LinkPreviewFetchState) -> Promise<Data> {
         firstly(on: Self.workQueue) { () -> Promise<(task: URLSessionDataTask, responseObject: Any?)> in
-            self.createSessionManager()
+            self.createSessionManager(fetchState: fetchState)
                 .getPromise(url.absoluteString)
                 .catchCancellation(andThrow: LinkPreviewError.invalidPreview)
 
@@ -763,6 +887,106 @@ fileprivate extension OWSLinkPreviewManager {
     }
 }
 
+// MARK: -
+
+// Tracks the network requests of a link preview fetch, so that they can be
+// cancelled.
+class LinkPreviewFetchState {
+    private let lock = UnfairLock()
+    private var _isCancelled = false
+    private var sessionManagers = [AFHTTPSessionManager]()
+
+    var isCancelled: Bool {
+        lock.withLock { _isCancelled }
+    }
+
+    func add(_ sessionManager: AFHTTPSessionManager) {
+        lock.withLock {
+            sessionManagers.append(sessionManager)
+        }
+    }
+
+    func cancel() {
+        let sessionManagers: [AFHTTPSessionManager] = lock.withLock {
+            _isCancelled = true
+            let sessionManagers = self.sessionManagers
+            self.sessionManagers = []
+            return sessionManagers
+        }
+        for sessionManager in sessionManagers {
+            sessionManager.tasks.forEach { $0.cancel() }
+        }
+    }
+}
+
+// MARK: -
+
+// Accumulates an HTML response until it contains the end of its <head>.
+class HTMLHeadBuffer {
+    private static let endOfHeadTag = Array("</head".utf8)
+
+    private let lock = UnfairLock()
+    private var data = Data()
+    private var response: URLResponse?
+    private var endOfHeadOffset: Int?
+
+    // Returns true once the end of the <head> has been received.
+    func append(_ chunk: Data, response: URLResponse?) -> Bool {
+        lock.withLock {
+            guard endOfHeadOffset == nil else {
+                return true
+            }
+            // The tag may straddle two chunks.
+            let searchStartOffset = max(0, data.count - Self.endOfHeadTag.count + 1)
+            data.append(chunk)
+            self.response = response
+            endOfHeadOffset = Self.offsetOfEndOfHeadTag(in: data, from: searchStartOffset)
+            return endOfHeadOffset != nil
+        }
+    }
+
+    // The response up to the end of its <head>, if it has been received.
+    var completedHead: (response: URLResponse?, data: Data)? {
+        lock.withLock {
+            guard let endOfHeadOffset = endOfHeadOffset else {
+                return nil
+            }
+            // The tag is ASCII, so this never splits a UTF-8 sequence.
+            return (response: response, data: Data(data.prefix(endOfHeadOffset)))
+        }
+    }
+
+    private static func offsetOfEndOfHeadTag(in data: Data, from startOffset: Int) -> Int? {
+        let tag = endOfHeadTag
+        guard data.count - tag.count >= startOffset else {
+            return nil
+        }
+        return data.withUnsafeBytes { (buffer: UnsafeRawBufferPointer) -> Int? in
+            let bytes = buffer.bindMemory(to: UInt8.self)
+            for offset in startOffset...(bytes.count - tag.count) {
+                var isMatch = true
+                for (index, tagByte) in tag.enumerated() {
+                    var byte = bytes[offset + index]
+                    // ASCII lowercase.
+                    if byte >= 0x41 && byte <= 0x5A {
+                        byte += 0x20
+                    }
+                    if byte != tagByte {
+                        isMatch = false
+                        break
+                    }
+                }
+                if isMatch {
+                    return offset
+                }
+            }
+            return nil
+        }
+    }
+}
+
+// MARK: -
+
 private func normalizeString(_ string: String, maxLines: Int) -> String {
     var result = string
     var components = result.components(separatedBy: .newlines)
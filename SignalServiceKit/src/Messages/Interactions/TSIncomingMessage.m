@@ -220,7 +220,7 @@ const NSUInteger TSIncomingMessageSchemaVersion = 1;
 
 - (SignalServiceAddress *)authorAddress
 {
-    return [[SignalServiceAddress alloc] initWithUuidString:self.authorUUID phoneNumber:self.authorPhoneNumber];
+    return [SignalServiceAddress canonicalAddressWithUuidString:self.authorUUID phoneNumber:self.authorPhoneNumber];
 }
 
 @end
@@ -78,20 +78,14 @@ extension TSInfoMessage {
                                         newGroupModel: TSGroupModel,
                                         transaction: SDSAnyReadTransaction) -> String {
 
-        guard let localAddress = tsAccountManager.localAddress else {
-            owsFailDebug("missing local address")
+        guard let items = groupUpdateItems(oldGroupModel: oldGroupModel,
+                                           newGroupModel: newGroupModel,
+                                           transaction: transaction) else {
             return GroupUpdateCopy.defaultGroupUpdateDescription(groupUpdateSourceAddress: groupUpdateSourceAddress,
                                                                  transaction: transaction)
         }
-
-        let groupUpdate = GroupUpdateCopy(newGroupModel: newGroupModel,
-                                          oldGroupModel: oldGroupModel,
-                                          oldDisappearingMessageToken: oldDisappearingMessageToken,
-                                          newDisappearingMessageToken: newDisappearingMessageToken,
-                                          localAddress: localAddress,
-                                          groupUpdateSourceAddress: groupUpdateSourceAddress,
-                                          transaction: transaction)
-        return groupUpdate.updateDescription
+        // See GroupUpdateCopy.updateDescription.
+        return items.map { $0.text }.joined(separator: "\n")
     }
 
     private func groupUpdateItems(oldGroupModel: TSGroupModel?,
@@ -103,14 +97,16 @@ extension TSInfoMessage {
             return nil
         }
 
-        let groupUpdate = GroupUpdateCopy(newGroupModel: newGroupModel,
-                                          oldGroupModel: oldGroupModel,
-                                          oldDisappearingMessageToken: oldDisappearingMessageToken,
-                                          newDisappearingMessageToken: newDisappearingMessageToken,
-                                          localAddress: localAddress,
-                                          groupUpdateSourceAddress: groupUpdateSourceAddress,
-                                          transaction: transaction)
-        return groupUpdate.itemList
+        return GroupUpdateCopyCache.shared.items(forInfoMessageId: uniqueId) {
+            let groupUpdate = GroupUpdateCopy(newGroupModel: newGroupModel,
+                                              oldGroupModel: oldGroupModel,
+                                              oldDisappearingMessageToken: oldDisappearingMessageToken,
+                                              newDisappearingMessageToken: newDisappearingMessageToken,
+                                              localAddress: localAddress,
+                                              groupUpdateSourceAddress: groupUpdateSourceAddress,
+                                              transaction: transaction)
+            return groupUpdate.itemList
+        }
     }
 
     @objc
@@ -38,3 +38,25 @@ extension TSInteraction {
         owsAssertDebug(self.sortId > 0)
     }
 }
+
+// MARK: -
+
+public extension TSInteraction {
+    // Traverses all interactions, decoding them in parallel.
+    // Interactions are not visited in any particular order.
+    @objc
+    class func anyEnumerateInParallel(transaction: SDSAnyReadTransaction,
+                                      block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead:
+            TSInteraction.anyEnumerate(transaction: transaction, batched: true, block: block)
+        case .grdbRead(let grdbTransaction):
+            TSInteraction.grdbEnumerateInParallel(recordType: InteractionRecord.self,
+                                                  sql: "SELECT * FROM \(InteractionRecord.databaseTableName)",
+                                                  transaction: grdbTransaction,
+                                                  order: .unordered,
+                                                  decode: { try TSInteraction.fromRecord($0) },
+                                                  block: block)
+        }
+    }
+}
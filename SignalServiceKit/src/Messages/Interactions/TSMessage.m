@@ -621,6 +621,7 @@ static const NSUInteger OWSMessageSchemaVersion = 4;
 {
     if (self.hasPerConversationExpirationStarted) {
         // Expiration already started.
+        [[OWSDisappearingMessagesJob sharedJob] trackExpiringMessage:self];
         return;
     }
     if (![self shouldStartExpireTimer]) {
@@ -822,13 +823,15 @@ static const NSUInteger OWSMessageSchemaVersion = 4;
 - (void)removeAllRenderableContentWithTransaction:(SDSAnyWriteTransaction *)transaction
                                             block:(void (^)(TSMessage *message))block
 {
-    // We call removeAllAttachmentsWithTransaction() before
-    // anyUpdateWithTransaction, because anyUpdateWithTransaction's
-    // block can be called twice, once on this instance and once
-    // on the copy from the database.  We only want to remove
-    // attachments once.
+    // We purge the attachments before anyUpdateWithTransaction,
+    // because anyUpdateWithTransaction's block can be called twice,
+    // once on this instance and once on the copy from the database.
+    // We only want to purge attachments once.
+    //
+    // The attachments and their files are removed later, in batches,
+    // by MessageContentSweeper.
     [self anyReloadWithTransaction:transaction ignoreMissing:YES];
-    [self removeAllAttachmentsWithTransaction:transaction];
+    [MessageContentSweeper attachmentsNeedPurging:self.allAttachmentIds transaction:transaction.unwrapGrdbWrite];
     [self removeAllMentionsWithTransaction:transaction];
 
     [self anyUpdateMessageWithTransaction:transaction
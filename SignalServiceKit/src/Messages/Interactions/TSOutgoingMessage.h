@@ -311,6 +311,13 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:receivedAtTimestamp
                   readTimestamp:(uint64_t)readTimestamp
                     transaction:(SDSAnyWriteTransaction *)transaction;
 
+// This method is used to record the deliveries and reads by many recipients
+// in a single update. deliveryTimestamps and readTimestamps map recipients
+// to their receipt's timestamp; deliveries are applied before reads.
+- (void)updateWithDeliveryTimestamps:(NSDictionary<SignalServiceAddress *, NSNumber *> *)deliveryTimestamps
+                      readTimestamps:(NSDictionary<SignalServiceAddress *, NSNumber *> *)readTimestamps
+                         transaction:(SDSAnyWriteTransaction *)transaction;
+
 - (nullable NSNumber *)firstRecipientReadTimestamp;
 
 - (void)updateWithRecipientAddressStates:
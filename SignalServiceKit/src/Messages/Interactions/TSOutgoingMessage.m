@@ -874,6 +874,32 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
                                             }];
 }
 
+// Applies a delivery and/or read receipt to a recipient's state.
+//
+// This should only be called from an update block.
++ (void)applyReceiptFromRecipient:(SignalServiceAddress *)recipientAddress
+                deliveryTimestamp:(nullable NSNumber *)deliveryTimestamp
+                    readTimestamp:(nullable NSNumber *)readTimestamp
+                        toMessage:(TSOutgoingMessage *)message
+{
+    TSOutgoingMessageRecipientState *_Nullable recipientState = message.recipientAddressStates[recipientAddress];
+    if (!recipientState) {
+        OWSFailDebug(@"Missing recipient state for receipt recipient: %@", recipientAddress);
+        return;
+    }
+    if (recipientState.state != OWSOutgoingMessageRecipientStateSent) {
+        OWSLogWarn(@"marking unsent message as delivered.");
+    }
+    recipientState.state = OWSOutgoingMessageRecipientStateSent;
+    if (deliveryTimestamp != nil) {
+        recipientState.deliveryTimestamp = deliveryTimestamp;
+    }
+    if (readTimestamp != nil) {
+        recipientState.readTimestamp = readTimestamp;
+    }
+    recipientState.errorCode = nil;
+}
+
 - (void)updateWithDeliveredRecipient:(SignalServiceAddress *)recipientAddress
                    deliveryTimestamp:(NSNumber *_Nullable)deliveryTimestamp
                          transaction:(SDSAnyWriteTransaction *)transaction
@@ -894,19 +920,10 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
     [self anyUpdateOutgoingMessageWithTransaction:transaction
                                             block:^(TSOutgoingMessage *message) {
-                                                TSOutgoingMessageRecipientState *_Nullable recipientState
-                                                    = message.recipientAddressStates[recipientAddress];
-                                                if (!recipientState) {
-                                                    OWSFailDebug(@"Missing recipient state for delivered recipient: %@",
-                                                        recipientAddress);
-                                                    return;
-                                                }
-                                                if (recipientState.state != OWSOutgoingMessageRecipientStateSent) {
-                                                    OWSLogWarn(@"marking unsent message as delivered.");
-                                                }
-                                                recipientState.state = OWSOutgoingMessageRecipientStateSent;
-                                                recipientState.deliveryTimestamp = deliveryTimestamp;
-                                                recipientState.errorCode = nil;
+                                                [TSOutgoingMessage applyReceiptFromRecipient:recipientAddress
+                                                                           deliveryTimestamp:deliveryTimestamp
+                                                                               readTimestamp:nil
+                                                                                   toMessage:message];
                                             }];
 }
 
@@ -925,19 +942,46 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
     [self anyUpdateOutgoingMessageWithTransaction:transaction
                                             block:^(TSOutgoingMessage *message) {
-                                                TSOutgoingMessageRecipientState *_Nullable recipientState
-                                                    = message.recipientAddressStates[recipientAddress];
-                                                if (!recipientState) {
-                                                    OWSFailDebug(@"Missing recipient state for delivered recipient: %@",
-                                                        recipientAddress);
-                                                    return;
-                                                }
-                                                if (recipientState.state != OWSOutgoingMessageRecipientStateSent) {
-                                                    OWSLogWarn(@"marking unsent message as delivered.");
-                                                }
-                                                recipientState.state = OWSOutgoingMessageRecipientStateSent;
-                                                recipientState.readTimestamp = @(readTimestamp);
-                                                recipientState.errorCode = nil;
+                                                [TSOutgoingMessage applyReceiptFromRecipient:recipientAddress
+                                                                           deliveryTimestamp:nil
+                                                                               readTimestamp:@(readTimestamp)
+                                                                                   toMessage:message];
+                                            }];
+}
+
+- (void)updateWithDeliveryTimestamps:(NSDictionary<SignalServiceAddress *, NSNumber *> *)deliveryTimestamps
+                      readTimestamps:(NSDictionary<SignalServiceAddress *, NSNumber *> *)readTimestamps
+                         transaction:(SDSAnyWriteTransaction *)transaction
+{
+    OWSAssertDebug(deliveryTimestamps.count > 0 || readTimestamps.count > 0);
+    OWSAssertDebug(transaction);
+
+    // Ignore receipts for messages that have been deleted.
+    // They are no longer relevant to this message.
+    if (self.wasRemotelyDeleted) {
+        return;
+    }
+
+    [self anyUpdateOutgoingMessageWithTransaction:transaction
+                                            block:^(TSOutgoingMessage *message) {
+                                                [deliveryTimestamps enumerateKeysAndObjectsUsingBlock:^(
+                                                    SignalServiceAddress *recipientAddress,
+                                                    NSNumber *deliveryTimestamp,
+                                                    BOOL *stop) {
+                                                    [TSOutgoingMessage applyReceiptFromRecipient:recipientAddress
+                                                                               deliveryTimestamp:deliveryTimestamp
+                                                                                   readTimestamp:nil
+                                                                                       toMessage:message];
+                                                }];
+                                                [readTimestamps enumerateKeysAndObjectsUsingBlock:^(
+                                                    SignalServiceAddress *recipientAddress,
+                                                    NSNumber *readTimestamp,
+                                                    BOOL *stop) {
+                                                    [TSOutgoingMessage applyReceiptFromRecipient:recipientAddress
+                                                                               deliveryTimestamp:nil
+                                                                                   readTimestamp:readTimestamp
+                                                                                       toMessage:message];
+                                                }];
                                             }];
 }
 
@@ -1539,9 +1583,7 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
         return nil;
     }
 
-    SSKProtoContentBuilder *contentBuilder = [SSKProtoContent builder];
-    [contentBuilder setDataMessage:dataMessage];
-    NSData *_Nullable contentData = [contentBuilder buildSerializedDataAndReturnError:&error];
+    NSData *_Nullable contentData = [SSKProtoContent serializedDataWithDataMessage:dataMessage error:&error];
     if (error || !contentData) {
         OWSFailDebug(@"could not serialize protobuf: %@", error);
         return nil;
@@ -0,0 +1,202 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+// Removes message content in bounded batches, outside of the transactions
+// which decide that the content should go.
+//
+// Completing a view-once message or applying a remote delete strips the
+// message and, in the same transaction, used to remove each of its
+// attachments and their files; remote deletes are applied while incoming
+// messages are being processed. Instead, the writing transaction removes
+// the attachments from the media gallery and records them in a pending
+// table. The pending attachments are then removed in batches, each batch
+// in its own write transaction, shortly afterward.
+//
+// The sweeper also completes view-once messages which are due, e.g. after
+// 30 days. Incomplete view-once messages are already indexed, so each
+// sweep only loads the messages which are due, a batch at a time, rather
+// than every incomplete view-once message in a single transaction.
+//
+// The pending table is the consistency cursor: an attachment is removed
+// from it in the same transaction that removes the attachment, so an
+// attachment which was pending when the app was terminated is removed on
+// the next launch.
+//
+// Pending attachments are only removed in the main app; extensions leave
+// them for the main app.
+@objc
+public class MessageContentSweeper: NSObject {
+
+    // MARK: - Dependencies
+
+    private static var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    // MARK: -
+
+    static let pendingTableName = "attachment_purge_pending"
+    private static let uniqueIdColumn = "uniqueId"
+
+    static var createTableSql: String {
+        """
+        CREATE TABLE \(pendingTableName) (
+            id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
+            \(uniqueIdColumn) TEXT NOT NULL
+        );
+
+        CREATE UNIQUE INDEX index_attachment_purge_pending_on_uniqueId
+        ON \(pendingTableName)(\(uniqueIdColumn));
+        """
+    }
+
+    // Tests sweep explicitly, so that they can observe pending content.
+    static var shouldSweepAutomatically = !CurrentAppContext().isRunningTests
+
+    private static let batchSize = 100
+    private static let sweepDelay: TimeInterval = 0.5
+
+    private static let serialQueue = DispatchQueue(label: "org.signal.messageContentSweeper", qos: .utility)
+    private static let isSweepScheduled = AtomicBool(false)
+
+    // MARK: - Pending Attachments
+
+    @objc
+    public class func attachmentsNeedPurging(_ attachmentIds: [String], transaction: GRDBWriteTransaction) {
+        guard !attachmentIds.isEmpty else {
+            return
+        }
+
+        // The message no longer references the attachments, so they should
+        // leave the media gallery now rather than when they are removed.
+        // A message has at most a few dozen attachments, well below
+        // SQLite's limit on the number of arguments.
+        let gallerySql = """
+            DELETE FROM \(MediaGalleryRecord.databaseTableName)
+            WHERE attachmentId IN (
+                SELECT \(attachmentColumn: .id)
+                FROM \(AttachmentRecord.databaseTableName)
+                WHERE \(attachmentColumn: .uniqueId) IN (\(attachmentIds.map { _ in "?" }.joined(separator: ", ")))
+            )
+            """
+        transaction.executeUpdate(sql: gallerySql, arguments: StatementArguments(attachmentIds))
+
+        let sql = """
+            INSERT OR IGNORE INTO \(pendingTableName) (\(uniqueIdColumn))
+            VALUES (?)
+            """
+        for attachmentId in attachmentIds {
+            transaction.executeWithCachedStatement(sql: sql, arguments: [attachmentId])
+        }
+        transaction.addAsyncCompletion(queue: serialQueue) {
+            scheduleSweep()
+        }
+    }
+
+    // MARK: - Sweeping
+
+    @objc
+    public class func scheduleSweep() {
+        guard CurrentAppContext().isMainApp, shouldSweepAutomatically else {
+            return
+        }
+        guard AppReadiness.isAppReady else {
+            AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+                scheduleSweep()
+            }
+            return
+        }
+        // Coalesce the writes of the next moment into the same batches.
+        guard isSweepScheduled.tryToSetFlag() else {
+            return
+        }
+        serialQueue.asyncAfter(deadline: .now() + sweepDelay) {
+            isSweepScheduled.set(false)
+
+            var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+            sweepSync()
+            owsAssertDebug(backgroundTask != nil)
+            backgroundTask = nil
+        }
+    }
+
+    // Completes any view-once messages which are due, then removes all
+    // pending attachments, a batch at a time.
+    class func sweepSync() {
+        completeDueViewOnceMessagesSync()
+        purgePendingAttachmentsSync()
+    }
+
+    private class func completeDueViewOnceMessagesSync() {
+        var rowId: Int64 = 0
+        var batchCount = 0
+        while true {
+            let nextRowId: Int64? = databaseStorage.write { transaction in
+                ViewOnceMessages.completeDueMessages(afterRowId: rowId, limit: batchSize, transaction: transaction)
+            }
+            batchCount += 1
+            guard let lastRowId = nextRowId else {
+                break
+            }
+            rowId = lastRowId
+        }
+        if batchCount > 1 {
+            Logger.verbose("Checked view-once messages in \(batchCount) batches.")
+        }
+    }
+
+    private class func purgePendingAttachmentsSync() {
+        guard StorageCoordinator.dataStoreForUI == .grdb else {
+            return
+        }
+        var purgedCount = 0
+        while true {
+            let batchCount: Int = databaseStorage.write { transaction in
+                purgeBatch(transaction: transaction.unwrapGrdbWrite)
+            }
+            purgedCount += batchCount
+            guard batchCount == batchSize else {
+                break
+            }
+        }
+        if purgedCount > 0 {
+            Logger.verbose("Purged \(purgedCount) pending attachments.")
+        }
+    }
+
+    private class func purgeBatch(transaction: GRDBWriteTransaction) -> Int {
+        let sql = """
+            SELECT id, \(uniqueIdColumn)
+            FROM \(pendingTableName)
+            ORDER BY id
+            LIMIT ?
+            """
+        do {
+            let rows = try Row.fetchAll(transaction.database, sql: sql, arguments: [batchSize])
+            guard let lastRow = rows.last else {
+                return 0
+            }
+            for row in rows {
+                let uniqueId: String = row[1]
+                // The attachment may have been removed in the meantime, e.g.
+                // by the orphan data cleaner.
+                guard let attachment = TSAttachment.anyFetch(uniqueId: uniqueId, transaction: transaction.asAnyRead) else {
+                    continue
+                }
+                // [TSAttachment anyRemoveWithTransaction:] also removes the
+                // attachment's files.
+                attachment.anyRemove(transaction: transaction.asAnyWrite)
+            }
+            let lastId: Int64 = lastRow[0]
+            transaction.executeUpdate(sql: "DELETE FROM \(pendingTableName) WHERE id <= ?",
+                                      arguments: [lastId])
+            return rows.count
+        } catch {
+            owsFail("Error: \(error)")
+        }
+    }
+}
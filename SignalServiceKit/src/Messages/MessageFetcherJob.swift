@@ -185,32 +185,90 @@ public class MessageFetcherJob: NSObject {
     private class func fetchMessagesViaRest() -> Promise<Void> {
         Logger.debug("")
 
+        return fetchMessagesViaRest(handledEnvelopeKeys: Set<String>(),
+                                    previousPageAcknowledged: Guarantee.value(()),
+                                    isPipelined: false)
+    }
+
+    // Pages are fetched in a pipeline: the next page is requested while the
+    // previous page is handled and ACKed. At most two pages are in flight;
+    // we don't request a page until the ACKs of the page two before it have
+    // completed.
+    //
+    // The service can return envelopes again until it has seen their ACKs,
+    // so a pipelined page may repeat envelopes from the previous page. We
+    // skip envelopes we've already handled and only ACK them again.
+    private class func fetchMessagesViaRest(handledEnvelopeKeys: Set<String>,
+                                            previousPageAcknowledged: Guarantee<Void>,
+                                            isPipelined: Bool) -> Promise<Void> {
         return firstly {
             fetchBatchViaRest()
         }.then { (envelopes: [SSKProtoEnvelope], serverDeliveryTimestamp: UInt64, more: Bool) -> Promise<Void> in
+            var handledEnvelopeKeys = handledEnvelopeKeys
+            var redeliveredCount = 0
+            var acknowledgements = [Guarantee<Void>]()
             for envelope in envelopes {
-                Logger.info("received envelope.")
-                do {
-                    let envelopeData = try envelope.serializedData()
-                    self.messageReceiver.handleReceivedEnvelopeData(
-                        envelopeData,
-                        serverDeliveryTimestamp: serverDeliveryTimestamp
-                    )
-                } catch {
-                    owsFailDebug("failed to serialize envelope")
+                if let key = envelopeKey(envelope), !handledEnvelopeKeys.insert(key).inserted {
+                    // This envelope has already been handed to the message receiver,
+                    // but its ACK is still in flight or failed, so we only ACK it again.
+                    redeliveredCount += 1
+                    acknowledgements.append(acknowledgeDelivery(envelope: envelope))
+                    continue
                 }
-                self.acknowledgeDelivery(envelope: envelope)
+                acknowledgements.append(handleFetchedEnvelope(envelope,
+                                                              serverDeliveryTimestamp: serverDeliveryTimestamp))
+            }
+            let pageAcknowledged = when(guarantees: acknowledgements)
+            let allPagesAcknowledged = when(guarantees: [previousPageAcknowledged, pageAcknowledged])
+            let isRedeliveredPage = redeliveredCount > 0 && redeliveredCount == envelopes.count
+
+            if isRedeliveredPage && !isPipelined {
+                // The service keeps returning envelopes we've handled even though
+                // their ACKs had completed; let the next fetch cycle retry rather
+                // than spinning on failing ACKs.
+                Logger.warn("Service re-delivered \(redeliveredCount) handled envelopes.")
+                return allPagesAcknowledged.then { _ -> Promise<Void> in Promise.value(()) }
             }
 
-            if more {
-                Logger.info("fetching more messages.")
-
-                return self.fetchMessagesViaRest()
-            } else {
+            guard more else {
                 // All finished
-                return Promise.value(())
+                return allPagesAcknowledged.then { _ -> Promise<Void> in Promise.value(()) }
+            }
+
+            Logger.info("fetching more messages.")
+
+            if isRedeliveredPage {
+                // We requested this page before the previous page's ACKs had
+                // completed. Wait for every ACK before requesting the next page,
+                // so that it holds new envelopes.
+                return allPagesAcknowledged.then { _ -> Promise<Void> in
+                    self.fetchMessagesViaRest(handledEnvelopeKeys: handledEnvelopeKeys,
+                                              previousPageAcknowledged: Guarantee.value(()),
+                                              isPipelined: false)
+                }
             }
+
+            return previousPageAcknowledged.then { _ -> Promise<Void> in
+                self.fetchMessagesViaRest(handledEnvelopeKeys: handledEnvelopeKeys,
+                                          previousPageAcknowledged: pageAcknowledged,
+                                          isPipelined: true)
+            }
+        }
+    }
+
+    private class func handleFetchedEnvelope(_ envelope: SSKProtoEnvelope,
+                                             serverDeliveryTimestamp: UInt64) -> Guarantee<Void> {
+        Logger.info("received envelope.")
+        do {
+            let envelopeData = try envelope.serializedData()
+            self.messageReceiver.handleReceivedEnvelopeData(
+                envelopeData,
+                serverDeliveryTimestamp: serverDeliveryTimestamp
+            )
+        } catch {
+            owsFailDebug("failed to serialize envelope")
         }
+        return self.acknowledgeDelivery(envelope: envelope)
     }
 
     // MARK: - Run Loop
@@ -341,7 +399,10 @@ public class MessageFetcherJob: NSObject {
         }
     }
 
-    private class func acknowledgeDelivery(envelope: SSKProtoEnvelope) {
+    // The returned guarantee resolves once the service has responded to
+    // the acknowledgement, whether or not it succeeded. If it failed, the
+    // service will deliver the message again.
+    private class func acknowledgeDelivery(envelope: SSKProtoEnvelope) -> Guarantee<Void> {
         let request: TSRequest
         if let serverGuid = envelope.serverGuid, serverGuid.count > 0 {
             request = OWSRequestFactory.acknowledgeMessageDeliveryRequest(withServerGuid: serverGuid)
@@ -349,16 +410,30 @@ public class MessageFetcherJob: NSObject {
             request = OWSRequestFactory.acknowledgeMessageDeliveryRequest(with: sourceAddress, timestamp: envelope.timestamp)
         } else {
             owsFailDebug("Cannot ACK message which has neither source, nor server GUID and timestamp.")
-            return
+            return Guarantee.value(())
         }
 
+        let (guarantee, resolver) = Guarantee<Void>.pending()
         self.networkManager.makeRequest(request,
                                         success: { (_: URLSessionDataTask?, _: Any?) -> Void in
                                             Logger.debug("acknowledged delivery for message at timestamp: \(envelope.timestamp)")
+                                            resolver(())
         },
                                         failure: { (_: URLSessionDataTask?, error: Error?) in
                                             Logger.debug("acknowledging delivery for message at timestamp: \(envelope.timestamp) failed with error: \(String(describing: error))")
+                                            resolver(())
         })
+        return guarantee
+    }
+
+    private class func envelopeKey(_ envelope: SSKProtoEnvelope) -> String? {
+        if let serverGuid = envelope.serverGuid, serverGuid.count > 0 {
+            return serverGuid
+        } else if let sourceAddress = envelope.sourceAddress, sourceAddress.isValid, envelope.timestamp > 0 {
+            return "\(sourceAddress.stringForDisplay).\(envelope.sourceDevice).\(envelope.timestamp)"
+        } else {
+            return nil
+        }
     }
 }
 
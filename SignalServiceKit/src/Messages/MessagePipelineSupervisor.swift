@@ -13,6 +13,13 @@ public class MessagePipelineSupervisor: NSObject {
     private let pipelineStages = NSHashTable<MessageProcessingPipelineStage>.weakObjects()
     private var suspensionCount = 0
 
+    // Held while another process holds the message processing lease.
+    // Should only be accessed on the main thread.
+    private var leaseSuspension: MessagePipelineSuspensionHandle?
+
+    /// Per-envelope latencies between the stages of the receive pipeline.
+    @objc public let timings = MessagePipelineTimings()
+
     // MARK: - Lifecycle
 
     /// Constructs an instance of `MessagePipelineSupervisor` to be treated as a shared instance for the application.
@@ -129,6 +136,37 @@ public class MessagePipelineSupervisor: NSObject {
                 uuidBackfillSuspension.invalidate()
             }
         }
+
+        // Only one process at a time should drain the queues. Extensions that
+        // don't process messages, e.g. the share extension, never contend.
+        let shouldContendForLease = CurrentAppContext().shouldProcessIncomingMessages &&
+                                    !CurrentAppContext().isRunningTests
+        if shouldContendForLease {
+            NotificationCenter.default.addObserver(self,
+                                                   selector: #selector(messageProcessingLeaseDidChange),
+                                                   name: MessageProcessingLease.leaseDidChange,
+                                                   object: nil)
+            MessageProcessingLease.shared.start()
+            updateLeaseSuspension()
+        }
+    }
+
+    @objc
+    private func messageProcessingLeaseDidChange() {
+        AssertIsOnMainThread()
+
+        updateLeaseSuspension()
+    }
+
+    private func updateLeaseSuspension() {
+        AssertIsOnMainThread()
+
+        if MessageProcessingLease.shared.isHeld {
+            leaseSuspension?.invalidate()
+            leaseSuspension = nil
+        } else if leaseSuspension == nil {
+            leaseSuspension = suspendMessageProcessing(for: "Message processing lease held by another process")
+        }
     }
 }
 
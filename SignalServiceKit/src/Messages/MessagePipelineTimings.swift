@@ -0,0 +1,218 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+@objc
+public enum MessagePipelineTimingStage: Int, CaseIterable, CustomStringConvertible {
+    // The envelope arrived from the service.
+    case received
+    // The envelope's decrypt job was committed.
+    case persisted
+    // The envelope was decrypted and handed to the batch processor.
+    case decrypted
+    // The envelope was processed by the message manager (or handed to the
+    // groups v2 processor).
+    case processed
+    // The transaction which processed the envelope was committed, so its
+    // changes are visible to the UI.
+    case visible
+
+    public var description: String {
+        switch self {
+        case .received:
+            return "received"
+        case .persisted:
+            return "persisted"
+        case .decrypted:
+            return "decrypted"
+        case .processed:
+            return "processed"
+        case .visible:
+            return "visible"
+        }
+    }
+}
+
+// MARK: -
+
+/// Records when each incoming envelope reaches each stage of the receive pipeline,
+/// and keeps latency histograms for each step between stages.
+@objc
+public class MessagePipelineTimings: NSObject {
+
+    private struct EnvelopeKey: Hashable {
+        let timestamp: UInt64
+        let serverTimestamp: UInt64
+    }
+
+    private struct EnvelopeTiming {
+        let receivedAt: CFTimeInterval
+        var stage: MessagePipelineTimingStage
+        var stageAt: CFTimeInterval
+    }
+
+    // A fixed-size sample of the most recent durations for one step.
+    private struct Histogram {
+        static let maxSampleCount = 256
+
+        private var samples = [Double]()
+        private var nextIndex = 0
+        private(set) var totalCount: UInt64 = 0
+
+        mutating func add(_ sample: Double) {
+            totalCount += 1
+            if samples.count < Self.maxSampleCount {
+                samples.append(sample)
+            } else {
+                samples[nextIndex] = sample
+                nextIndex = (nextIndex + 1) % Self.maxSampleCount
+            }
+        }
+
+        func percentiles(_ percentiles: [Double]) -> [Double]? {
+            guard !samples.isEmpty else {
+                return nil
+            }
+            let sortedSamples = samples.sorted()
+            return percentiles.map { percentile in
+                let index = Int((Double(sortedSamples.count - 1) * percentile).rounded())
+                return sortedSamples[index]
+            }
+        }
+    }
+
+    // We stop tracking envelopes if too many of them never reach the last stage.
+    private static let maxTrackedEnvelopeCount = 2000
+
+    // We log a summary after this many envelopes become visible.
+    private static let envelopesPerSummary: UInt64 = 1000
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+    private var envelopeTimings = [EnvelopeKey: EnvelopeTiming]()
+    private var processedEnvelopeKeys = [EnvelopeKey]()
+    // Keyed by the stage at the end of the step.
+    private var stepHistograms = [MessagePipelineTimingStage: Histogram]()
+    private var totalHistogram = Histogram()
+
+    // MARK: -
+
+    private static func envelopeKey(_ envelope: SSKProtoEnvelope) -> EnvelopeKey {
+        EnvelopeKey(timestamp: envelope.timestamp,
+                    serverTimestamp: envelope.hasServerTimestamp ? envelope.serverTimestamp : 0)
+    }
+
+    @objc(recordStage:envelope:)
+    public func record(stage: MessagePipelineTimingStage, envelope: SSKProtoEnvelope) {
+        let now = CACurrentMediaTime()
+        let key = Self.envelopeKey(envelope)
+
+        unfairLock.withLock {
+            guard stage != .received else {
+                if envelopeTimings.count >= Self.maxTrackedEnvelopeCount {
+                    Logger.warn("Discarding \(envelopeTimings.count) incomplete envelope timings.")
+                    envelopeTimings.removeAll()
+                    processedEnvelopeKeys.removeAll()
+                }
+                envelopeTimings[key] = EnvelopeTiming(receivedAt: now, stage: .received, stageAt: now)
+                return
+            }
+            // Envelopes received before we started tracking are ignored.
+            guard var timing = envelopeTimings[key],
+                  timing.stage.rawValue < stage.rawValue else {
+                return
+            }
+            stepHistograms[stage, default: Histogram()].add((now - timing.stageAt) * 1000)
+            timing.stage = stage
+            timing.stageAt = now
+            envelopeTimings[key] = timing
+
+            if stage == .processed {
+                processedEnvelopeKeys.append(key)
+            }
+        }
+    }
+
+    /// Should be called after the transaction in which envelopes were processed commits.
+    @objc
+    public func recordProcessedEnvelopesVisible() {
+        let now = CACurrentMediaTime()
+        let shouldLogSummary: Bool = unfairLock.withLock {
+            guard !processedEnvelopeKeys.isEmpty else {
+                return false
+            }
+            let oldTotalCount = totalHistogram.totalCount
+            for key in processedEnvelopeKeys {
+                guard let timing = envelopeTimings.removeValue(forKey: key) else {
+                    continue
+                }
+                stepHistograms[.visible, default: Histogram()].add((now - timing.stageAt) * 1000)
+                totalHistogram.add((now - timing.receivedAt) * 1000)
+            }
+            processedEnvelopeKeys.removeAll()
+            return (oldTotalCount / Self.envelopesPerSummary) != (totalHistogram.totalCount / Self.envelopesPerSummary)
+        }
+        if shouldLogSummary {
+            logSummary()
+        }
+    }
+
+    /// The number of envelopes which have become visible since launch or
+    /// the last reset.
+    public var visibleEnvelopeCount: UInt64 {
+        unfairLock.withLock { totalHistogram.totalCount }
+    }
+
+    /// Discards all timings, e.g. before measuring a synthetic load.
+    public func reset() {
+        unfairLock.withLock {
+            envelopeTimings.removeAll()
+            processedEnvelopeKeys.removeAll()
+            stepHistograms.removeAll()
+            totalHistogram = Histogram()
+        }
+    }
+
+    // MARK: - Reporting
+
+    /// A one-line-per-step summary of p50/p95/p99 latencies, in milliseconds.
+    @objc
+    public var summary: String {
+        let percentiles = [0.5, 0.95, 0.99]
+        func format(_ title: String, _ histogram: Histogram?) -> String? {
+            guard let histogram = histogram,
+                  let values = histogram.percentiles(percentiles) else {
+                return nil
+            }
+            let formattedValues = values.map { String(format: "%0.1f", $0) }
+            return "\(title): p50 \(formattedValues[0])ms, p95 \(formattedValues[1])ms, p99 \(formattedValues[2])ms (n=\(histogram.totalCount))"
+        }
+
+        return unfairLock.withLock {
+            var lines = [String]()
+            var previousStage = MessagePipelineTimingStage.received
+            for stage in MessagePipelineTimingStage.allCases where stage != .received {
+                if let line = format("\(previousStage) -> \(stage)", stepHistograms[stage]) {
+                    lines.append(line)
+                }
+                previousStage = stage
+            }
+            if let line = format("received -> visible", totalHistogram) {
+                lines.append(line)
+            }
+            return lines.joined(separator: "\n")
+        }
+    }
+
+    @objc
+    public func logSummary() {
+        let summary = self.summary
+        guard !summary.isEmpty else {
+            return
+        }
+        Logger.info("Message pipeline timings:\n\(summary)")
+    }
+}
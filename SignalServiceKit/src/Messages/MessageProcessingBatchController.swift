@@ -0,0 +1,160 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Sizes the batches of OWSMessageContentQueue.
+///
+/// Every batch is processed within a single write transaction. Large batches
+/// amortize the cost of committing across many messages, but hold the write
+/// lock longer and lose more work if the app is suspended mid-transaction.
+///
+/// The controller measures how long each batch takes to process and commit,
+/// maintains a moving average of the cost per message, and sizes the next
+/// batch so that it should complete within a target duration:
+///
+/// * A single live message is always processed right away.
+/// * A large backlog is processed in large batches without waiting between them.
+/// * In the background, batches are sized to fit well within the remaining
+///   background execution budget.
+/// * When memory headroom is low (e.g. in the NSE), batches are sized to fit
+///   well within it, since a batch's work is held until it commits.
+///
+/// This class is not thread-safe; OWSMessageContentQueue only uses it on its
+/// serial queue. The reported metrics may be read from any thread.
+@objc
+public class MessageProcessingBatchController: NSObject {
+
+    // How long we'd like a foreground batch to hold the write lock.
+    static let targetBatchDuration: TimeInterval = 0.1
+
+    static let maxBatchSize: UInt = 128
+
+    // We never want to spend more than this fraction of the remaining
+    // background time within a single batch.
+    static let backgroundBudgetFraction: Double = 0.25
+
+    // After we enter the background, we assume we have roughly this
+    // long to run before we're suspended.
+    @objc
+    public static let assumedBackgroundExecutionBudget: TimeInterval = 25
+
+    // When only a few messages are waiting, wait a short while before
+    // the next batch in hopes of increasing its size.
+    static let maxCoalescingDelay: TimeInterval = 0.5
+
+    // Weight of the most recent sample in the moving average.
+    static let smoothingFactor: Double = 0.2
+
+    // Initial estimate of the cost of processing a single message.
+    static let defaultCostPerMessage: TimeInterval = 0.005
+
+    // A conservative estimate of the memory a message holds until its batch
+    // commits, e.g. its models, cache entries and autoreleased objects.
+    static let estimatedMemoryPerMessage: UInt64 = 64 * 1024
+
+    // We never want a single batch to use more than this fraction of the
+    // remaining memory headroom.
+    static let memoryBudgetFraction: Double = 0.5
+
+    private var costPerMessage: TimeInterval = MessageProcessingBatchController.defaultCostPerMessage
+
+    // MARK: - Metrics
+
+    private let _lastBatchSize = AtomicUInt(0)
+    private let _lastBatchDuration = AtomicValue<TimeInterval>(0)
+    private let _averageCostPerMessage = AtomicValue<TimeInterval>(MessageProcessingBatchController.defaultCostPerMessage)
+
+    /// The size of the most recently committed batch.
+    @objc
+    public var lastBatchSize: UInt { _lastBatchSize.get() }
+
+    /// How long the most recently committed batch took to process and commit.
+    @objc
+    public var lastBatchDuration: TimeInterval { _lastBatchDuration.get() }
+
+    /// The moving average of the per-message cost of a batch.
+    @objc
+    public var averageCostPerMessage: TimeInterval { _averageCostPerMessage.get() }
+
+    // MARK: -
+
+    /// Returns the number of jobs to process in the next batch.
+    ///
+    /// - Parameters:
+    ///   - queueDepth: The number of jobs currently waiting.
+    ///   - remainingBackgroundTime: How much background execution time we
+    ///     expect to have left, or a negative value if the app is in the foreground.
+    ///   - availableMemory: The remaining memory headroom in bytes, or
+    ///     UInt64.max if it is unknown; see MemoryHeadroom.
+    @objc
+    public func nextBatchSize(queueDepth: UInt,
+                              remainingBackgroundTime: TimeInterval,
+                              availableMemory: UInt64 = UInt64.max) -> UInt {
+        guard queueDepth > 0 else {
+            return 0
+        }
+
+        let targetDuration: TimeInterval
+        if remainingBackgroundTime >= 0 {
+            targetDuration = min(Self.targetBatchDuration,
+                                 remainingBackgroundTime * Self.backgroundBudgetFraction)
+        } else {
+            targetDuration = Self.targetBatchDuration
+        }
+
+        let estimatedBatchSize = UInt(max(1, (targetDuration / max(costPerMessage, 0.0001)).rounded(.down)))
+        var batchSize = min(queueDepth, estimatedBatchSize, Self.maxBatchSize)
+        if availableMemory < MemoryHeadroom.lowThreshold {
+            let exhaustedThreshold = MemoryHeadroom.exhaustedThreshold
+            let usableMemory = availableMemory > exhaustedThreshold ? availableMemory - exhaustedThreshold : 0
+            let memoryBudget = Double(usableMemory) * Self.memoryBudgetFraction
+            let memoryBatchSize = UInt(memoryBudget / Double(Self.estimatedMemoryPerMessage))
+            batchSize = min(batchSize, memoryBatchSize)
+        }
+        return max(1, batchSize)
+    }
+
+    /// Records the duration of a batch, including the cost of committing its transaction.
+    @objc
+    public func didCompleteBatch(size: UInt, duration: TimeInterval) {
+        guard size > 0 else {
+            return
+        }
+
+        let sample = max(0, duration) / TimeInterval(size)
+        costPerMessage = (Self.smoothingFactor * sample) + ((1 - Self.smoothingFactor) * costPerMessage)
+
+        _lastBatchSize.set(size)
+        _lastBatchDuration.set(duration)
+        _averageCostPerMessage.set(costPerMessage)
+
+        if DebugFlags.isMessageProcessingVerbose {
+            Logger.verbose("batchSize: \(size), duration: \(String(format: "%0.1fms", duration * 1000)), " +
+                           "costPerMessage: \(String(format: "%0.2fms", costPerMessage * 1000))")
+        }
+    }
+
+    /// Returns how long to wait before processing the next batch.
+    ///
+    /// We don't wait if the queue is empty (the next step will find it drained)
+    /// or if there are enough jobs waiting to fill a batch.
+    @objc
+    public func delayBeforeNextBatch(queueDepth: UInt, remainingBackgroundTime: TimeInterval) -> TimeInterval {
+        guard queueDepth > 0 else {
+            return 0
+        }
+        guard remainingBackgroundTime < 0 else {
+            // Don't waste background time waiting.
+            return 0
+        }
+        let fullBatchSize = nextBatchSize(queueDepth: Self.maxBatchSize, remainingBackgroundTime: remainingBackgroundTime)
+        guard queueDepth < fullBatchSize else {
+            return 0
+        }
+        // Wait in proportion to how far we are from a full batch.
+        let shortfall = Double(fullBatchSize - queueDepth) / Double(fullBatchSize)
+        return Self.maxCoalescingDelay * shortfall
+    }
+}
@@ -0,0 +1,307 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Ensures that only one process at a time drains the message processing
+/// queues, so that the main app and the NSE don't decrypt and process the
+/// same envelopes while contending for the database's write lock.
+///
+/// The processes that process incoming messages contend for a lease in the
+/// shared container. The holder renews it with a heartbeat; the others
+/// defer until it is released or expires, e.g. because the holder was
+/// suspended or killed. The main app takes precedence while it is active:
+/// it preempts the NSE then. It releases the lease when it enters the
+/// background and doesn't contend for it until it is active again, since
+/// a suspended main app would otherwise keep the NSE waiting for the lease
+/// to expire.
+///
+/// Processes post a Darwin notification when they acquire or release the
+/// lease, so that the others needn't wait for their next heartbeat to learn
+/// that it changed hands. MessagePipelineSupervisor suspends processing
+/// whenever the lease isn't held.
+///
+/// This class is thread-safe.
+@objc
+public class MessageProcessingLease: NSObject {
+
+    /// Posted on the main thread when this process acquires or loses the lease.
+    @objc
+    public static let leaseDidChange = Notification.Name("MessageProcessingLeaseDidChange")
+
+    static let leaseDuration: TimeInterval = 15
+    static let heartbeatInterval: TimeInterval = 5
+
+    @objc
+    public static let shared = MessageProcessingLease(leaseFile: LeaseFile(fileUrl: URL(fileURLWithPath: OWSFileSystem.appSharedDataDirectoryPath())
+                                                                            .appendingPathComponent("MessageProcessingLease")))
+
+    private let leaseFile: LeaseFile
+
+    // Distinguishes this process from any earlier process with the same pid.
+    private let ownerId = UUID().uuidString
+
+    private let serialQueue = DispatchQueue(label: "org.signal.messageProcessingLease")
+
+    private let isHeldFlag = AtomicBool(false)
+
+    // The properties below should only be accessed on serialQueue.
+    private var isStarted = false
+    private var heartbeatTimer: DispatchSourceTimer?
+    private var observerToken = DarwinNotificationInvalidObserver
+    private var didBecomeActiveObserver: NSObjectProtocol?
+    private var didEnterBackgroundObserver: NSObjectProtocol?
+    // Set from when the main app enters the background until it is active again.
+    private var isYielding = false
+
+    private init(leaseFile: LeaseFile) {
+        self.leaseFile = leaseFile
+
+        super.init()
+
+        SwiftSingletons.register(self)
+    }
+
+    @objc
+    public var isHeld: Bool {
+        isHeldFlag.get()
+    }
+
+    // reportedApplicationState is thread-safe, unlike isMainAppAndActive.
+    private var canPreempt: Bool {
+        CurrentAppContext().isMainApp && CurrentAppContext().isAppForegroundAndActive()
+    }
+
+    private var ownerDescription: String {
+        "\(CurrentAppContext().isMainApp ? "main app" : "extension") (\(ProcessInfo.processInfo.processIdentifier))"
+    }
+
+    /// Starts contending for the lease. The lease is acquired
+    /// asynchronously, since doing so takes a file lock; observe
+    /// leaseDidChange to learn when it is held.
+    @objc
+    public func start() {
+        serialQueue.async {
+            guard !self.isStarted else {
+                return
+            }
+            self.isStarted = true
+
+            self.observerToken = DarwinNotificationCenter.addObserver(for: .messageProcessingLeaseDidChange,
+                                                                      queue: self.serialQueue) { [weak self] _ in
+                self?.refresh()
+            }
+            if CurrentAppContext().isMainApp {
+                // Preempt the NSE as soon as the main app becomes active,
+                // rather than at the next heartbeat.
+                let notificationCenter = NotificationCenter.default
+                self.didBecomeActiveObserver = notificationCenter.addObserver(forName: .OWSApplicationDidBecomeActive,
+                                                                              object: nil,
+                                                                              queue: nil) { [weak self] _ in
+                    guard let self = self else { return }
+                    self.serialQueue.async {
+                        self.isYielding = false
+                        self.refresh()
+                    }
+                }
+                self.didEnterBackgroundObserver = notificationCenter.addObserver(forName: .OWSApplicationDidEnterBackground,
+                                                                                 object: nil,
+                                                                                 queue: nil) { [weak self] _ in
+                    guard let self = self else { return }
+                    // Release the lease before the app is suspended.
+                    var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+                    self.serialQueue.async {
+                        self.isYielding = true
+                        self.releaseIfHeld()
+                        owsAssertDebug(backgroundTask != nil)
+                        backgroundTask = nil
+                    }
+                }
+            }
+
+            let heartbeatTimer = DispatchSource.makeTimerSource(queue: self.serialQueue)
+            heartbeatTimer.schedule(deadline: .now() + Self.heartbeatInterval,
+                                    repeating: Self.heartbeatInterval,
+                                    leeway: .seconds(1))
+            heartbeatTimer.setEventHandler { [weak self] in
+                self?.refresh()
+            }
+            heartbeatTimer.resume()
+            self.heartbeatTimer = heartbeatTimer
+
+            self.refresh()
+        }
+    }
+
+    /// Releases the lease, if held, and stops contending for it; e.g. when
+    /// the main app terminates, so that the NSE needn't wait for the lease
+    /// to expire.
+    ///
+    /// This blocks until the lease is released, since the process may exit
+    /// as soon as it returns.
+    @objc
+    public func stop() {
+        serialQueue.sync {
+            guard isStarted else {
+                return
+            }
+            isStarted = false
+
+            heartbeatTimer?.cancel()
+            heartbeatTimer = nil
+            if DarwinNotificationCenter.isValidObserver(observerToken) {
+                DarwinNotificationCenter.removeObserver(observerToken)
+            }
+            observerToken = DarwinNotificationInvalidObserver
+            for observer in [didBecomeActiveObserver, didEnterBackgroundObserver].compactMap({ $0 }) {
+                NotificationCenter.default.removeObserver(observer)
+            }
+            didBecomeActiveObserver = nil
+            didEnterBackgroundObserver = nil
+
+            releaseIfHeld()
+        }
+    }
+
+    private func releaseIfHeld() {
+        assertOnQueue(serialQueue)
+
+        guard isHeld else {
+            return
+        }
+        do {
+            try leaseFile.release(ownerId: ownerId)
+        } catch {
+            owsFailDebug("Error: \(error)")
+        }
+        Logger.info("Released lease.")
+        setIsHeld(false)
+        DarwinNotificationCenter.post(.messageProcessingLeaseDidChange)
+    }
+
+    // Acquires or renews the lease if possible.
+    private func refresh() {
+        assertOnQueue(serialQueue)
+
+        guard isStarted, !isYielding else {
+            return
+        }
+
+        let wasHeld = isHeld
+        let isNowHeld: Bool
+        do {
+            isNowHeld = try leaseFile.acquire(ownerId: ownerId,
+                                              ownerDescription: ownerDescription,
+                                              canPreempt: canPreempt,
+                                              now: Date())
+        } catch {
+            owsFailDebug("Error: \(error)")
+            // If the file can't be used, don't stall message processing.
+            isNowHeld = true
+        }
+        guard isNowHeld != wasHeld else {
+            return
+        }
+
+        if isNowHeld {
+            Logger.info("Acquired lease.")
+            // Let any preempted holder know promptly.
+            DarwinNotificationCenter.post(.messageProcessingLeaseDidChange)
+        } else {
+            Logger.info("Lost lease to: \(leaseFile.currentOwnerDescription() ?? "unknown").")
+        }
+        setIsHeld(isNowHeld)
+    }
+
+    private func setIsHeld(_ isHeld: Bool) {
+        isHeldFlag.set(isHeld)
+        NotificationCenter.default.postNotificationNameAsync(Self.leaseDidChange, object: nil)
+    }
+
+    // MARK: - Lease File
+
+    fileprivate struct Lease: Codable {
+        let ownerId: String
+        let ownerDescription: String
+        let expirationDate: Date
+    }
+
+    /// A small JSON file that holds the current lease. Processes take an
+    /// exclusive flock() on the file while they read or write it.
+    class LeaseFile {
+
+        let fileUrl: URL
+
+        init(fileUrl: URL) {
+            self.fileUrl = fileUrl
+        }
+
+        /// Acquires or renews the lease unless another owner holds it and
+        /// it hasn't expired. If canPreempt is set, the lease is acquired
+        /// regardless.
+        func acquire(ownerId: String, ownerDescription: String, canPreempt: Bool, now: Date) throws -> Bool {
+            try withLockedFile { fileHandle in
+                if let lease = Self.readLease(fileHandle: fileHandle),
+                   lease.ownerId != ownerId,
+                   lease.expirationDate > now,
+                   !canPreempt {
+                    return false
+                }
+                let lease = Lease(ownerId: ownerId,
+                                  ownerDescription: ownerDescription,
+                                  expirationDate: now.addingTimeInterval(MessageProcessingLease.leaseDuration))
+                let data = try JSONEncoder().encode(lease)
+                fileHandle.truncateFile(atOffset: 0)
+                fileHandle.write(data)
+                return true
+            }
+        }
+
+        /// Releases the lease if it is held by ownerId.
+        func release(ownerId: String) throws {
+            try withLockedFile { fileHandle in
+                guard Self.readLease(fileHandle: fileHandle)?.ownerId == ownerId else {
+                    return
+                }
+                fileHandle.truncateFile(atOffset: 0)
+            }
+        }
+
+        func currentOwnerDescription() -> String? {
+            try? withLockedFile { fileHandle in
+                Self.readLease(fileHandle: fileHandle)?.ownerDescription
+            }
+        }
+
+        private static func readLease(fileHandle: FileHandle) -> Lease? {
+            fileHandle.seek(toFileOffset: 0)
+            let data = fileHandle.readDataToEndOfFile()
+            guard !data.isEmpty else {
+                return nil
+            }
+            do {
+                return try JSONDecoder().decode(Lease.self, from: data)
+            } catch {
+                // Treat a corrupt lease as released.
+                owsFailDebug("Error: \(error)")
+                return nil
+            }
+        }
+
+        private func withLockedFile<T>(_ block: (FileHandle) throws -> T) throws -> T {
+            let fileDescriptor = open(fileUrl.path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR)
+            guard fileDescriptor >= 0 else {
+                throw OWSAssertionError("Couldn't open lease: \(errno)")
+            }
+            let fileHandle = FileHandle(fileDescriptor: fileDescriptor, closeOnDealloc: true)
+            guard flock(fileDescriptor, LOCK_EX) == 0 else {
+                throw OWSAssertionError("Couldn't lock lease: \(errno)")
+            }
+            defer {
+                flock(fileDescriptor, LOCK_UN)
+            }
+            return try block(fileHandle)
+        }
+    }
+}
@@ -96,6 +96,9 @@ NS_SWIFT_NAME(OutgoingAttachmentInfo)
 
 + (NSOperationQueuePriority)queuePriorityForMessage:(TSOutgoingMessage *)message;
 
+// YES if any message sends are waiting for or using the global sending queue.
+@property (class, nonatomic, readonly) BOOL hasPendingMessageSends;
+
 // TODO: Make this private.
 - (void)sendMessageToRecipient:(OWSMessageSend *)messageSend;
 
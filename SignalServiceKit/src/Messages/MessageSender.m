@@ -4,6 +4,7 @@
 
 #import "MessageSender.h"
 #import "AppContext.h"
+#import "AppReadiness.h"
 #import "NSData+keyVersionByte.h"
 #import "NSData+messagePadding.h"
 #import "NSError+OWSOperation.h"
@@ -268,9 +269,16 @@ NSError *SSKEnsureError(NSError *_Nullable error, OWSErrorCode fallbackCode, NSS
         return;
     }
 
+    uint64_t signpostId = [Signposts beginInterval:SignpostIntervalMessageSend];
     [self.messageSender sendMessageToService:self.message
-        success:^{ [self reportSuccess]; }
-        failure:^(NSError *error) { [self reportError:error]; }];
+        success:^{
+            [Signposts endInterval:SignpostIntervalMessageSend signpostId:signpostId];
+            [self reportSuccess];
+        }
+        failure:^(NSError *error) {
+            [Signposts endInterval:SignpostIntervalMessageSend signpostId:signpostId];
+            [self reportError:error];
+        }];
 }
 
 - (void)didSucceed
@@ -316,6 +324,8 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
 
     OWSSingletonAssert();
 
+    [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{ [SessionPrewarmer.shared schedulePrewarming]; }];
+
     return self;
 }
 
@@ -400,6 +410,16 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
     NSString *queueKey = message.uniqueThreadId ?: kDefaultQueueKey;
     OWSAssertDebug(queueKey.length > 0);
 
+    // Call messages are latency-sensitive: every offer, answer and ICE update
+    // delays call setup until it is sent. They get their own serial queue per
+    // conversation so that they don't wait behind the conversation's other
+    // messages, e.g. attachment sends. RingRTC doesn't send a call's next
+    // signaling message until the previous one has been sent, so they're
+    // still sent in order.
+    if (message.isCallMessage) {
+        queueKey = [@"call:" stringByAppendingString:queueKey];
+    }
+
     if ([kDefaultQueueKey isEqualToString:queueKey]) {
         // when do we get here?
         OWSLogDebug(@"using default message queue");
@@ -409,6 +429,8 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
         NSOperationQueue *sendingQueue = self.sendingQueueMap[queueKey];
 
         if (!sendingQueue) {
+            [self evictIdleSendingQueues];
+
             sendingQueue = [NSOperationQueue new];
             sendingQueue.qualityOfService = NSOperationQualityOfServiceUserInitiated;
             sendingQueue.maxConcurrentOperationCount = 1;
@@ -420,6 +442,35 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
     }
 }
 
+// Every conversation gets its own serial sending queue, which ensures that
+// its messages are sent in order. Large accounts can send to thousands of
+// conversations, so we discard queues that have no pending operations
+// once we're holding more than a few of them. A queue with no operations
+// has nothing to order new operations against, so it's always safe to
+// replace it.
+- (void)evictIdleSendingQueues
+{
+    // Must be called while synchronized on self.
+
+    const NSUInteger kMaxSendingQueueCount = 16;
+    if (self.sendingQueueMap.count < kMaxSendingQueueCount) {
+        return;
+    }
+
+    NSMutableArray<NSString *> *idleQueueKeys = [NSMutableArray new];
+    [self.sendingQueueMap enumerateKeysAndObjectsUsingBlock:^(
+        NSString *queueKey, NSOperationQueue *sendingQueue, BOOL *stop) {
+        if (sendingQueue.operationCount == 0) {
+            [idleQueueKeys addObject:queueKey];
+        }
+    }];
+    [self.sendingQueueMap removeObjectsForKeys:idleQueueKeys];
+
+    OWSLogVerbose(@"Evicted %lu idle sending queues, %lu remain.",
+        (unsigned long)idleQueueKeys.count,
+        (unsigned long)self.sendingQueueMap.count);
+}
+
 + (NSOperationQueue *)globalSendingQueue
 {
     static dispatch_once_t onceToken;
@@ -434,6 +485,11 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
     return operationQueue;
 }
 
++ (BOOL)hasPendingMessageSends
+{
+    return self.globalSendingQueue.operationCount > 0;
+}
+
 - (void)sendMessage:(OutgoingMessagePreparer *)outgoingMessagePreparer
             success:(void (^)(void))successHandler
             failure:(void (^)(NSError *error))failureHandler
@@ -485,7 +541,16 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
             [OWSUploadOperation.uploadQueue addOperation:uploadAttachmentOperation];
         }
 
-        NSOperationQueue *sendingQueue = [self sendingQueueForMessage:message];
+        if (message.isCallMessage) {
+            // Call messages are small and infrequent, so they skip the global
+            // limit on sends in flight; see -sendingQueueForMessage:.
+            @synchronized(self) {
+                NSOperationQueue *sendingQueue = [self sendingQueueForMessage:message];
+                [sendingQueue addOperation:sendMessageOperation];
+            }
+            return;
+        }
+
         NSOperationQueue *globalSendingQueue = MessageSender.globalSendingQueue;
 
         // We use two "global" operations and the globalSendingQueue
@@ -498,12 +563,22 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
         // One global operation runs _after_ sendMessageOperation and
         // ensures that subsequent message sends will block behind the
         // message send which are currently enqueuing.
+        //
+        // The global operations share the priority of sendMessageOperation,
+        // so that messages with renderable content can overtake bulk
+        // traffic like receipts and sync messages that is waiting for a
+        // slot on the globalSendingQueue.
         NSOperation *globalBeforeOperation = [NSOperation new];
+        globalBeforeOperation.queuePriority = sendMessageOperation.queuePriority;
         [sendMessageOperation addDependency:globalBeforeOperation];
         NSOperation *globalAfterOperation = [NSOperation new];
+        globalAfterOperation.queuePriority = sendMessageOperation.queuePriority;
         [globalAfterOperation addDependency:sendMessageOperation];
 
         @synchronized(self) {
+            // Look up the sending queue while synchronized so that it can't
+            // be evicted before we enqueue sendMessageOperation.
+            NSOperationQueue *sendingQueue = [self sendingQueueForMessage:message];
             [globalSendingQueue addOperation:globalBeforeOperation];
             [sendingQueue addOperation:sendMessageOperation];
             [globalSendingQueue addOperation:globalAfterOperation];
@@ -598,11 +673,16 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
         return;
     }
 
+    uint64_t signpostId = [Signposts beginInterval:SignpostIntervalMessageSendPrepare];
     [MessageSender prepareForSendOf:message
-                            success:^(MessageSendInfo *sendInfo) {
-                                [self sendMessageToService:message sendInfo:sendInfo success:success failure:failure];
-                            }
-                            failure:failure];
+        success:^(MessageSendInfo *sendInfo) {
+            [Signposts endInterval:SignpostIntervalMessageSendPrepare signpostId:signpostId];
+            [self sendMessageToService:message sendInfo:sendInfo success:success failure:failure];
+        }
+        failure:^(NSError *error) {
+            [Signposts endInterval:SignpostIntervalMessageSendPrepare signpostId:signpostId];
+            failure(error);
+        }];
 }
 
 - (AnyPromise *)unlockPreKeyUpdateFailuresPromise
@@ -648,16 +728,18 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
     OWSAssertDebug(message);
     OWSAssertDebug(thread);
 
-    // 1. gather "ud sending access" using a single write transaction.
-    NSMutableDictionary<SignalServiceAddress *, OWSUDSendingAccess *> *sendingAccessMap = [NSMutableDictionary new];
+    // 1. gather "ud sending access" for all recipients in a single pass.
+    NSDictionary<SignalServiceAddress *, OWSUDSendingAccess *> *sendingAccessMap = @{};
     if (senderCertificates != nil) {
+        NSMutableArray<SignalServiceAddress *> *remoteAddresses = [NSMutableArray new];
         for (SignalServiceAddress *address in addresses) {
             if (!address.isLocalAddress) {
-                sendingAccessMap[address] = [self.udManager udSendingAccessForAddress:address
-                                                                    requireSyncAccess:YES
-                                                                   senderCertificates:senderCertificates];
+                [remoteAddresses addObject:address];
             }
         }
+        sendingAccessMap = [self.udManager udSendingAccessMapForAddresses:remoteAddresses
+                                                        requireSyncAccess:YES
+                                                       senderCertificates:senderCertificates];
     }
 
     // 2. Build a "OWSMessageSend" for each recipient.
@@ -689,7 +771,15 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
             // completion promise to execute until _all_ send promises
             // have either succeeded or failed. PMKWhen() executes as
             // soon as any of its input promises fail.
-            return PMKJoin(sendPromises);
+            return PMKJoin(sendPromises)
+                .thenInBackground(^(id joinValue) {
+                    [MessageSender logSendLatenciesForMessageSends:messageSends];
+                    return joinValue;
+                })
+                .catchInBackground(^(NSError *error) {
+                    [MessageSender logSendLatenciesForMessageSends:messageSends];
+                    return error;
+                });
         });
 }
 
@@ -1269,12 +1359,12 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
     OWSAssertDebug(messageSend.message);
     OWSAssertDebug(messageSend.address.isValid);
 
-    __block SignalRecipient *recipient;
+    __block RecipientDevices *_Nullable recipient;
     __block NSData *_Nullable plainText;
     [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
-        recipient = [SignalRecipient getRecipientForAddress:messageSend.address
-                                            mustHaveDevices:NO
-                                                transaction:transaction];
+        recipient = [GroupRecipientDeviceCache.shared recipientDevicesFor:messageSend.address
+                                                                   thread:messageSend.thread
+                                                              transaction:transaction];
         plainText = [messageSend.message buildPlainTextData:messageSend.address
                                                      thread:messageSend.thread
                                                 transaction:transaction];
@@ -1288,7 +1378,7 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
         OWSRaiseException(InvalidMessageException, @"Failed to build message proto");
     }
 
-    NSMutableArray<NSNumber *> *deviceIds = [recipient.devices.array mutableCopy];
+    NSMutableArray<NSNumber *> *deviceIds = [recipient.deviceIds mutableCopy];
     OWSAssertDebug(deviceIds);
 
     NSMutableArray *messagesArray = [NSMutableArray arrayWithCapacity:deviceIds.count];
@@ -1297,7 +1387,7 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
         @"built message: %@ plainTextData.length: %lu", [messageSend.message class], (unsigned long)plainText.length);
 
     OWSLogVerbose(@"building device messages for: %@ %@ (isLocalAddress: %d, isUDSend: %d)",
-        recipient.address,
+        messageSend.address,
         deviceIds,
         messageSend.isLocalAddress,
         messageSend.isUDSend);
@@ -1583,6 +1673,9 @@ NSString *const MessageSenderRateLimitedException = @"RateLimitedException";
 
 + (NSOperationQueuePriority)queuePriorityForMessage:(TSOutgoingMessage *)message
 {
+    if (message.isCallMessage) {
+        return NSOperationQueuePriorityVeryHigh;
+    }
     return message.hasRenderableContent ? NSOperationQueuePriorityHigh : NSOperationQueuePriorityNormal;
 }
 
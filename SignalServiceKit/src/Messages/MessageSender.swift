@@ -96,144 +96,279 @@ public extension MessageSender {
         AnyPromise(ensureSessions(forMessageSends: messageSends,
                                   ignoreErrors: ignoreErrors))
     }
+
+    // Reports how long the slowest recipients of a multi-recipient send took.
+    class func logSendLatencies(forMessageSends messageSends: [OWSMessageSend]) {
+        guard messageSends.count > 1 else {
+            return
+        }
+        let sortedSends = messageSends.compactMap { messageSend -> (OWSMessageSend, TimeInterval)? in
+            guard let sendDuration = messageSend.sendDuration else {
+                return nil
+            }
+            return (messageSend, sendDuration.doubleValue)
+        }.sorted { $0.1 > $1.1 }
+        guard let (slowestSend, slowestDuration) = sortedSends.first else {
+            return
+        }
+        let medianDuration = sortedSends[sortedSends.count / 2].1
+        Logger.info("Sent \(slowestSend.message.timestamp) to \(sortedSends.count) recipients, " +
+                        "median: \(String(format: "%0.3fs", medianDuration)), " +
+                        "slowest: \(slowestSend.address) \(String(format: "%0.3fs", slowestDuration))")
+        if DebugFlags.internalLogging {
+            for (messageSend, sendDuration) in sortedSends {
+                Logger.verbose("\(messageSend.address): \(String(format: "%0.3fs", sendDuration))")
+            }
+        }
+    }
 }
 
 // MARK: -
 
 extension MessageSender {
 
+    // Preparing sends and fetching prekeys is driven from this queue. Their
+    // promise chains use the TaskQueue so that steps which follow one another
+    // on the queue don't re-dispatch.
+    static let taskQueue = TaskQueue(label: "org.signal.messageSender", qos: .default, attributes: .concurrent)
+
     private struct SessionStates {
         let deviceAlreadyHasSession = AtomicUInt(0)
         let deviceDeviceSessionCreated = AtomicUInt(0)
         let failure = AtomicUInt(0)
     }
 
+    // Prekey fetches for a large group can number in the hundreds; we
+    // keep only a few of them in flight at a time.
+    static let maxConcurrentPrekeyFetches = 8
+
     private class func ensureSessions(forMessageSends messageSends: [OWSMessageSend],
                                       ignoreErrors: Bool) -> Promise<Void> {
-        let promise = firstly(on: .global()) { () -> Promise<Void> in
-            var promises = [Promise<Void>]()
-            for messageSend in messageSends {
-                promises += self.ensureSessions(forMessageSend: messageSend,
-                                                ignoreErrors: ignoreErrors)
+        let promise = firstly(on: MessageSender.taskQueue) { () -> Promise<Void> in
+            // Find the devices without sessions for every recipient in a
+            // single transaction.
+            let sessionStates: [(messageSend: OWSMessageSend, accountId: AccountId?, deviceIds: [UInt32])] = databaseStorage.read { transaction in
+                guard let thread = messageSends.first?.thread else {
+                    return []
+                }
+                let recipientDevicesMap = GroupRecipientDeviceCache.shared.recipientDevices(for: messageSends.map { $0.address },
+                                                                                            thread: thread,
+                                                                                            transaction: transaction)
+                return messageSends.compactMap { messageSend in
+                    let (accountId, deviceIds) = self.deviceIdsWithoutSessions(forMessageSend: messageSend,
+                                                                               recipientDevices: recipientDevicesMap[messageSend.address],
+                                                                               transaction: transaction)
+                    guard !deviceIds.isEmpty else {
+                        return nil
+                    }
+                    return (messageSend: messageSend, accountId: accountId, deviceIds: deviceIds)
+                }
             }
-            if !promises.isEmpty {
-                Logger.info("Prekey fetches: \(promises.count)")
+
+            var prekeyFetches = [() -> Promise<Void>]()
+            for sessionState in sessionStates {
+                prekeyFetches += self.prekeyFetches(forMessageSend: sessionState.messageSend,
+                                                    accountId: sessionState.accountId,
+                                                    deviceIdsWithoutSessions: sessionState.deviceIds,
+                                                    ignoreErrors: ignoreErrors)
+            }
+            if !prekeyFetches.isEmpty {
+                Logger.info("Prekey fetches: \(prekeyFetches.count)")
             }
-            return when(fulfilled: promises).asVoid()
+            return self.performWithBoundedConcurrency(prekeyFetches,
+                                                      maxConcurrency: maxConcurrentPrekeyFetches)
         }
         if !ignoreErrors {
-            promise.catch(on: .global()) { _ in
+            promise.catch(on: MessageSender.taskQueue) { _ in
                 owsFailDebug("The promises should never fail.")
             }
         }
         return promise
     }
 
-    private class func ensureSessions(forMessageSend messageSend: OWSMessageSend,
-                                      ignoreErrors: Bool) -> [Promise<Void>] {
+    // Runs the given tasks, with no more than maxConcurrency of them in flight at a time.
+    //
+    // Every task runs, even if an earlier one fails. Once they have all
+    // completed, the promise is rejected with the first error, if any.
+    class func performWithBoundedConcurrency(_ tasks: [() -> Promise<Void>],
+                                                     maxConcurrency: Int) -> Promise<Void> {
+        guard !tasks.isEmpty else {
+            return Promise.value(())
+        }
 
-        var accountId: AccountId?
-        let deviceIdsWithoutSessions: [UInt32] = databaseStorage.read { transaction in
-            guard let recipient = SignalRecipient.get(
-                address: messageSend.address,
-                mustHaveDevices: false,
-                transaction: transaction
-            ) else {
-                // If there is no existing recipient for this address, try and send to
-                // the primary device so we can see if they are registered.
-                return [OWSDevicePrimaryDeviceId]
+        let unfairLock = UnfairLock()
+        // These properties should only be accessed with unfairLock.
+        var remainingTasks = tasks[...]
+        var firstError: Error?
+        func popTask() -> (() -> Promise<Void>)? {
+            unfairLock.withLock {
+                remainingTasks.popFirst()
             }
-
-            accountId = recipient.accountId
-
-            var deviceIds: [UInt32] = recipient.devices.compactMap { value in
-                guard let numberValue = value as? NSNumber else {
-                    owsFailDebug("Invalid device id: \(value)")
-                    return nil
+        }
+        func performRemainingTasks() -> Promise<Void> {
+            guard let task = popTask() else {
+                return Promise.value(())
+            }
+            return firstly(on: MessageSender.taskQueue) {
+                task()
+            }.recover(on: MessageSender.taskQueue) { (error: Error) -> Void in
+                unfairLock.withLock {
+                    if firstError == nil {
+                        firstError = error
+                    }
                 }
-                return numberValue.uint32Value
+            }.then(on: MessageSender.taskQueue.dispatchQueue) {
+                // Always dispatch here, so that tasks which complete
+                // immediately don't recurse.
+                performRemainingTasks()
             }
+        }
 
-            // Filter out the current device, we never need a session for it.
-            if messageSend.isLocalAddress {
-                let localDeviceId = tsAccountManager.storedDeviceId(with: transaction)
-                deviceIds = deviceIds.filter { $0 != localDeviceId }
+        let workerCount = min(tasks.count, max(1, maxConcurrency))
+        let workers = (0..<workerCount).map { _ in performRemainingTasks() }
+        return when(fulfilled: workers).asVoid().done(on: MessageSender.taskQueue) {
+            if let error = unfairLock.withLock({ firstError }) {
+                throw error
             }
+        }
+    }
 
-            return deviceIds.filter { deviceId in
-                !self.sessionStore.containsSession(
-                    forAccountId: recipient.accountId,
-                    deviceId: Int32(deviceId),
-                    transaction: transaction
-                )
-            }
+    private class func deviceIdsWithoutSessions(forMessageSend messageSend: OWSMessageSend,
+                                                recipientDevices: RecipientDevices?,
+                                                transaction: SDSAnyReadTransaction) -> (accountId: AccountId?, deviceIds: [UInt32]) {
+        guard let recipient = recipientDevices else {
+            // If there is no existing recipient for this address, try and send to
+            // the primary device so we can see if they are registered.
+            return (accountId: nil, deviceIds: [OWSDevicePrimaryDeviceId])
         }
 
-        guard !deviceIdsWithoutSessions.isEmpty else { return [] }
+        var deviceIds: [UInt32] = recipient.deviceIds.map { $0.uint32Value }
 
-        var promises = [Promise<Void>]()
-        for deviceId in deviceIdsWithoutSessions {
+        // Filter out the current device, we never need a session for it.
+        if messageSend.isLocalAddress {
+            let localDeviceId = tsAccountManager.storedDeviceId(with: transaction)
+            deviceIds = deviceIds.filter { $0 != localDeviceId }
+        }
 
-            Logger.verbose("Fetching prekey for: \(messageSend.address), \(deviceId)")
+        let deviceIdsWithoutSessions = deviceIds.filter { deviceId in
+            !self.sessionStore.containsSession(
+                forAccountId: recipient.accountId,
+                deviceId: Int32(deviceId),
+                transaction: transaction
+            )
+        }
+        SessionPrewarmer.shared.recordSessionLookup(accountId: recipient.accountId,
+                                                    deviceIds: deviceIds,
+                                                    deviceIdsWithoutSessions: deviceIdsWithoutSessions)
+        return (accountId: recipient.accountId, deviceIds: deviceIdsWithoutSessions)
+    }
 
-            let promise: Promise<Void> = firstly(on: .global()) { () -> Promise<PreKeyBundle> in
-                let (promise, resolver) = Promise<PreKeyBundle>.pending()
-                self.makePrekeyRequest(
-                    messageSend: messageSend,
-                    deviceId: NSNumber(value: deviceId),
-                    accountId: accountId,
-                    success: { preKeyBundle in
-                        guard let preKeyBundle = preKeyBundle else {
-                            return resolver.reject(OWSAssertionError("Missing preKeyBundle."))
-                        }
-                        resolver.fulfill(preKeyBundle)
-                    },
-                    failure: { error in
-                        resolver.reject(error)
+    private class func prekeyFetches(forMessageSend messageSend: OWSMessageSend,
+                                      accountId: AccountId?,
+                                      deviceIdsWithoutSessions: [UInt32],
+                                      ignoreErrors: Bool) -> [() -> Promise<Void>] {
 
-                    }
-                )
-                return promise
-            }.done(on: .global()) { (preKeyBundle: PreKeyBundle) -> Void in
-                try self.databaseStorage.write { transaction in
-                    // Since we successfully fetched the prekey bundle,
-                    // we know this device is registered. We can safely
-                    // mark it as such to acquire a stable accountId.
-                    let recipient = SignalRecipient.mark(
-                        asRegisteredAndGet: messageSend.address,
-                        deviceId: deviceId,
-                        trustLevel: .low,
-                        transaction: transaction
-                    )
-                    try self.createSession(
-                        forPreKeyBundle: preKeyBundle,
-                        accountId: recipient.accountId,
-                        recipientAddress: messageSend.address,
+        var prekeyFetches = [() -> Promise<Void>]()
+        for deviceId in deviceIdsWithoutSessions {
+            prekeyFetches.append({ () -> Promise<Void> in
+                Logger.verbose("Fetching prekey for: \(messageSend.address), \(deviceId)")
+
+                return firstly(on: MessageSender.taskQueue) { () -> Promise<PreKeyBundle> in
+                    let (promise, resolver) = Promise<PreKeyBundle>.pending()
+                    self.makePrekeyRequest(
+                        messageSend: messageSend,
                         deviceId: NSNumber(value: deviceId),
-                        transaction: transaction
+                        accountId: accountId,
+                        success: { preKeyBundle in
+                            guard let preKeyBundle = preKeyBundle else {
+                                return resolver.reject(OWSAssertionError("Missing preKeyBundle."))
+                            }
+                            resolver.fulfill(preKeyBundle)
+                        },
+                        failure: { error in
+                            resolver.reject(error)
+
+                        }
                     )
-                }
-            }.recover(on: .global()) { (error: Error) in
-                switch error {
-                case MessageSenderError.missingDevice:
-                    self.databaseStorage.write { transaction in
-                        MessageSender.updateDevices(messageSend: messageSend,
-                                                    devicesToAdd: [],
-                                                    devicesToRemove: [NSNumber(value: deviceId)],
-                                                    transaction: transaction)
+                    return promise
+                }.done(on: MessageSender.taskQueue) { (preKeyBundle: PreKeyBundle) -> Void in
+                    try self.databaseStorage.write { transaction in
+                        // Since we successfully fetched the prekey bundle,
+                        // we know this device is registered. We can safely
+                        // mark it as such to acquire a stable accountId.
+                        let recipient = SignalRecipient.mark(
+                            asRegisteredAndGet: messageSend.address,
+                            deviceId: deviceId,
+                            trustLevel: .low,
+                            transaction: transaction
+                        )
+                        try self.createSession(
+                            forPreKeyBundle: preKeyBundle,
+                            accountId: recipient.accountId,
+                            recipientAddress: messageSend.address,
+                            deviceId: NSNumber(value: deviceId),
+                            transaction: transaction
+                        )
+                    }
+                }.recover(on: MessageSender.taskQueue) { (error: Error) in
+                    switch error {
+                    case MessageSenderError.missingDevice:
+                        self.databaseStorage.write { transaction in
+                            MessageSender.updateDevices(messageSend: messageSend,
+                                                        devicesToAdd: [],
+                                                        devicesToRemove: [NSNumber(value: deviceId)],
+                                                        transaction: transaction)
+                        }
+                    default:
+                        break
+                    }
+                    if ignoreErrors {
+                        Logger.warn("Ignoring error: \(error)")
+                    } else {
+                        throw error
                     }
-                default:
-                    break
                 }
-                if ignoreErrors {
-                    Logger.warn("Ignoring error: \(error)")
-                } else {
-                    throw error
+            })
+        }
+        return prekeyFetches
+    }
+
+    // Creates a session for a device before we first send to it, so that
+    // the send doesn't have to wait for a prekey fetch.
+    class func prewarmSession(recipientAddress: SignalServiceAddress,
+                              accountId: AccountId,
+                              deviceId: UInt32) -> Promise<Void> {
+        return firstly(on: MessageSender.taskQueue) { () -> Promise<PreKeyBundle> in
+            let (promise, resolver) = Promise<PreKeyBundle>.pending()
+            self.makePrekeyRequest(
+                recipientAddress: recipientAddress,
+                deviceId: NSNumber(value: deviceId),
+                accountId: accountId,
+                udAccess: self.udManager.udAccess(forAddress: recipientAddress, requireSyncAccess: false),
+                udAuthFailureBlock: {},
+                websocketFailureBlock: {},
+                success: { preKeyBundle in
+                    guard let preKeyBundle = preKeyBundle else {
+                        return resolver.reject(OWSAssertionError("Missing preKeyBundle."))
+                    }
+                    resolver.fulfill(preKeyBundle)
+                },
+                failure: { error in
+                    resolver.reject(error)
                 }
+            )
+            return promise
+        }.done(on: MessageSender.taskQueue) { (preKeyBundle: PreKeyBundle) -> Void in
+            try self.databaseStorage.write { transaction in
+                try self.createSession(
+                    forPreKeyBundle: preKeyBundle,
+                    accountId: accountId,
+                    recipientAddress: recipientAddress,
+                    deviceId: NSNumber(value: deviceId),
+                    transaction: transaction
+                )
             }
-            promises.append(promise)
         }
-        return promises
     }
 }
 
@@ -247,9 +382,33 @@ public extension MessageSender {
                                  accountId: AccountId?,
                                  success: @escaping (PreKeyBundle?) -> Void,
                                  failure: @escaping (Error) -> Void) {
-        assert(!Thread.isMainThread)
+        makePrekeyRequest(recipientAddress: messageSend.address,
+                          deviceId: deviceId,
+                          accountId: accountId,
+                          udAccess: messageSend.udSendingAccess?.udAccess,
+                          udAuthFailureBlock: {
+                            // Note the UD auth failure so subsequent retries
+                            // to this recipient also use basic auth.
+                            messageSend.setHasUDAuthFailed()
+                          },
+                          websocketFailureBlock: {
+                            // Note the websocket failure so subsequent retries
+                            // to this recipient also use REST.
+                            messageSend.hasWebsocketSendFailed = true
+                          },
+                          success: success,
+                          failure: failure)
+    }
 
-        let recipientAddress = messageSend.address
+    private class func makePrekeyRequest(recipientAddress: SignalServiceAddress,
+                                         deviceId: NSNumber,
+                                         accountId: AccountId?,
+                                         udAccess: OWSUDAccess?,
+                                         udAuthFailureBlock: @escaping () -> Void,
+                                         websocketFailureBlock: @escaping () -> Void,
+                                         success: @escaping (PreKeyBundle?) -> Void,
+                                         failure: @escaping (Error) -> Void) {
+        assert(!Thread.isMainThread)
         assert(recipientAddress.isValid)
 
         Logger.info("recipientAddress: \(recipientAddress), deviceId: \(deviceId)")
@@ -284,27 +443,21 @@ public extension MessageSender {
                                             return OWSRequestFactory.recipientPreKeyRequest(with: recipientAddress,
                                                                                             deviceId: deviceId.stringValue,
                                                                                             udAccessKey: udAccessKeyForRequest)
-                                        }, udAuthFailureBlock: {
-                                            // Note the UD auth failure so subsequent retries
-                                            // to this recipient also use basic auth.
-                                            messageSend.setHasUDAuthFailed()
-                                        }, websocketFailureBlock: {
-                                            // Note the websocket failure so subsequent retries
-                                            // to this recipient also use REST.
-                                            messageSend.hasWebsocketSendFailed = true
-                                        }, address: recipientAddress,
-                                        udAccess: messageSend.udSendingAccess?.udAccess,
+                                        }, udAuthFailureBlock: udAuthFailureBlock,
+                                        websocketFailureBlock: websocketFailureBlock,
+                                        address: recipientAddress,
+                                        udAccess: udAccess,
                                         canFailoverUDAuth: true)
 
-        firstly(on: .global()) { () -> Promise<RequestMakerResult> in
+        firstly(on: MessageSender.taskQueue) { () -> Promise<RequestMakerResult> in
             return requestMaker.makeRequest()
-        }.done(on: .global()) { (result: RequestMakerResult) in
+        }.done(on: MessageSender.taskQueue) { (result: RequestMakerResult) in
             guard let responseObject = result.responseObject as? [AnyHashable: Any] else {
                 throw OWSAssertionError("Prekey fetch missing response object.")
             }
             let bundle = PreKeyBundle(from: responseObject, forDeviceNumber: deviceId)
             success(bundle)
-        }.catch(on: .global()) { error in
+        }.catch(on: MessageSender.taskQueue) { error in
             if let httpStatusCode = error.httpStatusCode {
                 if httpStatusCode == 404 {
                     self.hadMissingDeviceError(recipientAddress: recipientAddress, deviceId: deviceId)
@@ -561,15 +714,15 @@ extension MessageSender {
                                       failure: @escaping (Error?) -> Void) {
         firstly {
             prepareSend(of: message)
-        }.done(on: .global()) { messageSendRecipients in
+        }.done(on: MessageSender.taskQueue) { messageSendRecipients in
             success(messageSendRecipients)
-        }.catch(on: .global()) { error in
+        }.catch(on: MessageSender.taskQueue) { error in
             failure(error)
         }
     }
 
     private static func prepareSend(of message: TSOutgoingMessage) -> Promise<MessageSendInfo> {
-        firstly(on: .global()) { () -> Promise<SenderCertificates> in
+        firstly(on: MessageSender.taskQueue) { () -> Promise<SenderCertificates> in
             let (promise, resolver) = Promise<SenderCertificates>.pending()
             self.udManager.ensureSenderCertificates(
                 certificateExpirationPolicy: .permissive,
@@ -581,7 +734,7 @@ extension MessageSender {
                 }
             )
             return promise
-        }.then(on: .global()) { senderCertificates in
+        }.then(on: MessageSender.taskQueue) { senderCertificates in
             self.prepareRecipients(of: message, senderCertificates: senderCertificates)
         }
     }
@@ -589,7 +742,7 @@ extension MessageSender {
     private static func prepareRecipients(of message: TSOutgoingMessage,
                                           senderCertificates: SenderCertificates) -> Promise<MessageSendInfo> {
 
-        firstly(on: .global()) { () -> MessageSendInfo in
+        firstly(on: MessageSender.taskQueue) { () -> MessageSendInfo in
             guard let localAddress = tsAccountManager.localAddress else {
                 throw OWSAssertionError("Missing localAddress.").asUnretryableError
             }
@@ -609,18 +762,18 @@ extension MessageSender {
             return MessageSendInfo(thread: thread,
                                    recipients: proposedRecipients,
                                    senderCertificates: senderCertificates)
-        }.then(on: .global()) { (sendInfo: MessageSendInfo) -> Promise<MessageSendInfo> in
+        }.then(on: MessageSender.taskQueue) { (sendInfo: MessageSendInfo) -> Promise<MessageSendInfo> in
             // We might need to use CDS to fill in missing UUIDs and/or identify
             // which recipients are unregistered.
-            return firstly(on: .global()) { () -> Promise<[SignalServiceAddress]> in
+            return firstly(on: MessageSender.taskQueue) { () -> Promise<[SignalServiceAddress]> in
                 Self.ensureRecipientAddresses(sendInfo.recipients, message: message)
-            }.map { (validRecipients: [SignalServiceAddress]) in
+            }.map(on: MessageSender.taskQueue) { (validRecipients: [SignalServiceAddress]) in
                 // Replace recipients with validRecipients.
                 MessageSendInfo(thread: sendInfo.thread,
                                 recipients: validRecipients,
                                 senderCertificates: sendInfo.senderCertificates)
             }
-        }.map(on: .global()) { (sendInfo: MessageSendInfo) -> MessageSendInfo in
+        }.map(on: MessageSender.taskQueue) { (sendInfo: MessageSendInfo) -> MessageSendInfo in
             // Mark skipped recipients as such.  We skip because:
             //
             // * Recipient is no longer in the group.
@@ -832,9 +985,13 @@ public extension MessageSender {
                                         udAccess: messageSend.udSendingAccess?.udAccess,
                                         canFailoverUDAuth: false)
 
+        let signpostId = Signposts.begin(.messageSendRequest, "\(message.timestamp)")
+
         // Client-side fanout can yield many
         firstly {
             requestMaker.makeRequest()
+        }.ensure(on: Self.completionQueue) {
+            Signposts.end(.messageSendRequest, signpostId)
         }.done(on: Self.completionQueue) { (result: RequestMakerResult) in
             self.messageSendDidSucceed(messageSend,
                                        deviceMessages: deviceMessages,
@@ -6,12 +6,15 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class MessageProcessingBatchController;
 @class OWSStorage;
 @class SDSAnyReadTransaction;
 @class SDSAnyWriteTransaction;
 @class SSKProtoEnvelope;
 
 extern NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue;
+// Posted when an app extension stops processing because it is running out of memory.
+extern NSNotificationName const kNSNotificationNameMessageProcessingDidPauseForMemory;
 
 @interface OWSMessageContentJob : BaseModel
 
@@ -65,14 +68,29 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:createdAt:envelopeD
 @property (nonatomic) BOOL shouldProcessDuringTests;
 #endif
 
+// Exposes the chosen batch size and per-batch latency for tuning.
+@property (nonatomic, readonly) MessageProcessingBatchController *batchController;
+
 - (void)enqueueEnvelopeData:(NSData *)envelopeData
               plaintextData:(NSData *_Nullable)plaintextData
             wasReceivedByUD:(BOOL)wasReceivedByUD
     serverDeliveryTimestamp:(uint64_t)serverDeliveryTimestamp
                 transaction:(SDSAnyWriteTransaction *)transaction;
 
+// Use this method when the parsed envelope is at hand, so that
+// it can be reused when the envelope is processed.
+- (void)enqueueEnvelope:(SSKProtoEnvelope *)envelope
+               envelopeData:(NSData *)envelopeData
+              plaintextData:(NSData *_Nullable)plaintextData
+            wasReceivedByUD:(BOOL)wasReceivedByUD
+    serverDeliveryTimestamp:(uint64_t)serverDeliveryTimestamp
+                transaction:(SDSAnyWriteTransaction *)transaction
+    NS_SWIFT_NAME(enqueue(envelope:envelopeData:plaintextData:wasReceivedByUD:serverDeliveryTimestamp:transaction:));
+
 - (BOOL)hasPendingJobsWithTransaction:(SDSAnyReadTransaction *)transaction;
 
+- (NSUInteger)queuedJobCountWithTransaction:(SDSAnyReadTransaction *)transaction;
+
 @end
 
 NS_ASSUME_NONNULL_END
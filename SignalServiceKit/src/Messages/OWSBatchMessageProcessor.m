@@ -21,6 +21,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
     = @"kNSNotificationNameMessageProcessingDidFlushQueue";
+NSNotificationName const kNSNotificationNameMessageProcessingDidPauseForMemory
+    = @"kNSNotificationNameMessageProcessingDidPauseForMemory";
 
 @implementation OWSMessageContentJob
 
@@ -112,6 +114,10 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
 @property (nonatomic, readonly) AnyMessageContentJobFinder *finder;
 @property (nonatomic) BOOL isDrainingQueue;
 @property (atomic) BOOL isAppInBackground;
+@property (atomic, nullable) NSDate *backgroundEntryDate;
+@property (nonatomic, readonly) MessageProcessingBatchController *batchController;
+// This property should only be accessed on serialQueue.
+@property (nonatomic) MemoryHeadroomLevel lastMemoryHeadroomLevel;
 
 #ifdef TESTABLE_BUILD
 @property (nonatomic) BOOL shouldProcessDuringTests;
@@ -133,7 +139,9 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
     }
 
     _finder = [AnyMessageContentJobFinder new];
+    _batchController = [MessageProcessingBatchController new];
     _isDrainingQueue = NO;
+    _lastMemoryHeadroomLevel = MemoryHeadroomLevelAmple;
 
     [[NSNotificationCenter defaultCenter] addObserver:self
                                              selector:@selector(applicationWillEnterForeground:)
@@ -198,13 +206,29 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
 - (void)applicationWillEnterForeground:(NSNotification *)notification
 {
     self.isAppInBackground = NO;
+    self.backgroundEntryDate = nil;
 }
 
 - (void)applicationDidEnterBackground:(NSNotification *)notification
 {
+    self.backgroundEntryDate = [NSDate new];
     self.isAppInBackground = YES;
 }
 
+// Returns a negative value if the app is in the foreground.
+- (NSTimeInterval)remainingBackgroundTime
+{
+    if (!self.isAppInBackground) {
+        return -1;
+    }
+    NSDate *_Nullable backgroundEntryDate = self.backgroundEntryDate;
+    if (backgroundEntryDate == nil) {
+        return 0;
+    }
+    NSTimeInterval elapsed = fabs(backgroundEntryDate.timeIntervalSinceNow);
+    return MAX(0, MessageProcessingBatchController.assumedBackgroundExecutionBudget - elapsed);
+}
+
 - (void)registrationStateDidChange:(NSNotification *)notification
 {
     OWSAssertIsOnMainThread();
@@ -246,6 +270,11 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
     return [self.finder jobCountWithTransaction:transaction] > 0;
 }
 
+- (NSUInteger)queuedJobCountWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    return [self.finder jobCountWithTransaction:transaction];
+}
+
 - (void)drainQueue
 {
     OWSAssertDebugUnlessRunningTests(AppReadiness.isAppReady);
@@ -286,15 +315,37 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
     }
 #endif
 
-    // We want a value that is just high enough to yield perf benefits.
-    const NSUInteger kIncomingMessageBatchSize = 32;
-    // If the app is in the background, use batch size of 1.
-    // This reduces the cost of being interrupted and rolled back if
-    // app is suspended.
-    NSUInteger batchSize = self.isAppInBackground ? 1 : kIncomingMessageBatchSize;
+    // Batches are sized from the queue depth, the measured cost of recent
+    // batches and, in the background, the remaining execution budget.
+    // Smaller background batches reduce the cost of being interrupted and
+    // rolled back if the app is suspended.
+    NSTimeInterval remainingBackgroundTime = self.remainingBackgroundTime;
+    BOOL isBackgroundBatch = remainingBackgroundTime >= 0;
+
+    // Batches also shrink as memory headroom drops. If an app extension
+    // (especially the NSE) runs out, it stops rather than risk being
+    // jetsammed mid-batch, which would roll back the batch. The remaining
+    // jobs are persisted, so the main app (or the next extension launch)
+    // will process them.
+    uint64_t availableMemory = MemoryHeadroom.availableMemory;
+    if ([self shouldPauseForMemoryWithAvailableMemory:availableMemory]) {
+        self.isDrainingQueue = NO;
+        [[NSNotificationCenter defaultCenter] postNotificationNameAsync:kNSNotificationNameMessageProcessingDidPauseForMemory
+                                                                 object:nil
+                                                               userInfo:nil];
+        return;
+    }
 
     __block NSArray<OWSMessageContentJob *> *batchJobs;
     [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+        NSUInteger queueDepth = [self.finder jobCountWithTransaction:transaction];
+        NSUInteger batchSize = [self.batchController nextBatchSizeWithQueueDepth:queueDepth
+                                                          remainingBackgroundTime:remainingBackgroundTime
+                                                                  availableMemory:availableMemory];
+        if (batchSize < 1) {
+            batchJobs = @[];
+            return;
+        }
         batchJobs = [self.finder nextJobsWithBatchSize:batchSize transaction:transaction];
     }];
     OWSAssertDebug(batchJobs);
@@ -315,24 +366,38 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
 
     __block NSArray<OWSMessageContentJob *> *processedJobs;
     __block NSUInteger jobCount;
+    NSDate *batchStartDate = [NSDate new];
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-        processedJobs = [self processJobs:batchJobs transaction:transaction];
+        // Apply the receipts for each outgoing message once per batch.
+        [OutgoingMessageReceiptAggregator aggregateReceiptsWithTransaction:transaction
+                                                                     block:^{
+                                                                         processedJobs = [self processJobs:batchJobs
+                                                                                         isBackgroundBatch:isBackgroundBatch
+                                                                                               transaction:transaction];
+                                                                     }];
         
         [self.finder removeJobsWithUniqueIds:processedJobs.uniqueIds transaction:transaction];
         
         jobCount = [self.finder jobCountWithTransaction:transaction];
     });
+    // This duration includes the cost of committing the transaction.
+    NSTimeInterval batchDuration = fabs(batchStartDate.timeIntervalSinceNow);
+    [self.pipelineSupervisor.timings recordProcessedEnvelopesVisible];
+    [self.batchController didCompleteBatchWithSize:processedJobs.count duration:batchDuration];
 
-    OWSLogVerbose(@"completed %lu/%lu jobs. %lu jobs left.",
+    OWSLogVerbose(@"completed %lu/%lu jobs in %0.1fms. %lu jobs left.",
         (unsigned long)processedJobs.count,
         (unsigned long)batchJobs.count,
+        batchDuration * 1000,
         (unsigned long)jobCount);
 
-    // Wait a bit in hopes of increasing the batch size.
+    // If only a few jobs are waiting, wait a bit in hopes of increasing the batch size.
     // This delay won't affect the first message to arrive when this queue is idle,
     // so by definition we're receiving more than one message and can benefit from
     // batching.
-    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.5f * NSEC_PER_SEC)), self.serialQueue, ^{
+    NSTimeInterval delay = [self.batchController delayBeforeNextBatchWithQueueDepth:jobCount
+                                                           remainingBackgroundTime:self.remainingBackgroundTime];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self.serialQueue, ^{
         [self drainQueueWorkStep];
 
         OWSAssertDebug(backgroundTask);
@@ -340,7 +405,30 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
     });
 }
 
+// Sheds memory when headroom drops and returns YES if this process
+// should stop processing for now.
+- (BOOL)shouldPauseForMemoryWithAvailableMemory:(uint64_t)availableMemory
+{
+    AssertOnDispatchQueue(self.serialQueue);
+
+    MemoryHeadroomLevel level = [MemoryHeadroom levelWithAvailableMemory:availableMemory];
+    MemoryHeadroomLevel lastLevel = self.lastMemoryHeadroomLevel;
+    self.lastMemoryHeadroomLevel = level;
+
+    if (level > lastLevel) {
+        OWSLogWarn(@"Memory headroom dropped to %llu bytes.", availableMemory);
+
+        // Only shed memory once per drop.
+        BOOL isCritical = level == MemoryHeadroomLevelExhausted;
+        dispatch_async(dispatch_get_main_queue(), ^{ [MemoryAccountant.shared shedMemoryWithIsCritical:isCritical]; });
+    }
+
+    // The main app's headroom is far larger; if it runs out, stopping won't help.
+    return level == MemoryHeadroomLevelExhausted && !CurrentAppContext().isMainApp;
+}
+
 - (NSArray<OWSMessageContentJob *> *)processJobs:(NSArray<OWSMessageContentJob *> *)jobs
+                               isBackgroundBatch:(BOOL)isBackgroundBatch
                                      transaction:(SDSAnyWriteTransaction *)transaction
 {
     OWSAssertDebug(jobs.count > 0);
@@ -348,6 +436,7 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
 
     NSMutableArray<OWSMessageContentJob *> *processedJobs = [NSMutableArray new];
     for (OWSMessageContentJob *job in jobs) {
+        uint64_t signpostId = [Signposts beginInterval:SignpostIntervalMessageProcess];
 
         void (^reportFailure)(SDSAnyWriteTransaction *transaction) = ^(SDSAnyWriteTransaction *transaction) {
             // TODO: Add analytics.
@@ -356,8 +445,13 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
                                                                                 transaction:transaction];
         };
 
-        SSKProtoEnvelope *_Nullable envelope = job.envelope;
+        // Reuse the envelope parsed by the decrypt stage, if possible.
+        NSError *_Nullable parseError;
+        SSKProtoEnvelope *_Nullable envelope =
+            [EnvelopeHandleCache.shared handleWithEnvelopeData:job.envelopeData consume:YES error:&parseError]
+                .envelope;
         if (!envelope) {
+            OWSFailDebug(@"failed to parse envelope with error: %@", parseError);
             reportFailure(transaction);
         } else if ([GroupsV2MessageProcessor isGroupsV2MessageWithEnvelope:envelope plaintextData:job.plaintextData]) {
             [self.groupsV2MessageProcessor enqueueWithEnvelopeData:job.envelopeData
@@ -375,14 +469,18 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
                 reportFailure(transaction);
             }
         }
+        if (envelope != nil) {
+            [self.pipelineSupervisor.timings recordStage:MessagePipelineTimingStageProcessed envelope:envelope];
+        }
         [processedJobs addObject:job];
+        [Signposts endInterval:SignpostIntervalMessageProcess signpostId:signpostId];
 
-        if (self.isAppInBackground) {
-            // If the app is in the background, stop processing this batch.
+        if (!isBackgroundBatch && self.isAppInBackground) {
+            // If the app entered the background, stop processing this batch,
+            // which was sized for the foreground.
             //
-            // Since this check is done after processing jobs, we'll continue
-            // to process jobs in batches of 1.  This reduces the cost of
-            // being interrupted and rolled back if app is suspended.
+            // Subsequent batches will be sized for the background.  This reduces
+            // the cost of being interrupted and rolled back if app is suspended.
             break;
         }
     }
@@ -428,6 +526,11 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
 
 #pragma mark - instance methods
 
+- (MessageProcessingBatchController *)batchController
+{
+    return self.processingQueue.batchController;
+}
+
 - (void)enqueueEnvelopeData:(NSData *)envelopeData
               plaintextData:(NSData *_Nullable)plaintextData
             wasReceivedByUD:(BOOL)wasReceivedByUD
@@ -455,11 +558,36 @@ NSNotificationName const kNSNotificationNameMessageProcessingDidFlushQueue
                                        }];
 }
 
+- (void)enqueueEnvelope:(SSKProtoEnvelope *)envelope
+               envelopeData:(NSData *)envelopeData
+              plaintextData:(NSData *_Nullable)plaintextData
+            wasReceivedByUD:(BOOL)wasReceivedByUD
+    serverDeliveryTimestamp:(uint64_t)serverDeliveryTimestamp
+                transaction:(SDSAnyWriteTransaction *)transaction
+{
+    OWSAssertDebug(envelope);
+
+    [EnvelopeHandleCache.shared add:[[EnvelopeHandle alloc] initWithEnvelopeData:envelopeData envelope:envelope]];
+    [SSKEnvironment.shared.messagePipelineSupervisor.timings recordStage:MessagePipelineTimingStageDecrypted
+                                                                envelope:envelope];
+
+    [self enqueueEnvelopeData:envelopeData
+                plaintextData:plaintextData
+              wasReceivedByUD:wasReceivedByUD
+      serverDeliveryTimestamp:serverDeliveryTimestamp
+                  transaction:transaction];
+}
+
 - (BOOL)hasPendingJobsWithTransaction:(SDSAnyReadTransaction *)transaction
 {
     return [self.processingQueue hasPendingJobsWithTransaction:transaction];
 }
 
+- (NSUInteger)queuedJobCountWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    return [self.processingQueue queuedJobCountWithTransaction:transaction];
+}
+
 #ifdef TESTABLE_BUILD
 - (void)setShouldProcessDuringTests:(BOOL)shouldProcessDuringTests
 {
@@ -20,6 +20,26 @@ typedef NS_CLOSED_ENUM(NSUInteger, BlockMode) {
     BlockMode_LocalShouldNotLeaveGroups,
 };
 
+// An immutable copy of the block list state.
+//
+// OWSBlockingManager publishes a new snapshot whenever the block list
+// changes, so lookups against a snapshot don't need to take any lock.
+@interface OWSBlockListSnapshot : NSObject
+
+@property (nonatomic, readonly) NSSet<NSString *> *blockedPhoneNumberSet;
+@property (nonatomic, readonly) NSSet<NSString *> *blockedUUIDSet;
+@property (nonatomic, readonly) NSDictionary<NSData *, TSGroupModel *> *blockedGroupMap;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (BOOL)isAddressBlocked:(SignalServiceAddress *)address;
+- (BOOL)isGroupIdBlocked:(NSData *)groupId;
+- (BOOL)isThreadBlocked:(TSThread *)thread;
+
+@end
+
+#pragma mark -
+
 // This class can be safely accessed and used from any thread.
 @interface OWSBlockingManager : NSObject
 
@@ -46,6 +66,10 @@ typedef NS_CLOSED_ENUM(NSUInteger, BlockMode) {
                                    blockedGroupIds:(nullable NSSet<NSData *> *)blockedGroupIds
                                        transaction:(SDSAnyWriteTransaction *)transaction;
 
+// The current state of the block list. Prefer this over the other accessors
+// when doing many lookups, e.g. for every incoming envelope.
+@property (readonly) OWSBlockListSnapshot *blockListSnapshot;
+
 @property (readonly) NSSet<SignalServiceAddress *> *blockedAddresses;
 @property (readonly) NSArray<NSString *> *blockedPhoneNumbers;
 @property (readonly) NSArray<NSString *> *blockedUUIDs;
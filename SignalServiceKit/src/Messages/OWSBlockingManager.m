@@ -28,6 +28,58 @@ NSString *const kOWSBlockingManager_SyncedBlockedPhoneNumbersKey = @"kOWSBlockin
 NSString *const kOWSBlockingManager_SyncedBlockedUUIDsKey = @"kOWSBlockingManager_SyncedBlockedUUIDsKey";
 NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingManager_SyncedBlockedGroupIdsKey";
 
+@implementation OWSBlockListSnapshot
+
+- (instancetype)initWithBlockedPhoneNumberSet:(NSSet<NSString *> *)blockedPhoneNumberSet
+                               blockedUUIDSet:(NSSet<NSString *> *)blockedUUIDSet
+                              blockedGroupMap:(NSDictionary<NSData *, TSGroupModel *> *)blockedGroupMap
+{
+    self = [super init];
+
+    if (!self) {
+        return self;
+    }
+
+    _blockedPhoneNumberSet = [blockedPhoneNumberSet copy];
+    _blockedUUIDSet = [blockedUUIDSet copy];
+    _blockedGroupMap = [blockedGroupMap copy];
+
+    return self;
+}
+
+- (BOOL)isAddressBlocked:(SignalServiceAddress *)address
+{
+    NSString *_Nullable phoneNumber = address.phoneNumber;
+    if (phoneNumber != nil && [self.blockedPhoneNumberSet containsObject:phoneNumber]) {
+        return YES;
+    }
+    NSString *_Nullable uuidString = address.uuidString;
+    return uuidString != nil && [self.blockedUUIDSet containsObject:uuidString];
+}
+
+- (BOOL)isGroupIdBlocked:(NSData *)groupId
+{
+    return self.blockedGroupMap[groupId] != nil;
+}
+
+- (BOOL)isThreadBlocked:(TSThread *)thread
+{
+    if ([thread isKindOfClass:[TSContactThread class]]) {
+        TSContactThread *contactThread = (TSContactThread *)thread;
+        return [self isAddressBlocked:contactThread.contactAddress];
+    } else if ([thread isKindOfClass:[TSGroupThread class]]) {
+        TSGroupThread *groupThread = (TSGroupThread *)thread;
+        return [self isGroupIdBlocked:groupThread.groupModel.groupId];
+    } else {
+        OWSFailDebug(@"%@ failure unexpected thread type", self.logTag);
+        return NO;
+    }
+}
+
+@end
+
+#pragma mark -
+
 @interface OWSBlockingManager ()
 
 // We don't store the phone numbers as instances of PhoneNumber to avoid
@@ -37,6 +89,11 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 @property (atomic, readonly) NSMutableSet<NSString *> *blockedUUIDSet;
 @property (atomic, readonly) NSMutableDictionary<NSData *, TSGroupModel *> *blockedGroupMap;
 
+// The mutable state above is only accessed by writers, within a synchronized
+// block. Readers use this snapshot of it instead, which is replaced (never
+// mutated) after every change.
+@property (atomic, nullable) OWSBlockListSnapshot *latestBlockListSnapshot;
+
 @end
 
 #pragma mark -
@@ -126,6 +183,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
         // Clear out so we re-initialize if we ever re-run the "on launch" logic,
         // such as after a completed database transfer.
         _blockedPhoneNumberSet = nil;
+        self.latestBlockListSnapshot = nil;
 
         [self ensureLazyInitialization];
     }
@@ -138,20 +196,34 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 
 #pragma mark -
 
-- (BOOL)isThreadBlocked:(TSThread *)thread
+- (OWSBlockListSnapshot *)blockListSnapshot
 {
-    if ([thread isKindOfClass:[TSContactThread class]]) {
-        TSContactThread *contactThread = (TSContactThread *)thread;
-        return [self isAddressBlocked:contactThread.contactAddress];
-    } else if ([thread isKindOfClass:[TSGroupThread class]]) {
-        TSGroupThread *groupThread = (TSGroupThread *)thread;
-        return [self isGroupIdBlocked:groupThread.groupModel.groupId];
-    } else {
-        OWSFailDebug(@"%@ failure unexpected thread type", self.logTag);
-        return NO;
+    OWSBlockListSnapshot *_Nullable snapshot = self.latestBlockListSnapshot;
+    if (snapshot != nil) {
+        return snapshot;
+    }
+
+    @synchronized(self) {
+        [self ensureLazyInitialization];
+
+        return self.latestBlockListSnapshot;
     }
 }
 
+// This method should only be called from within a synchronized block,
+// after any change to the block list.
+- (void)updateBlockListSnapshot
+{
+    self.latestBlockListSnapshot = [[OWSBlockListSnapshot alloc] initWithBlockedPhoneNumberSet:_blockedPhoneNumberSet
+                                                                                blockedUUIDSet:_blockedUUIDSet
+                                                                               blockedGroupMap:_blockedGroupMap];
+}
+
+- (BOOL)isThreadBlocked:(TSThread *)thread
+{
+    return [self.blockListSnapshot isThreadBlocked:thread];
+}
+
 #pragma mark - Contact Blocking
 
 - (NSSet<SignalServiceAddress *> *)blockedAddresses
@@ -190,6 +262,10 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
             didChange = YES;
             [_blockedUUIDSet addObject:address.uuidString];
         }
+
+        if (didChange) {
+            [self updateBlockListSnapshot];
+        }
     }
 
     BOOL wasLocallyInitiated = [self wasLocallyInitiatedWithBlockMode:blockMode];
@@ -242,6 +318,10 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
             didChange = YES;
             [_blockedUUIDSet removeObject:address.uuidString];
         }
+
+        if (didChange) {
+            [self updateBlockListSnapshot];
+        }
     }
 
     // The block state changed, schedule a backup with the storage service
@@ -322,6 +402,8 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
             return;
         }
 
+        [self updateBlockListSnapshot];
+
         oldGroupMap = [self.blockedGroupMap copy];
     }
 
@@ -361,6 +443,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 
         @synchronized(self) {
             _blockedGroupMap = newGroupMap;
+            [self updateBlockListSnapshot];
         }
     }
 
@@ -369,61 +452,43 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 
 - (NSArray<NSString *> *)blockedPhoneNumbers
 {
-    @synchronized(self)
-    {
-        [self ensureLazyInitialization];
-
-        return [_blockedPhoneNumberSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
-    }
+    return [self.blockListSnapshot.blockedPhoneNumberSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
 }
 
 - (NSArray<NSString *> *)blockedUUIDs
 {
-    @synchronized(self) {
-        [self ensureLazyInitialization];
-
-        return [_blockedUUIDSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
-    }
+    return [self.blockListSnapshot.blockedUUIDSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
 }
 
 - (BOOL)isAddressBlocked:(SignalServiceAddress *)address
 {
     OWSAssertDebug(self.isInitialized);
 
-    return [self.blockedPhoneNumbers containsObject:address.phoneNumber] ||
-        [self.blockedUUIDs containsObject:address.uuidString];
+    return [self.blockListSnapshot isAddressBlocked:address];
 }
 
 #pragma mark - Group Blocking
 
 - (NSArray<NSData *> *)blockedGroupIds
 {
-    @synchronized(self) {
-        [self ensureLazyInitialization];
-        return self.blockedGroupMap.allKeys;
-    }
+    return self.blockListSnapshot.blockedGroupMap.allKeys;
 }
 
 - (NSArray<TSGroupModel *> *)blockedGroups
 {
-    @synchronized(self) {
-        [self ensureLazyInitialization];
-        return self.blockedGroupMap.allValues;
-    }
+    return self.blockListSnapshot.blockedGroupMap.allValues;
 }
 
 - (BOOL)isGroupIdBlocked:(NSData *)groupId
 {
     OWSAssertDebug(self.isInitialized);
 
-    return self.blockedGroupMap[groupId] != nil;
+    return [self.blockListSnapshot isGroupIdBlocked:groupId];
 }
 
 - (nullable TSGroupModel *)cachedGroupDetailsWithGroupId:(NSData *)groupId
 {
-    @synchronized(self) {
-        return self.blockedGroupMap[groupId];
-    }
+    return self.blockListSnapshot.blockedGroupMap[groupId];
 }
 
 - (void)addBlockedGroup:(TSGroupModel *)groupModel blockMode:(BlockMode)blockMode
@@ -442,6 +507,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
         }
 
         self.blockedGroupMap[groupId] = groupModel;
+        [self updateBlockListSnapshot];
     }
 
     // Open a sneaky transaction and quit the group if we're a member
@@ -498,6 +564,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 
         if (groupThread != nil) {
             self.blockedGroupMap[groupId] = groupThread.groupModel;
+            [self updateBlockListSnapshot];
         } else {
             OWSFailDebug(@"missing group thread");
         }
@@ -527,6 +594,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
         TSGroupModel *_Nullable groupModel = self.blockedGroupMap[groupId];
 
         [self.blockedGroupMap removeObjectForKey:groupId];
+        [self updateBlockListSnapshot];
 
         if (wasLocallyInitiated && groupModel != nil) {
             [self.storageServiceManager recordPendingUpdatesWithGroupModel:groupModel];
@@ -553,6 +621,7 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
         }
 
         [self.blockedGroupMap removeObjectForKey:groupId];
+        [self updateBlockListSnapshot];
     }
 
     [self handleUpdateAndSendSyncMessage:wasLocallyInitiated transaction:transaction];
@@ -628,13 +697,13 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
 
 - (void)handleUpdateAndSendSyncMessage:(BOOL)sendSyncMessage transaction:(SDSAnyWriteTransaction *)transaction
 {
-    NSArray<NSString *> *blockedPhoneNumbers = [self blockedPhoneNumbers];
-    NSArray<NSString *> *blockedUUIDs = [self blockedUUIDs];
+    OWSBlockListSnapshot *snapshot = self.blockListSnapshot;
+    NSArray<NSString *> *blockedPhoneNumbers =
+        [snapshot.blockedPhoneNumberSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
+    NSArray<NSString *> *blockedUUIDs =
+        [snapshot.blockedUUIDSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
 
-    NSDictionary<NSData *, TSGroupModel *> *blockedGroupMap;
-    @synchronized(self) {
-        blockedGroupMap = [self.blockedGroupMap copy];
-    }
+    NSDictionary<NSData *, TSGroupModel *> *blockedGroupMap = snapshot.blockedGroupMap;
     NSArray<NSData *> *blockedGroupIds = blockedGroupMap.allKeys;
 
     [OWSBlockingManager.keyValueStore setObject:blockedPhoneNumbers
@@ -715,6 +784,8 @@ NSString *const kOWSBlockingManager_SyncedBlockedGroupIdsKey = @"kOWSBlockingMan
         _blockedGroupMap = [NSMutableDictionary new];
     }
 
+    [self updateBlockListSnapshot];
+
     [self syncBlockListIfNecessary];
     [self observeNotifications];
 }
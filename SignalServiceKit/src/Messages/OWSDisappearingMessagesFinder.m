@@ -85,24 +85,7 @@ static NSString *const OWSDisappearingMessageFinderExpiresAtIndex = @"index_mess
 {
     OWSAssertDebug(transaction);
 
-    __block TSMessage *firstMessage;
-    [InteractionFinder
-        enumerateMessagesWithStartedPerConversationExpirationWithTransaction:transaction
-                                                                       block:^(TSInteraction *interaction, BOOL *stop) {
-                                                                           if (![interaction
-                                                                                   isKindOfClass:[TSMessage class]]) {
-                                                                               OWSFailDebug(@"Unexpected object: %@",
-                                                                                   interaction.class);
-                                                                               return;
-                                                                           }
-                                                                           firstMessage = (TSMessage *)interaction;
-                                                                           *stop = YES;
-                                                                       }];
-    if (firstMessage && firstMessage.expiresAt > 0) {
-        return [NSNumber numberWithUnsignedLongLong:firstMessage.expiresAt];
-    }
-
-    return nil;
+    return [InteractionFinder nextExpirationTimestampWithTransaction:transaction];
 }
 
 + (void)ydb_enumerateMessagesWithStartedPerConversationExpirationWithBlock:(void (^_Nonnull)(
@@ -21,6 +21,10 @@ NS_ASSUME_NONNULL_BEGIN
                  expirationStartedAt:(uint64_t)expirationStartedAt
                          transaction:(SDSAnyWriteTransaction *_Nonnull)transaction;
 
+// Should be called whenever a message whose expiration has started is written,
+// so that the job can delete it without re-querying the database.
+- (void)trackExpiringMessage:(TSMessage *)message;
+
 // Clean up any messages that expired since last launch immediately
 // and continue cleaning in the background.
 - (void)startIfNecessary;
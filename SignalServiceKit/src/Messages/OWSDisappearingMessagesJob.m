@@ -23,6 +23,7 @@ NS_ASSUME_NONNULL_BEGIN
 @interface OWSDisappearingMessagesJob ()
 
 @property (nonatomic, readonly) OWSDisappearingMessagesFinder *disappearingMessagesFinder;
+@property (nonatomic, readonly) DisappearingMessagesExpirationWheel *expirationWheel;
 
 + (dispatch_queue_t)serialQueue;
 
@@ -32,6 +33,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, nullable) NSDate *nextDisappearanceDate;
 @property (nonatomic, nullable) NSTimer *fallbackTimer;
 
+// Should only be accessed while synchronized on the OWSDisappearingMessagesJob.
+@property (nonatomic, nullable) NSDate *pendingRunDate;
+
 @end
 
 void AssertIsOnDisappearingMessagesQueue()
@@ -60,6 +64,7 @@ void AssertIsOnDisappearingMessagesQueue()
     }
 
     _disappearingMessagesFinder = [OWSDisappearingMessagesFinder new];
+    _expirationWheel = [DisappearingMessagesExpirationWheel new];
 
     // suspenders in case a deletion schedule is missed.
     NSTimeInterval kFallBackTimerInterval = 5 * kMinuteInterval;
@@ -83,6 +88,10 @@ void AssertIsOnDisappearingMessagesQueue()
                                              selector:@selector(applicationWillResignActive:)
                                                  name:OWSApplicationWillResignActiveNotification
                                                object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(databaseDidReceiveCrossProcessNotification:)
+                                                 name:SDSDatabaseStorage.didReceiveCrossProcessNotification
+                                               object:nil];
 
     return self;
 }
@@ -124,6 +133,17 @@ void AssertIsOnDisappearingMessagesQueue()
 
     __block NSUInteger expirationCount = 0;
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+        uint64_t nowMs = [NSDate ows_millisecondTimeStamp];
+        if ([self.expirationWheel needsLoadWithNowMs:nowMs]) {
+            [self.expirationWheel loadWithNowMs:nowMs transaction:transaction];
+        }
+        if (self.expirationWheel.isLoaded) {
+            expirationCount = [self deleteExpiredMessagesFromWheelWithNowMs:nowMs transaction:transaction];
+            return;
+        }
+
+        // We couldn't fill the wheel; query the database instead.
+
         [self.disappearingMessagesFinder enumerateExpiredMessagesWithBlock:^(TSMessage *message) {
             // We want to compute `now` *after* our finder fetches results.
             // Otherwise, if we computed it before the finder, and a message had expired in the tiny
@@ -151,6 +171,34 @@ void AssertIsOnDisappearingMessagesQueue()
     return expirationCount;
 }
 
+// Deletes the messages in the expiration wheel that are due, in a single transaction.
+- (NSUInteger)deleteExpiredMessagesFromWheelWithNowMs:(uint64_t)now transaction:(SDSAnyWriteTransaction *)transaction
+{
+    AssertIsOnDisappearingMessagesQueue();
+
+    NSUInteger expirationCount = 0;
+    for (NSString *messageId in [self.expirationWheel popExpiredMessageIdsWithNowMs:now]) {
+        TSMessage *_Nullable message = [TSMessage anyFetchMessageWithUniqueId:messageId transaction:transaction];
+        if (message == nil) {
+            // The message was deleted after its expiration started.
+            continue;
+        }
+        if (message.expiresAt == 0) {
+            continue;
+        }
+        if (message.expiresAt > now) {
+            // The message's expiration changed after it was tracked.
+            [self.expirationWheel trackMessageWithUniqueId:message.uniqueId expiresAt:message.expiresAt];
+            continue;
+        }
+
+        OWSLogInfo(@"Removing message which expired at: %lld", message.expiresAt);
+        [message anyRemoveWithTransaction:transaction];
+        expirationCount++;
+    }
+    return expirationCount;
+}
+
 // deletes any expired messages and schedules the next run.
 - (NSUInteger)runLoop
 {
@@ -159,11 +207,15 @@ void AssertIsOnDisappearingMessagesQueue()
 
     NSUInteger deletedCount = [self deleteExpiredMessages];
 
-    __block NSNumber *nextExpirationTimestampNumber;
-    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
-        nextExpirationTimestampNumber =
-            [self.disappearingMessagesFinder nextExpirationTimestampWithTransaction:transaction];
-    }];
+    __block NSNumber *_Nullable nextExpirationTimestampNumber;
+    if (self.expirationWheel.isLoaded) {
+        nextExpirationTimestampNumber = self.expirationWheel.nextExpirationTimestamp;
+    } else {
+        [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+            nextExpirationTimestampNumber =
+                [self.disappearingMessagesFinder nextExpirationTimestampWithTransaction:transaction];
+        }];
+    }
 
     if (!nextExpirationTimestampNumber) {
         OWSLogDebug(@"No more expiring messages.");
@@ -202,6 +254,14 @@ void AssertIsOnDisappearingMessagesQueue()
     }];
 }
 
+- (void)trackExpiringMessage:(TSMessage *)message
+{
+    if (message.expiresAt == 0) {
+        return;
+    }
+    [self.expirationWheel trackMessageWithUniqueId:message.uniqueId expiresAt:message.expiresAt];
+}
+
 #pragma mark -
 
 - (void)startIfNecessary
@@ -220,7 +280,21 @@ void AssertIsOnDisappearingMessagesQueue()
             DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
                 [self cleanupMessagesWhichFailedToStartExpiringWithTransaction:transaction];
             });
-            
+
+            [self.expirationWheel reset];
+            [self runLoop];
+        });
+    }];
+}
+
+// Expirations can be started outside of this process (e.g. by the NSE or
+// the share extension), without the wheel tracking them, so we refill the
+// wheel from the database whenever that might have happened.
+- (void)scheduleReloadAndPass
+{
+    [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{
+        dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{
+            [self.expirationWheel reset];
             [self runLoop];
         });
     }];
@@ -256,11 +330,31 @@ void AssertIsOnDisappearingMessagesQueue()
     return dateFormatter;
 }
 
-- (void)scheduleRunByDate:(NSDate *)date
+- (void)scheduleRunByDate:(NSDate *)requestedDate
 {
-    OWSAssertDebug(date);
+    OWSAssertDebug(requestedDate);
+
+    // Expiration can start for many messages at once, e.g. when a linked device
+    // reads a backlog of messages. Rather than scheduling a run for each of them,
+    // coalesce them into a single run by the earliest date.
+    @synchronized(self) {
+        BOOL isRunPending = self.pendingRunDate != nil;
+        if (!isRunPending || [requestedDate isBeforeDate:self.pendingRunDate]) {
+            self.pendingRunDate = requestedDate;
+        }
+        if (isRunPending) {
+            return;
+        }
+    }
 
     dispatch_async(dispatch_get_main_queue(), ^{
+        NSDate *date;
+        @synchronized(self) {
+            date = self.pendingRunDate;
+            self.pendingRunDate = nil;
+        }
+        OWSAssertDebug(date);
+
         if (!CurrentAppContext().isMainAppAndActive) {
             // Don't schedule run when inactive or not in main app.
             return;
@@ -329,14 +423,21 @@ void AssertIsOnDisappearingMessagesQueue()
 
     [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{
         dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{
+            // Refill the expiration wheel from the database, in case it missed
+            // a message whose expiration started.
+            [self.expirationWheel reset];
+
             NSUInteger deletedCount = [self runLoop];
 
             // Normally deletions should happen via the disappearanceTimer, to make sure that they're prompt.
             // So, if we're deleting something via this fallback timer, something may have gone wrong. The
             // exception is if we're in close proximity to the disappearanceTimer, in which case a race condition
             // is inevitable.
+            //
+            // Messages whose expiration was started without the wheel tracking it can
+            // still be missed until the wheel is reloaded, so this isn't a failure.
             if (!recentlyScheduledDisappearanceTimer && deletedCount > 0) {
-                OWSFailDebug(@"unexpectedly deleted disappearing messages via fallback timer.");
+                OWSLogWarn(@"Deleted %lu disappearing messages via fallback timer.", (unsigned long)deletedCount);
             }
         });
     }];
@@ -383,11 +484,14 @@ void AssertIsOnDisappearingMessagesQueue()
 {
     OWSAssertIsOnMainThread();
 
-    [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{
-        dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{
-            [self runLoop];
-        });
-    }];
+    [self scheduleReloadAndPass];
+}
+
+- (void)databaseDidReceiveCrossProcessNotification:(NSNotification *)notification
+{
+    OWSAssertIsOnMainThread();
+
+    [self scheduleReloadAndPass];
 }
 
 - (void)applicationWillResignActive:(NSNotification *)notification
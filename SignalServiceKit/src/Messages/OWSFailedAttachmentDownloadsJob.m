@@ -45,14 +45,14 @@ static NSString *const OWSFailedAttachmentDownloadsJobAttachmentStateIndex = @"i
     return [attachmentIds copy];
 }
 
-- (void)enumerateAttemptingOutAttachmentsWithBlock:(void (^_Nonnull)(TSAttachmentPointer *attachment))block
-                                       transaction:(SDSAnyReadTransaction *)transaction
+- (void)enumerateAttemptingOutAttachmentsWithIds:(NSArray<NSString *> *)attachmentIds
+                                          block:(void (^_Nonnull)(TSAttachmentPointer *attachment))block
+                                    transaction:(SDSAnyReadTransaction *)transaction
 {
     OWSAssertDebug(transaction);
 
     // Since we can't directly mutate the enumerated attachments, we store only their ids in hopes
     // of saving a little memory and then enumerate the (larger) TSAttachment objects one at a time.
-    NSArray<NSString *> *attachmentIds = [AttachmentFinder unfailedAttachmentPointerIdsWithTransaction:transaction];
     for (NSString *attachmentId in attachmentIds) {
         TSAttachmentPointer *_Nullable attachment =
             [TSAttachmentPointer anyFetchAttachmentPointerWithUniqueId:attachmentId transaction:transaction];
@@ -66,37 +66,50 @@ static NSString *const OWSFailedAttachmentDownloadsJobAttachmentStateIndex = @"i
 
 - (void)runSync
 {
+    __block NSArray<NSString *> *attachmentIds;
+    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+        attachmentIds = [AttachmentFinder unfailedAttachmentPointerIdsWithTransaction:transaction];
+    }];
+
     __block uint count = 0;
-    DatabaseStorageWrite(
-        self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-            [self enumerateAttemptingOutAttachmentsWithBlock:^(TSAttachmentPointer *attachment) {
-                // sanity check
-                if (attachment.state == TSAttachmentPointerStateFailed) {
-                    OWSFailDebug(@"Attachment has unexpected state.");
-                    return;
-                }
-
-                switch (attachment.state) {
-                    case TSAttachmentPointerStateFailed:
-                        OWSFailDebug(@"Attachment has unexpected state.");
-                        break;
-                    case TSAttachmentPointerStatePendingMessageRequest:
-                        // Do nothing. We don't want to mark this attachment as failed.
-                        // It will be updated when the message request is resolved.
-                        break;
-                    case TSAttachmentPointerStateEnqueued:
-                    case TSAttachmentPointerStateDownloading:
-                        [attachment updateWithAttachmentPointerState:TSAttachmentPointerStateFailed
-                                                         transaction:transaction];
-                        count++;
-                        return;
-                    case TSAttachmentPointerStatePendingManualDownload:
-                        // Do nothing. We don't want to mark this attachment as failed.
-                        break;
-                }
-            }
-                                                 transaction:transaction];
+
+    // Mark the attachments in batches so that we don't hold the write lock
+    // for long if many downloads were interrupted.
+    const NSUInteger maxBatchSize = 500;
+    while (attachmentIds.count > 0) {
+        NSUInteger batchSize = MIN(attachmentIds.count, maxBatchSize);
+        NSArray<NSString *> *batch = [attachmentIds subarrayWithRange:NSMakeRange(0, batchSize)];
+        attachmentIds = [attachmentIds subarrayWithRange:NSMakeRange(batchSize, attachmentIds.count - batchSize)];
+        DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+            [self enumerateAttemptingOutAttachmentsWithIds:batch
+                                                     block:^(TSAttachmentPointer *attachment) {
+                                                         switch (attachment.state) {
+                                                             case TSAttachmentPointerStateFailed:
+                                                                 // The attachment's state may have changed since
+                                                                 // we fetched its id.
+                                                                 break;
+                                                             case TSAttachmentPointerStatePendingMessageRequest:
+                                                                 // Do nothing. We don't want to mark this attachment
+                                                                 // as failed. It will be updated when the message
+                                                                 // request is resolved.
+                                                                 break;
+                                                             case TSAttachmentPointerStateEnqueued:
+                                                             case TSAttachmentPointerStateDownloading:
+                                                                 [attachment
+                                                                     updateWithAttachmentPointerState:
+                                                                         TSAttachmentPointerStateFailed
+                                                                                          transaction:transaction];
+                                                                 count++;
+                                                                 return;
+                                                             case TSAttachmentPointerStatePendingManualDownload:
+                                                                 // Do nothing. We don't want to mark this attachment
+                                                                 // as failed.
+                                                                 break;
+                                                         }
+                                                     }
+                                               transaction:transaction];
         });
+    }
 
     if (count > 0) {
         OWSLogDebug(@"Marked %u attachments as failed", count);
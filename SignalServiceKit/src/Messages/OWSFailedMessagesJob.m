@@ -52,14 +52,15 @@ static NSString *const OWSFailedMessagesJobMessageStateIndex = @"index_outoing_m
     return [messageIds copy];
 }
 
-- (void)enumerateAttemptingOutMessagesWithBlock:(void (^_Nonnull)(TSOutgoingMessage *message))block
-                                    transaction:(SDSAnyReadTransaction *)transaction
+- (void)enumerateAttemptingOutMessagesWithIds:(NSArray<NSString *> *)messageIds
+                                        block:(void (^_Nonnull)(TSOutgoingMessage *message))block
+                                  transaction:(SDSAnyReadTransaction *)transaction
 {
     OWSAssertDebug(transaction);
 
     // Since we can't directly mutate the enumerated "attempting out" expired messages, we store only their ids in hopes
     // of saving a little memory and then enumerate the (larger) TSMessage objects one at a time.
-    for (NSString *expiredMessageId in [self fetchAttemptingOutMessageIdsWithTransaction:transaction]) {
+    for (NSString *expiredMessageId in messageIds) {
         TSOutgoingMessage *_Nullable message =
             [TSOutgoingMessage anyFetchOutgoingMessageWithUniqueId:expiredMessageId transaction:transaction];
         if (message == nil) {
@@ -72,26 +73,44 @@ static NSString *const OWSFailedMessagesJobMessageStateIndex = @"index_outoing_m
 
 - (void)runSync
 {
+    __block NSArray<NSString *> *messageIds;
+    [self.databaseStorage readWithBlock:^(SDSAnyReadTransaction *transaction) {
+        messageIds = [self fetchAttemptingOutMessageIdsWithTransaction:transaction];
+    }];
+
     __block uint count = 0;
 
-    DatabaseStorageWrite(
-        self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-            [self enumerateAttemptingOutMessagesWithBlock:^(TSOutgoingMessage *message) {
-                // sanity check
-                OWSAssertDebug(message.messageState == TSOutgoingMessageStateSending);
-                if (message.messageState != TSOutgoingMessageStateSending) {
-                    OWSLogError(@"Refusing to mark as unsent message with state: %d", (int)message.messageState);
-                    return;
-                }
-
-                OWSLogDebug(@"marking message as unsent: %@", message.uniqueId);
-                [message updateWithAllSendingRecipientsMarkedAsFailedWithTansaction:transaction];
-                OWSAssertDebug(message.messageState == TSOutgoingMessageStateFailed);
-
-                count++;
-            }
-                                              transaction:transaction];
+    // Mark the messages in batches so that we don't hold the write lock
+    // for long if many sends were interrupted.
+    const NSUInteger maxBatchSize = 500;
+    while (messageIds.count > 0) {
+        NSUInteger batchSize = MIN(messageIds.count, maxBatchSize);
+        NSArray<NSString *> *batch = [messageIds subarrayWithRange:NSMakeRange(0, batchSize)];
+        messageIds = [messageIds subarrayWithRange:NSMakeRange(batchSize, messageIds.count - batchSize)];
+        DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+            [self enumerateAttemptingOutMessagesWithIds:batch
+                                                  block:^(TSOutgoingMessage *message) {
+                                                      // sanity check
+                                                      if (message.messageState != TSOutgoingMessageStateSending) {
+                                                          // The message's state may have changed since we
+                                                          // fetched its id.
+                                                          OWSLogError(@"Refusing to mark as unsent message with state: %d",
+                                                              (int)message.messageState);
+                                                          return;
+                                                      }
+
+                                                      OWSLogDebug(@"marking message as unsent: %@", message.uniqueId);
+                                                      [message
+                                                          updateWithAllSendingRecipientsMarkedAsFailedWithTansaction:
+                                                              transaction];
+                                                      OWSAssertDebug(
+                                                          message.messageState == TSOutgoingMessageStateFailed);
+
+                                                      count++;
+                                                  }
+                                            transaction:transaction];
         });
+    }
 
     OWSLogDebug(@"Marked %u messages as unsent", count);
 }
@@ -10,6 +10,7 @@
 #import "NotificationsProtocol.h"
 #import "OWSError.h"
 #import "OWSFileSystem.h"
+#import "OWSFingerprint.h"
 #import "OWSOutgoingNullMessage.h"
 #import "OWSRecipientIdentity.h"
 #import "OWSVerificationStateChangeMessage.h"
@@ -252,6 +253,7 @@ NSNotificationName const kNSNotificationNameIdentityStateDidChange = @"kNSNotifi
         [self clearSyncMessageForAccountId:accountId transaction:transaction];
 
         [self fireIdentityStateChangeNotificationAfterTransaction:transaction];
+        [self prewarmFingerprintForAccountId:accountId identityKey:identityKey transaction:transaction];
 
         // Identity key was created, schedule a social graph backup
         [self.storageServiceManager recordPendingUpdatesWithUpdatedAccountIds:@[ accountId ]];
@@ -289,6 +291,7 @@ NSNotificationName const kNSNotificationNameIdentityStateDidChange = @"kNSNotifi
         [self clearSyncMessageForAccountId:accountId transaction:transaction];
 
         [self fireIdentityStateChangeNotificationAfterTransaction:transaction];
+        [self prewarmFingerprintForAccountId:accountId identityKey:identityKey transaction:transaction];
 
         // Identity key was changed, schedule a social graph backup
         [self.storageServiceManager recordPendingUpdatesWithUpdatedAccountIds:@[ accountId ]];
@@ -459,6 +462,31 @@ NSNotificationName const kNSNotificationNameIdentityStateDidChange = @"kNSNotifi
     }];
 }
 
+// Safety numbers take thousands of hash iterations to compute, so we compute
+// them in the background as soon as we learn a new identity key. OWSFingerprint
+// caches the result by identity key, so the safety number screen doesn't have
+// to compute them on the main thread.
+- (void)prewarmFingerprintForAccountId:(NSString *)accountId
+                           identityKey:(NSData *)identityKey
+                           transaction:(SDSAnyWriteTransaction *)transaction
+{
+    SignalServiceAddress *_Nullable localAddress = [self.tsAccountManager localAddress];
+    NSData *_Nullable localIdentityKey = [self identityKeyPairWithTransaction:transaction].publicKey;
+    SignalServiceAddress *_Nullable address = [[OWSAccountIdFinder new] addressForAccountId:accountId
+                                                                                transaction:transaction];
+    if (!localAddress.isValid || localIdentityKey == nil || !address.isValid) {
+        return;
+    }
+
+    [transaction addAsyncCompletionOffMain:^{
+        [OWSFingerprint fingerprintWithMyStableAddress:localAddress
+                                         myIdentityKey:localIdentityKey
+                                    theirStableAddress:address
+                                      theirIdentityKey:identityKey
+                                             theirName:@""];
+    }];
+}
+
 - (BOOL)isTrustedIdentityKey:(NSData *)identityKey
                      address:(SignalServiceAddress *)address
                    direction:(TSMessageDirection)direction
@@ -12,6 +12,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface OWSMessageDecryptResult : NSObject
 
+@property (nonatomic, readonly) SSKProtoEnvelope *envelope;
 @property (nonatomic, readonly) NSData *envelopeData;
 @property (nonatomic, readonly, nullable) NSData *plaintextData;
 @property (nonatomic, readonly) SignalServiceAddress *sourceAddress;
@@ -39,6 +40,17 @@ typedef void (^DecryptFailureBlock)(void);
            successBlock:(DecryptSuccessBlock)successBlock
            failureBlock:(DecryptFailureBlock)failureBlock;
 
+// Decrypts the envelope within the given transaction, which lets callers
+// decrypt a batch of envelopes in a single write transaction.
+//
+// Exactly one of successBlock & failureBlock will be called,
+// once, synchronously, on the calling thread.
+- (void)decryptEnvelope:(SSKProtoEnvelope *)envelope
+           envelopeData:(NSData *)envelopeData
+            transaction:(SDSAnyWriteTransaction *)transaction
+           successBlock:(DecryptSuccessBlock)successBlock
+           failureBlock:(DecryptFailureBlock)failureBlock;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -45,6 +45,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
 
 @interface OWSMessageDecryptResult ()
 
+@property (nonatomic) SSKProtoEnvelope *envelope;
 @property (nonatomic) NSData *envelopeData;
 @property (nonatomic, nullable) NSData *plaintextData;
 @property (nonatomic) SignalServiceAddress *sourceAddress;
@@ -57,17 +58,20 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
 
 @implementation OWSMessageDecryptResult
 
-+ (OWSMessageDecryptResult *)resultWithEnvelopeData:(NSData *)envelopeData
-                                      plaintextData:(nullable NSData *)plaintextData
-                                      sourceAddress:(SignalServiceAddress *)sourceAddress
-                                       sourceDevice:(UInt32)sourceDevice
-                                        isUDMessage:(BOOL)isUDMessage
++ (OWSMessageDecryptResult *)resultWithEnvelope:(SSKProtoEnvelope *)envelope
+                                   envelopeData:(NSData *)envelopeData
+                                  plaintextData:(nullable NSData *)plaintextData
+                                  sourceAddress:(SignalServiceAddress *)sourceAddress
+                                   sourceDevice:(UInt32)sourceDevice
+                                    isUDMessage:(BOOL)isUDMessage
 {
+    OWSAssertDebug(envelope);
     OWSAssertDebug(envelopeData);
     OWSAssertDebug(sourceAddress.isValid);
     OWSAssertDebug(sourceDevice > 0);
 
     OWSMessageDecryptResult *result = [OWSMessageDecryptResult new];
+    result.envelope = envelope;
     result.envelopeData = envelopeData;
     result.plaintextData = plaintextData;
     result.sourceAddress = sourceAddress;
@@ -210,7 +214,6 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
     OWSAssertDebug(envelopeData);
     OWSAssertDebug(successBlockParameter);
     OWSAssertDebug(failureBlockParameter);
-    OWSAssertDebug([self.tsAccountManager isRegistered]);
 
     // successBlock is called synchronously so that we can avail ourselves of
     // the transaction.
@@ -222,6 +225,43 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         });
     };
 
+    DatabaseStorageAsyncWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+        [self decryptEnvelope:envelope
+                 envelopeData:envelopeData
+                  transaction:transaction
+                 successBlock:successBlockParameter
+                 failureBlock:failureBlock];
+    });
+}
+
+- (void)decryptEnvelope:(SSKProtoEnvelope *)envelope
+           envelopeData:(NSData *)envelopeData
+            transaction:(SDSAnyWriteTransaction *)transaction
+           successBlock:(DecryptSuccessBlock)successBlock
+           failureBlock:(DecryptFailureBlock)failureBlock
+{
+    uint64_t signpostId = [Signposts beginInterval:SignpostIntervalMessageDecrypt];
+    [self decryptEnvelopeUnmeasured:envelope
+                       envelopeData:envelopeData
+                        transaction:transaction
+                       successBlock:successBlock
+                       failureBlock:failureBlock];
+    [Signposts endInterval:SignpostIntervalMessageDecrypt signpostId:signpostId];
+}
+
+- (void)decryptEnvelopeUnmeasured:(SSKProtoEnvelope *)envelope
+                     envelopeData:(NSData *)envelopeData
+                      transaction:(SDSAnyWriteTransaction *)transaction
+                     successBlock:(DecryptSuccessBlock)successBlockParameter
+                     failureBlock:(DecryptFailureBlock)failureBlock
+{
+    OWSAssertDebug(envelope);
+    OWSAssertDebug(envelopeData);
+    OWSAssertDebug(transaction);
+    OWSAssertDebug(successBlockParameter);
+    OWSAssertDebug(failureBlock);
+    OWSAssertDebug([self.tsAccountManager isRegistered]);
+
     uint32_t localDeviceId = self.tsAccountManager.storedDeviceId;
     DecryptSuccessBlock successBlock = ^(OWSMessageDecryptResult *result, SDSAnyWriteTransaction *transaction) {
         // Ensure all blocked messages are discarded.
@@ -284,6 +324,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
             case SSKProtoEnvelopeTypeCiphertext: {
                 [self throws_decryptSecureMessage:envelope
                     envelopeData:envelopeData
+                     transaction:transaction
                     successBlock:^(OWSMessageDecryptResult *result, SDSAnyWriteTransaction *transaction) {
                         OWSLogDebug(@"decrypted secure message.");
                         successBlock(result, transaction);
@@ -301,6 +342,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
             case SSKProtoEnvelopeTypePrekeyBundle: {
                 [self throws_decryptPreKeyBundle:envelope
                     envelopeData:envelopeData
+                     transaction:transaction
                     successBlock:^(OWSMessageDecryptResult *result, SDSAnyWriteTransaction *transaction) {
                         OWSLogDebug(@"decrypted pre-key whisper message");
                         successBlock(result, transaction);
@@ -320,20 +362,19 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
             case SSKProtoEnvelopeTypeReceipt:
             case SSKProtoEnvelopeTypeKeyExchange:
             case SSKProtoEnvelopeTypeUnknown: {
-                DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-                    OWSMessageDecryptResult *result =
-                        [OWSMessageDecryptResult resultWithEnvelopeData:envelopeData
-                                                          plaintextData:nil
-                                                          sourceAddress:envelope.sourceAddress
-                                                           sourceDevice:envelope.sourceDevice
-                                                            isUDMessage:NO];
-                    successBlock(result, transaction);
-                });
+                OWSMessageDecryptResult *result = [OWSMessageDecryptResult resultWithEnvelope:envelope
+                                                                                 envelopeData:envelopeData
+                                                                                plaintextData:nil
+                                                                                sourceAddress:envelope.sourceAddress
+                                                                                 sourceDevice:envelope.sourceDevice
+                                                                                  isUDMessage:NO];
+                successBlock(result, transaction);
                 // Return to avoid double-acknowledging.
                 return;
             }
             case SSKProtoEnvelopeTypeUnidentifiedSender: {
                 [self decryptUnidentifiedSender:envelope
+                    transaction:transaction
                     successBlock:^(OWSMessageDecryptResult *result, SDSAnyWriteTransaction *transaction) {
                         OWSLogDebug(@"decrypted unidentified sender message");
                         successBlock(result, transaction);
@@ -360,11 +401,9 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         OWSFailDebug(@"Received an invalid envelope: %@", exception.debugDescription);
         OWSProdFail([OWSAnalyticsEvents messageManagerErrorInvalidProtocolMessage]);
 
-        DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-            ThreadlessErrorMessage *errorMessage = [ThreadlessErrorMessage corruptedMessageInUnknownThread];
-            [SSKEnvironment.shared.notificationsManager notifyUserForThreadlessErrorMessage:errorMessage
-                                                                                transaction:transaction];
-        });
+        ThreadlessErrorMessage *errorMessage = [ThreadlessErrorMessage corruptedMessageInUnknownThread];
+        [SSKEnvironment.shared.notificationsManager notifyUserForThreadlessErrorMessage:errorMessage
+                                                                            transaction:transaction];
     }
 
     failureBlock();
@@ -372,6 +411,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
 
 - (void)throws_decryptSecureMessage:(SSKProtoEnvelope *)envelope
                        envelopeData:(NSData *)envelopeData
+                        transaction:(SDSAnyWriteTransaction *)transaction
                        successBlock:(DecryptSuccessBlock)successBlock
                        failureBlock:(void (^)(NSError *_Nullable error))failureBlock
 {
@@ -386,12 +426,14 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         cipherMessageBlock:^(NSData *encryptedData) {
             return [[WhisperMessage alloc] init_throws_withData:encryptedData];
         }
+               transaction:transaction
               successBlock:successBlock
               failureBlock:failureBlock];
 }
 
 - (void)throws_decryptPreKeyBundle:(SSKProtoEnvelope *)envelope
                       envelopeData:(NSData *)envelopeData
+                       transaction:(SDSAnyWriteTransaction *)transaction
                       successBlock:(DecryptSuccessBlock)successBlock
                       failureBlock:(void (^)(NSError *_Nullable error))failureBlock
 {
@@ -409,6 +451,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         cipherMessageBlock:^(NSData *encryptedData) {
             return [[PreKeyWhisperMessage alloc] init_throws_withData:encryptedData];
         }
+               transaction:transaction
               successBlock:successBlock
               failureBlock:failureBlock];
 }
@@ -417,6 +460,7 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
            envelopeData:(NSData *)envelopeData
          cipherTypeName:(NSString *)cipherTypeName
      cipherMessageBlock:(id<CipherMessage> (^_Nonnull)(NSData *))cipherMessageBlock
+            transaction:(SDSAnyWriteTransaction *)transaction
            successBlock:(DecryptSuccessBlock)successBlock
            failureBlock:(void (^)(NSError *_Nullable error))failureBlock
 {
@@ -437,42 +481,39 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         return failureBlock(error);
     }
 
-    DatabaseStorageAsyncWrite(
-        SDSDatabaseStorage.shared, ^(SDSAnyWriteTransaction *transaction) {
-            NSString *accountIdentifier = [[OWSAccountIdFinder new] ensureAccountIdForAddress:envelope.sourceAddress
-                                                                                  transaction:transaction];
-            @try {
-                id<CipherMessage> cipherMessage = cipherMessageBlock(encryptedData);
-                SessionCipher *cipher = [[SessionCipher alloc] initWithSessionStore:self.sessionStore
-                                                                        preKeyStore:self.preKeyStore
-                                                                  signedPreKeyStore:self.signedPreKeyStore
-                                                                   identityKeyStore:self.identityManager
-                                                                        recipientId:accountIdentifier
-                                                                           deviceId:deviceId];
-
-                // plaintextData may be nil for some envelope types.
-                NSData *_Nullable plaintextData =
-                    [[cipher throws_decrypt:cipherMessage protocolContext:transaction] removePadding];
-                OWSMessageDecryptResult *result = [OWSMessageDecryptResult resultWithEnvelopeData:envelopeData
-                                                                                    plaintextData:plaintextData
-                                                                                    sourceAddress:envelope.sourceAddress
-                                                                                     sourceDevice:envelope.sourceDevice
-                                                                                      isUDMessage:NO];
-                successBlock(result, transaction);
-            } @catch (NSException *exception) {
-                dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-                    [self processException:exception envelope:envelope];
-                    NSString *errorDescription = [NSString
-                        stringWithFormat:@"Exception while decrypting %@: %@", cipherTypeName, exception.description];
-                    OWSLogError(@"%@", errorDescription);
-                    NSError *error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptMessage, errorDescription);
-                    failureBlock(error);
-                });
-            }
-        });
+    NSString *accountIdentifier = [[OWSAccountIdFinder new] ensureAccountIdForAddress:envelope.sourceAddress
+                                                                          transaction:transaction];
+    @try {
+        id<CipherMessage> cipherMessage = cipherMessageBlock(encryptedData);
+        SessionCipher *cipher = [[SessionCipher alloc] initWithSessionStore:self.sessionStore
+                                                                preKeyStore:self.preKeyStore
+                                                          signedPreKeyStore:self.signedPreKeyStore
+                                                           identityKeyStore:self.identityManager
+                                                                recipientId:accountIdentifier
+                                                                   deviceId:deviceId];
+
+        // plaintextData may be nil for some envelope types.
+        NSData *_Nullable plaintextData =
+            [[cipher throws_decrypt:cipherMessage protocolContext:transaction] removePadding];
+        OWSMessageDecryptResult *result = [OWSMessageDecryptResult resultWithEnvelope:envelope
+                                                                         envelopeData:envelopeData
+                                                                        plaintextData:plaintextData
+                                                                        sourceAddress:envelope.sourceAddress
+                                                                         sourceDevice:envelope.sourceDevice
+                                                                          isUDMessage:NO];
+        successBlock(result, transaction);
+    } @catch (NSException *exception) {
+        [self processException:exception envelope:envelope transaction:transaction];
+        NSString *errorDescription =
+            [NSString stringWithFormat:@"Exception while decrypting %@: %@", cipherTypeName, exception.description];
+        OWSLogError(@"%@", errorDescription);
+        NSError *error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptMessage, errorDescription);
+        failureBlock(error);
+    }
 }
 
 - (void)decryptUnidentifiedSender:(SSKProtoEnvelope *)envelope
+                      transaction:(SDSAnyWriteTransaction *)transaction
                      successBlock:(DecryptSuccessBlock)successBlock
                      failureBlock:(void (^)(NSError *_Nullable error))failureBlock
 {
@@ -512,17 +553,15 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
     SignalServiceAddress *localAddress = self.tsAccountManager.localAddress;
     uint32_t localDeviceId = self.tsAccountManager.storedDeviceId;
 
-    DatabaseStorageAsyncWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-        [self decryptUnidentifiedSender:envelope
-                          encryptedData:encryptedData
-                   certificateValidator:certificateValidator
-                           localAddress:localAddress
-                          localDeviceId:localDeviceId
-                        serverTimestamp:serverTimestamp
-                            transaction:transaction
-                           successBlock:successBlock
-                           failureBlock:failureBlock];
-    });
+    [self decryptUnidentifiedSender:envelope
+                      encryptedData:encryptedData
+               certificateValidator:certificateValidator
+                       localAddress:localAddress
+                      localDeviceId:localDeviceId
+                    serverTimestamp:serverTimestamp
+                        transaction:transaction
+                       successBlock:successBlock
+                       failureBlock:failureBlock];
 }
 
 - (void)decryptUnidentifiedSender:(SSKProtoEnvelope *)envelope
@@ -614,20 +653,18 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         // Decrypt Failure Part 2: Handle unwrapped failure details
 
         if (underlyingException) {
-            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-                [self processException:underlyingException envelope:identifiedEnvelope];
-                NSString *errorDescription = [NSString
-                    stringWithFormat:@"Exception while decrypting ud message: %@", underlyingException.description];
-                NSError *error;
-                if ([underlyingException.name isEqualToString:DuplicateMessageException]) {
-                    OWSLogInfo(@"%@", errorDescription);
-                    error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptDuplicateMessage, errorDescription);
-                } else {
-                    OWSLogError(@"%@", errorDescription);
-                    error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptMessage, errorDescription);
-                }
-                failureBlock(error);
-            });
+            [self processException:underlyingException envelope:identifiedEnvelope transaction:transaction];
+            NSString *errorDescription = [NSString
+                stringWithFormat:@"Exception while decrypting ud message: %@", underlyingException.description];
+            NSError *error;
+            if ([underlyingException.name isEqualToString:DuplicateMessageException]) {
+                OWSLogInfo(@"%@", errorDescription);
+                error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptDuplicateMessage, errorDescription);
+            } else {
+                OWSLogError(@"%@", errorDescription);
+                error = OWSErrorWithCodeDescription(OWSErrorCodeFailedToDecryptMessage, errorDescription);
+            }
+            failureBlock(error);
             return;
         }
 
@@ -673,22 +710,26 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
     [envelopeBuilder setSourceUuid:sourceAddress.uuidString];
     [envelopeBuilder setSourceDevice:(uint32_t)sourceDeviceId];
     NSError *envelopeBuilderError;
-    NSData *_Nullable newEnvelopeData = [envelopeBuilder buildSerializedDataAndReturnError:&envelopeBuilderError];
-    if (envelopeBuilderError || !newEnvelopeData) {
+    SSKProtoEnvelope *_Nullable newEnvelope = [envelopeBuilder buildAndReturnError:&envelopeBuilderError];
+    NSData *_Nullable newEnvelopeData = [newEnvelope serializedDataAndReturnError:&envelopeBuilderError];
+    if (envelopeBuilderError || !newEnvelope || !newEnvelopeData) {
         OWSFailDebug(@"Could not update UD envelope data: %@", envelopeBuilderError);
         NSError *error = EnsureDecryptError(envelopeBuilderError, @"Could not update UD envelope data");
         return failureBlock(error);
     }
 
-    OWSMessageDecryptResult *result = [OWSMessageDecryptResult resultWithEnvelopeData:newEnvelopeData
-                                                                        plaintextData:plaintextData
-                                                                        sourceAddress:sourceAddress
-                                                                         sourceDevice:(UInt32)sourceDeviceId
-                                                                          isUDMessage:YES];
+    OWSMessageDecryptResult *result = [OWSMessageDecryptResult resultWithEnvelope:newEnvelope
+                                                                     envelopeData:newEnvelopeData
+                                                                    plaintextData:plaintextData
+                                                                    sourceAddress:sourceAddress
+                                                                     sourceDevice:(UInt32)sourceDeviceId
+                                                                      isUDMessage:YES];
     successBlock(result, transaction);
 }
 
-- (void)processException:(NSException *)exception envelope:(SSKProtoEnvelope *)envelope
+- (void)processException:(NSException *)exception
+                envelope:(SSKProtoEnvelope *)envelope
+             transaction:(SDSAnyWriteTransaction *)transaction
 {
     NSString *logString = [NSString stringWithFormat:@"Got exception: %@ of type: %@ with reason: %@",
                                     exception.description,
@@ -702,134 +743,132 @@ NSError *EnsureDecryptError(NSError *_Nullable error, NSString *fallbackErrorDes
         OWSLogError(@"%@", logString);
     }
 
-    DatabaseStorageWrite(self.databaseStorage, (^(SDSAnyWriteTransaction *transaction) {
-        TSErrorMessage *errorMessage;
+    TSErrorMessage *errorMessage;
 
-        if (!envelope.sourceAddress.isValid) {
-            ThreadlessErrorMessage *errorMessage = [ThreadlessErrorMessage corruptedMessageInUnknownThread];
-            [SSKEnvironment.shared.notificationsManager notifyUserForThreadlessErrorMessage:errorMessage
-                                                                                transaction:transaction];
-            return;
-        }
+    if (!envelope.sourceAddress.isValid) {
+        ThreadlessErrorMessage *errorMessage = [ThreadlessErrorMessage corruptedMessageInUnknownThread];
+        [SSKEnvironment.shared.notificationsManager notifyUserForThreadlessErrorMessage:errorMessage
+                                                                            transaction:transaction];
+        return;
+    }
 
-        TSContactThread *contactThread = [TSContactThread getOrCreateThreadWithContactAddress:envelope.sourceAddress
-                                                                                  transaction:transaction];
-
-        if (envelope.hasSourceUuid) {
-            // Since the message failed to decrypt, we want to reset our session
-            // with this device to ensure future messages we receive are decryptable.
-            // We achieve this by archiving our current session with this device.
-            // It's important we don't do this if we've already recently reset the
-            // session for a given device, for example if we're processing a backlog
-            // of 50 message from Alice that all fail to decrypt we don't want to
-            // reset the session 50 times. We acomplish this by tracking the UUID +
-            // device ID pair that we have recently reset, so we can skip subsequent
-            // resets. When the message decrypt queue is drained, the list of recently
-            // reset IDs is cleared.
-
-            NSString *senderId = [NSString stringWithFormat:@"%@.%d", envelope.sourceUuid, envelope.sourceDevice];
-
-            BOOL hasResetDuringThisBatch = [self.senderIdsResetDuringCurrentBatch containsObject:senderId];
-
-            // We only ever want to archive sessions outside of a given "batch"
-            // of message decryption. In practice, this means we:
-            // 1. Only archive at max once per sender while draining the initial
-            //    queue after establishing the websocket connection, until we
-            //    receive the empty response.
-            // 2. Only archive once if we get a quick burst of messages that
-            //    cannot decrypt in the decryption queue while the app is running.
-            //
-            // Outside of these cases, we *always* archive your current session
-            // when we encounter a decryption error, so that your next message
-            // send to that device should send a prekey message and establish
-            // a new, healthy, session.
-            if (!hasResetDuringThisBatch) {
-                [self.senderIdsResetDuringCurrentBatch addObject:senderId];
-
-                OWSLogWarn(@"Archiving session for undecryptable message from %@", senderId);
-                [self.sessionStore archiveSessionForAddress:envelope.sourceAddress
-                                                   deviceId:envelope.sourceDevice
-                                                transaction:transaction];
-
-                // Always notify the user that we have performed an automatic archive.
-                errorMessage = [TSErrorMessage sessionRefreshWithEnvelope:envelope withTransaction:transaction];
-
-                NSDate *_Nullable lastNullMessageDate = [self.keyValueStore getDate:senderId transaction:transaction];
-
-                BOOL hasRecentlySentNullMessage = NO;
-                if (lastNullMessageDate) {
-                    hasRecentlySentNullMessage = fabs([lastNullMessageDate timeIntervalSinceNow])
-                        <= RemoteConfig.automaticSessionResetAttemptInterval;
-                }
-
-                // In order to quickly get both devices into a healthy state, we
-                // try and send a null message immediately to establish the new
-                // session. However, we only do this at max once per a given time
-                // interval so in the case the other client is continually
-                // responding to our message with another message we can't decrypt,
-                // we don't get in a loop where we keep responding to them.
-                // In general, this should never happen because the other
-                // client should be able to decrypt a prekey message.
-                if (RemoteConfig.automaticSessionResetKillSwitch) {
-                    OWSLogWarn(
-                        @"Skipping null message after undecryptable message from %@ due to kill switch.", senderId);
-                } else if (hasRecentlySentNullMessage) {
-                    OWSLogWarn(
-                        @"Skipping null message after undecryptable message from %@, last null message sent %llu",
-                        senderId,
-                        [lastNullMessageDate ows_millisecondsSince1970]);
-                } else {
-                    OWSLogInfo(@"Sending null message to reset session after undecryptable message from: %@", senderId);
-
-                    [self.keyValueStore setDate:[NSDate new] key:senderId transaction:transaction];
-
-                    OWSOutgoingNullMessage *nullMessage =
-                        [[OWSOutgoingNullMessage alloc] initWithContactThread:contactThread];
-                    [self.messageSender sendMessage:nullMessage.asPreparer
-                        success:^{
-                            OWSLogInfo(
-                                @"Successfully sent null message after session reset for undecryptable message from %@",
-                                senderId);
-                        }
-                        failure:^(NSError *error) {
-                            OWSFailDebug(@"Failed to send null message after session reset for undecryptable message "
-                                         @"from %@ (%@)",
-                                senderId,
-                                error.localizedDescription);
-                        }];
-                }
+    TSContactThread *contactThread = [TSContactThread getOrCreateThreadWithContactAddress:envelope.sourceAddress
+                                                                              transaction:transaction];
+
+    if (envelope.hasSourceUuid) {
+        // Since the message failed to decrypt, we want to reset our session
+        // with this device to ensure future messages we receive are decryptable.
+        // We achieve this by archiving our current session with this device.
+        // It's important we don't do this if we've already recently reset the
+        // session for a given device, for example if we're processing a backlog
+        // of 50 message from Alice that all fail to decrypt we don't want to
+        // reset the session 50 times. We acomplish this by tracking the UUID +
+        // device ID pair that we have recently reset, so we can skip subsequent
+        // resets. When the message decrypt queue is drained, the list of recently
+        // reset IDs is cleared.
+
+        NSString *senderId = [NSString stringWithFormat:@"%@.%d", envelope.sourceUuid, envelope.sourceDevice];
+
+        BOOL hasResetDuringThisBatch = [self.senderIdsResetDuringCurrentBatch containsObject:senderId];
+
+        // We only ever want to archive sessions outside of a given "batch"
+        // of message decryption. In practice, this means we:
+        // 1. Only archive at max once per sender while draining the initial
+        //    queue after establishing the websocket connection, until we
+        //    receive the empty response.
+        // 2. Only archive once if we get a quick burst of messages that
+        //    cannot decrypt in the decryption queue while the app is running.
+        //
+        // Outside of these cases, we *always* archive your current session
+        // when we encounter a decryption error, so that your next message
+        // send to that device should send a prekey message and establish
+        // a new, healthy, session.
+        if (!hasResetDuringThisBatch) {
+            [self.senderIdsResetDuringCurrentBatch addObject:senderId];
+
+            OWSLogWarn(@"Archiving session for undecryptable message from %@", senderId);
+            [self.sessionStore archiveSessionForAddress:envelope.sourceAddress
+                                               deviceId:envelope.sourceDevice
+                                            transaction:transaction];
+
+            // Always notify the user that we have performed an automatic archive.
+            errorMessage = [TSErrorMessage sessionRefreshWithEnvelope:envelope withTransaction:transaction];
+
+            NSDate *_Nullable lastNullMessageDate = [self.keyValueStore getDate:senderId transaction:transaction];
+
+            BOOL hasRecentlySentNullMessage = NO;
+            if (lastNullMessageDate) {
+                hasRecentlySentNullMessage = fabs([lastNullMessageDate timeIntervalSinceNow])
+                    <= RemoteConfig.automaticSessionResetAttemptInterval;
+            }
+
+            // In order to quickly get both devices into a healthy state, we
+            // try and send a null message immediately to establish the new
+            // session. However, we only do this at max once per a given time
+            // interval so in the case the other client is continually
+            // responding to our message with another message we can't decrypt,
+            // we don't get in a loop where we keep responding to them.
+            // In general, this should never happen because the other
+            // client should be able to decrypt a prekey message.
+            if (RemoteConfig.automaticSessionResetKillSwitch) {
+                OWSLogWarn(
+                    @"Skipping null message after undecryptable message from %@ due to kill switch.", senderId);
+            } else if (hasRecentlySentNullMessage) {
+                OWSLogWarn(
+                    @"Skipping null message after undecryptable message from %@, last null message sent %llu",
+                    senderId,
+                    [lastNullMessageDate ows_millisecondsSince1970]);
             } else {
-                OWSLogWarn(@"Skipping session reset for undecryptable message from %@, already reset during this batch",
-                    senderId);
+                OWSLogInfo(@"Sending null message to reset session after undecryptable message from: %@", senderId);
+
+                [self.keyValueStore setDate:[NSDate new] key:senderId transaction:transaction];
+
+                OWSOutgoingNullMessage *nullMessage =
+                    [[OWSOutgoingNullMessage alloc] initWithContactThread:contactThread];
+                [self.messageSender sendMessage:nullMessage.asPreparer
+                    success:^{
+                        OWSLogInfo(
+                            @"Successfully sent null message after session reset for undecryptable message from %@",
+                            senderId);
+                    }
+                    failure:^(NSError *error) {
+                        OWSFailDebug(@"Failed to send null message after session reset for undecryptable message "
+                                     @"from %@ (%@)",
+                            senderId,
+                            error.localizedDescription);
+                    }];
             }
         } else {
-            OWSFailDebug(@"Received envelope missing UUID %@.%d", envelope.sourceAddress, envelope.sourceDevice);
-            errorMessage = [TSErrorMessage corruptedMessageWithEnvelope:envelope withTransaction:transaction];
+            OWSLogWarn(@"Skipping session reset for undecryptable message from %@, already reset during this batch",
+                senderId);
         }
+    } else {
+        OWSFailDebug(@"Received envelope missing UUID %@.%d", envelope.sourceAddress, envelope.sourceDevice);
+        errorMessage = [TSErrorMessage corruptedMessageWithEnvelope:envelope withTransaction:transaction];
+    }
 
-        // Log the error appropriately.
-        if ([exception.name isEqualToString:NoSessionException]) {
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorNoSession], envelope);
-        } else if ([exception.name isEqualToString:InvalidKeyException]) {
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidKey], envelope);
-        } else if ([exception.name isEqualToString:InvalidKeyIdException]) {
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidKeyId], envelope);
-        } else if ([exception.name isEqualToString:InvalidVersionException]) {
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidMessageVersion], envelope);
-        } else if ([exception.name isEqualToString:UntrustedIdentityKeyException]) {
-            // Should no longer get here, since we now record the new identity for incoming messages.
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorUntrustedIdentityKeyException], envelope);
-            OWSFailDebug(@"Failed to trust identity on incoming message from: %@", envelopeAddress(envelope));
-        } else {
-            OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorCorruptMessage], envelope);
-        }
+    // Log the error appropriately.
+    if ([exception.name isEqualToString:NoSessionException]) {
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorNoSession], envelope);
+    } else if ([exception.name isEqualToString:InvalidKeyException]) {
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidKey], envelope);
+    } else if ([exception.name isEqualToString:InvalidKeyIdException]) {
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidKeyId], envelope);
+    } else if ([exception.name isEqualToString:InvalidVersionException]) {
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorInvalidMessageVersion], envelope);
+    } else if ([exception.name isEqualToString:UntrustedIdentityKeyException]) {
+        // Should no longer get here, since we now record the new identity for incoming messages.
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorUntrustedIdentityKeyException], envelope);
+        OWSFailDebug(@"Failed to trust identity on incoming message from: %@", envelopeAddress(envelope));
+    } else {
+        OWSProdErrorWEnvelope([OWSAnalyticsEvents messageManagerErrorCorruptMessage], envelope);
+    }
 
-        OWSAssertDebug(errorMessage);
-        if (errorMessage != nil) {
-            [errorMessage anyInsertWithTransaction:transaction];
-            [self notifyUserForErrorMessage:errorMessage contactThread:contactThread transaction:transaction];
-        }
-    }));
+    OWSAssertDebug(errorMessage);
+    if (errorMessage != nil) {
+        [errorMessage anyInsertWithTransaction:transaction];
+        [self notifyUserForErrorMessage:errorMessage contactThread:contactThread transaction:transaction];
+    }
 }
 
 - (void)notifyUserForErrorMessage:(TSErrorMessage *)errorMessage
@@ -421,24 +421,28 @@ NS_ASSUME_NONNULL_BEGIN
 
     NSMutableArray<NSNumber *> *earlyTimestamps = [NSMutableArray new];
 
+    NSMutableArray<NSNumber *> *validTimestamps = [NSMutableArray new];
     for (NSNumber *nsTimestamp in sentTimestamps) {
-        uint64_t timestamp = [nsTimestamp unsignedLongLongValue];
-        if (![SDS fitsInInt64:timestamp]) {
+        if (![SDS fitsInInt64:[nsTimestamp unsignedLongLongValue]]) {
             OWSFailDebug(@"Invalid timestamp.");
             continue;
         }
+        [validTimestamps addObject:nsTimestamp];
+    }
 
-        NSError *error;
-        NSArray<TSOutgoingMessage *> *messages = (NSArray<TSOutgoingMessage *> *)[InteractionFinder
-            interactionsWithTimestamp:timestamp
-                               filter:^(TSInteraction *interaction) {
-                                   return [interaction isKindOfClass:[TSOutgoingMessage class]];
-                               }
-                          transaction:transaction
-                                error:&error];
-        if (error != nil) {
-            OWSFailDebug(@"Error loading interactions: %@", error);
-        }
+    // Look up the messages for all of the receipt's timestamps together.
+    NSError *error;
+    NSDictionary<NSNumber *, NSArray<TSOutgoingMessage *> *> *messagesByTimestamp =
+        [InteractionFinder outgoingMessagesByTimestampWithTimestamps:validTimestamps
+                                                         transaction:transaction
+                                                               error:&error];
+    if (error != nil) {
+        OWSFailDebug(@"Error loading interactions: %@", error);
+    }
+
+    for (NSNumber *nsTimestamp in validTimestamps) {
+        uint64_t timestamp = [nsTimestamp unsignedLongLongValue];
+        NSArray<TSOutgoingMessage *> *messages = messagesByTimestamp[nsTimestamp] ?: @[];
 
         if (messages.count < 1) {
             OWSLogInfo(@"Missing message for delivery receipt: %llu", timestamp);
@@ -449,10 +453,18 @@ NS_ASSUME_NONNULL_BEGIN
                     (unsigned long)messages.count,
                     timestamp);
             }
+            OutgoingMessageReceiptAggregator *_Nullable receiptAggregator =
+                [OutgoingMessageReceiptAggregator aggregatorWithTransaction:transaction];
             for (TSOutgoingMessage *outgoingMessage in messages) {
-                [outgoingMessage updateWithDeliveredRecipient:address
-                                            deliveryTimestamp:deliveryTimestamp
-                                                  transaction:transaction];
+                if (receiptAggregator != nil) {
+                    [receiptAggregator addDeliveryReceiptWithMessage:outgoingMessage
+                                                    recipientAddress:address
+                                                   deliveryTimestamp:deliveryTimestamp];
+                } else {
+                    [outgoingMessage updateWithDeliveredRecipient:address
+                                                deliveryTimestamp:deliveryTimestamp
+                                                      transaction:transaction];
+                }
             }
         }
     }
@@ -1642,7 +1654,8 @@ NS_ASSUME_NONNULL_BEGIN
                                                   wasReceivedByUD:wasReceivedByUD
                                           serverDeliveryTimestamp:serverDeliveryTimestamp
                                        associatedMessageTimestamp:dataMessage.reaction.timestamp
-                                          associatedMessageAuthor:dataMessage.reaction.authorAddress];
+                                          associatedMessageAuthor:dataMessage.reaction.authorAddress
+                                                      transaction:transaction];
                     break;
             }
         } else if (dataMessage.delete != nil) {
@@ -1678,7 +1691,8 @@ NS_ASSUME_NONNULL_BEGIN
                                                   wasReceivedByUD:wasReceivedByUD
                                           serverDeliveryTimestamp:serverDeliveryTimestamp
                                        associatedMessageTimestamp:dataMessage.delete.targetSentTimestamp
-                                          associatedMessageAuthor:envelope.sourceAddress];
+                                          associatedMessageAuthor:envelope.sourceAddress
+                                                      transaction:transaction];
                     break;
             }
         } else if (dataMessage.groupCallUpdate != nil) {
@@ -1783,7 +1797,8 @@ NS_ASSUME_NONNULL_BEGIN
                                               wasReceivedByUD:wasReceivedByUD
                                       serverDeliveryTimestamp:serverDeliveryTimestamp
                                    associatedMessageTimestamp:syncMessage.viewOnceOpen.timestamp
-                                      associatedMessageAuthor:syncMessage.viewOnceOpen.senderAddress];
+                                      associatedMessageAuthor:syncMessage.viewOnceOpen.senderAddress
+                                                  transaction:transaction];
                 break;
         }
     } else if (syncMessage.configuration) {
@@ -2101,7 +2116,8 @@ NS_ASSUME_NONNULL_BEGIN
                                               wasReceivedByUD:wasReceivedByUD
                                       serverDeliveryTimestamp:serverDeliveryTimestamp
                                    associatedMessageTimestamp:dataMessage.reaction.timestamp
-                                      associatedMessageAuthor:dataMessage.reaction.authorAddress];
+                                      associatedMessageAuthor:dataMessage.reaction.authorAddress
+                                                  transaction:transaction];
                 break;
         }
 
@@ -2128,7 +2144,8 @@ NS_ASSUME_NONNULL_BEGIN
                                               wasReceivedByUD:wasReceivedByUD
                                       serverDeliveryTimestamp:serverDeliveryTimestamp
                                    associatedMessageTimestamp:dataMessage.delete.targetSentTimestamp
-                                      associatedMessageAuthor:envelope.sourceAddress];
+                                      associatedMessageAuthor:envelope.sourceAddress
+                                                  transaction:transaction];
                 break;
         }
         return nil;
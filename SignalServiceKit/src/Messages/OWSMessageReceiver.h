@@ -82,6 +82,8 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:createdAt:envelopeD
 
 - (BOOL)hasPendingJobsWithTransaction:(SDSAnyReadTransaction *)transaction;
 
+- (NSUInteger)queuedJobCountWithTransaction:(SDSAnyReadTransaction *)transaction;
+
 @end
 
 NS_ASSUME_NONNULL_END
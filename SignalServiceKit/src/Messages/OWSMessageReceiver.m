@@ -452,7 +452,8 @@ NSString *const OWSMessageDecryptJobFinderExtensionGroup = @"OWSMessageProcessin
     AssertOnDispatchQueue(self.serialQueue);
     OWSAssertDebug(job);
 
-    SSKProtoEnvelope *_Nullable envelope = job.envelopeProto;
+    SSKProtoEnvelope *_Nullable envelope =
+        [EnvelopeHandleCache.shared cachedHandleWithEnvelopeData:job.envelopeData].envelope ?: job.envelopeProto;
     if (!envelope) {
         OWSFailDebug(@"Could not parse proto.");
         // TODO: Add analytics.
@@ -484,11 +485,12 @@ NSString *const OWSMessageDecryptJobFinderExtensionGroup = @"OWSMessageProcessin
             //
             // NOTE: We use envelopeData from the decrypt result, not job.envelopeData,
             // since the envelope may be altered by the decryption process in the UD case.
-            [self.batchMessageProcessor enqueueEnvelopeData:result.envelopeData
-                                              plaintextData:result.plaintextData
-                                            wasReceivedByUD:wasReceivedByUD
-                                    serverDeliveryTimestamp:job.serverDeliveryTimestamp
-                                                transaction:transaction];
+            [self.batchMessageProcessor enqueueEnvelope:result.envelope
+                                           envelopeData:result.envelopeData
+                                          plaintextData:result.plaintextData
+                                        wasReceivedByUD:wasReceivedByUD
+                                serverDeliveryTimestamp:job.serverDeliveryTimestamp
+                                            transaction:transaction];
 
             [self.profileManager didSendOrReceiveMessageFromAddress:result.sourceAddress transaction:transaction];
 
@@ -555,6 +557,11 @@ NSString *const OWSMessageDecryptJobFinderExtensionGroup = @"OWSMessageProcessin
     return SSKEnvironment.shared.storageCoordinator;
 }
 
+- (MessagePipelineTimings *)pipelineTimings
+{
+    return SSKEnvironment.shared.messagePipelineSupervisor.timings;
+}
+
 #pragma mark - class methods
 
 + (NSString *)databaseExtensionName
@@ -592,12 +599,29 @@ NSString *const OWSMessageDecryptJobFinderExtensionGroup = @"OWSMessageProcessin
         OWSFailDebug(@"Unexpectedly large message.");
     }
 
+    // Parse the envelope once, up front; later pipeline stages will
+    // reuse the parsed envelope rather than parsing these bytes again.
+    NSError *_Nullable parseError;
+    EnvelopeHandle *_Nullable envelopeHandle = [EnvelopeHandle handleWithEnvelopeData:envelopeData error:&parseError];
+    if (envelopeHandle != nil) {
+        [EnvelopeHandleCache.shared add:envelopeHandle];
+        [self.pipelineTimings recordStage:MessagePipelineTimingStageReceived envelope:envelopeHandle.envelope];
+    } else {
+        // We'll fail to decrypt this envelope later; the decrypt queue is
+        // responsible for reporting that failure.
+        OWSLogWarn(@"Could not parse envelope: %@", parseError);
+    }
+
     if (StorageCoordinator.dataStoreForUI == DataStoreYdb) {
         [self.yapProcessingQueue enqueueEnvelopeData:envelopeData serverDeliveryTimestamp:serverDeliveryTimestamp];
         [self.yapProcessingQueue drainQueue];
     } else {
         // We *could* use this processing Queue for Yap *and* GRDB
         [self.messageDecryptJobQueue enqueueEnvelopeData:envelopeData serverDeliveryTimestamp:serverDeliveryTimestamp];
+        if (envelopeHandle != nil) {
+            // The decrypt job is written synchronously.
+            [self.pipelineTimings recordStage:MessagePipelineTimingStagePersisted envelope:envelopeHandle.envelope];
+        }
     }
 }
 
@@ -611,6 +635,15 @@ NSString *const OWSMessageDecryptJobFinderExtensionGroup = @"OWSMessageProcessin
     }
 }
 
+- (NSUInteger)queuedJobCountWithTransaction:(SDSAnyReadTransaction *)transaction
+{
+    if (StorageCoordinator.dataStoreForUI == DataStoreYdb) {
+        return [self.yapProcessingQueue.finder queuedJobCountWithTransaction:transaction];
+    } else {
+        return [self.messageDecryptJobQueue pendingJobCountObjcWithTransaction:transaction];
+    }
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
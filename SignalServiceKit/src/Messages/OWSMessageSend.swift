@@ -59,6 +59,15 @@ public class OWSMessageSend: NSObject {
         return AnyPromise(promise)
     }
 
+    private let _sendDuration: AtomicOptional<NSNumber>
+
+    // How long it took to send to this recipient, measured from when
+    // this message send was created. Nil until the send completes.
+    @objc
+    public var sendDuration: NSNumber? {
+        return _sendDuration.get()
+    }
+
     @objc
     public let success: () -> Void
 
@@ -80,10 +89,15 @@ public class OWSMessageSend: NSObject {
 
         let (promise, resolver) = Promise<Void>.pending()
         self.promise = promise
+        let startDate = Date()
+        let sendDuration = AtomicOptional<NSNumber>(nil)
+        self._sendDuration = sendDuration
         self.success = {
+            sendDuration.set(NSNumber(value: abs(startDate.timeIntervalSinceNow)))
             resolver.fulfill(())
         }
         self.failure = { error in
+            sendDuration.set(NSNumber(value: abs(startDate.timeIntervalSinceNow)))
             if let sendErrorBlock = sendErrorBlock {
                 sendErrorBlock(error)
             }
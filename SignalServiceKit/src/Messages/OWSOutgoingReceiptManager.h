@@ -25,6 +25,10 @@ NS_ASSUME_NONNULL_BEGIN
                            timestamp:(uint64_t)timestamp
                          transaction:(SDSAnyWriteTransaction *)transaction;
 
+// Read receipts enqueued by block within this transaction are coalesced
+// and written with a single record per sender once block returns.
+- (void)batchReadReceiptsWithTransaction:(SDSAnyWriteTransaction *)transaction block:(void (^NS_NOESCAPE)(void))block;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -25,6 +25,12 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
 // This property should only be accessed on the serialQueue.
 @property (nonatomic) BOOL isProcessing;
 
+// Keyed by the transaction in which read receipts are being batched.
+// This property should only be accessed while synchronized on self.
+@property (nonatomic, readonly)
+    NSMutableDictionary<NSValue *, NSMutableDictionary<SignalServiceAddress *, NSMutableSet<NSNumber *> *> *>
+        *readReceiptBatches;
+
 @end
 
 #pragma mark -
@@ -69,6 +75,8 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
 
     OWSSingletonAssert();
 
+    _readReceiptBatches = [NSMutableDictionary new];
+
     [[NSNotificationCenter defaultCenter] addObserver:self
                                              selector:@selector(reachabilityChanged)
                                                  name:SSKReachability.owsReachabilityDidChange
@@ -270,19 +278,91 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
     [self enqueueReceiptForAddress:address timestamp:timestamp receiptType:OWSReceiptType_Read transaction:transaction];
 }
 
+- (void)batchReadReceiptsWithTransaction:(SDSAnyWriteTransaction *)transaction block:(void (^NS_NOESCAPE)(void))block
+{
+    OWSAssertDebug(transaction);
+
+    NSValue *key = [NSValue valueWithNonretainedObject:transaction];
+    BOOL isNested;
+    @synchronized(self) {
+        isNested = self.readReceiptBatches[key] != nil;
+        if (!isNested) {
+            self.readReceiptBatches[key] = [NSMutableDictionary new];
+        }
+    }
+
+    block();
+
+    if (isNested) {
+        // The outer batch will write these receipts.
+        return;
+    }
+
+    NSDictionary<SignalServiceAddress *, NSSet<NSNumber *> *> *batch;
+    @synchronized(self) {
+        batch = self.readReceiptBatches[key];
+        [self.readReceiptBatches removeObjectForKey:key];
+    }
+    if (batch.count < 1) {
+        return;
+    }
+
+    __block NSUInteger receiptCount = 0;
+    [batch enumerateKeysAndObjectsUsingBlock:^(
+        SignalServiceAddress *address, NSSet<NSNumber *> *timestamps, BOOL *stop) {
+        receiptCount += timestamps.count;
+        [self enqueueReceiptsForAddress:address
+                             timestamps:timestamps
+                            receiptType:OWSReceiptType_Read
+                            transaction:transaction];
+    }];
+    OWSLogInfo(@"Enqueued %lu read receipts for %lu senders.", (unsigned long)receiptCount, (unsigned long)batch.count);
+}
+
 - (void)enqueueReceiptForAddress:(SignalServiceAddress *)address
                        timestamp:(uint64_t)timestamp
                      receiptType:(OWSReceiptType)receiptType
                      transaction:(SDSAnyWriteTransaction *)transaction
 {
-    SDSKeyValueStore *store = [self storeForReceiptType:receiptType];
-
     OWSAssertDebug(address.isValid);
     if (timestamp < 1) {
         OWSFailDebug(@"Invalid timestamp.");
         return;
     }
 
+    if (receiptType == OWSReceiptType_Read) {
+        NSValue *key = [NSValue valueWithNonretainedObject:transaction];
+        @synchronized(self) {
+            NSMutableDictionary<SignalServiceAddress *, NSMutableSet<NSNumber *> *> *_Nullable batch
+                = self.readReceiptBatches[key];
+            if (batch != nil) {
+                NSMutableSet<NSNumber *> *_Nullable timestamps = batch[address];
+                if (timestamps == nil) {
+                    timestamps = [NSMutableSet new];
+                    batch[address] = timestamps;
+                }
+                [timestamps addObject:@(timestamp)];
+                return;
+            }
+        }
+    }
+
+    [self enqueueReceiptsForAddress:address
+                         timestamps:[NSSet setWithObject:@(timestamp)]
+                        receiptType:receiptType
+                        transaction:transaction];
+}
+
+- (void)enqueueReceiptsForAddress:(SignalServiceAddress *)address
+                       timestamps:(NSSet<NSNumber *> *)timestamps
+                      receiptType:(OWSReceiptType)receiptType
+                      transaction:(SDSAnyWriteTransaction *)transaction
+{
+    SDSKeyValueStore *store = [self storeForReceiptType:receiptType];
+
+    OWSAssertDebug(address.isValid);
+    OWSAssertDebug(timestamps.count > 0);
+
     NSString *identifier = address.uuidString ?: address.phoneNumber;
 
     NSSet<NSNumber *> *_Nullable oldUUIDTimestamps;
@@ -311,7 +391,7 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
     }
 
     NSMutableSet<NSNumber *> *newTimestamps = (oldTimestamps ? [oldTimestamps mutableCopy] : [NSMutableSet new]);
-    [newTimestamps addObject:@(timestamp)];
+    [newTimestamps unionSet:timestamps];
 
     [store setObject:newTimestamps key:identifier transaction:transaction];
 
@@ -332,7 +412,8 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
         OWSFailDebug(@"Invalid timestamps.");
         return;
     }
-    DatabaseStorageAsyncWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
+    // Dequeuing receipts is a tiny write and happens once per sent receipt.
+    [self.databaseStorage asyncCoalescedWriteWithBlock:^(SDSAnyWriteTransaction *transaction) {
         NSString *identifier = address.uuidString ?: address.phoneNumber;
 
         NSSet<NSNumber *> *_Nullable oldUUIDTimestamps;
@@ -369,7 +450,7 @@ typedef NS_ENUM(NSUInteger, OWSReceiptType) {
         } else {
             [store removeValueForKey:identifier transaction:transaction];
         }
-    });
+    }];
 }
 
 - (void)reachabilityChanged
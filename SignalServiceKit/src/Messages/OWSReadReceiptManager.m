@@ -273,20 +273,19 @@ NSString *const OWSReadReceiptManagerAreReadReceiptsEnabled = @"areReadReceiptsE
         return @[];
     }
 
+    // Look up the messages for all of the receipt's timestamps together.
+    NSError *error;
+    NSDictionary<NSNumber *, NSArray<TSOutgoingMessage *> *> *messagesByTimestamp =
+        [InteractionFinder outgoingMessagesByTimestampWithTimestamps:sentTimestamps
+                                                         transaction:transaction
+                                                               error:&error];
+    if (error != nil) {
+        OWSFailDebug(@"Error loading interactions: %@", error);
+    }
+
     for (NSNumber *nsSentTimestamp in sentTimestamps) {
         UInt64 sentTimestamp = [nsSentTimestamp unsignedLongLongValue];
-
-        NSError *error;
-        NSArray<TSOutgoingMessage *> *messages = (NSArray<TSOutgoingMessage *> *)[InteractionFinder
-            interactionsWithTimestamp:sentTimestamp
-                               filter:^(TSInteraction *interaction) {
-                                   return [interaction isKindOfClass:[TSOutgoingMessage class]];
-                               }
-                          transaction:transaction
-                                error:&error];
-        if (error != nil) {
-            OWSFailDebug(@"Error loading interactions: %@", error);
-        }
+        NSArray<TSOutgoingMessage *> *messages = messagesByTimestamp[nsSentTimestamp] ?: @[];
 
         if (messages.count > 1) {
             OWSLogError(@"More than one matching message with timestamp: %llu.", sentTimestamp);
@@ -295,8 +294,16 @@ NSString *const OWSReadReceiptManagerAreReadReceiptsEnabled = @"areReadReceiptsE
         if (messages.count > 0) {
             // TODO: We might also need to "mark as read by recipient" any older messages
             // from us in that thread.  Or maybe this state should hang on the thread?
+            OutgoingMessageReceiptAggregator *_Nullable receiptAggregator =
+                [OutgoingMessageReceiptAggregator aggregatorWithTransaction:transaction];
             for (TSOutgoingMessage *message in messages) {
-                [message updateWithReadRecipient:address readTimestamp:readTimestamp transaction:transaction];
+                if (receiptAggregator != nil) {
+                    [receiptAggregator addReadReceiptWithMessage:message
+                                                recipientAddress:address
+                                                   readTimestamp:readTimestamp];
+                } else {
+                    [message updateWithReadRecipient:address readTimestamp:readTimestamp transaction:transaction];
+                }
             }
         } else {
             [sentTimestampsMissingMessage addObject:@(sentTimestamp)];
@@ -316,13 +323,12 @@ NSString *const OWSReadReceiptManagerAreReadReceiptsEnabled = @"areReadReceiptsE
     OWSAssertDebug(readReceiptProtos);
     OWSAssertDebug(transaction);
 
-    NSMutableArray<SSKProtoSyncMessageRead *> *receiptsMissingMessage = [NSMutableArray new];
-
+    NSMutableArray<SSKProtoSyncMessageRead *> *validReceiptProtos = [NSMutableArray new];
+    NSMutableOrderedSet<NSNumber *> *messageIdTimestamps = [NSMutableOrderedSet new];
     for (SSKProtoSyncMessageRead *readReceiptProto in readReceiptProtos) {
-        SignalServiceAddress *_Nullable senderAddress = readReceiptProto.senderAddress;
         uint64_t messageIdTimestamp = readReceiptProto.timestamp;
 
-        OWSAssertDebug(senderAddress.isValid);
+        OWSAssertDebug(readReceiptProto.senderAddress.isValid);
 
         if (messageIdTimestamp == 0) {
             OWSFailDebug(@"messageIdTimestamp was unexpectedly 0");
@@ -332,75 +338,153 @@ NSString *const OWSReadReceiptManagerAreReadReceiptsEnabled = @"areReadReceiptsE
             OWSFailDebug(@"Invalid messageIdTimestamp.");
             continue;
         }
+        [validReceiptProtos addObject:readReceiptProto];
+        [messageIdTimestamps addObject:@(messageIdTimestamp)];
+    }
+
+    // A linked device can mark many messages as read at once, so look up
+    // the messages for all of the receipts together rather than one receipt
+    // at a time.
+    NSError *error;
+    NSArray<TSMessage *> *messages = (NSArray<TSMessage *> *)[InteractionFinder
+        interactionsWithTimestamps:messageIdTimestamps.array
+                            filter:^(TSInteraction *interaction) {
+                                return [interaction isKindOfClass:[TSMessage class]];
+                            }
+                       transaction:transaction
+                             error:&error];
+    if (error != nil) {
+        OWSFailDebug(@"Error loading interactions: %@", error);
+    }
 
-        NSError *error;
-        NSArray<TSMessage *> *messages = (NSArray<TSMessage *> *)[InteractionFinder
-            interactionsWithTimestamp:messageIdTimestamp
-                               filter:^(TSInteraction *interaction) {
-                                   return [interaction isKindOfClass:[TSMessage class]];
-                               }
-                          transaction:transaction
-                                error:&error];
-        if (error != nil) {
-            OWSFailDebug(@"Error loading interactions: %@", error);
+    NSMutableDictionary<NSNumber *, NSMutableArray<TSMessage *> *> *messagesByTimestamp = [NSMutableDictionary new];
+    for (TSMessage *message in messages) {
+        NSMutableArray<TSMessage *> *messagesWithTimestamp = messagesByTimestamp[@(message.timestamp)];
+        if (messagesWithTimestamp == nil) {
+            messagesWithTimestamp = [NSMutableArray new];
+            messagesByTimestamp[@(message.timestamp)] = messagesWithTimestamp;
         }
+        [messagesWithTimestamp addObject:message];
+    }
 
-        if (messages.count > 0) {
-            for (TSMessage *message in messages) {
-                TSThread *_Nullable thread = [message threadWithTransaction:transaction];
-                if (thread == nil) {
-                    OWSFailDebug(@"thread was unexpectedly nil");
-                    continue;
-                }
-                NSTimeInterval secondsSinceRead = [NSDate new].timeIntervalSince1970 - readTimestamp / 1000;
-                OWSAssertDebug([message isKindOfClass:[TSMessage class]]);
-                OWSLogDebug(@"read on linked device %f seconds ago", secondsSinceRead);
-                [self markAsReadOnLinkedDevice:message
-                                        thread:thread
-                                 readTimestamp:readTimestamp
-                                   transaction:transaction];
-            }
-        } else {
+    NSMutableArray<SSKProtoSyncMessageRead *> *receiptsMissingMessage = [NSMutableArray new];
+    NSMutableOrderedSet<NSString *> *threadIds = [NSMutableOrderedSet new];
+    NSMutableDictionary<NSString *, NSMutableOrderedSet<TSMessage *> *> *messagesByThreadId =
+        [NSMutableDictionary new];
+    for (SSKProtoSyncMessageRead *readReceiptProto in validReceiptProtos) {
+        NSArray<TSMessage *> *_Nullable messagesWithTimestamp = messagesByTimestamp[@(readReceiptProto.timestamp)];
+        if (messagesWithTimestamp.count < 1) {
             [receiptsMissingMessage addObject:readReceiptProto];
+            continue;
+        }
+        for (TSMessage *message in messagesWithTimestamp) {
+            NSMutableOrderedSet<TSMessage *> *threadMessages = messagesByThreadId[message.uniqueThreadId];
+            if (threadMessages == nil) {
+                threadMessages = [NSMutableOrderedSet new];
+                messagesByThreadId[message.uniqueThreadId] = threadMessages;
+                [threadIds addObject:message.uniqueThreadId];
+            }
+            [threadMessages addObject:message];
         }
     }
 
+    NSTimeInterval secondsSinceRead = [NSDate new].timeIntervalSince1970 - readTimestamp / 1000;
+    OWSLogDebug(@"read on linked device %f seconds ago", secondsSinceRead);
+
+    // Apply the receipts a thread at a time, in one batch of receipts.
+    [self.outgoingReceiptManager batchReadReceiptsWithTransaction:transaction
+                                                            block:^{
+                                                                for (NSString *threadId in threadIds) {
+                                                                    NSArray<TSMessage *> *threadMessages
+                                                                        = messagesByThreadId[threadId].array;
+                                                                    [self markMessagesAsReadOnLinkedDevice:threadMessages
+                                                                                             readTimestamp:readTimestamp
+                                                                                               transaction:transaction];
+                                                                }
+                                                            }];
+
     return [receiptsMissingMessage copy];
 }
 
+// All of the messages should belong to the same thread.
+- (void)markMessagesAsReadOnLinkedDevice:(NSArray<TSMessage *> *)messages
+                           readTimestamp:(uint64_t)readTimestamp
+                             transaction:(SDSAnyWriteTransaction *)transaction
+{
+    OWSAssertDebug(messages.count > 0);
+    OWSAssertDebug(transaction);
+
+    TSThread *_Nullable thread = [messages.firstObject threadWithTransaction:transaction];
+    if (thread == nil) {
+        OWSFailDebug(@"thread was unexpectedly nil");
+        return;
+    }
+    [self markMessagesAsReadOnLinkedDevice:messages thread:thread readTimestamp:readTimestamp transaction:transaction];
+}
+
 - (void)markAsReadOnLinkedDevice:(TSMessage *)message
                           thread:(TSThread *)thread
                    readTimestamp:(uint64_t)readTimestamp
                      transaction:(SDSAnyWriteTransaction *)transaction
 {
     OWSAssertDebug(message);
+
+    [self markMessagesAsReadOnLinkedDevice:@[ message ]
+                                    thread:thread
+                             readTimestamp:readTimestamp
+                               transaction:transaction];
+}
+
+- (void)markMessagesAsReadOnLinkedDevice:(NSArray<TSMessage *> *)messages
+                                  thread:(TSThread *)thread
+                           readTimestamp:(uint64_t)readTimestamp
+                             transaction:(SDSAnyWriteTransaction *)transaction
+{
+    OWSAssertDebug(messages.count > 0);
     OWSAssertDebug(thread);
     OWSAssertDebug(transaction);
 
-    if ([message isKindOfClass:[TSIncomingMessage class]]) {
-        TSIncomingMessage *incomingMessage = (TSIncomingMessage *)message;
-        BOOL hasPendingMessageRequest = [thread hasPendingMessageRequestWithTransaction:transaction.unwrapGrdbRead];
-        OWSReadCircumstance circumstance = hasPendingMessageRequest
-            ? OWSReadCircumstanceReadOnLinkedDeviceWhilePendingMessageRequest
-            : OWSReadCircumstanceReadOnLinkedDevice;
+    TSIncomingMessage *_Nullable latestIncomingMessage;
+    OWSReadCircumstance circumstance = OWSReadCircumstanceReadOnLinkedDevice;
+    for (TSMessage *message in messages) {
+        OWSAssertDebug([message.uniqueThreadId isEqualToString:thread.uniqueId]);
+
+        if ([message isKindOfClass:[TSIncomingMessage class]]) {
+            TSIncomingMessage *incomingMessage = (TSIncomingMessage *)message;
+            if (latestIncomingMessage == nil) {
+                BOOL hasPendingMessageRequest =
+                    [thread hasPendingMessageRequestWithTransaction:transaction.unwrapGrdbRead];
+                circumstance = hasPendingMessageRequest
+                    ? OWSReadCircumstanceReadOnLinkedDeviceWhilePendingMessageRequest
+                    : OWSReadCircumstanceReadOnLinkedDevice;
+            }
 
-        // Always re-mark the message as read to ensure any earlier read time is applied to disappearing messages.
-        [incomingMessage markAsReadAtTimestamp:readTimestamp
-                                        thread:thread
-                                  circumstance:circumstance
-                                   transaction:transaction];
+            // Always re-mark the message as read to ensure any earlier read time is applied to disappearing
+            // messages.
+            [incomingMessage markAsReadAtTimestamp:readTimestamp
+                                            thread:thread
+                                      circumstance:circumstance
+                                       transaction:transaction];
 
+            if (latestIncomingMessage == nil || incomingMessage.sortId > latestIncomingMessage.sortId) {
+                latestIncomingMessage = incomingMessage;
+            }
+        } else if ([message isKindOfClass:[TSOutgoingMessage class]]) {
+            // Outgoing messages are always "read", but if we get a receipt
+            // from our linked device about one that indicates that any reactions
+            // we received on this message should also be marked read.
+            [message markUnreadReactionsAsReadWithTransaction:transaction];
+        }
+    }
+
+    if (latestIncomingMessage != nil) {
         // Also mark any unread messages appearing earlier in the thread as read as well.
-        [self markAsReadBeforeSortId:incomingMessage.sortId
+        // Doing so once, for the latest message, covers every other message.
+        [self markAsReadBeforeSortId:latestIncomingMessage.sortId
                               thread:thread
                        readTimestamp:readTimestamp
                         circumstance:circumstance
                          transaction:transaction];
-    } else if ([message isKindOfClass:[TSOutgoingMessage class]]) {
-        // Outgoing messages are always "read", but if we get a receipt
-        // from our linked device about one that indicates that any reactions
-        // we received on this message should also be marked read.
-        [message markUnreadReactionsAsReadWithTransaction:transaction];
     }
 }
 
@@ -454,9 +538,15 @@ NSString *const OWSReadReceiptManagerAreReadReceiptsEnabled = @"areReadReceiptsE
                 (unsigned long)unreadMessages.count);
             break;
     }
-    for (id<OWSReadTracking> readItem in unreadMessages) {
-        [readItem markAsReadAtTimestamp:readTimestamp thread:thread circumstance:circumstance transaction:transaction];
-    }
+    [self.outgoingReceiptManager batchReadReceiptsWithTransaction:transaction
+                                                            block:^{
+                                                                for (id<OWSReadTracking> readItem in unreadMessages) {
+                                                                    [readItem markAsReadAtTimestamp:readTimestamp
+                                                                                             thread:thread
+                                                                                       circumstance:circumstance
+                                                                                        transaction:transaction];
+                                                                }
+                                                            }];
 }
 
 #pragma mark - Settings
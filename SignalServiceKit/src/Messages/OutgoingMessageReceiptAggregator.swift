@@ -0,0 +1,121 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Gathers the delivery and read receipts for outgoing messages within a
+/// batch of incoming messages and applies them with one update per message.
+///
+/// In large groups a single outgoing message can receive hundreds of
+/// receipts. Without aggregation, each receipt loads and rewrites that
+/// message's row.
+///
+/// An aggregator is bound to the write transaction of the batch that
+/// created it; receipts processed in any other transaction are applied
+/// immediately, as before.
+@objc
+public class OutgoingMessageReceiptAggregator: NSObject {
+
+    private class PendingReceipts {
+        var message: TSOutgoingMessage
+        var deliveryTimestamps = [SignalServiceAddress: NSNumber]()
+        var readTimestamps = [SignalServiceAddress: NSNumber]()
+
+        init(message: TSOutgoingMessage) {
+            self.message = message
+        }
+    }
+
+    // Keyed by message uniqueId, in the order we first received a receipt for each message.
+    private var pendingReceiptsMap = [String: PendingReceipts]()
+    private var pendingMessageIds = [String]()
+
+    private static let unfairLock = UnfairLock()
+
+    // This property should only be accessed with unfairLock.
+    private static var aggregatorMap = [ObjectIdentifier: OutgoingMessageReceiptAggregator]()
+
+    /// Aggregates the receipts processed by `block`, then applies them
+    /// within the same transaction.
+    @objc
+    public class func aggregateReceipts(transaction: SDSAnyWriteTransaction, block: () -> Void) {
+        let key = ObjectIdentifier(transaction)
+        let aggregator = OutgoingMessageReceiptAggregator()
+        let isNested: Bool = unfairLock.withLock {
+            guard aggregatorMap[key] == nil else {
+                return true
+            }
+            aggregatorMap[key] = aggregator
+            return false
+        }
+        guard !isNested else {
+            // Receipts will be applied by the outer aggregator.
+            block()
+            return
+        }
+
+        block()
+
+        unfairLock.withLock {
+            _ = aggregatorMap.removeValue(forKey: key)
+        }
+        aggregator.applyReceipts(transaction: transaction)
+    }
+
+    /// Returns the aggregator for this transaction, if its receipts are being aggregated.
+    @objc
+    public class func aggregator(transaction: SDSAnyWriteTransaction) -> OutgoingMessageReceiptAggregator? {
+        unfairLock.withLock {
+            aggregatorMap[ObjectIdentifier(transaction)]
+        }
+    }
+
+    // deliveryTimestamp is nil for legacy delivery receipts.
+    @objc
+    public func addDeliveryReceipt(message: TSOutgoingMessage,
+                                   recipientAddress: SignalServiceAddress,
+                                   deliveryTimestamp: NSNumber?) {
+        // If delivery notification doesn't include timestamp, use "now" as an estimate.
+        let deliveryTimestamp = deliveryTimestamp ?? NSNumber(value: NSDate.ows_millisecondTimeStamp())
+        pendingReceipts(message: message).deliveryTimestamps[recipientAddress] = deliveryTimestamp
+    }
+
+    @objc
+    public func addReadReceipt(message: TSOutgoingMessage,
+                               recipientAddress: SignalServiceAddress,
+                               readTimestamp: UInt64) {
+        pendingReceipts(message: message).readTimestamps[recipientAddress] = NSNumber(value: readTimestamp)
+    }
+
+    private func pendingReceipts(message: TSOutgoingMessage) -> PendingReceipts {
+        if let pendingReceipts = pendingReceiptsMap[message.uniqueId] {
+            pendingReceipts.message = message
+            return pendingReceipts
+        }
+        let pendingReceipts = PendingReceipts(message: message)
+        pendingReceiptsMap[message.uniqueId] = pendingReceipts
+        pendingMessageIds.append(message.uniqueId)
+        return pendingReceipts
+    }
+
+    private func applyReceipts(transaction: SDSAnyWriteTransaction) {
+        for messageId in pendingMessageIds {
+            guard let pendingReceipts = pendingReceiptsMap[messageId] else {
+                owsFailDebug("Missing pending receipts.")
+                continue
+            }
+            pendingReceipts.message.update(withDeliveryTimestamps: pendingReceipts.deliveryTimestamps,
+                                           readTimestamps: pendingReceipts.readTimestamps,
+                                           transaction: transaction)
+        }
+        if DebugFlags.isMessageProcessingVerbose, !pendingMessageIds.isEmpty {
+            let receiptCount = pendingReceiptsMap.values.reduce(0) {
+                $0 + $1.deliveryTimestamps.count + $1.readTimestamps.count
+            }
+            Logger.verbose("Applied \(receiptCount) receipts to \(pendingMessageIds.count) messages.")
+        }
+        pendingReceiptsMap.removeAll()
+        pendingMessageIds.removeAll()
+    }
+}
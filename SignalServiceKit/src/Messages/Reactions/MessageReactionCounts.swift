@@ -0,0 +1,128 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+/// Per-message reaction counts for each emoji, so that rendering a message
+/// doesn't need to load and group all of its reactions.
+///
+/// The counts are maintained by triggers on the reactions table, so they
+/// stay correct for every insert and delete, including the bulk delete of a
+/// message's reactions which bypasses the models.
+public class MessageReactionCounts {
+
+    public static let databaseTableName = "message_reaction_counts"
+
+    // MARK: - Schema
+
+    private static func incrementSql(_ row: String) -> String {
+        """
+        INSERT OR IGNORE INTO \(databaseTableName) (uniqueMessageId, emoji)
+        VALUES (\(row).\(reactionColumn: .uniqueMessageId), \(row).\(reactionColumn: .emoji));
+        UPDATE \(databaseTableName)
+        SET reactionCount = reactionCount + 1,
+            mostRecentReactionId = MAX(mostRecentReactionId, \(row).\(reactionColumn: .id))
+        WHERE uniqueMessageId = \(row).\(reactionColumn: .uniqueMessageId)
+        AND emoji = \(row).\(reactionColumn: .emoji);
+        """
+    }
+
+    private static func decrementSql(_ row: String) -> String {
+        """
+        UPDATE \(databaseTableName)
+        SET reactionCount = reactionCount - 1,
+            mostRecentReactionId = COALESCE((
+                SELECT MAX(reaction.\(reactionColumn: .id))
+                FROM \(ReactionRecord.databaseTableName) AS reaction
+                WHERE reaction.\(reactionColumn: .uniqueMessageId) = \(row).\(reactionColumn: .uniqueMessageId)
+                AND reaction.\(reactionColumn: .emoji) = \(row).\(reactionColumn: .emoji)
+            ), 0)
+        WHERE uniqueMessageId = \(row).\(reactionColumn: .uniqueMessageId)
+        AND emoji = \(row).\(reactionColumn: .emoji);
+        DELETE FROM \(databaseTableName)
+        WHERE uniqueMessageId = \(row).\(reactionColumn: .uniqueMessageId)
+        AND emoji = \(row).\(reactionColumn: .emoji)
+        AND reactionCount <= 0;
+        """
+    }
+
+    static var createTableAndTriggersSql: String {
+        let reactionTable = ReactionRecord.databaseTableName
+        // Models are always saved in full, so the update trigger checks
+        // whether the values it cares about actually changed.
+        return """
+        CREATE TABLE \(databaseTableName) (
+            uniqueMessageId TEXT NOT NULL,
+            emoji TEXT NOT NULL,
+            reactionCount INTEGER NOT NULL DEFAULT 0,
+            mostRecentReactionId INTEGER NOT NULL DEFAULT 0,
+            PRIMARY KEY (uniqueMessageId, emoji)
+        );
+
+        CREATE TRIGGER \(databaseTableName)_on_insert
+        AFTER INSERT ON \(reactionTable)
+        BEGIN
+            \(incrementSql("NEW"))
+        END;
+
+        CREATE TRIGGER \(databaseTableName)_on_delete
+        AFTER DELETE ON \(reactionTable)
+        BEGIN
+            \(decrementSql("OLD"))
+        END;
+
+        CREATE TRIGGER \(databaseTableName)_on_update
+        AFTER UPDATE OF \(reactionColumn: .uniqueMessageId), \(reactionColumn: .emoji)
+        ON \(reactionTable)
+        WHEN OLD.\(reactionColumn: .uniqueMessageId) IS NOT NEW.\(reactionColumn: .uniqueMessageId)
+        OR OLD.\(reactionColumn: .emoji) IS NOT NEW.\(reactionColumn: .emoji)
+        BEGIN
+            \(decrementSql("OLD"))
+            \(incrementSql("NEW"))
+        END;
+        """
+    }
+
+    private static var rebuildSql: String {
+        """
+        DELETE FROM \(databaseTableName);
+        INSERT INTO \(databaseTableName) (uniqueMessageId, emoji, reactionCount, mostRecentReactionId)
+        SELECT reaction.\(reactionColumn: .uniqueMessageId),
+               reaction.\(reactionColumn: .emoji),
+               COUNT(*),
+               MAX(reaction.\(reactionColumn: .id))
+        FROM \(ReactionRecord.databaseTableName) AS reaction
+        GROUP BY reaction.\(reactionColumn: .uniqueMessageId), reaction.\(reactionColumn: .emoji);
+        """
+    }
+
+    static func rebuild(database: Database) throws {
+        try database.execute(sql: rebuildSql)
+    }
+
+    // MARK: - Counts
+
+    private static let emojiCountsSql = """
+        SELECT emoji, reactionCount
+        FROM \(databaseTableName)
+        WHERE uniqueMessageId = ?
+        ORDER BY mostRecentReactionId DESC
+        """
+
+    /// The number of reactions with each emoji, exactly as reacted (i.e.
+    /// including skin tones), ordered by the most recent such reaction.
+    public static func emojiCounts(uniqueMessageId: String,
+                                   transaction: GRDBReadTransaction) -> [(emoji: String, count: Int)] {
+        do {
+            let request = SQLRequest<Row>(sql: emojiCountsSql, arguments: [uniqueMessageId], cached: true)
+            return try Row.fetchAll(transaction.database, request).map { row in
+                (emoji: row[0], count: row[1])
+            }
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return []
+        }
+    }
+}
@@ -0,0 +1,288 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// The first message we send to a device without a session has to wait
+// for a prekey fetch. SessionPrewarmer creates sessions ahead of time
+// for the devices of recently active contacts and group members, while
+// we're on Wi-Fi and have no message sends in flight.
+//
+// Each session we create uses up one of the contact's one-time prekeys,
+// so we only prewarm sessions for contacts we have no session with at
+// all in the threads we've used most recently, and only a few per pass.
+@objc
+public class SessionPrewarmer: NSObject {
+
+    @objc
+    public static let shared = SessionPrewarmer()
+
+    // MARK: - Dependencies
+
+    private var databaseStorage: SDSDatabaseStorage {
+        return .shared
+    }
+
+    private var tsAccountManager: TSAccountManager {
+        return .shared()
+    }
+
+    private var sessionStore: SSKSessionStore {
+        return SSKEnvironment.shared.sessionStore
+    }
+
+    private var reachabilityManager: SSKReachabilityManager {
+        return SSKEnvironment.shared.reachabilityManager
+    }
+
+    // MARK: -
+
+    // We only consider the members of this many of the most recently
+    // active threads, if they've been active within maxThreadAgeMs.
+    static let maxThreadCount = 10
+    static let maxThreadAgeMs: UInt64 = 7 * kDayInMs
+
+    // We create at most this many sessions per pass.
+    static let maxSessionsPerPass = 8
+
+    static let minIntervalBetweenPasses: TimeInterval = 6 * kHourInterval
+
+    // Wait this long after the app becomes ready, so that we don't
+    // compete with launch and the initial message fetch.
+    static let launchDelay: TimeInterval = 10
+
+    private let serialQueue = DispatchQueue(label: "org.signal.sessionPrewarmer", qos: .utility)
+
+    // This property should only be accessed on serialQueue.
+    private var isPassInFlight = false
+
+    // This property should only be accessed on serialQueue.
+    private var lastPassDate: Date?
+
+    private let unfairLock = UnfairLock()
+
+    // Sessions we've created that haven't yet been used by a message send.
+    // This property should only be accessed with unfairLock.
+    private var prewarmedSessionKeys = Set<String>()
+
+    // MARK: - Metrics
+
+    private let _prewarmedSessionCount = AtomicUInt(0)
+    private let _hitCount = AtomicUInt(0)
+    private let _missCount = AtomicUInt(0)
+
+    /// The number of sessions created by the prewarmer.
+    @objc
+    public var prewarmedSessionCount: UInt { _prewarmedSessionCount.get() }
+
+    /// The number of devices a message send found a prewarmed session for.
+    @objc
+    public var hitCount: UInt { _hitCount.get() }
+
+    /// The number of devices a message send had to fetch a prekey bundle for.
+    @objc
+    public var missCount: UInt { _missCount.get() }
+
+    // MARK: -
+
+    @objc
+    public override init() {
+        super.init()
+
+        SwiftSingletons.register(self)
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(reachabilityDidChange),
+                                               name: SSKReachability.owsReachabilityDidChange,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    @objc
+    private func reachabilityDidChange() {
+        schedulePrewarming(delay: 0)
+    }
+
+    @objc
+    public func schedulePrewarming() {
+        schedulePrewarming(delay: Self.launchDelay)
+    }
+
+    private func schedulePrewarming(delay: TimeInterval) {
+        guard CurrentAppContext().isMainApp,
+              !CurrentAppContext().isRunningTests else {
+            return
+        }
+        serialQueue.asyncAfter(deadline: .now() + delay) {
+            self.prewarmSessionsIfNecessary()
+        }
+    }
+
+    // MARK: - Metrics
+
+    func recordSessionLookup(accountId: AccountId,
+                             deviceIds: [UInt32],
+                             deviceIdsWithoutSessions: [UInt32]) {
+        if !deviceIdsWithoutSessions.isEmpty {
+            _missCount.add(UInt(deviceIdsWithoutSessions.count))
+        }
+
+        let deviceIdsWithSessions = Set(deviceIds).subtracting(deviceIdsWithoutSessions)
+        guard !deviceIdsWithSessions.isEmpty else {
+            return
+        }
+        let hitCount: Int = unfairLock.withLock {
+            guard !prewarmedSessionKeys.isEmpty else {
+                return 0
+            }
+            var hitCount = 0
+            for deviceId in deviceIdsWithSessions {
+                let key = Self.sessionKey(accountId: accountId, deviceId: deviceId)
+                if prewarmedSessionKeys.remove(key) != nil {
+                    hitCount += 1
+                }
+            }
+            return hitCount
+        }
+        if hitCount > 0 {
+            _hitCount.add(UInt(hitCount))
+        }
+    }
+
+    private static func sessionKey(accountId: AccountId, deviceId: UInt32) -> String {
+        return "\(accountId).\(deviceId)"
+    }
+
+    // MARK: -
+
+    private struct Candidate {
+        let address: SignalServiceAddress
+        let accountId: AccountId
+        let deviceId: UInt32
+    }
+
+    private func prewarmSessionsIfNecessary() {
+        assertOnQueue(serialQueue)
+
+        guard !isPassInFlight else {
+            return
+        }
+        if let lastPassDate = lastPassDate,
+           abs(lastPassDate.timeIntervalSinceNow) < Self.minIntervalBetweenPasses {
+            return
+        }
+        guard AppReadiness.isAppReady,
+              tsAccountManager.isRegisteredAndReady,
+              reachabilityManager.isReachable(via: .wifi) else {
+            return
+        }
+        guard !MessageSender.hasPendingMessageSends else {
+            // Try again once we're idle.
+            Logger.verbose("Deferring until message sends complete.")
+            schedulePrewarming()
+            return
+        }
+
+        isPassInFlight = true
+        lastPassDate = Date()
+
+        let candidates = databaseStorage.read { transaction in
+            self.candidates(transaction: transaction)
+        }
+        guard !candidates.isEmpty else {
+            isPassInFlight = false
+            return
+        }
+
+        Logger.info("Prewarming \(candidates.count) sessions.")
+
+        let prewarmedCount = AtomicUInt(0)
+        let prewarms = candidates.map { candidate in
+            return { () -> Promise<Void> in
+                MessageSender.prewarmSession(recipientAddress: candidate.address,
+                                             accountId: candidate.accountId,
+                                             deviceId: candidate.deviceId)
+                    .done(on: .global()) {
+                        prewarmedCount.increment()
+                        self._prewarmedSessionCount.increment()
+                        let key = Self.sessionKey(accountId: candidate.accountId, deviceId: candidate.deviceId)
+                        self.unfairLock.withLock {
+                            _ = self.prewarmedSessionKeys.insert(key)
+                        }
+                    }.recover(on: .global()) { (error: Error) -> Promise<Void> in
+                        // Prewarming is best effort; the first send to this
+                        // device will try again.
+                        Logger.warn("Could not prewarm session: \(error)")
+                        return Promise.value(())
+                    }
+            }
+        }
+        _ = MessageSender.performWithBoundedConcurrency(prewarms,
+                                                        maxConcurrency: MessageSender.maxConcurrentPrekeyFetches)
+            .ensure(on: serialQueue) {
+                Logger.info("Prewarmed \(prewarmedCount.get()) of \(candidates.count) sessions.")
+                self.isPassInFlight = false
+            }
+    }
+
+    private func candidates(transaction: SDSAnyReadTransaction) -> [Candidate] {
+        let threadIds: [String]
+        do {
+            threadIds = try AnyThreadFinder().visibleThreadIds(isArchived: false, transaction: transaction)
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return []
+        }
+
+        let minActiveTimestamp = NSDate.ows_millisecondTimeStamp() - Self.maxThreadAgeMs
+        var candidates = [Candidate]()
+        var visitedAddresses = Set<SignalServiceAddress>()
+        for threadId in threadIds.prefix(Self.maxThreadCount) {
+            guard let thread = TSThread.anyFetch(uniqueId: threadId, transaction: transaction) else {
+                continue
+            }
+            guard let lastInteraction = thread.lastInteractionForInbox(transaction: transaction),
+                  lastInteraction.receivedAtTimestamp >= minActiveTimestamp else {
+                continue
+            }
+            for address in thread.recipientAddresses {
+                guard !address.isLocalAddress,
+                      !visitedAddresses.contains(address) else {
+                    continue
+                }
+                visitedAddresses.insert(address)
+
+                guard let recipient = SignalRecipient.get(address: address,
+                                                          mustHaveDevices: true,
+                                                          transaction: transaction) else {
+                    continue
+                }
+                let deviceIds = recipient.devices.compactMap { ($0 as? NSNumber)?.uint32Value }
+                let hasAnySession = deviceIds.contains { deviceId in
+                    sessionStore.containsSession(forAccountId: recipient.accountId,
+                                                 deviceId: Int32(deviceId),
+                                                 transaction: transaction)
+                }
+                guard !hasAnySession else {
+                    // We've messaged this contact before; a new linked device
+                    // can wait for the next send.
+                    continue
+                }
+                for deviceId in deviceIds {
+                    candidates.append(Candidate(address: address,
+                                                accountId: recipient.accountId,
+                                                deviceId: deviceId))
+                    if candidates.count >= Self.maxSessionsPerPass {
+                        return candidates
+                    }
+                }
+            }
+        }
+        return candidates
+    }
+}
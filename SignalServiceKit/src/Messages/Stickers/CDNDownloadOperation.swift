@@ -55,6 +55,8 @@ open class CDNDownloadOperation: OWSOperation {
         firstly(on: .global()) { () -> Promise<OWSUrlDownloadResponse> in
             let headers = ["Content-Type": OWSMimeTypeApplicationOctetStream]
             let urlSession = self.cdn0urlSession
+            // Sticker downloads should yield to interactive traffic.
+            urlSession.requestPriority = .background
             return urlSession.urlDownloadTaskPromise(urlPath,
                                                      method: .get,
                                                      headers: headers) { [weak self] (task: URLSessionTask, progress: Progress) in
@@ -15,19 +15,16 @@ class DownloadStickerOperation: CDNDownloadOperation {
 
     // MARK: - Cache
 
-    private static let cache: NSCache<NSString, NSData> = {
-        let cache = NSCache<NSString, NSData>()
-        // Limits are imprecise/not strict.
-        cache.countLimit = 50
+    // Unlike NSCache, this can report how much memory it holds.
+    private static let cache: ShardedLRUCache<String, Data> = {
+        let cache = ShardedLRUCache<String, Data>(maxSize: 50) { $0.count }
+        MemoryAccountant.shared.register(cache, name: "Sticker data", sheddingPriority: .first)
         return cache
     }()
     private static let maxCacheDataLength: UInt = 100 * 1000
 
     public class func cachedData(for stickerInfo: StickerInfo) -> Data? {
-        guard let stickerData = cache.object(forKey: stickerInfo.asKey() as NSString) else {
-            return nil
-        }
-        return stickerData as Data
+        return cache.get(key: stickerInfo.asKey())
     }
 
     private class func setCachedData(_ data: Data,
@@ -35,7 +32,7 @@ class DownloadStickerOperation: CDNDownloadOperation {
         guard data.count <= maxCacheDataLength else {
             return
         }
-        cache.setObject(data as NSData, forKey: stickerInfo.asKey() as NSString)
+        cache.set(key: stickerInfo.asKey(), value: data)
     }
 
     // MARK: -
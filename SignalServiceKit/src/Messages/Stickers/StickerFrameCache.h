@@ -0,0 +1,40 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class StickerInfo;
+
+// A process-wide cache of decoded animated sticker frames.
+//
+// Frames are keyed by sticker, display size and frame index, so a sticker
+// shown by several views at the same size is only decoded once.
+@interface StickerFrameCache : NSObject
+
+@property (class, nonatomic, readonly) StickerFrameCache *shared;
+
+// Decoded frames are evicted once their total size exceeds this limit.
+@property (atomic) NSUInteger costLimitBytes;
+
+// The memory currently held by decoded frames.
+@property (atomic, readonly) NSUInteger currentCostBytes;
+
+// Returns an image which YYAnimatedImageView can display, or nil if the
+// sticker could not be parsed.
+//
+// pixelSize is the size the sticker will be displayed at, in pixels. Frames
+// are decoded at that size; pass CGSizeZero to decode them at their original
+// size.
+- (nullable UIImage *)animatedImageForStickerInfo:(StickerInfo *)stickerInfo
+                                   stickerDataUrl:(NSURL *)stickerDataUrl
+                                        pixelSize:(CGSize)pixelSize
+    NS_SWIFT_NAME(animatedImage(stickerInfo:stickerDataUrl:pixelSize:));
+
+- (void)removeAllFrames;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,312 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import "StickerFrameCache.h"
+#import "StickerInfo.h"
+#import <YYImage/YYImage.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSUInteger StickerFrameCost(UIImage *frame)
+{
+    CGImageRef _Nullable cgImage = frame.CGImage;
+    if (cgImage == NULL) {
+        return 0;
+    }
+    return CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage);
+}
+
+@interface StickerFrameCache () <NSCacheDelegate>
+
+- (nullable UIImage *)frameForKey:(NSString *)key;
+- (void)setFrame:(UIImage *)frame forKey:(NSString *)key;
+
+@end
+
+#pragma mark -
+
+// Vends frames from the shared frame cache, decoding them on demand.
+@interface StickerAnimatedImage : UIImage <YYAnimatedImage>
+
+@property (nonatomic, readonly) NSString *cacheKey;
+@property (nonatomic, readonly) YYImageDecoder *decoder;
+@property (nonatomic, readonly) CGSize pixelSize;
+@property (nonatomic, readonly) NSUInteger bytesPerFrame;
+@property (nonatomic, readonly) StickerFrameCache *frameCache;
+
+@end
+
+#pragma mark -
+
+@implementation StickerAnimatedImage
+
++ (nullable instancetype)imageWithDecoder:(YYImageDecoder *)decoder
+                                 cacheKey:(NSString *)cacheKey
+                                pixelSize:(CGSize)pixelSize
+                               frameCache:(StickerFrameCache *)frameCache
+{
+    UIImage *_Nullable firstFrame = [self decodeFrameAtIndex:0 decoder:decoder pixelSize:pixelSize];
+    if (firstFrame == nil || firstFrame.CGImage == NULL) {
+        return nil;
+    }
+    StickerAnimatedImage *image = [[self alloc] initWithCGImage:firstFrame.CGImage
+                                                          scale:firstFrame.scale
+                                                    orientation:UIImageOrientationUp];
+    if (image == nil) {
+        return nil;
+    }
+    image->_cacheKey = cacheKey;
+    image->_decoder = decoder;
+    image->_pixelSize = pixelSize;
+    image->_bytesPerFrame = StickerFrameCost(firstFrame);
+    image->_frameCache = frameCache;
+    image.yy_isDecodedForDisplay = YES;
+    return image;
+}
+
++ (nullable UIImage *)decodeFrameAtIndex:(NSUInteger)index decoder:(YYImageDecoder *)decoder pixelSize:(CGSize)pixelSize
+{
+    UIImage *_Nullable image = [decoder frameAtIndex:index decodeForDisplay:YES].image;
+    CGImageRef _Nullable cgImage = image.CGImage;
+    if (image == nil || cgImage == NULL) {
+        return nil;
+    }
+
+    size_t width = CGImageGetWidth(cgImage);
+    size_t height = CGImageGetHeight(cgImage);
+    if (width < 1 || height < 1) {
+        return nil;
+    }
+
+    // Only scale down, preserving the aspect ratio.
+    CGFloat scale = 1;
+    if (pixelSize.width > 0 && pixelSize.height > 0) {
+        scale = MIN(1, MIN(pixelSize.width / width, pixelSize.height / height));
+    }
+    if (scale >= 1) {
+        image.yy_isDecodedForDisplay = YES;
+        return image;
+    }
+
+    size_t scaledWidth = MAX(1, (size_t)round(width * scale));
+    size_t scaledHeight = MAX(1, (size_t)round(height * scale));
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef _Nullable context = CGBitmapContextCreate(NULL,
+        scaledWidth,
+        scaledHeight,
+        8,
+        0,
+        colorSpace,
+        kCGBitmapByteOrder32Host | kCGImageAlphaPremultipliedFirst);
+    CGColorSpaceRelease(colorSpace);
+    if (context == NULL) {
+        OWSFailDebug(@"Could not create context.");
+        return nil;
+    }
+    CGContextSetInterpolationQuality(context, kCGInterpolationHigh);
+    CGContextDrawImage(context, CGRectMake(0, 0, scaledWidth, scaledHeight), cgImage);
+    CGImageRef _Nullable scaledImage = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+    if (scaledImage == NULL) {
+        OWSFailDebug(@"Could not scale frame.");
+        return nil;
+    }
+
+    // Preserve the frame's size in points.
+    UIImage *frame = [UIImage imageWithCGImage:scaledImage
+                                         scale:image.scale * (CGFloat)scaledWidth / (CGFloat)width
+                                   orientation:UIImageOrientationUp];
+    CGImageRelease(scaledImage);
+    frame.yy_isDecodedForDisplay = YES;
+    return frame;
+}
+
+#pragma mark - YYAnimatedImage
+
+- (NSUInteger)animatedImageFrameCount
+{
+    return self.decoder.frameCount;
+}
+
+- (NSUInteger)animatedImageLoopCount
+{
+    return self.decoder.loopCount;
+}
+
+- (NSUInteger)animatedImageBytesPerFrame
+{
+    return self.bytesPerFrame;
+}
+
+- (nullable UIImage *)animatedImageFrameAtIndex:(NSUInteger)index
+{
+    NSString *key = [NSString stringWithFormat:@"%@.%lu", self.cacheKey, (unsigned long)index];
+    UIImage *_Nullable frame = [self.frameCache frameForKey:key];
+    if (frame != nil) {
+        return frame;
+    }
+
+    // Each view fetches frames on its own queue. Views showing the same
+    // sticker share this image, so decoding under its lock ensures that
+    // each frame is only decoded once.
+    @synchronized(self) {
+        frame = [self.frameCache frameForKey:key];
+        if (frame != nil) {
+            return frame;
+        }
+        frame = [StickerAnimatedImage decodeFrameAtIndex:index decoder:self.decoder pixelSize:self.pixelSize];
+        if (frame == nil) {
+            return nil;
+        }
+        [self.frameCache setFrame:frame forKey:key];
+        return frame;
+    }
+}
+
+- (NSTimeInterval)animatedImageDurationAtIndex:(NSUInteger)index
+{
+    return [self.decoder frameDurationAtIndex:index];
+}
+
+@end
+
+#pragma mark -
+
+@interface StickerFrameCache ()
+
+@property (nonatomic, readonly) NSCache<NSString *, UIImage *> *frames;
+
+// Views which show the same sticker at the same size share an image, and
+// therefore its decoder. Images are only retained by their views.
+//
+// This property should only be accessed while synchronized on self.
+@property (nonatomic, readonly) NSMapTable<NSString *, StickerAnimatedImage *> *images;
+
+@property (atomic) NSUInteger currentCostBytes;
+
+@end
+
+#pragma mark -
+
+@implementation StickerFrameCache
+
++ (StickerFrameCache *)shared
+{
+    static StickerFrameCache *instance;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        instance = [StickerFrameCache new];
+    });
+    return instance;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (!self) {
+        return self;
+    }
+
+    _frames = [NSCache new];
+    _frames.delegate = self;
+    _images = [NSMapTable strongToWeakObjectsMapTable];
+
+    // Budget 1/32 of physical memory for decoded frames, up to 64 MB.
+    self.costLimitBytes = (NSUInteger)MIN(64 * 1024 * 1024, NSProcessInfo.processInfo.physicalMemory / 32);
+
+    return self;
+}
+
+- (NSUInteger)costLimitBytes
+{
+    return self.frames.totalCostLimit;
+}
+
+- (void)setCostLimitBytes:(NSUInteger)costLimitBytes
+{
+    self.frames.totalCostLimit = costLimitBytes;
+}
+
+- (nullable UIImage *)animatedImageForStickerInfo:(StickerInfo *)stickerInfo
+                                   stickerDataUrl:(NSURL *)stickerDataUrl
+                                        pixelSize:(CGSize)pixelSize
+{
+    NSString *cacheKey = [NSString stringWithFormat:@"%@.%.0fx%.0f",
+                                   stickerInfo.asKey,
+                                   round(pixelSize.width),
+                                   round(pixelSize.height)];
+
+    @synchronized(self) {
+        StickerAnimatedImage *_Nullable image = [self.images objectForKey:cacheKey];
+        if (image != nil) {
+            return image;
+        }
+    }
+
+    NSData *_Nullable data = [NSData dataWithContentsOfURL:stickerDataUrl options:NSDataReadingMappedIfSafe error:nil];
+    if (data == nil) {
+        OWSLogWarn(@"Could not read sticker data.");
+        return nil;
+    }
+    YYImageDecoder *_Nullable decoder = [YYImageDecoder decoderWithData:data scale:1];
+    if (decoder == nil || decoder.frameCount < 1) {
+        OWSLogWarn(@"Could not parse sticker.");
+        return nil;
+    }
+    StickerAnimatedImage *_Nullable image = [StickerAnimatedImage imageWithDecoder:decoder
+                                                                          cacheKey:cacheKey
+                                                                         pixelSize:pixelSize
+                                                                        frameCache:self];
+    if (image == nil) {
+        OWSLogWarn(@"Could not decode sticker.");
+        return nil;
+    }
+
+    @synchronized(self) {
+        // Another view may have loaded the same sticker in the meantime.
+        StickerAnimatedImage *_Nullable existingImage = [self.images objectForKey:cacheKey];
+        if (existingImage != nil) {
+            return existingImage;
+        }
+        [self.images setObject:image forKey:cacheKey];
+    }
+    return image;
+}
+
+- (nullable UIImage *)frameForKey:(NSString *)key
+{
+    return [self.frames objectForKey:key];
+}
+
+- (void)setFrame:(UIImage *)frame forKey:(NSString *)key
+{
+    NSUInteger cost = StickerFrameCost(frame);
+    @synchronized(self) {
+        self.currentCostBytes += cost;
+    }
+    [self.frames setObject:frame forKey:key cost:cost];
+}
+
+- (void)removeAllFrames
+{
+    [self.frames removeAllObjects];
+}
+
+#pragma mark - NSCacheDelegate
+
+- (void)cache:(NSCache *)cache willEvictObject:(id)object
+{
+    if (![object isKindOfClass:[UIImage class]]) {
+        OWSFailDebug(@"Unexpected object.");
+        return;
+    }
+    NSUInteger cost = StickerFrameCost(object);
+    @synchronized(self) {
+        self.currentCostBytes -= MIN(cost, self.currentCostBytes);
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
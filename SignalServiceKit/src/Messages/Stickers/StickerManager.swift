@@ -101,6 +101,12 @@ public class StickerManager: NSObject {
             StickerManager.shared.warmTooltipState()
         }
         AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+            // The NSE shouldn't spend its time or memory on sticker housekeeping
+            // or downloads; the main app will do them.
+            guard CurrentAppContext().isMainApp else {
+                return
+            }
+
             StickerManager.cleanupOrphans()
 
             if TSAccountManager.shared().isRegisteredAndReady {
@@ -406,15 +412,24 @@ public class StickerManager: NSObject {
         var fetches = [Promise<Void>]()
 
         // The cover.
-        fetches.append(tryToDownloadAndInstallSticker(stickerPack: stickerPack, item: stickerPack.cover, transaction: transaction))
+        fetches.append(tryToDownloadAndInstallSticker(stickerPack: stickerPack,
+                                                      item: stickerPack.cover,
+                                                      priority: .normal,
+                                                      transaction: transaction))
 
         guard !onlyInstallCover else {
             return when(fulfilled: fetches)
         }
 
         // The stickers.
+        //
+        // These are prefetched at low priority, so that a large pack doesn't
+        // hold up downloads of stickers the user is waiting to see.
         for item in stickerPack.items {
-            fetches.append(tryToDownloadAndInstallSticker(stickerPack: stickerPack, item: item, transaction: transaction))
+            fetches.append(tryToDownloadAndInstallSticker(stickerPack: stickerPack,
+                                                          item: item,
+                                                          priority: .low,
+                                                          transaction: transaction))
         }
         return when(fulfilled: fetches)
     }
@@ -717,6 +732,7 @@ public class StickerManager: NSObject {
 
     private class func tryToDownloadAndInstallSticker(stickerPack: StickerPack,
                                                       item: StickerPackItem,
+                                                      priority: Operation.QueuePriority,
                                                       transaction: SDSAnyReadTransaction) -> Promise<Void> {
         let stickerInfo: StickerInfo = item.stickerInfo(with: stickerPack)
         let emojiString = item.emojiString
@@ -726,7 +742,7 @@ public class StickerManager: NSObject {
             return Promise.value(())
         }
 
-        return tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo)
+        return shared.tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo, priority: priority)
             .done(on: DispatchQueue.global()) { (stickerData) in
                 self.installSticker(stickerInfo: stickerInfo,
                                     stickerData: stickerData,
@@ -735,9 +751,10 @@ public class StickerManager: NSObject {
         }
     }
 
-    private struct StickerDownload {
+    private class StickerDownload {
         let promise: Promise<Data>
         let resolver: Resolver<Data>
+        weak var operation: Operation?
 
         init() {
             let (promise, resolver) = Promise<Data>.pending()
@@ -756,12 +773,18 @@ public class StickerManager: NSObject {
     }()
 
     private func tryToDownloadSticker(stickerPack: StickerPack,
-                                      stickerInfo: StickerInfo) -> Promise<Data> {
+                                      stickerInfo: StickerInfo,
+                                      priority: Operation.QueuePriority) -> Promise<Data> {
         if let data = DownloadStickerOperation.cachedData(for: stickerInfo) {
             return Promise.value(data)
         }
         return stickerDownloadQueue.sync { () -> Promise<Data> in
             if let stickerDownload = stickerDownloadMap[stickerInfo.asKey()] {
+                // A prefetched sticker may be needed sooner than expected.
+                if let operation = stickerDownload.operation,
+                   operation.queuePriority.rawValue < priority.rawValue {
+                    operation.queuePriority = priority
+                }
                 return stickerDownload.promise
             }
 
@@ -787,6 +810,8 @@ public class StickerManager: NSObject {
                                                         }
                                                         stickerDownload.resolver.reject(error)
             })
+            operation.queuePriority = priority
+            stickerDownload.operation = operation
             self.stickerOperationQueue.addOperation(operation)
             return stickerDownload.promise
         }
@@ -794,8 +819,9 @@ public class StickerManager: NSObject {
 
     // This method is public so that we can download "transient" (uninstalled) stickers.
     public class func tryToDownloadSticker(stickerPack: StickerPack,
-                                           stickerInfo: StickerInfo) -> Promise<Data> {
-        shared.tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo)
+                                           stickerInfo: StickerInfo,
+                                           priority: Operation.QueuePriority = .normal) -> Promise<Data> {
+        shared.tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo, priority: priority)
     }
 
     // MARK: - Emoji
@@ -73,13 +73,8 @@ public class TypingIndicatorMessage: TSOutgoingMessage {
             typingBuilder.setGroupID(groupThread.groupModel.groupId)
         }
 
-        let contentBuilder = SSKProtoContent.builder()
-
         do {
-            contentBuilder.setTypingMessage(try typingBuilder.build())
-
-            let data = try contentBuilder.buildSerializedData()
-            return data
+            return try SSKProtoContent.serializedData(typingMessage: try typingBuilder.build())
         } catch let error {
             owsFailDebug("failed to build content: \(error)")
             return nil
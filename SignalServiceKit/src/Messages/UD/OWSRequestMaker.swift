@@ -41,6 +41,8 @@ public class RequestMakerResult: NSObject {
 //
 // * UD auth-to-Non-UD auth failover.
 // * Websocket-to-REST failover.
+//
+// SocketRequestRouter decides whether the websocket is used.
 @objc(OWSRequestMaker)
 public class RequestMaker: NSObject {
 
@@ -79,6 +81,10 @@ public class RequestMaker: NSObject {
         return SSKEnvironment.shared.socketManager
     }
 
+    private var socketRequestRouter: SocketRequestRouter {
+        return SocketRequestRouter.shared
+    }
+
     private var networkManager: TSNetworkManager {
         return SSKEnvironment.shared.networkManager
     }
@@ -120,11 +126,13 @@ public class RequestMaker: NSObject {
         guard let request: TSRequest = requestFactoryBlock(udAccessForRequest?.udAccessKey) else {
             return Promise(error: RequestMakerError.requestCreationFailed)
         }
-        let canMakeWebsocketRequests = (socketManager.canMakeRequests() && !skipWebsocket && !isUDRequest)
+        let canMakeWebsocketRequests = (!skipWebsocket && socketRequestRouter.shouldUseWebsocket(for: request))
 
         if canMakeWebsocketRequests {
             return Promise { resolver in
                 socketManager.make(request, success: { (responseObject: Any?) in
+                    self.socketRequestRouter.websocketRequestDidSucceed()
+
                     if self.udManager.isUDVerboseLoggingEnabled() {
                         if isUDRequest {
                             Logger.debug("UD websocket request '\(self.label)' succeeded.")
@@ -140,6 +148,7 @@ public class RequestMaker: NSObject {
                                                         wasSentByWebsocket: true))
                     },
                                    failure: { (statusCode: Int, responseData: Data?, error: Error) in
+                                    self.socketRequestRouter.websocketRequestDidFail(statusCode: statusCode)
                                     resolver.reject(RequestMakerError.websocketRequestError(statusCode: statusCode, responseData: responseData, underlyingError: error))
                     })
                 }.recover(on: .global()) { (error: Error) -> Promise<RequestMakerResult> in
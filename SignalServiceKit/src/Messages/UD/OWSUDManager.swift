@@ -120,6 +120,11 @@ public class OWSUDSendingAccess: NSObject {
                          requireSyncAccess: Bool,
                          senderCertificates: SenderCertificates) -> OWSUDSendingAccess?
 
+    @objc
+    func udSendingAccessMap(forAddresses addresses: [SignalServiceAddress],
+                            requireSyncAccess: Bool,
+                            senderCertificates: SenderCertificates) -> [SignalServiceAddress: OWSUDSendingAccess]
+
     // MARK: Sender Certificate
 
     // We use completion handlers instead of a promise so that message sending
@@ -180,6 +185,24 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
     private var phoneNumberAccessCache = [String: UnidentifiedAccessMode]()
     private var uuidAccessCache = [UUID: UnidentifiedAccessMode]()
 
+    // Deriving a UD access key requires a database read and an HMAC,
+    // and group sends derive one for every member. We cache the derived
+    // keys (or their absence) by address.
+    //
+    // Entries are versioned. Invalidating an address (or the whole cache)
+    // bumps the version, and we discard any entry whose lookup began
+    // before the most recent invalidation that applies to it.
+    private struct CachedUDAccessKey {
+        let version: UInt64
+        let udAccessKey: SMKUDAccessKey?
+    }
+
+    // These properties should only be accessed using unfairLock.
+    private var udAccessKeyCache = [SignalServiceAddress: CachedUDAccessKey]()
+    private var udAccessKeyCacheVersion: UInt64 = 0
+    private var udAccessKeyCacheResetVersion: UInt64 = 0
+    private var udAccessKeyInvalidationVersions = [SignalServiceAddress: UInt64]()
+
     @objc
     public required override init() {
         self.certificateValidator = SMKCertificateDefaultValidator(trustRoot: OWSUDManagerImpl.trustRoot())
@@ -242,6 +265,18 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
                                                selector: #selector(didBecomeActive),
                                                name: .OWSApplicationDidBecomeActive,
                                                object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(otherUsersProfileDidChange(notification:)),
+                                               name: .otherUsersProfileDidChange,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(localProfileDidChange),
+                                               name: .localProfileDidChange,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveCrossProcessNotification),
+                                               name: SDSDatabaseStorage.didReceiveCrossProcessNotification,
+                                               object: nil)
 
         // We can fill in any missing sender certificate async;
         // message sending will fill in the sender certificate sooner
@@ -270,6 +305,28 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
         _ = ensureSenderCertificates(certificateExpirationPolicy: .strict)
     }
 
+    @objc
+    func otherUsersProfileDidChange(notification: Notification) {
+        guard let address = notification.userInfo?[kNSNotificationKey_ProfileAddress] as? SignalServiceAddress else {
+            owsFailDebug("Missing address.")
+            invalidateUDAccessKeyCache()
+            return
+        }
+        invalidateUDAccessKey(forAddress: address)
+    }
+
+    @objc
+    func localProfileDidChange() {
+        invalidateUDAccessKeyCache()
+    }
+
+    @objc
+    func didReceiveCrossProcessNotification(_ notification: Notification) {
+        // Another process (e.g. the NSE) may have written profile keys,
+        // and its profile change notifications are not posted here.
+        invalidateUDAccessKeyCache()
+    }
+
     // MARK: -
 
     @objc
@@ -383,6 +440,7 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
         guard didChange else {
             return
         }
+        invalidateUDAccessKey(forAddress: address)
         // Update database async.
         databaseStorage.asyncWrite { transaction in
             if let uuid = address.uuid {
@@ -398,11 +456,23 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
     // if we have a valid profile key for them.
     @objc
     public func udAccessKey(forAddress address: SignalServiceAddress) -> SMKUDAccessKey? {
-        let profileKeyData = databaseStorage.read { transaction in
-            return self.profileManager.profileKeyData(for: address,
-                                                      transaction: transaction)
+        let (cachedEntry, version) = unfairLock.withLock { () -> (CachedUDAccessKey?, UInt64) in
+            return (self.udAccessKeyCache[address], self.udAccessKeyCacheVersion)
+        }
+        if let cachedEntry = cachedEntry {
+            return cachedEntry.udAccessKey
+        }
+
+        let udAccessKey = databaseStorage.read { transaction in
+            self.deriveUDAccessKey(forAddress: address, transaction: transaction)
         }
-        guard let profileKey = profileKeyData else {
+        cacheUDAccessKey(udAccessKey, forAddress: address, lookupVersion: version)
+        return udAccessKey
+    }
+
+    private func deriveUDAccessKey(forAddress address: SignalServiceAddress,
+                                   transaction: SDSAnyReadTransaction) -> SMKUDAccessKey? {
+        guard let profileKey = profileManager.profileKeyData(for: address, transaction: transaction) else {
             // Mark as "not a UD recipient".
             return nil
         }
@@ -415,6 +485,61 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
         }
     }
 
+    // Fills the cache for any of these addresses whose keys aren't
+    // already cached, using a single transaction.
+    private func warmUDAccessKeys(forAddresses addresses: [SignalServiceAddress]) {
+        let (uncachedAddresses, version) = unfairLock.withLock { () -> ([SignalServiceAddress], UInt64) in
+            let uncachedAddresses = addresses.filter { self.udAccessKeyCache[$0] == nil }
+            return (uncachedAddresses, self.udAccessKeyCacheVersion)
+        }
+        guard !uncachedAddresses.isEmpty else {
+            return
+        }
+        let udAccessKeys = databaseStorage.read { transaction in
+            uncachedAddresses.map { self.deriveUDAccessKey(forAddress: $0, transaction: transaction) }
+        }
+        for (address, udAccessKey) in zip(uncachedAddresses, udAccessKeys) {
+            cacheUDAccessKey(udAccessKey, forAddress: address, lookupVersion: version)
+        }
+    }
+
+    private func cacheUDAccessKey(_ udAccessKey: SMKUDAccessKey?,
+                                  forAddress address: SignalServiceAddress,
+                                  lookupVersion: UInt64) {
+        unfairLock.withLock {
+            // Discard values that may have been invalidated while we were
+            // looking them up.
+            guard lookupVersion >= self.udAccessKeyCacheResetVersion,
+                  lookupVersion >= self.udAccessKeyInvalidationVersions[address] ?? 0 else {
+                return
+            }
+            if let existingEntry = self.udAccessKeyCache[address],
+               existingEntry.version > lookupVersion {
+                return
+            }
+            self.udAccessKeyCache[address] = CachedUDAccessKey(version: lookupVersion, udAccessKey: udAccessKey)
+            self.udAccessKeyInvalidationVersions.removeValue(forKey: address)
+        }
+    }
+
+    private func invalidateUDAccessKey(forAddress address: SignalServiceAddress) {
+        unfairLock.withLock {
+            self.udAccessKeyCacheVersion += 1
+            self.udAccessKeyCache.removeValue(forKey: address)
+            self.udAccessKeyInvalidationVersions[address] = self.udAccessKeyCacheVersion
+        }
+    }
+
+    @objc
+    public func invalidateUDAccessKeyCache() {
+        unfairLock.withLock {
+            self.udAccessKeyCacheVersion += 1
+            self.udAccessKeyCacheResetVersion = self.udAccessKeyCacheVersion
+            self.udAccessKeyCache.removeAll()
+            self.udAccessKeyInvalidationVersions.removeAll()
+        }
+    }
+
     // Returns the UD access key for sending to a given recipient or fetching a profile
     @objc
     public func udAccess(forAddress address: SignalServiceAddress, requireSyncAccess: Bool) -> OWSUDAccess? {
@@ -511,6 +636,24 @@ public class OWSUDManagerImpl: NSObject, OWSUDManager {
         return OWSUDSendingAccess(udAccess: udAccess, senderCertificate: senderCertificate)
     }
 
+    // Resolves the sending access for all of these recipients (e.g. the
+    // members of a group) in one pass, reading any uncached access keys
+    // in a single transaction.
+    @objc
+    public func udSendingAccessMap(forAddresses addresses: [SignalServiceAddress],
+                                   requireSyncAccess: Bool,
+                                   senderCertificates: SenderCertificates) -> [SignalServiceAddress: OWSUDSendingAccess] {
+        warmUDAccessKeys(forAddresses: addresses)
+
+        var result = [SignalServiceAddress: OWSUDSendingAccess]()
+        for address in addresses {
+            result[address] = udSendingAccess(forAddress: address,
+                                              requireSyncAccess: requireSyncAccess,
+                                              senderCertificates: senderCertificates)
+        }
+        return result
+    }
+
     // MARK: - Sender Certificate
 
     #if DEBUG
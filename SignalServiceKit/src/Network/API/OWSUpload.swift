@@ -240,62 +240,129 @@ public class OWSAttachmentUploadV2: NSObject {
     // MARK: - V3
 
     public func uploadV3(progressBlock: ProgressBlock? = nil) -> Promise<Void> {
+        var upload: ResumableAttachmentUpload?
+
+        return firstly(on: Self.serialQueue) { () -> Promise<ResumableAttachmentUpload> in
+            _ = Self.removeExpiredUploadsOnce
+
+            if let existingUpload = ResumableAttachmentUploads.upload(forAttachmentId: self.attachmentStream.uniqueId) {
+                Logger.info("Resuming upload.")
+                return self.resumeUploadV3(existingUpload)
+            }
+            return self.startUploadV3()
+        }.then(on: Self.serialQueue) { (resumableUpload: ResumableAttachmentUpload) -> Promise<Void> in
+            upload = resumableUpload
+
+            self.cdnKey = resumableUpload.cdnKey
+            self.cdnNumber = resumableUpload.cdnNumber
+
+            let uploadV3Metadata = try UploadV3Metadata(upload: resumableUpload,
+                                                        plaintextFileUrl: try self.plaintextFileUrl())
+            uploadV3Metadata.recordProgress(resumableUpload.bytesUploaded)
+            return firstly {
+                self.performResumableUploadV3(cdnNumber: resumableUpload.cdnNumber,
+                                              uploadV3Metadata: uploadV3Metadata,
+                                              locationUrl: resumableUpload.locationUrl,
+                                              progressBlock: progressBlock,
+                                              bytesAlreadyUploaded: resumableUpload.bytesUploaded)
+            }.map(on: Self.serialQueue) { (digest: Data) -> Void in
+                self.encryptionKey = resumableUpload.encryptionKey
+                self.digest = digest
+            }
+        }.map(on: Self.serialQueue) { () throws -> Void in
+            guard let upload = upload else {
+                throw OWSAssertionError("Missing upload.")
+            }
+
+            self.uploadTimestamp = NSDate.ows_millisecondTimeStamp()
+
+            ResumableAttachmentUploads.discard(upload)
+        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<Void> in
+            // Keep the upload so that a later attempt can resume it,
+            // unless it failed for reasons other than connectivity.
+            if let upload = upload,
+               !IsNetworkConnectivityFailure(error) {
+                ResumableAttachmentUploads.discard(upload)
+            }
+            throw error
+        }
+    }
+
+    private static let removeExpiredUploadsOnce: Void = {
+        ResumableAttachmentUploads.removeExpiredUploads()
+    }()
+
+    private func plaintextFileUrl() throws -> URL {
+        guard let plaintextFileUrl = attachmentStream.originalMediaURL else {
+            throw OWSAssertionError("Missing attachment file.")
+        }
+        return plaintextFileUrl
+    }
+
+    // Fetches an upload form and starts a resumable upload, then
+    // persists its state.
+    private func startUploadV3() -> Promise<ResumableAttachmentUpload> {
         var form: OWSUploadFormV3?
-        var uploadV3Metadata: UploadV3Metadata?
-        var locationUrl: URL?
 
         return firstly(on: Self.serialQueue) {
             // Fetch attachment upload form.
             return self.performRequest {
                 return OWSRequestFactory.allocAttachmentRequestV3()
             }
-        }.map(on: Self.serialQueue) { [weak self] (formResponseObject: Any?) -> Void in
-            guard let self = self else {
-                throw OWSAssertionError("Upload deallocated")
-            }
+        }.then(on: Self.serialQueue) { (formResponseObject: Any?) -> Promise<URL> in
             // Parse upload form.
             let uploadForm = try OWSUploadFormV3(responseObject: formResponseObject)
-            self.cdnKey = uploadForm.cdnKey
-            self.cdnNumber = uploadForm.cdnNumber
             form = uploadForm
-        }.then(on: Self.serialQueue) { () -> Promise<Void> in
-            return firstly {
-                return self.prepareUploadV3()
-            }.map(on: Self.serialQueue) { (metadata: UploadV3Metadata) in
-                uploadV3Metadata = metadata
-            }
-        }.then(on: Self.serialQueue) { () -> Promise<Void> in
-            return firstly { () -> Promise<URL> in
-                guard let form = form,
-                    let uploadV3Metadata = uploadV3Metadata else {
-                        throw OWSAssertionError("Missing form or metadata.")
-                }
-                return self.fetchResumableUploadLocationV3(form: form, uploadV3Metadata: uploadV3Metadata)
-            }.map(on: Self.serialQueue) { (url: URL) in
-                locationUrl = url
-            }
-        }.then(on: Self.serialQueue) { () -> Promise<Void> in
-            guard let form = form,
-                let uploadV3Metadata = uploadV3Metadata,
-                let locationUrl = locationUrl else {
-                    throw OWSAssertionError("Missing form or metadata.")
-            }
-            return self.performResumableUploadV3(form: form,
-                                                 uploadV3Metadata: uploadV3Metadata,
-                                                 locationUrl: locationUrl,
-                                                 progressBlock: progressBlock)
-        }.map(on: Self.serialQueue) { () throws -> Void in
-            guard let uploadV3Metadata = uploadV3Metadata else {
-                throw OWSAssertionError("Missing form or metadata.")
-            }
-
-            self.uploadTimestamp = NSDate.ows_millisecondTimeStamp()
+            return self.fetchResumableUploadLocationV3(form: uploadForm)
+        }.map(on: Self.serialQueue) { (locationUrl: URL) -> ResumableAttachmentUpload in
+            guard let form = form else {
+                throw OWSAssertionError("Missing form.")
+            }
+            guard let plaintextLength = OWSFileSystem.fileSize(ofPath: try self.plaintextFileUrl().path)?.intValue else {
+                throw OWSAssertionError("Could not determine file size.")
+            }
+            // This generates the key and IV that every attempt will use.
+            let encrypter = try AttachmentStreamEncrypter(plaintextLength: plaintextLength)
+            let upload = ResumableAttachmentUpload(attachmentId: self.attachmentStream.uniqueId,
+                                                   plaintextLength: plaintextLength,
+                                                   encryptionKey: encrypter.encryptionKey,
+                                                   iv: encrypter.iv,
+                                                   cdnKey: form.cdnKey,
+                                                   cdnNumber: form.cdnNumber,
+                                                   locationUrl: locationUrl,
+                                                   creationDate: Date(),
+                                                   bytesUploaded: 0,
+                                                   digest: nil)
+            ResumableAttachmentUploads.save(upload)
+            return upload
+        }
+    }
 
-            do {
-                try OWSFileSystem.deleteFile(url: uploadV3Metadata.temporaryFileUrl)
-            } catch {
-                owsFailDebug("Error: \(error)")
+    // Asks the CDN how much of a persisted upload it has received.
+    private func resumeUploadV3(_ upload: ResumableAttachmentUpload) -> Promise<ResumableAttachmentUpload> {
+        return firstly(on: Self.serialQueue) { () -> Promise<Int> in
+            let uploadV3Metadata = try UploadV3Metadata(upload: upload, plaintextFileUrl: try self.plaintextFileUrl())
+            return self.getResumableUploadProgressV3Attempt(cdnNumber: upload.cdnNumber,
+                                                            dataLength: uploadV3Metadata.dataLength,
+                                                            locationUrl: upload.locationUrl)
+        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<Int> in
+            if case OWSUploadError.missingRangeHeader = error {
+                // Nothing has been persisted yet.
+                return Promise.value(0)
+            }
+            throw error
+        }.map(on: Self.serialQueue) { (bytesAlreadyUploaded: Int) -> ResumableAttachmentUpload in
+            var upload = upload
+            upload.bytesUploaded = bytesAlreadyUploaded
+            return upload
+        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<ResumableAttachmentUpload> in
+            if IsNetworkConnectivityFailure(error) {
+                throw error
             }
+            // The upload session may have expired; start over.
+            Logger.warn("Could not resume upload: \(error)")
+            ResumableAttachmentUploads.discard(upload)
+            return self.startUploadV3()
         }
     }
 
@@ -306,9 +373,33 @@ public class OWSAttachmentUploadV2: NSObject {
     }
 
     private struct UploadV3Metadata {
-        let temporaryFileUrl: URL
+        let attachmentId: String
+        let plaintextFileUrl: URL
+        let plaintextLength: Int
+        let encryptionKey: Data
+        let iv: Data
         let dataLength: Int
         let startDate = Date()
+        // Known once the attachment has been encrypted in full.
+        let digest: AtomicOptional<Data>
+
+        init(upload: ResumableAttachmentUpload, plaintextFileUrl: URL) throws {
+            self.attachmentId = upload.attachmentId
+            self.plaintextFileUrl = plaintextFileUrl
+            self.plaintextLength = upload.plaintextLength
+            self.encryptionKey = upload.encryptionKey
+            self.iv = upload.iv
+            self.digest = AtomicOptional(upload.digest)
+            self.dataLength = try AttachmentStreamEncrypter(plaintextLength: upload.plaintextLength,
+                                                            encryptionKey: upload.encryptionKey,
+                                                            iv: upload.iv).encryptedLength
+        }
+
+        // Every attempt encrypts the attachment again, with the same key
+        // and IV, to reproduce the ciphertext.
+        fileprivate func makeEncrypter() throws -> AttachmentStreamEncrypter {
+            try AttachmentStreamEncrypter(plaintextLength: plaintextLength, encryptionKey: encryptionKey, iv: iv)
+        }
 
         private let _progress = AtomicValue<Int>(0)
 
@@ -352,24 +443,11 @@ public class OWSAttachmentUploadV2: NSObject {
         }
     }
 
-    private func prepareUploadV3() -> Promise<UploadV3Metadata> {
-        return firstly(on: Self.serialQueue) { () -> Promise<Data> in
-            self.attachmentData()
-        }.map(on: Self.serialQueue) { (encryptedData: Data) -> UploadV3Metadata in
-            // Write the encrypted data to a temporary file.
-            let temporaryFilePath = OWSFileSystem.temporaryFilePath(isAvailableWhileDeviceLocked: true)
-            let temporaryFileUrl = URL(fileURLWithPath: temporaryFilePath)
-            try encryptedData.write(to: temporaryFileUrl)
-            return UploadV3Metadata(temporaryFileUrl: temporaryFileUrl, dataLength: encryptedData.count)
-        }
-    }
-
     // This fetches a temporary URL that can be used for resumable uploads.
     //
     // See: https://cloud.google.com/storage/docs/performing-resumable-uploads#xml-api
     // NOTE: follow the "XML API" instructions.
     private func fetchResumableUploadLocationV3(form: OWSUploadFormV3,
-                                                uploadV3Metadata: UploadV3Metadata,
                                                 attemptCount: Int = 0) -> Promise<URL> {
         if attemptCount > 0 {
             Logger.info("attemptCount: \(attemptCount)")
@@ -416,35 +494,44 @@ public class OWSAttachmentUploadV2: NSObject {
             }
             Logger.info("Trying to resume. ")
             return self.fetchResumableUploadLocationV3(form: form,
-                                                       uploadV3Metadata: uploadV3Metadata,
                                                        attemptCount: attemptCount + 1)
         }
     }
 
-    private func performResumableUploadV3(form: OWSUploadFormV3,
+    private func performResumableUploadV3(cdnNumber: UInt32,
                                           uploadV3Metadata: UploadV3Metadata,
                                           locationUrl: URL,
                                           progressBlock progressBlockParam: ProgressBlock?,
-                                          bytesAlreadyUploaded: Int = 0) -> Promise<Void> {
+                                          bytesAlreadyUploaded: Int = 0) -> Promise<Data> {
         let attemptCount = uploadV3Metadata.attemptCount
         if attemptCount > 0 {
             Logger.info("attemptCount: \(attemptCount)")
         }
 
-        return firstly(on: Self.serialQueue) { () -> Promise<Void> in
+        return firstly(on: Self.serialQueue) { () -> Promise<Data> in
             let totalDataLength = uploadV3Metadata.dataLength
 
             if bytesAlreadyUploaded > totalDataLength {
                 throw OWSAssertionError("Unexpected content length.")
             }
+
             if bytesAlreadyUploaded == totalDataLength {
-                // Upload is already complete.
-                return Promise.value(())
+                // Upload is already complete, but we still need the digest.
+                return self.digestForCompletedUploadV3(uploadV3Metadata: uploadV3Metadata)
             }
 
+            // The attachment is encrypted as the upload reads it, so that
+            // the upload can start right away, and the ciphertext is never
+            // written to disk. When resuming, the bytes the CDN already has
+            // are encrypted but not sent.
+            let bodyStream = AttachmentEncryptingStream(encryptedLength: totalDataLength,
+                                                        plaintextFileUrl: uploadV3Metadata.plaintextFileUrl,
+                                                        skippingLength: bytesAlreadyUploaded,
+                                                        makeEncrypter: uploadV3Metadata.makeEncrypter)
+
             let formatInt = OWSFormat.formatInt
             let urlString = locationUrl.absoluteString
-            let urlSession = OWSUpload.cdnUrlSession(forCdnNumber: form.cdnNumber)
+            let urlSession = OWSUpload.cdnUrlSession(forCdnNumber: cdnNumber)
 
             // Wrap the progress block.
             let progressBlock = { (task: URLSessionTask, progress: Progress) in
@@ -463,56 +550,36 @@ public class OWSAttachmentUploadV2: NSObject {
                 progressBlockParam?(sliceProgress)
             }
 
-            if bytesAlreadyUploaded == 0 {
-                // Either first attempt or no progress so far, use entire encrypted data.
-                var headers = [String: String]()
-                headers["Content-Length"] = formatInt(uploadV3Metadata.dataLength)
-                return urlSession.uploadTaskPromise(urlString,
-                                                    method: .put,
-                                                    headers: headers,
-                                                    dataUrl: uploadV3Metadata.temporaryFileUrl,
-                                                    progress: progressBlock).asVoid()
-            } else {
-                // Resuming, slice attachment data in memory.
-                let dataSliceFileUrl = OWSFileSystem.temporaryFileUrl(isAvailableWhileDeviceLocked: true)
-
-                var dataSliceLength: Int = 0
-                try autoreleasepool {
-                    // TODO: It'd be better if we could slice on disk.
-                    let entireFileData = try Data(contentsOf: uploadV3Metadata.temporaryFileUrl)
-                    let dataSlice = entireFileData.suffix(from: Int(bytesAlreadyUploaded))
-                    dataSliceLength = dataSlice.count
-                    guard dataSliceLength + bytesAlreadyUploaded == entireFileData.count else {
-                        throw OWSAssertionError("Could not slice the data.")
-                    }
-
-                    // Write the slice to a temporary file.
-                    try dataSlice.write(to: dataSliceFileUrl)
-                }
-
+            var headers = [String: String]()
+            headers["Content-Length"] = formatInt(bodyStream.bodyLength)
+            if bytesAlreadyUploaded > 0 {
                 // Example: Resuming after uploading 2359296 of 7351375 bytes.
                 //
                 // Content-Range: bytes 2359296-7351374/7351375
                 // Content-Length: 4992079
-                var headers = [String: String]()
-                headers["Content-Length"] = formatInt(dataSliceLength)
                 headers["Content-Range"] = "bytes \(formatInt(bytesAlreadyUploaded))-\(formatInt(totalDataLength - 1))/\(formatInt(totalDataLength))"
+            }
 
-                return firstly(on: Self.serialQueue) {
-                    urlSession.uploadTaskPromise(urlString,
-                                                 method: .put,
-                                                 headers: headers,
-                                                 dataUrl: dataSliceFileUrl,
-                                                 progress: progressBlock).asVoid()
-                }.ensure(on: Self.serialQueue) {
-                    do {
-                        try OWSFileSystem.deleteFile(url: dataSliceFileUrl)
-                    } catch {
-                        owsFailDebug("Error: \(error)")
-                    }
-                }
+            let uploadPromise = urlSession.uploadTaskPromise(urlString,
+                                                             method: .put,
+                                                             headers: headers,
+                                                             bodyStreamBlock: bodyStream.makeInputStream,
+                                                             progress: progressBlock)
+            // Once the whole body has been written, persist the digest so that
+            // a later attempt that finds the upload complete needn't encrypt
+            // the attachment again to get it.
+            bodyStream.digestPromise.done(on: .global()) { digest in
+                uploadV3Metadata.digest.set(digest)
+                ResumableAttachmentUploads.recordDigest(digest, forAttachmentId: uploadV3Metadata.attachmentId)
+            }.cauterize()
+            return firstly {
+                uploadPromise
+            }.then(on: Self.serialQueue) { _ in
+                // The body must have been written in full for the upload
+                // to succeed, so this should already be resolved.
+                bodyStream.digestPromise
             }
-        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<Void> in
+        }.recover(on: Self.serialQueue) { (error: Error) -> Promise<Data> in
 
             guard IsNetworkConnectivityFailure(error) else {
                 throw error
@@ -522,16 +589,19 @@ public class OWSAttachmentUploadV2: NSObject {
             }
 
             return firstly {
-                self.getResumableUploadProgressV3(form: form,
+                self.getResumableUploadProgressV3(cdnNumber: cdnNumber,
                                                   uploadV3Metadata: uploadV3Metadata,
                                                   locationUrl: locationUrl)
-            }.then(on: Self.serialQueue) { (bytesAlreadyUploaded: Int) -> Promise<Void> in
+            }.then(on: Self.serialQueue) { (bytesAlreadyUploaded: Int) -> Promise<Data> in
 
                 let didAttemptMakeAnyProgress = uploadV3Metadata.progress < bytesAlreadyUploaded
 
                 // We need to record the progress so that we can use it
                 // to resume after failures.
                 uploadV3Metadata.recordProgress(bytesAlreadyUploaded)
+                // Persist it too, in case we have to resume in a later attempt.
+                ResumableAttachmentUploads.recordProgress(bytesAlreadyUploaded,
+                                                          forAttachmentId: uploadV3Metadata.attachmentId)
 
                 let failureMode = uploadV3Metadata.recordFailure(didAttemptMakeAnyProgress: didAttemptMakeAnyProgress)
 
@@ -555,7 +625,7 @@ public class OWSAttachmentUploadV2: NSObject {
                     }
                 }.then(on: Self.serialQueue) {
                     // Retry
-                    self.performResumableUploadV3(form: form,
+                    self.performResumableUploadV3(cdnNumber: cdnNumber,
                                                   uploadV3Metadata: uploadV3Metadata,
                                                   locationUrl: locationUrl,
                                                   progressBlock: progressBlockParam,
@@ -565,8 +635,26 @@ public class OWSAttachmentUploadV2: NSObject {
         }
     }
 
+    // The digest is usually recorded when the body is written. If it
+    // wasn't, e.g. because the app was terminated after the CDN received
+    // the body, we encrypt the attachment again to compute it. That
+    // happens off serialQueue, which every upload shares.
+    private func digestForCompletedUploadV3(uploadV3Metadata: UploadV3Metadata) -> Promise<Data> {
+        if let digest = uploadV3Metadata.digest.get() {
+            return Promise.value(digest)
+        }
+        return firstly(on: .global(qos: .utility)) { () -> Data in
+            let encrypter = try uploadV3Metadata.makeEncrypter()
+            try encrypter.encryptFile(at: uploadV3Metadata.plaintextFileUrl) { _ in }
+            guard let digest = encrypter.digest else {
+                throw OWSAssertionError("Missing digest.")
+            }
+            return digest
+        }
+    }
+
     // Determine how much has already been uploaded.
-    private func getResumableUploadProgressV3(form: OWSUploadFormV3,
+    private func getResumableUploadProgressV3(cdnNumber: UInt32,
                                               uploadV3Metadata: UploadV3Metadata,
                                               locationUrl: URL,
                                               attemptCount: UInt = 0) -> Promise<Int> {
@@ -576,8 +664,8 @@ public class OWSAttachmentUploadV2: NSObject {
             // so we wait before querying for the current upload progress.
             after(seconds: 5)
         }.then(on: Self.serialQueue) { () -> Promise<Int> in
-            self.getResumableUploadProgressV3Attempt(form: form,
-                                                     uploadV3Metadata: uploadV3Metadata,
+            self.getResumableUploadProgressV3Attempt(cdnNumber: cdnNumber,
+                                                     dataLength: uploadV3Metadata.dataLength,
                                                      locationUrl: locationUrl)
         }.recover(on: Self.serialQueue) { (error: Error) -> Promise<Int> in
             guard attemptCount < 2 else {
@@ -593,7 +681,7 @@ public class OWSAttachmentUploadV2: NSObject {
             guard canRetry else {
                 throw error
             }
-            return self.getResumableUploadProgressV3(form: form,
+            return self.getResumableUploadProgressV3(cdnNumber: cdnNumber,
                                                      uploadV3Metadata: uploadV3Metadata,
                                                      locationUrl: locationUrl,
                                                      attemptCount: attemptCount + 1)
@@ -601,8 +689,8 @@ public class OWSAttachmentUploadV2: NSObject {
     }
 
     // Determine how much has already been uploaded.
-    private func getResumableUploadProgressV3Attempt(form: OWSUploadFormV3,
-                                                     uploadV3Metadata: UploadV3Metadata,
+    private func getResumableUploadProgressV3Attempt(cdnNumber: UInt32,
+                                                     dataLength: Int,
                                                      locationUrl: URL) -> Promise<Int> {
 
         return firstly(on: Self.serialQueue) { () -> Promise<OWSHTTPResponse> in
@@ -610,15 +698,19 @@ public class OWSAttachmentUploadV2: NSObject {
 
             var headers = [String: String]()
             headers["Content-Length"] = "0"
-            headers["Content-Range"] = "bytes */\(OWSFormat.formatInt(uploadV3Metadata.dataLength))"
+            headers["Content-Range"] = "bytes */\(OWSFormat.formatInt(dataLength))"
 
-            let urlSession = OWSUpload.cdnUrlSession(forCdnNumber: form.cdnNumber)
+            let urlSession = OWSUpload.cdnUrlSession(forCdnNumber: cdnNumber)
 
             let body = "".data(using: .utf8)
 
             return urlSession.dataTaskPromise(urlString, method: .put, headers: headers, body: body)
         }.map(on: Self.serialQueue) { (response: OWSHTTPResponse) in
 
+            if response.statusCode == 200 || response.statusCode == 201 {
+                // The upload is already complete.
+                return dataLength
+            }
             if response.statusCode != 308 {
                 owsFailDebug("Invalid status code: \(response.statusCode).")
                 // Return zero to restart the upload.
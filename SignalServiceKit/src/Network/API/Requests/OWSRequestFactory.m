@@ -209,7 +209,9 @@ NSString *const OWSRequestKey_AuthKey = @"AuthKey";
 + (TSRequest *)availablePreKeysCountRequest
 {
     NSString *path = [NSString stringWithFormat:@"%@", textSecureKeysAPI];
-    return [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"GET" parameters:@{}];
+    TSRequest *request = [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"GET" parameters:@{}];
+    request.priority = TSRequestPriorityBackground;
+    return request;
 }
 
 + (TSRequest *)contactsIntersectionRequestWithHashesArray:(NSArray<NSString *> *)hashes
@@ -227,7 +229,9 @@ NSString *const OWSRequestKey_AuthKey = @"AuthKey";
 + (TSRequest *)currentSignedPreKeyRequest
 {
     NSString *path = textSecureSignedKeysAPI;
-    return [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"GET" parameters:@{}];
+    TSRequest *request = [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"GET" parameters:@{}];
+    request.priority = TSRequestPriorityBackground;
+    return request;
 }
 
 + (TSRequest *)profileAvatarUploadFormRequest
@@ -246,6 +250,7 @@ NSString *const OWSRequestKey_AuthKey = @"AuthKey";
     NSString *path = [NSString stringWithFormat:@"%@/%@/%@", textSecureKeysAPI, address.serviceIdentifier, deviceId];
 
     TSRequest *request = [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"GET" parameters:@{}];
+    request.priority = TSRequestPriorityInteractive;
     if (udAccessKey != nil) {
         [self useUDAuthWithRequest:request accessKey:udAccessKey];
     }
@@ -553,6 +558,9 @@ NSString *const OWSRequestKey_AuthKey = @"AuthKey";
     };
 
     TSRequest *request = [TSRequest requestWithUrl:[NSURL URLWithString:path] method:@"PUT" parameters:parameters];
+    request.priority = TSRequestPriorityInteractive;
+    // The device messages dominate the body, especially in large groups.
+    request.shouldCompressBody = YES;
     if (udAccessKey != nil) {
         [self useUDAuthWithRequest:request accessKey:udAccessKey];
     }
@@ -6,6 +6,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class SMKUDAccessKey;
 
+// Determines when NetworkRequestScheduler starts the request.
+typedef NS_ENUM(NSUInteger, TSRequestPriority) {
+    TSRequestPriorityDefault = 0,
+    // Traffic which the user is waiting on, e.g. message sends.
+    TSRequestPriorityInteractive,
+    // Traffic which can wait, e.g. storage service sync or prekey refills.
+    TSRequestPriorityBackground,
+};
+
 @interface TSRequest : NSMutableURLRequest
 
 @property (nonatomic) BOOL isUDRequest;
@@ -14,6 +23,11 @@ NS_ASSUME_NONNULL_BEGIN
 @property (atomic, nullable) NSString *authPassword;
 @property (atomic, nullable) NSString *customHost;
 @property (atomic, nullable) NSString *customCensorshipCircumventionPrefix;
+@property (atomic) TSRequestPriority priority;
+// Large bodies of requests with this flag are gzip-compressed when
+// RemoteConfig.requestCompression is enabled. Only set this for endpoints
+// which accept `Content-Encoding: gzip`.
+@property (atomic) BOOL shouldCompressBody;
 
 @property (nonatomic, readonly) NSDictionary<NSString *, id> *parameters;
 
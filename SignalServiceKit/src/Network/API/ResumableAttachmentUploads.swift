@@ -0,0 +1,121 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// The state of a v3 attachment upload which is persisted so that a
+// later attempt to upload the same attachment, e.g. after the upload
+// operation is retried or the app is relaunched, can resume the
+// CDN's resumable upload rather than starting again.
+//
+// The ciphertext isn't stored; resuming encrypts the attachment again
+// with the same key and IV, which reproduces it.
+struct ResumableAttachmentUpload: Codable {
+    let attachmentId: String
+    let plaintextLength: Int
+    let encryptionKey: Data
+    let iv: Data
+    let cdnKey: String
+    let cdnNumber: UInt32
+    // The resumable upload session URL.
+    let locationUrl: URL
+    let creationDate: Date
+    // The last offset the CDN acknowledged.
+    var bytesUploaded: Int
+    // Recorded once the attachment has been encrypted in full, so that
+    // resuming an upload the CDN has already received doesn't need to
+    // encrypt it again.
+    var digest: Data?
+
+    var isExpired: Bool {
+        abs(creationDate.timeIntervalSinceNow) > ResumableAttachmentUploads.maxUploadAge
+    }
+}
+
+// MARK: -
+
+enum ResumableAttachmentUploads {
+
+    // MARK: - Dependencies
+
+    private static var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    // MARK: -
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "ResumableAttachmentUploads")
+
+    // GCS resumable upload sessions expire after a week.
+    fileprivate static let maxUploadAge = 6 * kDayInterval
+
+    // Returns an upload which can be resumed, if any. Expired uploads
+    // are discarded.
+    static func upload(forAttachmentId attachmentId: String) -> ResumableAttachmentUpload? {
+        let upload: ResumableAttachmentUpload? = databaseStorage.read { transaction in
+            do {
+                return try keyValueStore.getCodableValue(forKey: attachmentId, transaction: transaction)
+            } catch {
+                owsFailDebug("Error: \(error)")
+                return nil
+            }
+        }
+        guard let upload = upload else {
+            return nil
+        }
+        guard !upload.isExpired else {
+            Logger.info("Discarding expired upload.")
+            discard(upload)
+            return nil
+        }
+        return upload
+    }
+
+    static func save(_ upload: ResumableAttachmentUpload) {
+        databaseStorage.write { transaction in
+            do {
+                try keyValueStore.setCodable(upload, key: upload.attachmentId, transaction: transaction)
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+        }
+    }
+
+    static func recordProgress(_ bytesUploaded: Int, forAttachmentId attachmentId: String) {
+        guard var upload = Self.upload(forAttachmentId: attachmentId) else {
+            return
+        }
+        upload.bytesUploaded = bytesUploaded
+        save(upload)
+    }
+
+    static func recordDigest(_ digest: Data, forAttachmentId attachmentId: String) {
+        guard var upload = Self.upload(forAttachmentId: attachmentId) else {
+            return
+        }
+        upload.digest = digest
+        save(upload)
+    }
+
+    // Call this once the upload has completed, or can't be resumed.
+    static func discard(_ upload: ResumableAttachmentUpload) {
+        databaseStorage.write { transaction in
+            keyValueStore.removeValue(forKey: upload.attachmentId, transaction: transaction)
+        }
+    }
+
+    // Removes expired uploads, e.g. uploads of attachments which were
+    // deleted before they could complete.
+    static func removeExpiredUploads() {
+        databaseStorage.write { transaction in
+            do {
+                let uploads: [ResumableAttachmentUpload] = try keyValueStore.allCodableValues(transaction: transaction)
+                let expiredAttachmentIds = uploads.filter { $0.isExpired }.map { $0.attachmentId }
+                keyValueStore.removeValues(forKeys: expiredAttachmentIds, transaction: transaction)
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+        }
+    }
+}
@@ -34,6 +34,10 @@ typedef void (^TSNetworkManagerFailure)(NSURLSessionDataTask *task, NSError *err
 
 + (instancetype)shared;
 
+// The number of requests which shared the response of an identical
+// in-flight request.
+@property (atomic, readonly) NSUInteger coalescedRequestCount;
+
 - (void)makeRequest:(TSRequest *)request
             success:(TSNetworkManagerSuccess)success
             failure:(TSNetworkManagerFailure)failure NS_SWIFT_NAME(makeRequest(_:success:failure:));
@@ -100,6 +100,15 @@ dispatch_queue_t NetworkManagerQueue()
 
 #pragma mark -
 
+// Smaller bodies aren't worth compressing.
+static const NSUInteger kMinCompressedBodyLength = 1024;
+
+// Set if the service rejects a compressed body, after which we stop
+// compressing bodies until the next launch.
+//
+// This should only be accessed on NetworkManagerQueue().
+static BOOL gServiceRejectedCompressedBody = NO;
+
 @implementation OWSSessionManager
 
 #pragma mark - Dependencies
@@ -205,6 +214,17 @@ dispatch_queue_t NetworkManagerQueue()
         [self.sessionManager.requestSerializer setValue:headerValue forHTTPHeaderField:headerField];
     }
 
+    if (request.shouldCompressBody && ![request.HTTPMethod isEqualToString:@"GET"] && RemoteConfig.requestCompression
+        && !gServiceRejectedCompressedBody) {
+        if ([self performCompressedRequest:request
+                                 URLString:requestURLString
+                                canUseAuth:canUseAuth
+                                   success:success
+                                   failure:failure]) {
+            return;
+        }
+    }
+
     if ([request.HTTPMethod isEqualToString:@"GET"]) {
         [self.sessionManager GET:requestURLString
                       parameters:request.parameters
@@ -226,6 +246,64 @@ dispatch_queue_t NetworkManagerQueue()
     }
 }
 
+// Returns NO if the request's body shouldn't be compressed, in which case
+// the request hasn't been made.
+- (BOOL)performCompressedRequest:(TSRequest *)request
+                       URLString:(NSString *)URLString
+                      canUseAuth:(BOOL)canUseAuth
+                         success:(TSNetworkManagerSuccess)success
+                         failure:(TSNetworkManagerFailure)failure
+{
+    AssertOnDispatchQueue(NetworkManagerQueue());
+
+    NSString *absoluteURLString =
+        [NSURL URLWithString:URLString relativeToURL:self.sessionManager.baseURL].absoluteString;
+    NSError *_Nullable serializationError;
+    NSMutableURLRequest *_Nullable urlRequest =
+        [self.sessionManager.requestSerializer requestWithMethod:request.HTTPMethod
+                                                       URLString:absoluteURLString
+                                                      parameters:request.parameters
+                                                           error:&serializationError];
+    if (urlRequest == nil || serializationError != nil) {
+        OWSFailDebug(@"Could not serialize request: %@", serializationError);
+        return NO;
+    }
+    NSData *_Nullable body = urlRequest.HTTPBody;
+    if (body.length < kMinCompressedBodyLength) {
+        return NO;
+    }
+    NSData *_Nullable compressedBody = [body gzipCompressedData];
+    if (compressedBody == nil) {
+        return NO;
+    }
+    OWSLogVerbose(@"Compressed body: %lu -> %lu.", (unsigned long)body.length, (unsigned long)compressedBody.length);
+    urlRequest.HTTPBody = compressedBody;
+    [urlRequest setValue:@"gzip" forHTTPHeaderField:@"Content-Encoding"];
+
+    __block NSURLSessionDataTask *task = [self.sessionManager
+           dataTaskWithRequest:urlRequest
+                uploadProgress:nil
+              downloadProgress:nil
+             completionHandler:^(NSURLResponse *response, id _Nullable responseObject, NSError *_Nullable error) {
+                 if (error == nil) {
+                     success(task, responseObject);
+                     return;
+                 }
+                 if ([response isKindOfClass:[NSHTTPURLResponse class]]
+                     && ((NSHTTPURLResponse *)response).statusCode == 415) {
+                     OWSLogWarn(@"Service rejected compressed body; retrying uncompressed.");
+                     dispatch_async(NetworkManagerQueue(), ^{
+                         gServiceRejectedCompressedBody = YES;
+                         [self performRequest:request canUseAuth:canUseAuth success:success failure:failure];
+                     });
+                     return;
+                 }
+                 failure(task, error);
+             }];
+    [task resume];
+    return YES;
+}
+
 @end
 
 #pragma mark -
@@ -315,11 +393,47 @@ dispatch_queue_t NetworkManagerQueue()
 
 #pragma mark -
 
+// The callbacks of a request which is waiting on an identical in-flight request.
+@interface TSNetworkManagerCallbacks : NSObject
+
+@property (nonatomic, readonly) dispatch_queue_t completionQueue;
+@property (nonatomic, readonly) TSNetworkManagerSuccess success;
+@property (nonatomic, readonly) TSNetworkManagerFailure failure;
+
+@end
+
+#pragma mark -
+
+@implementation TSNetworkManagerCallbacks
+
+- (instancetype)initWithCompletionQueue:(dispatch_queue_t)completionQueue
+                                success:(TSNetworkManagerSuccess)success
+                                failure:(TSNetworkManagerFailure)failure
+{
+    self = [super init];
+    if (!self) {
+        return self;
+    }
+
+    _completionQueue = completionQueue;
+    _success = success;
+    _failure = failure;
+
+    return self;
+}
+
+@end
+
+#pragma mark -
+
 @interface TSNetworkManager ()
 
 // These properties should only be accessed on serialQueue.
 @property (atomic, readonly) OWSSessionManagerPool *udSessionManagerPool;
 @property (atomic, readonly) OWSSessionManagerPool *nonUdSessionManagerPool;
+@property (nonatomic, readonly)
+    NSMutableDictionary<NSString *, NSMutableArray<TSNetworkManagerCallbacks *> *> *inFlightRequestCallbacks;
+@property (atomic) NSUInteger coalescedRequestCount;
 
 @end
 
@@ -352,6 +466,7 @@ dispatch_queue_t NetworkManagerQueue()
 
     _udSessionManagerPool = [OWSSessionManagerPool new];
     _nonUdSessionManagerPool = [OWSSessionManagerPool new];
+    _inFlightRequestCallbacks = [NSMutableDictionary new];
 
     OWSSingletonAssert();
 
@@ -377,10 +492,80 @@ dispatch_queue_t NetworkManagerQueue()
     OWSAssertDebug(failure);
 
     dispatch_async(NetworkManagerQueue(), ^{
-        [self makeRequestSync:request completionQueue:completionQueue success:success failure:failure];
+        [self makeCoalescedRequestSync:request completionQueue:completionQueue success:success failure:failure];
     });
 }
 
+// Identical GET requests share a single in-flight request and its response.
+- (nullable NSString *)coalescingKeyForRequest:(TSRequest *)request
+{
+    if (![request.HTTPMethod isEqualToString:@"GET"] || request.parameters.count > 0
+        || request.URL.absoluteString.length < 1) {
+        return nil;
+    }
+    NSMutableArray<NSString *> *components = [NSMutableArray new];
+    [components addObject:request.URL.absoluteString];
+    [components addObject:(request.isUDRequest ? @"ud" : @"non-ud")];
+    [components addObject:request.authUsername ?: @""];
+    [components addObject:request.authPassword ?: @""];
+    [components addObject:request.customHost ?: @""];
+    [components addObject:request.customCensorshipCircumventionPrefix ?: @""];
+    NSDictionary<NSString *, NSString *> *headers = request.allHTTPHeaderFields ?: @{};
+    for (NSString *headerField in [headers.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        [components addObject:[NSString stringWithFormat:@"%@: %@", headerField, headers[headerField]]];
+    }
+    return [components componentsJoinedByString:@"\n"];
+}
+
+- (void)makeCoalescedRequestSync:(TSRequest *)request
+                 completionQueue:(dispatch_queue_t)completionQueue
+                         success:(TSNetworkManagerSuccess)success
+                         failure:(TSNetworkManagerFailure)failure
+{
+    AssertOnDispatchQueue(NetworkManagerQueue());
+
+    NSString *_Nullable coalescingKey = [self coalescingKeyForRequest:request];
+    if (coalescingKey == nil) {
+        [self makeRequestSync:request completionQueue:completionQueue success:success failure:failure];
+        return;
+    }
+
+    TSNetworkManagerCallbacks *callbacks = [[TSNetworkManagerCallbacks alloc] initWithCompletionQueue:completionQueue
+                                                                                              success:success
+                                                                                              failure:failure];
+    NSMutableArray<TSNetworkManagerCallbacks *> *_Nullable inFlightCallbacks
+        = self.inFlightRequestCallbacks[coalescingKey];
+    if (inFlightCallbacks != nil) {
+        [inFlightCallbacks addObject:callbacks];
+        self.coalescedRequestCount += 1;
+        OWSLogInfo(@"Coalescing request with in-flight request: %@, %lu total.",
+            request,
+            (unsigned long)self.coalescedRequestCount);
+        return;
+    }
+    inFlightCallbacks = [NSMutableArray arrayWithObject:callbacks];
+    self.inFlightRequestCallbacks[coalescingKey] = inFlightCallbacks;
+
+    [self makeRequestSync:request
+        completionQueue:NetworkManagerQueue()
+        success:^(NSURLSessionDataTask *task, _Nullable id responseObject) {
+            [self.inFlightRequestCallbacks removeObjectForKey:coalescingKey];
+            for (TSNetworkManagerCallbacks *waitingCallbacks in inFlightCallbacks) {
+                dispatch_async(waitingCallbacks.completionQueue, ^{
+                    waitingCallbacks.success(task, responseObject);
+                });
+            }
+        }
+        failure:^(NSURLSessionDataTask *task, NSError *error) {
+            [self.inFlightRequestCallbacks removeObjectForKey:coalescingKey];
+            for (TSNetworkManagerCallbacks *waitingCallbacks in inFlightCallbacks) {
+                dispatch_async(waitingCallbacks.completionQueue, ^{
+                    waitingCallbacks.failure(task, error);
+                });
+            }
+        }];
+}
+
 - (void)makeRequestSync:(TSRequest *)request
         completionQueue:(dispatch_queue_t)completionQueue
                 success:(TSNetworkManagerSuccess)successParam
@@ -390,6 +575,32 @@ dispatch_queue_t NetworkManagerQueue()
     OWSAssertDebug(successParam);
     OWSAssertDebug(failureParam);
 
+    NSString *host = request.customHost ?: @"mainService";
+    [NetworkRequestScheduler.shared
+        scheduleRequestWithHost:host
+                       priority:request.priority
+                          queue:NetworkManagerQueue()
+                     startBlock:^(void (^requestDidComplete)(void)) {
+                         [self makeScheduledRequestSync:request
+                                        completionQueue:completionQueue
+                                                success:^(NSURLSessionDataTask *task, _Nullable id responseObject) {
+                                                    requestDidComplete();
+                                                    successParam(task, responseObject);
+                                                }
+                                                failure:^(NSURLSessionDataTask *task, NSError *error) {
+                                                    requestDidComplete();
+                                                    failureParam(task, error);
+                                                }];
+                     }];
+}
+
+- (void)makeScheduledRequestSync:(TSRequest *)request
+                 completionQueue:(dispatch_queue_t)completionQueue
+                         success:(TSNetworkManagerSuccess)successParam
+                         failure:(TSNetworkManagerFailure)failureParam
+{
+    AssertOnDispatchQueue(NetworkManagerQueue());
+
     BOOL isUDRequest = request.isUDRequest;
     NSString *label = (isUDRequest ? @"UD request" : @"Non-UD request");
     BOOL canUseAuth = !isUDRequest;
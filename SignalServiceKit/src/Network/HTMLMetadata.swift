@@ -26,7 +26,16 @@ public struct HTMLMetadata: Equatable {
     /// Parsed from the article:modified_time meta property
     var articleModifiedDateString: String?
 
-    static func construct(parsing rawHTML: String) -> HTMLMetadata {
+    static func construct(parsing html: String) -> HTMLMetadata {
+        // Every tag we look for belongs in the <head>, so there's no need to
+        // search the (often much larger) <body>.
+        let rawHTML: String
+        if let endOfHead = html.range(of: "</head", options: .caseInsensitive) {
+            rawHTML = String(html[..<endOfHead.lowerBound])
+        } else {
+            rawHTML = html
+        }
+
         let metaPropertyTags = Self.parseMetaProperties(in: rawHTML)
         return HTMLMetadata(
             titleTag: Self.parseTitleTag(in: rawHTML),
@@ -21,6 +21,14 @@ import Foundation
 ///
 /// Both respect the `error.isRetryable` convention to be sure we don't keep retrying in some situations
 /// (e.g. rate limiting)
+///
+/// ## Offline behavior
+///
+/// While we're offline, operations defer their attempts (and retries) until we're reachable,
+/// without using up their retries. DurableOperationRetryScheduler then releases them, subject to its
+/// concurrency cap, which renderable messages are exempt from. If reachability stays wrong for too
+/// long, they are attempted anyway. Each conversation's messages still send in order, since each
+/// conversation has a serial queue.
 public class MessageSenderJobQueue: NSObject, JobQueue {
 
     @objc
@@ -95,6 +103,18 @@ public class MessageSenderJobQueue: NSObject, JobQueue {
         }
     }
 
+    public func didMarkAsReady(oldJobRecords: [SSKMessageSenderJobRecord], transaction: SDSAnyWriteTransaction) {
+        // Fetch all of the restarted messages in one query rather than one per job.
+        let messageIds = Set(oldJobRecords.compactMap { $0.messageId })
+        guard !messageIds.isEmpty else {
+            return
+        }
+        let interactions = InteractionFinder.interactions(withInteractionIds: messageIds, transaction: transaction)
+        for case let message as TSOutgoingMessage in interactions {
+            message.updateAllUnsentRecipientsAsSending(transaction: transaction)
+        }
+    }
+
     public func buildOperation(jobRecord: SSKMessageSenderJobRecord, transaction: SDSAnyReadTransaction) throws -> MessageSenderOperation {
         let message: TSOutgoingMessage
         if let invisibleMessage = jobRecord.invisibleMessage {
@@ -231,6 +251,13 @@ public class MessageSenderOperation: OWSOperation, DurableOperation {
     // MARK: OWSOperation
 
     override public func run() {
+        // While we're offline, messages wait in the queue rather than making
+        // attempts which are certain to fail. Once we're reachable they are
+        // sent in order within each conversation, a few conversations at a time.
+        if DurableOperationRetryScheduler.shared.deferAttemptUntilReachable(operation: self) {
+            return
+        }
+
         self.messageSender.sendMessage(message.asPreparer,
                                        success: {
                                         self.reportSuccess()
@@ -0,0 +1,131 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Decides when outbound requests start, so that background traffic (e.g.
+// storage service sync, prekey refills or sticker pack downloads) doesn't
+// compete with interactive traffic such as message sends.
+//
+// Requests are started from priority lanes, highest priority first.
+// Interactive requests always start immediately. Other requests are capped
+// per host, and background requests have a lower cap of their own and yield
+// entirely while any interactive request is in flight.
+//
+// This class is used by both TSNetworkManager and OWSURLSession.
+@objc
+public class NetworkRequestScheduler: NSObject {
+
+    @objc
+    public static let shared = NetworkRequestScheduler()
+
+    static let maxConcurrentRequestsPerHost = 6
+    static let maxConcurrentBackgroundRequests = 2
+
+    public typealias StartBlock = (_ completion: @escaping () -> Void) -> Void
+
+    private struct PendingRequest {
+        let host: String
+        let queue: DispatchQueue
+        let startBlock: StartBlock
+    }
+
+    private let lock = UnfairLock()
+
+    // These properties should only be accessed while holding the lock.
+    private var pendingRequests = [TSRequestPriority: [PendingRequest]]()
+    private var activeCountByHost = [String: Int]()
+    private var activeCountByPriority = [TSRequestPriority: Int]()
+
+    // Lanes are drained in this order.
+    private static let priorities: [TSRequestPriority] = [.interactive, .default, .background]
+
+    /// Invokes `startBlock` on `queue` once the request may start.
+    ///
+    /// `startBlock` is passed a completion block which must be called
+    /// exactly once, when the request finishes for any reason.
+    @objc
+    public func scheduleRequest(host: String,
+                                priority: TSRequestPriority,
+                                queue: DispatchQueue,
+                                startBlock: @escaping StartBlock) {
+        lock.withLock {
+            pendingRequests[priority, default: []].append(PendingRequest(host: host,
+                                                                         queue: queue,
+                                                                         startBlock: startBlock))
+        }
+        startPendingRequests()
+    }
+
+    private func startPendingRequests() {
+        let requestsToStart: [(PendingRequest, TSRequestPriority)] = lock.withLock {
+            var requestsToStart = [(PendingRequest, TSRequestPriority)]()
+            for priority in Self.priorities {
+                guard var lane = pendingRequests[priority], !lane.isEmpty else {
+                    continue
+                }
+                var index = 0
+                while index < lane.count {
+                    let request = lane[index]
+                    guard canStart(host: request.host, priority: priority) else {
+                        // Requests to other hosts may still be able to start.
+                        index += 1
+                        continue
+                    }
+                    lane.remove(at: index)
+                    activeCountByHost[request.host, default: 0] += 1
+                    activeCountByPriority[priority, default: 0] += 1
+                    requestsToStart.append((request, priority))
+                }
+                pendingRequests[priority] = lane
+            }
+            return requestsToStart
+        }
+
+        for (request, priority) in requestsToStart {
+            let didComplete = AtomicBool(false)
+            let completion = { [weak self] in
+                guard didComplete.tryToSetFlag() else {
+                    owsFailDebug("Request completed more than once.")
+                    return
+                }
+                self?.requestDidComplete(host: request.host, priority: priority)
+            }
+            request.queue.async {
+                request.startBlock(completion)
+            }
+        }
+    }
+
+    private func canStart(host: String, priority: TSRequestPriority) -> Bool {
+        guard priority != .interactive else {
+            return true
+        }
+        guard activeCountByHost[host, default: 0] < Self.maxConcurrentRequestsPerHost else {
+            return false
+        }
+        guard priority == .background else {
+            return true
+        }
+        return (activeCountByPriority[.interactive, default: 0] == 0 &&
+                    activeCountByPriority[.background, default: 0] < Self.maxConcurrentBackgroundRequests)
+    }
+
+    private func requestDidComplete(host: String, priority: TSRequestPriority) {
+        lock.withLock {
+            activeCountByHost[host, default: 1] -= 1
+            if activeCountByHost[host] == 0 {
+                activeCountByHost.removeValue(forKey: host)
+            }
+            activeCountByPriority[priority, default: 1] -= 1
+        }
+        startPendingRequests()
+    }
+
+    // MARK: -
+
+    var pendingRequestCount: Int {
+        lock.withLock { pendingRequests.values.reduce(0) { $0 + $1.count } }
+    }
+}
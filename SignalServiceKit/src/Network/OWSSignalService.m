@@ -3,10 +3,13 @@
 //
 
 #import "OWSSignalService.h"
+#import "AppContext.h"
+#import "AppReadiness.h"
 #import "NSNotificationCenter+OWS.h"
 #import "OWSCensorshipConfiguration.h"
 #import "OWSError.h"
 #import "OWSHTTPSecurityPolicy.h"
+#import "OWSReadWriteLock.h"
 #import "TSAccountManager.h"
 #import "TSConstants.h"
 #import <SignalServiceKit/SignalServiceKit-Swift.h>
@@ -29,11 +32,24 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
 
 @property (atomic) BOOL isCensorshipCircumventionActive;
 
+// Every request consults the censorship circumvention state, which rarely
+// changes. It is guarded by this lock, which readers share.
+@property (nonatomic, readonly) OWSReadWriteLock *configurationLock;
+
 @end
 
 #pragma mark -
 
-@implementation OWSSignalService
+@implementation OWSSignalService {
+    // These ivars should only be accessed while holding configurationLock.
+    //
+    // The censorship configuration is built from several values in the
+    // database, so it is cached until any of them changes. The generation is
+    // incremented whenever the cache is discarded, so that a configuration
+    // built from stale values is never cached.
+    OWSCensorshipConfiguration *_Nullable _cachedCensorshipConfiguration;
+    NSUInteger _censorshipConfigurationGeneration;
+}
 
 #pragma mark - Dependencies
 
@@ -69,11 +85,15 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
         return self;
     }
 
+    _configurationLock = [OWSReadWriteLock new];
+
     [self observeNotifications];
 
     [self updateHasCensoredPhoneNumber];
     [self updateIsCensorshipCircumventionActive];
 
+    [AppReadiness runNowOrWhenAppDidBecomeReadyPolite:^{ [self preconnectServiceHosts]; }];
+
     OWSSingletonAssert();
 
     return self;
@@ -89,6 +109,10 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
                                              selector:@selector(localNumberDidChange:)
                                                  name:kNSNotificationName_LocalNumberDidChange
                                                object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(applicationWillEnterForeground:)
+                                                 name:OWSApplicationWillEnterForegroundNotification
+                                               object:nil];
 }
 
 - (void)dealloc
@@ -153,6 +177,8 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
 
 - (void)updateIsCensorshipCircumventionActive
 {
+    [self discardCensorshipConfiguration];
+
     if (self.isCensorshipCircumventionManuallyDisabled) {
         self.isCensorshipCircumventionActive = NO;
     } else if (self.isCensorshipCircumventionManuallyActivated) {
@@ -166,15 +192,18 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
 
 - (void)setIsCensorshipCircumventionActive:(BOOL)isCensorshipCircumventionActive
 {
-    @synchronized(self)
-    {
-        if (_isCensorshipCircumventionActive == isCensorshipCircumventionActive) {
-            return;
-        }
+    [self.configurationLock writeLock];
+    BOOL didChange = _isCensorshipCircumventionActive != isCensorshipCircumventionActive;
+    _isCensorshipCircumventionActive = isCensorshipCircumventionActive;
+    [self.configurationLock unlock];
 
-        _isCensorshipCircumventionActive = isCensorshipCircumventionActive;
+    if (!didChange) {
+        return;
     }
 
+    // Pooled sessions are bound to the old hosts.
+    [OWSURLSessionPool.shared removeAllSessions];
+
     [[NSNotificationCenter defaultCenter]
         postNotificationNameAsync:kNSNotificationName_IsCensorshipCircumventionActiveDidChange
                            object:nil
@@ -183,10 +212,10 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
 
 - (BOOL)isCensorshipCircumventionActive
 {
-    @synchronized(self)
-    {
-        return _isCensorshipCircumventionActive;
-    }
+    [self.configurationLock readLock];
+    BOOL result = _isCensorshipCircumventionActive;
+    [self.configurationLock unlock];
+    return result;
 }
 
 - (NSURL *)domainFrontBaseURL
@@ -208,12 +237,48 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
     [self updateHasCensoredPhoneNumber];
 }
 
+- (void)applicationWillEnterForeground:(NSNotification *)notification
+{
+    [self preconnectServiceHosts];
+}
+
 #pragma mark - Censorship Circumvention
 
+- (void)discardCensorshipConfiguration
+{
+    [self.configurationLock writeLock];
+    _cachedCensorshipConfiguration = nil;
+    _censorshipConfigurationGeneration++;
+    [self.configurationLock unlock];
+}
+
 - (OWSCensorshipConfiguration *)buildCensorshipConfiguration
 {
     OWSAssertDebug(self.isCensorshipCircumventionActive);
 
+    [self.configurationLock readLock];
+    OWSCensorshipConfiguration *_Nullable cachedConfiguration = _cachedCensorshipConfiguration;
+    NSUInteger generation = _censorshipConfigurationGeneration;
+    [self.configurationLock unlock];
+
+    if (cachedConfiguration != nil) {
+        return cachedConfiguration;
+    }
+
+    // We avoid opening a transaction while holding the lock.
+    OWSCensorshipConfiguration *configuration = [self loadCensorshipConfiguration];
+
+    [self.configurationLock writeLock];
+    if (_censorshipConfigurationGeneration == generation) {
+        _cachedCensorshipConfiguration = configuration;
+    }
+    [self.configurationLock unlock];
+
+    return configuration;
+}
+
+- (OWSCensorshipConfiguration *)loadCensorshipConfiguration
+{
     if (self.isCensorshipCircumventionManuallyActivated) {
         NSString *countryCode = self.manualCensorshipCircumventionCountryCode;
         if (countryCode.length == 0) {
@@ -250,6 +315,8 @@ NSString *const kNSNotificationName_IsCensorshipCircumventionActiveDidChange =
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
         [self.keyValueStore setString:value key:kManualCensorshipCircumventionCountryCodeKey transaction:transaction];
     });
+
+    [self discardCensorshipConfiguration];
 }
 
 @end
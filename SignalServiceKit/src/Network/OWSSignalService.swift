@@ -140,7 +140,8 @@ fileprivate extension OWSSignalService {
                                        securityPolicy: securityPolicy,
                                        configuration: .ephemeral,
                                        censorshipCircumventionHost: censorshipCircumventionHost,
-                                       extraHeaders: extraHeaders)
+                                       extraHeaders: extraHeaders,
+                                       poolKey: "\(signalServiceType).\(baseUrl.absoluteString)")
         urlSession.shouldHandleRemoteDeprecation = signalServiceInfo.shouldHandleRemoteDeprecation
         return urlSession
     }
@@ -174,4 +175,40 @@ public extension OWSSignalService {
     func urlSessionForCdn(cdnNumber: UInt32) -> OWSURLSession {
         buildUrlSession(for: SignalServiceType.type(forCdnNumber: cdnNumber))
     }
+
+    // MARK: - Pre-connect
+
+    private static let lastPreconnectDate = AtomicOptional<Date>(nil)
+    private static let minPreconnectInterval: TimeInterval = 60
+
+    /// Opens connections to the CDN and storage service hosts so that the
+    /// first requests after the app is foregrounded don't wait for
+    /// handshakes.
+    func preconnectServiceHosts() {
+        guard CurrentAppContext().isMainApp,
+              !CurrentAppContext().isRunningTests,
+              TSAccountManager.shared().isRegisteredAndReady else {
+            return
+        }
+        if let lastPreconnectDate = Self.lastPreconnectDate.get(),
+           abs(lastPreconnectDate.timeIntervalSinceNow) < Self.minPreconnectInterval {
+            return
+        }
+        Self.lastPreconnectDate.set(Date())
+
+        OWSURLSessionPool.shared.logMetrics()
+
+        let signalServiceTypes: [SignalServiceType] = [.storageService, .cdn0, .cdn2]
+        for signalServiceType in signalServiceTypes {
+            let urlSession = buildUrlSession(for: signalServiceType)
+            // Any response at all means the connection is open.
+            urlSession.require2xxOr3xx = false
+            urlSession.shouldHandleRemoteDeprecation = false
+            firstly {
+                urlSession.dataTaskPromise("", method: .head)
+            }.catch { error in
+                Logger.warn("Pre-connect failed: \(error)")
+            }
+        }
+    }
 }
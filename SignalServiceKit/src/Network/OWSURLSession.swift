@@ -189,10 +189,68 @@ public class OWSURLSession: NSObject {
         }
     }
 
+    private let _requestPriority = AtomicValue<TSRequestPriority>(.default)
+    @objc
+    public var requestPriority: TSRequestPriority {
+        get {
+            _requestPriority.get()
+        }
+        set {
+            _requestPriority.set(newValue)
+        }
+    }
+
+    // OWSURLSessions with the same pool key share a URLSession, and
+    // therefore its connections.
+    private let poolKey: String?
+
     private lazy var session: URLSession = {
-        URLSession(configuration: configuration, delegate: self, delegateQueue: Self.operationQueue)
+        if let poolKey = poolKey {
+            return OWSURLSessionPool.shared.session(forKey: poolKey, configuration: configuration)
+        }
+        return URLSession(configuration: configuration, delegate: self, delegateQueue: Self.operationQueue)
     }()
 
+    // Identical GET requests made through pooled sessions share a single
+    // in-flight task and its response.
+    private static let singleflight = Singleflight<OWSHTTPResponse>(label: "OWSURLSession")
+
+    @objc
+    public static var coalescedRequestCount: UInt {
+        singleflight.coalescedCount
+    }
+
+    private func coalescingKey(forRequest request: URLRequest) -> String? {
+        guard let poolKey = poolKey,
+              request.httpMethod == HTTPMethod.get.methodName,
+              request.httpBody == nil,
+              request.httpBodyStream == nil,
+              let url = request.url else {
+            return nil
+        }
+        let headers = (request.allHTTPHeaderFields ?? [:]).sorted { $0.key < $1.key }.map { "\($0.key): \($0.value)" }
+        // The response is shared, so the way it is handled must match too.
+        let options = [require2xxOr3xx, failOnError, shouldHandleRemoteDeprecation].map { $0 ? "1" : "0" }.joined()
+        return ([poolKey, url.absoluteString, options] + headers).joined(separator: "\n")
+    }
+
+    // Tasks are resumed once NetworkRequestScheduler lets them start, and
+    // release their slot when their promise resolves.
+    private func resume<T>(task: URLSessionTask, promise: Promise<T>) {
+        if poolKey != nil {
+            OWSURLSessionPool.shared.register(task: task, owner: self)
+        }
+        let host = task.originalRequest?.url?.host ?? baseUrl?.host ?? ""
+        NetworkRequestScheduler.shared.scheduleRequest(host: host,
+                                                       priority: requestPriority,
+                                                       queue: .global()) { requestDidComplete in
+            promise.ensure(on: .global()) {
+                requestDidComplete()
+            }.cauterize()
+            task.resume()
+        }
+    }
+
     @objc
     public static func defaultSecurityPolicy() -> AFSecurityPolicy {
         AFSecurityPolicy.default()
@@ -213,12 +271,14 @@ public class OWSURLSession: NSObject {
                 securityPolicy: AFSecurityPolicy,
                 configuration: URLSessionConfiguration,
                 censorshipCircumventionHost: String? = nil,
-                extraHeaders: [String: String] = [:]) {
+                extraHeaders: [String: String] = [:],
+                poolKey: String? = nil) {
         self.baseUrl = baseUrl
         self.securityPolicy = securityPolicy
         self.configuration = configuration
         self.censorshipCircumventionHost = censorshipCircumventionHost
         self.extraHeaders = extraHeaders
+        self.poolKey = poolKey
 
         super.init()
     }
@@ -495,6 +555,29 @@ public class OWSURLSession: NSObject {
         }
     }
 
+    // MARK: - Body Stream Blocks
+
+    public typealias BodyStreamBlock = () -> InputStream?
+    typealias BodyStreamBlockMap = [TaskIdentifier: BodyStreamBlock]
+
+    private var bodyStreamBlockMap = BodyStreamBlockMap()
+
+    private func bodyStreamBlock(forTask task: URLSessionTask) -> BodyStreamBlock? {
+        lock.withLock {
+            self.bodyStreamBlockMap[task.taskIdentifier]
+        }
+    }
+
+    private func setBodyStreamBlock(forTask task: URLSessionTask, _ bodyStreamBlock: BodyStreamBlock?) {
+        lock.withLock {
+            if let bodyStreamBlock = bodyStreamBlock {
+                self.bodyStreamBlockMap[task.taskIdentifier] = bodyStreamBlock
+            } else {
+                self.bodyStreamBlockMap.removeValue(forKey: task.taskIdentifier)
+            }
+        }
+    }
+
     // MARK: - Download Completion Blocks
 
     public typealias DownloadCompletionBlock = (URLSessionTask, URL) -> Void
@@ -592,6 +675,14 @@ extension OWSURLSession: URLSessionTaskDelegate {
         progress.completedUnitCount = totalBytesSent
         progressBlock(task, progress)
     }
+
+    public func urlSession(_ session: URLSession, task: URLSessionTask, needNewBodyStream completionHandler: @escaping (InputStream?) -> Void) {
+        guard let bodyStreamBlock = self.bodyStreamBlock(forTask: task) else {
+            owsFailDebug("Missing bodyStreamBlock.")
+            return completionHandler(nil)
+        }
+        completionHandler(bodyStreamBlock())
+    }
 }
 
 // MARK: -
@@ -665,7 +756,7 @@ public extension OWSURLSession {
         }
         requestConfig = self.requestConfig(forTask: task)
         setProgressBlock(forTask: task, progressBlock)
-        task.resume()
+        resume(task: task, promise: promise)
         return promise
     }
 
@@ -702,7 +793,59 @@ public extension OWSURLSession {
         }
         requestConfig = self.requestConfig(forTask: task)
         setProgressBlock(forTask: task, progressBlock)
-        task.resume()
+        resume(task: task, promise: promise)
+        return promise
+    }
+
+    // The body is read from bodyStream as it is sent, so it needn't
+    // exist in memory or on disk before the upload starts.
+    //
+    // bodyStreamBlock provides the body stream. It is called again if the
+    // body has to be re-sent, and must return a stream with the same content.
+    func uploadTaskPromise(_ urlString: String,
+                           method: HTTPMethod,
+                           headers: [String: String]? = nil,
+                           bodyStreamBlock: @escaping BodyStreamBlock,
+                           progress progressBlock: ProgressBlock? = nil) -> Promise<OWSHTTPResponse> {
+        firstly(on: .global()) { () -> Promise<OWSHTTPResponse> in
+            let request = try self.buildRequest(urlString, method: method, headers: headers)
+            return self.uploadTaskPromise(streamedRequest: request,
+                                          bodyStreamBlock: bodyStreamBlock,
+                                          progress: progressBlock)
+        }
+    }
+
+    func uploadTaskPromise(streamedRequest request: URLRequest,
+                           bodyStreamBlock: @escaping BodyStreamBlock,
+                           progress progressBlock: ProgressBlock? = nil) -> Promise<OWSHTTPResponse> {
+
+        guard !Self.appExpiry.isExpired else {
+            return Promise(error: OWSAssertionError("App is expired."))
+        }
+        guard let bodyStream = bodyStreamBlock() else {
+            return Promise(error: OWSAssertionError("Missing body stream."))
+        }
+        var request = request
+        request.httpBodyStream = bodyStream
+
+        let (promise, resolver) = Promise<OWSHTTPResponse>.pending()
+        var requestConfig: RequestConfig?
+        // Data tasks send httpBodyStream, and report upload progress like upload tasks.
+        let task = session.dataTask(with: request) { (responseData: Data?, _: URLResponse?, _: Error?) in
+            guard let requestConfig = requestConfig else {
+                owsFailDebug("Missing requestConfig.")
+                return
+            }
+            self.setProgressBlock(forTask: requestConfig.task, nil)
+            self.setBodyStreamBlock(forTask: requestConfig.task, nil)
+            Self.handleGenericTaskCompletion(resolver: resolver,
+                                             requestConfig: requestConfig,
+                                             responseData: responseData)
+        }
+        requestConfig = self.requestConfig(forTask: task)
+        setProgressBlock(forTask: task, progressBlock)
+        setBodyStreamBlock(forTask: task, bodyStreamBlock)
+        resume(task: task, promise: promise)
         return promise
     }
 
@@ -724,6 +867,15 @@ public extension OWSURLSession {
             return Promise(error: OWSAssertionError("App is expired."))
         }
 
+        guard let coalescingKey = self.coalescingKey(forRequest: request) else {
+            return uncoalescedDataTaskPromise(request: request)
+        }
+        return Self.singleflight.perform(key: coalescingKey) {
+            self.uncoalescedDataTaskPromise(request: request)
+        }
+    }
+
+    private func uncoalescedDataTaskPromise(request: URLRequest) -> Promise<OWSHTTPResponse> {
         let (promise, resolver) = Promise<OWSHTTPResponse>.pending()
         var requestConfig: RequestConfig?
         let task = session.dataTask(with: request) { (responseData: Data?, _: URLResponse?, _: Error?) in
@@ -737,7 +889,7 @@ public extension OWSURLSession {
                                              responseData: responseData)
         }
         requestConfig = self.requestConfig(forTask: task)
-        task.resume()
+        resume(task: task, promise: promise)
         return promise
     }
 
@@ -779,7 +931,7 @@ public extension OWSURLSession {
                                                  requestConfig: requestConfig,
                                                  downloadUrl: downloadUrl)
         }
-        task.resume()
+        resume(task: task, promise: promise)
         return promise
     }
 
@@ -807,7 +959,7 @@ public extension OWSURLSession {
                                                  requestConfig: requestConfig,
                                                  downloadUrl: downloadUrl)
         }
-        task.resume()
+        resume(task: task, promise: promise)
         return promise
     }
 }
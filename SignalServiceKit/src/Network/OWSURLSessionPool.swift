@@ -0,0 +1,237 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// A URLSession keeps its connections open between requests and multiplexes
+// concurrent requests to each host over a single HTTP/2 connection. But
+// OWSURLSession is typically used for a single request, so each request to
+// the CDN or storage service would otherwise pay for its own TCP and TLS
+// handshakes.
+//
+// OWSURLSessionPool shares one URLSession between all OWSURLSessions with the
+// same pool key, forwarding each task's delegate callbacks to the
+// OWSURLSession that created it.
+@objc
+public class OWSURLSessionPool: NSObject {
+
+    @objc
+    public static let shared = OWSURLSessionPool()
+
+    private static let operationQueue: OperationQueue = {
+        let queue = OperationQueue()
+        queue.underlyingQueue = .global()
+        return queue
+    }()
+
+    private let lock = UnfairLock()
+
+    // These properties should only be accessed while holding the lock.
+    private var sessions = [String: URLSession]()
+    private var taskOwners = [ObjectIdentifier: OWSURLSession]()
+    private var metrics = ConnectionMetrics()
+
+    // MARK: -
+
+    func session(forKey key: String, configuration: URLSessionConfiguration) -> URLSession {
+        lock.withLock {
+            if let session = sessions[key] {
+                return session
+            }
+            let session = URLSession(configuration: configuration, delegate: self, delegateQueue: Self.operationQueue)
+            sessions[key] = session
+            return session
+        }
+    }
+
+    // Owners must be registered before their tasks are resumed.
+    func register(task: URLSessionTask, owner: OWSURLSession) {
+        lock.withLock {
+            taskOwners[ObjectIdentifier(task)] = owner
+        }
+    }
+
+    private func owner(forTask task: URLSessionTask) -> OWSURLSession? {
+        lock.withLock {
+            taskOwners[ObjectIdentifier(task)]
+        }
+    }
+
+    private func unregister(task: URLSessionTask) {
+        lock.withLock {
+            _ = taskOwners.removeValue(forKey: ObjectIdentifier(task))
+        }
+    }
+
+    /// Discards all pooled sessions, e.g. when censorship circumvention
+    /// changes which hosts we connect to. In-flight tasks are allowed to
+    /// finish.
+    @objc
+    public func removeAllSessions() {
+        let sessions: [URLSession] = lock.withLock {
+            let sessions = Array(self.sessions.values)
+            self.sessions.removeAll()
+            return sessions
+        }
+        for session in sessions {
+            session.finishTasksAndInvalidate()
+        }
+    }
+
+    // MARK: - Metrics
+
+    struct ConnectionMetrics {
+        var newConnectionCount: UInt = 0
+        var reusedConnectionCount: UInt = 0
+        var http2ConnectionCount: UInt = 0
+        var handshakeCount: UInt = 0
+        var totalHandshakeDuration: TimeInterval = 0
+
+        var connectionReuseRatio: Double {
+            let total = newConnectionCount + reusedConnectionCount
+            guard total > 0 else {
+                return 0
+            }
+            return Double(reusedConnectionCount) / Double(total)
+        }
+
+        var averageHandshakeDuration: TimeInterval {
+            guard handshakeCount > 0 else {
+                return 0
+            }
+            return totalHandshakeDuration / Double(handshakeCount)
+        }
+
+        mutating func record(_ transaction: URLSessionTaskTransactionMetrics) {
+            guard transaction.resourceFetchType == .networkLoad else {
+                return
+            }
+            if transaction.isReusedConnection {
+                reusedConnectionCount += 1
+                return
+            }
+            newConnectionCount += 1
+            if transaction.networkProtocolName == "h2" {
+                http2ConnectionCount += 1
+            }
+            // The TCP and TLS handshakes.
+            if let connectStartDate = transaction.connectStartDate,
+               let connectEndDate = transaction.connectEndDate {
+                handshakeCount += 1
+                totalHandshakeDuration += connectEndDate.timeIntervalSince(connectStartDate)
+            }
+        }
+    }
+
+    /// The fraction of requests which were sent on an existing connection.
+    @objc
+    public var connectionReuseRatio: Double {
+        lock.withLock { metrics.connectionReuseRatio }
+    }
+
+    /// The mean time taken to establish new connections.
+    @objc
+    public var averageHandshakeDuration: TimeInterval {
+        lock.withLock { metrics.averageHandshakeDuration }
+    }
+
+    @objc
+    public func logMetrics() {
+        let metrics = lock.withLock { self.metrics }
+        Logger.info("Connections: \(metrics.newConnectionCount) new (\(metrics.http2ConnectionCount) HTTP/2), " +
+                        "\(metrics.reusedConnectionCount) reused, " +
+                        "reuse ratio: \(String(format: "%.2f", metrics.connectionReuseRatio)), " +
+                        "average handshake: \(String(format: "%.3f", metrics.averageHandshakeDuration))s.")
+    }
+
+    func record(metrics taskMetrics: URLSessionTaskMetrics) {
+        lock.withLock {
+            for transaction in taskMetrics.transactionMetrics {
+                metrics.record(transaction)
+            }
+        }
+    }
+}
+
+// MARK: -
+
+// Server trust challenges are forwarded to each task's owner; the pool key
+// should therefore identify the security policy as well as the host.
+extension OWSURLSessionPool: URLSessionTaskDelegate {
+
+    public func urlSession(_ session: URLSession,
+                           task: URLSessionTask,
+                           didReceive challenge: URLAuthenticationChallenge,
+                           completionHandler: @escaping OWSURLSession.URLAuthenticationChallengeCompletion) {
+        guard let owner = owner(forTask: task) else {
+            owsFailDebug("Missing owner.")
+            completionHandler(.cancelAuthenticationChallenge, nil)
+            return
+        }
+        owner.urlSession(session, task: task, didReceive: challenge, completionHandler: completionHandler)
+    }
+
+    public func urlSession(_ session: URLSession,
+                           task: URLSessionTask,
+                           willPerformHTTPRedirection response: HTTPURLResponse,
+                           newRequest: URLRequest,
+                           completionHandler: @escaping (URLRequest?) -> Void) {
+        guard let owner = owner(forTask: task) else {
+            owsFailDebug("Missing owner.")
+            completionHandler(nil)
+            return
+        }
+        owner.urlSession(session,
+                         task: task,
+                         willPerformHTTPRedirection: response,
+                         newRequest: newRequest,
+                         completionHandler: completionHandler)
+    }
+
+    public func urlSession(_ session: URLSession,
+                           task: URLSessionTask,
+                           didSendBodyData bytesSent: Int64,
+                           totalBytesSent: Int64,
+                           totalBytesExpectedToSend: Int64) {
+        owner(forTask: task)?.urlSession(session,
+                                         task: task,
+                                         didSendBodyData: bytesSent,
+                                         totalBytesSent: totalBytesSent,
+                                         totalBytesExpectedToSend: totalBytesExpectedToSend)
+    }
+
+    public func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        record(metrics: metrics)
+        // Tasks with completion handlers may not be sent didCompleteWithError.
+        unregister(task: task)
+    }
+
+    public func urlSession(_ session: URLSession, task: URLSessionTask, didCompleteWithError error: Error?) {
+        unregister(task: task)
+    }
+}
+
+// MARK: -
+
+extension OWSURLSessionPool: URLSessionDownloadDelegate {
+
+    public func urlSession(_ session: URLSession, downloadTask: URLSessionDownloadTask, didFinishDownloadingTo location: URL) {
+        owner(forTask: downloadTask)?.urlSession(session, downloadTask: downloadTask, didFinishDownloadingTo: location)
+    }
+
+    public func urlSession(_ session: URLSession, downloadTask: URLSessionDownloadTask, didWriteData bytesWritten: Int64, totalBytesWritten: Int64, totalBytesExpectedToWrite: Int64) {
+        owner(forTask: downloadTask)?.urlSession(session,
+                                                 downloadTask: downloadTask,
+                                                 didWriteData: bytesWritten,
+                                                 totalBytesWritten: totalBytesWritten,
+                                                 totalBytesExpectedToWrite: totalBytesExpectedToWrite)
+    }
+
+    public func urlSession(_ session: URLSession, downloadTask: URLSessionDownloadTask, didResumeAtOffset fileOffset: Int64, expectedTotalBytes: Int64) {
+        owner(forTask: downloadTask)?.urlSession(session,
+                                                 downloadTask: downloadTask,
+                                                 didResumeAtOffset: fileOffset,
+                                                 expectedTotalBytes: expectedTotalBytes)
+    }
+}
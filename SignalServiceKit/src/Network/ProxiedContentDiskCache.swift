@@ -0,0 +1,195 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// A size-bounded disk cache of downloaded proxied content, so that assets
+// survive across launches.
+//
+// Each entry is a content file plus a small metadata file, named after the
+// SHA-256 digest of the asset URL so that the cache doesn't reveal which
+// URLs were fetched. Entries are evicted least-recently-used first, using
+// the content file's modification date, which is bumped on each access.
+//
+// Entries are served without revalidation while they are fresh. Stale
+// entries can be revalidated against their ETag.
+public class ProxiedContentDiskCache {
+
+    public struct Entry {
+        public let url: URL
+        public let filePath: String
+        public let etag: String?
+        public let isFresh: Bool
+    }
+
+    private struct Metadata: Codable {
+        let etag: String?
+        let storedDate: Date
+    }
+
+    private let dirPath: String
+    private let maxSizeBytes: UInt64
+    private let freshnessInterval: TimeInterval
+
+    private let serialQueue = DispatchQueue(label: "org.signal.proxied-content-disk-cache")
+
+    public init(dirPath: String, maxSizeBytes: UInt64, freshnessInterval: TimeInterval) {
+        self.dirPath = dirPath
+        self.maxSizeBytes = maxSizeBytes
+        self.freshnessInterval = freshnessInterval
+    }
+
+    private func ensureDirectory() -> Bool {
+        guard OWSFileSystem.ensureDirectoryExists(dirPath) else {
+            owsFailDebug("Could not create cache directory.")
+            return false
+        }
+        // Don't back up cached content.
+        OWSFileSystem.protectFileOrFolder(atPath: dirPath)
+        return true
+    }
+
+    private func baseName(forUrl url: URL) -> String? {
+        guard let urlData = url.absoluteString.data(using: .utf8),
+              let digest = Cryptography.computeSHA256Digest(urlData) else {
+            owsFailDebug("Could not hash URL.")
+            return nil
+        }
+        return digest.hexadecimalString
+    }
+
+    private func contentPath(forBaseName baseName: String) -> String {
+        (dirPath as NSString).appendingPathComponent(baseName)
+    }
+
+    private func metadataPath(forBaseName baseName: String) -> String {
+        (dirPath as NSString).appendingPathComponent(baseName + ".metadata")
+    }
+
+    // MARK: -
+
+    // Lookups don't wait for writes or eviction, so an entry may be evicted
+    // before its file is used.
+    public func entry(forUrl url: URL) -> Entry? {
+        guard let baseName = baseName(forUrl: url) else {
+            return nil
+        }
+        let contentPath = self.contentPath(forBaseName: baseName)
+        let metadataPath = self.metadataPath(forBaseName: baseName)
+        guard OWSFileSystem.fileOrFolderExists(atPath: contentPath),
+              let metadataData = try? Data(contentsOf: URL(fileURLWithPath: metadataPath)),
+              let metadata = try? JSONDecoder().decode(Metadata.self, from: metadataData) else {
+            return nil
+        }
+        touch(contentPath: contentPath)
+        let isFresh = abs(metadata.storedDate.timeIntervalSinceNow) < freshnessInterval
+        return Entry(url: url, filePath: contentPath, etag: metadata.etag, isFresh: isFresh)
+    }
+
+    /// Adds a copy of the file at filePath to the cache.
+    public func store(url: URL, filePath: String, etag: String?) {
+        serialQueue.async {
+            guard self.ensureDirectory(),
+                  let baseName = self.baseName(forUrl: url) else {
+                return
+            }
+            let contentPath = self.contentPath(forBaseName: baseName)
+            let metadataPath = self.metadataPath(forBaseName: baseName)
+            do {
+                OWSFileSystem.deleteFileIfExists(contentPath)
+                try Self.linkOrCopyItem(atPath: filePath, toPath: contentPath)
+                let metadata = Metadata(etag: etag, storedDate: Date())
+                try JSONEncoder().encode(metadata).write(to: URL(fileURLWithPath: metadataPath), options: .atomic)
+            } catch {
+                owsFailDebug("Could not cache asset: \(error)")
+                OWSFileSystem.deleteFileIfExists(contentPath)
+                OWSFileSystem.deleteFileIfExists(metadataPath)
+                return
+            }
+            self.evictIfNecessary()
+        }
+    }
+
+    /// Marks a stale entry as fresh after it has been revalidated.
+    public func markRevalidated(url: URL, etag: String?) {
+        serialQueue.async {
+            guard let baseName = self.baseName(forUrl: url) else {
+                return
+            }
+            let metadata = Metadata(etag: etag, storedDate: Date())
+            do {
+                try JSONEncoder().encode(metadata).write(to: URL(fileURLWithPath: self.metadataPath(forBaseName: baseName)),
+                                                         options: .atomic)
+            } catch {
+                owsFailDebug("Could not update metadata: \(error)")
+            }
+        }
+    }
+
+    // MARK: -
+
+    // Assets on disk are deleted when they're no longer in use, and cached
+    // files must never be modified in place, so they are linked where possible.
+    public static func linkOrCopyItem(atPath srcPath: String, toPath dstPath: String) throws {
+        do {
+            try FileManager.default.linkItem(atPath: srcPath, toPath: dstPath)
+        } catch {
+            try FileManager.default.copyItem(atPath: srcPath, toPath: dstPath)
+        }
+    }
+
+    private func touch(contentPath: String) {
+        do {
+            try FileManager.default.setAttributes([.modificationDate: Date()], ofItemAtPath: contentPath)
+        } catch {
+            Logger.warn("Could not touch cache entry: \(error)")
+        }
+    }
+
+    private func evictIfNecessary() {
+        assertOnQueue(serialQueue)
+
+        let dirUrl = URL(fileURLWithPath: dirPath)
+        let keys: [URLResourceKey] = [.fileSizeKey, .contentModificationDateKey]
+        guard let fileUrls = try? FileManager.default.contentsOfDirectory(at: dirUrl,
+                                                                          includingPropertiesForKeys: keys,
+                                                                          options: .skipsHiddenFiles) else {
+            owsFailDebug("Could not enumerate cache.")
+            return
+        }
+
+        struct ContentFile {
+            let path: String
+            let size: UInt64
+            let modificationDate: Date
+        }
+        var contentFiles = [ContentFile]()
+        var totalSize: UInt64 = 0
+        for fileUrl in fileUrls where fileUrl.pathExtension.isEmpty {
+            guard let values = try? fileUrl.resourceValues(forKeys: Set(keys)) else {
+                continue
+            }
+            let size = UInt64(values.fileSize ?? 0)
+            totalSize += size
+            contentFiles.append(ContentFile(path: fileUrl.path,
+                                            size: size,
+                                            modificationDate: values.contentModificationDate ?? Date.distantPast))
+        }
+        guard totalSize > maxSizeBytes else {
+            return
+        }
+
+        var evictedCount: UInt = 0
+        for contentFile in contentFiles.sorted(by: { $0.modificationDate < $1.modificationDate }) {
+            guard totalSize > maxSizeBytes else {
+                break
+            }
+            OWSFileSystem.deleteFileIfExists(contentFile.path)
+            OWSFileSystem.deleteFileIfExists(contentFile.path + ".metadata")
+            totalSize -= min(totalSize, contentFile.size)
+            evictedCount += 1
+        }
+        Logger.info("Evicted \(evictedCount) entries.")
+    }
+}
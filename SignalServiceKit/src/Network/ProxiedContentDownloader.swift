@@ -171,6 +171,11 @@ public class ProxiedContentAssetRequest: NSObject {
         }
     }
     public weak var contentLengthTask: URLSessionDataTask?
+    // The asset's ETag, if any, from the content length response.
+    var etag: String?
+    var hasCheckedDiskCache = false
+    // A stale disk cache entry which the content length request revalidates.
+    var revalidationEntry: ProxiedContentDiskCache.Entry?
 
     init(assetDescription: ProxiedContentAssetDescription,
          priority: ProxiedContentRequestPriority,
@@ -298,6 +303,20 @@ public class ProxiedContentAssetRequest: NSObject {
         return true
     }
 
+    public func linkAssetFile(diskCacheEntry: ProxiedContentDiskCache.Entry,
+                              downloadFolderPath: String) -> ProxiedContentAsset? {
+        let fileName = (NSUUID().uuidString as NSString).appendingPathExtension(assetDescription.fileExtension)!
+        let filePath = (downloadFolderPath as NSString).appendingPathComponent(fileName)
+        do {
+            try ProxiedContentDiskCache.linkOrCopyItem(atPath: diskCacheEntry.filePath, toPath: filePath)
+            return ProxiedContentAsset(assetDescription: assetDescription, filePath: filePath)
+        } catch {
+            // The entry may have been evicted.
+            Logger.warn("Could not use cached asset: \(error)")
+            return nil
+        }
+    }
+
     public func writeAssetToFile(downloadFolderPath: String) -> ProxiedContentAsset? {
 
         var assetData = Data()
@@ -465,9 +484,25 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
 
         SwiftSingletons.register(self)
 
+        // The asset map is only accessed on the main thread, so it can
+        // safely shed its entries under memory pressure.
+        MemoryAccountant.shared.register(assetMap,
+                                         name: "ProxiedContent-\(downloadFolderName) assets",
+                                         sheddingPriority: .first)
+
         ensureDownloadFolder()
     }
 
+    // Assets which were downloaded in earlier launches. GIFs and other
+    // proxied assets rarely change, so entries are only revalidated after
+    // a week.
+    private lazy var diskCache: ProxiedContentDiskCache = {
+        let dirPath = (OWSFileSystem.cachesDirectoryPath() as NSString).appendingPathComponent("ProxiedContent-" + downloadFolderName)
+        return ProxiedContentDiskCache(dirPath: dirPath,
+                                       maxSizeBytes: 100 * 1024 * 1024,
+                                       freshnessInterval: 7 * kDayInterval)
+    }()
+
     deinit {
         NotificationCenter.default.removeObserver(self)
     }
@@ -566,6 +601,7 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
         assetRequest.state = .complete
 
         // Move write off main thread.
+        let etag = assetRequest.etag
         DispatchQueue.global().async {
             guard let downloadFolderPath = self.downloadFolderPath else {
                 owsFailDebug("Missing downloadFolderPath")
@@ -575,11 +611,37 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
                 self.segmentRequestDidFail(assetRequest: assetRequest)
                 return
             }
+            self.diskCache.store(url: assetRequest.assetDescription.url as URL, filePath: asset.filePath, etag: etag)
             self.assetRequestDidSucceed(assetRequest: assetRequest, asset: asset)
         }
         return true
     }
 
+    private func completeRequestFromDiskCache(assetRequest: ProxiedContentAssetRequest,
+                                              diskCacheEntry: ProxiedContentDiskCache.Entry) {
+        AssertIsOnMainThread()
+
+        assetRequest.state = .complete
+
+        DispatchQueue.global().async {
+            guard let downloadFolderPath = self.downloadFolderPath else {
+                owsFailDebug("Missing downloadFolderPath")
+                return
+            }
+            guard let asset = assetRequest.linkAssetFile(diskCacheEntry: diskCacheEntry,
+                                                         downloadFolderPath: downloadFolderPath) else {
+                // Fall back to downloading the asset.
+                DispatchQueue.main.async {
+                    assetRequest.state = .waiting
+                    assetRequest.revalidationEntry = nil
+                    self.processRequestQueueSync()
+                }
+                return
+            }
+            self.assetRequestDidSucceed(assetRequest: assetRequest, asset: asset)
+        }
+    }
+
     private func assetRequestDidSucceed(assetRequest: ProxiedContentAssetRequest, asset: ProxiedContentAsset) {
         DispatchQueue.main.async {
             self.assetMap.set(key: assetRequest.assetDescription.url, value: asset)
@@ -660,6 +722,21 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             return
         }
 
+        if assetRequest.state == .waiting, !assetRequest.hasCheckedDiskCache {
+            assetRequest.hasCheckedDiskCache = true
+
+            if let diskCacheEntry = diskCache.entry(forUrl: assetRequest.assetDescription.url as URL) {
+                if diskCacheEntry.isFresh {
+                    Logger.verbose("asset disk cache hit: \(assetRequest.assetDescription.url)")
+                    completeRequestFromDiskCache(assetRequest: assetRequest, diskCacheEntry: diskCacheEntry)
+                    processRequestQueueSync()
+                    return
+                } else if diskCacheEntry.etag != nil {
+                    assetRequest.revalidationEntry = diskCacheEntry
+                }
+            }
+        }
+
         if assetRequest.state == .waiting {
             // If asset request hasn't yet determined the resource size,
             // try to do so now, by requesting a small initial segment.
@@ -672,6 +749,9 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             request.httpShouldUsePipelining = true
             let rangeHeaderValue = "bytes=\(segmentStart)-\(segmentStart + segmentLength - 1)"
             request.addValue(rangeHeaderValue, forHTTPHeaderField: "Range")
+            if let etag = assetRequest.revalidationEntry?.etag {
+                request.addValue(etag, forHTTPHeaderField: "If-None-Match")
+            }
 
             guard ContentProxy.configureProxiedRequest(request: &request) else {
                 assetRequest.state = .failed
@@ -724,6 +804,22 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             self.assetRequestDidFail(assetRequest: assetRequest)
             return
         }
+        if let httpResponse = response as? HTTPURLResponse,
+           httpResponse.statusCode == 304 {
+            DispatchQueue.main.async {
+                guard let revalidationEntry = assetRequest.revalidationEntry else {
+                    owsFailDebug("Unexpected revalidation response.")
+                    assetRequest.state = .failed
+                    self.assetRequestDidFail(assetRequest: assetRequest)
+                    return
+                }
+                Logger.verbose("asset disk cache revalidated: \(assetRequest.assetDescription.url)")
+                self.diskCache.markRevalidated(url: revalidationEntry.url, etag: revalidationEntry.etag)
+                self.completeRequestFromDiskCache(assetRequest: assetRequest, diskCacheEntry: revalidationEntry)
+                self.processRequestQueueSync()
+            }
+            return
+        }
         guard let data = data,
         data.count > 0 else {
             owsFailDebug("Asset size response missing data.")
@@ -744,6 +840,7 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             return
         }
         var firstContentRangeString: String?
+        var etag: String?
         for header in httpResponse.allHeaderFields.keys {
             guard let headerString = header as? String else {
                 owsFailDebug("Invalid header: \(header)")
@@ -751,6 +848,8 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             }
             if headerString.lowercased() == "content-range" {
                 firstContentRangeString = httpResponse.allHeaderFields[header] as? String
+            } else if headerString.lowercased() == "etag" {
+                etag = httpResponse.allHeaderFields[header] as? String
             }
         }
         guard let contentRangeString = firstContentRangeString else {
@@ -783,6 +882,7 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
         }
 
         DispatchQueue.main.async {
+            assetRequest.etag = etag
             assetRequest.contentLength = contentLength
             assetRequest.createSegments(withInitialData: data)
             assetRequest.state = .active
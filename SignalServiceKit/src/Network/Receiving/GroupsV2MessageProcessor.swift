@@ -526,7 +526,12 @@ private class GroupsMessageProcessor: MessageProcessingPipelineStage {
     // Therefore, when trying to process we try to process either:
     //
     // * The first N messages that can be processed "without update".
-    // * The first message, which has to be processed "with update".
+    // * The first message, which has to be processed "with update",
+    //   along with the consecutive messages after it which don't need
+    //   a later revision than it does. The group is updated to the
+    //   first message's revision, which is the lowest any of them
+    //   needs, so that no message is processed against a group state
+    //   newer than the one it was sent in.
     //
     // Which type of batch we try to process is determined by the
     // message at the head of the queue.
@@ -575,33 +580,34 @@ private class GroupsMessageProcessor: MessageProcessingPipelineStage {
         //
         // "Update" jobs may require interaction with the service, namely
         // fetching group changes or latest group state.
-        var isUpdateBatch = false
+        var updateRevision: UInt32?
         var jobInfos = [IncomingGroupsV2MessageJobInfo]()
         for job in jobs {
             let jobInfo = self.jobInfo(forJob: job, transaction: transaction)
             let canJobBeProcessedWithoutUpdate = self.canJobBeProcessedWithoutUpdate(jobInfo: jobInfo, transaction: transaction)
             if !canJobBeProcessedWithoutUpdate {
-                if jobInfos.count > 0 {
+                if let updateRevision = updateRevision {
+                    // Jobs which were sent in the revision we're updating to, or an
+                    // earlier one, can join this batch.
+                    guard let revision = jobInfo.groupContext?.revision,
+                          revision <= updateRevision else {
+                        break
+                    }
+                } else if jobInfos.count > 0 {
                     // Can't add "update" job to "no update" batch, abort and process jobs
                     // already added to batch.
                     break
+                } else {
+                    // Update batches start with an "update" job, and gather the
+                    // consecutive jobs after it.
+                    updateRevision = jobInfo.groupContext?.revision ?? 0
                 }
-                // Update batches should only contain a single job.
-                isUpdateBatch = true
-                jobInfos.append(jobInfo)
-                break
             }
             jobInfos.append(jobInfo)
         }
 
-        if isUpdateBatch {
-            assert(jobInfos.count == 1)
-            guard let jobInfo = jobInfos.first else {
-                owsFailDebug("Missing job")
-                completion([], false, transaction)
-                return
-            }
-            updateGroupAndProcessJobAsync(jobInfo: jobInfo, completion: completion)
+        if updateRevision != nil {
+            updateGroupAndProcessJobsAsync(jobInfos: jobInfos, completion: completion)
         } else {
             let processedJobs = performLocalProcessingSync(jobInfos: jobInfos,
                                                            transaction: transaction)
@@ -666,16 +672,25 @@ private class GroupsMessageProcessor: MessageProcessingPipelineStage {
         case failureShouldFailoverToService
     }
 
-    private func updateGroupAndProcessJobAsync(jobInfo: IncomingGroupsV2MessageJobInfo,
-                                               completion: @escaping BatchCompletionBlock) {
+    // The first job is the one which needs an update.
+    private func updateGroupAndProcessJobsAsync(jobInfos: [IncomingGroupsV2MessageJobInfo],
+                                                completion: @escaping BatchCompletionBlock) {
+        guard let jobInfo = jobInfos.first else {
+            owsFailDebug("Missing job")
+            databaseStorage.write { transaction in
+                completion([], false, transaction)
+            }
+            return
+        }
 
         firstly {
             updateGroupPromise(jobInfo: jobInfo)
         }.map(on: DispatchQueue.global()) { (updateOutcome: UpdateOutcome) throws -> Void in
             switch updateOutcome {
             case .successShouldProcess:
+                // Process all of the jobs in the batch in a single transaction.
                 self.databaseStorage.write { transaction in
-                    let processedJobs = self.performLocalProcessingSync(jobInfos: [jobInfo], transaction: transaction)
+                    let processedJobs = self.performLocalProcessingSync(jobInfos: jobInfos, transaction: transaction)
                     completion(processedJobs, false, transaction)
                 }
             case .failureShouldDiscard:
@@ -701,8 +716,10 @@ private class GroupsMessageProcessor: MessageProcessingPipelineStage {
                     Logger.warn("Discarding unprocess-able message: \(error)")
 
                     // Do not retry
-                    // _Do_ include the job in the processed jobs.
-                    //      It will be discarded.
+                    // _Do_ include the first job in the processed jobs.
+                    //      The update was for it, so it is the job which
+                    //      failed; it will be discarded. The other jobs in
+                    //      the batch will be re-evaluated in the next batch.
                     // _Do not_ wait before retrying.
                     completion([jobInfo.job], false, transaction)
                 }
@@ -58,7 +58,7 @@ public class SSKMessageDecryptJobQueue: NSObject, JobQueue {
         // The pipeline supervisor will post updates when we can process messages
         // Suspend our operation queue if we should pause our work
         pipelineSupervisor.register(pipelineStage: self)
-        defaultQueue.isSuspended = !pipelineSupervisor.isMessageProcessingPermitted
+        setLanesSuspended(!pipelineSupervisor.isMessageProcessingPermitted)
 
         // GRDB TODO: Is it really a concern to run the decrypt queue when we're unregistered?
         // If we want this behavior, we should observe registration state changes, and rerun
@@ -81,25 +81,236 @@ public class SSKMessageDecryptJobQueue: NSObject, JobQueue {
     }
 
     public func buildOperation(jobRecord: SSKMessageDecryptJobRecord, transaction: SDSAnyReadTransaction) throws -> SSKMessageDecryptOperation {
-        return SSKMessageDecryptOperation(jobRecord: jobRecord)
+        let operation = SSKMessageDecryptOperation(jobRecord: jobRecord)
+        addLaneDependencies(operation: operation,
+                            laneKey: Self.laneKey(envelopeData: jobRecord.envelopeData))
+        return operation
     }
 
-    let defaultQueue: OperationQueue = {
-        let operationQueue = OperationQueue()
-        operationQueue.name = "MessageDecryptQueue"
-        operationQueue.maxConcurrentOperationCount = 1
-
-        return operationQueue
+    // MARK: Lanes
+
+    // Envelopes are decrypted in "lanes": serial operation queues which
+    // run concurrently with one another. Every envelope from a given
+    // sender is routed to the same lane, so a sender's envelopes are
+    // decrypted in the order in which they were received and the
+    // session state in SSKSessionStore is always advanced in order.
+    //
+    // Sealed sender envelopes do not reveal their sender until they have
+    // been decrypted, so they could be from any sender. Each one is a
+    // barrier: it waits for every earlier envelope in every lane, and
+    // every later envelope waits for it. A sender's sealed and unsealed
+    // envelopes are therefore still decrypted in order, and only runs of
+    // unsealed envelopes from different senders decrypt concurrently.
+    //
+    // Note that decryption itself still happens within a write transaction;
+    // lanes let envelopes from different senders be parsed, validated and
+    // queued for their transaction without waiting on one another.
+    static let laneCount: Int = 4
+
+    let lanes: [OperationQueue] = {
+        return (0..<SSKMessageDecryptJobQueue.laneCount).map { index in
+            let operationQueue = OperationQueue()
+            operationQueue.name = "MessageDecryptQueue-\(index)"
+            operationQueue.maxConcurrentOperationCount = 1
+            return operationQueue
+        }
     }()
 
+    static let unidentifiedSenderLaneKey = "unidentifiedSender"
+
+    static func laneKey(envelopeData: Data?) -> String {
+        guard let envelopeData = envelopeData,
+              let envelope = try? EnvelopeHandleCache.shared.handle(envelopeData: envelopeData, consume: false).envelope else {
+            // Unparseable envelopes fail quickly in their operation;
+            // it doesn't matter which lane they use.
+            return unidentifiedSenderLaneKey
+        }
+        guard envelope.type != .unidentifiedSender,
+              let sourceAddress = envelope.sourceAddress else {
+            return unidentifiedSenderLaneKey
+        }
+        // Prefer the uuid; the address cache will fill it in for
+        // envelopes which only specify an e164.
+        return sourceAddress.uuidString ?? sourceAddress.phoneNumber ?? unidentifiedSenderLaneKey
+    }
+
+    static func laneIndex(laneKey: String) -> Int {
+        // String.hashValue is seeded per-process, which is fine since lanes
+        // only need to be stable for the lifetime of the process.
+        let hash = laneKey.hashValue
+        let index = hash % laneCount
+        return index < 0 ? index + laneCount : index
+    }
+
+    private let laneLock = UnfairLock()
+    // The properties below should only be accessed with laneLock.
+    private var lastLaneOperations = [Int: Operation]()
+    private var lastBarrierOperation: Operation?
+
+    // Operations are built in the order they are enqueued, so this
+    // orders them relative to the earlier operations.
+    private func addLaneDependencies(operation: Operation, laneKey: String) {
+        laneLock.withLock {
+            if laneKey == Self.unidentifiedSenderLaneKey {
+                for laneOperation in lastLaneOperations.values where !laneOperation.isFinished {
+                    operation.addDependency(laneOperation)
+                }
+                lastLaneOperations.removeAll()
+                lastBarrierOperation = operation
+            } else if let barrierOperation = lastBarrierOperation, !barrierOperation.isFinished {
+                operation.addDependency(barrierOperation)
+            }
+            lastLaneOperations[Self.laneIndex(laneKey: laneKey)] = operation
+        }
+    }
+
     public func operationQueue(jobRecord: SSKMessageDecryptJobRecord) -> OperationQueue {
-        return defaultQueue
+        let laneKey = Self.laneKey(envelopeData: jobRecord.envelopeData)
+        return lanes[Self.laneIndex(laneKey: laneKey)]
+    }
+
+    fileprivate func setLanesSuspended(_ isSuspended: Bool) {
+        for lane in lanes {
+            lane.isSuspended = isSuspended
+        }
     }
 
     @objc
     public func hasPendingJobsObjc(transaction: SDSAnyReadTransaction) -> Bool {
         return hasPendingJobs(transaction: transaction)
     }
+
+    @objc
+    public func pendingJobCountObjc(transaction: SDSAnyReadTransaction) -> UInt {
+        return pendingJobCount(transaction: transaction)
+    }
+
+    // MARK: Batching
+
+    // In batched mode, up to this many envelopes are decrypted, handed to
+    // the OWSBatchMessageProcessor and have their job records removed
+    // within a single write transaction. This dramatically reduces the
+    // number of commits needed to drain a large backlog.
+    static let decryptBatchSize: Int = 32
+
+    private let batchQueue = DispatchQueue(label: "org.signal.messageDecryptJobQueue.batch")
+
+    private var messageDecrypter: OWSMessageDecrypter {
+        return SSKEnvironment.shared.messageDecrypter
+    }
+
+    private var batchMessageProcessor: OWSBatchMessageProcessor {
+        return SSKEnvironment.shared.batchMessageProcessor
+    }
+
+    public func workStep() {
+        guard FeatureFlags.batchedMessageDecryption else {
+            defaultWorkStep()
+            return
+        }
+
+        batchQueue.async {
+            self.drainBatchWorkStep()
+        }
+    }
+
+    private func drainBatchWorkStep() {
+        assertOnQueue(batchQueue)
+
+        guard !DebugFlags.suppressBackgroundActivity else {
+            // Don't process queues.
+            return
+        }
+        guard isSetup.get() else {
+            if !CurrentAppContext().isRunningTests {
+                owsFailDebug("not setup")
+            }
+            return
+        }
+        guard pipelineSupervisor.isMessageProcessingPermitted else {
+            // We'll resume when the supervisor resumes message processing.
+            return
+        }
+
+        var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+
+        var batchCount: Int = 0
+        databaseStorage.write { transaction in
+            var jobRecords = [SSKMessageDecryptJobRecord]()
+            self.finder.enumerateJobRecords(label: self.jobRecordLabel,
+                                            status: .ready,
+                                            transaction: transaction) { jobRecord, stopPointer in
+                jobRecords.append(jobRecord)
+                if jobRecords.count >= Self.decryptBatchSize {
+                    stopPointer.pointee = true
+                }
+            }
+
+            guard !jobRecords.isEmpty else {
+                Logger.verbose("nothing left to decrypt")
+                self.didFlushQueue(transaction: transaction)
+                return
+            }
+
+            for jobRecord in jobRecords {
+                self.decrypt(jobRecord: jobRecord, transaction: transaction)
+            }
+            batchCount = jobRecords.count
+        }
+        assert(backgroundTask != nil)
+        backgroundTask = nil
+
+        guard batchCount > 0 else {
+            return
+        }
+        Logger.verbose("decrypted batch of \(batchCount) envelopes.")
+
+        batchQueue.async {
+            self.drainBatchWorkStep()
+        }
+    }
+
+    private func decrypt(jobRecord: SSKMessageDecryptJobRecord, transaction: SDSAnyWriteTransaction) {
+        guard let envelopeData = jobRecord.envelopeData else {
+            owsFailDebug("envelopeData was unexpectedly nil")
+            jobRecord.saveAsPermanentlyFailed(transaction: transaction)
+            return
+        }
+        let envelope: SSKProtoEnvelope
+        do {
+            envelope = try EnvelopeHandleCache.shared.handle(envelopeData: envelopeData, consume: true).envelope
+        } catch {
+            owsFailDebug("Could not parse envelope: \(error)")
+            jobRecord.saveAsPermanentlyFailed(transaction: transaction)
+            return
+        }
+
+        let wasReceivedByUD = SSKMessageDecryptOperation.wasReceivedByUD(envelope: envelope)
+        let serverDeliveryTimestamp = jobRecord.serverDeliveryTimestamp
+        var didDecrypt = false
+        messageDecrypter.decryptEnvelope(envelope,
+                                         envelopeData: envelopeData,
+                                         transaction: transaction,
+                                         successBlock: { (result: OWSMessageDecryptResult, transaction: SDSAnyWriteTransaction) in
+                                            // See the comment in SSKMessageDecryptOperation.run().
+                                            self.batchMessageProcessor.enqueue(envelope: result.envelope,
+                                                                               envelopeData: result.envelopeData,
+                                                                               plaintextData: result.plaintextData,
+                                                                               wasReceivedByUD: wasReceivedByUD,
+                                                                               serverDeliveryTimestamp: serverDeliveryTimestamp,
+                                                                               transaction: transaction)
+                                            didDecrypt = true
+                                         },
+                                         failureBlock: {
+                                            // Decryption failures are not retryable.
+                                         })
+
+        if didDecrypt {
+            jobRecord.anyRemove(transaction: transaction)
+        } else {
+            jobRecord.saveAsPermanentlyFailed(transaction: transaction)
+        }
+    }
 }
 
 extension SSKMessageDecryptJobQueue: MessageProcessingPipelineStage {
@@ -108,11 +319,15 @@ extension SSKMessageDecryptJobQueue: MessageProcessingPipelineStage {
     }
 
     public func supervisorDidSuspendMessageProcessing(_ supervisor: MessagePipelineSupervisor) {
-        defaultQueue.isSuspended = true
+        setLanesSuspended(true)
     }
 
     public func supervisorDidResumeMessageProcessing(_ supervisor: MessagePipelineSupervisor) {
-        defaultQueue.isSuspended = false
+        setLanesSuspended(false)
+
+        if FeatureFlags.batchedMessageDecryption {
+            startWorkWhenAppIsReady()
+        }
     }
 }
 
@@ -166,8 +381,8 @@ public class SSKMessageDecryptOperation: OWSOperation, DurableOperation {
                 return
             }
 
-            let envelope = try SSKProtoEnvelope(serializedData: envelopeData)
-            let wasReceivedByUD = self.wasReceivedByUD(envelope: envelope)
+            let envelope = try EnvelopeHandleCache.shared.handle(envelopeData: envelopeData, consume: true).envelope
+            let wasReceivedByUD = Self.wasReceivedByUD(envelope: envelope)
             messageDecrypter.decryptEnvelope(envelope,
                                              envelopeData: envelopeData,
                                              successBlock: { (result: OWSMessageDecryptResult, transaction: SDSAnyWriteTransaction) in
@@ -177,11 +392,12 @@ public class SSKMessageDecryptOperation: OWSOperation, DurableOperation {
                                                 //
                                                 // NOTE: We use envelopeData from the decrypt result, not job.envelopeData,
                                                 // since the envelope may be altered by the decryption process in the UD case.
-                                                self.batchMessageProcessor.enqueueEnvelopeData(result.envelopeData,
-                                                                                               plaintextData: result.plaintextData,
-                                                                                               wasReceivedByUD: wasReceivedByUD,
-                                                                                               serverDeliveryTimestamp: self.jobRecord.serverDeliveryTimestamp,
-                                                                                               transaction: transaction)
+                                                self.batchMessageProcessor.enqueue(envelope: result.envelope,
+                                                                                   envelopeData: result.envelopeData,
+                                                                                   plaintextData: result.plaintextData,
+                                                                                   wasReceivedByUD: wasReceivedByUD,
+                                                                                   serverDeliveryTimestamp: self.jobRecord.serverDeliveryTimestamp,
+                                                                                   transaction: transaction)
                                                 DispatchQueue.global().async {
                                                     self.reportSuccess()
                                                 }
@@ -217,7 +433,7 @@ public class SSKMessageDecryptOperation: OWSOperation, DurableOperation {
 
     // MARK: -
 
-    private func wasReceivedByUD(envelope: SSKProtoEnvelope) -> Bool {
+    static func wasReceivedByUD(envelope: SSKProtoEnvelope) -> Bool {
         let hasSenderSource: Bool
         if envelope.hasValidSource {
             hasSenderSource = true
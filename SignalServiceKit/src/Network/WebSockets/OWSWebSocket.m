@@ -25,8 +25,6 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-static const CGFloat kSocketHeartbeatPeriodSeconds = 30.f;
-static const CGFloat kSocketReconnectDelaySeconds = 5.f;
 
 // If the app is in the background, it should keep the
 // websocket open if:
@@ -41,6 +39,13 @@ static const NSTimeInterval kKeepAliveDuration_MakeRequestInBackground = 20.f;
 // d) It has just received the response to a request.
 static const NSTimeInterval kKeepAliveDuration_ReceiveResponse = 5.f;
 
+// Acknowledgements for persisted envelopes are coalesced and flushed
+// together, either after a short delay or once enough have accumulated.
+// The protocol requires one response frame per request, but flushing them
+// together avoids waking the radio for every envelope in a burst.
+static const NSTimeInterval kAcknowledgementFlushDelaySeconds = 0.1f;
+static const NSUInteger kMaxPendingAcknowledgementCount = 32;
+
 NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificationWebSocketStateDidChange";
 
 @interface TSSocketMessage : NSObject
@@ -158,6 +163,13 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
 @property (nonatomic, nullable) id<SSKWebSocket> websocket;
 @property (nonatomic, nullable) NSTimer *heartbeatTimer;
 @property (nonatomic, nullable) NSTimer *reconnectTimer;
+@property (nonatomic, readonly) SocketKeepAlivePolicy *keepAlivePolicy;
+
+// Acknowledgements which have not yet been sent, in the order
+// in which their requests were received.
+@property (nonatomic, readonly) NSMutableArray<WebSocketProtoWebSocketRequestMessage *> *pendingAcknowledgements;
+@property (nonatomic, nullable) NSTimer *acknowledgementFlushTimer;
+@property (nonatomic, nullable) OWSBackgroundTask *acknowledgementBackgroundTask;
 
 #pragma mark -
 
@@ -225,6 +237,8 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     _hasEmptiedInitialQueue = NO;
     _willEmptyInitialQueue = NO;
     _socketMessageMap = [NSMutableDictionary new];
+    _pendingAcknowledgements = [NSMutableArray new];
+    _keepAlivePolicy = [SocketKeepAlivePolicy new];
 
     return self;
 }
@@ -311,6 +325,10 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
                                              selector:@selector(appExpiryDidChange:)
                                                  name:AppExpiry.AppExpiryDidChange
                                                object:nil];
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(reachabilityDidChange:)
+                                                 name:SSKReachability.owsReachabilityDidChange
+                                               object:nil];
 }
 
 #pragma mark - Manage Socket
@@ -418,14 +436,8 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
         case OWSWebSocketStateOpen: {
             OWSAssertDebug(self.state == OWSWebSocketStateConnecting);
 
-            self.heartbeatTimer = [NSTimer timerWithTimeInterval:kSocketHeartbeatPeriodSeconds
-                                                          target:self
-                                                        selector:@selector(webSocketHeartBeat)
-                                                        userInfo:nil
-                                                         repeats:YES];
-
-            // Additionally, we want the ping timer to work in the background too.
-            [[NSRunLoop mainRunLoop] addTimer:self.heartbeatTimer forMode:NSDefaultRunLoopMode];
+            [self.keepAlivePolicy socketDidOpen];
+            [self scheduleHeartbeat];
 
             // If the socket is open, we don't need to worry about reconnecting.
             [self clearReconnect];
@@ -478,11 +490,16 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
 {
     OWSAssertIsOnMainThread();
 
+    // Acknowledgements are only meaningful for the socket on which their
+    // requests were received, so flush them before we discard it.
+    [self flushPendingAcknowledgements];
+
     self.websocket.delegate = nil;
     [self.websocket disconnect];
     self.websocket = nil;
     [self.heartbeatTimer invalidate];
     self.heartbeatTimer = nil;
+    [self.keepAlivePolicy socketDidCloseUnexpectedly:NO];
 }
 
 - (void)closeWebSocket
@@ -735,6 +752,7 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     }
 
     OWSLogWarn(@"Websocket did fail with error: %@", error);
+    [self.keepAlivePolicy socketDidCloseUnexpectedly:self.state == OWSWebSocketStateOpen];
     if ([error.domain isEqualToString:SSKWebSocketError.errorDomain]) {
         NSNumber *_Nullable statusCode = error.userInfo[SSKWebSocketError.kStatusCodeKey];
         if (statusCode.unsignedIntegerValue == 403) {
@@ -856,7 +874,7 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
             }
 
             dispatch_async(dispatch_get_main_queue(), ^{
-                [self sendWebSocketMessageAcknowledgement:message];
+                [self enqueueWebSocketMessageAcknowledgement:message];
                 OWSAssertDebug(backgroundTask);
                 backgroundTask = nil;
             });
@@ -864,6 +882,7 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     } else if ([message.path isEqualToString:@"/api/v1/queue/empty"]) {
         // Queue is drained.
 
+        [self flushPendingAcknowledgements];
         [self sendWebSocketMessageAcknowledgement:message];
 
         if (!self.hasEmptiedInitialQueue) {
@@ -897,6 +916,51 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     }
 }
 
+- (void)enqueueWebSocketMessageAcknowledgement:(WebSocketProtoWebSocketRequestMessage *)request
+{
+    OWSAssertIsOnMainThread();
+
+    [self.pendingAcknowledgements addObject:request];
+
+    if (self.acknowledgementBackgroundTask == nil) {
+        self.acknowledgementBackgroundTask = [OWSBackgroundTask backgroundTaskWithLabelStr:__PRETTY_FUNCTION__];
+    }
+
+    if (self.pendingAcknowledgements.count >= kMaxPendingAcknowledgementCount) {
+        [self flushPendingAcknowledgements];
+        return;
+    }
+
+    if (self.acknowledgementFlushTimer == nil) {
+        self.acknowledgementFlushTimer =
+            [NSTimer weakScheduledTimerWithTimeInterval:kAcknowledgementFlushDelaySeconds
+                                                 target:self
+                                               selector:@selector(flushPendingAcknowledgements)
+                                               userInfo:nil
+                                                repeats:NO];
+    }
+}
+
+- (void)flushPendingAcknowledgements
+{
+    OWSAssertIsOnMainThread();
+
+    [self.acknowledgementFlushTimer invalidate];
+    self.acknowledgementFlushTimer = nil;
+
+    if (self.pendingAcknowledgements.count > 0) {
+        NSArray<WebSocketProtoWebSocketRequestMessage *> *acknowledgements = [self.pendingAcknowledgements copy];
+        [self.pendingAcknowledgements removeAllObjects];
+
+        OWSLogVerbose(@"Flushing %lu acknowledgements.", (unsigned long)acknowledgements.count);
+        for (WebSocketProtoWebSocketRequestMessage *request in acknowledgements) {
+            [self sendWebSocketMessageAcknowledgement:request];
+        }
+    }
+
+    self.acknowledgementBackgroundTask = nil;
+}
+
 - (void)sendWebSocketMessageAcknowledgement:(WebSocketProtoWebSocketRequestMessage *)request
 {
     OWSAssertIsOnMainThread();
@@ -938,12 +1002,31 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     [self.outageDetection reportConnectionFailure];
 }
 
+- (void)scheduleHeartbeat
+{
+    OWSAssertIsOnMainThread();
+
+    [self.heartbeatTimer invalidate];
+    self.heartbeatTimer = [NSTimer timerWithTimeInterval:self.keepAlivePolicy.heartbeatInterval
+                                                  target:self
+                                                selector:@selector(webSocketHeartBeat)
+                                                userInfo:nil
+                                                 repeats:YES];
+
+    // Additionally, we want the ping timer to work in the background too.
+    [[NSRunLoop mainRunLoop] addTimer:self.heartbeatTimer forMode:NSDefaultRunLoopMode];
+}
+
 - (void)webSocketHeartBeat
 {
     OWSAssertIsOnMainThread();
 
     if ([self shouldSocketBeOpen]) {
         [self.websocket writePing];
+
+        if ([self.keepAlivePolicy heartbeatDidSucceed]) {
+            [self scheduleHeartbeat];
+        }
     } else {
         OWSLogWarn(@"webSocketHeartBeat closing web socket");
         [self closeWebSocket];
@@ -1138,17 +1221,26 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     if (self.reconnectTimer) {
         OWSAssertDebug([self.reconnectTimer isValid]);
     } else {
-        // TODO: It'd be nice to do exponential backoff.
-        self.reconnectTimer = [NSTimer timerWithTimeInterval:kSocketReconnectDelaySeconds
+        self.reconnectTimer = [NSTimer timerWithTimeInterval:[self.keepAlivePolicy nextReconnectDelay]
                                                       target:self
-                                                    selector:@selector(applyDesiredSocketState)
+                                                    selector:@selector(reconnectTimerDidFire)
                                                     userInfo:nil
-                                                     repeats:YES];
+                                                     repeats:NO];
         // Additionally, we want the reconnect timer to work in the background too.
         [[NSRunLoop mainRunLoop] addTimer:self.reconnectTimer forMode:NSDefaultRunLoopMode];
     }
 }
 
+- (void)reconnectTimerDidFire
+{
+    OWSAssertIsOnMainThread();
+
+    // If the socket still isn't open, applyDesiredSocketState will
+    // schedule the next attempt with a longer delay.
+    self.reconnectTimer = nil;
+    [self applyDesiredSocketState];
+}
+
 - (void)clearReconnect
 {
     OWSAssertIsOnMainThread();
@@ -1213,6 +1305,17 @@ NSNotificationName const NSNotificationWebSocketStateDidChange = @"NSNotificatio
     [self applyDesiredSocketState];
 }
 
+- (void)reachabilityDidChange:(NSNotification *)notification
+{
+    OWSAssertIsOnMainThread();
+
+    // Failures on the old network say nothing about the new one,
+    // so retry promptly.
+    [self.keepAlivePolicy resetReconnectBackoff];
+    [self clearReconnect];
+    [self applyDesiredSocketState];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,154 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Chooses the websocket's heartbeat interval and reconnect delays.
+//
+// Routers drop idle connections after a NAT timeout that varies between
+// networks, so the heartbeat interval is learned per network type: it is
+// lengthened while the socket survives and shortened when an idle socket
+// drops. Reconnects use "decorrelated jitter" backoff, which retries quickly
+// after isolated failures but spreads out retries on flaky networks.
+//
+// This class should only be accessed on the main thread.
+@objc
+public class SocketKeepAlivePolicy: NSObject {
+
+    static let minHeartbeatInterval: TimeInterval = 10
+    static let defaultHeartbeatInterval: TimeInterval = 30
+    // Stay comfortably below the service's idle timeout.
+    static let maxHeartbeatInterval: TimeInterval = 55
+    static let heartbeatIntervalStep: TimeInterval = 5
+    // Lengthen the interval after this many consecutive heartbeats.
+    static let heartbeatsBeforeLengthening: UInt = 4
+
+    static let minReconnectDelay: TimeInterval = 1
+    static let maxReconnectDelay: TimeInterval = 60
+
+    private struct NetworkState {
+        var heartbeatInterval = SocketKeepAlivePolicy.defaultHeartbeatInterval
+        // The longest interval which hasn't yet failed on this network.
+        var maxHeartbeatInterval = SocketKeepAlivePolicy.maxHeartbeatInterval
+        var successfulHeartbeatCount: UInt = 0
+    }
+
+    private var networkStates = [String: NetworkState]()
+
+    private let networkKeyBlock: () -> String
+
+    private var lastReconnectDelay: TimeInterval?
+    private var reconnectAttemptCount: UInt = 0
+    private var totalReconnectCount: UInt = 0
+    private var openDate: Date?
+
+    @objc
+    public override convenience init() {
+        self.init(networkKeyBlock: {
+            SSKEnvironment.shared.reachabilityManager.isReachable(via: .wifi) ? "wifi" : "cellular"
+        })
+    }
+
+    init(networkKeyBlock: @escaping () -> String) {
+        self.networkKeyBlock = networkKeyBlock
+
+        super.init()
+    }
+
+    private var networkKey: String {
+        networkKeyBlock()
+    }
+
+    // MARK: - Heartbeat
+
+    @objc
+    public var heartbeatInterval: TimeInterval {
+        networkStates[networkKey, default: NetworkState()].heartbeatInterval
+    }
+
+    /// Returns YES if the heartbeat interval changed.
+    @objc
+    public func heartbeatDidSucceed() -> Bool {
+        // The socket has stayed up for a while, so we can stop backing off.
+        resetReconnectBackoff()
+
+        let networkKey = self.networkKey
+        var networkState = networkStates[networkKey, default: NetworkState()]
+        defer { networkStates[networkKey] = networkState }
+
+        networkState.successfulHeartbeatCount += 1
+        guard networkState.successfulHeartbeatCount >= Self.heartbeatsBeforeLengthening,
+              networkState.heartbeatInterval < networkState.maxHeartbeatInterval else {
+            return false
+        }
+        networkState.successfulHeartbeatCount = 0
+        networkState.heartbeatInterval = min(networkState.maxHeartbeatInterval,
+                                             networkState.heartbeatInterval + Self.heartbeatIntervalStep)
+        Logger.info("Lengthening heartbeat interval on \(networkKey): \(networkState.heartbeatInterval)s.")
+        return true
+    }
+
+    // MARK: - Socket Lifecycle
+
+    @objc
+    public func socketDidOpen() {
+        Logger.info("Socket opened after \(reconnectAttemptCount) reconnect attempts (\(totalReconnectCount) total).")
+        openDate = Date()
+    }
+
+    /// Should be called when the socket closes for any reason.
+    ///
+    /// Returns YES if the heartbeat interval changed.
+    @objc(socketDidCloseUnexpectedly:)
+    @discardableResult
+    public func socketDidClose(unexpectedly: Bool) -> Bool {
+        guard let openDate = openDate else {
+            return false
+        }
+        self.openDate = nil
+        let uptime = abs(openDate.timeIntervalSinceNow)
+        Logger.info("Socket closed after uptime: \(String(format: "%.1f", uptime))s, unexpectedly: \(unexpectedly).")
+
+        let networkKey = self.networkKey
+        var networkState = networkStates[networkKey, default: NetworkState()]
+        // Only a socket which outlived a heartbeat interval tells us anything
+        // about the NAT timeout.
+        guard unexpectedly, uptime >= networkState.heartbeatInterval else {
+            return false
+        }
+        defer { networkStates[networkKey] = networkState }
+
+        networkState.successfulHeartbeatCount = 0
+        networkState.maxHeartbeatInterval = max(Self.minHeartbeatInterval,
+                                                networkState.heartbeatInterval - Self.heartbeatIntervalStep)
+        networkState.heartbeatInterval = networkState.maxHeartbeatInterval
+        Logger.info("Shortening heartbeat interval on \(networkKey): \(networkState.heartbeatInterval)s.")
+        return true
+    }
+
+    // MARK: - Reconnect
+
+    /// Returns the delay before the next reconnect attempt.
+    @objc
+    public func nextReconnectDelay() -> TimeInterval {
+        reconnectAttemptCount += 1
+        totalReconnectCount += 1
+
+        let delay: TimeInterval
+        if let lastReconnectDelay = lastReconnectDelay {
+            let upperBound = max(Self.minReconnectDelay, lastReconnectDelay * 3)
+            delay = min(Self.maxReconnectDelay, Double.random(in: Self.minReconnectDelay...upperBound))
+        } else {
+            delay = Self.minReconnectDelay
+        }
+        lastReconnectDelay = delay
+        return delay
+    }
+
+    @objc
+    public func resetReconnectBackoff() {
+        lastReconnectDelay = nil
+        reconnectAttemptCount = 0
+    }
+}
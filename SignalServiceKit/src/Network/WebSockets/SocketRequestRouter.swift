@@ -0,0 +1,147 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+/// Decides whether REST requests to the service are sent over the
+/// authenticated websocket or over HTTPS.
+///
+/// The websocket carries any number of requests at once (responses are
+/// matched by request id), and saves a TLS handshake and the HTTP overhead
+/// for each request. If a websocket request gets no response, the socket
+/// may be stale even though it reports itself open; requests go over HTTPS
+/// for a while rather than each waiting out the socket timeout.
+@objc
+public class SocketRequestRouter: NSObject {
+
+    @objc
+    public static let shared = SocketRequestRouter()
+
+    static let unhealthyInterval: TimeInterval = 30
+
+    private let lock = UnfairLock()
+    // This property should only be accessed while holding the lock.
+    private var lastFailureDate: Date?
+
+    override init() {
+        super.init()
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(socketStateDidChange),
+                                               name: .webSocketStateDidChange,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    @objc
+    private func socketStateDidChange() {
+        // A newly opened socket is presumed healthy.
+        if socketManager.socketState() == .open {
+            websocketRequestDidSucceed()
+        }
+    }
+
+    // MARK: - Dependencies
+
+    private var socketManager: TSSocketManager {
+        return SSKEnvironment.shared.socketManager
+    }
+
+    private var networkManager: TSNetworkManager {
+        return SSKEnvironment.shared.networkManager
+    }
+
+    // MARK: -
+
+    /// Whether `request` can be sent over the websocket.
+    ///
+    /// The websocket is authenticated as the local user, so it can't carry
+    /// UD requests, requests with their own credentials or requests for
+    /// other hosts.
+    @objc
+    public static func isEligibleForWebsocket(_ request: TSRequest) -> Bool {
+        return (!request.isUDRequest &&
+                    request.authUsername == nil &&
+                    request.authPassword == nil &&
+                    request.customHost == nil &&
+                    request.customCensorshipCircumventionPrefix == nil)
+    }
+
+    @objc
+    public var isWebsocketHealthy: Bool {
+        lock.withLock {
+            guard let lastFailureDate = lastFailureDate else {
+                return true
+            }
+            return abs(lastFailureDate.timeIntervalSinceNow) >= Self.unhealthyInterval
+        }
+    }
+
+    @objc
+    public func shouldUseWebsocket(for request: TSRequest) -> Bool {
+        return (Self.isEligibleForWebsocket(request) &&
+                    socketManager.canMakeRequests() &&
+                    isWebsocketHealthy)
+    }
+
+    @objc
+    public func websocketRequestDidSucceed() {
+        lock.withLock {
+            lastFailureDate = nil
+        }
+    }
+
+    /// A status code of zero means the service never responded, e.g. the
+    /// request timed out or the socket closed. Other failures are
+    /// responses from the service, so the socket itself is fine.
+    @objc
+    public func websocketRequestDidFail(statusCode: Int) {
+        guard statusCode <= 0 else {
+            websocketRequestDidSucceed()
+            return
+        }
+        lock.withLock {
+            if lastFailureDate == nil {
+                Logger.warn("Websocket request got no response; preferring REST for \(Self.unhealthyInterval)s.")
+            }
+            lastFailureDate = Date()
+        }
+    }
+
+    // MARK: -
+
+    /// Sends `request` over the websocket if possible, failing over to HTTPS
+    /// if the websocket request gets no response.
+    public func makeRequest(_ request: TSRequest) -> Promise<Any?> {
+        guard shouldUseWebsocket(for: request) else {
+            return networkManager.makePromise(request: request).map { $0.responseObject }
+        }
+
+        return Promise<Any?> { resolver in
+            socketManager.make(request,
+                               success: { (responseObject: Any?) in
+                                self.websocketRequestDidSucceed()
+                                resolver.fulfill(responseObject)
+                               },
+                               failure: { (statusCode: Int, responseData: Data?, error: Error) in
+                                self.websocketRequestDidFail(statusCode: statusCode)
+                                resolver.reject(RequestMakerError.websocketRequestError(statusCode: statusCode,
+                                                                                         responseData: responseData,
+                                                                                         underlyingError: error))
+                               })
+        }.recover(on: .global()) { (error: Error) -> Promise<Any?> in
+            switch error {
+            case RequestMakerError.websocketRequestError(let statusCode, _, _) where statusCode <= 0:
+                Logger.info("Websocket request failed; failing over to REST request: \(error).")
+                return self.networkManager.makePromise(request: request).map { $0.responseObject }
+            default:
+                throw error
+            }
+        }
+    }
+}
@@ -17,3 +17,49 @@ public extension SSKProtoGroupContext {
         return membersE164.map { SignalServiceAddress(phoneNumber: $0) }
     }
 }
+
+// MARK: -
+
+// A Content that holds a single message is encoded as that message's
+// encoding, prefixed by the field's key and length. Messages which are sent
+// on their own are serialized as Content this way, rather than by building
+// a Content wrapper, which validates and copies the whole message again.
+@objc
+public extension SSKProtoContent {
+    private static let dataMessageFieldNumber: UInt32 = 1
+    private static let receiptMessageFieldNumber: UInt32 = 5
+    private static let typingMessageFieldNumber: UInt32 = 6
+
+    // Wire type 2: length-delimited.
+    private static let lengthDelimitedWireType: UInt32 = 2
+
+    static func serializedData(dataMessage: SSKProtoDataMessage) throws -> Data {
+        return serializedData(fieldNumber: dataMessageFieldNumber, messageData: try dataMessage.serializedData())
+    }
+
+    static func serializedData(receiptMessage: SSKProtoReceiptMessage) throws -> Data {
+        return serializedData(fieldNumber: receiptMessageFieldNumber, messageData: try receiptMessage.serializedData())
+    }
+
+    static func serializedData(typingMessage: SSKProtoTypingMessage) throws -> Data {
+        return serializedData(fieldNumber: typingMessageFieldNumber, messageData: try typingMessage.serializedData())
+    }
+
+    private static func serializedData(fieldNumber: UInt32, messageData: Data) -> Data {
+        var result = Data()
+        result.reserveCapacity(messageData.count + 6)
+        appendVarint(UInt64(fieldNumber << 3 | lengthDelimitedWireType), to: &result)
+        appendVarint(UInt64(messageData.count), to: &result)
+        result.append(messageData)
+        return result
+    }
+
+    private static func appendVarint(_ value: UInt64, to data: inout Data) {
+        var value = value
+        while value >= 0x80 {
+            data.append(UInt8(truncatingIfNeeded: value) | 0x80)
+            value >>= 7
+        }
+        data.append(UInt8(value))
+    }
+}
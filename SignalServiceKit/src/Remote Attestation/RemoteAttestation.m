@@ -366,8 +366,8 @@ NSString *NSStringForRemoteAttestationService(RemoteAttestationService value) {
     OWSAssertDebug(quoteData);
 
     NSError *signingError;
-    RemoteAttestationSigningCertificate *_Nullable certificate =
-        [RemoteAttestationSigningCertificate parseCertificateFromPem:certificates error:&signingError];
+    RemoteAttestationSigningCertificate *_Nullable certificate = [self signingCertificateFromPem:certificates
+                                                                                           error:&signingError];
     if (signingError) {
         *error = signingError;
         return NO;
@@ -472,6 +472,42 @@ NSString *NSStringForRemoteAttestationService(RemoteAttestationService value) {
     return YES;
 }
 
+// Every attestation is signed with the same IAS certificate, and evaluating
+// its chain is expensive. The last certificate we verified is reused until
+// it's superseded or kSigningCertificateReuseDuration has elapsed, after
+// which its chain is evaluated again.
+static const NSTimeInterval kSigningCertificateReuseDuration = 1 * kHourInterval;
+
++ (nullable RemoteAttestationSigningCertificate *)signingCertificateFromPem:(NSString *)certificatePem
+                                                                      error:(NSError **)error
+{
+    OWSAssertDebug(certificatePem.length > 0);
+
+    static NSString *_Nullable lastCertificatePem = nil;
+    static RemoteAttestationSigningCertificate *_Nullable lastCertificate = nil;
+    static NSDate *_Nullable lastVerificationDate = nil;
+
+    @synchronized(self) {
+        if (lastCertificate != nil && [lastCertificatePem isEqualToString:certificatePem]
+            && fabs(lastVerificationDate.timeIntervalSinceNow) < kSigningCertificateReuseDuration) {
+            return lastCertificate;
+        }
+    }
+
+    RemoteAttestationSigningCertificate *_Nullable certificate =
+        [RemoteAttestationSigningCertificate parseCertificateFromPem:certificatePem error:error];
+    if (certificate == nil) {
+        return nil;
+    }
+
+    @synchronized(self) {
+        lastCertificatePem = [certificatePem copy];
+        lastCertificate = certificate;
+        lastVerificationDate = [NSDate new];
+    }
+    return certificate;
+}
+
 + (nullable SignatureBodyEntity *)parseSignatureBodyEntity:(NSString *)signatureBody
 {
     OWSAssertDebug(signatureBody.length > 0);
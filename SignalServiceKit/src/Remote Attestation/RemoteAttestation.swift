@@ -55,9 +55,12 @@ extension RemoteAttestation {
         let remoteAttestations: [Id: RemoteAttestation]
     }
 
-    public static func performForCDS() -> Promise<CDSAttestation> {
+    /// - Parameter auth: The CDS auth credentials, if the caller has already fetched them.
+    ///   Callers which perform several attestations can share one set of credentials.
+    public static func performForCDS(auth: RemoteAttestationAuth? = nil) -> Promise<CDSAttestation> {
         return performAttestation(
             for: .contactDiscovery,
+            auth: auth,
             config: EnclaveConfig(
                 enclaveName: TSConstants.contactDiscoveryEnclaveName,
                 mrenclave: TSConstants.contactDiscoveryMrEnclave,
@@ -90,11 +93,45 @@ extension RemoteAttestation {
         }
     }
 
+    static func getAuthForCDS() -> Promise<RemoteAttestationAuth> {
+        return getAuth(for: .contactDiscovery)
+    }
+
     // MARK: -
 
+    // Auth credentials can be used for several attestations, so they're
+    // reused for back-to-back discovery batches and PIN operations rather
+    // than fetched for each. They're discarded after authCacheLifetime, or
+    // as soon as an attestation with them fails.
+    private static let authCacheLifetime: TimeInterval = 5 * kMinuteInterval
+
+    private struct CachedAuth {
+        let auth: RemoteAttestationAuth
+        let fetchDate: Date
+    }
+
+    private static let authCacheLock = UnfairLock()
+    // This property should only be accessed with authCacheLock.
+    private static var authCache = [RemoteAttestationService: CachedAuth]()
+
     private static func getAuth(for service: RemoteAttestationService) -> Promise<RemoteAttestationAuth> {
-        return Promise { resolver in
+        let cachedAuth = authCacheLock.withLock { authCache[service] }
+        if let cachedAuth = cachedAuth, abs(cachedAuth.fetchDate.timeIntervalSinceNow) < authCacheLifetime {
+            return Promise.value(cachedAuth.auth)
+        }
+
+        return Promise<RemoteAttestationAuth> { resolver in
             self.getAuthFor(service, success: resolver.fulfill, failure: resolver.reject)
+        }.map(on: .global()) { auth in
+            authCacheLock.withLock { authCache[service] = CachedAuth(auth: auth, fetchDate: Date()) }
+            return auth
+        }
+    }
+
+    private static func discardCachedAuth(_ auth: RemoteAttestationAuth, for service: RemoteAttestationService) {
+        authCacheLock.withLock {
+            guard authCache[service]?.auth === auth else { return }
+            authCache[service] = nil
         }
     }
 
@@ -147,6 +184,9 @@ extension RemoteAttestation {
                                            cookies: cookies,
                                            enclaveConfig: config,
                                            auth: auth)
+            }.recover(on: .global()) { error -> Promise<AttestationResponse> in
+                discardCachedAuth(auth, for: service)
+                throw error
             }
         }
     }
@@ -63,8 +63,10 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)new NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
 
+// Singletons which aren't needed before the first frame are passed as blocks,
+// and constructed when they are first accessed; see LazySingleton.
 - (instancetype)initWithContactsManager:(id<ContactsManagerProtocol>)contactsManager
-                     linkPreviewManager:(OWSLinkPreviewManager *)linkPreviewManager
+                linkPreviewManagerBlock:(OWSLinkPreviewManager * (^)(void))linkPreviewManagerBlock
                           messageSender:(MessageSender *)messageSender
                   messageSenderJobQueue:(MessageSenderJobQueue *)messageSenderJobQueue
              pendingReadReceiptRecorder:(id<PendingReadReceiptRecorder>)pendingReadReceiptRecorder
@@ -106,8 +108,8 @@ NS_ASSUME_NONNULL_BEGIN
                       messageProcessing:(MessageProcessing *)messageProcessing
                       messageFetcherJob:(MessageFetcherJob *)messageFetcherJob
                        bulkProfileFetch:(BulkProfileFetch *)bulkProfileFetch
-                         bulkUUIDLookup:(BulkUUIDLookup *)bulkUUIDLookup
-                      versionedProfiles:(id<VersionedProfiles>)versionedProfiles
+                    bulkUUIDLookupBlock:(BulkUUIDLookup * (^)(void))bulkUUIDLookupBlock
+                 versionedProfilesBlock:(id<VersionedProfiles> (^)(void))versionedProfilesBlock
                         modelReadCaches:(ModelReadCaches *)modelReadCaches
                     earlyMessageManager:(EarlyMessageManager *)earlyMessageManager
               messagePipelineSupervisor:(OWSMessagePipelineSupervisor *)messagePipelineSupervisor
@@ -17,6 +17,7 @@ static SSKEnvironment *sharedSSKEnvironment;
 @interface SSKEnvironment ()
 
 @property (nonatomic) id<ContactsManagerProtocol> contactsManager;
+@property (nonatomic, readonly) LazySingleton *lazyLinkPreviewManager;
 @property (nonatomic) MessageSender *messageSender;
 @property (nonatomic) id<ProfileManagerProtocol> profileManager;
 @property (nonatomic, nullable) OWSPrimaryStorage *primaryStorage;
@@ -50,8 +51,8 @@ static SSKEnvironment *sharedSSKEnvironment;
 @property (nonatomic) MessageProcessing *messageProcessing;
 @property (nonatomic) MessageFetcherJob *messageFetcherJob;
 @property (nonatomic) BulkProfileFetch *bulkProfileFetch;
-@property (nonatomic) BulkUUIDLookup *bulkUUIDLookup;
-@property (nonatomic) id<VersionedProfiles> versionedProfiles;
+@property (nonatomic, readonly) LazySingleton *lazyBulkUUIDLookup;
+@property (nonatomic, readonly) LazySingleton *lazyVersionedProfiles;
 @property (nonatomic) ModelReadCaches *modelReadCaches;
 @property (nonatomic) EarlyMessageManager *earlyMessageManager;
 @property (nonatomic) OWSMessagePipelineSupervisor *messagePipelineSupervisor;
@@ -68,7 +69,7 @@ static SSKEnvironment *sharedSSKEnvironment;
 @synthesize migrationDBConnection = _migrationDBConnection;
 
 - (instancetype)initWithContactsManager:(id<ContactsManagerProtocol>)contactsManager
-                     linkPreviewManager:(OWSLinkPreviewManager *)linkPreviewManager
+                linkPreviewManagerBlock:(OWSLinkPreviewManager * (^)(void))linkPreviewManagerBlock
                           messageSender:(MessageSender *)messageSender
                   messageSenderJobQueue:(MessageSenderJobQueue *)messageSenderJobQueue
              pendingReadReceiptRecorder:(id<PendingReadReceiptRecorder>)pendingReadReceiptRecorder
@@ -110,8 +111,8 @@ static SSKEnvironment *sharedSSKEnvironment;
                       messageProcessing:(MessageProcessing *)messageProcessing
                       messageFetcherJob:(MessageFetcherJob *)messageFetcherJob
                        bulkProfileFetch:(BulkProfileFetch *)bulkProfileFetch
-                         bulkUUIDLookup:(BulkUUIDLookup *)bulkUUIDLookup
-                      versionedProfiles:(id<VersionedProfiles>)versionedProfiles
+                    bulkUUIDLookupBlock:(BulkUUIDLookup * (^)(void))bulkUUIDLookupBlock
+                 versionedProfilesBlock:(id<VersionedProfiles> (^)(void))versionedProfilesBlock
                         modelReadCaches:(ModelReadCaches *)modelReadCaches
                     earlyMessageManager:(EarlyMessageManager *)earlyMessageManager
               messagePipelineSupervisor:(OWSMessagePipelineSupervisor *)messagePipelineSupervisor
@@ -123,7 +124,7 @@ static SSKEnvironment *sharedSSKEnvironment;
     }
 
     OWSAssertDebug(contactsManager);
-    OWSAssertDebug(linkPreviewManager);
+    OWSAssertDebug(linkPreviewManagerBlock);
     OWSAssertDebug(messageSender);
     OWSAssertDebug(messageSenderJobQueue);
     OWSAssertDebug(pendingReadReceiptRecorder);
@@ -164,14 +165,14 @@ static SSKEnvironment *sharedSSKEnvironment;
     OWSAssertDebug(messageProcessing);
     OWSAssertDebug(messageFetcherJob);
     OWSAssertDebug(bulkProfileFetch);
-    OWSAssertDebug(versionedProfiles);
-    OWSAssertDebug(bulkUUIDLookup);
+    OWSAssertDebug(versionedProfilesBlock);
+    OWSAssertDebug(bulkUUIDLookupBlock);
     OWSAssertDebug(modelReadCaches);
     OWSAssertDebug(earlyMessageManager);
     OWSAssertDebug(appExpiry);
 
     _contactsManager = contactsManager;
-    _linkPreviewManager = linkPreviewManager;
+    _lazyLinkPreviewManager = [[LazySingleton alloc] initWithName:@"linkPreviewManager" block:linkPreviewManagerBlock];
     _messageSender = messageSender;
     _messageSenderJobQueue = messageSenderJobQueue;
     _pendingReadReceiptRecorder = pendingReadReceiptRecorder;
@@ -213,8 +214,8 @@ static SSKEnvironment *sharedSSKEnvironment;
     _messageProcessing = messageProcessing;
     _messageFetcherJob = messageFetcherJob;
     _bulkProfileFetch = bulkProfileFetch;
-    _versionedProfiles = versionedProfiles;
-    _bulkUUIDLookup = bulkUUIDLookup;
+    _lazyVersionedProfiles = [[LazySingleton alloc] initWithName:@"versionedProfiles" block:versionedProfilesBlock];
+    _lazyBulkUUIDLookup = [[LazySingleton alloc] initWithName:@"bulkUUIDLookup" block:bulkUUIDLookupBlock];
     _modelReadCaches = modelReadCaches;
     _earlyMessageManager = earlyMessageManager;
     _messagePipelineSupervisor = messagePipelineSupervisor;
@@ -248,6 +249,23 @@ static SSKEnvironment *sharedSSKEnvironment;
     return sharedSSKEnvironment != nil;
 }
 
+#pragma mark - Lazy Accessors
+
+- (OWSLinkPreviewManager *)linkPreviewManager
+{
+    return (OWSLinkPreviewManager *)[self.lazyLinkPreviewManager get];
+}
+
+- (BulkUUIDLookup *)bulkUUIDLookup
+{
+    return (BulkUUIDLookup *)[self.lazyBulkUUIDLookup get];
+}
+
+- (id<VersionedProfiles>)versionedProfiles
+{
+    return (id<VersionedProfiles>)[self.lazyVersionedProfiles get];
+}
+
 #pragma mark - Mutable Accessors
 
 - (nullable id<OWSCallMessageHandler>)callMessageHandler
@@ -56,10 +56,10 @@ static uint32_t const OWSFingerprintDefaultHashIterations = 5200;
     _hashIterations = hashIterations;
 
     NSData *myStableAddressData = [self stableDataForAddress:_myStableAddress];
-    _myFingerprintData = [self dataForStableAddress:myStableAddressData publicKey:_myIdentityKey];
+    _myFingerprintData = [self cachedDataForStableAddress:myStableAddressData publicKey:_myIdentityKey];
 
     NSData *theirStableAddressData = [self stableDataForAddress:_theirStableAddress];
-    _theirFingerprintData = [self dataForStableAddress:theirStableAddressData publicKey:_theirIdentityKey];
+    _theirFingerprintData = [self cachedDataForStableAddress:theirStableAddressData publicKey:_theirIdentityKey];
 
     return self;
 }
@@ -216,6 +216,48 @@ static uint32_t const OWSFingerprintDefaultHashIterations = 5200;
 }
 
 
+#pragma mark - Cache
+
+// Each half of a fingerprint only depends on one party's stable address and
+// identity key, and is expensive to compute by design. Our own half is the
+// same for every fingerprint, and theirs only changes with their identity
+// key, which is part of the cache key.
++ (AnyShardedLRUCache *)fingerprintDataCache
+{
+    static AnyShardedLRUCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [[AnyShardedLRUCache alloc] initWithMaxSize:256];
+    });
+    return cache;
+}
+
+- (NSData *)cacheKeyForStableAddress:(NSData *)stableAddressData publicKey:(NSData *)publicKey
+{
+    uint32_t hashIterations = (uint32_t)self.hashIterations;
+    uint32_t publicKeyLength = (uint32_t)publicKey.length;
+    NSMutableData *cacheKey = [NSMutableData new];
+    [cacheKey appendBytes:&hashIterations length:sizeof(hashIterations)];
+    [cacheKey appendBytes:&publicKeyLength length:sizeof(publicKeyLength)];
+    [cacheKey appendData:publicKey];
+    [cacheKey appendData:stableAddressData];
+    return [cacheKey copy];
+}
+
+- (NSData *)cachedDataForStableAddress:(NSData *)stableAddressData publicKey:(NSData *)publicKey
+{
+    NSData *cacheKey = [self cacheKeyForStableAddress:stableAddressData publicKey:publicKey];
+    NSData *_Nullable cachedData = (NSData *)[OWSFingerprint.fingerprintDataCache getWithKey:cacheKey];
+    if (cachedData != nil) {
+        return cachedData;
+    }
+    NSData *data = [self dataForStableAddress:stableAddressData publicKey:publicKey];
+    [OWSFingerprint.fingerprintDataCache setWithKey:cacheKey value:data];
+    return data;
+}
+
+#pragma mark -
+
 - (NSData *)dataFromShort:(uint32_t)aShort
 {
     uint8_t bytes[] = {
@@ -248,23 +290,34 @@ static uint32_t const OWSFingerprintDefaultHashIterations = 5200;
     [hash appendData:publicKey];
     [hash appendData:stableAddressData];
 
-    NSMutableData *_Nullable digestData = [[NSMutableData alloc] initWithLength:CC_SHA512_DIGEST_LENGTH];
-    if (!digestData) {
-        @throw [NSException exceptionWithName:NSGenericException reason:@"Couldn't allocate buffer." userInfo:nil];
+    if (self.hashIterations < 1) {
+        return [hash copy];
     }
-    for (int i = 0; i < self.hashIterations; i++) {
-        [hash appendData:publicKey];
 
-        if (hash.length >= UINT32_MAX) {
-            @throw [NSException exceptionWithName:@"Oversize Data" reason:@"Oversize hash." userInfo:nil];
-        }
+    [hash appendData:publicKey];
+    if (hash.length >= UINT32_MAX) {
+        @throw [NSException exceptionWithName:@"Oversize Data" reason:@"Oversize hash." userInfo:nil];
+    }
 
-        CC_SHA512(hash.bytes, (uint32_t)hash.length, digestData.mutableBytes);
-        // TODO get rid of this loop-allocation
-        hash = [digestData mutableCopy];
+    // Every iteration after the first hashes the previous digest followed by
+    // the public key, so we hash in place within a single buffer:
+    // [ digest | publicKey ].
+    NSMutableData *_Nullable buffer =
+        [[NSMutableData alloc] initWithLength:CC_SHA512_DIGEST_LENGTH + publicKey.length];
+    if (!buffer) {
+        @throw [NSException exceptionWithName:NSGenericException reason:@"Couldn't allocate buffer." userInfo:nil];
+    }
+    uint8_t *bufferBytes = buffer.mutableBytes;
+    memcpy(bufferBytes + CC_SHA512_DIGEST_LENGTH, publicKey.bytes, publicKey.length);
+
+    uint8_t digest[CC_SHA512_DIGEST_LENGTH];
+    CC_SHA512(hash.bytes, (uint32_t)hash.length, digest);
+    for (NSUInteger i = 1; i < self.hashIterations; i++) {
+        memcpy(bufferBytes, digest, CC_SHA512_DIGEST_LENGTH);
+        CC_SHA512(bufferBytes, (uint32_t)buffer.length, digest);
     }
 
-    return [hash copy];
+    return [NSData dataWithBytes:digest length:CC_SHA512_DIGEST_LENGTH];
 }
 
 
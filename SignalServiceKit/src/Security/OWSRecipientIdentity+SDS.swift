@@ -340,7 +340,9 @@ public class OWSRecipientIdentityCursor: NSObject {
         guard let record = try cursor.next() else {
             return nil
         }
-        return try OWSRecipientIdentity.fromRecord(record)
+        let value = try OWSRecipientIdentity.fromRecord(record)
+        SSKEnvironment.shared.modelReadCaches.recipientIdentityReadCache.didReadRecipientIdentity(value, transaction: transaction.asAnyRead)
+        return value
     }
 
     public func all() throws -> [OWSRecipientIdentity] {
@@ -383,6 +385,20 @@ public extension OWSRecipientIdentity {
                         transaction: SDSAnyReadTransaction) -> OWSRecipientIdentity? {
         assert(uniqueId.count > 0)
 
+        return anyFetch(uniqueId: uniqueId, transaction: transaction, ignoreCache: false)
+    }
+
+    // Fetches a single model by "unique id".
+    class func anyFetch(uniqueId: String,
+                        transaction: SDSAnyReadTransaction,
+                        ignoreCache: Bool) -> OWSRecipientIdentity? {
+        assert(uniqueId.count > 0)
+
+        if !ignoreCache,
+            let cachedCopy = SSKEnvironment.shared.modelReadCaches.recipientIdentityReadCache.getRecipientIdentity(uniqueId: uniqueId, transaction: transaction) {
+            return cachedCopy
+        }
+
         switch transaction.readTransaction {
         case .yapRead(let ydbTransaction):
             return OWSRecipientIdentity.ydb_fetch(uniqueId: uniqueId, transaction: ydbTransaction)
@@ -599,7 +615,9 @@ public extension OWSRecipientIdentity {
                 return nil
             }
 
-            return try OWSRecipientIdentity.fromRecord(record)
+            let value = try OWSRecipientIdentity.fromRecord(record)
+            SSKEnvironment.shared.modelReadCaches.recipientIdentityReadCache.didReadRecipientIdentity(value, transaction: transaction.asAnyRead)
+            return value
         } catch {
             owsFailDebug("error: \(error)")
             return nil
@@ -97,6 +97,11 @@ NSUInteger const RecipientIdentitySchemaVersion = 1;
     return SDSDatabaseStorage.shared;
 }
 
+- (RecipientIdentityReadCache *)recipientIdentityReadCache
+{
+    return SSKEnvironment.shared.modelReadCaches.recipientIdentityReadCache;
+}
+
 #pragma mark - Table Contents
 
 - (nullable instancetype)initWithCoder:(NSCoder *)coder
@@ -186,6 +191,29 @@ NSUInteger const RecipientIdentitySchemaVersion = 1;
                              }];
 }
 
+#pragma mark -
+
+- (void)anyDidInsertWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidInsertWithTransaction:transaction];
+
+    [self.recipientIdentityReadCache didInsertOrUpdateRecipientIdentity:self transaction:transaction];
+}
+
+- (void)anyDidUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidUpdateWithTransaction:transaction];
+
+    [self.recipientIdentityReadCache didInsertOrUpdateRecipientIdentity:self transaction:transaction];
+}
+
+- (void)anyDidRemoveWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidRemoveWithTransaction:transaction];
+
+    [self.recipientIdentityReadCache didRemoveRecipientIdentity:self transaction:transaction];
+}
+
 #pragma mark - debug
 
 + (void)printAllIdentities
@@ -41,6 +41,7 @@
 #import <SignalServiceKit/OWSSessionResetJobRecord.h>
 #import <SignalServiceKit/OWSSignalService.h>
 #import <SignalServiceKit/OWSSyncMessageRequestResponseMessage.h>
+#import <SignalServiceKit/OWSThreadStackSampler.h>
 #import <SignalServiceKit/OWSUnknownContactBlockOfferMessage.h>
 #import <SignalServiceKit/OWSUnknownProtocolVersionMessage.h>
 #import <SignalServiceKit/OWSUpload.h>
@@ -15,6 +15,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSArray<PreKeyRecord *> *)generatePreKeyRecords;
 - (void)storePreKeyRecords:(NSArray<PreKeyRecord *> *)preKeyRecords NS_SWIFT_NAME(storePreKeyRecords(_:));
+- (void)storePreKeyRecords:(NSArray<PreKeyRecord *> *)preKeyRecords
+               transaction:(SDSAnyWriteTransaction *)transaction
+    NS_SWIFT_NAME(storePreKeyRecords(_:transaction:));
+
+// Generates the key pairs of the next batch of prekeys on a low priority
+// queue, so that generatePreKeyRecords doesn't have to.
+- (void)pregeneratePreKeysIfNecessary;
 
 #if TESTABLE_BUILD
 - (void)removeAll:(SDSAnyWriteTransaction *)transaction;
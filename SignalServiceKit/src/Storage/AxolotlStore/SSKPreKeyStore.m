@@ -46,6 +46,13 @@ NSString *const TSNextPrekeyIdKey = @"TSStorageInternalSettingsNextPreKeyId";
 
 @property (nonatomic, readonly) SDSKeyValueStore *metadataStore;
 
+// These key pairs are only held in memory, and are only given ids and
+// stored once they are used by generatePreKeyRecords.
+//
+// This property should only be accessed while synchronized on it.
+@property (nonatomic, readonly) NSMutableArray<ECKeyPair *> *pregeneratedKeyPairs;
+@property (nonatomic) BOOL isPregeneratingKeyPairs;
+
 @end
 
 #pragma mark - 
@@ -61,6 +68,7 @@ NSString *const TSNextPrekeyIdKey = @"TSStorageInternalSettingsNextPreKeyId";
 
     _keyStore = [[SDSKeyValueStore alloc] initWithCollection:@"TSStorageManagerPreKeyStoreCollection"];
     _metadataStore = [[SDSKeyValueStore alloc] initWithCollection:TSStorageInternalSettingsCollection];
+    _pregeneratedKeyPairs = [NSMutableArray new];
 
     return self;
 }
@@ -78,12 +86,26 @@ NSString *const TSNextPrekeyIdKey = @"TSStorageInternalSettingsNextPreKeyId";
 {
     NSMutableArray *preKeyRecords = [NSMutableArray array];
 
+    NSMutableArray<ECKeyPair *> *keyPairs;
+    @synchronized(self.pregeneratedKeyPairs) {
+        keyPairs = [self.pregeneratedKeyPairs mutableCopy];
+        [self.pregeneratedKeyPairs removeAllObjects];
+    }
+
     @synchronized(self) {
         int preKeyId = (int)[self nextPreKeyId];
 
-        OWSLogInfo(@"building %d new preKeys starting from preKeyId: %d", BATCH_SIZE, preKeyId);
+        OWSLogInfo(@"building %d new preKeys starting from preKeyId: %d, pregenerated: %lu",
+            BATCH_SIZE,
+            preKeyId,
+            (unsigned long)keyPairs.count);
         for (int i = 0; i < BATCH_SIZE; i++) {
-            ECKeyPair *keyPair = [Curve25519 generateKeyPair];
+            ECKeyPair *_Nullable keyPair = keyPairs.lastObject;
+            if (keyPair != nil) {
+                [keyPairs removeLastObject];
+            } else {
+                keyPair = [Curve25519 generateKeyPair];
+            }
             PreKeyRecord *record = [[PreKeyRecord alloc] initWithId:preKeyId
                                                             keyPair:keyPair
                                                           createdAt:[NSDate date]];
@@ -99,17 +121,45 @@ NSString *const TSNextPrekeyIdKey = @"TSStorageInternalSettingsNextPreKeyId";
     return preKeyRecords;
 }
 
+- (void)pregeneratePreKeysIfNecessary
+{
+    NSUInteger keyPairCount;
+    @synchronized(self.pregeneratedKeyPairs) {
+        if (self.isPregeneratingKeyPairs || self.pregeneratedKeyPairs.count >= BATCH_SIZE) {
+            return;
+        }
+        self.isPregeneratingKeyPairs = YES;
+        keyPairCount = BATCH_SIZE - self.pregeneratedKeyPairs.count;
+    }
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
+        NSMutableArray<ECKeyPair *> *keyPairs = [NSMutableArray new];
+        for (NSUInteger i = 0; i < keyPairCount; i++) {
+            [keyPairs addObject:[Curve25519 generateKeyPair]];
+        }
+
+        @synchronized(self.pregeneratedKeyPairs) {
+            [self.pregeneratedKeyPairs addObjectsFromArray:keyPairs];
+            self.isPregeneratingKeyPairs = NO;
+        }
+        OWSLogInfo(@"pregenerated %lu preKeys", (unsigned long)keyPairCount);
+    });
+}
+
 - (void)storePreKeyRecords:(NSArray<PreKeyRecord *> *)preKeyRecords
 {
     DatabaseStorageWrite(self.databaseStorage, ^(SDSAnyWriteTransaction *transaction) {
-        for (PreKeyRecord *record in preKeyRecords) {
-            [self.keyStore setPreKeyRecord:record
-                                    forKey:[SDSKeyValueStore keyWithInt:record.Id]
-                               transaction:transaction];
-        }
+        [self storePreKeyRecords:preKeyRecords transaction:transaction];
     });
 }
 
+- (void)storePreKeyRecords:(NSArray<PreKeyRecord *> *)preKeyRecords transaction:(SDSAnyWriteTransaction *)transaction
+{
+    for (PreKeyRecord *record in preKeyRecords) {
+        [self.keyStore setPreKeyRecord:record forKey:[SDSKeyValueStore keyWithInt:record.Id] transaction:transaction];
+    }
+}
+
 - (nullable PreKeyRecord *)loadPreKey:(int)preKeyId
                       protocolContext:(nullable id<SPKProtocolReadContext>)protocolContext
 {
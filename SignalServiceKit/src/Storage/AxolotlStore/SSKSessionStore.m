@@ -13,6 +13,7 @@ NS_ASSUME_NONNULL_BEGIN
 @interface SSKSessionStore ()
 
 @property (nonatomic, readonly) SDSKeyValueStore *keyValueStore;
+@property (nonatomic, readonly) SessionRecordCache *sessionRecordCache;
 
 @end
 
@@ -28,6 +29,7 @@ NS_ASSUME_NONNULL_BEGIN
     }
 
     _keyValueStore = [[SDSKeyValueStore alloc] initWithCollection:@"TSStorageManagerSessionStoreCollection"];
+    _sessionRecordCache = [[SessionRecordCache alloc] initWithKeyValueStore:_keyValueStore];
 
     return self;
 }
@@ -70,13 +72,9 @@ NS_ASSUME_NONNULL_BEGIN
     OWSAssertDebug(deviceId > 0);
     OWSAssertDebug([transaction isKindOfClass:[SDSAnyReadTransaction class]]);
 
-    NSDictionary *_Nullable dictionary = [self.keyValueStore getObjectForKey:accountId transaction:transaction];
-
-    SessionRecord *record;
-
-    if (dictionary) {
-        record = [dictionary objectForKey:@(deviceId)];
-    }
+    SessionRecord *_Nullable record = [self.sessionRecordCache loadSessionRecordWithAccountId:accountId
+                                                                                     deviceId:deviceId
+                                                                                  transaction:transaction];
 
     if (record == nil) {
         return [SessionRecord new];
@@ -115,9 +113,7 @@ NS_ASSUME_NONNULL_BEGIN
     // If we are going to start using it I'd want to re-verify it works as intended.
     OWSFailDebug(@"subDevicesSessions is deprecated");
 
-    NSDictionary *_Nullable dictionary = [self.keyValueStore getObjectForKey:accountId transaction:transaction];
-
-    return dictionary ? dictionary.allKeys : @[];
+    return [self.sessionRecordCache sessionRecordsWithAccountId:accountId transaction:transaction].allKeys;
 }
 #pragma clang diagnostic pop
 
@@ -161,14 +157,7 @@ NS_ASSUME_NONNULL_BEGIN
     // NOTE: this may no longer be necessary now that we have a non-caching session db connection.
     [session markAsUnFresh];
 
-    NSDictionary *immutableDictionary = [self.keyValueStore getObjectForKey:accountId transaction:transaction];
-
-    NSMutableDictionary *dictionary
-        = (immutableDictionary ? [immutableDictionary mutableCopy] : [NSMutableDictionary new]);
-
-    [dictionary setObject:session forKey:@(deviceId)];
-
-    [self.keyValueStore setObject:[dictionary copy] key:accountId transaction:transaction];
+    [self.sessionRecordCache storeSessionRecord:session accountId:accountId deviceId:deviceId transaction:transaction];
 }
 
 - (BOOL)containsSession:(NSString *)contactIdentifier
@@ -201,8 +190,10 @@ NS_ASSUME_NONNULL_BEGIN
     OWSAssertDebug(accountId.length > 0);
     OWSAssertDebug(deviceId >= 0);
 
-    return
-        [self loadSessionForAccountId:accountId deviceId:deviceId transaction:transaction].sessionState.hasSenderChain;
+    // Don't load the session, which would lend it to us; we only read it.
+    SessionRecord *_Nullable record =
+        [self.sessionRecordCache sessionRecordsWithAccountId:accountId transaction:transaction][@(deviceId)];
+    return record.sessionState.hasSenderChain;
 }
 
 - (nullable NSNumber *)maxSessionSenderChainKeyIndexForAccountId:(NSString *)accountId
@@ -212,14 +203,9 @@ NS_ASSUME_NONNULL_BEGIN
     OWSAssertDebug([transaction isKindOfClass:[SDSAnyReadTransaction class]]);
 
     NSNumber *_Nullable result = nil;
-    NSDictionary *_Nullable dictionary = [self.keyValueStore getObjectForKey:accountId transaction:transaction];
-    for (id value in dictionary.allValues) {
-        if (![value isKindOfClass:[SessionRecord class]]) {
-            OWSLogVerbose(@"Unexpected value: %@", value);
-            OWSFailDebug(@"Unexpected value.");
-            continue;
-        }
-        SessionRecord *record = (SessionRecord *)value;
+    NSDictionary<NSNumber *, SessionRecord *> *records =
+        [self.sessionRecordCache sessionRecordsWithAccountId:accountId transaction:transaction];
+    for (SessionRecord *record in records.allValues) {
         if (SSKDebugFlags.verboseSignalRecipientLogging) {
             OWSLogInfo(@"Record hasSenderChain: %d.", record.sessionState.hasSenderChain);
         }
@@ -272,14 +258,7 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSLogInfo(@"deleting session for accountId: %@ device: %d", accountId, deviceId);
 
-    NSDictionary *immutableDictionary = [self.keyValueStore getObjectForKey:accountId transaction:transaction];
-
-    NSMutableDictionary *dictionary
-        = (immutableDictionary ? [immutableDictionary mutableCopy] : [NSMutableDictionary new]);
-
-    [dictionary removeObjectForKey:@(deviceId)];
-
-    [self.keyValueStore setObject:[dictionary copy] key:accountId transaction:transaction];
+    [self.sessionRecordCache removeSessionRecordWithAccountId:accountId deviceId:deviceId transaction:transaction];
 }
 
 - (void)deleteAllSessionsForContact:(NSString *)contactIdentifier
@@ -307,7 +286,7 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSLogInfo(@"deleting all sessions for contact: %@", accountId);
 
-    [self.keyValueStore removeValueForKey:accountId transaction:transaction];
+    [self.sessionRecordCache removeAllSessionRecordsWithAccountId:accountId transaction:transaction];
 }
 
 - (void)archiveSessionForAddress:(SignalServiceAddress *)address
@@ -361,21 +340,19 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSLogInfo(@"archiving all sessions for contact: %@", accountId);
 
-    __block NSDictionary<NSNumber *, SessionRecord *> *sessionRecords =
-        [self.keyValueStore getObjectForKey:accountId transaction:transaction];
+    NSArray<NSNumber *> *deviceIds =
+        [self.sessionRecordCache sessionRecordsWithAccountId:accountId transaction:transaction].allKeys;
 
-    for (id deviceId in sessionRecords) {
-        id object = sessionRecords[deviceId];
-        if (![object isKindOfClass:[SessionRecord class]]) {
-            OWSFailDebug(@"Unexpected object in session dict: %@", [object class]);
-            continue;
-        }
-
-        SessionRecord *sessionRecord = (SessionRecord *)object;
+    for (NSNumber *deviceId in deviceIds) {
+        SessionRecord *sessionRecord = [self loadSessionForAccountId:accountId
+                                                            deviceId:deviceId.intValue
+                                                         transaction:transaction];
         [sessionRecord archiveCurrentState];
+        [self storeSessionForAccountId:accountId
+                              deviceId:deviceId.intValue
+                               session:sessionRecord
+                           transaction:transaction];
     }
-
-    [self.keyValueStore setObject:sessionRecords key:accountId transaction:transaction];
 }
 
 #pragma mark - debug
@@ -386,7 +363,7 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSLogWarn(@"resetting session store");
 
-    [self.keyValueStore removeAllWithTransaction:transaction];
+    [self.sessionRecordCache removeAllSessionRecordsWithTransaction:transaction];
 }
 
 - (void)printAllSessionsWithTransaction:(SDSAnyReadTransaction *)transaction
@@ -0,0 +1,250 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import AxolotlKit
+
+// Within a write transaction, SSKSessionStore reads and writes sessions
+// through this cache. Each recipient's session records are then
+// deserialized once and archived once per transaction, not once per load
+// and store. This matters when encrypting a group message for hundreds of
+// devices, or decrypting a batch of envelopes.
+//
+// Dirty sessions are written back when the transaction is finalized.
+// Nothing is cached across transactions. Another process may write
+// sessions between our transactions, and a transaction that fails to
+// commit must leave nothing behind.
+//
+// libsignal modifies the records it loads in place, and doesn't store
+// them if it then fails, e.g. to decrypt. So a loaded record is "lent" to
+// its caller. Until the caller stores it, the record's latest value is
+// the one in the database, which is read again if it's needed.
+@objc
+public class SessionRecordCache: NSObject {
+
+    // If a transaction touches the sessions of more recipients than this,
+    // they are written back early.
+    public static let maxEntryCount = 256
+
+    private static let transactionFinalizationKey = "SessionRecordCache"
+
+    private class Entry {
+        // The latest value of each of the recipient's sessions.
+        var records: [Int32: SessionRecord]
+        // Sessions that have been loaded and not stored since. They are
+        // never dirty: their latest value is the one in the database.
+        var lentDeviceIds = Set<Int32>()
+        // Sessions that have been stored or removed and not yet written back.
+        var dirtyDeviceIds = Set<Int32>()
+
+        init(records: [Int32: SessionRecord]) {
+            self.records = records
+        }
+    }
+
+    private let keyValueStore: SDSKeyValueStore
+
+    // These properties should only be accessed within write transactions,
+    // which are serialized.
+    private weak var currentTransaction: GRDBWriteTransaction?
+    private var entries = [String: Entry]()
+
+    @objc
+    public init(keyValueStore: SDSKeyValueStore) {
+        self.keyValueStore = keyValueStore
+    }
+
+    // MARK: -
+
+    // The caller may modify the returned record, but must store it for the
+    // changes to take effect.
+    @objc
+    public func loadSessionRecord(accountId: String,
+                                  deviceId: Int32,
+                                  transaction: SDSAnyReadTransaction) -> SessionRecord? {
+        guard let writeTransaction = cacheableTransaction(transaction) else {
+            return readRecords(accountId: accountId, transaction: transaction)[deviceId]
+        }
+        let entry = self.entry(accountId: accountId, transaction: writeTransaction)
+        if entry.lentDeviceIds.contains(deviceId) {
+            recoverLentRecords(entry: entry, accountId: accountId, transaction: writeTransaction)
+        }
+        guard let record = entry.records[deviceId] else {
+            return nil
+        }
+        if entry.dirtyDeviceIds.contains(deviceId) {
+            // Once lent, the stored value can't be told apart from changes
+            // the caller doesn't store.
+            writeBack(entry: entry, accountId: accountId, transaction: writeTransaction)
+        }
+        entry.lentDeviceIds.insert(deviceId)
+        return record
+    }
+
+    // The caller must not modify the returned records.
+    @objc
+    public func sessionRecords(accountId: String,
+                               transaction: SDSAnyReadTransaction) -> [NSNumber: SessionRecord] {
+        var result = [NSNumber: SessionRecord]()
+        let records: [Int32: SessionRecord]
+        if let writeTransaction = cacheableTransaction(transaction) {
+            let entry = self.entry(accountId: accountId, transaction: writeTransaction)
+            recoverLentRecords(entry: entry, accountId: accountId, transaction: writeTransaction)
+            records = entry.records
+        } else {
+            records = readRecords(accountId: accountId, transaction: transaction)
+        }
+        for (deviceId, record) in records {
+            result[NSNumber(value: deviceId)] = record
+        }
+        return result
+    }
+
+    @objc
+    public func storeSessionRecord(_ record: SessionRecord,
+                                   accountId: String,
+                                   deviceId: Int32,
+                                   transaction: SDSAnyWriteTransaction) {
+        guard let writeTransaction = cacheableTransaction(transaction) else {
+            var records = readRecords(accountId: accountId, transaction: transaction)
+            records[deviceId] = record
+            writeRecords(records, accountId: accountId, transaction: transaction)
+            return
+        }
+        let entry = self.entry(accountId: accountId, transaction: writeTransaction)
+        entry.records[deviceId] = record
+        entry.lentDeviceIds.remove(deviceId)
+        entry.dirtyDeviceIds.insert(deviceId)
+    }
+
+    @objc
+    public func removeSessionRecord(accountId: String,
+                                    deviceId: Int32,
+                                    transaction: SDSAnyWriteTransaction) {
+        guard let writeTransaction = cacheableTransaction(transaction) else {
+            var records = readRecords(accountId: accountId, transaction: transaction)
+            records[deviceId] = nil
+            writeRecords(records, accountId: accountId, transaction: transaction)
+            return
+        }
+        let entry = self.entry(accountId: accountId, transaction: writeTransaction)
+        entry.records[deviceId] = nil
+        entry.lentDeviceIds.remove(deviceId)
+        entry.dirtyDeviceIds.insert(deviceId)
+    }
+
+    @objc
+    public func removeAllSessionRecords(accountId: String, transaction: SDSAnyWriteTransaction) {
+        if cacheableTransaction(transaction) != nil {
+            entries[accountId] = nil
+        }
+        keyValueStore.removeValue(forKey: accountId, transaction: transaction)
+    }
+
+    @objc
+    public func removeAllSessionRecords(transaction: SDSAnyWriteTransaction) {
+        if cacheableTransaction(transaction) != nil {
+            entries.removeAll()
+        }
+        keyValueStore.removeAll(transaction: transaction)
+    }
+
+    // MARK: -
+
+    // Returns nil if sessions should be read and written directly.
+    private func cacheableTransaction(_ transaction: SDSAnyReadTransaction) -> SDSAnyWriteTransaction? {
+        guard let transaction = transaction as? SDSAnyWriteTransaction,
+              case .grdbWrite(let grdbWrite) = transaction.writeTransaction else {
+            return nil
+        }
+        guard currentTransaction !== grdbWrite else {
+            return transaction
+        }
+
+        // Any entries belong to a transaction that was never finalized.
+        owsAssertDebug(entries.isEmpty)
+        entries.removeAll()
+
+        currentTransaction = grdbWrite
+        transaction.addTransactionFinalizationBlock(forKey: Self.transactionFinalizationKey) { [weak self] transaction in
+            self?.writeBackAll(transaction: transaction)
+        }
+        // If the transaction is already being finalized, the block above
+        // has already run.
+        guard currentTransaction === grdbWrite else {
+            return nil
+        }
+        return transaction
+    }
+
+    private func entry(accountId: String, transaction: SDSAnyWriteTransaction) -> Entry {
+        if let entry = entries[accountId] {
+            return entry
+        }
+        if entries.count >= Self.maxEntryCount {
+            Logger.info("Writing back sessions early.")
+            for (accountId, entry) in entries {
+                writeBack(entry: entry, accountId: accountId, transaction: transaction)
+            }
+            entries.removeAll()
+        }
+        let entry = Entry(records: readRecords(accountId: accountId, transaction: transaction))
+        entries[accountId] = entry
+        return entry
+    }
+
+    private func recoverLentRecords(entry: Entry, accountId: String, transaction: SDSAnyWriteTransaction) {
+        guard !entry.lentDeviceIds.isEmpty else {
+            return
+        }
+        let persistedRecords = readRecords(accountId: accountId, transaction: transaction)
+        for deviceId in entry.lentDeviceIds {
+            entry.records[deviceId] = persistedRecords[deviceId]
+        }
+        entry.lentDeviceIds.removeAll()
+    }
+
+    private func writeBack(entry: Entry, accountId: String, transaction: SDSAnyWriteTransaction) {
+        guard !entry.dirtyDeviceIds.isEmpty else {
+            return
+        }
+        recoverLentRecords(entry: entry, accountId: accountId, transaction: transaction)
+        writeRecords(entry.records, accountId: accountId, transaction: transaction)
+        entry.dirtyDeviceIds.removeAll()
+    }
+
+    private func writeBackAll(transaction: SDSAnyWriteTransaction) {
+        for (accountId, entry) in entries {
+            writeBack(entry: entry, accountId: accountId, transaction: transaction)
+        }
+        entries.removeAll()
+        currentTransaction = nil
+    }
+
+    // MARK: -
+
+    private func readRecords(accountId: String, transaction: SDSAnyReadTransaction) -> [Int32: SessionRecord] {
+        guard let dictionary = keyValueStore.getObject(forKey: accountId, transaction: transaction) as? NSDictionary else {
+            return [:]
+        }
+        var records = [Int32: SessionRecord]()
+        for (key, value) in dictionary {
+            guard let deviceId = key as? NSNumber,
+                  let record = value as? SessionRecord else {
+                owsFailDebug("Unexpected session: \(type(of: key)), \(type(of: value)).")
+                continue
+            }
+            records[deviceId.int32Value] = record
+        }
+        return records
+    }
+
+    private func writeRecords(_ records: [Int32: SessionRecord], accountId: String, transaction: SDSAnyWriteTransaction) {
+        let dictionary = NSMutableDictionary()
+        for (deviceId, record) in records {
+            dictionary[NSNumber(value: deviceId)] = record
+        }
+        keyValueStore.setObject(dictionary.copy(), key: accountId, transaction: transaction)
+    }
+}
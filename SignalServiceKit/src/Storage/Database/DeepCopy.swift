@@ -240,8 +240,12 @@ extension OWSAES256Key: DeepCopyable {
 @objc
 extension TSGroupModel: DeepCopyable {
     public func deepCopy() throws -> AnyObject {
-        // This class can use shallow copies.
-        return try DeepCopies.shallowCopy(self)
+        // Group models are immutable once initialized; group updates
+        // replace the thread's model rather than mutating it. Copies
+        // of a group thread can therefore share its model, which
+        // avoids a costly copy of the membership whenever a thread
+        // is read from the cache.
+        return self
     }
 }
 
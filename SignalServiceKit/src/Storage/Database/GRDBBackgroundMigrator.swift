@@ -0,0 +1,143 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+// Runs data migrations which needn't block launch.
+//
+// The migrations registered with GRDBSchemaMigrator's incremental migrator
+// each run in a single transaction before the app becomes ready. That's
+// necessary for schema migrations and for data migrations the rest of the
+// app relies upon, but a migration which revisits every row of a large
+// table (e.g. to populate an index) can delay launch by seconds after an
+// update.
+//
+// Background migrations instead migrate a chunk at a time, each chunk in
+// its own write transaction so that the app's own writes can interleave
+// with them. Each chunk returns a checkpoint, e.g. the last row id it
+// migrated, which is persisted in the same transaction; a migration which
+// is interrupted (e.g. because the app was suspended) resumes from its
+// last checkpoint on the next launch.
+//
+// Background migrations run serially, in the order they were registered,
+// at utility priority once the app has become ready and is idle. They only
+// run in the main app; extensions don't have the time or memory to spare.
+//
+// Because the rest of the app may read and write the data being migrated
+// while a background migration is in progress, background migrations must
+// tolerate rows that are already migrated, e.g. rows inserted since launch.
+class GRDBBackgroundMigrator: NSObject {
+
+    // MARK: - Dependencies
+
+    private var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    // MARK: -
+
+    typealias Checkpoint = Int
+
+    // Migrates the chunk after the checkpoint, or the first chunk if the
+    // checkpoint is nil. Returns the checkpoint to resume from, or nil if
+    // the migration is complete.
+    typealias MigrateChunkBlock = (_ checkpoint: Checkpoint?, _ transaction: GRDBWriteTransaction) -> Checkpoint?
+
+    private struct Migration {
+        let identifier: String
+        let migrateChunk: MigrateChunkBlock
+    }
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "GRDBBackgroundMigrator")
+
+    private static func checkpointKey(identifier: String) -> String {
+        return "\(identifier).checkpoint"
+    }
+
+    private let serialQueue = DispatchQueue(label: "org.signal.grdbBackgroundMigrator", qos: .utility)
+
+    // This property should only be mutated before the migrator is run.
+    private var migrations = [Migration]()
+
+    func registerMigration(_ identifier: String, migrateChunk: @escaping MigrateChunkBlock) {
+        owsAssertDebug(!migrations.contains { $0.identifier == identifier })
+
+        migrations.append(Migration(identifier: identifier, migrateChunk: migrateChunk))
+    }
+
+    // MARK: -
+
+    func isComplete(identifier: String, transaction: GRDBReadTransaction) -> Bool {
+        return Self.keyValueStore.getBool(identifier, defaultValue: false, transaction: transaction.asAnyRead)
+    }
+
+    // New databases have nothing for the background migrations to migrate.
+    func markAllMigrationsAsComplete(transaction: GRDBWriteTransaction) {
+        for migration in migrations {
+            markAsComplete(identifier: migration.identifier, transaction: transaction)
+        }
+    }
+
+    private func markAsComplete(identifier: String, transaction: GRDBWriteTransaction) {
+        Self.keyValueStore.setBool(true, key: identifier, transaction: transaction.asAnyWrite)
+        Self.keyValueStore.removeValue(forKey: Self.checkpointKey(identifier: identifier), transaction: transaction.asAnyWrite)
+    }
+
+    // MARK: - Running
+
+    func runOutstandingMigrations(completion: (() -> Void)? = nil) {
+        var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+        serialQueue.async {
+            self.runOutstandingMigrationsSync()
+
+            owsAssertDebug(backgroundTask != nil)
+            backgroundTask = nil
+
+            completion?()
+        }
+    }
+
+    func runOutstandingMigrationsSync() {
+        for migration in migrations {
+            run(migration: migration)
+        }
+    }
+
+    private func run(migration: Migration) {
+        let identifier = migration.identifier
+        var chunkCount = 0
+        let startDate = Date()
+
+        while true {
+            let isComplete: Bool = databaseStorage.write { transaction in
+                let transaction = transaction.unwrapGrdbWrite
+                guard !self.isComplete(identifier: identifier, transaction: transaction) else {
+                    return true
+                }
+                let checkpointKey = Self.checkpointKey(identifier: identifier)
+                let checkpoint = Self.keyValueStore.getInt(checkpointKey, transaction: transaction.asAnyRead)
+                if chunkCount == 0 {
+                    Logger.info("Running background migration: \(identifier), checkpoint: \(checkpoint.map { "\($0)" } ?? "none")")
+                }
+                chunkCount += 1
+
+                guard let nextCheckpoint = migration.migrateChunk(checkpoint, transaction) else {
+                    self.markAsComplete(identifier: identifier, transaction: transaction)
+                    return true
+                }
+                owsAssertDebug(checkpoint.map { nextCheckpoint > $0 } ?? true)
+                Self.keyValueStore.setInt(nextCheckpoint, key: checkpointKey, transaction: transaction.asAnyWrite)
+                return false
+            }
+            guard !isComplete else {
+                break
+            }
+        }
+
+        if chunkCount > 0 {
+            Logger.info("Completed background migration: \(identifier), chunks: \(chunkCount), duration: \(abs(startDate.timeIntervalSinceNow))s")
+        }
+    }
+}
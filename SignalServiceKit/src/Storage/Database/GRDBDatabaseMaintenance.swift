@@ -0,0 +1,291 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+// Keeps the database compact on heavy-use devices.
+//
+// At most once a day, while the device is charging and the database
+// has been idle for a while, this:
+//
+// * Truncates the WAL, which otherwise slows every read and inflates backups.
+// * Returns free pages to the file system with incremental vacuums.
+// * Refreshes the statistics the query planner uses.
+//
+// Incremental vacuums only work if the database uses incremental
+// auto-vacuum. New databases do; existing databases are converted with a
+// one-time full vacuum once enough of their pages are free to be worth it.
+//
+// All of this work uses the checkpointing queue, whose busy handler gives
+// up quickly, so maintenance yields to the app's own writes rather than
+// blocking them. Work that is interrupted is simply retried later.
+class GRDBDatabaseMaintenance: NSObject {
+
+    // MARK: - Dependencies
+
+    private var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    // MARK: -
+
+    struct Report {
+        let databaseFileSize: UInt64
+        let walFileSize: UInt64
+        let pageCount: Int
+        let freePageCount: Int
+
+        var description: String {
+            let formattedDatabaseFileSize = ByteCountFormatter.string(fromByteCount: Int64(databaseFileSize), countStyle: .file)
+            let formattedWALFileSize = ByteCountFormatter.string(fromByteCount: Int64(walFileSize), countStyle: .file)
+            return "database: \(formattedDatabaseFileSize), WAL: \(formattedWALFileSize), pages: \(pageCount), free pages: \(freePageCount)"
+        }
+    }
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "GRDBDatabaseMaintenance")
+    private static let lastMaintenanceDateKey = "lastMaintenanceDate"
+
+    private static let maintenanceInterval: TimeInterval = kDayInterval
+    // How long the database must go without commits before we consider it idle.
+    private static let idleInterval: TimeInterval = 60
+    // How many pages each incremental vacuum frees. Each step is a separate
+    // write, so that the app's own writes can interleave with them.
+    private static let incrementalVacuumPageCount = 1024
+    // The fraction of pages which must be free before we convert a database
+    // to incremental auto-vacuum.
+    private static let conversionFreePageFraction = 0.1
+
+    private let checkpointingQueue: DatabaseQueue
+    private weak var storageAdapter: GRDBDatabaseStorageAdapter?
+
+    private let serialQueue = DispatchQueue(label: "GRDBDatabaseMaintenance")
+
+    // These properties should only be accessed on serialQueue.
+    private var isCharging = false
+    private var isIdleCheckScheduled = false
+    private var isRunning = false
+
+    init(checkpointingQueue: DatabaseQueue, storageAdapter: GRDBDatabaseStorageAdapter) {
+        self.checkpointingQueue = checkpointingQueue
+        self.storageAdapter = storageAdapter
+
+        super.init()
+
+        guard !CurrentAppContext().isRunningTests else {
+            return
+        }
+
+        AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+            self.start()
+        }
+    }
+
+    private func start() {
+        AssertIsOnMainThread()
+
+        UIDevice.current.isBatteryMonitoringEnabled = true
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(conditionsMayHaveChanged),
+                                               name: UIDevice.batteryStateDidChangeNotification,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(conditionsMayHaveChanged),
+                                               name: .OWSApplicationDidBecomeActive,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(conditionsMayHaveChanged),
+                                               name: .OWSApplicationDidEnterBackground,
+                                               object: nil)
+
+        conditionsMayHaveChanged()
+    }
+
+    @objc
+    private func conditionsMayHaveChanged() {
+        AssertIsOnMainThread()
+
+        let batteryState = UIDevice.current.batteryState
+        let isCharging = batteryState == .charging || batteryState == .full
+        serialQueue.async {
+            self.isCharging = isCharging
+            self.scheduleIdleCheckIfNecessary()
+        }
+    }
+
+    // MARK: - Scheduling
+
+    private func scheduleIdleCheckIfNecessary() {
+        assertOnQueue(serialQueue)
+
+        guard isCharging, !isIdleCheckScheduled, !isRunning, isMaintenanceDue else {
+            return
+        }
+        guard let dataVersion = self.dataVersion() else {
+            return
+        }
+        isIdleCheckScheduled = true
+        serialQueue.asyncAfter(deadline: .now() + Self.idleInterval) { [weak self] in
+            self?.checkIdle(previousDataVersion: dataVersion)
+        }
+    }
+
+    private func checkIdle(previousDataVersion: Int) {
+        assertOnQueue(serialQueue)
+
+        isIdleCheckScheduled = false
+
+        guard isCharging, isMaintenanceDue else {
+            return
+        }
+        guard let dataVersion = self.dataVersion() else {
+            return
+        }
+        guard dataVersion == previousDataVersion else {
+            // There have been commits since the last check.
+            scheduleIdleCheckIfNecessary()
+            return
+        }
+
+        isRunning = true
+        var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+        DispatchQueue.global(qos: .utility).async {
+            self.runMaintenance()
+
+            self.serialQueue.async {
+                self.isRunning = false
+                owsAssertDebug(backgroundTask != nil)
+                backgroundTask = nil
+            }
+        }
+    }
+
+    private var isMaintenanceDue: Bool {
+        let lastMaintenanceDate = databaseStorage.read { transaction in
+            Self.keyValueStore.getDate(Self.lastMaintenanceDateKey, transaction: transaction)
+        }
+        guard let date = lastMaintenanceDate else {
+            return true
+        }
+        return abs(date.timeIntervalSinceNow) >= Self.maintenanceInterval
+    }
+
+    // The data version changes whenever another connection commits.
+    private func dataVersion() -> Int? {
+        do {
+            return try checkpointingQueue.inDatabase { db in
+                try Int.fetchOne(db, sql: "PRAGMA data_version")
+            }
+        } catch {
+            Logger.warn("Could not read data version: \(error.grdbErrorForLogging)")
+            return nil
+        }
+    }
+
+    // MARK: - Maintenance
+
+    @discardableResult
+    func runMaintenance() -> (before: Report, after: Report)? {
+        do {
+            let before = try report()
+            Logger.info("Before maintenance: \(before.description)")
+
+            try Bench(title: "Database maintenance", logInProduction: true) {
+                try truncateWAL()
+                try vacuum(report: before)
+                try optimize()
+                try truncateWAL()
+            }
+
+            let after = try report()
+            Logger.info("After maintenance: \(after.description)")
+
+            databaseStorage.write { transaction in
+                Self.keyValueStore.setDate(Date(), key: Self.lastMaintenanceDateKey, transaction: transaction)
+            }
+
+            return (before: before, after: after)
+        } catch {
+            // The most likely failure is that the database was busy;
+            // we'll try again the next time conditions allow.
+            Logger.warn("Maintenance failed: \(error.grdbErrorForLogging)")
+            return nil
+        }
+    }
+
+    private func report() throws -> Report {
+        let (pageCount, freePageCount) = try checkpointingQueue.inDatabase { db -> (Int, Int) in
+            let pageCount = try Int.fetchOne(db, sql: "PRAGMA page_count") ?? 0
+            let freePageCount = try Int.fetchOne(db, sql: "PRAGMA freelist_count") ?? 0
+            return (pageCount, freePageCount)
+        }
+        return Report(databaseFileSize: storageAdapter?.databaseFileSize ?? 0,
+                      walFileSize: storageAdapter?.databaseWALFileSize ?? 0,
+                      pageCount: pageCount,
+                      freePageCount: freePageCount)
+    }
+
+    private func truncateWAL() throws {
+        let result = try GRDBDatabaseStorageAdapter.checkpoint(checkpointingQueue: checkpointingQueue,
+                                                               mode: .truncate)
+        Logger.info("walSizePages: \(result.walSizePages), pagesCheckpointed: \(result.pagesCheckpointed)")
+    }
+
+    private enum AutoVacuumMode: Int {
+        case none = 0
+        case full = 1
+        case incremental = 2
+    }
+
+    private func vacuum(report: Report) throws {
+        let autoVacuumMode = try checkpointingQueue.inDatabase { db in
+            AutoVacuumMode(rawValue: try Int.fetchOne(db, sql: "PRAGMA auto_vacuum") ?? 0) ?? .none
+        }
+
+        switch autoVacuumMode {
+        case .incremental:
+            break
+        case .full:
+            // Free pages are already released on every commit.
+            return
+        case .none:
+            guard report.pageCount > 0,
+                Double(report.freePageCount) / Double(report.pageCount) >= Self.conversionFreePageFraction else {
+                return
+            }
+            // Changing the auto-vacuum mode only takes effect after a full vacuum,
+            // which also releases every free page.
+            Logger.info("Converting to incremental auto-vacuum.")
+            try Bench(title: "Full vacuum", logInProduction: true) {
+                try checkpointingQueue.inDatabase { db in
+                    try db.execute(sql: "PRAGMA auto_vacuum = INCREMENTAL")
+                    try db.execute(sql: "VACUUM")
+                }
+            }
+            return
+        }
+
+        while true {
+            let freePageCount = try checkpointingQueue.inDatabase { db -> Int in
+                try db.execute(sql: "PRAGMA incremental_vacuum(\(Self.incrementalVacuumPageCount))")
+                return try Int.fetchOne(db, sql: "PRAGMA freelist_count") ?? 0
+            }
+            guard freePageCount > 0 else {
+                break
+            }
+            guard serialQueue.sync(execute: { isCharging }) else {
+                Logger.info("Stopping incremental vacuum; no longer charging.")
+                break
+            }
+        }
+    }
+
+    private func optimize() throws {
+        // Analyzes any tables whose statistics would benefit the query planner.
+        try checkpointingQueue.inDatabase { db in
+            try db.execute(sql: "PRAGMA optimize")
+        }
+    }
+}
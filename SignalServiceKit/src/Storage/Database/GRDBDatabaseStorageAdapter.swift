@@ -139,9 +139,25 @@ public class GRDBDatabaseStorageAdapter: NSObject {
         self.uiDatabaseObserver = nil
     }
 
+    private var maintenance: GRDBDatabaseMaintenance?
+
     func setup() throws {
         GRDBMediaGalleryFinder.setup(storage: self)
         try setupUIDatabase()
+
+        // Like checkpointing, maintenance is only done by the main app.
+        if let checkpointingQueue = storage.checkpointingQueue {
+            maintenance = GRDBDatabaseMaintenance(checkpointingQueue: checkpointingQueue, storageAdapter: self)
+        }
+    }
+
+    func testing_runMaintenance() -> (before: GRDBDatabaseMaintenance.Report, after: GRDBDatabaseMaintenance.Report)? {
+        guard let checkpointingQueue = storage.checkpointingQueue else {
+            return nil
+        }
+        let maintenance = self.maintenance ?? GRDBDatabaseMaintenance(checkpointingQueue: checkpointingQueue,
+                                                                      storageAdapter: self)
+        return maintenance.runMaintenance()
     }
 
     // MARK: -
@@ -252,6 +268,9 @@ public class GRDBDatabaseStorageAdapter: NSObject {
 extension GRDBDatabaseStorageAdapter: SDSDatabaseStorageAdapter {
 
     #if TESTABLE_BUILD
+    // Tests can observe every statement we execute, e.g. to check their query plans.
+    static let queryObserver = AtomicOptional<(String) -> Void>(nil)
+
     // TODO: We could eventually eliminate all nested transactions.
     private static let detectNestedTransactions = false
 
@@ -412,6 +431,29 @@ extension GRDBDatabaseStorageAdapter: SDSDatabaseStorageAdapter {
         }
     }
 
+    // Reads a private copy of the database, made with SQLite's online backup
+    // API. Making the copy is a short read of the database, after which the
+    // block can read for as long as it likes without holding a read open,
+    // which would keep the WAL from being checkpointed, or competing with
+    // the app's own reads. The copy is deleted afterward.
+    public func readCopy(block: @escaping (GRDBReadTransaction) -> Void) throws {
+        assertCanRead()
+
+        let copyUrl = OWSFileSystem.temporaryFileUrl(fileExtension: "sqlite")
+        defer {
+            OWSFileSystem.deleteFileIfExists(copyUrl.path)
+            OWSFileSystem.deleteFileIfExists(copyUrl.path + "-wal")
+            OWSFileSystem.deleteFileIfExists(copyUrl.path + "-shm")
+        }
+
+        let copy = try storage.copy(to: copyUrl)
+        try copy.read { database in
+            autoreleasepool {
+                block(GRDBReadTransaction(database: database, isUIRead: false))
+            }
+        }
+    }
+
     private func assertCanWrite() {
         if !databaseStorage.canWriteToGrdb {
             Logger.error("storageMode: \(FeatureFlags.storageModeDescription).")
@@ -488,6 +530,9 @@ func filterForDBQueryLog(_ input: String) -> String {
 }
 
 private func dbQueryLog(_ value: String) {
+    #if TESTABLE_BUILD
+    GRDBDatabaseStorageAdapter.queryObserver.get()?(value)
+    #endif
     guard SDSDatabaseStorage.shouldLogDBQueries else {
         return
     }
@@ -530,6 +575,14 @@ private struct GRDBStorage {
         OWSFileSystem.protectFileOrFolder(atPath: dbURL.path)
     }
 
+    // The copy is encrypted with the same key as the database.
+    func copy(to copyURL: URL) throws -> DatabaseQueue {
+        let copy = try DatabaseQueue(path: copyURL.path, configuration: poolConfiguration)
+        try pool.backup(to: copy)
+        OWSFileSystem.protectFileOrFolder(atPath: copyURL.path)
+        return copy
+    }
+
     private static func buildConfiguration(keyspec: GRDBKeySpecSource,
                                            isForCheckpointingQueue: Bool) -> Configuration {
         var configuration = Configuration()
@@ -568,6 +621,9 @@ private struct GRDBStorage {
             let keyspec = try keyspec.fetchString()
             try db.execute(sql: "PRAGMA key = \"\(keyspec)\"")
             try db.execute(sql: "PRAGMA cipher_plaintext_header_size = 32")
+            // This only takes effect for new databases; GRDBDatabaseMaintenance
+            // converts existing databases.
+            try db.execute(sql: "PRAGMA auto_vacuum = INCREMENTAL")
         }
         configuration.defaultTransactionKind = .immediate
         configuration.allowsUnsafeTransactions = true
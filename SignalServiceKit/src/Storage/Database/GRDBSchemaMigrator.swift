@@ -18,16 +18,41 @@ public class GRDBSchemaMigrator: NSObject {
 
     @objc
     public func runSchemaMigrations() {
+        LaunchTimer.shared.begin(.grdbSchemaMigrations)
+        defer { LaunchTimer.shared.end(.grdbSchemaMigrations) }
+
         if hasCreatedInitialSchema {
             Logger.info("Using incrementalMigrator.")
             try! incrementalMigrator.migrate(grdbStorage.pool)
         } else {
             Logger.info("Using newUserMigrator.")
             try! newUserMigrator.migrate(grdbStorage.pool)
+            try! grdbStorage.write { transaction in
+                self.backgroundMigrator.markAllMigrationsAsComplete(transaction: transaction)
+            }
         }
         Logger.info("Migrations complete.")
 
         SSKPreferences.markGRDBSchemaAsLatest()
+
+        scheduleBackgroundMigrations()
+    }
+
+    private func scheduleBackgroundMigrations() {
+        // Extensions don't have the time or memory to spare; the main app
+        // will run any outstanding background migrations.
+        guard CurrentAppContext().isMainApp else {
+            return
+        }
+        let backgroundMigrator = self.backgroundMigrator
+        AppReadiness.runNowOrWhenAppDidBecomeReadyIdle {
+            backgroundMigrator.runOutstandingMigrations()
+        }
+
+        // Index any messages that were written, e.g. by the NSE, since the
+        // main app last indexed, and resume any interrupted index rebuild.
+        FullTextSearchIndexer.scheduleFlush()
+        FullTextSearchIndexer.resumeRebuildIfNecessary()
     }
 
     private var hasCreatedInitialSchema: Bool {
@@ -92,6 +117,13 @@ public class GRDBSchemaMigrator: NSObject {
         case updateMarkedUnreadIndex
         case addGroupCallMessage2
         case addGroupCallEraIdIndex
+        case addInterruptedAttachmentDownloadIndex
+        case createEarlyMessageEnvelopes
+        case createThreadInteractionCounters
+        case addCoveringIndexesForHotQueries
+        case createMessageReactionCounts
+        case createPendingFTSIndexTable
+        case createPendingAttachmentPurgeTable
 
         // NOTE: Every time we add a migration id, consider
         // incrementing grdbSchemaVersionLatest.
@@ -119,13 +151,22 @@ public class GRDBSchemaMigrator: NSObject {
         case dataMigration_resetStorageServiceData
         case dataMigration_markAllInteractionsAsNotDeleted
         case dataMigration_recordMessageRequestInteractionIdEpoch
-        case dataMigration_indexSignalRecipients
         case dataMigration_kbsStateCleanup
         case dataMigration_turnScreenSecurityOnForExistingUsers
         case dataMigration_disableLinkPreviewForExistingUsers
         case dataMigration_groupIdMapping
     }
 
+    // MARK: Background Migrations
+    //
+    // Data migrations which revisit every row of a large table, and which the rest of the
+    // app doesn't rely upon (e.g. populating an index), should be background migrations
+    // so that they don't delay launch. See GRDBBackgroundMigrator.
+    private enum BackgroundMigrationId: String, CaseIterable {
+        // This was formerly a (blocking) data migration.
+        case dataMigration_indexSignalRecipients
+    }
+
     public static let grdbSchemaVersionDefault: UInt = 0
     public static let grdbSchemaVersionLatest: UInt = 16
 
@@ -178,6 +219,12 @@ public class GRDBSchemaMigrator: NSObject {
         return migratorWrapper.migrator
     }()
 
+    private lazy var backgroundMigrator: GRDBBackgroundMigrator = {
+        let migrator = GRDBBackgroundMigrator()
+        registerBackgroundMigrations(migrator: migrator)
+        return migrator
+    }()
+
     private func registerSchemaMigrations(migrator: DatabaseMigratorWrapper) {
 
         // The migration blocks should never throw. If we introduce a crashing
@@ -901,6 +948,110 @@ public class GRDBSchemaMigrator: NSObject {
             }
         }
 
+        migrator.registerMigration(MigrationId.addInterruptedAttachmentDownloadIndex.rawValue) { db in
+            do {
+                // A partial index of the attachment pointers whose download was in
+                // flight, so OWSFailedAttachmentDownloadsJob doesn't need to scan
+                // every pending attachment on launch.
+                try db.execute(sql: """
+                    CREATE INDEX index_attachments_on_interrupted_download
+                    ON model_TSAttachment(uniqueId)
+                    WHERE recordType = \(SDSRecordType.attachmentPointer.rawValue)
+                    AND state IN (\(TSAttachmentPointerState.enqueued.rawValue), \(TSAttachmentPointerState.downloading.rawValue))
+                    """)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.createEarlyMessageEnvelopes.rawValue) { db in
+            do {
+                try db.create(table: "early_message_envelopes") { table in
+                    table.autoIncrementedPrimaryKey("id")
+                    table.column("associatedMessageTimestamp", .integer).notNull()
+                    table.column("associatedMessageAuthorUuid", .text)
+                    table.column("associatedMessageAuthorPhoneNumber", .text)
+                    table.column("envelopeData", .blob).notNull()
+                    table.column("plainTextData", .blob)
+                    table.column("wasReceivedByUD", .boolean).notNull()
+                    table.column("serverDeliveryTimestamp", .integer).notNull()
+                    table.column("recordedAt", .integer).notNull()
+                }
+                try db.create(index: "index_early_message_envelopes_on_associatedMessageTimestamp",
+                              on: "early_message_envelopes",
+                              columns: ["associatedMessageTimestamp"])
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.createThreadInteractionCounters.rawValue) { db in
+            do {
+                try db.execute(sql: ThreadInteractionCounters.createTableAndTriggersSql)
+                try ThreadInteractionCounters.rebuild(database: db)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.addCoveringIndexesForHotQueries.rawValue) { db in
+            do {
+                // Conversation loading pages through interaction ids, so we
+                // include the uniqueId to answer those queries from the index.
+                // This supersedes index_interactions_on_threadUniqueId_and_id.
+                try db.create(
+                    index: "index_interactions_on_threadUniqueId_and_id_and_uniqueId",
+                    on: "model_TSInteraction",
+                    columns: ["uniqueThreadId", "id", "uniqueId"]
+                )
+                try db.drop(index: "index_interactions_on_threadUniqueId_and_id")
+
+                // These terms must match the queries in
+                // enumerateMessagesWhichFailedToStartExpiring() and
+                // enumerateAttachmentPointersWithLazyRestoreFragments()
+                // so that SQLite can use these partial indexes.
+                try db.execute(sql: """
+                    CREATE INDEX index_interactions_which_failed_to_start_expiring
+                    ON model_TSInteraction(uniqueId)
+                    WHERE storedShouldStartExpireTimer IS TRUE
+                    AND (expiresAt IS 0 OR expireStartedAt IS 0)
+                    """)
+                try db.execute(sql: """
+                    CREATE INDEX index_attachments_with_lazy_restore_fragments
+                    ON model_TSAttachment(lazyRestoreFragmentId)
+                    WHERE recordType = \(SDSRecordType.attachmentPointer.rawValue)
+                    AND lazyRestoreFragmentId IS NOT NULL
+                    """)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.createMessageReactionCounts.rawValue) { db in
+            do {
+                try db.execute(sql: MessageReactionCounts.createTableAndTriggersSql)
+                try MessageReactionCounts.rebuild(database: db)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.createPendingFTSIndexTable.rawValue) { db in
+            do {
+                try db.execute(sql: FullTextSearchIndexer.createTableSql)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
+        migrator.registerMigration(MigrationId.createPendingAttachmentPurgeTable.rawValue) { db in
+            do {
+                try db.execute(sql: MessageContentSweeper.createTableSql)
+            } catch {
+                owsFail("Error: \(error)")
+            }
+        }
+
         // MARK: - Schema Migration Insertion Point
     }
 
@@ -970,21 +1121,6 @@ public class GRDBSchemaMigrator: NSObject {
             SSKPreferences.setMessageRequestInteractionIdEpoch(maxId, transaction: transaction)
         }
 
-        migrator.registerMigration(MigrationId.dataMigration_indexSignalRecipients.rawValue) { db in
-            let transaction = GRDBWriteTransaction(database: db)
-            defer { transaction.finalizeTransaction() }
-
-            // This migration was initially created as a schema migration instead of a data migration.
-            // If we already ran it there, we need to skip it here since we're doing inserts below that
-            // cannot be repeated.
-            guard !hasRunMigration("indexSignalRecipients", transaction: transaction) else { return }
-
-            SignalRecipient.anyEnumerate(transaction: transaction.asAnyWrite) { (signalRecipient: SignalRecipient,
-                _: UnsafeMutablePointer<ObjCBool>) in
-                GRDBFullTextSearchFinder.modelWasInserted(model: signalRecipient, transaction: transaction)
-            }
-        }
-
         migrator.registerMigration(MigrationId.dataMigration_kbsStateCleanup.rawValue) { db in
             let transaction = GRDBWriteTransaction(database: db)
             defer { transaction.finalizeTransaction() }
@@ -1047,6 +1183,51 @@ public class GRDBSchemaMigrator: NSObject {
             }
         }
     }
+
+    func registerBackgroundMigrations(migrator: GRDBBackgroundMigrator) {
+
+        // Each chunk should be small enough that the app's own writes can
+        // interleave with the migration; see backgroundMigrationChunkSize.
+
+        migrator.registerMigration(BackgroundMigrationId.dataMigration_indexSignalRecipients.rawValue) { checkpoint, transaction in
+            // This migration was initially created as a schema migration, then as a blocking
+            // data migration. If we already ran it as either, we needn't run it again.
+            if checkpoint == nil,
+               hasRunMigration("indexSignalRecipients", transaction: transaction) ||
+               hasRunMigration(BackgroundMigrationId.dataMigration_indexSignalRecipients.rawValue, transaction: transaction) {
+                return nil
+            }
+
+            let sql = """
+                SELECT * FROM \(SignalRecipientRecord.databaseTableName)
+                WHERE \(signalRecipientColumn: .id) > ?
+                ORDER BY \(signalRecipientColumn: .id)
+                LIMIT ?
+                """
+            let cursor = SignalRecipient.grdbFetchCursor(sql: sql,
+                                                         arguments: [checkpoint ?? 0, backgroundMigrationChunkSize],
+                                                         transaction: transaction)
+            var lastRowId: Int?
+            var rowCount = 0
+            do {
+                while let signalRecipient = try cursor.next() {
+                    rowCount += 1
+                    lastRowId = signalRecipient.grdbId?.intValue
+                    // Recipients inserted since launch have already been indexed.
+                    guard !GRDBFullTextSearchFinder.isModelIndexed(model: signalRecipient, transaction: transaction) else {
+                        continue
+                    }
+                    GRDBFullTextSearchFinder.modelWasInserted(model: signalRecipient, transaction: transaction)
+                }
+            } catch {
+                owsFail("Error: \(error)")
+            }
+            guard rowCount == backgroundMigrationChunkSize, let nextCheckpoint = lastRowId else {
+                return nil
+            }
+            return nextCheckpoint
+        }
+    }
 }
 
 private func createV1Schema(db: Database) throws {
@@ -1760,6 +1941,8 @@ public func dedupeSignalRecipients(transaction: SDSAnyWriteTransaction) throws {
     }
 }
 
+private let backgroundMigrationChunkSize = 500
+
 private func hasRunMigration(_ identifier: String, transaction: GRDBReadTransaction) -> Bool {
     do {
         return try String.fetchOne(transaction.database, sql: "SELECT identifier FROM grdb_migrations WHERE identifier = ?", arguments: [identifier]) != nil
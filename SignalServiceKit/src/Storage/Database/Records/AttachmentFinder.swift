@@ -39,6 +39,8 @@ public class AttachmentFinder: NSObject, AttachmentFinderAdapter {
         }
     }
 
+    // In GRDB, attachments are enumerated in the order they were inserted,
+    // oldest first.
     @objc
     public class func enumerateAttachmentPointersWithLazyRestoreFragments(transaction: SDSAnyReadTransaction, block: @escaping (TSAttachmentPointer, UnsafeMutablePointer<ObjCBool>) -> Void) {
         switch transaction.readTransaction {
@@ -49,18 +51,51 @@ public class AttachmentFinder: NSObject, AttachmentFinderAdapter {
         }
     }
 
+    // Fetches the attachments with the given unique ids, keyed by unique id.
+    //
+    // Attachments in the model read cache are used as is. The others are
+    // fetched with as few queries as possible, which also adds them to the
+    // cache, so that callers can resolve the attachments of many messages
+    // at once and later look them up one at a time without further
+    // queries. Unique ids without an attachment are omitted.
+    @objc
+    public class func fetchAttachments(
+        uniqueIds: [String],
+        transaction: SDSAnyReadTransaction
+    ) -> [String: TSAttachment] {
+        guard !uniqueIds.isEmpty else {
+            return [:]
+        }
+        var result = SSKEnvironment.shared.modelReadCaches.attachmentReadCache.getAttachmentsIfInCache(forUniqueIds: uniqueIds, transaction: transaction)
+        let uncachedIds = Set(uniqueIds).subtracting(result.keys)
+        guard !uncachedIds.isEmpty else {
+            return result
+        }
+        switch transaction.readTransaction {
+        case .yapRead:
+            for uniqueId in uncachedIds {
+                if let attachment = TSAttachment.anyFetch(uniqueId: uniqueId,
+                                                          transaction: transaction,
+                                                          ignoreCache: true) {
+                    result[uniqueId] = attachment
+                }
+            }
+        case .grdbRead(let grdbRead):
+            let attachments = GRDBAttachmentFinderAdapter.fetchAttachments(uniqueIds: Array(uncachedIds),
+                                                                           transaction: grdbRead)
+            for attachment in attachments {
+                result[attachment.uniqueId] = attachment
+            }
+        }
+        return result
+    }
+
     @objc
     public class func attachments(
         withAttachmentIds attachmentIds: [String],
         transaction: GRDBReadTransaction
     ) -> [TSAttachment] {
-        guard !attachmentIds.isEmpty else {
-            return []
-        }
-        return GRDBAttachmentFinderAdapter.attachments(
-            withAttachmentIds: attachmentIds,
-            transaction: transaction
-        )
+        return orderedAttachments(withAttachmentIds: attachmentIds, transaction: transaction) { _ in true }
     }
 
     @objc
@@ -69,14 +104,9 @@ public class AttachmentFinder: NSObject, AttachmentFinderAdapter {
         matchingContentType: String,
         transaction: GRDBReadTransaction
     ) -> [TSAttachment] {
-        guard !attachmentIds.isEmpty else {
-            return []
+        return orderedAttachments(withAttachmentIds: attachmentIds, transaction: transaction) { attachment in
+            attachment.contentType == matchingContentType
         }
-        return GRDBAttachmentFinderAdapter.attachments(
-            withAttachmentIds: attachmentIds,
-            matchingContentType: matchingContentType,
-            transaction: transaction
-        )
     }
 
     @objc
@@ -84,15 +114,31 @@ public class AttachmentFinder: NSObject, AttachmentFinderAdapter {
         withAttachmentIds attachmentIds: [String],
         ignoringContentType: String,
         transaction: GRDBReadTransaction
+    ) -> [TSAttachment] {
+        return orderedAttachments(withAttachmentIds: attachmentIds, transaction: transaction) { attachment in
+            attachment.contentType != ignoringContentType
+        }
+    }
+
+    // Returns the attachments in the order of attachmentIds.
+    private class func orderedAttachments(
+        withAttachmentIds attachmentIds: [String],
+        transaction: GRDBReadTransaction,
+        isIncluded: (TSAttachment) -> Bool
     ) -> [TSAttachment] {
         guard !attachmentIds.isEmpty else {
             return []
         }
-        return GRDBAttachmentFinderAdapter.attachments(
-            withAttachmentIds: attachmentIds,
-            ignoringContentType: ignoringContentType,
-            transaction: transaction
-        )
+        let attachmentMap = fetchAttachments(uniqueIds: attachmentIds, transaction: transaction.asAnyRead)
+        var addedIds = Set<String>()
+        return attachmentIds.compactMap { attachmentId -> TSAttachment? in
+            guard addedIds.insert(attachmentId).inserted,
+                  let attachment = attachmentMap[attachmentId],
+                  isIncluded(attachment) else {
+                return nil
+            }
+            return attachment
+        }
     }
 
     @objc
@@ -161,17 +207,18 @@ struct GRDBAttachmentFinderAdapter: AttachmentFinderAdapter {
     // MARK: - static methods
 
     static func unfailedAttachmentPointerIds(transaction: ReadTransaction) -> [String] {
+        // Only downloads that were in flight need to be marked as failed.
+        // These terms must match index_attachments_on_interrupted_download
+        // so that SQLite can use that partial index.
         let sql: String = """
         SELECT \(attachmentColumn: .uniqueId)
         FROM \(AttachmentRecord.databaseTableName)
         WHERE \(attachmentColumn: .recordType) = \(SDSRecordType.attachmentPointer.rawValue)
-        AND \(attachmentColumn: .state) != ?
+        AND \(attachmentColumn: .state) IN (\(TSAttachmentPointerState.enqueued.rawValue), \(TSAttachmentPointerState.downloading.rawValue))
         """
         var result = [String]()
         do {
-            let cursor = try String.fetchCursor(transaction.database,
-                                                sql: sql,
-                                                arguments: [TSAttachmentPointerState.failed.rawValue])
+            let cursor = try String.fetchCursor(transaction.database, sql: sql)
             while let uniqueId = try cursor.next() {
                 result.append(uniqueId)
             }
@@ -182,11 +229,14 @@ struct GRDBAttachmentFinderAdapter: AttachmentFinderAdapter {
     }
 
     static func enumerateAttachmentPointersWithLazyRestoreFragments(transaction: GRDBReadTransaction, block: @escaping (TSAttachmentPointer, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        // These terms must match index_attachments_with_lazy_restore_fragments
+        // so that SQLite can use that partial index.
         let sql: String = """
         SELECT *
         FROM \(AttachmentRecord.databaseTableName)
         WHERE \(attachmentColumn: .recordType) = \(SDSRecordType.attachmentPointer.rawValue)
         AND \(attachmentColumn: .lazyRestoreFragmentId) IS NOT NULL
+        ORDER BY \(attachmentColumn: .id)
         """
         let cursor = TSAttachment.grdbFetchCursor(sql: sql, transaction: transaction)
         do {
@@ -206,54 +256,33 @@ struct GRDBAttachmentFinderAdapter: AttachmentFinderAdapter {
         }
     }
 
-    static func attachments(
-        withAttachmentIds attachmentIds: [String],
-        ignoringContentType: String? = nil,
-        matchingContentType: String? = nil,
-        transaction: GRDBReadTransaction
-    ) -> [TSAttachment] {
-        guard !attachmentIds.isEmpty else { return [] }
-
-        var sql = """
-            SELECT * FROM \(AttachmentRecord.databaseTableName)
-            WHERE \(attachmentColumn: .uniqueId) IN (\(attachmentIds.map { "\'\($0)'" }.joined(separator: ",")))
-        """
-
-        let arguments: StatementArguments
-
-        if let ignoringContentType = ignoringContentType {
-            sql += " AND \(attachmentColumn: .contentType) != ?"
-            arguments = [ignoringContentType]
-        } else if let matchingContentType = matchingContentType {
-            sql += " AND \(attachmentColumn: .contentType) = ?"
-            arguments = [matchingContentType]
-        } else {
-            arguments = []
-        }
-
-        let cursor = TSAttachment.grdbFetchCursor(sql: sql, arguments: arguments, transaction: transaction)
+    // SQLite limits the number of arguments of a statement.
+    private static let maxFetchBatchSize = 500
 
+    // Returns the attachments in no particular order.
+    static func fetchAttachments(uniqueIds: [String], transaction: GRDBReadTransaction) -> [TSAttachment] {
         var attachments = [TSAttachment]()
-
-        do {
-            while let attachment = try cursor.next() {
-                attachments.append(attachment)
-            }
-        } catch {
-            owsFailDebug("unexpected error \(error)")
-        }
-
-        return attachments.sorted { lhs, rhs -> Bool in
-            guard let lhsIndex = attachmentIds.firstIndex(of: lhs.uniqueId) else {
-                owsFailDebug("unexpected attachment \(lhs.uniqueId)")
-                return false
-            }
-            guard let rhsIndex = attachmentIds.firstIndex(of: rhs.uniqueId) else {
-                owsFailDebug("unexpected attachment \(rhs.uniqueId)")
-                return false
+        var batchStart = 0
+        while batchStart < uniqueIds.count {
+            let batch = Array(uniqueIds[batchStart..<min(uniqueIds.count, batchStart + maxFetchBatchSize)])
+            batchStart += batch.count
+
+            let sql = """
+                SELECT * FROM \(AttachmentRecord.databaseTableName)
+                WHERE \(attachmentColumn: .uniqueId) IN (\(batch.map { _ in "?" }.joined(separator: ",")))
+            """
+            let cursor = TSAttachment.grdbFetchCursor(sql: sql,
+                                                      arguments: StatementArguments(batch),
+                                                      transaction: transaction)
+            do {
+                while let attachment = try cursor.next() {
+                    attachments.append(attachment)
+                }
+            } catch {
+                owsFailDebug("unexpected error \(error)")
             }
-            return lhsIndex < rhsIndex
         }
+        return attachments
     }
 
     static func existsAttachments(
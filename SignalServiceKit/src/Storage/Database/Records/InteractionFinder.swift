@@ -25,10 +25,14 @@ protocol InteractionFinderAdapter {
 
     static func interactionIdsWithExpiredPerConversationExpiration(transaction: ReadTransaction) -> [String]
 
+    static func nextExpirationTimestamp(transaction: ReadTransaction) -> UInt64?
+
     static func enumerateMessagesWhichFailedToStartExpiring(transaction: ReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void)
 
     static func interactions(withInteractionIds interactionIds: Set<String>, transaction: ReadTransaction) -> Set<TSInteraction>
 
+    static func enumerateAllMessageAttachmentIds(transaction: ReadTransaction, block: @escaping ([String], UnsafeMutablePointer<ObjCBool>) -> Void)
+
     // MARK: - instance methods
 
     func mostRecentInteractionForInbox(transaction: ReadTransaction) -> TSInteraction?
@@ -114,6 +118,24 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
+    // Fetches the interactions with any of the given timestamps, using one
+    // query per batch of timestamps rather than one query per timestamp.
+    @objc
+    public class func interactions(withTimestamps timestamps: [NSNumber], filter: @escaping (TSInteraction) -> Bool, transaction: SDSAnyReadTransaction) throws -> [TSInteraction] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return try timestamps.flatMap { timestamp in
+                try YAPDBInteractionFinderAdapter.interactions(withTimestamp: timestamp.uint64Value,
+                                                               filter: filter,
+                                                               transaction: yapRead)
+            }
+        case .grdbRead(let grdbRead):
+            return try GRDBInteractionFinder.interactions(withTimestamps: timestamps.map { $0.uint64Value },
+                                                          filter: filter,
+                                                          transaction: grdbRead)
+        }
+    }
+
     @objc
     public class func incompleteCallIds(transaction: SDSAnyReadTransaction) -> [String] {
         switch transaction.readTransaction {
@@ -134,33 +156,354 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
+    // The badge is recomputed on every database change, so we build
+    // this SQL once and reuse its prepared statement.
+    private static let markedUnreadThreadCountQuery = """
+        SELECT COUNT(*)
+        FROM \(ThreadRecord.databaseTableName)
+        WHERE \(threadColumn: .isMarkedUnread) = 1
+        AND \(threadColumn: .shouldThreadBeVisible) = 1
+    """
+
     @objc
     public class func unreadCountInAllThreads(transaction: GRDBReadTransaction) -> UInt {
         do {
-            var unreadInteractionQuery = """
-                SELECT COUNT(interaction.\(interactionColumn: .id))
-                FROM \(InteractionRecord.databaseTableName) AS interaction
-            """
+            let includeMutedThreads = SSKPreferences.includeMutedThreadsInBadgeCount(transaction: transaction.asAnyRead)
+            let unreadInteractionCount = try ThreadInteractionCounters.unreadCountInAllThreads(includeMutedThreads: includeMutedThreads,
+                                                                                             transaction: transaction)
+
+            let markedUnreadThreadRequest = SQLRequest<UInt>(sql: markedUnreadThreadCountQuery, cached: true)
+            guard let markedUnreadCount = try UInt.fetchOne(transaction.database, markedUnreadThreadRequest) else {
+                owsFailDebug("markedUnreadCount was unexpectedly nil")
+                return unreadInteractionCount
+            }
+
+            return unreadInteractionCount + markedUnreadCount
+        } catch {
+            owsFailDebug("error: \(error)")
+            return 0
+        }
+    }
+
+    // The interactions should be enumerated in order from "next to expire" to "last to expire".
+    @objc
+    public class func enumerateMessagesWithStartedPerConversationExpiration(transaction: SDSAnyReadTransaction, block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            YAPDBInteractionFinderAdapter.enumerateMessagesWithStartedPerConversationExpiration(transaction: yapRead, block: block)
+        case .grdbRead(let grdbRead):
+            GRDBInteractionFinder.enumerateMessagesWithStartedPerConversationExpiration(transaction: grdbRead, block: block)
+        }
+    }
+
+    @objc
+    public class func interactionIdsWithExpiredPerConversationExpiration(transaction: SDSAnyReadTransaction) -> [String] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.interactionIdsWithExpiredPerConversationExpiration(transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return GRDBInteractionFinder.interactionIdsWithExpiredPerConversationExpiration(transaction: grdbRead)
+        }
+    }
+
+    /// The expiration time of the next message to expire, if any.
+    @objc
+    public class func nextExpirationTimestamp(transaction: SDSAnyReadTransaction) -> NSNumber? {
+        let result: UInt64?
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            result = YAPDBInteractionFinderAdapter.nextExpirationTimestamp(transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            result = GRDBInteractionFinder.nextExpirationTimestamp(transaction: grdbRead)
+        }
+        return result.map { NSNumber(value: $0) }
+    }
+
+    @objc
+    public class func enumerateMessagesWhichFailedToStartExpiring(transaction: SDSAnyReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            YAPDBInteractionFinderAdapter.enumerateMessagesWhichFailedToStartExpiring(transaction: yapRead, block: block)
+        case .grdbRead(let grdbRead):
+            GRDBInteractionFinder.enumerateMessagesWhichFailedToStartExpiring(transaction: grdbRead, block: block)
+        }
+    }
+
+    @objc
+    public class func interactions(withInteractionIds interactionIds: Set<String>, transaction: SDSAnyReadTransaction) -> Set<TSInteraction> {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.interactions(withInteractionIds: interactionIds, transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return GRDBInteractionFinder.interactions(withInteractionIds: interactionIds, transaction: grdbRead)
+        }
+    }
+
+    /// Enumerates the allAttachmentIds of every message.
+    ///
+    /// With GRDB, this doesn't build the messages, and the block is also
+    /// called (with no ids) for interactions which aren't messages.
+    @objc
+    public class func enumerateAllMessageAttachmentIds(transaction: SDSAnyReadTransaction, block: @escaping ([String], UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            YAPDBInteractionFinderAdapter.enumerateAllMessageAttachmentIds(transaction: yapRead, block: block)
+        case .grdbRead(let grdbRead):
+            GRDBInteractionFinder.enumerateAllMessageAttachmentIds(transaction: grdbRead, block: block)
+        }
+    }
+
+    @objc
+    public class func findMessage(
+        withTimestamp timestamp: UInt64,
+        threadId: String,
+        author: SignalServiceAddress,
+        transaction: SDSAnyReadTransaction
+    ) -> TSMessage? {
+        return findMessages(withTimestampsAndAuthors: [(timestamp: timestamp, author: author)],
+                            threadId: threadId,
+                            transaction: transaction)[0]
+    }
+
+    public typealias MessageReference = (timestamp: UInt64, author: SignalServiceAddress)
+
+    /// Resolves many references to messages in a thread at once, e.g. the
+    /// quotes, reactions or deletes which refer to messages by their
+    /// timestamp and author.
+    ///
+    /// Returns the message for each reference, in the same order as the
+    /// references, or nil for each reference which doesn't resolve.
+    public class func findMessages(
+        withTimestampsAndAuthors references: [MessageReference],
+        threadId: String,
+        transaction: SDSAnyReadTransaction
+    ) -> [TSMessage?] {
+        guard !threadId.isEmpty else {
+            owsFailDebug("invalid thread")
+            return references.map { _ in nil }
+        }
+
+        var timestamps = Set<UInt64>()
+        for reference in references {
+            if reference.timestamp == 0 {
+                owsFailDebug("invalid timestamp: \(reference.timestamp)")
+            } else if !reference.author.isValid {
+                owsFailDebug("Invalid author \(reference.author)")
+            } else {
+                timestamps.insert(reference.timestamp)
+            }
+        }
+        guard !timestamps.isEmpty else {
+            return references.map { _ in nil }
+        }
+
+        let interactions: [TSInteraction]
+        do {
+            interactions = try InteractionFinder.interactions(
+                withTimestamps: timestamps.map { NSNumber(value: $0) },
+                filter: { $0 is TSMessage },
+                transaction: transaction
+            )
+        } catch {
+            owsFailDebug("Error loading interactions \(error.localizedDescription)")
+            return references.map { _ in nil }
+        }
 
-            if !SSKPreferences.includeMutedThreadsInBadgeCount(transaction: transaction.asAnyRead) {
-                unreadInteractionQuery += " \(sqlClauseForIgnoringInteractionsWithMutedThread) "
+        var messagesByTimestamp = [UInt64: [TSMessage]]()
+        for interaction in interactions {
+            guard let message = interaction as? TSMessage else {
+                owsFailDebug("received unexpected non-message interaction")
+                continue
             }
 
-            unreadInteractionQuery += " WHERE \(sqlClauseForUnreadInteractionCounts(interactionsAlias: "interaction")) "
+            guard message.uniqueThreadId == threadId else { continue }
+
+            messagesByTimestamp[message.timestamp, default: []].append(message)
+        }
 
-            guard let unreadInteractionCount = try UInt.fetchOne(transaction.database, sql: unreadInteractionQuery) else {
-                owsFailDebug("unreadInteractionCount was unexpectedly nil")
-                return 0
+        return references.map { reference in
+            guard let messages = messagesByTimestamp[reference.timestamp] else {
+                return nil
             }
+            for message in messages {
+                if let incomingMessage = message as? TSIncomingMessage,
+                    incomingMessage.authorAddress.isEqualToAddress(reference.author) {
+                    return incomingMessage
+                }
 
-            let markedUnreadThreadQuery = """
-                SELECT COUNT(*)
-                FROM \(ThreadRecord.databaseTableName)
-                WHERE \(threadColumn: .isMarkedUnread) = 1
-                AND \(threadColumn: .shouldThreadBeVisible) = 1
-            """
+                if let outgoingMessage = message as? TSOutgoingMessage,
+                    reference.author.isLocalAddress {
+                    return outgoingMessage
+                }
+            }
+            return nil
+        }
+    }
+
+    /// Fetches the outgoing messages with any of the given timestamps, e.g.
+    /// the timestamps of a delivery or read receipt, keyed by timestamp.
+    @objc
+    public class func outgoingMessagesByTimestamp(
+        withTimestamps timestamps: [NSNumber],
+        transaction: SDSAnyReadTransaction
+    ) throws -> [NSNumber: [TSOutgoingMessage]] {
+        let interactions = try InteractionFinder.interactions(
+            withTimestamps: timestamps,
+            filter: { $0 is TSOutgoingMessage },
+            transaction: transaction
+        )
+        var result = [NSNumber: [TSOutgoingMessage]]()
+        for interaction in interactions {
+            guard let outgoingMessage = interaction as? TSOutgoingMessage else {
+                owsFailDebug("received unexpected non-outgoing interaction")
+                continue
+            }
+            result[NSNumber(value: outgoingMessage.timestamp), default: []].append(outgoingMessage)
+        }
+        return result
+    }
+
+    // MARK: - instance methods
+
+    func mostRecentInteractionForInbox(transaction: ReadTransaction) -> TSInteraction?
+
+    func earliestKnownInteractionRowId(transaction: ReadTransaction) -> Int?
+
+    func distanceFromLatest(interactionUniqueId: String, transaction: ReadTransaction) throws -> UInt?
+    func count(transaction: ReadTransaction) -> UInt
+    func enumerateInteractionIds(transaction: ReadTransaction, block: @escaping (String, UnsafeMutablePointer<ObjCBool>) throws -> Void) throws
+    func enumerateRecentInteractions(transaction: ReadTransaction, block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) throws
+    func enumerateInteractions(range: NSRange, transaction: ReadTransaction, block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) throws
+    func interactionIds(inRange range: NSRange, transaction: ReadTransaction) throws -> [String]
+    func existsOutgoingMessage(transaction: ReadTransaction) -> Bool
+    func outgoingMessageCount(transaction: ReadTransaction) -> UInt
+
+    func interaction(at index: UInt, transaction: ReadTransaction) throws -> TSInteraction?
+
+    func firstInteraction(atOrAroundSortId sortId: UInt64, transaction: ReadTransaction) -> TSInteraction?
+
+    #if DEBUG
+    func enumerateUnstartedExpiringMessages(transaction: ReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void)
+    #endif
+}
+
+// MARK: -
+
+@objc
+public class InteractionFinder: NSObject, InteractionFinderAdapter {
+
+    let yapAdapter: YAPDBInteractionFinderAdapter
+    let grdbAdapter: GRDBInteractionFinder
+    let threadUniqueId: String
+
+    @objc
+    public init(threadUniqueId: String) {
+        self.threadUniqueId = threadUniqueId
+        self.yapAdapter = YAPDBInteractionFinderAdapter(threadUniqueId: threadUniqueId)
+        self.grdbAdapter = GRDBInteractionFinder(threadUniqueId: threadUniqueId)
+    }
+
+    // MARK: - static methods
+
+    @objc
+    public class func fetchSwallowingErrors(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSInteraction? {
+        do {
+            return try fetch(uniqueId: uniqueId, transaction: transaction)
+        } catch {
+            owsFailDebug("error: \(error)")
+            return nil
+        }
+    }
+
+    public class func fetch(uniqueId: String, transaction: SDSAnyReadTransaction) throws -> TSInteraction? {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.fetch(uniqueId: uniqueId, transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return try GRDBInteractionFinder.fetch(uniqueId: uniqueId, transaction: grdbRead)
+        }
+    }
+
+    @objc
+    public class func existsIncomingMessage(timestamp: UInt64, address: SignalServiceAddress, sourceDeviceId: UInt32, transaction: SDSAnyReadTransaction) -> Bool {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.existsIncomingMessage(timestamp: timestamp, address: address, sourceDeviceId: sourceDeviceId, transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return GRDBInteractionFinder.existsIncomingMessage(timestamp: timestamp, address: address, sourceDeviceId: sourceDeviceId, transaction: grdbRead)
+        }
+    }
+
+    @objc
+    public class func interactions(withTimestamp timestamp: UInt64, filter: @escaping (TSInteraction) -> Bool, transaction: SDSAnyReadTransaction) throws -> [TSInteraction] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return try YAPDBInteractionFinderAdapter.interactions(withTimestamp: timestamp,
+                                                                  filter: filter,
+                                                                  transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return try GRDBInteractionFinder.interactions(withTimestamp: timestamp,
+                                                                 filter: filter,
+                                                                 transaction: grdbRead)
+        }
+    }
+
+    // Fetches the interactions with any of the given timestamps, using one
+    // query per batch of timestamps rather than one query per timestamp.
+    @objc
+    public class func interactions(withTimestamps timestamps: [NSNumber], filter: @escaping (TSInteraction) -> Bool, transaction: SDSAnyReadTransaction) throws -> [TSInteraction] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return try timestamps.flatMap { timestamp in
+                try YAPDBInteractionFinderAdapter.interactions(withTimestamp: timestamp.uint64Value,
+                                                               filter: filter,
+                                                               transaction: yapRead)
+            }
+        case .grdbRead(let grdbRead):
+            return try GRDBInteractionFinder.interactions(withTimestamps: timestamps.map { $0.uint64Value },
+                                                          filter: filter,
+                                                          transaction: grdbRead)
+        }
+    }
+
+    @objc
+    public class func incompleteCallIds(transaction: SDSAnyReadTransaction) -> [String] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.incompleteCallIds(transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return GRDBInteractionFinder.incompleteCallIds(transaction: grdbRead)
+        }
+    }
+
+    @objc
+    public class func attemptingOutInteractionIds(transaction: SDSAnyReadTransaction) -> [String] {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            return YAPDBInteractionFinderAdapter.attemptingOutInteractionIds(transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            return GRDBInteractionFinder.attemptingOutInteractionIds(transaction: grdbRead)
+        }
+    }
 
-            guard let markedUnreadCount = try UInt.fetchOne(transaction.database, sql: markedUnreadThreadQuery) else {
+    // The badge is recomputed on every database change, so we build
+    // this SQL once and reuse its prepared statement.
+    private static let markedUnreadThreadCountQuery = """
+        SELECT COUNT(*)
+        FROM \(ThreadRecord.databaseTableName)
+        WHERE \(threadColumn: .isMarkedUnread) = 1
+        AND \(threadColumn: .shouldThreadBeVisible) = 1
+    """
+
+    @objc
+    public class func unreadCountInAllThreads(transaction: GRDBReadTransaction) -> UInt {
+        do {
+            let includeMutedThreads = SSKPreferences.includeMutedThreadsInBadgeCount(transaction: transaction.asAnyRead)
+            let unreadInteractionCount = try ThreadInteractionCounters.unreadCountInAllThreads(includeMutedThreads: includeMutedThreads,
+                                                                                             transaction: transaction)
+
+            let markedUnreadThreadRequest = SQLRequest<UInt>(sql: markedUnreadThreadCountQuery, cached: true)
+            guard let markedUnreadCount = try UInt.fetchOne(transaction.database, markedUnreadThreadRequest) else {
                 owsFailDebug("markedUnreadCount was unexpectedly nil")
                 return unreadInteractionCount
             }
@@ -193,6 +536,19 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
+    /// The expiration time of the next message to expire, if any.
+    @objc
+    public class func nextExpirationTimestamp(transaction: SDSAnyReadTransaction) -> NSNumber? {
+        let result: UInt64?
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            result = YAPDBInteractionFinderAdapter.nextExpirationTimestamp(transaction: yapRead)
+        case .grdbRead(let grdbRead):
+            result = GRDBInteractionFinder.nextExpirationTimestamp(transaction: grdbRead)
+        }
+        return result.map { NSNumber(value: $0) }
+    }
+
     @objc
     public class func enumerateMessagesWhichFailedToStartExpiring(transaction: SDSAnyReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void) {
         switch transaction.readTransaction {
@@ -213,6 +569,20 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
+    /// Enumerates the allAttachmentIds of every message.
+    ///
+    /// With GRDB, this doesn't build the messages, and the block is also
+    /// called (with no ids) for interactions which aren't messages.
+    @objc
+    public class func enumerateAllMessageAttachmentIds(transaction: SDSAnyReadTransaction, block: @escaping ([String], UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead(let yapRead):
+            YAPDBInteractionFinderAdapter.enumerateAllMessageAttachmentIds(transaction: yapRead, block: block)
+        case .grdbRead(let grdbRead):
+            GRDBInteractionFinder.enumerateAllMessageAttachmentIds(transaction: grdbRead, block: block)
+        }
+    }
+
     @objc
     public class func findMessage(
         withTimestamp timestamp: UInt64,
@@ -315,21 +685,7 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
     @objc
     public func unreadCount(transaction: GRDBReadTransaction) -> UInt {
         do {
-            let sql = """
-                SELECT COUNT(*)
-                FROM \(InteractionRecord.databaseTableName)
-                WHERE \(interactionColumn: .threadUniqueId) = ?
-                AND \(InteractionFinder.sqlClauseForUnreadInteractionCounts())
-            """
-            let arguments: StatementArguments = [threadUniqueId]
-
-            guard let count = try UInt.fetchOne(transaction.database,
-                                                sql: sql,
-                                                arguments: arguments) else {
-                    owsFailDebug("count was unexpectedly nil")
-                    return 0
-            }
-            return count
+            return try ThreadInteractionCounters.unreadCount(threadUniqueId: threadUniqueId, transaction: transaction)
         } catch {
             owsFailDebug("error: \(error)")
             return 0
@@ -391,7 +747,7 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
             SELECT *
             FROM \(InteractionRecord.databaseTableName)
             WHERE \(interactionColumn: .threadUniqueId) = ?
-            AND \(sqlClauseForAllUnreadInteractions)
+            AND \(Self.sqlClauseForAllUnreadInteractions)
         """
 
         let cursor = TSInteraction.grdbFetchCursor(sql: sql, arguments: [threadUniqueId], transaction: transaction)
@@ -428,7 +784,7 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
             FROM \(InteractionRecord.databaseTableName)
             WHERE \(interactionColumn: .threadUniqueId) = ?
             AND \(interactionColumn: .id) <= ?
-            AND \(sqlClauseForAllUnreadInteractions)
+            AND \(Self.sqlClauseForAllUnreadInteractions)
         """
 
         let cursor = TSInteraction.grdbFetchCursor(sql: sql, arguments: [threadUniqueId, beforeSortId], transaction: transaction)
@@ -491,13 +847,27 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
             SELECT *
             FROM \(InteractionRecord.databaseTableName)
             WHERE \(interactionColumn: .threadUniqueId) = ?
-            AND \(sqlClauseForAllUnreadInteractions)
+            AND \(Self.sqlClauseForAllUnreadInteractions)
             ORDER BY \(interactionColumn: .id)
         """
         let cursor = TSInteraction.grdbFetchCursor(sql: sql, arguments: [threadUniqueId], transaction: transaction)
         return try cursor.next()
     }
 
+    /// Returns the interaction which immediately follows a given sort id in this thread, if any.
+    public func interaction(afterSortId sortId: UInt64, transaction: GRDBReadTransaction) throws -> TSInteraction? {
+        let sql = """
+            SELECT *
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .threadUniqueId) = ?
+            AND \(interactionColumn: .id) > ?
+            ORDER BY \(interactionColumn: .id)
+            LIMIT 1
+        """
+        let cursor = TSInteraction.grdbFetchCursor(sql: sql, arguments: [threadUniqueId, sortId], transaction: transaction)
+        return try cursor.next()
+    }
+
     public func interaction(at index: UInt, transaction: SDSAnyReadTransaction) throws -> TSInteraction? {
         switch transaction.readTransaction {
         case .yapRead(let yapRead):
@@ -551,7 +921,7 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
 
     // MARK: - Unread
 
-    private let sqlClauseForAllUnreadInteractions: String = {
+    private static let sqlClauseForAllUnreadInteractions: String = {
         let recordTypes: [SDSRecordType] = [
             .disappearingConfigurationUpdateInfoMessage,
             .unknownProtocolVersionMessage,
@@ -575,7 +945,9 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         """
     }()
 
-    private static func sqlClauseForUnreadInteractionCounts(interactionsAlias: String? = nil) -> String {
+    // NOTE: ThreadInteractionCounters' triggers are built from this clause;
+    // changing it requires a migration which recreates those triggers.
+    static func sqlClauseForUnreadInteractionCounts(interactionsAlias: String? = nil) -> String {
         let columnPrefix: String
         if let interactionsAlias = interactionsAlias {
             columnPrefix = interactionsAlias + "."
@@ -594,17 +966,6 @@ public class InteractionFinder: NSObject, InteractionFinderAdapter {
         )
         """
     }
-
-    private static let sqlClauseForIgnoringInteractionsWithMutedThread: String = {
-        return """
-        INNER JOIN \(ThreadRecord.databaseTableName) AS thread
-        ON \(interactionColumn: .threadUniqueId) = thread.\(threadColumn: .uniqueId)
-        AND (
-            thread.\(threadColumn: .mutedUntilDate) <= strftime('%s','now')
-            OR thread.\(threadColumn: .mutedUntilDate) IS NULL
-        )
-        """
-    }()
 }
 
 // MARK: -
@@ -651,6 +1012,21 @@ struct YAPDBInteractionFinderAdapter: InteractionFinderAdapter {
         return OWSDisappearingMessagesFinder.ydb_interactionIdsWithExpiredPerConversationExpiration(with: transaction)
     }
 
+    static func nextExpirationTimestamp(transaction: YapDatabaseReadTransaction) -> UInt64? {
+        var result: UInt64?
+        enumerateMessagesWithStartedPerConversationExpiration(transaction: transaction) { interaction, stop in
+            guard let message = interaction as? TSMessage else {
+                owsFailDebug("Unexpected object: \(type(of: interaction))")
+                return
+            }
+            if message.expiresAt > 0 {
+                result = message.expiresAt
+            }
+            stop.pointee = true
+        }
+        return result
+    }
+
     static func enumerateMessagesWhichFailedToStartExpiring(transaction: YapDatabaseReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void) {
         OWSDisappearingMessagesFinder.ydb_enumerateMessagesWhichFailedToStartExpiring(block, transaction: transaction)
     }
@@ -659,6 +1035,15 @@ struct YAPDBInteractionFinderAdapter: InteractionFinderAdapter {
         owsFail("Not implemented.")
     }
 
+    static func enumerateAllMessageAttachmentIds(transaction: YapDatabaseReadTransaction, block: @escaping ([String], UnsafeMutablePointer<ObjCBool>) -> Void) {
+        TSInteraction.anyEnumerate(transaction: transaction.asAnyRead, batched: true) { interaction, stop in
+            guard let message = interaction as? TSMessage else {
+                return
+            }
+            block(message.allAttachmentIds(), stop)
+        }
+    }
+
     // MARK: - instance methods
 
     func mostRecentInteractionForInbox(transaction: YapDatabaseReadTransaction) -> TSInteraction? {
@@ -883,6 +1268,24 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         return unfiltered.filter(filter)
     }
 
+    static func interactions(withTimestamps timestamps: [UInt64], filter: @escaping (TSInteraction) -> Bool, transaction: ReadTransaction) throws -> [TSInteraction] {
+        var result = [TSInteraction]()
+        // Stay well below SQLite's limit on the number of arguments.
+        let batchSize = 500
+        for batchStart in stride(from: 0, to: timestamps.count, by: batchSize) {
+            let batch = Array(timestamps[batchStart..<min(timestamps.count, batchStart + batchSize)])
+            let sql = """
+            SELECT *
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .timestamp) IN (\(batch.map { _ in "?" }.joined(separator: ", ")))
+            """
+            let arguments = StatementArguments(batch)
+            let unfiltered = try TSInteraction.grdbFetchCursor(sql: sql, arguments: arguments, transaction: transaction).all()
+            result += unfiltered.filter(filter)
+        }
+        return result
+    }
+
     static func incompleteCallIds(transaction: ReadTransaction) -> [String] {
         let sql: String = """
         SELECT \(interactionColumn: .uniqueId)
@@ -1019,9 +1422,33 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         return result
     }
 
+    static func nextExpirationTimestamp(transaction: ReadTransaction) -> UInt64? {
+        // We only need expiresAt, so we don't build the message.
+        var result: UInt64?
+        do {
+            try InteractionProjection.enumerate(
+                columns: [.expiresAt],
+                sqlSuffix: """
+                    WHERE \(interactionColumn: .expiresInSeconds) > 0
+                    AND \(interactionColumn: .expiresAt) > 0
+                    ORDER BY \(interactionColumn: .expiresAt)
+                    LIMIT 1
+                    """,
+                transaction: transaction
+            ) { projection, _ in
+                result = projection.value(.expiresAt)
+            }
+        } catch {
+            owsFailDebug("error: \(error)")
+        }
+        return result
+    }
+
     static func enumerateMessagesWhichFailedToStartExpiring(transaction: ReadTransaction, block: @escaping (TSMessage, UnsafeMutablePointer<ObjCBool>) -> Void) {
         // NOTE: We DO consult storedShouldStartExpireTimer here.
         //       We don't want to start expiration until it is true.
+        // These terms must match index_interactions_which_failed_to_start_expiring
+        // so that SQLite can use that partial index.
         let sql = """
         SELECT *
         FROM \(InteractionRecord.databaseTableName)
@@ -1071,19 +1498,39 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         return interactions
     }
 
+    static func enumerateAllMessageAttachmentIds(transaction: GRDBReadTransaction, block: @escaping ([String], UnsafeMutablePointer<ObjCBool>) -> Void) {
+        do {
+            try InteractionProjection.enumerate(columns: InteractionProjection.attachmentIdColumns,
+                                                sqlSuffix: "",
+                                                transaction: transaction) { projection, stop in
+                try autoreleasepool {
+                    block(try projection.allAttachmentIds(), stop)
+                }
+            }
+        } catch {
+            owsFailDebug("error: \(error)")
+        }
+    }
+
     // MARK: - instance methods
 
+    // The conversation list runs these queries for every visible cell, so we
+    // build their SQL once. The SQL doubles as the key for the connection's
+    // prepared statement cache, so these queries must bind all of their values.
+    private static let mostRecentInteractionsForInboxSql = """
+            SELECT *
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .threadUniqueId) = ?
+            AND \(interactionColumn: .errorType) IS NOT ?
+            AND \(interactionColumn: .messageType) IS NOT ?
+            AND \(interactionColumn: .messageType) IS NOT ?
+            ORDER BY \(interactionColumn: .id) DESC
+            """
+    private static let mostRecentInteractionForInboxSql = mostRecentInteractionsForInboxSql + " LIMIT 1"
+
     func mostRecentInteractionForInbox(transaction: GRDBReadTransaction) -> TSInteraction? {
-        let interactionsSql = """
-                SELECT *
-                FROM \(InteractionRecord.databaseTableName)
-                WHERE \(interactionColumn: .threadUniqueId) = ?
-                AND \(interactionColumn: .errorType) IS NOT ?
-                AND \(interactionColumn: .messageType) IS NOT ?
-                AND \(interactionColumn: .messageType) IS NOT ?
-                ORDER BY \(interactionColumn: .id) DESC
-                """
-        let firstInteractionSql = interactionsSql + " LIMIT 1"
+        let interactionsSql = Self.mostRecentInteractionsForInboxSql
+        let firstInteractionSql = Self.mostRecentInteractionForInboxSql
         let arguments: StatementArguments = [threadUniqueId,
                                              TSErrorMessageType.nonBlockingIdentityChange.rawValue,
                                              TSInfoMessageType.verificationStateChange.rawValue,
@@ -1124,35 +1571,48 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
+    private static let earliestKnownInteractionRowIdSql = """
+            SELECT \(interactionColumn: .id)
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .threadUniqueId) = ?
+            ORDER BY \(interactionColumn: .id) ASC
+            LIMIT 1
+            """
+
     func earliestKnownInteractionRowId(transaction: GRDBReadTransaction) -> Int? {
-        let sql = """
-                SELECT \(interactionColumn: .id)
-                FROM \(InteractionRecord.databaseTableName)
-                WHERE \(interactionColumn: .threadUniqueId) = ?
-                ORDER BY \(interactionColumn: .id) ASC
-                LIMIT 1
-                """
-        let arguments: StatementArguments = [threadUniqueId]
-        return try? Int.fetchOne(transaction.database, sql: sql, arguments: arguments)
+        let request = SQLRequest<Int>(sql: Self.earliestKnownInteractionRowIdSql,
+                                      arguments: [threadUniqueId],
+                                      cached: true)
+        return try? Int.fetchOne(transaction.database, request)
     }
 
+    private static let interactionRowIdSql = """
+        SELECT id
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .uniqueId) = ?
+    """
+
+    private static let distanceFromLatestSql = """
+        SELECT count(*) - 1
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .threadUniqueId) = ?
+        AND \(interactionColumn: .id) >= ?
+        ORDER BY \(interactionColumn: .id) DESC
+    """
+
     func distanceFromLatest(interactionUniqueId: String, transaction: GRDBReadTransaction) throws -> UInt? {
-        guard let interactionId = try UInt.fetchOne(transaction.database, sql: """
-            SELECT id
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .uniqueId) = ?
-        """, arguments: [interactionUniqueId]) else {
+        let interactionIdRequest = SQLRequest<UInt>(sql: Self.interactionRowIdSql,
+                                                    arguments: [interactionUniqueId],
+                                                    cached: true)
+        guard let interactionId = try UInt.fetchOne(transaction.database, interactionIdRequest) else {
             owsFailDebug("failed to find id for interaction \(interactionUniqueId)")
             return nil
         }
 
-        guard let distanceFromLatest = try UInt.fetchOne(transaction.database, sql: """
-            SELECT count(*) - 1
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .threadUniqueId) = ?
-            AND \(interactionColumn: .id) >= ?
-            ORDER BY \(interactionColumn: .id) DESC
-        """, arguments: [threadUniqueId, interactionId]) else {
+        let distanceRequest = SQLRequest<UInt>(sql: Self.distanceFromLatestSql,
+                                               arguments: [threadUniqueId, interactionId],
+                                               cached: true)
+        guard let distanceFromLatest = try UInt.fetchOne(transaction.database, distanceRequest) else {
             owsFailDebug("failed to find distance from latest message")
             return nil
         }
@@ -1162,31 +1622,25 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
 
     func count(transaction: GRDBReadTransaction) -> UInt {
         do {
-            guard let count = try UInt.fetchOne(transaction.database,
-                                                sql: """
-                SELECT COUNT(*)
-                FROM \(InteractionRecord.databaseTableName)
-                WHERE \(interactionColumn: .threadUniqueId) = ?
-                """,
-                arguments: [threadUniqueId]) else {
-                    throw OWSAssertionError("count was unexpectedly nil")
-            }
-            return count
+            return try ThreadInteractionCounters.interactionCount(threadUniqueId: threadUniqueId, transaction: transaction)
         } catch {
             owsFail("error: \(error)")
         }
     }
 
+    private static let interactionIdsNewestFirstSql = """
+        SELECT \(interactionColumn: .uniqueId)
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .threadUniqueId) = ?
+        ORDER BY \(interactionColumn: .id) DESC
+        """
+
     func enumerateInteractionIds(transaction: GRDBReadTransaction, block: @escaping (String, UnsafeMutablePointer<ObjCBool>) throws -> Void) throws {
 
-        let cursor = try String.fetchCursor(transaction.database,
-                                            sql: """
-            SELECT \(interactionColumn: .uniqueId)
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .threadUniqueId) = ?
-            ORDER BY \(interactionColumn: .id) DESC
-            """,
-            arguments: [threadUniqueId])
+        let request = SQLRequest<String>(sql: Self.interactionIdsNewestFirstSql,
+                                         arguments: [threadUniqueId],
+                                         cached: true)
+        let cursor = try String.fetchCursor(transaction.database, request)
         while let uniqueId = try cursor.next() {
             var stop: ObjCBool = false
             try block(uniqueId, &stop)
@@ -1217,17 +1671,20 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
-    func enumerateInteractions(range: NSRange, transaction: GRDBReadTransaction, block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) throws {
-        let sql = """
+    private static let interactionsInRangeSql = """
         SELECT *
         FROM \(InteractionRecord.databaseTableName)
         WHERE \(interactionColumn: .threadUniqueId) = ?
         ORDER BY \(interactionColumn: .id)
-        LIMIT \(range.length)
-        OFFSET \(range.location)
+        LIMIT ?
+        OFFSET ?
         """
-        let arguments: StatementArguments = [threadUniqueId]
-        let cursor = TSInteraction.grdbFetchCursor(sql: sql,
+
+    func enumerateInteractions(range: NSRange, transaction: GRDBReadTransaction, block: @escaping (TSInteraction, UnsafeMutablePointer<ObjCBool>) -> Void) throws {
+        // Bind the range, rather than interpolating it, so that every
+        // range shares one prepared statement.
+        let arguments: StatementArguments = [threadUniqueId, range.length, range.location]
+        let cursor = TSInteraction.grdbFetchCursor(sql: Self.interactionsInRangeSql,
                                                    arguments: arguments,
                                                    transaction: transaction)
 
@@ -1240,19 +1697,20 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
-    func interactionIds(inRange range: NSRange, transaction: GRDBReadTransaction) throws -> [String] {
-        let sql = """
+    private static let interactionIdsInRangeSql = """
         SELECT \(interactionColumn: .uniqueId)
         FROM \(InteractionRecord.databaseTableName)
         WHERE \(interactionColumn: .threadUniqueId) = ?
         ORDER BY \(interactionColumn: .id)
-        LIMIT \(range.length)
-        OFFSET \(range.location)
+        LIMIT ?
+        OFFSET ?
         """
-        let arguments: StatementArguments = [threadUniqueId]
-        return try String.fetchAll(transaction.database,
-                                   sql: sql,
-                                   arguments: arguments)
+
+    func interactionIds(inRange range: NSRange, transaction: GRDBReadTransaction) throws -> [String] {
+        let request = SQLRequest<String>(sql: Self.interactionIdsInRangeSql,
+                                         arguments: [threadUniqueId, range.length, range.location],
+                                         cached: true)
+        return try String.fetchAll(transaction.database, request)
     }
 
     @objc
@@ -1290,8 +1748,7 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         }
     }
 
-    func interaction(at index: UInt, transaction: GRDBReadTransaction) throws -> TSInteraction? {
-        let sql = """
+    private static let interactionAtIndexSql = """
         SELECT *
         FROM \(InteractionRecord.databaseTableName)
         WHERE \(interactionColumn: .threadUniqueId) = ?
@@ -1299,8 +1756,10 @@ public class GRDBInteractionFinder: NSObject, InteractionFinderAdapter {
         LIMIT 1
         OFFSET ?
         """
+
+    func interaction(at index: UInt, transaction: GRDBReadTransaction) throws -> TSInteraction? {
         let arguments: StatementArguments = [threadUniqueId, index]
-        return TSInteraction.grdbFetchOne(sql: sql, arguments: arguments, transaction: transaction)
+        return TSInteraction.grdbFetchOne(sql: Self.interactionAtIndexSql, arguments: arguments, transaction: transaction)
     }
 
     func firstInteraction(atOrAroundSortId sortId: UInt64, transaction: GRDBReadTransaction) -> TSInteraction? {
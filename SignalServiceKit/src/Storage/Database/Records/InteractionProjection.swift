@@ -0,0 +1,102 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+/// A partial interaction record, for callers which only need a few columns.
+///
+/// Building a TSInteraction decodes every column of its row, including archived
+/// blobs like the quoted message and the link preview. A projection only fetches
+/// the columns it was asked for, and only unarchives a blob column when it is
+/// accessed.
+public struct InteractionProjection {
+
+    public typealias Column = InteractionRecord.CodingKeys
+
+    private let row: Row
+
+    private init(row: Row) {
+        self.row = row
+    }
+
+    public func value<T: DatabaseValueConvertible>(_ column: Column) -> T? {
+        row[column.rawValue]
+    }
+
+    /// Unarchives a blob column. The result isn't cached, so callers which need
+    /// a value more than once should hold onto it.
+    public func unarchivedValue<T>(_ column: Column) throws -> T? {
+        let encoded: Data? = row[column.rawValue]
+        return try SDSDeserialization.optionalUnarchive(encoded, name: column.rawValue)
+    }
+
+    // MARK: -
+
+    /// Enumerates projections of the interactions matching the SQL which follows
+    /// the FROM clause, e.g. "WHERE ... ORDER BY ...".
+    static func enumerate(columns: [Column],
+                          sqlSuffix: String,
+                          arguments: StatementArguments = StatementArguments(),
+                          transaction: GRDBReadTransaction,
+                          block: (InteractionProjection, UnsafeMutablePointer<ObjCBool>) throws -> Void) throws {
+        owsAssertDebug(!columns.isEmpty)
+
+        let sql = """
+            SELECT \(columns.map { $0.rawValue }.joined(separator: ", "))
+            FROM \(InteractionRecord.databaseTableName)
+            \(sqlSuffix)
+            """
+        let cursor = try Row.fetchCursor(transaction.database, sql: sql, arguments: arguments)
+        while let row = try cursor.next() {
+            var stop: ObjCBool = false
+            // Cursors reuse their rows; this only copies the projected columns.
+            try block(InteractionProjection(row: row.copy()), &stop)
+            if stop.boolValue {
+                return
+            }
+        }
+    }
+}
+
+// MARK: - Attachments
+
+extension InteractionProjection {
+
+    /// The columns needed by allAttachmentIds().
+    static let attachmentIdColumns: [Column] = [
+        .attachmentIds,
+        .quotedMessage,
+        .contactShare,
+        .linkPreview,
+        .messageSticker
+    ]
+
+    /// Mirrors -[TSMessage allAttachmentIds].
+    func allAttachmentIds() throws -> [String] {
+        var result = [String]()
+        if let attachmentIds: [String] = try unarchivedValue(.attachmentIds) {
+            result += attachmentIds
+        }
+        if let quotedMessage: TSQuotedMessage = try unarchivedValue(.quotedMessage) {
+            result += quotedMessage.thumbnailAttachmentStreamIds()
+            if let thumbnailAttachmentPointerId = quotedMessage.thumbnailAttachmentPointerId() {
+                result.append(thumbnailAttachmentPointerId)
+            }
+        }
+        if let contactShare: OWSContact = try unarchivedValue(.contactShare),
+           let avatarAttachmentId = contactShare.avatarAttachmentId {
+            result.append(avatarAttachmentId)
+        }
+        if let linkPreview: OWSLinkPreview = try unarchivedValue(.linkPreview),
+           let imageAttachmentId = linkPreview.imageAttachmentId {
+            result.append(imageAttachmentId)
+        }
+        if let messageSticker: MessageSticker = try unarchivedValue(.messageSticker) {
+            result.append(messageSticker.attachmentId)
+        }
+        // De-duplicate the result.
+        return Array(Set(result))
+    }
+}
@@ -0,0 +1,122 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+@objc
+public class OrphanRecordSlice: NSObject {
+
+    // The unique ids of the orphaned records in this slice.
+    @objc
+    public let orphanUniqueIds: [String]
+
+    // The row id of the last record in this slice, or nil if
+    // there were no records after the cursor.
+    @objc
+    public let lastRowId: NSNumber?
+
+    init(orphanUniqueIds: [String], lastRowId: Int64?) {
+        self.orphanUniqueIds = orphanUniqueIds
+        self.lastRowId = lastRowId.map { NSNumber(value: $0) }
+    }
+}
+
+// MARK: -
+
+/// Finds orphaned records a bounded slice at a time, in row id order,
+/// so that the orphan data cleaner can resume where it left off.
+@objc
+public class OrphanRecordFinder: NSObject {
+
+    /// Interactions whose thread no longer exists.
+    @objc
+    public class func orphanInteractionSlice(afterRowId: Int64,
+                                             limit: Int,
+                                             transaction: GRDBReadTransaction) -> OrphanRecordSlice {
+        let sql = """
+        SELECT interaction.\(interactionColumn: .id),
+               interaction.\(interactionColumn: .uniqueId),
+               NOT EXISTS (
+                   SELECT 1
+                   FROM \(ThreadRecord.databaseTableName) AS thread
+                   WHERE thread.\(threadColumn: .uniqueId) = interaction.\(interactionColumn: .threadUniqueId)
+               )
+        FROM \(InteractionRecord.databaseTableName) AS interaction
+        WHERE interaction.\(interactionColumn: .id) > ?
+        ORDER BY interaction.\(interactionColumn: .id)
+        LIMIT ?
+        """
+        return fetchSlice(sql: sql, afterRowId: afterRowId, limit: limit, transaction: transaction)
+    }
+
+    /// Reactions whose message no longer exists.
+    @objc
+    public class func orphanReactionSlice(afterRowId: Int64,
+                                          limit: Int,
+                                          transaction: GRDBReadTransaction) -> OrphanRecordSlice {
+        let sql = """
+        SELECT reaction.\(reactionColumn: .id),
+               reaction.\(reactionColumn: .uniqueId),
+               NOT EXISTS (
+                   SELECT 1
+                   FROM \(InteractionRecord.databaseTableName) AS interaction
+                   WHERE interaction.\(interactionColumn: .uniqueId) = reaction.\(reactionColumn: .uniqueMessageId)
+               )
+        FROM \(ReactionRecord.databaseTableName) AS reaction
+        WHERE reaction.\(reactionColumn: .id) > ?
+        ORDER BY reaction.\(reactionColumn: .id)
+        LIMIT ?
+        """
+        return fetchSlice(sql: sql, afterRowId: afterRowId, limit: limit, transaction: transaction)
+    }
+
+    /// Mentions whose message no longer exists.
+    @objc
+    public class func orphanMentionSlice(afterRowId: Int64,
+                                         limit: Int,
+                                         transaction: GRDBReadTransaction) -> OrphanRecordSlice {
+        let sql = """
+        SELECT mention.\(mentionColumn: .id),
+               mention.\(mentionColumn: .uniqueId),
+               NOT EXISTS (
+                   SELECT 1
+                   FROM \(InteractionRecord.databaseTableName) AS interaction
+                   WHERE interaction.\(interactionColumn: .uniqueId) = mention.\(mentionColumn: .uniqueMessageId)
+               )
+        FROM \(MentionRecord.databaseTableName) AS mention
+        WHERE mention.\(mentionColumn: .id) > ?
+        ORDER BY mention.\(mentionColumn: .id)
+        LIMIT ?
+        """
+        return fetchSlice(sql: sql, afterRowId: afterRowId, limit: limit, transaction: transaction)
+    }
+
+    private class func fetchSlice(sql: String,
+                                  afterRowId: Int64,
+                                  limit: Int,
+                                  transaction: GRDBReadTransaction) -> OrphanRecordSlice {
+        var orphanUniqueIds = [String]()
+        var lastRowId: Int64?
+        do {
+            let cursor = try Row.fetchCursor(transaction.database,
+                                             sql: sql,
+                                             arguments: [afterRowId, limit])
+            while let row = try cursor.next() {
+                let rowId: Int64 = row[0]
+                let uniqueId: String = row[1]
+                let isOrphan: Bool = row[2]
+                if isOrphan {
+                    orphanUniqueIds.append(uniqueId)
+                }
+                lastRowId = rowId
+            }
+        } catch {
+            owsFailDebug("Error: \(error)")
+            // Stop this lap rather than skipping records.
+            return OrphanRecordSlice(orphanUniqueIds: [], lastRowId: nil)
+        }
+        return OrphanRecordSlice(orphanUniqueIds: orphanUniqueIds, lastRowId: lastRowId)
+    }
+}
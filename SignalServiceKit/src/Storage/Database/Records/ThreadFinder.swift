@@ -166,16 +166,19 @@ public class GRDBThreadFinder: NSObject, ThreadFinder {
 
     static let cn = ThreadRecord.columnName
 
-    public func visibleThreadCount(isArchived: Bool, transaction: GRDBReadTransaction) throws -> UInt {
-        let sql = """
+    // The conversation list runs these queries constantly, so we build their
+    // SQL once and reuse each connection's prepared statements for them.
+
+    private static let visibleThreadCountSql = """
             SELECT COUNT(*)
             FROM \(ThreadRecord.databaseTableName)
             WHERE \(threadColumn: .shouldThreadBeVisible) = 1
             AND \(threadColumn: .isArchived) = ?
         """
-        let arguments: StatementArguments = [isArchived]
 
-        guard let count = try UInt.fetchOne(transaction.database, sql: sql, arguments: arguments) else {
+    public func visibleThreadCount(isArchived: Bool, transaction: GRDBReadTransaction) throws -> UInt {
+        let request = SQLRequest<UInt>(sql: Self.visibleThreadCountSql, arguments: [isArchived], cached: true)
+        guard let count = try UInt.fetchOne(transaction.database, request) else {
             owsFailDebug("count was unexpectedly nil")
             return 0
         }
@@ -183,39 +186,37 @@ public class GRDBThreadFinder: NSObject, ThreadFinder {
         return count
     }
 
-    @objc
-    public func enumerateVisibleThreads(isArchived: Bool, transaction: GRDBReadTransaction, block: @escaping (TSThread) -> Void) throws {
-        let sql = """
+    private static let visibleThreadsSql = """
             SELECT *
             FROM \(ThreadRecord.databaseTableName)
             WHERE \(threadColumn: .shouldThreadBeVisible) = 1
             AND \(threadColumn: .isArchived) = ?
             ORDER BY \(threadColumn: .lastInteractionRowId) DESC
             """
-        let arguments: StatementArguments = [isArchived]
 
-        try ThreadRecord.fetchCursor(transaction.database, sql: sql, arguments: arguments).forEach { threadRecord in
+    @objc
+    public func enumerateVisibleThreads(isArchived: Bool, transaction: GRDBReadTransaction, block: @escaping (TSThread) -> Void) throws {
+        let request = SQLRequest<ThreadRecord>(sql: Self.visibleThreadsSql, arguments: [isArchived], cached: true)
+        try ThreadRecord.fetchCursor(transaction.database, request).forEach { threadRecord in
             block(try TSThread.fromRecord(threadRecord))
         }
     }
 
-    @objc
-    public func visibleThreadIds(isArchived: Bool, transaction: GRDBReadTransaction) throws -> [String] {
-        let sql = """
+    private static let visibleThreadIdsSql = """
         SELECT \(threadColumn: .uniqueId)
         FROM \(ThreadRecord.databaseTableName)
         WHERE \(threadColumn: .shouldThreadBeVisible) = 1
         AND \(threadColumn: .isArchived) = ?
         ORDER BY \(threadColumn: .lastInteractionRowId) DESC
         """
-        let arguments: StatementArguments = [isArchived]
-        return try String.fetchAll(transaction.database,
-                                   sql: sql,
-                                   arguments: arguments)
+
+    @objc
+    public func visibleThreadIds(isArchived: Bool, transaction: GRDBReadTransaction) throws -> [String] {
+        let request = SQLRequest<String>(sql: Self.visibleThreadIdsSql, arguments: [isArchived], cached: true)
+        return try String.fetchAll(transaction.database, request)
     }
 
-    public func sortIndex(thread: TSThread, transaction: GRDBReadTransaction) throws -> UInt? {
-        let sql = """
+    private static let sortIndexSql = """
         SELECT sortIndex
         FROM (
             SELECT
@@ -226,12 +227,14 @@ public class GRDBThreadFinder: NSObject, ThreadFinder {
         )
         WHERE \(threadColumn: .id) = ?
         """
+
+    public func sortIndex(thread: TSThread, transaction: GRDBReadTransaction) throws -> UInt? {
         guard let grdbId = thread.grdbId, grdbId.intValue > 0 else {
             throw OWSAssertionError("grdbId was unexpectedly nil")
         }
 
-        let arguments: StatementArguments = [grdbId.intValue]
-        return try UInt.fetchOne(transaction.database, sql: sql, arguments: arguments)
+        let request = SQLRequest<UInt>(sql: Self.sortIndexSql, arguments: [grdbId.intValue], cached: true)
+        return try UInt.fetchOne(transaction.database, request)
     }
 
     @objc
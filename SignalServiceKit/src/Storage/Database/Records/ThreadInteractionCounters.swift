@@ -0,0 +1,207 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+/// Per-thread interaction and unread counts, so that the conversation list
+/// and the badge don't need to count interactions.
+///
+/// The counters are maintained by triggers on the interactions table, so they
+/// stay correct for every insert, update and delete, including bulk deletes
+/// which bypass the models. verifyAndRepair() rebuilds them if they drift.
+@objc
+public class ThreadInteractionCounters: NSObject {
+
+    public static let databaseTableName = "thread_interaction_counters"
+
+    // MARK: - Schema
+
+    // Whether the interaction row (e.g. "NEW" or "OLD" in a trigger) counts as unread.
+    // This must match InteractionFinder.sqlClauseForUnreadInteractionCounts().
+    private static func isUnreadSql(_ row: String) -> String {
+        "(\(InteractionFinder.sqlClauseForUnreadInteractionCounts(interactionsAlias: row)))"
+    }
+
+    private static func incrementSql(_ row: String) -> String {
+        """
+        INSERT OR IGNORE INTO \(databaseTableName) (threadUniqueId)
+        VALUES (\(row).\(interactionColumn: .threadUniqueId));
+        UPDATE \(databaseTableName)
+        SET interactionCount = interactionCount + 1,
+            unreadCount = unreadCount + \(isUnreadSql(row))
+        WHERE threadUniqueId = \(row).\(interactionColumn: .threadUniqueId);
+        """
+    }
+
+    private static func decrementSql(_ row: String) -> String {
+        """
+        UPDATE \(databaseTableName)
+        SET interactionCount = interactionCount - 1,
+            unreadCount = unreadCount - \(isUnreadSql(row))
+        WHERE threadUniqueId = \(row).\(interactionColumn: .threadUniqueId);
+        """
+    }
+
+    static var createTableAndTriggersSql: String {
+        let interactionTable = InteractionRecord.databaseTableName
+        // Models are always saved in full, so the update trigger checks
+        // whether the values it cares about actually changed.
+        return """
+        CREATE TABLE \(databaseTableName) (
+            threadUniqueId TEXT PRIMARY KEY NOT NULL,
+            interactionCount INTEGER NOT NULL DEFAULT 0,
+            unreadCount INTEGER NOT NULL DEFAULT 0
+        );
+
+        CREATE TRIGGER \(databaseTableName)_on_insert
+        AFTER INSERT ON \(interactionTable)
+        BEGIN
+            \(incrementSql("NEW"))
+        END;
+
+        CREATE TRIGGER \(databaseTableName)_on_delete
+        AFTER DELETE ON \(interactionTable)
+        BEGIN
+            \(decrementSql("OLD"))
+        END;
+
+        CREATE TRIGGER \(databaseTableName)_on_update
+        AFTER UPDATE OF \(interactionColumn: .threadUniqueId), \(interactionColumn: .read), \(interactionColumn: .recordType), \(interactionColumn: .messageType)
+        ON \(interactionTable)
+        WHEN OLD.\(interactionColumn: .threadUniqueId) IS NOT NEW.\(interactionColumn: .threadUniqueId)
+        OR OLD.\(interactionColumn: .read) IS NOT NEW.\(interactionColumn: .read)
+        OR OLD.\(interactionColumn: .recordType) IS NOT NEW.\(interactionColumn: .recordType)
+        OR OLD.\(interactionColumn: .messageType) IS NOT NEW.\(interactionColumn: .messageType)
+        BEGIN
+            \(decrementSql("OLD"))
+            \(incrementSql("NEW"))
+        END;
+        """
+    }
+
+    private static var rebuildSql: String {
+        """
+        DELETE FROM \(databaseTableName);
+        INSERT INTO \(databaseTableName) (threadUniqueId, interactionCount, unreadCount)
+        SELECT interaction.\(interactionColumn: .threadUniqueId),
+               COUNT(*),
+               SUM(\(isUnreadSql("interaction")))
+        FROM \(InteractionRecord.databaseTableName) AS interaction
+        GROUP BY interaction.\(interactionColumn: .threadUniqueId);
+        """
+    }
+
+    static func rebuild(database: Database) throws {
+        try database.execute(sql: rebuildSql)
+    }
+
+    // MARK: - Counts
+
+    private static let interactionCountSql = """
+        SELECT interactionCount
+        FROM \(databaseTableName)
+        WHERE threadUniqueId = ?
+        """
+
+    private static let unreadCountSql = """
+        SELECT unreadCount
+        FROM \(databaseTableName)
+        WHERE threadUniqueId = ?
+        """
+
+    private static let unreadCountInAllThreadsSql = """
+        SELECT COALESCE(SUM(unreadCount), 0)
+        FROM \(databaseTableName)
+        """
+
+    private static let unreadCountInUnmutedThreadsSql = """
+        SELECT COALESCE(SUM(counters.unreadCount), 0)
+        FROM \(databaseTableName) AS counters
+        INNER JOIN \(ThreadRecord.databaseTableName) AS thread
+        ON counters.threadUniqueId = thread.\(threadColumn: .uniqueId)
+        AND (
+            thread.\(threadColumn: .mutedUntilDate) <= strftime('%s','now')
+            OR thread.\(threadColumn: .mutedUntilDate) IS NULL
+        )
+        """
+
+    private static func fetchCount(sql: String,
+                                   arguments: StatementArguments = StatementArguments(),
+                                   transaction: GRDBReadTransaction) throws -> UInt {
+        let request = SQLRequest<UInt>(sql: sql, arguments: arguments, cached: true)
+        // Threads without interactions may not have counters yet.
+        return try UInt.fetchOne(transaction.database, request) ?? 0
+    }
+
+    public static func interactionCount(threadUniqueId: String, transaction: GRDBReadTransaction) throws -> UInt {
+        try fetchCount(sql: interactionCountSql, arguments: [threadUniqueId], transaction: transaction)
+    }
+
+    public static func unreadCount(threadUniqueId: String, transaction: GRDBReadTransaction) throws -> UInt {
+        try fetchCount(sql: unreadCountSql, arguments: [threadUniqueId], transaction: transaction)
+    }
+
+    public static func unreadCountInAllThreads(includeMutedThreads: Bool, transaction: GRDBReadTransaction) throws -> UInt {
+        let sql = includeMutedThreads ? unreadCountInAllThreadsSql : unreadCountInUnmutedThreadsSql
+        return try fetchCount(sql: sql, transaction: transaction)
+    }
+
+    // MARK: - Repair
+
+    private struct Counts: Equatable {
+        let interactionCount: Int64
+        let unreadCount: Int64
+    }
+
+    /// Compares the counters with the interactions table and rebuilds them if they've drifted.
+    ///
+    /// Returns the number of threads whose counters were wrong.
+    @objc
+    @discardableResult
+    public static func verifyAndRepair(transaction: GRDBWriteTransaction) -> Int {
+        do {
+            let expectedSql = """
+                SELECT interaction.\(interactionColumn: .threadUniqueId),
+                       COUNT(*),
+                       SUM(\(isUnreadSql("interaction")))
+                FROM \(InteractionRecord.databaseTableName) AS interaction
+                GROUP BY interaction.\(interactionColumn: .threadUniqueId)
+                """
+            var expectedCounts = [String: Counts]()
+            let expectedCursor = try Row.fetchCursor(transaction.database, sql: expectedSql)
+            while let row = try expectedCursor.next() {
+                expectedCounts[row[0]] = Counts(interactionCount: row[1], unreadCount: row[2])
+            }
+
+            let actualSql = """
+                SELECT threadUniqueId, interactionCount, unreadCount
+                FROM \(databaseTableName)
+                """
+            var driftedThreadCount = 0
+            var verifiedThreadUniqueIds = Set<String>()
+            let actualCursor = try Row.fetchCursor(transaction.database, sql: actualSql)
+            while let row = try actualCursor.next() {
+                let threadUniqueId: String = row[0]
+                let actualCounts = Counts(interactionCount: row[1], unreadCount: row[2])
+                let threadExpectedCounts = expectedCounts[threadUniqueId] ?? Counts(interactionCount: 0, unreadCount: 0)
+                if actualCounts != threadExpectedCounts {
+                    driftedThreadCount += 1
+                }
+                verifiedThreadUniqueIds.insert(threadUniqueId)
+            }
+            driftedThreadCount += Set(expectedCounts.keys).subtracting(verifiedThreadUniqueIds).count
+
+            guard driftedThreadCount > 0 else {
+                return 0
+            }
+            Logger.warn("Rebuilding counters for \(driftedThreadCount) threads.")
+            try rebuild(database: transaction.database)
+            return driftedThreadCount
+        } catch {
+            owsFailDebug("Error: \(error)")
+            return 0
+        }
+    }
+}
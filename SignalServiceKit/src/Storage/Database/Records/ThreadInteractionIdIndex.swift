@@ -0,0 +1,152 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+/// An in-memory copy of the ordered interaction ids of a single thread.
+///
+/// Conversation view loads need to map between an interaction's position in
+/// the thread and its id. Asking the database for that costs an OFFSET query
+/// or a count per lookup, which gets slower the further the user scrolls from
+/// the newest message. The index loads the ids once, then brings itself up to
+/// date on each load by fetching only the rows inserted since.
+///
+/// Rows are only ever appended to a thread in order, since interaction row
+/// ids are auto-incremented. Deletions are applied with didDeleteInteractions().
+/// If the index ever disagrees with the thread's interaction counter, e.g.
+/// because another process deleted interactions, it reloads itself.
+///
+/// This class isn't thread-safe; each conversation view should use its own.
+public class ThreadInteractionIdIndex {
+
+    public let threadUniqueId: String
+
+    // Parallel arrays, in sort order.
+    private var rowIds = [Int64]()
+    private var uniqueIds = [String]()
+    private var rowIdMap = [String: Int64]()
+
+    private var isLoaded = false
+
+    public init(threadUniqueId: String) {
+        self.threadUniqueId = threadUniqueId
+    }
+
+    public var count: Int {
+        owsAssertDebug(isLoaded)
+        return uniqueIds.count
+    }
+
+    // MARK: - Updates
+
+    /// Removes deleted interactions from the index. Ids of interactions
+    /// in other threads are ignored.
+    public func didDeleteInteractions(uniqueIds deletedUniqueIds: Set<String>) {
+        guard isLoaded, !deletedUniqueIds.isEmpty else {
+            return
+        }
+        var deletedRowIds = Set<Int64>()
+        for uniqueId in deletedUniqueIds {
+            if let rowId = rowIdMap.removeValue(forKey: uniqueId) {
+                deletedRowIds.insert(rowId)
+            }
+        }
+        guard !deletedRowIds.isEmpty else {
+            return
+        }
+        var keptRowIds = [Int64]()
+        var keptUniqueIds = [String]()
+        keptRowIds.reserveCapacity(rowIds.count - deletedRowIds.count)
+        keptUniqueIds.reserveCapacity(rowIds.count - deletedRowIds.count)
+        for (rowId, uniqueId) in zip(rowIds, uniqueIds) where !deletedRowIds.contains(rowId) {
+            keptRowIds.append(rowId)
+            keptUniqueIds.append(uniqueId)
+        }
+        rowIds = keptRowIds
+        uniqueIds = keptUniqueIds
+    }
+
+    /// Discards the index; the next update reloads it.
+    public func reset() {
+        isLoaded = false
+        rowIds = []
+        uniqueIds = []
+        rowIdMap = [:]
+    }
+
+    private static let idsAfterRowIdSql = """
+        SELECT \(interactionColumn: .id), \(interactionColumn: .uniqueId)
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .threadUniqueId) = ?
+        AND \(interactionColumn: .id) > ?
+        ORDER BY \(interactionColumn: .id)
+        """
+
+    /// Fetches any interactions inserted since the last update, and reloads
+    /// the index if it's missing or has drifted from the database.
+    public func update(transaction: GRDBReadTransaction) throws {
+        if isLoaded {
+            try appendRows(transaction: transaction)
+            let expectedCount = try ThreadInteractionCounters.interactionCount(threadUniqueId: threadUniqueId,
+                                                                               transaction: transaction)
+            guard Int(expectedCount) != uniqueIds.count else {
+                return
+            }
+            Logger.info("Reloading; expected \(expectedCount) interactions, have \(uniqueIds.count).")
+            reset()
+        }
+        try appendRows(transaction: transaction)
+        isLoaded = true
+    }
+
+    private func appendRows(transaction: GRDBReadTransaction) throws {
+        let request = SQLRequest<Row>(sql: Self.idsAfterRowIdSql,
+                                      arguments: [threadUniqueId, rowIds.last ?? 0],
+                                      cached: true)
+        let cursor = try Row.fetchCursor(transaction.database, request)
+        while let row = try cursor.next() {
+            let rowId: Int64 = row[0]
+            let uniqueId: String = row[1]
+            rowIds.append(rowId)
+            uniqueIds.append(uniqueId)
+            rowIdMap[uniqueId] = rowId
+        }
+    }
+
+    // MARK: - Lookups
+
+    /// The position of the interaction in the thread, oldest first.
+    public func sortIndex(interactionUniqueId: String) -> Int? {
+        owsAssertDebug(isLoaded)
+        guard let rowId = rowIdMap[interactionUniqueId] else {
+            return nil
+        }
+        // rowIds is sorted, so we can binary search it.
+        var lowerBound = 0
+        var upperBound = rowIds.count
+        while lowerBound < upperBound {
+            let middle = (lowerBound + upperBound) / 2
+            if rowIds[middle] < rowId {
+                lowerBound = middle + 1
+            } else {
+                upperBound = middle
+            }
+        }
+        guard lowerBound < rowIds.count, rowIds[lowerBound] == rowId else {
+            owsFailDebug("Missing rowId.")
+            return nil
+        }
+        return lowerBound
+    }
+
+    /// The ids of the interactions in the range, oldest first. Like
+    /// OFFSET and LIMIT, the range is clamped to the thread.
+    public func interactionIds(inRange range: NSRange) -> [String] {
+        owsAssertDebug(isLoaded)
+        let lowerBound = min(max(0, range.location), uniqueIds.count)
+        let upperBound = min(max(lowerBound, range.location + range.length), uniqueIds.count)
+        return Array(uniqueIds[lowerBound..<upperBound])
+    }
+}
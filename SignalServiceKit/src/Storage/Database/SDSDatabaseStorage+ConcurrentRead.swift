@@ -0,0 +1,309 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// MARK: - Concurrent Reads
+
+public extension SDSDatabaseStorage {
+
+    // GRDB's pool has 10 reader connections. We leave some of them free
+    // for uiReads and for the other reads on background threads.
+    static let maxConcurrentReadCount = 4
+
+    private static let concurrentReadQueue: OperationQueue = {
+        let operationQueue = OperationQueue()
+        operationQueue.name = "SDSDatabaseStorage.concurrentRead"
+        operationQueue.maxConcurrentOperationCount = maxConcurrentReadCount
+        operationQueue.qualityOfService = .userInitiated
+        return operationQueue
+    }()
+
+    /// Runs a batch of independent reads concurrently, off the main thread.
+    ///
+    /// Each block runs in its own read transaction on a separate reader
+    /// connection, so each block sees a consistent snapshot of the database,
+    /// but two blocks may see different snapshots if a write commits while
+    /// the batch is running. Blocks which need to see the same snapshot should
+    /// be combined into one block.
+    ///
+    /// The results are in the same order as the blocks.
+    func concurrentRead<T>(_: PMKNamespacer, _ blocks: [(SDSAnyReadTransaction) -> T]) -> Promise<[T]> {
+        guard !blocks.isEmpty else {
+            return Promise.value([])
+        }
+
+        return Promise { resolver in
+            let unfairLock = UnfairLock()
+            var results = [T?](repeating: nil, count: blocks.count)
+
+            let group = DispatchGroup()
+            for (index, block) in blocks.enumerated() {
+                group.enter()
+                Self.concurrentReadQueue.addOperation {
+                    var result: T!
+                    self.read { transaction in
+                        result = block(transaction)
+                    }
+                    unfairLock.withLock {
+                        results[index] = result
+                    }
+                    group.leave()
+                }
+            }
+            group.notify(queue: .global()) {
+                let completedResults: [T] = unfairLock.withLock {
+                    results.map { $0! }
+                }
+                resolver.fulfill(completedResults)
+            }
+        }
+    }
+
+    /// For Obj-C callers: runs the block once per item, concurrently and
+    /// off the main thread, as with `concurrentRead(_:_:)`. The completion
+    /// runs on the main thread once the block has run for every item.
+    @objc
+    func concurrentRead(items: [Any],
+                        block: @escaping (Any, SDSAnyReadTransaction) -> Void,
+                        completion: @escaping () -> Void) {
+        let blocks: [(SDSAnyReadTransaction) -> Void] = items.map { item in
+            { transaction in block(item, transaction) }
+        }
+        concurrentRead(.promise, blocks).done { _ in
+            completion()
+        }.cauterize()
+    }
+}
+
+// MARK: - Main Thread Reads
+
+/// A call site which opened transactions on the main thread that took
+/// longer than MainThreadReadMonitor's budget.
+public struct MainThreadTransactionOffender {
+    public let callSite: String
+    public let isWrite: Bool
+    public fileprivate(set) var count: UInt64 = 0
+    public fileprivate(set) var totalDuration: TimeInterval = 0
+    public fileprivate(set) var maxDuration: TimeInterval = 0
+    // The stack of the slowest of these transactions.
+    public fileprivate(set) var stack: [String] = []
+}
+
+// MARK: -
+
+/// Measures how much time the main thread spends inside read transactions.
+///
+/// Every read on the main thread delays the next frame, so these numbers are
+/// a decent proxy for how much our reads contribute to scrolling hitches.
+///
+/// Read and write transactions on the main thread which take longer than
+/// the budget are also aggregated by call site, with a sample stack, so
+/// that we can find the worst offenders, e.g. "...WithSneakyTransaction"
+/// methods which are called from the main thread.
+@objc
+public class MainThreadReadMonitor: NSObject {
+
+    @objc
+    public static let shared = MainThreadReadMonitor()
+
+    // Transactions longer than a frame are logged individually.
+    private static let slowReadThreshold: TimeInterval = 1 / 60.0
+    private static let summaryInterval: TimeInterval = 60
+    private static let maxOffenderCount = 100
+    private static let maxStackDepth = 24
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+    private var readCount: UInt64 = 0
+    private var readDuration: TimeInterval = 0
+    private var slowReadCount: UInt64 = 0
+    private var intervalReadCount: UInt64 = 0
+    private var intervalReadDuration: TimeInterval = 0
+    private var intervalStartTime = CACurrentMediaTime()
+    private var offenderMap = [String: MainThreadTransactionOffender]()
+
+    private override init() {
+        super.init()
+    }
+
+    /// The number of read transactions opened on the main thread.
+    @objc
+    public var mainThreadReadCount: UInt64 {
+        unfairLock.withLock { readCount }
+    }
+
+    /// The total time the main thread has spent inside read transactions.
+    @objc
+    public var mainThreadReadDuration: TimeInterval {
+        unfairLock.withLock { readDuration }
+    }
+
+    /// The number of read transactions on the main thread that took longer than a frame.
+    @objc
+    public var mainThreadSlowReadCount: UInt64 {
+        unfairLock.withLock { slowReadCount }
+    }
+
+    /// The call sites of slow main thread transactions, worst first.
+    public var offenders: [MainThreadTransactionOffender] {
+        let offenders = unfairLock.withLock { Array(offenderMap.values) }
+        return offenders.sorted { $0.totalDuration > $1.totalDuration }
+    }
+
+    @objc
+    public func resetOffenders() {
+        unfairLock.withLock {
+            offenderMap.removeAll()
+        }
+    }
+
+    /// Runs the block, measuring it if we're on the main thread.
+    func measure<T>(block: () throws -> T) rethrows -> T {
+        guard Thread.isMainThread else {
+            return try block()
+        }
+        let startTime = CACurrentMediaTime()
+        defer {
+            didRead(duration: CACurrentMediaTime() - startTime)
+        }
+        return try block()
+    }
+
+    /// Writes report their own duration, since they already have their call site.
+    func didWrite(duration: TimeInterval, callSite: String) {
+        guard Thread.isMainThread, duration > Self.slowReadThreshold else {
+            return
+        }
+        let stack = Self.captureStack()
+        didExceedBudget(duration: duration, callSite: callSite, isWrite: true, stack: stack)
+        Logger.warn(String(format: "Slow main thread write: %0.1fms, %@", duration * 1000, callSite))
+    }
+
+    private func didRead(duration: TimeInterval) {
+        let now = CACurrentMediaTime()
+        let intervalSummary: String? = unfairLock.withLock {
+            readCount += 1
+            readDuration += duration
+            intervalReadCount += 1
+            intervalReadDuration += duration
+            if duration > Self.slowReadThreshold {
+                slowReadCount += 1
+            }
+
+            let intervalDuration = now - intervalStartTime
+            guard intervalDuration >= Self.summaryInterval else {
+                return nil
+            }
+            var summary = String(format: "Main thread spent %0.1fms in %llu read transactions over the last %0.0fs.",
+                                 intervalReadDuration * 1000,
+                                 intervalReadCount,
+                                 intervalDuration)
+            if let worstOffender = offenderMap.values.max(by: { $0.totalDuration < $1.totalDuration }) {
+                summary += String(format: " Worst offender: %@ (%llu, %0.1fms).",
+                                  worstOffender.callSite,
+                                  worstOffender.count,
+                                  worstOffender.totalDuration * 1000)
+            }
+            intervalReadCount = 0
+            intervalReadDuration = 0
+            intervalStartTime = now
+            return summary
+        }
+
+        if duration > Self.slowReadThreshold {
+            // We only pay for the stack once we know the read was slow. The
+            // transaction has completed, but its caller is still on the stack.
+            let stack = Self.captureStack()
+            let callSite = Self.callSite(stack: stack)
+            didExceedBudget(duration: duration, callSite: callSite, isWrite: false, stack: stack)
+            Logger.warn(String(format: "Slow main thread read: %0.1fms, %@", duration * 1000, callSite))
+        }
+        if let intervalSummary = intervalSummary {
+            Logger.info(intervalSummary)
+        }
+    }
+
+    private func didExceedBudget(duration: TimeInterval, callSite: String, isWrite: Bool, stack: [String]) {
+        let key = (isWrite ? "write: " : "read: ") + callSite
+        unfairLock.withLock {
+            var offender = offenderMap[key]
+                ?? MainThreadTransactionOffender(callSite: callSite, isWrite: isWrite)
+            guard offenderMap[key] != nil || offenderMap.count < Self.maxOffenderCount else {
+                return
+            }
+            offender.count += 1
+            offender.totalDuration += duration
+            if duration > offender.maxDuration {
+                offender.maxDuration = duration
+                offender.stack = stack
+            }
+            offenderMap[key] = offender
+        }
+    }
+
+    // MARK: - Stacks
+
+    // Frames of the database plumbing, which we skip to find the call site.
+    private static let storageFrameMarkers = [
+        "MainThreadReadMonitor",
+        "SDSDatabaseStorage",
+        "SDSTransactable",
+        "Signposts"
+    ]
+
+    private static func captureStack() -> [String] {
+        // Drop this method's own frame.
+        Array(Thread.callStackSymbols.dropFirst().prefix(maxStackDepth))
+    }
+
+    private static func callSite(stack: [String]) -> String {
+        let frame = stack.first { frame in
+            !storageFrameMarkers.contains { frame.contains($0) }
+        }
+        guard let callSiteFrame = frame else {
+            return "Unknown"
+        }
+        return symbol(frame: callSiteFrame)
+    }
+
+    // Frames look like "3   SignalServiceKit   0x0000000104a5c3f4 -[OWSContactsManager ...] + 120".
+    private static func symbol(frame: String) -> String {
+        let components = frame.split(separator: " ", omittingEmptySubsequences: true)
+        guard components.count > 3 else {
+            return frame
+        }
+        return components.dropFirst(3).joined(separator: " ")
+    }
+
+    // MARK: - Report
+
+    /// A plain text report of the offenders, worst first.
+    @objc
+    public var offendersReport: String {
+        let offenders = self.offenders
+        guard !offenders.isEmpty else {
+            return "No main thread transactions have exceeded the budget."
+        }
+        var lines = [String]()
+        lines.append(String(format: "Main thread transactions longer than %0.1fms, by call site:",
+                            Self.slowReadThreshold * 1000))
+        for (index, offender) in offenders.enumerated() {
+            lines.append("")
+            lines.append(String(format: "%ld. %@ %@: %llu, total %0.1fms, max %0.1fms",
+                                index + 1,
+                                offender.isWrite ? "Write" : "Read",
+                                offender.callSite,
+                                offender.count,
+                                offender.totalDuration * 1000,
+                                offender.maxDuration * 1000))
+            for frame in offender.stack {
+                lines.append("    " + frame)
+            }
+        }
+        return lines.joined(separator: "\n")
+    }
+}
@@ -28,6 +28,12 @@ public class SDSDatabaseStorage: SDSTransactable {
 
     private let crossProcess = SDSCrossProcess()
 
+    @objc
+    public let commitRateMonitor = DatabaseCommitRateMonitor()
+
+    @objc
+    public private(set) var writeCoalescer: SDSWriteCoalescer!
+
     // MARK: - Initialization / Setup
 
     @objc
@@ -54,7 +60,9 @@ public class SDSDatabaseStorage: SDSTransactable {
         if let storage = _grdbStorage {
             return storage
         } else {
+            LaunchTimer.shared.begin(.storageOpen)
             let storage = createGrdbStorage()
+            LaunchTimer.shared.end(.storageOpen)
             _grdbStorage = storage
             return storage
         }
@@ -66,6 +74,8 @@ public class SDSDatabaseStorage: SDSTransactable {
 
         super.init()
 
+        writeCoalescer = SDSWriteCoalescer(databaseStorage: self)
+
         addObservers()
     }
 
@@ -424,23 +434,30 @@ public class SDSDatabaseStorage: SDSTransactable {
     private func postCrossProcessNotification() {
         Logger.info("")
 
-        // TODO: The observers of this notification will inevitably do
-        //       expensive work.  It'd be nice to only fire this event
-        //       if this had any effect, if the state of the database
-        //       has changed.
+        // Most (all?) cross process write notifications will be delivered to
+        // the main app while it is inactive. By de-bouncing notifications while
+        // inactive and only updating once when we become active, we skip most
+        // of the cost of observing them.
         //
-        //       In the meantime, most (all?) cross process write notifications
-        //       will be delivered to the main app while it is inactive. By
-        //       de-bouncing notifications while inactive and only updating
-        //       once when we become active, we should be able to effectively
-        //       skip most of the perf cost.
-        NotificationCenter.default.postNotificationNameAsync(SDSDatabaseStorage.didReceiveCrossProcessNotification, object: nil)
+        // The notification's object is the journaled changes, if available.
+        // Otherwise observers should discard all of their state.
+        let crossProcessChanges = CrossProcessDatabaseChanges.journal.consume()
+        NotificationCenter.default.postNotificationNameAsync(SDSDatabaseStorage.didReceiveCrossProcessNotification,
+                                                             object: crossProcessChanges)
     }
 
     // MARK: - SDSTransactable
 
     @objc
     public func uiRead(block: @escaping (SDSAnyReadTransaction) -> Void) {
+        MainThreadReadMonitor.shared.measure {
+            Signposts.measure(.databaseUIRead) {
+                uiReadUnmeasured(block: block)
+            }
+        }
+    }
+
+    private func uiReadUnmeasured(block: @escaping (SDSAnyReadTransaction) -> Void) {
         switch dataStoreForReads {
         case .grdb:
             do {
@@ -461,6 +478,53 @@ public class SDSDatabaseStorage: SDSTransactable {
 
     @objc
     public override func read(block: @escaping (SDSAnyReadTransaction) -> Void) {
+        MainThreadReadMonitor.shared.measure {
+            Signposts.measure(.databaseRead) {
+                readUnmeasured(block: block)
+            }
+        }
+    }
+
+    /// Performs a read whose models aren't added to the model read caches.
+    ///
+    /// See SDSAnyReadTransaction.performBulkScan(_:).
+    @objc
+    public func bulkScanRead(block: @escaping (SDSAnyReadTransaction) -> Void) {
+        read { transaction in
+            transaction.performBulkScan {
+                block(transaction)
+            }
+        }
+    }
+
+    /// Like bulkScanRead(block:), but reads a private copy of the database, so
+    /// that a long scan doesn't hold a read open while writers carry on.
+    /// The block doesn't see changes made after the copy.
+    ///
+    /// Returns false if the copy couldn't be made.
+    @objc
+    public func bulkScanReadCopy(block: @escaping (SDSAnyReadTransaction) -> Void) -> Bool {
+        switch dataStoreForReads {
+        case .grdb:
+            do {
+                try grdbStorage.readCopy { transaction in
+                    let anyTransaction = transaction.asAnyRead
+                    anyTransaction.performBulkScan {
+                        block(anyTransaction)
+                    }
+                }
+                return true
+            } catch {
+                owsFailDebug("error: \(error.grdbErrorForLogging)")
+                return false
+            }
+        case .ydb:
+            bulkScanRead(block: block)
+            return true
+        }
+    }
+
+    private func readUnmeasured(block: @escaping (SDSAnyReadTransaction) -> Void) {
         switch dataStoreForReads {
         case .grdb:
             do {
@@ -489,7 +553,11 @@ public class SDSDatabaseStorage: SDSTransactable {
         }
         #endif
 
-        let benchTitle = "Slow Write Transaction \(Self.owsFormatLogMessage(file: file, function: function, line: line))"
+        let callSite = Self.owsFormatLogMessage(file: file, function: function, line: line)
+        let benchTitle = "Slow Write Transaction \(callSite)"
+        let signpostId = Signposts.begin(.databaseWrite, callSite)
+        defer { Signposts.end(.databaseWrite, signpostId) }
+        let startTime = CACurrentMediaTime()
         switch dataStoreForWrites {
         case .grdb:
             do {
@@ -508,10 +576,21 @@ public class SDSDatabaseStorage: SDSTransactable {
                 }
             }
         }
+        let duration = CACurrentMediaTime() - startTime
+        commitRateMonitor.didCommit(duration: duration)
+        MainThreadReadMonitor.shared.didWrite(duration: duration, callSite: callSite)
         crossProcess.notifyChangedAsync()
     }
 
     public func uiReadThrows(block: @escaping (SDSAnyReadTransaction) throws -> Void) throws {
+        try MainThreadReadMonitor.shared.measure {
+            try Signposts.measure(.databaseUIRead) {
+                try uiReadThrowsUnmeasured(block: block)
+            }
+        }
+    }
+
+    private func uiReadThrowsUnmeasured(block: @escaping (SDSAnyReadTransaction) throws -> Void) throws {
         switch dataStoreForReads {
         case .grdb:
             try grdbStorage.uiReadThrows { transaction in
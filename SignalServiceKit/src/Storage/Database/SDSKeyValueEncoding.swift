@@ -0,0 +1,223 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// A compact binary encoding for the common value types stored in
+// SDSKeyValueStore: numbers, strings, dates, data and arrays or sets
+// of them.
+//
+// Archiving these with NSKeyedArchiver costs far more than the values
+// themselves, both in time and in space. Values of other types are
+// still archived.
+//
+// Encoded values start with a zero byte, which distinguishes them from
+// keyed archives, which always start with "bplist".
+enum SDSKeyValueEncoding {
+
+    private static let magic: [UInt8] = [0x00, 0x01]
+
+    private enum Tag: UInt8 {
+        case bool = 1
+        case int64 = 2
+        case uint64 = 3
+        case double = 4
+        case string = 5
+        case data = 6
+        case date = 7
+        case array = 8
+        case set = 9
+    }
+
+    // MARK: - Encoding
+
+    // Returns nil if the value has a type we don't encode.
+    static func encode(_ value: Any) -> Data? {
+        var result = Data(magic)
+        guard append(value, to: &result) else {
+            return nil
+        }
+        return result
+    }
+
+    private static func append(_ value: Any, to data: inout Data) -> Bool {
+        if let number = value as? NSNumber {
+            append(number: number, to: &data)
+        } else if let string = value as? NSString {
+            let utf8 = Data((string as String).utf8)
+            data.append(Tag.string.rawValue)
+            appendVarint(UInt64(utf8.count), to: &data)
+            data.append(utf8)
+        } else if let date = value as? NSDate {
+            data.append(Tag.date.rawValue)
+            appendFixed(date.timeIntervalSinceReferenceDate.bitPattern, to: &data)
+        } else if let bytes = value as? NSData {
+            data.append(Tag.data.rawValue)
+            appendVarint(UInt64(bytes.length), to: &data)
+            data.append(bytes as Data)
+        } else if let array = value as? NSArray {
+            data.append(Tag.array.rawValue)
+            appendVarint(UInt64(array.count), to: &data)
+            for element in array {
+                guard append(element, to: &data) else {
+                    return false
+                }
+            }
+        } else if let set = value as? NSSet {
+            data.append(Tag.set.rawValue)
+            appendVarint(UInt64(set.count), to: &data)
+            for element in set {
+                guard append(element, to: &data) else {
+                    return false
+                }
+            }
+        } else {
+            return false
+        }
+        return true
+    }
+
+    private static func append(number: NSNumber, to data: inout Data) {
+        if CFGetTypeID(number) == CFBooleanGetTypeID() {
+            data.append(Tag.bool.rawValue)
+            data.append(number.boolValue ? 1 : 0)
+            return
+        }
+        switch UInt8(bitPattern: number.objCType.pointee) {
+        case UInt8(ascii: "d"), UInt8(ascii: "f"):
+            data.append(Tag.double.rawValue)
+            appendFixed(number.doubleValue.bitPattern, to: &data)
+        case UInt8(ascii: "Q"):
+            data.append(Tag.uint64.rawValue)
+            appendFixed(number.uint64Value, to: &data)
+        default:
+            data.append(Tag.int64.rawValue)
+            appendFixed(UInt64(bitPattern: number.int64Value), to: &data)
+        }
+    }
+
+    private static func appendFixed(_ value: UInt64, to data: inout Data) {
+        var littleEndian = value.littleEndian
+        withUnsafeBytes(of: &littleEndian) { data.append(contentsOf: $0) }
+    }
+
+    private static func appendVarint(_ value: UInt64, to data: inout Data) {
+        var value = value
+        while value >= 0x80 {
+            data.append(UInt8(truncatingIfNeeded: value) | 0x80)
+            value >>= 7
+        }
+        data.append(UInt8(value))
+    }
+
+    // MARK: - Decoding
+
+    static func isEncoded(_ data: Data) -> Bool {
+        return data.starts(with: magic)
+    }
+
+    static func decode(_ data: Data) throws -> Any {
+        guard isEncoded(data) else {
+            throw OWSAssertionError("Missing magic.")
+        }
+        var decoder = Decoder(bytes: [UInt8](data), offset: magic.count)
+        let value = try decoder.decodeValue()
+        guard decoder.offset == decoder.bytes.count else {
+            throw OWSAssertionError("Unexpected trailing bytes.")
+        }
+        return value
+    }
+
+    private struct Decoder {
+        let bytes: [UInt8]
+        var offset: Int
+
+        mutating func decodeValue() throws -> Any {
+            guard let tag = Tag(rawValue: try readByte()) else {
+                throw OWSAssertionError("Unknown tag.")
+            }
+            switch tag {
+            case .bool:
+                return NSNumber(value: try readByte() != 0)
+            case .int64:
+                return NSNumber(value: Int64(bitPattern: try readFixed()))
+            case .uint64:
+                return NSNumber(value: try readFixed())
+            case .double:
+                return NSNumber(value: Double(bitPattern: try readFixed()))
+            case .string:
+                let utf8 = try readBytes(count: try readLength())
+                guard let string = String(bytes: utf8, encoding: .utf8) else {
+                    throw OWSAssertionError("Invalid string.")
+                }
+                return string as NSString
+            case .data:
+                return Data(try readBytes(count: try readLength())) as NSData
+            case .date:
+                return NSDate(timeIntervalSinceReferenceDate: Double(bitPattern: try readFixed()))
+            case .array:
+                let count = try readLength()
+                var array = [Any]()
+                array.reserveCapacity(count)
+                for _ in 0..<count {
+                    array.append(try decodeValue())
+                }
+                return array as NSArray
+            case .set:
+                let count = try readLength()
+                let set = NSMutableSet(capacity: count)
+                for _ in 0..<count {
+                    set.add(try decodeValue())
+                }
+                return set.copy() as! NSSet
+            }
+        }
+
+        private mutating func readByte() throws -> UInt8 {
+            guard offset < bytes.count else {
+                throw OWSAssertionError("Unexpected end of data.")
+            }
+            defer { offset += 1 }
+            return bytes[offset]
+        }
+
+        private mutating func readBytes(count: Int) throws -> ArraySlice<UInt8> {
+            guard count <= bytes.count - offset else {
+                throw OWSAssertionError("Unexpected end of data.")
+            }
+            defer { offset += count }
+            return bytes[offset..<offset + count]
+        }
+
+        private mutating func readFixed() throws -> UInt64 {
+            var value: UInt64 = 0
+            for (index, byte) in try readBytes(count: 8).enumerated() {
+                value |= UInt64(byte) << (8 * UInt64(index))
+            }
+            return value
+        }
+
+        // Lengths can't exceed the remaining bytes, which also
+        // bounds the capacity we reserve for arrays and sets.
+        private mutating func readLength() throws -> Int {
+            var value: UInt64 = 0
+            var shift: UInt64 = 0
+            while true {
+                let byte = try readByte()
+                guard shift < 64 else {
+                    throw OWSAssertionError("Invalid varint.")
+                }
+                value |= UInt64(byte & 0x7f) << shift
+                if byte & 0x80 == 0 {
+                    break
+                }
+                shift += 7
+            }
+            guard value <= UInt64(bytes.count - offset) else {
+                throw OWSAssertionError("Invalid length.")
+            }
+            return Int(value)
+        }
+    }
+}
@@ -340,19 +340,12 @@ public class SDSKeyValueStore: NSObject {
             ydbTransaction.enumerateKeysAndObjects(inCollection: collection) { (key: String, value: Any, stopPtr: UnsafeMutablePointer<ObjCBool>) in
                 block(key, value, stopPtr)
             }
-        case .grdbRead(let grdbRead):
+        case .grdbRead:
             var stop: ObjCBool = false
-            // PERF - we could enumerate with a single query rather than
-            // fetching keys then fetching objects one by one. In practice
-            // the collections that use this are pretty small.
-            for key in allKeys(grdbTransaction: grdbRead) {
+            for (key, value) in allKeysAndObjects(transaction: transaction) {
                 guard !stop.boolValue else {
                     return
                 }
-                guard let value: Any = read(key, transaction: transaction) else {
-                    owsFailDebug("value was unexpectedly nil")
-                    continue
-                }
                 block(key, value, &stop)
             }
         }
@@ -378,11 +371,99 @@ public class SDSKeyValueStore: NSObject {
 
     @objc
     public func allValues(transaction: SDSAnyReadTransaction) -> [Any] {
-        return allKeys(transaction: transaction).map { key in
-            return self.read(key, transaction: transaction)
+        switch transaction.readTransaction {
+        case .yapRead:
+            return allKeys(transaction: transaction).map { key in
+                return self.read(key, transaction: transaction)
+            }
+        case .grdbRead:
+            return Array(allKeysAndObjects(transaction: transaction).values)
+        }
+    }
+
+    // MARK: - Batches
+
+    // Reads the whole collection. In GRDB, this uses a single query.
+    @objc
+    public func allKeysAndObjects(transaction: SDSAnyReadTransaction) -> [String: Any] {
+        switch transaction.readTransaction {
+        case .yapRead:
+            var result = [String: Any]()
+            for key in allKeys(transaction: transaction) {
+                result[key] = readRawObject(key, transaction: transaction)
+            }
+            return result
+        case .grdbRead:
+            return parsePairs(allPairs(transaction: transaction))
         }
     }
 
+    // Reads the values for the keys which are present. In GRDB, this
+    // uses a single query per batch of keys.
+    @objc
+    public func getObjects(forKeys keys: [String], transaction: SDSAnyReadTransaction) -> [String: Any] {
+        switch transaction.readTransaction {
+        case .yapRead:
+            var result = [String: Any]()
+            for key in keys {
+                result[key] = readRawObject(key, transaction: transaction)
+            }
+            return result
+        case .grdbRead(let grdbTransaction):
+            var result = [String: Any]()
+            // Stay well below SQLite's limit on the number of arguments.
+            let batchSize = 500
+            for batchStart in stride(from: 0, to: keys.count, by: batchSize) {
+                let batch = Array(keys[batchStart..<min(keys.count, batchStart + batchSize)])
+                let sql = """
+                SELECT
+                    \(SDSKeyValueStore.keyColumn.columnName),
+                    \(SDSKeyValueStore.valueColumn.columnName)
+                FROM \(SDSKeyValueStore.table.tableName)
+                WHERE \(SDSKeyValueStore.collectionColumn.columnName) == ?
+                AND \(SDSKeyValueStore.keyColumn.columnName) IN (\(batch.map { _ in "?" }.joined(separator: ", ")))
+                """
+                do {
+                    let pairs = try PairRecord.fetchAll(grdbTransaction.database,
+                                                        sql: sql,
+                                                        arguments: StatementArguments([collection] + batch))
+                    result.merge(parsePairs(pairs)) { _, new in new }
+                } catch {
+                    owsFailDebug("Error: \(error)")
+                }
+            }
+            return result
+        }
+    }
+
+    @objc
+    public func setObjects(_ values: [String: Any], transaction: SDSAnyWriteTransaction) {
+        // Each write reuses the same cached statement.
+        for (key, value) in values {
+            setObject(value, key: key, transaction: transaction)
+        }
+    }
+
+    private func parsePairs(_ pairs: [PairRecord]) -> [String: Any] {
+        var result = [String: Any]()
+        for pair in pairs {
+            guard let key = pair.key else {
+                owsFailDebug("missing key.")
+                continue
+            }
+            guard let value = pair.value else {
+                owsFailDebug("missing value.")
+                continue
+            }
+            guard let rawObject = parseArchivedValue(value) else {
+                owsFailDebug("Could not parse value.")
+                continue
+            }
+            result[key] = rawObject
+        }
+        return result
+    }
+
     @objc
     public func allDataValues(transaction: SDSAnyReadTransaction) -> [Data] {
         return allKeys(transaction: transaction).compactMap { key in
@@ -561,6 +642,14 @@ public class SDSKeyValueStore: NSObject {
     }
 
     private func parseArchivedValue(_ encoded: Data) -> Any? {
+        if SDSKeyValueEncoding.isEncoded(encoded) {
+            do {
+                return try SDSKeyValueEncoding.decode(encoded)
+            } catch {
+                owsFailDebug("Decode failed: \(error)")
+                return nil
+            }
+        }
         do {
             guard let rawObject = try NSKeyedUnarchiver.unarchiveTopLevelObjectWithData(encoded) else {
                 owsFailDebug("Could not decode value.")
@@ -609,7 +698,8 @@ public class SDSKeyValueStore: NSObject {
         }
     }
 
-    // TODO: Codable? NSCoding? Other serialization?
+    // Common value types use the compact SDSKeyValueEncoding;
+    // anything else is archived.
     private func write(_ value: NSCoding?, forKey key: String, transaction: SDSAnyWriteTransaction) {
         // YDB values are serialized by YDB.
         // GRDB values are serialized to data by this class.
@@ -622,7 +712,8 @@ public class SDSKeyValueStore: NSObject {
             }
         case .grdbWrite:
             if let value = value {
-                let encoded = NSKeyedArchiver.archivedData(withRootObject: value)
+                let encoded = (SDSKeyValueEncoding.encode(value)
+                                ?? NSKeyedArchiver.archivedData(withRootObject: value))
                 writeData(encoded, forKey: key, transaction: transaction)
             } else {
                 writeData(nil, forKey: key, transaction: transaction)
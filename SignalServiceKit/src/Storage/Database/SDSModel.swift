@@ -139,3 +139,150 @@ public extension SDSModel {
         }
     }
 }
+
+// MARK: - Parallel Enumeration
+
+@objc
+public enum SDSEnumerationOrder: Int {
+    // Models are delivered in the order that their records are fetched.
+    case ordered
+    // Within each batch, models are delivered as soon as they are decoded.
+    case unordered
+}
+
+public extension SDSModel {
+    // Decoding models (e.g. unarchiving their NSKeyedArchiver columns) is
+    // the bulk of the cost of whole-table scans. This enumerates the
+    // records which match `sql` in batches: each batch is fetched on the
+    // calling thread, then decoded by a pool of workers while the next
+    // batch is fetched.
+    //
+    // Models are delivered to the block on the calling thread, one at a
+    // time, so the block can use the transaction. `decode` runs on the
+    // workers, so it must not use the transaction.
+    //
+    // Bulk scans don't populate the model read caches.
+    static func grdbEnumerateInParallel<RecordType: FetchableRecord>(
+        recordType: RecordType.Type,
+        sql: String,
+        arguments: StatementArguments = StatementArguments(),
+        transaction: GRDBReadTransaction,
+        batchSize: UInt = Batching.kDefaultBatchSize,
+        order: SDSEnumerationOrder = .ordered,
+        decode: @escaping (RecordType) throws -> Self,
+        block: (Self, UnsafeMutablePointer<ObjCBool>) -> Void
+    ) {
+        owsAssertDebug(batchSize > 0)
+
+        do {
+            let cursor = try RecordType.fetchCursor(transaction.database, sql: sql, arguments: arguments)
+            let fetchBatch = { () throws -> [RecordType] in
+                var records = [RecordType]()
+                while records.count < Int(batchSize), let record = try cursor.next() {
+                    records.append(record)
+                }
+                return records
+            }
+
+            var stop: ObjCBool = false
+            var records = try fetchBatch()
+            while !records.isEmpty, !stop.boolValue {
+                try autoreleasepool {
+                    let decoder = SDSParallelDecoder(records: records, decode: decode)
+                    // Fetch the next batch while this one is being decoded.
+                    let nextRecords = try fetchBatch()
+                    try decoder.deliver(order: order) { model in
+                        block(model, &stop)
+                        return !stop.boolValue
+                    }
+                    records = nextRecords
+                }
+            }
+        } catch {
+            owsFailDebug("Couldn't fetch models: \(error)")
+        }
+    }
+}
+
+// MARK: -
+
+// Decodes a batch of records on the decoding queue, one worker per
+// active processor.
+private class SDSParallelDecoder<RecordType, Model> {
+
+    private static var decodingQueue: DispatchQueue {
+        DispatchQueue.global(qos: .userInitiated)
+    }
+
+    private let count: Int
+    private let group = DispatchGroup()
+    // Signaled once per decoded record.
+    private let semaphore = DispatchSemaphore(value: 0)
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var results: [Result<Model, Error>?]
+    private var decodedIndices = [Int]()
+
+    init(records: [RecordType], decode: @escaping (RecordType) throws -> Model) {
+        count = records.count
+        results = Array(repeating: nil, count: records.count)
+
+        let workerCount = min(records.count, ProcessInfo.processInfo.activeProcessorCount)
+        for workerIndex in 0..<workerCount {
+            Self.decodingQueue.async(group: group) { [self] in
+                // Each worker decodes every workerCount-th record, so
+                // that the records are decoded in roughly fetch order.
+                for index in stride(from: workerIndex, to: records.count, by: workerCount) {
+                    let result = autoreleasepool {
+                        Result { try decode(records[index]) }
+                    }
+                    unfairLock.withLock {
+                        results[index] = result
+                        decodedIndices.append(index)
+                    }
+                    semaphore.signal()
+                }
+            }
+        }
+    }
+
+    // Delivers each model until `block` returns false, then waits for the
+    // workers to finish.
+    func deliver(order: SDSEnumerationOrder, block: (Model) -> Bool) throws {
+        defer {
+            group.wait()
+        }
+        for deliveredCount in 0..<count {
+            let result: Result<Model, Error>
+            switch order {
+            case .ordered:
+                while true {
+                    let decoded: Result<Model, Error>? = unfairLock.withLock {
+                        let decoded = results[deliveredCount]
+                        results[deliveredCount] = nil
+                        return decoded
+                    }
+                    if let decoded = decoded {
+                        result = decoded
+                        break
+                    }
+                    // Another record has been decoded in the meantime; the
+                    // record to deliver next must still be pending.
+                    semaphore.wait()
+                }
+            case .unordered:
+                semaphore.wait()
+                result = unfairLock.withLock {
+                    let index = decodedIndices.removeFirst()
+                    let decoded = results[index]!
+                    results[index] = nil
+                    return decoded
+                }
+            }
+            guard block(try result.get()) else {
+                return
+            }
+        }
+    }
+}
@@ -14,6 +14,9 @@ public class GRDBReadTransaction: NSObject {
 
     public let isUIRead: Bool
 
+    // See SDSAnyReadTransaction.performBulkScan(_:).
+    fileprivate(set) var isBulkScan = false
+
     init(database: Database, isUIRead: Bool) {
         self.database = database
         self.isUIRead = isUIRead
@@ -183,6 +186,37 @@ public class SDSAnyReadTransaction: NSObject, SPKProtocolReadContext {
             return grdbRead.isUIRead
         }
     }
+
+    // MARK: - Bulk Scans
+
+    /// Bulk scans, e.g. the orphan data cleaner or the backup export, should
+    /// read inside this block so that the models they read aren't added to
+    /// the model read caches, where they'd displace the models the rest of
+    /// the app is using.
+    @objc
+    public func performBulkScan(_ block: () -> Void) {
+        switch readTransaction {
+        case .yapRead:
+            // YDB reads don't use the model read caches.
+            block()
+        case .grdbRead(let grdbRead):
+            let wasBulkScan = grdbRead.isBulkScan
+            grdbRead.isBulkScan = true
+            defer {
+                grdbRead.isBulkScan = wasBulkScan
+            }
+            block()
+        }
+    }
+
+    var canAdmitToModelReadCaches: Bool {
+        switch readTransaction {
+        case .yapRead:
+            return true
+        case .grdbRead(let grdbRead):
+            return !grdbRead.isBulkScan
+        }
+    }
 }
 
 @objc
@@ -0,0 +1,216 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+/// Merges small, independent writes into shared write transactions.
+///
+/// Every write transaction pays for a commit (and an fsync), which dominates
+/// the cost of tiny writes like recording a receipt. Blocks submitted to the
+/// coalescer within a short window are performed in a single transaction.
+///
+/// The blocks can't fail: they share their transaction, and neither storage
+/// can cleanly undo one block's writes. A GRDB savepoint would roll back its
+/// rows but not the model read cache or the observations it updated, and YDB
+/// has no savepoints at all. Writes which can fail should use their own
+/// transaction.
+@objc
+public class SDSWriteCoalescer: NSObject {
+
+    // How long we wait for other writes to join a batch.
+    static let coalescingWindow: TimeInterval = 0.02
+    // The most blocks we'll perform in one transaction.
+    static let maxBatchSize = 64
+
+    private struct PendingWrite {
+        let block: (SDSAnyWriteTransaction) -> Void
+        let resolver: Resolver<Void>
+    }
+
+    // The storage owns its coalescer.
+    private unowned let databaseStorage: SDSDatabaseStorage
+
+    private let serialQueue = DispatchQueue(label: "org.signal.SDSWriteCoalescer")
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+    private var pendingWrites = [PendingWrite]()
+    private var isFlushScheduled = false
+    private var _coalescedWriteCount: UInt64 = 0
+    private var _commitCount: UInt64 = 0
+
+    @objc
+    public required init(databaseStorage: SDSDatabaseStorage) {
+        self.databaseStorage = databaseStorage
+
+        super.init()
+    }
+
+    /// The number of blocks the coalescer has performed.
+    @objc
+    public var coalescedWriteCount: UInt64 {
+        unfairLock.withLock { _coalescedWriteCount }
+    }
+
+    /// The number of transactions the coalescer has committed.
+    @objc
+    public var commitCount: UInt64 {
+        unfairLock.withLock { _commitCount }
+    }
+
+    // MARK: -
+
+    /// The promise is fulfilled once the block's transaction has committed.
+    public func write(_ block: @escaping (SDSAnyWriteTransaction) -> Void) -> Promise<Void> {
+        let (promise, resolver) = Promise<Void>.pending()
+
+        let shouldScheduleFlush: Bool = unfairLock.withLock {
+            pendingWrites.append(PendingWrite(block: block, resolver: resolver))
+            guard !isFlushScheduled else {
+                return false
+            }
+            isFlushScheduled = true
+            return true
+        }
+        if shouldScheduleFlush {
+            serialQueue.asyncAfter(deadline: .now() + Self.coalescingWindow) { [weak self] in
+                self?.flush()
+            }
+        }
+
+        return promise
+    }
+
+    @objc
+    public func asyncWrite(block: @escaping (SDSAnyWriteTransaction) -> Void) {
+        _ = write(block)
+    }
+
+    private func flush() {
+        let batch: [PendingWrite] = unfairLock.withLock {
+            let batch = Array(pendingWrites.prefix(Self.maxBatchSize))
+            pendingWrites.removeFirst(batch.count)
+            return batch
+        }
+
+        if !batch.isEmpty {
+            databaseStorage.write { transaction in
+                for pendingWrite in batch {
+                    pendingWrite.block(transaction)
+                }
+            }
+        }
+
+        let hasMorePendingWrites: Bool = unfairLock.withLock {
+            _coalescedWriteCount += UInt64(batch.count)
+            if !batch.isEmpty {
+                _commitCount += 1
+            }
+            isFlushScheduled = !pendingWrites.isEmpty
+            return isFlushScheduled
+        }
+
+        // Resolve outside of the transaction so that callers can safely write again.
+        for pendingWrite in batch {
+            pendingWrite.resolver.fulfill(())
+        }
+
+        if hasMorePendingWrites {
+            // The writes which arrived during this flush have already waited.
+            serialQueue.async { [weak self] in
+                self?.flush()
+            }
+        }
+    }
+}
+
+// MARK: -
+
+public extension SDSDatabaseStorage {
+
+    /// Performs a small write in a transaction shared with other coalesced writes.
+    ///
+    /// See SDSWriteCoalescer.
+    func coalescedWrite(_ block: @escaping (SDSAnyWriteTransaction) -> Void) -> Promise<Void> {
+        writeCoalescer.write(block)
+    }
+
+    @objc
+    func asyncCoalescedWrite(block: @escaping (SDSAnyWriteTransaction) -> Void) {
+        writeCoalescer.asyncWrite(block: block)
+    }
+}
+
+// MARK: -
+
+/// Counts write transaction commits, so that we can see how often we fsync,
+/// and how long write transactions take.
+@objc
+public class DatabaseCommitRateMonitor: NSObject {
+
+    // The window over which commitsPerSecond and p95CommitDuration are measured.
+    static let measurementWindow: TimeInterval = 10
+
+    private struct Commit {
+        let time: CFTimeInterval
+        let duration: TimeInterval
+    }
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+    private var recentCommits = [Commit]()
+    private var _totalCommitCount: UInt64 = 0
+
+    @objc
+    public var totalCommitCount: UInt64 {
+        unfairLock.withLock { _totalCommitCount }
+    }
+
+    /// The average number of commits per second over the last 10 seconds.
+    @objc
+    public var commitsPerSecond: Double {
+        let now = CACurrentMediaTime()
+        return unfairLock.withLock {
+            pruneCommits(now: now)
+            return Double(recentCommits.count) / Self.measurementWindow
+        }
+    }
+
+    /// The 95th percentile duration of the write transactions which
+    /// committed over the last 10 seconds, or zero if there were none.
+    @objc
+    public var p95CommitDuration: TimeInterval {
+        let now = CACurrentMediaTime()
+        let durations = unfairLock.withLock { () -> [TimeInterval] in
+            pruneCommits(now: now)
+            return recentCommits.map { $0.duration }
+        }.sorted()
+        guard !durations.isEmpty else {
+            return 0
+        }
+        let index = min(durations.count - 1, Int(Double(durations.count) * 0.95))
+        return durations[index]
+    }
+
+    func didCommit(duration: TimeInterval) {
+        let now = CACurrentMediaTime()
+        unfairLock.withLock {
+            _totalCommitCount += 1
+            recentCommits.append(Commit(time: now, duration: duration))
+            pruneCommits(now: now)
+        }
+    }
+
+    private func pruneCommits(now: CFTimeInterval) {
+        let cutoff = now - Self.measurementWindow
+        if let firstIndexToKeep = recentCommits.firstIndex(where: { $0.time >= cutoff }) {
+            recentCommits.removeFirst(firstIndexToKeep)
+        } else {
+            recentCommits.removeAll()
+        }
+    }
+}
@@ -0,0 +1,223 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// The changes committed by other processes, e.g. the NSE or the share
+/// extension, since the main app last looked.
+///
+/// SDSCrossProcess can only tell the main app that *something* was written.
+/// Without knowing what, every observer has to discard all of its state. So
+/// the extensions also append the changes of each write transaction to a
+/// small journal in the shared container, which the main app consumes when
+/// it's notified of a cross process write.
+@objc
+public class CrossProcessDatabaseChanges: NSObject, UIDatabaseChanges {
+
+    public let threadUniqueIds: Set<UniqueId>
+    public let interactionUniqueIds: Set<UniqueId>
+    public let attachmentUniqueIds: Set<UniqueId>
+
+    public let interactionDeletedUniqueIds: Set<UniqueId>
+    public let attachmentDeletedUniqueIds: Set<UniqueId>
+
+    public let tableNames: Set<String>
+    public let collections: Set<String>
+
+    fileprivate init(entry: Entry) {
+        self.threadUniqueIds = entry.threadUniqueIds
+        self.interactionUniqueIds = entry.interactionUniqueIds
+        self.attachmentUniqueIds = entry.attachmentUniqueIds
+        self.interactionDeletedUniqueIds = entry.interactionDeletedUniqueIds
+        self.attachmentDeletedUniqueIds = entry.attachmentDeletedUniqueIds
+        self.tableNames = entry.tableNames
+        self.collections = entry.collections
+    }
+
+    public var didUpdateInteractions: Bool {
+        collections.contains(TSInteraction.collection())
+    }
+
+    public var didUpdateThreads: Bool {
+        collections.contains(TSThread.collection())
+    }
+
+    public var didUpdateInteractionsOrThreads: Bool {
+        didUpdateInteractions || didUpdateThreads
+    }
+
+    @objc(didUpdateModelWithCollection:)
+    public func didUpdateModel(collection: String) -> Bool {
+        collections.contains(collection)
+    }
+
+    @objc(didUpdateKeyValueStore:)
+    public func didUpdate(keyValueStore: SDSKeyValueStore) -> Bool {
+        // Only GRDB writes are journaled.
+        collections.contains(SDSKeyValueStore.dataStoreCollection)
+    }
+
+    @objc(didUpdateInteraction:)
+    public func didUpdate(interaction: TSInteraction) -> Bool {
+        interactionUniqueIds.contains(interaction.uniqueId)
+    }
+
+    @objc(didUpdateThread:)
+    public func didUpdate(thread: TSThread) -> Bool {
+        threadUniqueIds.contains(thread.uniqueId)
+    }
+
+    // MARK: - Journal
+
+    fileprivate struct Entry: Codable {
+        var threadUniqueIds = Set<String>()
+        var interactionUniqueIds = Set<String>()
+        var attachmentUniqueIds = Set<String>()
+        var interactionDeletedUniqueIds = Set<String>()
+        var attachmentDeletedUniqueIds = Set<String>()
+        var tableNames = Set<String>()
+        var collections = Set<String>()
+        // Set if the changes were too large to journal.
+        var didOverflow = false
+
+        mutating func formUnion(_ other: Entry) {
+            threadUniqueIds.formUnion(other.threadUniqueIds)
+            interactionUniqueIds.formUnion(other.interactionUniqueIds)
+            attachmentUniqueIds.formUnion(other.attachmentUniqueIds)
+            interactionDeletedUniqueIds.formUnion(other.interactionDeletedUniqueIds)
+            attachmentDeletedUniqueIds.formUnion(other.attachmentDeletedUniqueIds)
+            tableNames.formUnion(other.tableNames)
+            collections.formUnion(other.collections)
+            didOverflow = didOverflow || other.didOverflow
+        }
+
+        var rowChangeCount: Int {
+            let uniqueIds = [
+                threadUniqueIds,
+                interactionUniqueIds,
+                attachmentUniqueIds,
+                interactionDeletedUniqueIds,
+                attachmentDeletedUniqueIds
+            ]
+            return uniqueIds.map { $0.count }.reduce(0, +)
+        }
+    }
+
+    static let journal = Journal(fileUrl: URL(fileURLWithPath: OWSFileSystem.appSharedDataDirectoryPath())
+                                    .appendingPathComponent("CrossProcessDatabaseChanges.journal"))
+
+    /// An append-only file of JSON entries, one per line. Processes take an
+    /// exclusive flock() on the file while they read or write it.
+    class Journal {
+
+        // If the main app doesn't consume the journal for a long time, e.g.
+        // because it isn't running, we stop journaling and it reloads.
+        static let maxFileSize: UInt64 = 256 * 1024
+
+        let fileUrl: URL
+
+        init(fileUrl: URL) {
+            self.fileUrl = fileUrl
+        }
+
+        /// Journals the changes of a write transaction.
+        func append(changes: UIDatabaseChanges) {
+            var entry = Entry()
+            entry.threadUniqueIds = changes.threadUniqueIds
+            entry.interactionUniqueIds = changes.interactionUniqueIds
+            entry.attachmentUniqueIds = changes.attachmentUniqueIds
+            entry.interactionDeletedUniqueIds = changes.interactionDeletedUniqueIds
+            entry.attachmentDeletedUniqueIds = changes.attachmentDeletedUniqueIds
+            entry.tableNames = changes.tableNames
+            entry.collections = changes.collections
+            append(entry: entry)
+        }
+
+        /// Journals a write transaction whose changes we couldn't determine,
+        /// so that the main app reloads everything.
+        func appendOverflow() {
+            var entry = Entry()
+            entry.didOverflow = true
+            append(entry: entry)
+        }
+
+        private func append(entry: Entry) {
+            do {
+                var line = try JSONEncoder().encode(entry)
+                line.append(Self.newline)
+                try withLockedFile { fileHandle in
+                    let fileSize = fileHandle.seekToEndOfFile()
+                    if fileSize + UInt64(line.count) > Self.maxFileSize {
+                        Logger.warn("Journal is full.")
+                        var overflowEntry = Entry()
+                        overflowEntry.didOverflow = true
+                        var overflowLine = try JSONEncoder().encode(overflowEntry)
+                        overflowLine.append(Self.newline)
+                        fileHandle.truncateFile(atOffset: 0)
+                        fileHandle.write(overflowLine)
+                    } else {
+                        fileHandle.write(line)
+                    }
+                }
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+        }
+
+        /// Returns and clears the journaled changes.
+        ///
+        /// Returns nil if the changes are too large to apply incrementally
+        /// or couldn't be read; observers should reload everything.
+        func consume() -> CrossProcessDatabaseChanges? {
+            do {
+                let data: Data = try withLockedFile { fileHandle in
+                    let data = fileHandle.readDataToEndOfFile()
+                    fileHandle.truncateFile(atOffset: 0)
+                    return data
+                }
+                var mergedEntry = Entry()
+                for line in data.split(separator: Self.newline) {
+                    mergedEntry.formUnion(try JSONDecoder().decode(Entry.self, from: line))
+                }
+                guard !mergedEntry.didOverflow,
+                      mergedEntry.rowChangeCount < UIDatabaseObserver.kMaxIncrementalRowChanges else {
+                    return nil
+                }
+                return CrossProcessDatabaseChanges(entry: mergedEntry)
+            } catch {
+                owsFailDebug("Error: \(error)")
+                return nil
+            }
+        }
+
+        /// Discards the journal, e.g. when the main app launches and
+        /// has no state to update.
+        func removeAll() {
+            do {
+                try withLockedFile { fileHandle in
+                    fileHandle.truncateFile(atOffset: 0)
+                }
+            } catch {
+                owsFailDebug("Error: \(error)")
+            }
+        }
+
+        private static let newline = UInt8(ascii: "\n")
+
+        private func withLockedFile<T>(_ block: (FileHandle) throws -> T) throws -> T {
+            let fileDescriptor = open(fileUrl.path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR)
+            guard fileDescriptor >= 0 else {
+                throw OWSAssertionError("Couldn't open journal: \(errno)")
+            }
+            let fileHandle = FileHandle(fileDescriptor: fileDescriptor, closeOnDealloc: true)
+            guard flock(fileDescriptor, LOCK_EX) == 0 else {
+                throw OWSAssertionError("Couldn't lock journal: \(errno)")
+            }
+            defer {
+                flock(fileDescriptor, LOCK_UN)
+            }
+            return try block(fileHandle)
+        }
+    }
+}
@@ -156,6 +156,10 @@ public class UIDatabaseObserver: NSObject {
     init(pool: DatabasePool, checkpointingQueue: DatabaseQueue?) throws {
         self.pool = pool
         self.checkpointingQueue = checkpointingQueue
+        if CurrentAppContext().isMainApp {
+            // Our snapshot will include everything that's been journaled.
+            CrossProcessDatabaseChanges.journal.removeAll()
+        }
         self.latestSnapshot = try pool.makeSnapshot()
 
         super.init()
@@ -236,9 +240,30 @@ public class UIDatabaseObserver: NSObject {
         AssertIsOnMainThread()
         Logger.verbose("")
 
-        for delegate in snapshotDelegates {
-            delegate.uiDatabaseSnapshotDidUpdateExternally()
+        guard let crossProcessChanges = notification.object as? CrossProcessDatabaseChanges else {
+            for delegate in snapshotDelegates {
+                delegate.uiDatabaseSnapshotDidUpdateExternally()
+            }
+            return
         }
+
+        // Deliver the other process's changes like our own, with the
+        // next snapshot update.
+        committedChanges.append(interactionUniqueIds: crossProcessChanges.interactionUniqueIds)
+        committedChanges.append(threadUniqueIds: crossProcessChanges.threadUniqueIds)
+        committedChanges.append(attachmentUniqueIds: crossProcessChanges.attachmentUniqueIds)
+        committedChanges.append(interactionDeletedUniqueIds: crossProcessChanges.interactionDeletedUniqueIds)
+        committedChanges.append(attachmentDeletedUniqueIds: crossProcessChanges.attachmentDeletedUniqueIds)
+        committedChanges.append(collections: crossProcessChanges.collections)
+
+        hasPendingSnapshotUpdate.set(true)
+        ensureDisplayLink()
+        updateSnapshotIfNecessary()
+    }
+
+    // Only the main app observes the changes made by other processes.
+    private static var shouldJournalChanges: Bool {
+        !CurrentAppContext().isMainApp
     }
 }
 
@@ -385,7 +410,14 @@ extension UIDatabaseObserver: TransactionObserver {
                     self.committedChanges.append(collections: collections)
                     self.committedChanges.append(completionBlocks: completionBlocks)
                 }
+
+                if Self.shouldJournalChanges {
+                    CrossProcessDatabaseChanges.journal.append(changes: pendingChangesToCommit)
+                }
             } catch {
+                if Self.shouldJournalChanges {
+                    CrossProcessDatabaseChanges.journal.appendOverflow()
+                }
                 DispatchQueue.main.async {
                     self.committedChanges.setLastError(error)
                 }
@@ -393,7 +425,9 @@ extension UIDatabaseObserver: TransactionObserver {
 
             let didModifyInteractions = pendingChangesToCommit.tableNames.contains(InteractionRecord.databaseTableName)
             if didModifyInteractions {
-                NotificationCenter.default.postNotificationNameAsync(Self.databaseDidCommitInteractionChangeNotification, object: nil)
+                // Message processing commits many writes in a row; their
+                // observers only need to hear about the burst.
+                CoalescingNotificationCenter.shared.post(name: Self.databaseDidCommitInteractionChangeNotification)
             }
 
             #if TESTABLE_BUILD
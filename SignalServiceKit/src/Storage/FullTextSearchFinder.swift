@@ -7,12 +7,45 @@ import GRDB
 
 @objc
 public class FullTextSearchFinder: NSObject {
-    public func enumerateObjects(searchText: String, transaction: SDSAnyReadTransaction, block: @escaping (Any, String, UnsafeMutablePointer<ObjCBool>) -> Void) {
+    // Matches are enumerated best first. If collections is non-nil, only
+    // matches from those collections are enumerated.
+    public func enumerateObjects(searchText: String,
+                                 collections: [String]? = nil,
+                                 limit: UInt? = nil,
+                                 offset: UInt = 0,
+                                 transaction: SDSAnyReadTransaction,
+                                 block: @escaping (Any, String, UnsafeMutablePointer<ObjCBool>) -> Void) {
         switch transaction.readTransaction {
         case .yapRead:
             owsFailDebug("YDB FTS no longer supported.")
         case .grdbRead(let grdbRead):
-            GRDBFullTextSearchFinder.enumerateObjects(searchText: searchText, transaction: grdbRead, block: block)
+            GRDBFullTextSearchFinder.enumerateObjects(searchText: searchText,
+                                                      collections: collections,
+                                                      limit: limit,
+                                                      offset: offset,
+                                                      transaction: grdbRead,
+                                                      block: block)
+        }
+    }
+
+    // Matching messages in the given thread are enumerated most recent
+    // first, without loading the messages.
+    public func enumerateMessageMatches(searchText: String,
+                                        threadUniqueId: String,
+                                        limit: UInt,
+                                        offset: UInt = 0,
+                                        transaction: SDSAnyReadTransaction,
+                                        block: @escaping (_ uniqueId: String, _ sortId: UInt64, UnsafeMutablePointer<ObjCBool>) -> Void) {
+        switch transaction.readTransaction {
+        case .yapRead:
+            owsFailDebug("YDB FTS no longer supported.")
+        case .grdbRead(let grdbRead):
+            GRDBFullTextSearchFinder.enumerateMessageMatches(searchText: searchText,
+                                                             threadUniqueId: threadUniqueId,
+                                                             limit: limit,
+                                                             offset: offset,
+                                                             transaction: grdbRead,
+                                                             block: block)
         }
     }
 
@@ -226,6 +259,11 @@ class GRDBFullTextSearchFinder: NSObject {
     }
 
     public class func modelWasInserted(model: SDSModel, transaction: GRDBWriteTransaction) {
+        guard !FullTextSearchIndexer.shouldDeferIndexing(model: model) else {
+            FullTextSearchIndexer.modelNeedsIndexing(model, transaction: transaction)
+            return
+        }
+
         let uniqueId = model.uniqueId
         let collection = self.collection(forModel: model)
         let ftsContent = AnySearchIndexer.indexContent(object: model, transaction: transaction.asAnyRead) ?? ""
@@ -247,23 +285,22 @@ class GRDBFullTextSearchFinder: NSObject {
     }
 
     public class func modelWasUpdated(model: SDSModel, transaction: GRDBWriteTransaction) {
+        guard !FullTextSearchIndexer.shouldDeferIndexing(updatedModel: model) else {
+            FullTextSearchIndexer.modelNeedsIndexing(model, transaction: transaction)
+            return
+        }
+        if FullTextSearchIndexer.shouldDeferIndexing(model: model) {
+            // The model's insert may have been deferred, in which case it
+            // isn't in the index yet.
+            indexModel(model, transaction: transaction)
+            return
+        }
+
         let uniqueId = model.uniqueId
         let collection = self.collection(forModel: model)
         let ftsContent = AnySearchIndexer.indexContent(object: model, transaction: transaction.asAnyRead) ?? ""
 
-        let shouldSkipUpdate: Bool = serialQueue.sync {
-            guard !CurrentAppContext().isRunningTests else {
-                return false
-            }
-            let cacheKey = self.cacheKey(collection: collection, uniqueId: uniqueId)
-            if let cachedValue = ftsCache.object(forKey: cacheKey as NSString),
-                (cachedValue as String) == ftsContent {
-                return true
-            }
-            ftsCache.setObject(ftsContent as NSString, forKey: cacheKey as NSString)
-            return false
-        }
-        guard !shouldSkipUpdate else {
+        guard !cacheContentForUpdate(ftsContent, collection: collection, uniqueId: uniqueId) else {
             Logger.verbose("Skipping FTS update")
             return
         }
@@ -279,6 +316,23 @@ class GRDBFullTextSearchFinder: NSObject {
             transaction: transaction)
     }
 
+    // Returns true if the content is unchanged since we last indexed it,
+    // in which case the update can be skipped.
+    private class func cacheContentForUpdate(_ ftsContent: String, collection: String, uniqueId: String) -> Bool {
+        return serialQueue.sync {
+            guard !CurrentAppContext().isRunningTests else {
+                return false
+            }
+            let cacheKey = self.cacheKey(collection: collection, uniqueId: uniqueId)
+            if let cachedValue = ftsCache.object(forKey: cacheKey as NSString),
+                (cachedValue as String) == ftsContent {
+                return true
+            }
+            ftsCache.setObject(ftsContent as NSString, forKey: cacheKey as NSString)
+            return false
+        }
+    }
+
     public class func modelWasRemoved(model: SDSModel, transaction: GRDBWriteTransaction) {
         let uniqueId = model.uniqueId
         let collection = self.collection(forModel: model)
@@ -296,6 +350,10 @@ class GRDBFullTextSearchFinder: NSObject {
             """,
             arguments: [uniqueId, collection],
             transaction: transaction)
+
+        if FullTextSearchIndexer.shouldDeferIndexing(model: model) {
+            FullTextSearchIndexer.modelWasRemoved(collection: collection, uniqueId: uniqueId, transaction: transaction)
+        }
     }
 
     public class func allModelsWereRemoved(collection: String, transaction: GRDBWriteTransaction) {
@@ -311,6 +369,71 @@ class GRDBFullTextSearchFinder: NSObject {
             """,
             arguments: [collection],
             transaction: transaction)
+
+        FullTextSearchIndexer.allModelsWereRemoved(collection: collection, transaction: transaction)
+    }
+
+    // Used by FullTextSearchIndexer to index models whose indexing was
+    // deferred.
+    class func indexModel(_ model: SDSModel, transaction: GRDBWriteTransaction) {
+        let uniqueId = model.uniqueId
+        let collection = self.collection(forModel: model)
+        let ftsContent = AnySearchIndexer.indexContent(object: model, transaction: transaction.asAnyRead) ?? ""
+
+        // Most deferred updates, e.g. read receipts, don't change the content.
+        // The content is only cached once it has been written, so a cache hit
+        // means the row is already up to date.
+        guard !cacheContentForUpdate(ftsContent, collection: collection, uniqueId: uniqueId) else {
+            return
+        }
+
+        if isModelIndexed(model: model, transaction: transaction) {
+            executeUpdate(
+                sql: """
+                UPDATE \(contentTableName)
+                SET \(ftsContentColumn) = ?
+                WHERE \(collectionColumn) == ?
+                AND \(uniqueIdColumn) == ?
+                """,
+                arguments: [ftsContent, collection, uniqueId],
+                transaction: transaction)
+        } else {
+            executeUpdate(
+                sql: """
+                INSERT INTO \(contentTableName)
+                (\(collectionColumn), \(uniqueIdColumn), \(ftsContentColumn))
+                VALUES
+                (?, ?, ?)
+                """,
+                arguments: [collection, uniqueId, ftsContent],
+                transaction: transaction)
+        }
+    }
+
+    // Rebuilds the FTS index from the indexable content, e.g. if the index
+    // is corrupt or its tokenizer has changed.
+    class func rebuildFTSIndex(transaction: GRDBWriteTransaction) {
+        executeUpdate(
+            sql: "INSERT INTO \(ftsTableName)(\(ftsTableName)) VALUES('rebuild')",
+            arguments: [],
+            transaction: transaction)
+    }
+
+    public class func isModelIndexed(model: SDSModel, transaction: GRDBReadTransaction) -> Bool {
+        let sql = """
+            SELECT EXISTS (
+                SELECT 1 FROM \(contentTableName)
+                WHERE \(uniqueIdColumn) == ?
+                AND \(collectionColumn) == ?
+            )
+            """
+        do {
+            return try Bool.fetchOne(transaction.database,
+                                     sql: sql,
+                                     arguments: [model.uniqueId, collection(forModel: model)]) ?? false
+        } catch {
+            owsFail("Error: \(error)")
+        }
     }
 
     private static let disableFTS = false
@@ -366,7 +489,12 @@ class GRDBFullTextSearchFinder: NSObject {
 
     // MARK: - Querying
 
-    public class func enumerateObjects(searchText: String, transaction: GRDBReadTransaction, block: @escaping (Any, String, UnsafeMutablePointer<ObjCBool>) -> Void) {
+    public class func enumerateObjects(searchText: String,
+                                       collections: [String]? = nil,
+                                       limit: UInt? = nil,
+                                       offset: UInt = 0,
+                                       transaction: GRDBReadTransaction,
+                                       block: @escaping (Any, String, UnsafeMutablePointer<ObjCBool>) -> Void) {
 
         let query = FullTextSearchFinder.query(searchText: searchText)
 
@@ -381,12 +509,11 @@ class GRDBFullTextSearchFinder: NSObject {
         do {
             var stop: ObjCBool = false
 
-            // GRDB TODO: We could use bm25() instead of rank to order results.
             let indexOfContentColumnInFTSTable = 0
             // Determines the length of the snippet.
             let numTokens: UInt = 15
             let matchSnippet = "match_snippet"
-            let sql: String = """
+            var sql: String = """
                 SELECT
                     \(contentTableName).\(collectionColumn),
                     \(contentTableName).\(uniqueIdColumn),
@@ -394,9 +521,21 @@ class GRDBFullTextSearchFinder: NSObject {
                 FROM \(ftsTableName)
                 LEFT JOIN \(contentTableName) ON \(contentTableName).rowId = \(ftsTableName).rowId
                 WHERE \(ftsTableName) MATCH '"\(ftsContentColumn)" : \(query)'
-                ORDER BY rank
             """
-            let cursor = try Row.fetchCursor(transaction.database, sql: sql)
+            var arguments = StatementArguments()
+            if let collections = collections {
+                sql += " AND \(contentTableName).\(collectionColumn) IN (\(collections.map { _ in "?" }.joined(separator: ", ")))"
+                arguments += StatementArguments(collections)
+            }
+            // rank is bm25() by default. FTS5 can stop early when a query is
+            // ordered by rank and limited, so callers should pass a limit.
+            sql += " ORDER BY rank"
+            if let limit = limit {
+                sql += " LIMIT ? OFFSET ?"
+                arguments += [limit, offset]
+            }
+
+            let cursor = try Row.fetchCursor(transaction.database, sql: sql, arguments: arguments)
             while let row = try cursor.next() {
                 let collection: String = row[collectionColumn]
                 let uniqueId: String = row[uniqueIdColumn]
@@ -423,6 +562,57 @@ class GRDBFullTextSearchFinder: NSObject {
         }
     }
 
+    // Searching within a conversation only needs the ids of the matching
+    // messages, so we filter and order by thread in SQL rather than loading
+    // every match and discarding those from other threads.
+    public class func enumerateMessageMatches(searchText: String,
+                                              threadUniqueId: String,
+                                              limit: UInt,
+                                              offset: UInt = 0,
+                                              transaction: GRDBReadTransaction,
+                                              block: @escaping (_ uniqueId: String, _ sortId: UInt64, UnsafeMutablePointer<ObjCBool>) -> Void) {
+
+        let query = FullTextSearchFinder.query(searchText: searchText)
+
+        guard query.count > 0 else {
+            Logger.warn("Empty query.")
+            return
+        }
+
+        do {
+            var stop: ObjCBool = false
+
+            let sql: String = """
+                SELECT
+                    interaction.\(interactionColumn: .uniqueId),
+                    interaction.\(interactionColumn: .id)
+                FROM \(ftsTableName)
+                INNER JOIN \(contentTableName)
+                    ON \(contentTableName).rowId = \(ftsTableName).rowId
+                    AND \(contentTableName).\(collectionColumn) = ?
+                INNER JOIN \(InteractionRecord.databaseTableName) AS interaction
+                    ON interaction.\(interactionColumn: .uniqueId) = \(contentTableName).\(uniqueIdColumn)
+                    AND interaction.\(interactionColumn: .threadUniqueId) = ?
+                WHERE \(ftsTableName) MATCH '"\(ftsContentColumn)" : \(query)'
+                ORDER BY interaction.\(interactionColumn: .id) DESC
+                LIMIT ? OFFSET ?
+            """
+            let arguments: StatementArguments = [TSInteraction.collection(), threadUniqueId, limit, offset]
+            let cursor = try Row.fetchCursor(transaction.database, sql: sql, arguments: arguments)
+            while let row = try cursor.next() {
+                let uniqueId: String = row[0]
+                let sortId: UInt64 = row[1]
+
+                block(uniqueId, sortId, &stop)
+                guard !stop.boolValue else {
+                    break
+                }
+            }
+        } catch {
+            owsFailDebug("Couldn't fetch results: \(error)")
+        }
+    }
+
 }
 
 // MARK: -
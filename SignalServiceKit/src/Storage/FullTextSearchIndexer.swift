@@ -0,0 +1,304 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+// Indexes messages for full-text search outside of the transactions which
+// write them.
+//
+// Indexing a message means building its indexable content and updating
+// the FTS index, which makes every message write heavier; incoming
+// messages are written while the user is waiting for them. Instead, the
+// writing transaction just records the message in a pending table. The
+// pending messages are then indexed in batches, each batch in its own
+// write transaction, shortly afterward.
+//
+// The pending table is the consistency cursor: a message is removed from
+// it in the same transaction that indexes it, so a message which was
+// pending when the app was terminated is indexed on the next launch. New
+// messages are briefly unsearchable until their batch is indexed.
+//
+// Pending messages are only indexed in the main app; extensions leave
+// them for the main app.
+//
+// The indexer can also rebuild the index in the background, e.g. after
+// the FTS index is corrupted or its tokenizer changes.
+@objc
+public class FullTextSearchIndexer: NSObject {
+
+    // MARK: - Dependencies
+
+    private static var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    // MARK: -
+
+    static let pendingTableName = "indexable_text_pending"
+    private static let collectionColumn = "collection"
+    private static let uniqueIdColumn = "uniqueId"
+
+    static var createTableSql: String {
+        """
+        CREATE TABLE \(pendingTableName) (
+            id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
+            \(collectionColumn) TEXT NOT NULL,
+            \(uniqueIdColumn) TEXT NOT NULL
+        );
+
+        CREATE UNIQUE INDEX index_indexable_text_pending_on_collection_and_uniqueId
+        ON \(pendingTableName)(\(collectionColumn), \(uniqueIdColumn));
+        """
+    }
+
+    // Messages are by far the most frequently written indexed models;
+    // other models are still indexed in their writing transactions.
+    //
+    // Tests expect writes to be searchable immediately, so they opt in.
+    static var shouldDeferIndexing = !CurrentAppContext().isRunningTests
+
+    class func shouldDeferIndexing(model: SDSModel) -> Bool {
+        return shouldDeferIndexing && model is TSInteraction
+    }
+
+    // Updates which remove content, e.g. remote deletes and view-once
+    // messages, are indexed in their writing transaction. Extensions
+    // leave pending models for the main app, so deferring them could
+    // leave the removed content searchable until the main app next runs.
+    class func shouldDeferIndexing(updatedModel model: SDSModel) -> Bool {
+        guard shouldDeferIndexing(model: model) else {
+            return false
+        }
+        guard let message = model as? TSMessage else {
+            // Other interactions have no indexable content.
+            return false
+        }
+        guard !message.wasRemotelyDeleted, !message.isViewOnceMessage else {
+            return false
+        }
+        guard let body = message.body, !body.isEmpty else {
+            return false
+        }
+        return true
+    }
+
+    private static let batchSize = 100
+    private static let flushDelay: TimeInterval = 0.5
+
+    private static let serialQueue = DispatchQueue(label: "org.signal.fullTextSearchIndexer", qos: .utility)
+    private static let isFlushScheduled = AtomicBool(false)
+
+    // MARK: - Pending Models
+
+    class func modelNeedsIndexing(_ model: SDSModel, transaction: GRDBWriteTransaction) {
+        let sql = """
+            INSERT OR IGNORE INTO \(pendingTableName) (\(collectionColumn), \(uniqueIdColumn))
+            VALUES (?, ?)
+            """
+        transaction.executeWithCachedStatement(sql: sql,
+                                               arguments: [type(of: model).collection(), model.uniqueId])
+        transaction.addAsyncCompletion(queue: serialQueue) {
+            scheduleFlush()
+        }
+    }
+
+    class func modelWasRemoved(collection: String, uniqueId: String, transaction: GRDBWriteTransaction) {
+        let sql = """
+            DELETE FROM \(pendingTableName)
+            WHERE \(collectionColumn) = ?
+            AND \(uniqueIdColumn) = ?
+            """
+        transaction.executeWithCachedStatement(sql: sql, arguments: [collection, uniqueId])
+    }
+
+    class func allModelsWereRemoved(collection: String, transaction: GRDBWriteTransaction) {
+        let sql = """
+            DELETE FROM \(pendingTableName)
+            WHERE \(collectionColumn) = ?
+            """
+        transaction.executeUpdate(sql: sql, arguments: [collection])
+    }
+
+    // MARK: - Indexing
+
+    // Extensions, e.g. the NSE, leave the messages they write pending.
+    // Index them as soon as the main app learns of the writes, rather
+    // than on its next launch.
+    private static let observeCrossProcessWritesOnce: Void = {
+        NotificationCenter.default.addObserver(forName: SDSDatabaseStorage.didReceiveCrossProcessNotification,
+                                               object: nil,
+                                               queue: nil) { _ in
+            scheduleFlush()
+        }
+    }()
+
+    @objc
+    public class func scheduleFlush() {
+        guard CurrentAppContext().isMainApp else {
+            return
+        }
+        _ = observeCrossProcessWritesOnce
+        guard AppReadiness.isAppReady else {
+            AppReadiness.runNowOrWhenAppDidBecomeReadyPolite {
+                scheduleFlush()
+            }
+            return
+        }
+        // Coalesce the writes of the next moment into the same batches.
+        guard isFlushScheduled.tryToSetFlag() else {
+            return
+        }
+        serialQueue.asyncAfter(deadline: .now() + flushDelay) {
+            isFlushScheduled.set(false)
+
+            var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+            flushSync()
+            owsAssertDebug(backgroundTask != nil)
+            backgroundTask = nil
+        }
+    }
+
+    // Indexes all pending models, a batch at a time.
+    class func flushSync() {
+        var indexedCount = 0
+        while true {
+            let batchCount: Int = databaseStorage.write { transaction in
+                indexBatch(transaction: transaction.unwrapGrdbWrite)
+            }
+            indexedCount += batchCount
+            guard batchCount == batchSize else {
+                break
+            }
+        }
+        if indexedCount > 0 {
+            Logger.verbose("Indexed \(indexedCount) pending models.")
+        }
+    }
+
+    private class func indexBatch(transaction: GRDBWriteTransaction) -> Int {
+        let sql = """
+            SELECT id, \(collectionColumn), \(uniqueIdColumn)
+            FROM \(pendingTableName)
+            ORDER BY id
+            LIMIT ?
+            """
+        do {
+            let rows = try Row.fetchAll(transaction.database, sql: sql, arguments: [batchSize])
+            guard let lastRow = rows.last else {
+                return 0
+            }
+            for row in rows {
+                let collection: String = row[1]
+                let uniqueId: String = row[2]
+                guard collection == TSInteraction.collection() else {
+                    owsFailDebug("Unexpected collection: \(collection)")
+                    continue
+                }
+                // The model may have been removed without being instantiated.
+                guard let model = TSInteraction.anyFetch(uniqueId: uniqueId, transaction: transaction.asAnyRead) else {
+                    continue
+                }
+                GRDBFullTextSearchFinder.indexModel(model, transaction: transaction)
+            }
+            let lastId: Int64 = lastRow[0]
+            transaction.executeUpdate(sql: "DELETE FROM \(pendingTableName) WHERE id <= ?",
+                                      arguments: [lastId])
+            return rows.count
+        } catch {
+            owsFail("Error: \(error)")
+        }
+    }
+
+    // MARK: - Rebuilding
+
+    private static let keyValueStore = SDSKeyValueStore(collection: "FullTextSearchIndexer")
+    private static let rebuildCursorKey = "rebuildCursor"
+    private static let rebuildChunkSize = 1000
+
+    // Rebuilds the FTS index from the indexable content, then re-indexes
+    // every message, a chunk at a time. An interrupted rebuild resumes from
+    // its last chunk on the next launch.
+    @objc
+    public class func rebuildIndex(completion: (() -> Void)? = nil) {
+        serialQueue.async {
+            var backgroundTask: OWSBackgroundTask? = OWSBackgroundTask(label: "\(#function)")
+
+            databaseStorage.write { transaction in
+                let transaction = transaction.unwrapGrdbWrite
+                GRDBFullTextSearchFinder.rebuildFTSIndex(transaction: transaction)
+                keyValueStore.setInt(0, key: rebuildCursorKey, transaction: transaction.asAnyWrite)
+            }
+            Logger.info("Rebuilt FTS index.")
+            resumeRebuildSync()
+
+            owsAssertDebug(backgroundTask != nil)
+            backgroundTask = nil
+
+            completion?()
+        }
+    }
+
+    class func resumeRebuildIfNecessary() {
+        guard CurrentAppContext().isMainApp else {
+            return
+        }
+        AppReadiness.runNowOrWhenAppDidBecomeReadyIdle {
+            serialQueue.async {
+                resumeRebuildSync()
+            }
+        }
+    }
+
+    private class func resumeRebuildSync() {
+        var chunkCount = 0
+        while true {
+            let isComplete: Bool = databaseStorage.write { transaction in
+                let transaction = transaction.unwrapGrdbWrite
+                guard let cursor = keyValueStore.getInt(rebuildCursorKey, transaction: transaction.asAnyRead) else {
+                    return true
+                }
+                chunkCount += 1
+
+                let sql = """
+                    SELECT \(interactionColumn: .id), \(interactionColumn: .uniqueId)
+                    FROM \(InteractionRecord.databaseTableName)
+                    WHERE \(interactionColumn: .id) > ?
+                    ORDER BY \(interactionColumn: .id)
+                    LIMIT ?
+                    """
+                do {
+                    let rows = try Row.fetchAll(transaction.database, sql: sql, arguments: [cursor, rebuildChunkSize])
+                    let insertSql = """
+                        INSERT OR IGNORE INTO \(pendingTableName) (\(collectionColumn), \(uniqueIdColumn))
+                        VALUES (?, ?)
+                        """
+                    for row in rows {
+                        let uniqueId: String = row[1]
+                        transaction.executeWithCachedStatement(sql: insertSql,
+                                                               arguments: [TSInteraction.collection(), uniqueId])
+                    }
+                    guard rows.count == rebuildChunkSize, let lastRow = rows.last else {
+                        keyValueStore.removeValue(forKey: rebuildCursorKey, transaction: transaction.asAnyWrite)
+                        return true
+                    }
+                    let lastId: Int = lastRow[0]
+                    keyValueStore.setInt(lastId, key: rebuildCursorKey, transaction: transaction.asAnyWrite)
+                    return false
+                } catch {
+                    owsFail("Error: \(error)")
+                }
+            }
+            // Index each chunk before enqueuing the next, so that the pending
+            // table stays small.
+            flushSync()
+            guard !isComplete else {
+                break
+            }
+        }
+        if chunkCount > 0 {
+            Logger.info("Re-indexed messages in \(chunkCount) chunks.")
+        }
+    }
+}
@@ -98,10 +98,16 @@ NSErrorDomain const SSKJobRecordErrorDomain = @"SignalServiceKit.JobRecord";
 
 - (void)updateStatus:(SSKJobRecordStatus)status transaction:(SDSAnyWriteTransaction *)transaction
 {
-    [self anyUpdateWithTransaction:transaction
-                             block:^(SSKJobRecord *record) {
-                                 record.status = status;
-                             }];
+    if (transaction.isYapWrite) {
+        [self anyUpdateWithTransaction:transaction
+                                 block:^(SSKJobRecord *record) {
+                                     record.status = status;
+                                 }];
+        return;
+    }
+
+    self.status = status;
+    [self grdbUpdateStatusAndFailureCountWithTransaction:transaction.unwrapGrdbWrite];
 }
 
 - (BOOL)saveAsStartedWithTransaction:(SDSAnyWriteTransaction *)transaction error:(NSError **)outError
@@ -149,10 +155,16 @@ NSErrorDomain const SSKJobRecordErrorDomain = @"SignalServiceKit.JobRecord";
 {
     switch (self.status) {
         case SSKJobRecordStatus_Running: {
-            [self anyUpdateWithTransaction:transaction
-                                     block:^(SSKJobRecord *record) {
-                                         record.failureCount = MIN(record.failureCount + 1, INT64_MAX);
-                                     }];
+            if (transaction.isYapWrite) {
+                [self anyUpdateWithTransaction:transaction
+                                         block:^(SSKJobRecord *record) {
+                                             record.failureCount = MIN(record.failureCount + 1, INT64_MAX);
+                                         }];
+                return YES;
+            }
+
+            self.failureCount = MIN(self.failureCount + 1, INT64_MAX);
+            [self grdbUpdateStatusAndFailureCountWithTransaction:transaction.unwrapGrdbWrite];
             return YES;
         }
         case SSKJobRecordStatus_Ready:
@@ -0,0 +1,25 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import GRDB
+
+extension SSKJobRecord {
+    // State transitions only change the status and failure count columns.
+    // Saving the whole record would re-archive its payload, e.g. the
+    // invisible message of a message sender job, on every transition.
+    //
+    // Like anyUpdate, this does nothing if the record has been removed.
+    @objc
+    public func grdbUpdateStatusAndFailureCount(transaction: GRDBWriteTransaction) {
+        let sql = """
+            UPDATE \(JobRecordRecord.databaseTableName)
+            SET \(jobRecordColumn: .status) = ?,
+                \(jobRecordColumn: .failureCount) = ?
+            WHERE \(jobRecordColumn: .uniqueId) = ?
+            """
+        transaction.executeWithCachedStatement(sql: sql,
+                                               arguments: [status.rawValue, failureCount, uniqueId])
+    }
+}
@@ -285,16 +285,19 @@ extension GRDBMediaGalleryFinder: MediaGalleryFinder {
     }
 
     func mediaIndex(attachment: TSAttachmentStream, transaction: GRDBReadTransaction) -> Int? {
-        let sql = """
-        SELECT mediaIndex
-        FROM (
-            SELECT
-                ROW_NUMBER() OVER (
-                    ORDER BY
-                        media_gallery_items.albumMessageId,
-                        media_gallery_items.originalAlbumOrder
-                ) - 1 as mediaIndex,
-                media_gallery_items.attachmentId
+        guard let attachmentRowId = attachment.grdbId else {
+            owsFailDebug("attachment.grdbId was unexpectedly nil")
+            return nil
+        }
+
+        // media_gallery_items is already a per-thread projection of the gallery,
+        // ordered by index_media_gallery_items_for_gallery. Rather than numbering
+        // every row in the thread, we look up the attachment's own record and
+        // count the records which precede it within that index. This only visits
+        // the items before the attachment, so opening the gallery on an old photo
+        // no longer scans the whole thread.
+        let anchorSql = """
+            SELECT media_gallery_items.albumMessageId, media_gallery_items.originalAlbumOrder
             FROM media_gallery_items
             INNER JOIN \(AttachmentRecord.databaseTableName)
                 ON media_gallery_items.attachmentId = model_TSAttachment.id
@@ -302,16 +305,33 @@ extension GRDBMediaGalleryFinder: MediaGalleryFinder {
             INNER JOIN \(InteractionRecord.databaseTableName)
                 ON media_gallery_items.albumMessageId = \(interactionColumnFullyQualified: .id)
                 AND \(interactionColumn: .isViewOnceMessage) = FALSE
-            WHERE media_gallery_items.threadId = ?
-        )
-        WHERE attachmentId = ?
+            WHERE media_gallery_items.attachmentId = ?
+            AND media_gallery_items.threadId = ?
         """
 
-        guard let attachmentRowId = attachment.grdbId else {
-            owsFailDebug("attachment.grdbId was unexpectedly nil")
+        guard let anchor = try! Row.fetchOne(transaction.database,
+                                             sql: anchorSql,
+                                             arguments: [attachmentRowId, threadId]) else {
             return nil
         }
+        let albumMessageId: Int64 = anchor[0]
+        let originalAlbumOrder: Int = anchor[1]
+
+        let countSql = """
+            SELECT COUNT(*)
+            FROM media_gallery_items
+            INNER JOIN \(AttachmentRecord.databaseTableName)
+                ON media_gallery_items.attachmentId = model_TSAttachment.id
+                AND IsVisualMediaContentType(\(attachmentColumn: .contentType)) IS TRUE
+            INNER JOIN \(InteractionRecord.databaseTableName)
+                ON media_gallery_items.albumMessageId = \(interactionColumnFullyQualified: .id)
+                AND \(interactionColumn: .isViewOnceMessage) = FALSE
+            WHERE media_gallery_items.threadId = ?
+            AND (media_gallery_items.albumMessageId, media_gallery_items.originalAlbumOrder) < (?, ?)
+        """
 
-        return try! Int.fetchOne(transaction.database, sql: sql, arguments: [threadId, attachmentRowId])
+        return try! Int.fetchOne(transaction.database,
+                                 sql: countSql,
+                                 arguments: [threadId, albumMessageId, originalAlbumOrder]) ?? 0
     }
 }
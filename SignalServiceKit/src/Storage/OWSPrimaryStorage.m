@@ -125,67 +125,65 @@ void VerifyRegistrationsForPrimaryStorage(OWSStorage *storage, dispatch_block_t
     //
     // All sync registrations must be done before all async registrations,
     // or the sync registrations will block on the async registrations.
+    //
+    // YapDatabase registers extensions one at a time, in the order they're
+    // requested, so we needn't wait for an extension's dependencies to
+    // complete before requesting it; it's enough to request them first.
+    // Requesting everything up front lets YapDatabase register one extension
+    // after another without waiting on the main thread in between.
+    NSDate *startDate = [NSDate new];
+
     [TSDatabaseView asyncRegisterLegacyThreadInteractionsDatabaseView:self];
 
     [TSDatabaseView asyncRegisterThreadInteractionsDatabaseView:self];
 
+    // Building this view requires TSMessageDatabaseViewExtensionName which is
+    // registered above in asyncRegisterThreadInteractionsDatabaseView.
+    [TSDatabaseView asyncRegisterThreadDatabaseView:self];
+
+    [self asyncRegisterExtension:[TSDatabaseSecondaryIndexes registerTimeStampIndex]
+                        withName:[TSDatabaseSecondaryIndexes registerTimeStampIndexExtensionName]];
+
+    [OWSMessageReceiver asyncRegisterDatabaseExtension:self];
+    [YAPDBMessageContentJobFinder asyncRegisterDatabaseExtension:self];
+
+    [TSDatabaseView asyncRegisterThreadOutgoingMessagesDatabaseView:self];
+    [TSDatabaseView asyncRegisterThreadSpecialMessagesDatabaseView:self];
+    [TSDatabaseView asyncRegisterIncompleteViewOnceMessagesDatabaseView:self];
+    [TSDatabaseView asyncRegisterInteractionsBySortIdDatabaseView:self];
+
+    [YAPDBSignalServiceAddressIndex asyncRegisterDatabaseExtensions:self];
+    [OWSIncomingMessageFinder asyncRegisterExtensionWithPrimaryStorage:self];
+    [OWSDisappearingMessagesFinder asyncRegisterDatabaseExtensions:self];
+    [OWSFailedMessagesJob asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
+    [OWSIncompleteCallsJob asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
+    [OWSFailedAttachmentDownloadsJob asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
+    [YAPDBMediaGalleryFinder asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
+    [TSDatabaseView asyncRegisterLazyRestoreAttachmentsDatabaseView:self];
+    [YAPDBJobRecordFinderSetup asyncRegisterDatabaseExtensionObjCWithStorage:self];
+    [YAPDBUserProfileFinder asyncRegisterDatabaseExtensions:self];
+
     [self.database
-        flushExtensionRequestsWithCompletionQueue:dispatch_get_main_queue()
+        flushExtensionRequestsWithCompletionQueue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
                                   completionBlock:^{
-                                      OWSAssertIsOnMainThread();
-
-                                      // Building this view requires TSMessageDatabaseViewExtensionName which is
-                                      // registered above in asyncRegisterThreadInteractionsDatabaseView.
-                                      [TSDatabaseView asyncRegisterThreadDatabaseView:self];
-
-                                      [self asyncRegisterExtension:[TSDatabaseSecondaryIndexes registerTimeStampIndex]
-                                                          withName:[TSDatabaseSecondaryIndexes
-                                                                       registerTimeStampIndexExtensionName]];
-
-                                      [OWSMessageReceiver asyncRegisterDatabaseExtension:self];
-                                      [YAPDBMessageContentJobFinder asyncRegisterDatabaseExtension:self];
-
-                                      [TSDatabaseView asyncRegisterThreadOutgoingMessagesDatabaseView:self];
-                                      [TSDatabaseView asyncRegisterThreadSpecialMessagesDatabaseView:self];
-                                      [TSDatabaseView asyncRegisterIncompleteViewOnceMessagesDatabaseView:self];
-                                      [TSDatabaseView asyncRegisterInteractionsBySortIdDatabaseView:self];
-
-                                      [YAPDBSignalServiceAddressIndex asyncRegisterDatabaseExtensions:self];
-                                      [OWSIncomingMessageFinder asyncRegisterExtensionWithPrimaryStorage:self];
-                                      [OWSDisappearingMessagesFinder asyncRegisterDatabaseExtensions:self];
-                                      [OWSFailedMessagesJob asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
-                                      [OWSIncompleteCallsJob asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
-                                      [OWSFailedAttachmentDownloadsJob
-                                          asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
-                                      [YAPDBMediaGalleryFinder asyncRegisterDatabaseExtensionsWithPrimaryStorage:self];
-                                      [TSDatabaseView asyncRegisterLazyRestoreAttachmentsDatabaseView:self];
-                                      [YAPDBJobRecordFinderSetup asyncRegisterDatabaseExtensionObjCWithStorage:self];
-                                      [YAPDBUserProfileFinder asyncRegisterDatabaseExtensions:self];
-
-                                      [self.database
-                                          flushExtensionRequestsWithCompletionQueue:dispatch_get_global_queue(
-                                                                                        DISPATCH_QUEUE_PRIORITY_DEFAULT,
-                                                                                        0)
-                                                                    completionBlock:^{
-                                                                        OWSAssertDebug(
-                                                                            !self.areAsyncRegistrationsComplete);
-                                                                        OWSLogVerbose(@"async registrations complete.");
-
-                                                                        // We verify that all database views registered
-                                                                        // successfully and are accessible on launch
-                                                                        // _before_ "database is ready".  This ensures
-                                                                        // that if a view becomes corrupted it, we
-                                                                        // detect that now and increment the view
-                                                                        // version, so that it will be rebuilt on next
-                                                                        // launch. Otherwise, the app might crash later
-                                                                        // in a place that won't increment the view
-                                                                        // version.
-                                                                        VerifyRegistrationsForPrimaryStorage(self, ^{
-                                                                            self.areAsyncRegistrationsComplete = YES;
-
-                                                                            completion();
-                                                                        });
-                                                                    }];
+                                      OWSAssertDebug(!self.areAsyncRegistrationsComplete);
+                                      OWSLogInfo(@"async registrations complete in %0.0fms.",
+                                          fabs(startDate.timeIntervalSinceNow) * 1000);
+
+                                      // We verify that all database views registered
+                                      // successfully and are accessible on launch
+                                      // _before_ "database is ready".  This ensures
+                                      // that if a view becomes corrupted it, we
+                                      // detect that now and increment the view
+                                      // version, so that it will be rebuilt on next
+                                      // launch. Otherwise, the app might crash later
+                                      // in a place that won't increment the view
+                                      // version.
+                                      VerifyRegistrationsForPrimaryStorage(self, ^{
+                                          self.areAsyncRegistrationsComplete = YES;
+
+                                          completion();
+                                      });
                                   }];
 }
 
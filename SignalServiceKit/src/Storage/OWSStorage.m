@@ -369,6 +369,11 @@ NSString *const kNSUserDefaults_DatabaseExtensionVersionMap = @"kNSUserDefaults_
 
 @property (nonatomic) NSMutableArray<NSString *> *extensionNames;
 
+// These properties should only be accessed on the main thread.
+@property (nonatomic) NSUInteger asyncRegistrationRequestCount;
+@property (nonatomic) NSUInteger asyncRegistrationCompletionCount;
+@property (nonatomic, nullable) NSDate *lastAsyncRegistrationDate;
+
 @end
 
 #pragma mark -
@@ -608,6 +613,10 @@ NSString *const kNSUserDefaults_DatabaseExtensionVersionMap = @"kNSUserDefaults_
 
 #pragma mark - Extension Registration
 
+// Registrations slower than this are logged, since they usually indicate that
+// the extension was (re)built.
+static const NSTimeInterval kAsyncRegistrationSlowThreshold = 0.1;
+
 + (void)incrementVersionOfDatabaseExtension:(NSString *)extensionName
 {
     OWSLogError(@"%@", extensionName);
@@ -730,23 +739,46 @@ NSString *const kNSUserDefaults_DatabaseExtensionVersionMap = @"kNSUserDefaults_
                       withName:(NSString *)extensionName
                     completion:(nullable dispatch_block_t)completion
 {
+    OWSAssertIsOnMainThread();
+
     extension = [self updateExtensionVersion:extension withName:extensionName];
 
     OWSAssertDebug(![self.extensionNames containsObject:extensionName]);
     [self.extensionNames addObject:extensionName];
 
+    self.asyncRegistrationRequestCount += 1;
+    NSDate *requestDate = [NSDate new];
+
     [self.database asyncRegisterExtension:extension
                                  withName:extensionName
                           completionBlock:^(BOOL ready) {
-                              if (!ready) {
-                                  OWSFailDebug(@"asyncRegisterExtension failed: %@", extensionName);
-                              } else {
-                                  if (!CurrentAppContext().isRunningTests) {
+                              dispatch_async(dispatch_get_main_queue(), ^{
+                                  // YapDatabase registers extensions one at a time, in the order they
+                                  // were requested, so this extension's registration began when the
+                                  // previous one completed. Registration is slow if it (re)builds the
+                                  // extension, e.g. after its version was incremented.
+                                  NSDate *startDate = requestDate;
+                                  if (self.lastAsyncRegistrationDate != nil &&
+                                      [self.lastAsyncRegistrationDate compare:requestDate] == NSOrderedDescending) {
+                                      startDate = self.lastAsyncRegistrationDate;
+                                  }
+                                  NSDate *completionDate = [NSDate new];
+                                  NSTimeInterval duration = [completionDate timeIntervalSinceDate:startDate];
+                                  self.lastAsyncRegistrationDate = completionDate;
+                                  self.asyncRegistrationCompletionCount += 1;
+
+                                  if (!ready) {
+                                      OWSFailDebug(@"asyncRegisterExtension failed: %@", extensionName);
+                                  } else if (duration > kAsyncRegistrationSlowThreshold) {
+                                      OWSLogInfo(@"asyncRegisterExtension succeeded: %@ (%lu of %lu) in %0.0fms",
+                                          extensionName,
+                                          (unsigned long)self.asyncRegistrationCompletionCount,
+                                          (unsigned long)self.asyncRegistrationRequestCount,
+                                          duration * 1000);
+                                  } else if (!CurrentAppContext().isRunningTests) {
                                       OWSLogVerbose(@"asyncRegisterExtension succeeded: %@", extensionName);
                                   }
-                              }
 
-                              dispatch_async(dispatch_get_main_queue(), ^{
                                   if (completion) {
                                       completion();
                                   }
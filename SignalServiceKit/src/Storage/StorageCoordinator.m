@@ -303,10 +303,17 @@ NSString *NSStringForDataStore(DataStore value)
                 if (hasUnmigratedYdbFile) {
                     self.state = StorageCoordinatorStateBeforeYDBToGRDBMigration;
 
-                    // We might want to delete any existing GRDB database
-                    // files here, since they represent an incomplete
-                    // previous migration and might cause problems.
-                    [self.databaseStorage deleteGrdbFiles];
+                    // Any existing GRDB database files represent an incomplete
+                    // previous migration. If it left checkpoints, the migration
+                    // resumes from them; otherwise we delete them, since they
+                    // might cause problems.
+                    if (SSKPreferences.hasYdbMigrationCheckpoints
+                        && SSKFeatureFlags.storageMode != StorageModeGrdbThrowawayIfMigrating) {
+                        OWSLogInfo(@"Resuming YDB-to-GRDB migration.");
+                    } else {
+                        [SSKPreferences setHasYdbMigrationCheckpoints:NO];
+                        [self.databaseStorage deleteGrdbFiles];
+                    }
                 } else {
                     self.state = StorageCoordinatorStateGRDB;
 
@@ -0,0 +1,206 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+#if TESTABLE_BUILD
+
+/// Builds a large database that resembles a long-used account, for
+/// benchmarks of whole-database work such as backup, device transfer and
+/// the YDB to GRDB migration.
+///
+/// The defaults are those of a heavy user. Messages are spread unevenly,
+/// so that a few conversations hold most of them, and a few groups are
+/// very large. Some messages have an album rather than a single
+/// attachment, and some have reactions, mostly the common emoji.
+///
+/// This is the shared fixture for benchmarks; prefer it over building
+/// large datasets with the factories, which write each model in its own
+/// transaction unless given one.
+///
+///     let fixture = DatabaseFixture()
+///     fixture.interactionCount = 1000
+///     fixture.create()
+///
+@objc
+public class DatabaseFixture: NSObject {
+
+    @objc
+    public var threadCount: UInt = 2 * 1000
+
+    @objc
+    public var interactionCount: UInt = 200 * 1000
+
+    @objc
+    public var attachmentCount: UInt = 30 * 1000
+
+    // One in this many messages with attachments has an album of
+    // several attachments.
+    @objc
+    public var albumInterval: UInt = 5
+
+    @objc
+    public var reactionCount: UInt = 20 * 1000
+
+    // One in this many threads is a group.
+    @objc
+    public var groupThreadInterval: UInt = 5
+
+    @objc
+    public var largeGroupCount: UInt = 3
+
+    @objc
+    public var largeGroupMemberCount: UInt = 1000
+
+    // The fixture is written across many transactions of this many models,
+    // so that no one transaction holds the whole fixture in memory.
+    @objc
+    public var batchSize: UInt = 1000
+
+    // The threads which were created. The first threads are the busiest.
+    @objc
+    public private(set) var threads = [TSThread]()
+
+    private var databaseStorage: SDSDatabaseStorage { .shared }
+
+    private lazy var imageData = ImageFactory().buildPNGData()
+
+    // Roughly most common first.
+    private static let reactionEmoji = ["👍", "❤️", "😂", "😮", "😢", "🙏", "🔥", "👎"]
+
+    // MARK: -
+
+    @objc
+    public func create() {
+        threads = createThreads()
+        createInteractions(threads: threads)
+    }
+
+    // Squaring skews the distribution towards the first elements.
+    private func skewedIndex(count: Int) -> Int {
+        let fraction = pow(Double.random(in: 0..<1), 2)
+        return Int(fraction * Double(count))
+    }
+
+    private func createThreads() -> [TSThread] {
+        let contactThreadFactory = ContactThreadFactory()
+        let groupThreadFactory = GroupThreadFactory()
+        let largeGroupThreadFactory = GroupThreadFactory()
+        let largeGroupMemberCount = self.largeGroupMemberCount
+        largeGroupThreadFactory.memberAddressesBuilder = {
+            (0..<largeGroupMemberCount).map { _ in CommonGenerator.address() }
+        }
+
+        var threads = [TSThread]()
+        createInBatches(count: threadCount) { index, transaction in
+            if index < self.largeGroupCount {
+                threads.append(largeGroupThreadFactory.create(transaction: transaction))
+            } else if index % self.groupThreadInterval == 0 {
+                threads.append(groupThreadFactory.create(transaction: transaction))
+            } else {
+                threads.append(contactThreadFactory.create(transaction: transaction))
+            }
+        }
+        return threads
+    }
+
+    private func createInteractions(threads: [TSThread]) {
+        guard !threads.isEmpty else { return }
+
+        var thread = threads[0]
+        let incomingMessageFactory = IncomingMessageFactory()
+        incomingMessageFactory.threadCreator = { _ in thread }
+        let outgoingMessageFactory = OutgoingMessageFactory()
+        outgoingMessageFactory.threadCreator = { _ in thread }
+
+        let attachmentInterval = max(1, interactionCount / max(1, attachmentCount))
+        var createdAttachmentCount: UInt = 0
+        // Most messages with reactions have one, some have a few.
+        let reactionInterval = max(1, interactionCount / max(1, reactionCount))
+        var createdReactionCount: UInt = 0
+
+        createInBatches(count: interactionCount) { index, transaction in
+            thread = threads[self.skewedIndex(count: threads.count)]
+
+            var attachmentIds = [String]()
+            if index % attachmentInterval == 0, createdAttachmentCount < self.attachmentCount {
+                let isAlbum = (index / attachmentInterval) % self.albumInterval == 1
+                let albumCount = isAlbum ? UInt.random(in: 2...4) : 1
+                let count = min(albumCount, self.attachmentCount - createdAttachmentCount)
+                for _ in 0..<count {
+                    attachmentIds.append(self.createImageAttachment(transaction: transaction).uniqueId)
+                }
+                createdAttachmentCount += count
+            }
+
+            let messageBody = index % 10 == 3 ? CommonGenerator.paragraph : CommonGenerator.sentence
+            let message: TSMessage
+            if Bool.random() {
+                incomingMessageFactory.messageBodyBuilder = { messageBody }
+                incomingMessageFactory.attachmentIdsBuilder = { attachmentIds }
+                message = incomingMessageFactory.create(transaction: transaction)
+            } else {
+                outgoingMessageFactory.messageBodyBuilder = { messageBody }
+                outgoingMessageFactory.attachmentIdsBuilder = { attachmentIds }
+                message = outgoingMessageFactory.create(transaction: transaction)
+            }
+
+            if index % reactionInterval == 0, createdReactionCount < self.reactionCount {
+                createdReactionCount += self.createReactions(message: message,
+                                                             thread: thread,
+                                                             maxCount: self.reactionCount - createdReactionCount,
+                                                             transaction: transaction)
+            }
+        }
+
+        Logger.info("Created \(threads.count) threads, \(interactionCount) interactions, \(createdAttachmentCount) attachments and \(createdReactionCount) reactions.")
+    }
+
+    // Returns the number of reactions which were created.
+    private func createReactions(message: TSMessage,
+                                 thread: TSThread,
+                                 maxCount: UInt,
+                                 transaction: SDSAnyWriteTransaction) -> UInt {
+        // Each reactor can only have one reaction to a message.
+        var reactors = thread.recipientAddresses
+        if reactors.isEmpty {
+            reactors = [CommonGenerator.address()]
+        }
+        let count = min(maxCount, UInt(min(reactors.count, skewedIndex(count: 4) + 1)))
+        for (offset, reactor) in reactors.shuffled().prefix(Int(count)).enumerated() {
+            let emoji = Self.reactionEmoji[skewedIndex(count: Self.reactionEmoji.count)]
+            let timestamp = message.timestamp + UInt64(offset + 1) * kMinuteInMs
+            message.recordReaction(for: reactor,
+                                   emoji: emoji,
+                                   sentAtTimestamp: timestamp,
+                                   receivedAtTimestamp: timestamp,
+                                   transaction: transaction)
+        }
+        return count
+    }
+
+    private func createImageAttachment(transaction: SDSAnyWriteTransaction) -> TSAttachmentStream {
+        let dataSource = DataSourceValue.dataSource(with: imageData, fileExtension: "png")!
+        return AttachmentStreamFactory.create(contentType: OWSMimeTypeImagePng,
+                                              dataSource: dataSource,
+                                              transaction: transaction)
+    }
+
+    private func createInBatches(count: UInt, block: @escaping (UInt, SDSAnyWriteTransaction) -> Void) {
+        var index: UInt = 0
+        while index < count {
+            let batchEnd = min(count, index + batchSize)
+            databaseStorage.write { transaction in
+                while index < batchEnd {
+                    autoreleasepool {
+                        block(index, transaction)
+                    }
+                    index += 1
+                }
+            }
+        }
+    }
+}
+
+#endif
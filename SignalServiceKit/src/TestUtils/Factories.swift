@@ -46,6 +46,7 @@ public protocol Factory {
 
     func create(count: UInt) -> [ObjectType]
     func create(count: UInt, transaction: SDSAnyWriteTransaction) -> [ObjectType]
+    func create(count: UInt, batchSize: UInt) -> [ObjectType]
 }
 
 public extension Factory {
@@ -87,6 +88,27 @@ public extension Factory {
     func create(count: UInt, transaction: SDSAnyWriteTransaction) -> [ObjectType] {
         return (0..<count).map { _ in return create(transaction: transaction) }
     }
+
+    // Creates the objects across transactions of at most batchSize objects
+    // each, so that creating many objects neither needs a transaction per
+    // object nor holds them all in one transaction. See also DatabaseFixture.
+    func create(count: UInt, batchSize: UInt) -> [ObjectType] {
+        owsAssertDebug(batchSize > 0)
+
+        var items: [ObjectType] = []
+        items.reserveCapacity(Int(count))
+        while items.count < count {
+            let batchCount = min(max(1, batchSize), count - UInt(items.count))
+            write { transaction in
+                for _ in 0..<batchCount {
+                    autoreleasepool {
+                        items.append(self.create(transaction: transaction))
+                    }
+                }
+            }
+        }
+        return items
+    }
 }
 
 @objc
@@ -0,0 +1,248 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+#if TESTABLE_BUILD
+
+/// Generates a synthetic load for the incoming message pipeline, so that we
+/// can measure its throughput and the latency of each of its stages.
+///
+/// A handful of fake senders establish sessions with the local client. The
+/// generator then builds a mix of envelopes from them, encrypted for those
+/// sessions, and pushes them through OWSMessageReceiver as if they had
+/// arrived from the service. The per-stage latencies are collected by
+/// MessagePipelineTimings.
+public class MessagePipelineLoadGenerator {
+
+    public enum EnvelopeKind: CaseIterable, CustomStringConvertible {
+        case text
+        case attachmentPointer
+        case receipt
+        case groupUpdate
+
+        public var description: String {
+            switch self {
+            case .text:
+                return "text"
+            case .attachmentPointer:
+                return "attachment pointer"
+            case .receipt:
+                return "receipt"
+            case .groupUpdate:
+                return "group update"
+            }
+        }
+    }
+
+    public struct Report {
+        public let envelopeCount: Int
+        public let visibleEnvelopeCount: Int
+        public let duration: TimeInterval
+        /// See MessagePipelineTimings.summary.
+        public let stageSummary: String
+
+        public var messagesPerSecond: Double {
+            guard duration > 0 else {
+                return 0
+            }
+            return Double(visibleEnvelopeCount) / duration
+        }
+
+        public var logDescription: String {
+            var lines = [String(format: "Processed %ld of %ld envelopes in %0.2fs: %0.1f messages/s.",
+                                visibleEnvelopeCount,
+                                envelopeCount,
+                                duration,
+                                messagesPerSecond)]
+            if !stageSummary.isEmpty {
+                lines.append(stageSummary)
+            }
+            return lines.joined(separator: "\n")
+        }
+    }
+
+    // MARK: - Dependencies
+
+    private var messageReceiver: OWSMessageReceiver {
+        return SSKEnvironment.shared.messageReceiver
+    }
+
+    private var timings: MessagePipelineTimings {
+        return SSKEnvironment.shared.messagePipelineSupervisor.timings
+    }
+
+    // MARK: -
+
+    private static let groupCount = 3
+
+    public let kinds: [EnvelopeKind]
+
+    private let localClient = LocalSignalClient()
+    private let runner = TestProtocolRunner()
+    private let senderClients: [FakeSignalClient]
+    private let groupIds: [Data]
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    // Envelopes are keyed by timestamp, so each must have a distinct one.
+    private var nextTimestamp = NSDate.ows_millisecondTimeStamp()
+    private var sentTimestamps = [UInt64]()
+
+    public init(senderCount: Int = 4, kinds: [EnvelopeKind] = EnvelopeKind.allCases) {
+        owsAssertDebug(senderCount > 0)
+        owsAssertDebug(!kinds.isEmpty)
+
+        self.kinds = kinds
+        self.senderClients = (0..<senderCount).map { _ in FakeSignalClient.generate() }
+        self.groupIds = (0..<Self.groupCount).map { _ in Randomness.generateRandomBytes(Int32(kGroupIdLengthV1)) }
+    }
+
+    /// Establishes sessions between the fake senders and the local client.
+    /// This should be called once, before building any envelopes.
+    public func prepare(transaction: SDSAnyWriteTransaction) throws {
+        for senderClient in senderClients {
+            try runner.initialize(senderClient: senderClient,
+                                  recipientClient: localClient,
+                                  transaction: transaction)
+        }
+    }
+
+    /// Builds envelopes which cycle through the kinds and senders.
+    public func buildEnvelopeDatas(count: Int, transaction: SDSAnyWriteTransaction) throws -> [Data] {
+        try (0..<count).map { index in
+            let kind = kinds[index % kinds.count]
+            let senderClient = senderClients[index % senderClients.count]
+            return try buildEnvelopeData(kind: kind, senderClient: senderClient, transaction: transaction)
+        }
+    }
+
+    /// Pushes the envelopes through the pipeline and resolves once they have
+    /// all become visible or the timeout has elapsed, whichever comes first.
+    ///
+    /// This resets MessagePipelineTimings, so that the report only reflects
+    /// this load.
+    public func run(envelopeDatas: [Data], timeout: TimeInterval = 60) -> Promise<Report> {
+        timings.reset()
+
+        let startTime = CACurrentMediaTime()
+        for envelopeData in envelopeDatas {
+            messageReceiver.handleReceivedEnvelopeData(envelopeData, serverDeliveryTimestamp: 0)
+        }
+
+        let (promise, resolver) = Promise<Report>.pending()
+        waitForVisibleEnvelopes(envelopeCount: envelopeDatas.count,
+                                startTime: startTime,
+                                timeout: timeout,
+                                resolver: resolver)
+        return promise
+    }
+
+    private func waitForVisibleEnvelopes(envelopeCount: Int,
+                                         startTime: CFTimeInterval,
+                                         timeout: TimeInterval,
+                                         resolver: Resolver<Report>) {
+        let visibleEnvelopeCount = Int(timings.visibleEnvelopeCount)
+        let duration = CACurrentMediaTime() - startTime
+        guard visibleEnvelopeCount >= envelopeCount || duration >= timeout else {
+            DispatchQueue.global().asyncAfter(deadline: .now() + 0.05) {
+                self.waitForVisibleEnvelopes(envelopeCount: envelopeCount,
+                                             startTime: startTime,
+                                             timeout: timeout,
+                                             resolver: resolver)
+            }
+            return
+        }
+        if visibleEnvelopeCount < envelopeCount {
+            Logger.warn("Timed out after \(visibleEnvelopeCount) of \(envelopeCount) envelopes became visible.")
+        }
+        resolver.fulfill(Report(envelopeCount: envelopeCount,
+                                visibleEnvelopeCount: visibleEnvelopeCount,
+                                duration: duration,
+                                stageSummary: timings.summary))
+    }
+
+    // MARK: - Envelopes
+
+    private func buildEnvelopeData(kind: EnvelopeKind,
+                                   senderClient: FakeSignalClient,
+                                   transaction: SDSAnyWriteTransaction) throws -> Data {
+        let timestamp: UInt64 = unfairLock.withLock {
+            let timestamp = nextTimestamp
+            nextTimestamp += 1
+            return timestamp
+        }
+
+        let contentBuilder = SSKProtoContent.builder()
+        switch kind {
+        case .text, .attachmentPointer, .groupUpdate:
+            contentBuilder.setDataMessage(try buildDataMessage(kind: kind, timestamp: timestamp))
+        case .receipt:
+            contentBuilder.setReceiptMessage(try buildReceiptMessage())
+        }
+        let plaintext = try contentBuilder.buildSerializedData()
+
+        let cipherMessage = try runner.encrypt(plaintext: plaintext,
+                                               senderClient: senderClient,
+                                               recipientAccountId: localClient.accountId(transaction: transaction),
+                                               protocolContext: transaction)
+        owsAssertDebug(cipherMessage is WhisperMessage)
+
+        let envelopeBuilder = SSKProtoEnvelope.builder(timestamp: timestamp)
+        envelopeBuilder.setType(.ciphertext)
+        envelopeBuilder.setSourceE164(senderClient.e164Identifier!)
+        envelopeBuilder.setSourceUuid(senderClient.uuidIdentifier)
+        envelopeBuilder.setSourceDevice(senderClient.deviceId)
+        envelopeBuilder.setContent(cipherMessage.serialized())
+        return try envelopeBuilder.buildSerializedData()
+    }
+
+    private func buildDataMessage(kind: EnvelopeKind, timestamp: UInt64) throws -> SSKProtoDataMessage {
+        let dataMessageBuilder = SSKProtoDataMessage.builder()
+        dataMessageBuilder.setTimestamp(timestamp)
+        switch kind {
+        case .text:
+            dataMessageBuilder.setBody(CommonGenerator.paragraph)
+            // Later receipts refer to these messages.
+            unfairLock.withLock {
+                sentTimestamps.append(timestamp)
+            }
+        case .attachmentPointer:
+            // The pointer refers to a nonexistent CDN object, so the
+            // download will fail; we only measure the pipeline.
+            let pointerBuilder = SSKProtoAttachmentPointer.builder()
+            pointerBuilder.setCdnID(UInt64.random(in: 1..<UInt64.max))
+            pointerBuilder.setKey(Randomness.generateRandomBytes(64))
+            pointerBuilder.setDigest(Randomness.generateRandomBytes(32))
+            pointerBuilder.setContentType(OWSMimeTypeImageJpeg)
+            pointerBuilder.setSize(UInt32.random(in: 10_000..<1_000_000))
+            dataMessageBuilder.addAttachments(try pointerBuilder.build())
+            dataMessageBuilder.setBody(CommonGenerator.sentence)
+        case .groupUpdate:
+            let groupId = groupIds[Int(timestamp % UInt64(groupIds.count))]
+            let groupContextBuilder = SSKProtoGroupContext.builder(id: groupId)
+            groupContextBuilder.setType(.update)
+            groupContextBuilder.setName(CommonGenerator.words(count: 3))
+            let memberE164s = senderClients.compactMap { $0.e164Identifier } + [localClient.e164Identifier].compactMap { $0 }
+            groupContextBuilder.setMembersE164(memberE164s)
+            dataMessageBuilder.setGroup(try groupContextBuilder.build())
+        case .receipt:
+            owsFailDebug("Receipts are not data messages.")
+        }
+        return try dataMessageBuilder.build()
+    }
+
+    private func buildReceiptMessage() throws -> SSKProtoReceiptMessage {
+        let receiptBuilder = SSKProtoReceiptMessage.builder()
+        receiptBuilder.setType(Bool.random() ? .delivery : .read)
+        let timestamps: [UInt64] = unfairLock.withLock {
+            sentTimestamps.isEmpty ? [nextTimestamp] : Array(sentTimestamps.suffix(3))
+        }
+        receiptBuilder.setTimestamp(timestamps)
+        return try receiptBuilder.build()
+    }
+}
+
+#endif
@@ -113,7 +113,7 @@ NS_ASSUME_NONNULL_BEGIN
     AppExpiry *appExpiry = [AppExpiry new];
 
     self = [super initWithContactsManager:contactsManager
-                       linkPreviewManager:linkPreviewManager
+                  linkPreviewManagerBlock:^{ return linkPreviewManager; }
                             messageSender:messageSender
                     messageSenderJobQueue:messageSenderJobQueue
                pendingReadReceiptRecorder:[NoopPendingReadReceiptRecorder new]
@@ -155,8 +155,8 @@ NS_ASSUME_NONNULL_BEGIN
                         messageProcessing:messageProcessing
                         messageFetcherJob:messageFetcherJob
                          bulkProfileFetch:bulkProfileFetch
-                           bulkUUIDLookup:bulkUUIDLookup
-                        versionedProfiles:versionedProfiles
+                      bulkUUIDLookupBlock:^{ return bulkUUIDLookup; }
+                   versionedProfilesBlock:^{ return versionedProfiles; }
                           modelReadCaches:modelReadCaches
                       earlyMessageManager:earlyMessageManager
                 messagePipelineSupervisor:messagePipelineSupervisor
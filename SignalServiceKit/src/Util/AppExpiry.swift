@@ -43,7 +43,8 @@ public class AppExpiry: NSObject {
             owsAssertDebug(mode != .atDate || expirationDate != nil)
         }
     }
-    private let expirationState = AtomicValue<ExpirationState>(.init(mode: .default))
+    // This is read for every network request, but rarely changes.
+    private let expirationState = AtomicSnapshot<ExpirationState>(.init(mode: .default))
     private static let expirationStateKey = "expirationState"
 
     @objc
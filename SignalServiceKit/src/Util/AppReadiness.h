@@ -17,6 +17,13 @@ typedef void (^AppReadyBlock)(void);
 // This method should only be called on the main thread.
 + (void)setAppIsReady;
 
+// This should be called once the first frame of the app's initial UI has
+// rendered. If it isn't called soon after the app becomes ready, or the app
+// is launched in the background, we don't wait for it.
+//
+// This method should only be called on the main thread.
++ (void)setFirstFrameDidRender;
+
 // If the app is ready, the block is called immediately;
 // otherwise it is called when the app becomes ready.
 //
@@ -36,9 +43,25 @@ typedef void (^AppReadyBlock)(void);
 //   can be safely delayed for a second or two after the app becomes ready.
 // * We should use the "polite" flavor of "did become ready" blocks wherever possible
 //   since they avoid a stampede of activity on launch.
-+ (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block NS_SWIFT_NAME(runNowOrWhenAppWillBecomeReady(_:));
-+ (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block NS_SWIFT_NAME(runNowOrWhenAppDidBecomeReady(_:));
-+ (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block NS_SWIFT_NAME(runNowOrWhenAppDidBecomeReadyPolite(_:));
+// * The "polite" blocks are performed one at a time once the first frame has
+//   rendered, so that they don't compete with it.
+//
+// * We should use the "idle" flavor of "did become ready" blocks for work that
+//   can wait until the app settles, e.g. audits and cleanup. They are performed
+//   after the "polite" blocks, in short slices of main thread time.
+//
+// * Each block is labeled with its call site, so that we can log the slowest
+//   blocks. Swift callers use the refinements in AppReadiness.swift, which
+//   label blocks with their file and line.
++ (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block NS_SWIFT_UNAVAILABLE("Use the Swift refinement.");
++ (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block NS_SWIFT_UNAVAILABLE("Use the Swift refinement.");
++ (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block NS_SWIFT_UNAVAILABLE("Use the Swift refinement.");
++ (void)runNowOrWhenAppDidBecomeReadyIdle:(AppReadyBlock)block NS_SWIFT_UNAVAILABLE("Use the Swift refinement.");
+
++ (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block label:(NSString *)label NS_REFINED_FOR_SWIFT;
++ (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block label:(NSString *)label NS_REFINED_FOR_SWIFT;
++ (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block label:(NSString *)label NS_REFINED_FOR_SWIFT;
++ (void)runNowOrWhenAppDidBecomeReadyIdle:(AppReadyBlock)block label:(NSString *)label NS_REFINED_FOR_SWIFT;
 
 @end
 
@@ -3,6 +3,7 @@
 //
 
 #import "AppReadiness.h"
+#import "OWSThreadStackSampler.h"
 #import <SignalCoreKit/Threading.h>
 #import <SignalServiceKit/SignalServiceKit-Swift.h>
 
@@ -11,11 +12,17 @@ NS_ASSUME_NONNULL_BEGIN
 @interface AppReadiness ()
 
 @property (nonatomic, readonly) ReadyFlag *readyFlag;
+// Polite and idle blocks are enqueued on this flag once the app is ready,
+// so that they are deferred until the first frame has rendered.
+@property (nonatomic, readonly) ReadyFlag *firstFrameFlag;
 
 @end
 
 #pragma mark -
 
+// How long after the app becomes ready we wait for the first frame.
+static const NSTimeInterval kFirstFrameTimeout = 2.0;
+
 @implementation AppReadiness
 
 + (instancetype)shared
@@ -39,10 +46,22 @@ NS_ASSUME_NONNULL_BEGIN
     OWSSingletonAssert();
 
     _readyFlag = [[ReadyFlag alloc] initWithName:@"AppReadiness" queueMode:QueueModeMainThreadOnly];
+    _firstFrameFlag = [[ReadyFlag alloc] initWithName:@"AppReadinessFirstFrame" queueMode:QueueModeMainThreadOnly];
 
     return self;
 }
 
+// ObjC callers are labeled with their return address, which can be
+// symbolicated like a crash report frame.
++ (NSString *)labelForCallerAtAddress:(uintptr_t)returnAddress
+{
+    if (self.isAppReady) {
+        // The block will be performed immediately, so it needn't be labeled.
+        return @"";
+    }
+    return [OWSThreadStackSampler describeReturnAddress:returnAddress];
+}
+
 + (BOOL)isAppReady
 {
     AppReadiness *instance = self.shared;
@@ -51,10 +70,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block
 {
-    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppWillBecomeReady:block]; });
+    uintptr_t returnAddress = (uintptr_t)__builtin_return_address(0);
+    [self runNowOrWhenAppWillBecomeReady:block label:[self labelForCallerAtAddress:returnAddress]];
 }
 
-- (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block
++ (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block label:(NSString *)label
+{
+    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppWillBecomeReady:block label:label]; });
+}
+
+- (void)runNowOrWhenAppWillBecomeReady:(AppReadyBlock)block label:(NSString *)label
 {
     OWSAssertIsOnMainThread();
     OWSAssertDebug(block);
@@ -64,15 +89,21 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
 
-    [self.readyFlag runNowOrWhenWillBecomeReady:block];
+    [self.readyFlag runNowOrWhenWillBecomeReady:block label:label];
 }
 
 + (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block
 {
-    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppDidBecomeReady:block]; });
+    uintptr_t returnAddress = (uintptr_t)__builtin_return_address(0);
+    [self runNowOrWhenAppDidBecomeReady:block label:[self labelForCallerAtAddress:returnAddress]];
+}
+
++ (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block label:(NSString *)label
+{
+    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppDidBecomeReady:block label:label]; });
 }
 
-- (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block
+- (void)runNowOrWhenAppDidBecomeReady:(AppReadyBlock)block label:(NSString *)label
 {
     OWSAssertIsOnMainThread();
     OWSAssertDebug(block);
@@ -82,12 +113,18 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
 
-    [self.readyFlag runNowOrWhenDidBecomeReady:block];
+    [self.readyFlag runNowOrWhenDidBecomeReady:block label:label];
 }
 
 + (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block
 {
-    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppDidBecomeReadyPolite:block]; });
+    uintptr_t returnAddress = (uintptr_t)__builtin_return_address(0);
+    [self runNowOrWhenAppDidBecomeReadyPolite:block label:[self labelForCallerAtAddress:returnAddress]];
+}
+
++ (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block label:(NSString *)label
+{
+    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppDidBecomeReadyPolite:block label:label]; });
 }
 
 // We now have many (36+ in best case; many more in worst case)
@@ -105,7 +142,7 @@ NS_ASSUME_NONNULL_BEGIN
 // perform them one-by-one with slight delays between them to
 // reduce the risk of starving the main thread, especially if
 // any given block is expensive.
-- (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block
+- (void)runNowOrWhenAppDidBecomeReadyPolite:(AppReadyBlock)block label:(NSString *)label
 {
     OWSAssertIsOnMainThread();
     OWSAssertDebug(block);
@@ -115,7 +152,33 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
 
-    [self.readyFlag runNowOrWhenDidBecomeReadyPolite:block];
+    [self.readyFlag runNowOrWhenDidBecomeReady:^{ [self.firstFrameFlag runNowOrWhenDidBecomeReadyPolite:block label:label]; }
+                                         label:label];
+}
+
++ (void)runNowOrWhenAppDidBecomeReadyIdle:(AppReadyBlock)block
+{
+    uintptr_t returnAddress = (uintptr_t)__builtin_return_address(0);
+    [self runNowOrWhenAppDidBecomeReadyIdle:block label:[self labelForCallerAtAddress:returnAddress]];
+}
+
++ (void)runNowOrWhenAppDidBecomeReadyIdle:(AppReadyBlock)block label:(NSString *)label
+{
+    DispatchMainThreadSafe(^{ [self.shared runNowOrWhenAppDidBecomeReadyIdle:block label:label]; });
+}
+
+- (void)runNowOrWhenAppDidBecomeReadyIdle:(AppReadyBlock)block label:(NSString *)label
+{
+    OWSAssertIsOnMainThread();
+    OWSAssertDebug(block);
+
+    if (CurrentAppContext().isRunningTests) {
+        // We don't need to do any "on app ready" work in the tests.
+        return;
+    }
+
+    [self.readyFlag runNowOrWhenDidBecomeReady:^{ [self.firstFrameFlag runNowOrWhenDidBecomeReadyIdle:block label:label]; }
+                                         label:label];
 }
 
 + (void)setAppIsReady
@@ -130,7 +193,39 @@ NS_ASSUME_NONNULL_BEGIN
 
     OWSLogInfo(@"");
 
-    [self.readyFlag setIsReady];
+    [LaunchTimer.shared measurePhase:LaunchPhaseAppReadiness block:^{ [self.readyFlag setIsReady]; }];
+
+    if (!CurrentAppContext().isMainApp || CurrentAppContext().isInBackground) {
+        // There's no first frame to wait for.
+        [self setFirstFrameDidRender];
+    } else {
+        // Don't defer the polite and idle blocks indefinitely, e.g. if the
+        // initial UI doesn't report its first frame.
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kFirstFrameTimeout * NSEC_PER_SEC)),
+            dispatch_get_main_queue(),
+            ^{
+                if (!self.firstFrameFlag.isSet) {
+                    OWSLogWarn(@"First frame didn't render in time.");
+                    [self setFirstFrameDidRender];
+                }
+            });
+    }
+}
+
++ (void)setFirstFrameDidRender
+{
+    [self.shared setFirstFrameDidRender];
+}
+
+- (void)setFirstFrameDidRender
+{
+    OWSAssertIsOnMainThread();
+
+    if (!self.readyFlag.isSet || self.firstFrameFlag.isSet) {
+        return;
+    }
+
+    [self.firstFrameFlag setIsReady];
 }
 
 @end
@@ -0,0 +1,41 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Label each block with its call site; see AppReadiness.h.
+public extension AppReadiness {
+
+    static func runNowOrWhenAppWillBecomeReady(file: String = #file,
+                                               line: Int = #line,
+                                               _ block: @escaping AppReadyBlock) {
+        __runNowOrWhenAppWillBecomeReady(block, label: label(file: file, line: line))
+    }
+
+    static func runNowOrWhenAppDidBecomeReady(file: String = #file,
+                                              line: Int = #line,
+                                              _ block: @escaping AppReadyBlock) {
+        __runNowOrWhenAppDidBecomeReady(block, label: label(file: file, line: line))
+    }
+
+    static func runNowOrWhenAppDidBecomeReadyPolite(file: String = #file,
+                                                    line: Int = #line,
+                                                    _ block: @escaping AppReadyBlock) {
+        __runNowOrWhenAppDidBecomeReadyPolite(block, label: label(file: file, line: line))
+    }
+
+    static func runNowOrWhenAppDidBecomeReadyIdle(file: String = #file,
+                                                  line: Int = #line,
+                                                  _ block: @escaping AppReadyBlock) {
+        __runNowOrWhenAppDidBecomeReadyIdle(block, label: label(file: file, line: line))
+    }
+
+    private static func label(file: String, line: Int) -> String {
+        guard !isAppReady else {
+            // The block will be performed immediately, so it needn't be labeled.
+            return ""
+        }
+        return "\((file as NSString).lastPathComponent):\(line)"
+    }
+}
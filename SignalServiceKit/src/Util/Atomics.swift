@@ -102,6 +102,12 @@ public class AtomicUInt: NSObject {
     public func increment() -> UInt {
         return value.map { $0 + 1 }
     }
+
+    @discardableResult
+    @objc
+    public func add(_ delta: UInt) -> UInt {
+        return value.map { $0 + delta }
+    }
 }
 
 // MARK: -
@@ -215,6 +221,45 @@ extension AtomicOptional where T: Equatable {
 
 // MARK: -
 
+// Holds a value, usually an immutable snapshot, which is read far more often
+// than it is replaced.
+//
+// Unlike AtomicValue, readers only take a shared lock of this instance, so
+// they do not contend with each other or with other atomics.
+public final class AtomicSnapshot<T> {
+    private let lock = ReadWriteLock()
+    private var value: T
+
+    public required init(_ value: T) {
+        self.value = value
+    }
+
+    public func get() -> T {
+        lock.withReadLock {
+            return self.value
+        }
+    }
+
+    public func set(_ value: T) {
+        lock.withWriteLock {
+            self.value = value
+        }
+    }
+
+    // Replace the current value with one derived from it. The block should be
+    // cheap: readers wait while it runs.
+    @discardableResult
+    public func update(_ block: (T) -> T) -> T {
+        lock.withWriteLock {
+            let newValue = block(self.value)
+            self.value = newValue
+            return newValue
+        }
+    }
+}
+
+// MARK: -
+
 public class AtomicArray<T> {
 
     private var values: [T]
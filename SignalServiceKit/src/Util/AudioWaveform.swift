@@ -258,7 +258,9 @@ public class AudioWaveform: NSObject {
 
     /// The maximum duration asset that we will display waveforms for.
     /// It's too intensive to sample a waveform for really long audio files.
-    fileprivate static let maximumDuration: TimeInterval = 10 * kMinuteInterval
+    ///
+    /// Sampling uses constant memory, so this only bounds the time spent decoding.
+    fileprivate static let maximumDuration: TimeInterval = 30 * kMinuteInterval
 
     private weak var sampleOperation: Operation?
 
@@ -407,10 +409,8 @@ private class AudioWaveformSamplingOperation: Operation {
     }
 
     private func readDecibels(from assetReader: AVAssetReader) -> [Float] {
-        var outputSamples = [Float]()
-        var readBuffer = Data()
-
-        let samplesToGroup = max(1, sampleCount(from: assetReader) / AudioWaveform.sampleCount)
+        let sampler = AudioWaveformDecibelSampler(groupSize: sampleCount(from: assetReader) / AudioWaveform.sampleCount)
+        var copyBuffer = [Int16]()
 
         assetReader.startReading()
         while assetReader.status == .reading {
@@ -429,30 +429,39 @@ private class AudioWaveformSamplingOperation: Operation {
                     break
             }
 
-            var readBufferLength = 0
-            var readBufferPointer: UnsafeMutablePointer<Int8>?
-            CMBlockBufferGetDataPointer(
-                blockBuffer,
-                atOffset: 0,
-                lengthAtOffsetOut: &readBufferLength,
-                totalLengthOut: nil,
-                dataPointerOut: &readBufferPointer
-            )
-            readBuffer.append(UnsafeBufferPointer(start: readBufferPointer, count: readBufferLength))
-            CMSampleBufferInvalidate(nextSampleBuffer)
-
-            // Try and process any pending samples, we may not have read enough data yet to do this.
-            let processedSamples = convertToDecibels(fromAmplitudes: readBuffer, from: assetReader, groupSize: samplesToGroup)
-            outputSamples += processedSamples
-
-            // If we successfully processed samples, remove any processed samples
-            // from the read buffer.
-            if processedSamples.count > 0 {
-                readBuffer.removeFirst(processedSamples.count * samplesToGroup * MemoryLayout<Int16>.size)
+            // Each sample buffer is sampled, then released, before the next one
+            // is read, so memory use doesn't grow with the length of the audio.
+            let amplitudeCount = CMBlockBufferGetDataLength(blockBuffer) / MemoryLayout<Int16>.size
+            var dataPointer: UnsafeMutablePointer<Int8>?
+            if CMBlockBufferIsRangeContiguous(blockBuffer, atOffset: 0, length: 0),
+               CMBlockBufferGetDataPointer(blockBuffer,
+                                           atOffset: 0,
+                                           lengthAtOffsetOut: nil,
+                                           totalLengthOut: nil,
+                                           dataPointerOut: &dataPointer) == kCMBlockBufferNoErr,
+               let dataPointer = dataPointer {
+                dataPointer.withMemoryRebound(to: Int16.self, capacity: amplitudeCount) { amplitudes in
+                    sampler.append(amplitudes: amplitudes, count: amplitudeCount)
+                }
+            } else {
+                if copyBuffer.count < amplitudeCount {
+                    copyBuffer = [Int16](repeating: 0, count: amplitudeCount)
+                }
+                copyBuffer.withUnsafeMutableBufferPointer { amplitudes in
+                    guard CMBlockBufferCopyDataBytes(blockBuffer,
+                                                     atOffset: 0,
+                                                     dataLength: amplitudeCount * MemoryLayout<Int16>.size,
+                                                     destination: amplitudes.baseAddress!) == kCMBlockBufferNoErr else {
+                        owsFailDebug("Could not copy sample buffer.")
+                        return
+                    }
+                    sampler.append(amplitudes: amplitudes.baseAddress!, count: amplitudeCount)
+                }
             }
+            CMSampleBufferInvalidate(nextSampleBuffer)
         }
 
-        return outputSamples
+        return sampler.decibelSamples
     }
 
     private func sampleCount(from assetReader: AVAssetReader) -> Int {
@@ -477,64 +486,75 @@ private class AudioWaveformSamplingOperation: Operation {
 
         return channelCount
     }
+}
 
-    private func convertToDecibels(fromAmplitudes sampleBuffer: Data, from assetReader: AVAssetReader, groupSize: Int) -> [Float] {
-        var downSampledData = [Float]()
-
-        sampleBuffer.withUnsafeBytes { samples in
-            let sampleLength = sampleBuffer.count / MemoryLayout<Int16>.size
-            var decibelSamples = [Float](repeating: 0.0, count: sampleLength)
+// MARK: -
 
-            // maximum amplitude storable in Int16 = 0 dB (loudest)
-            var zeroDecibelEquivalent: Float = Float(Int16.max)
+// Converts amplitudes to decibels and averages them in groups of a fixed
+// size as they arrive, so that sampling an audio file doesn't require
+// holding all of its samples in memory.
+//
+// Any trailing partial group is discarded.
+final class AudioWaveformDecibelSampler {
+    let groupSize: Int
 
-            var loudestClipValue: Float = 0.0
-            var quietestClipValue = AudioWaveform.silenceDecibelThreshold
-            let samplesToProcess = vDSP_Length(sampleLength)
+    private(set) var decibelSamples = [Float]()
 
-            // convert 16bit int amplitudes to float representation
-            vDSP_vflt16([Int16](samples.bindMemory(to: Int16.self)), 1, &decibelSamples, 1, samplesToProcess)
+    private var groupSum: Double = 0
+    private var groupSampleCount = 0
 
-            // take the absolute amplitude value
-            vDSP_vabs(decibelSamples, 1, &decibelSamples, 1, samplesToProcess)
+    // Reused across calls to append().
+    private var decibelBuffer = [Float]()
 
-            // convert to dB
-            vDSP_vdbcon(decibelSamples, 1, &zeroDecibelEquivalent, &decibelSamples, 1, samplesToProcess, 1)
+    init(groupSize: Int) {
+        self.groupSize = max(1, groupSize)
+    }
 
-            // clip between loudest + quietest
-            vDSP_vclip(decibelSamples, 1, &quietestClipValue, &loudestClipValue, &decibelSamples, 1, samplesToProcess)
+    func append(amplitudes: UnsafePointer<Int16>, count: Int) {
+        guard count > 0 else { return }
 
-            let sampleCount = sampleLength / groupSize
-            downSampledData = downsample(samples: decibelSamples, toSampleCount: sampleCount)
+        if decibelBuffer.count < count {
+            decibelBuffer = [Float](repeating: 0, count: count)
         }
 
-        return downSampledData
-    }
+        // maximum amplitude storable in Int16 = 0 dB (loudest)
+        var zeroDecibelEquivalent: Float = Float(Int16.max)
 
-    private func downsample(samples: [Float], toSampleCount sampleCount: Int) -> [Float] {
-        // Do nothing if the number of requested samples is less than 1
-        guard sampleCount > 0 else { return [] }
+        var loudestClipValue: Float = 0.0
+        var quietestClipValue = AudioWaveform.silenceDecibelThreshold
+        let samplesToProcess = vDSP_Length(count)
 
-        // Calculate the number of samples each resulting sample should span.
-        // If samples.count % sampleCount is > 0, that many samples will
-        // be omitted from the resulting array. This is okay, because we don't
-        // remove any unprocessed samples from the read buffer and will include
-        // them in the next group to downsample.
-        let strideLength = samples.count / sampleCount
-
-        // This filter indicates that we should evaluate each sample equally when downsampling.
-        let filter = [Float](repeating: 1.0 / Float(strideLength), count: strideLength)
-        var downSampledData = [Float](repeating: 0.0, count: sampleCount)
-
-        vDSP_desamp(
-            samples,
-            vDSP_Stride(strideLength),
-            filter,
-            &downSampledData,
-            vDSP_Length(sampleCount),
-            vDSP_Length(strideLength)
-        )
+        decibelBuffer.withUnsafeMutableBufferPointer { decibelBuffer in
+            let decibels = decibelBuffer.baseAddress!
+
+            // convert 16bit int amplitudes to float representation
+            vDSP_vflt16(amplitudes, 1, decibels, 1, samplesToProcess)
 
-        return downSampledData
+            // take the absolute amplitude value
+            vDSP_vabs(decibels, 1, decibels, 1, samplesToProcess)
+
+            // convert to dB
+            vDSP_vdbcon(decibels, 1, &zeroDecibelEquivalent, decibels, 1, samplesToProcess, 1)
+
+            // clip between loudest + quietest
+            vDSP_vclip(decibels, 1, &quietestClipValue, &loudestClipValue, decibels, 1, samplesToProcess)
+
+            // Add the decibels to the current group, completing groups as we go.
+            var offset = 0
+            while offset < count {
+                let length = min(groupSize - groupSampleCount, count - offset)
+                var sum: Float = 0
+                vDSP_sve(decibels + offset, 1, &sum, vDSP_Length(length))
+                groupSum += Double(sum)
+                groupSampleCount += length
+                offset += length
+
+                if groupSampleCount == groupSize {
+                    decibelSamples.append(Float(groupSum / Double(groupSize)))
+                    groupSum = 0
+                    groupSampleCount = 0
+                }
+            }
+        }
     }
 }
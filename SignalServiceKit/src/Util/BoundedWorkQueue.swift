@@ -0,0 +1,86 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+/// Runs asynchronous work with a bounded number of items in flight.
+///
+/// Unlike an OperationQueue, each item holds its slot until the promise it
+/// returns resolves, so work that waits on other systems (e.g. Photos)
+/// still counts against the limit. Items start in the order they were
+/// enqueued.
+public class BoundedWorkQueue {
+
+    public let maxConcurrentCount: Int
+
+    private let workQueue: DispatchQueue
+
+    // These properties should only be accessed while holding the lock.
+    private let lock = UnfairLock()
+    private var activeCount = 0
+    private var pendingItems = [() -> Void]()
+
+    public init(label: String, maxConcurrentCount: Int, qos: DispatchQoS = .userInitiated) {
+        owsAssertDebug(maxConcurrentCount > 0)
+
+        self.maxConcurrentCount = max(1, maxConcurrentCount)
+        self.workQueue = DispatchQueue(label: label, qos: qos, attributes: .concurrent)
+    }
+
+    /// The number of concurrent items the device can afford, if each item
+    /// needs `bytesPerItem` of memory at its peak.
+    ///
+    /// We budget an eighth of physical memory, and never use more than one
+    /// item per core.
+    public static func maxConcurrentCount(bytesPerItem: UInt64) -> Int {
+        owsAssertDebug(bytesPerItem > 0)
+
+        let memoryBudget = ProcessInfo.processInfo.physicalMemory / 8
+        let memoryLimit = Int(clamping: memoryBudget / max(1, bytesPerItem))
+        let coreLimit = ProcessInfo.processInfo.activeProcessorCount
+        return max(1, min(memoryLimit, coreLimit))
+    }
+
+    /// `block` is invoked on a background queue once a slot is free.
+    public func enqueue<T>(_ block: @escaping () throws -> Promise<T>) -> Promise<T> {
+        let (promise, resolver) = Promise<T>.pending()
+        let item = { [weak self] in
+            firstly {
+                try block()
+            }.ensure(on: .global()) {
+                self?.itemDidComplete()
+            }.pipe {
+                resolver.resolve($0)
+            }
+        }
+
+        let shouldStart: Bool = lock.withLock {
+            guard activeCount < maxConcurrentCount else {
+                pendingItems.append(item)
+                return false
+            }
+            activeCount += 1
+            return true
+        }
+        if shouldStart {
+            workQueue.async(execute: item)
+        }
+        return promise
+    }
+
+    private func itemDidComplete() {
+        let nextItem: (() -> Void)? = lock.withLock {
+            guard !pendingItems.isEmpty else {
+                activeCount -= 1
+                return nil
+            }
+            // The completed item's slot passes directly to the next item.
+            return pendingItems.removeFirst()
+        }
+        if let nextItem = nextItem {
+            workQueue.async(execute: nextItem)
+        }
+    }
+}
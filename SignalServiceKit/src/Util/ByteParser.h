@@ -13,6 +13,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithData:(NSData *)data littleEndian:(BOOL)littleEndian;
 
+#pragma mark - Byte
+
+- (uint8_t)byteAtIndex:(NSUInteger)index;
+- (uint8_t)nextByte;
+
 #pragma mark - Short
 
 - (uint16_t)shortAtIndex:(NSUInteger)index;
@@ -29,6 +29,27 @@ NS_ASSUME_NONNULL_BEGIN
     return self;
 }
 
+#pragma mark - Byte
+
+- (uint8_t)byteAtIndex:(NSUInteger)index
+{
+    uint8_t value;
+    const size_t valueSize = sizeof(value);
+    if (index + valueSize > self.data.length) {
+        self.hasError = YES;
+        return 0;
+    }
+    [self.data getBytes:&value range:NSMakeRange(index, valueSize)];
+    return value;
+}
+
+- (uint8_t)nextByte
+{
+    uint8_t value = [self byteAtIndex:self.cursor];
+    self.cursor += sizeof(value);
+    return value;
+}
+
 #pragma mark - Short
 
 - (uint16_t)shortAtIndex:(NSUInteger)index
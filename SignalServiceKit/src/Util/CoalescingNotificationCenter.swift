@@ -0,0 +1,151 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+// Posts notifications on the main thread, like postNotificationNameAsync,
+// but merges the notifications of a burst.
+//
+// Notifications with the same name and object are delivered at most once
+// per window (see DebouncedEvent). The first notification of a burst is
+// delivered asynchronously as soon as possible; any which are posted
+// before it is delivered or within the window are merged into it or into
+// a single delayed notification.
+//
+// The userInfo of a merged notification contains the values of every
+// merged userInfo, with later values replacing earlier ones for the same
+// key. The individual userInfos are listed, in the order they were
+// posted, under userInfosKey; see Notification.coalescedUserInfos.
+//
+// Only notifications whose observers don't need to handle each change
+// separately should be coalesced. The state for each name and object is
+// kept for the lifetime of the center, so objects should be nil or one
+// of a few values.
+@objc
+public class CoalescingNotificationCenter: NSObject {
+
+    @objc
+    public static let shared = CoalescingNotificationCenter(notificationCenter: .default)
+
+    @objc
+    public static let userInfosKey = "CoalescingNotificationCenter.userInfos"
+
+    @objc
+    public static let defaultWindow: TimeInterval = 0.25
+
+    private let notificationCenter: NotificationCenter
+
+    private struct Key: Hashable {
+        let name: Notification.Name
+        let object: NSObject?
+    }
+
+    private class Entry {
+        var event: DebouncedEvent?
+        var postCount = 0
+        var userInfos = [[AnyHashable: Any]]()
+    }
+
+    private let unfairLock = UnfairLock()
+    private var entries = [Key: Entry]()
+
+    init(notificationCenter: NotificationCenter) {
+        self.notificationCenter = notificationCenter
+    }
+
+    @objc
+    public func postNotificationName(_ name: Notification.Name,
+                                     object: Any?,
+                                     userInfo: [AnyHashable: Any]?) {
+        post(name: name, object: object, userInfo: userInfo)
+    }
+
+    // The window of the first notification posted with a given name and
+    // object is used for all later ones.
+    public func post(name: Notification.Name,
+                     object: Any? = nil,
+                     userInfo: [AnyHashable: Any]? = nil,
+                     window: TimeInterval = defaultWindow) {
+        let key = Key(name: name, object: object as? NSObject)
+        let event = unfairLock.withLock { () -> DebouncedEvent in
+            let entry: Entry
+            if let existingEntry = entries[key] {
+                entry = existingEntry
+            } else {
+                entry = Entry()
+                entries[key] = entry
+            }
+            entry.postCount += 1
+            if let userInfo = userInfo {
+                entry.userInfos.append(userInfo)
+            }
+            if let event = entry.event {
+                return event
+            }
+            let event = DebouncedEvent(maxFrequencySeconds: window, onQueue: .main) { [weak self] in
+                self?.deliver(key: key)
+            }
+            entry.event = event
+            return event
+        }
+        event.requestNotify()
+    }
+
+    private func deliver(key: Key) {
+        AssertIsOnMainThread()
+
+        let (postCount, userInfos) = unfairLock.withLock { () -> (Int, [[AnyHashable: Any]]) in
+            guard let entry = entries[key] else {
+                return (0, [])
+            }
+            let result = (entry.postCount, entry.userInfos)
+            entry.postCount = 0
+            entry.userInfos = []
+            return result
+        }
+        // An earlier delivery may already have included the notifications
+        // which requested this one.
+        guard postCount > 0 else {
+            return
+        }
+
+        var mergedUserInfo: [AnyHashable: Any]?
+        if !userInfos.isEmpty {
+            var userInfo = [AnyHashable: Any]()
+            for postedUserInfo in userInfos {
+                userInfo.merge(postedUserInfo) { _, new in new }
+            }
+            userInfo[Self.userInfosKey] = userInfos
+            mergedUserInfo = userInfo
+        }
+
+        #if TESTABLE_BUILD
+        deliveryCount.increment()
+        #endif
+
+        notificationCenter.post(name: key.name, object: key.object, userInfo: mergedUserInfo)
+    }
+
+    #if TESTABLE_BUILD
+    let deliveryCount = AtomicUInt(0)
+    #endif
+}
+
+// MARK: -
+
+public extension Notification {
+
+    // The userInfo of each notification which was merged into this one,
+    // in the order they were posted. For a notification which wasn't
+    // coalesced, this is its own userInfo, if any.
+    var coalescedUserInfos: [[AnyHashable: Any]] {
+        if let userInfos = userInfo?[CoalescingNotificationCenter.userInfosKey] as? [[AnyHashable: Any]] {
+            return userInfos
+        }
+        if let userInfo = userInfo {
+            return [userInfo]
+        }
+        return []
+    }
+}
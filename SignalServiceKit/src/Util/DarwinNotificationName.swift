@@ -10,6 +10,7 @@ public class DarwinNotificationName: NSObject, ExpressibleByStringLiteral {
     @objc public static let nseDidReceiveNotification: DarwinNotificationName = "org.signal.nseDidReceiveNotification"
     @objc public static let mainAppHandledNotification: DarwinNotificationName = "org.signal.mainAppHandledNotification"
     @objc public static let mainAppLaunched: DarwinNotificationName = "org.signal.mainAppLaunched"
+    @objc public static let messageProcessingLeaseDidChange: DarwinNotificationName = "org.signal.messageProcessingLeaseDidChange"
 
     public typealias StringLiteralType = String
 
@@ -0,0 +1,79 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import Compression
+
+public extension Data {
+
+    /// Returns the data in the gzip format (RFC 1952), e.g. for use with
+    /// `Content-Encoding: gzip`, or nil if it couldn't be compressed.
+    func gzipCompressed() -> Data? {
+        guard !isEmpty else {
+            return nil
+        }
+
+        // COMPRESSION_ZLIB produces a raw DEFLATE stream, which we wrap in a
+        // gzip header and trailer ourselves. Anything that doesn't shrink isn't
+        // worth compressing, so the output buffer needn't be any larger.
+        let capacity = count
+        var deflated = Data(count: capacity)
+        let deflatedCount = deflated.withUnsafeMutableBytes { (dstBuffer: UnsafeMutableRawBufferPointer) -> Int in
+            withUnsafeBytes { (srcBuffer: UnsafeRawBufferPointer) -> Int in
+                guard let dst = dstBuffer.bindMemory(to: UInt8.self).baseAddress,
+                      let src = srcBuffer.bindMemory(to: UInt8.self).baseAddress else {
+                    return 0
+                }
+                return compression_encode_buffer(dst, capacity, src, count, nil, COMPRESSION_ZLIB)
+            }
+        }
+        guard deflatedCount > 0 else {
+            return nil
+        }
+
+        // Magic number, DEFLATE, no flags, no modification time, no extra
+        // flags, unknown OS.
+        var result = Data([0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff])
+        result.append(deflated.prefix(deflatedCount))
+        result.appendLittleEndian(Self.crc32(self))
+        result.appendLittleEndian(UInt32(truncatingIfNeeded: count))
+        return result
+    }
+
+    // MARK: -
+
+    private static let crc32Table: [UInt32] = (0..<256).map { (index: UInt32) -> UInt32 in
+        var value = index
+        for _ in 0..<8 {
+            value = (value & 1 == 1) ? (0xedb88320 ^ (value >> 1)) : (value >> 1)
+        }
+        return value
+    }
+
+    static func crc32(_ data: Data) -> UInt32 {
+        let table = crc32Table
+        var crc: UInt32 = 0xffffffff
+        for byte in data {
+            crc = table[Int((crc ^ UInt32(byte)) & 0xff)] ^ (crc >> 8)
+        }
+        return crc ^ 0xffffffff
+    }
+
+    private mutating func appendLittleEndian(_ value: UInt32) {
+        append(contentsOf: [UInt8(truncatingIfNeeded: value),
+                            UInt8(truncatingIfNeeded: value >> 8),
+                            UInt8(truncatingIfNeeded: value >> 16),
+                            UInt8(truncatingIfNeeded: value >> 24)])
+    }
+}
+
+// MARK: -
+
+@objc
+public extension NSData {
+
+    func gzipCompressedData() -> Data? {
+        (self as Data).gzipCompressed()
+    }
+}
@@ -36,6 +36,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, readonly) ImageMetadata *imageMetadata;
 
+// Reads only the given range of the data, e.g. to hash, encrypt or upload
+// a large file in chunks.
+//
+// Returns nil if the range extends past the end of the data.
+- (nullable NSData *)readDataInRange:(NSRange)range error:(NSError **)error;
+
 // Returns YES on success.
 - (BOOL)writeToUrl:(NSURL *)dstUrl error:(NSError **)error;
 
@@ -79,4 +85,14 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+#pragma mark -
+
+// Like DataSourcePath, but `data` maps the file into memory when it is safe to
+// do so (NSDataReadingMappedIfSafe), rather than copying it onto the heap.
+//
+// Prefer this for files that may be large, e.g. videos and documents.
+@interface DataSourceMappedPath : DataSourcePath
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -250,6 +250,18 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+- (nullable NSData *)readDataInRange:(NSRange)range error:(NSError **)error
+{
+    OWSAssertDebug(!self.isConsumed);
+    OWSAssertDebug(self.data);
+
+    if (range.location > self.data.length || range.length > self.data.length - range.location) {
+        *error = OWSErrorMakeAssertionError(@"Range extends past the end of the data.");
+        return nil;
+    }
+    return [self.data subdataWithRange:range];
+}
+
 @end
 
 #pragma mark -
@@ -264,6 +276,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic) NSData *cachedData;
 @property (nonatomic, nullable) ImageMetadata *cachedImageMetadata;
 
+@property (nonatomic, readonly) NSDataReadingOptions dataReadingOptions;
+
 @end
 
 #pragma mark -
@@ -373,7 +387,7 @@ NS_ASSUME_NONNULL_BEGIN
     @synchronized(self)
     {
         if (!self.cachedData) {
-            self.cachedData = [NSData dataWithContentsOfFile:self.fileUrl.path];
+            self.cachedData = [NSData dataWithContentsOfURL:self.fileUrl options:self.dataReadingOptions error:nil];
         }
         if (!self.cachedData) {
             OWSLogDebug(@"Could not read data from disk: %@", self.fileUrl);
@@ -384,6 +398,11 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+- (NSDataReadingOptions)dataReadingOptions
+{
+    return 0;
+}
+
 - (NSUInteger)dataLength
 {
     OWSAssertDebug(!self.isConsumed);
@@ -448,6 +467,50 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+- (nullable NSData *)readDataInRange:(NSRange)range error:(NSError **)error
+{
+    OWSAssertDebug(!self.isConsumed);
+    OWSAssertDebug(self.fileUrl);
+
+    @synchronized(self) {
+        if (self.cachedData != nil) {
+            if (range.location > self.cachedData.length || range.length > self.cachedData.length - range.location) {
+                *error = OWSErrorMakeAssertionError(@"Range extends past the end of the data.");
+                return nil;
+            }
+            return [self.cachedData subdataWithRange:range];
+        }
+    }
+
+    NSUInteger dataLength = self.dataLength;
+    if (range.location > dataLength || range.length > dataLength - range.location) {
+        *error = OWSErrorMakeAssertionError(@"Range extends past the end of the data.");
+        return nil;
+    }
+
+    // Avoid reading the whole file just to return part of it.
+    NSFileHandle *_Nullable fileHandle = [NSFileHandle fileHandleForReadingFromURL:self.fileUrl error:error];
+    if (fileHandle == nil) {
+        return nil;
+    }
+    NSData *data;
+    @try {
+        [fileHandle seekToFileOffset:range.location];
+        data = [fileHandle readDataOfLength:range.length];
+    } @catch (NSException *exception) {
+        OWSLogWarn(@"Could not read file: %@", exception);
+        *error = OWSErrorMakeAssertionError(@"Could not read file.");
+        return nil;
+    } @finally {
+        [fileHandle closeFile];
+    }
+    if (data.length != range.length) {
+        *error = OWSErrorMakeAssertionError(@"Range extends past the end of the data.");
+        return nil;
+    }
+    return data;
+}
+
 - (BOOL)writeToUrl:(NSURL *)dstUrl error:(NSError **)error
 {
     OWSAssertDebug(!self.isConsumed);
@@ -518,4 +581,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+#pragma mark -
+
+@implementation DataSourceMappedPath
+
+- (NSDataReadingOptions)dataReadingOptions
+{
+    return NSDataReadingMappedIfSafe;
+}
+
+@end
+
 NS_ASSUME_NONNULL_END
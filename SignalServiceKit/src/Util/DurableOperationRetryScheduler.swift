@@ -0,0 +1,316 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Schedules the retries of every OWSOperation.
+///
+/// Operations that fail at the same moment (e.g. when connectivity flaps)
+/// would otherwise all retry at the same moment too. The scheduler:
+///
+/// * Jitters each retry interval so that retries spread out.
+/// * Caps how many retries may be in flight at once; the rest wait their turn,
+///   highest queue priority first. User-visible work (a queue priority of high
+///   or above, e.g. sending a renderable message) is exempt from the cap.
+/// * Holds back the retries of operations that need the network while we're
+///   offline, and releases them (still subject to the cap) once we're reachable.
+///   Operations may also defer their attempts while we're offline. Reachability
+///   can be wrong, so retries are never held for longer than maxOfflineHoldDuration.
+@objc
+public class DurableOperationRetryScheduler: NSObject {
+
+    @objc
+    public static let shared = DurableOperationRetryScheduler()
+
+    // The most retries that may be in flight at once.
+    static let maxConcurrentRetries = 4
+
+    // How long a retry may be held back because we appear to be offline
+    // before it is attempted anyway.
+    static let maxOfflineHoldDuration: TimeInterval = 2 * kMinuteInterval
+
+    // An attempt which hasn't reported its outcome after this long no longer
+    // counts against the concurrency cap.
+    static let inFlightRetryTimeout: TimeInterval = 2 * kMinuteInterval
+
+    private struct WaitingRetry {
+        let operation: OWSOperation
+        let token: UInt64
+    }
+
+    private struct HeldRetry {
+        let operation: OWSOperation
+        let heldDate: Date
+    }
+
+    private let unfairLock = UnfairLock()
+
+    // The properties below should only be accessed with unfairLock.
+
+    // Retries whose interval hasn't elapsed yet.
+    private var waitingRetries = [ObjectIdentifier: WaitingRetry]()
+    private var nextToken: UInt64 = 0
+    // Retries which are due but held back by the concurrency cap or because
+    // we're offline, in the order they became due.
+    private var heldRetries = [HeldRetry]()
+    // Retry attempt token, by operation.
+    private var inFlightRetries = [ObjectIdentifier: UInt64]()
+    // Operations which were released while we appeared to be offline,
+    // so shouldn't defer their next attempt.
+    private var offlineReleasedRetries = Set<ObjectIdentifier>()
+
+    // MARK: -
+
+    override private init() {
+        super.init()
+
+        SwiftSingletons.register(self)
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(reachabilityChanged),
+                                               name: SSKReachability.owsReachabilityDidChange,
+                                               object: nil)
+    }
+
+    private var isReachable: Bool {
+        guard SSKEnvironment.hasShared() else {
+            return false
+        }
+        return SSKEnvironment.shared.reachabilityManager.isReachable
+    }
+
+    // MARK: - Backlog
+
+    /// The number of retries which are scheduled but haven't started.
+    @objc
+    public var pendingRetryCount: Int {
+        unfairLock.withLock { waitingRetries.count + heldRetries.count }
+    }
+
+    /// The number of retries which are due but are being held back.
+    @objc
+    public var heldRetryCount: Int {
+        unfairLock.withLock { heldRetries.count }
+    }
+
+    // MARK: -
+
+    /// Spreads retries with the same nominal interval over [interval / 2, interval].
+    @objc
+    public static func jitteredRetryInterval(_ retryInterval: TimeInterval) -> TimeInterval {
+        guard retryInterval > 0 else {
+            return 0
+        }
+        let halfInterval = retryInterval / 2
+        return halfInterval + Double.random(in: 0...halfInterval)
+    }
+
+    @objc(scheduleRetryForOperation:retryInterval:)
+    public func scheduleRetry(operation: OWSOperation, retryInterval: TimeInterval) {
+        let interval = Self.jitteredRetryInterval(retryInterval)
+        let token: UInt64 = unfairLock.withLock {
+            nextToken += 1
+            let key = ObjectIdentifier(operation)
+            waitingRetries[key] = WaitingRetry(operation: operation, token: nextToken)
+            return nextToken
+        }
+
+        DispatchQueue.global().asyncAfter(deadline: .now() + interval) { [weak self] in
+            self?.retryIntervalDidElapse(operation: operation, token: token)
+        }
+    }
+
+    private func retryIntervalDidElapse(operation: OWSOperation, token: UInt64) {
+        unfairLock.withLock {
+            let key = ObjectIdentifier(operation)
+            // The retry may have already been run early.
+            guard let waitingRetry = waitingRetries[key],
+                  waitingRetry.token == token else {
+                return
+            }
+            waitingRetries.removeValue(forKey: key)
+            hold(operation: operation)
+        }
+        startHeldRetries()
+    }
+
+    // This method should only be called with unfairLock.
+    private func hold(operation: OWSOperation) {
+        heldRetries.append(HeldRetry(operation: operation, heldDate: Date()))
+        if operation.retryRequiresReachability {
+            // In case we're held back by a reachability which is wrong.
+            DispatchQueue.global().asyncAfter(deadline: .now() + Self.maxOfflineHoldDuration) { [weak self] in
+                self?.startHeldRetries()
+            }
+        }
+    }
+
+    // This method should only be called with unfairLock.
+    private func markInFlight(operation: OWSOperation) {
+        nextToken += 1
+        let key = ObjectIdentifier(operation)
+        let token = nextToken
+        inFlightRetries[key] = token
+        // Don't let an attempt which never reports back hold its slot forever.
+        DispatchQueue.global().asyncAfter(deadline: .now() + Self.inFlightRetryTimeout) { [weak self] in
+            self?.inFlightRetryDidTimeOut(key: key, token: token)
+        }
+    }
+
+    private func inFlightRetryDidTimeOut(key: ObjectIdentifier, token: UInt64) {
+        let didTimeOut: Bool = unfairLock.withLock {
+            guard inFlightRetries[key] == token else {
+                return false
+            }
+            inFlightRetries.removeValue(forKey: key)
+            return true
+        }
+        if didTimeOut {
+            Logger.warn("Retry attempt did not report back; releasing its slot.")
+            startHeldRetries()
+        }
+    }
+
+    private static func isExemptFromConcurrencyCap(_ operation: OWSOperation) -> Bool {
+        operation.queuePriority.rawValue >= Operation.QueuePriority.high.rawValue
+    }
+
+    /// Runs the operation's pending retry immediately, regardless of its interval,
+    /// the concurrency cap or reachability.
+    ///
+    /// Returns false if the operation has no pending retry.
+    @objc(runPendingRetryNowForOperation:)
+    public func runPendingRetryNow(operation: OWSOperation) -> Bool {
+        let didFindRetry: Bool = unfairLock.withLock {
+            let key = ObjectIdentifier(operation)
+            var didFindRetry = waitingRetries.removeValue(forKey: key) != nil
+            if let index = heldRetries.firstIndex(where: { $0.operation === operation }) {
+                heldRetries.remove(at: index)
+                didFindRetry = true
+            }
+            if didFindRetry, !Self.isExemptFromConcurrencyCap(operation) {
+                markInFlight(operation: operation)
+            }
+            return didFindRetry
+        }
+        guard didFindRetry else {
+            return false
+        }
+        DispatchQueue.global().async {
+            operation.run()
+        }
+        return true
+    }
+
+    /// Holds back an attempt which is certain to fail because we're offline,
+    /// without counting it against the operation's retries. The attempt is
+    /// run (subject to the concurrency cap) once we're reachable, or after
+    /// maxOfflineHoldDuration in case reachability is wrong.
+    ///
+    /// Returns false if we're reachable, or the attempt has already been held
+    /// back, in which case the caller should make the attempt now.
+    @objc(deferAttemptUntilReachableForOperation:)
+    public func deferAttemptUntilReachable(operation: OWSOperation) -> Bool {
+        // Only operations whose retries require reachability are held back
+        // until we're reachable.
+        guard operation.retryRequiresReachability,
+              !CurrentAppContext().isRunningTests,
+              SSKEnvironment.hasShared(),
+              !isReachable else {
+            return false
+        }
+        let key = ObjectIdentifier(operation)
+        let shouldDefer: Bool = unfairLock.withLock {
+            guard offlineReleasedRetries.remove(key) == nil else {
+                // This attempt was already held back for long enough.
+                return false
+            }
+            // The attempt may have been released as a retry.
+            inFlightRetries.removeValue(forKey: key)
+            hold(operation: operation)
+            return true
+        }
+        guard shouldDefer else {
+            return false
+        }
+        Logger.info("Deferring attempt until reachable: \(operation).")
+        // In case we became reachable in the meantime.
+        startHeldRetries()
+        return true
+    }
+
+    /// Should be called whenever an operation reports the outcome of an attempt.
+    @objc(operationDidFinishAttempt:)
+    public func operationDidFinishAttempt(_ operation: OWSOperation) {
+        let didFinishRetry: Bool = unfairLock.withLock {
+            let key = ObjectIdentifier(operation)
+            offlineReleasedRetries.remove(key)
+            return inFlightRetries.removeValue(forKey: key) != nil
+        }
+        if didFinishRetry {
+            startHeldRetries()
+        }
+    }
+
+    private func startHeldRetries() {
+        let isReachable = self.isReachable
+        let now = Date()
+        let operationsToStart: [OWSOperation] = unfairLock.withLock {
+            var operationsToStart = [OWSOperation]()
+            var remainingHeldRetries = [HeldRetry]()
+            // Higher priority retries go first; the sort is stable, so retries
+            // with the same priority keep the order they became due in.
+            let sortedHeldRetries = heldRetries.enumerated().sorted { lhs, rhs in
+                let lhsPriority = lhs.element.operation.queuePriority.rawValue
+                let rhsPriority = rhs.element.operation.queuePriority.rawValue
+                return lhsPriority != rhsPriority ? lhsPriority > rhsPriority : lhs.offset < rhs.offset
+            }.map { $0.element }
+            for heldRetry in sortedHeldRetries {
+                let operation = heldRetry.operation
+                let isExempt = Self.isExemptFromConcurrencyCap(operation)
+                let hasHeldTooLong = now.timeIntervalSince(heldRetry.heldDate) >= Self.maxOfflineHoldDuration
+                guard isExempt || inFlightRetries.count < Self.maxConcurrentRetries,
+                      isReachable || !operation.retryRequiresReachability || hasHeldTooLong else {
+                    remainingHeldRetries.append(heldRetry)
+                    continue
+                }
+                if !isReachable, operation.retryRequiresReachability {
+                    offlineReleasedRetries.insert(ObjectIdentifier(operation))
+                }
+                if !isExempt {
+                    markInFlight(operation: operation)
+                }
+                operationsToStart.append(operation)
+            }
+            // Keep the remaining retries in the order they became due.
+            let remainingOperations = Set(remainingHeldRetries.map { ObjectIdentifier($0.operation) })
+            heldRetries = heldRetries.filter { remainingOperations.contains(ObjectIdentifier($0.operation)) }
+            return operationsToStart
+        }
+        for operation in operationsToStart {
+            DispatchQueue.global().async {
+                operation.run()
+            }
+        }
+    }
+
+    @objc
+    private func reachabilityChanged() {
+        guard isReachable else {
+            return
+        }
+
+        // Operations which need the network have likely been failing while we were
+        // offline and backing off accordingly, so retry them as soon as the
+        // concurrency cap allows rather than waiting out their backoff.
+        unfairLock.withLock {
+            let reachabilityRetries = waitingRetries.filter { $0.value.operation.retryRequiresReachability }
+            for (key, waitingRetry) in reachabilityRetries.sorted(by: { $0.value.token < $1.value.token }) {
+                waitingRetries.removeValue(forKey: key)
+                heldRetries.append(HeldRetry(operation: waitingRetry.operation, heldDate: Date()))
+            }
+        }
+        startHeldRetries()
+    }
+}
@@ -141,6 +141,10 @@ public class FeatureFlags: BaseFlags {
     @objc
     public static let complainAboutSlowDBWrites = true
 
+    // Decrypt incoming envelopes in batches, one write transaction per batch.
+    @objc
+    public static let batchedMessageDecryption = build.includes(.qa)
+
     // Don't consult this flags; consult RemoteConfig.usernames.
     static let usernamesSupported = build.includes(.qa)
 
@@ -251,6 +255,11 @@ public class DebugFlags: BaseFlags {
     @objc
     public static let logSQLQueries = build.includes(.dev)
 
+    // Traces database transactions, message processing and sending, the
+    // conversation view and attachments with os_signpost. See Signposts.
+    @objc
+    public static let signposts = build.includes(.qa)
+
     @objc
     public static let groupsV2IgnoreCapability = false
 
@@ -0,0 +1,43 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import "NSData+Image.h"
+#import <ImageIO/ImageIO.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// The properties of an image which can be read from its container headers,
+// without reading or decoding the rest of the file.
+@interface ImageHeaderInfo : NSObject
+
+@property (nonatomic, readonly) ImageFormat imageFormat;
+// The stored size, in pixels; orientation has not been applied.
+@property (nonatomic, readonly) CGSize pixelSize;
+@property (nonatomic, readonly) CGImagePropertyOrientation orientation;
+// The number of bits in each color sample.
+@property (nonatomic, readonly) NSUInteger depthBits;
+@property (nonatomic, readonly) BOOL hasAlpha;
+@property (nonatomic, readonly) BOOL isAnimated;
+@property (nonatomic, readonly) unsigned long long fileLength;
+
+@end
+
+#pragma mark -
+
+@interface ImageHeaderProbe : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Reads the container headers of a PNG, JPEG, GIF, WebP or HEIF image.
+//
+// Returns nil if the file isn't in one of these formats, if its headers are
+// malformed, or if they aren't enough to settle the image's properties, e.g.
+// for a CMYK JPEG or an animated WebP. Callers should fall back to decoding
+// the image in that case.
++ (nullable ImageHeaderInfo *)probeImageAtPath:(NSString *)filePath;
+
+@end
+
+NS_ASSUME_NONNULL_END
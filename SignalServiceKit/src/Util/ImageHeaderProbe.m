@@ -0,0 +1,692 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import "ImageHeaderProbe.h"
+#import "ByteParser.h"
+#import "OWSFileSystem.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Reads are rounded up to this length so that consecutive small reads,
+// e.g. of a few chunk headers, are served by a single read of the file.
+static const NSUInteger kBufferedFileReaderBufferLength = 4 * 1024;
+
+// Headers are expected near the start of the file; rather than scan large
+// files for them, we fall back to decoding.
+static const unsigned long long kMaxProbeOffset = 256 * 1024;
+
+static BOOL HasFourCC(NSData *data, NSUInteger index, const char *fourCC)
+{
+    if (index + 4 > data.length) {
+        return NO;
+    }
+    return memcmp((const uint8_t *)data.bytes + index, fourCC, 4) == 0;
+}
+
+#pragma mark -
+
+@interface OWSBufferedFileReader : NSObject
+
+@property (nonatomic, readonly) unsigned long long fileLength;
+
+@end
+
+#pragma mark -
+
+@implementation OWSBufferedFileReader {
+    NSFileHandle *_fileHandle;
+    NSData *_Nullable _buffer;
+    unsigned long long _bufferOffset;
+}
+
+- (nullable instancetype)initWithFilePath:(NSString *)filePath
+{
+    NSNumber *_Nullable fileLength = [OWSFileSystem fileSizeOfPath:filePath];
+    NSFileHandle *_Nullable fileHandle = [NSFileHandle fileHandleForReadingAtPath:filePath];
+    if (fileLength == nil || fileHandle == nil) {
+        return nil;
+    }
+
+    if (self = [super init]) {
+        _fileLength = fileLength.unsignedLongLongValue;
+        _fileHandle = fileHandle;
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [_fileHandle closeFile];
+}
+
+// Returns nil if the range extends past the end of the file, or past the
+// point at which we stop probing.
+- (nullable NSData *)readDataAtOffset:(unsigned long long)offset length:(NSUInteger)length
+{
+    if (offset + length > self.fileLength || offset + length > kMaxProbeOffset) {
+        return nil;
+    }
+    if (_buffer != nil && offset >= _bufferOffset && offset + length <= _bufferOffset + _buffer.length) {
+        return [_buffer subdataWithRange:NSMakeRange((NSUInteger)(offset - _bufferOffset), length)];
+    }
+
+    NSUInteger readLength = (NSUInteger)MIN(MAX(length, kBufferedFileReaderBufferLength), self.fileLength - offset);
+    NSData *data;
+    @try {
+        [_fileHandle seekToFileOffset:offset];
+        data = [_fileHandle readDataOfLength:readLength];
+    } @catch (NSException *exception) {
+        OWSLogWarn(@"Could not read file: %@", exception);
+        return nil;
+    }
+    if (data.length < length) {
+        return nil;
+    }
+    _buffer = data;
+    _bufferOffset = offset;
+    return [data subdataWithRange:NSMakeRange(0, length)];
+}
+
+- (nullable ByteParser *)parserAtOffset:(unsigned long long)offset
+                                 length:(NSUInteger)length
+                           littleEndian:(BOOL)littleEndian
+{
+    NSData *_Nullable data = [self readDataAtOffset:offset length:length];
+    if (data == nil) {
+        return nil;
+    }
+    return [[ByteParser alloc] initWithData:data littleEndian:littleEndian];
+}
+
+@end
+
+#pragma mark -
+
+@interface ImageHeaderInfo ()
+
+@property (nonatomic) ImageFormat imageFormat;
+@property (nonatomic) CGSize pixelSize;
+@property (nonatomic) CGImagePropertyOrientation orientation;
+@property (nonatomic) NSUInteger depthBits;
+@property (nonatomic) BOOL hasAlpha;
+@property (nonatomic) BOOL isAnimated;
+@property (nonatomic) unsigned long long fileLength;
+
+@end
+
+#pragma mark -
+
+@implementation ImageHeaderInfo
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _orientation = kCGImagePropertyOrientationUp;
+        _depthBits = 8;
+    }
+
+    return self;
+}
+
+@end
+
+#pragma mark -
+
+@implementation ImageHeaderProbe
+
++ (nullable ImageHeaderInfo *)probeImageAtPath:(NSString *)filePath
+{
+    OWSBufferedFileReader *_Nullable reader = [[OWSBufferedFileReader alloc] initWithFilePath:filePath];
+    if (reader == nil) {
+        return nil;
+    }
+    const NSUInteger kSignatureLength = 16;
+    NSData *_Nullable signature = [reader readDataAtOffset:0 length:kSignatureLength];
+    if (signature == nil) {
+        return nil;
+    }
+    const uint8_t *bytes = signature.bytes;
+
+    ImageHeaderInfo *_Nullable headerInfo;
+    const uint8_t kPngSignature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+    if (memcmp(bytes, kPngSignature, sizeof(kPngSignature)) == 0) {
+        headerInfo = [self probePngWithReader:reader];
+    } else if (bytes[0] == 0xff && bytes[1] == 0xd8 && bytes[2] == 0xff) {
+        headerInfo = [self probeJpegWithReader:reader];
+    } else if (memcmp(bytes, "GIF87a", 6) == 0 || memcmp(bytes, "GIF89a", 6) == 0) {
+        headerInfo = [self probeGifWithReader:reader];
+    } else if (HasFourCC(signature, 0, "RIFF") && HasFourCC(signature, 8, "WEBP")) {
+        headerInfo = [self probeWebpWithReader:reader];
+    } else if (HasFourCC(signature, 4, "ftyp")) {
+        // Match ows_guessHighEfficiencyImageFormat: the brand must be followed by a null.
+        ImageFormat imageFormat = ImageFormat_Unknown;
+        BOOL hasTerminatedBrand = bytes[12] == 0;
+        if (hasTerminatedBrand && HasFourCC(signature, 8, "heic")) {
+            imageFormat = ImageFormat_Heic;
+        } else if (hasTerminatedBrand && (HasFourCC(signature, 8, "mif1") || HasFourCC(signature, 8, "msf1"))) {
+            imageFormat = ImageFormat_Heif;
+        }
+        if (imageFormat != ImageFormat_Unknown) {
+            headerInfo = [self probeHeifWithReader:reader];
+            headerInfo.imageFormat = imageFormat;
+        }
+    }
+    headerInfo.fileLength = reader.fileLength;
+    return headerInfo;
+}
+
+#pragma mark - PNG
+
+// See: https://www.w3.org/TR/PNG/#11IHDR
++ (nullable ImageHeaderInfo *)probePngWithReader:(OWSBufferedFileReader *)reader
+{
+    // The IHDR chunk must come first.
+    const unsigned long long kIhdrOffset = 8;
+    const NSUInteger kIhdrLength = 13;
+    NSData *_Nullable ihdr = [reader readDataAtOffset:kIhdrOffset length:8 + kIhdrLength];
+    if (ihdr == nil || !HasFourCC(ihdr, 4, "IHDR")) {
+        return nil;
+    }
+    ByteParser *parser = [[ByteParser alloc] initWithData:ihdr littleEndian:NO];
+    if ([parser intAtIndex:0] != kIhdrLength) {
+        return nil;
+    }
+    uint32_t width = [parser intAtIndex:8];
+    uint32_t height = [parser intAtIndex:12];
+    uint8_t bitDepth = [parser byteAtIndex:16];
+    uint8_t colorType = [parser byteAtIndex:17];
+    if (parser.hasError) {
+        return nil;
+    }
+
+    BOOL hasAlpha;
+    switch (colorType) {
+        case 0: // Grayscale
+        case 2: // Truecolor
+        case 3: // Indexed-color
+            hasAlpha = NO;
+            break;
+        case 4: // Grayscale with alpha
+        case 6: // Truecolor with alpha
+            hasAlpha = YES;
+            break;
+        default:
+            OWSLogWarn(@"Invalid PNG color type: %d", colorType);
+            return nil;
+    }
+
+    // Transparency (tRNS) and animation (acTL) chunks must both appear before
+    // the first IDAT chunk, so we only need to walk the chunk headers up to it.
+    BOOL isAnimated = NO;
+    unsigned long long chunkOffset = kIhdrOffset + 8 + kIhdrLength + 4;
+    while (true) {
+        NSData *_Nullable chunkHeader = [reader readDataAtOffset:chunkOffset length:8];
+        if (chunkHeader == nil) {
+            return nil;
+        }
+        uint32_t chunkLength = [[[ByteParser alloc] initWithData:chunkHeader littleEndian:NO] intAtIndex:0];
+        if (HasFourCC(chunkHeader, 4, "IDAT")) {
+            break;
+        } else if (HasFourCC(chunkHeader, 4, "acTL")) {
+            isAnimated = YES;
+        } else if (HasFourCC(chunkHeader, 4, "tRNS")) {
+            hasAlpha = YES;
+        }
+        // Skip the chunk's header, data and CRC.
+        chunkOffset += 8 + (unsigned long long)chunkLength + 4;
+    }
+
+    ImageHeaderInfo *headerInfo = [ImageHeaderInfo new];
+    headerInfo.imageFormat = ImageFormat_Png;
+    headerInfo.pixelSize = CGSizeMake(width, height);
+    headerInfo.depthBits = bitDepth;
+    headerInfo.hasAlpha = hasAlpha;
+    headerInfo.isAnimated = isAnimated;
+    return headerInfo;
+}
+
+#pragma mark - JPEG
+
+// See: https://www.w3.org/Graphics/JPEG/itu-t81.pdf
++ (nullable ImageHeaderInfo *)probeJpegWithReader:(OWSBufferedFileReader *)reader
+{
+    CGImagePropertyOrientation orientation = kCGImagePropertyOrientationUp;
+    unsigned long long segmentOffset = 2;
+    while (true) {
+        NSData *_Nullable marker = [reader readDataAtOffset:segmentOffset length:2];
+        if (marker == nil) {
+            return nil;
+        }
+        const uint8_t *markerBytes = marker.bytes;
+        if (markerBytes[0] != 0xff) {
+            OWSLogWarn(@"Invalid JPEG marker.");
+            return nil;
+        }
+        uint8_t markerType = markerBytes[1];
+        if (markerType == 0xff) {
+            // Fill byte.
+            segmentOffset += 1;
+            continue;
+        }
+        if (markerType == 0x01 || (markerType >= 0xd0 && markerType <= 0xd7)) {
+            // These markers have no length or payload.
+            segmentOffset += 2;
+            continue;
+        }
+        if (markerType == 0xd9 || markerType == 0xda) {
+            // We've reached the end of the image or the scan data without finding a frame header.
+            return nil;
+        }
+
+        ByteParser *_Nullable lengthParser = [reader parserAtOffset:segmentOffset + 2 length:2 littleEndian:NO];
+        uint16_t segmentLength = [lengthParser shortAtIndex:0];
+        if (lengthParser == nil || segmentLength < 2) {
+            return nil;
+        }
+        unsigned long long payloadOffset = segmentOffset + 4;
+        NSUInteger payloadLength = segmentLength - 2;
+
+        BOOL isStartOfFrame = (markerType >= 0xc0 && markerType <= 0xcf && markerType != 0xc4 && markerType != 0xc8
+            && markerType != 0xcc);
+        if (isStartOfFrame) {
+            ByteParser *_Nullable parser = [reader parserAtOffset:payloadOffset length:6 littleEndian:NO];
+            uint8_t precision = [parser byteAtIndex:0];
+            uint16_t height = [parser shortAtIndex:1];
+            uint16_t width = [parser shortAtIndex:3];
+            uint8_t componentCount = [parser byteAtIndex:5];
+            if (parser == nil || parser.hasError) {
+                return nil;
+            }
+            if (height == 0) {
+                // The height is defined later, by a DNL marker.
+                return nil;
+            }
+            if (componentCount != 1 && componentCount != 3) {
+                // ImageIO would tell us whether this is e.g. CMYK, which we reject.
+                return nil;
+            }
+
+            ImageHeaderInfo *headerInfo = [ImageHeaderInfo new];
+            headerInfo.imageFormat = ImageFormat_Jpeg;
+            headerInfo.pixelSize = CGSizeMake(width, height);
+            headerInfo.orientation = orientation;
+            headerInfo.depthBits = precision;
+            headerInfo.hasAlpha = NO;
+            headerInfo.isAnimated = NO;
+            return headerInfo;
+        } else if (markerType == 0xe1) {
+            NSData *_Nullable payload = [reader readDataAtOffset:payloadOffset length:payloadLength];
+            if (payload == nil) {
+                return nil;
+            }
+            NSNumber *_Nullable exifOrientation = [self orientationForExifPayload:payload];
+            if (exifOrientation != nil) {
+                orientation = (CGImagePropertyOrientation)exifOrientation.intValue;
+            }
+        }
+
+        segmentOffset = payloadOffset + payloadLength;
+    }
+}
+
+// Returns the orientation in an APP1 segment's EXIF data, or nil if it
+// doesn't have one.
+//
+// See: https://www.cipa.jp/std/documents/e/DC-008-2012_E.pdf
++ (nullable NSNumber *)orientationForExifPayload:(NSData *)payload
+{
+    const NSUInteger kExifHeaderLength = 6;
+    if (payload.length < kExifHeaderLength || memcmp(payload.bytes, "Exif\0\0", kExifHeaderLength) != 0) {
+        return nil;
+    }
+    NSData *tiff = [payload subdataWithRange:NSMakeRange(kExifHeaderLength, payload.length - kExifHeaderLength)];
+    BOOL littleEndian;
+    if (tiff.length >= 2 && memcmp(tiff.bytes, "II", 2) == 0) {
+        littleEndian = YES;
+    } else if (tiff.length >= 2 && memcmp(tiff.bytes, "MM", 2) == 0) {
+        littleEndian = NO;
+    } else {
+        return nil;
+    }
+
+    ByteParser *parser = [[ByteParser alloc] initWithData:tiff littleEndian:littleEndian];
+    if ([parser shortAtIndex:2] != 42) {
+        return nil;
+    }
+    uint32_t ifdOffset = [parser intAtIndex:4];
+    uint16_t entryCount = [parser shortAtIndex:ifdOffset];
+    const uint16_t kOrientationTag = 0x0112;
+    const NSUInteger kEntryLength = 12;
+    for (NSUInteger i = 0; i < entryCount && !parser.hasError; i++) {
+        NSUInteger entryOffset = ifdOffset + 2 + i * kEntryLength;
+        if ([parser shortAtIndex:entryOffset] != kOrientationTag) {
+            continue;
+        }
+        uint16_t orientation = [parser shortAtIndex:entryOffset + 8];
+        if (parser.hasError || orientation < 1 || orientation > 8) {
+            return nil;
+        }
+        return @(orientation);
+    }
+    return nil;
+}
+
+#pragma mark - GIF
+
+// See: https://www.w3.org/Graphics/GIF/spec-gif89a.txt
++ (nullable ImageHeaderInfo *)probeGifWithReader:(OWSBufferedFileReader *)reader
+{
+    // The logical screen descriptor follows the 6-byte signature.
+    ByteParser *_Nullable parser = [reader parserAtOffset:6 length:7 littleEndian:YES];
+    uint16_t width = [parser shortAtIndex:0];
+    uint16_t height = [parser shortAtIndex:2];
+    uint8_t packedFields = [parser byteAtIndex:4];
+    if (parser == nil || parser.hasError || width == 0 || height == 0) {
+        return nil;
+    }
+
+    // The first frame is transparent if the graphic control extension
+    // which precedes its image descriptor says so.
+    BOOL hasAlpha = NO;
+    unsigned long long blockOffset = 13;
+    if (packedFields & 0x80) {
+        // Skip the global color table.
+        blockOffset += 3 * (1 << ((packedFields & 0x07) + 1));
+    }
+    while (true) {
+        ByteParser *_Nullable blockParser = [reader parserAtOffset:blockOffset length:2 littleEndian:YES];
+        if (blockParser == nil) {
+            return nil;
+        }
+        uint8_t introducer = [blockParser byteAtIndex:0];
+        if (introducer == 0x2c) {
+            // Image descriptor.
+            break;
+        } else if (introducer != 0x21) {
+            return nil;
+        }
+        uint8_t label = [blockParser byteAtIndex:1];
+        blockOffset += 2;
+        if (label == 0xf9) {
+            ByteParser *_Nullable extensionParser = [reader parserAtOffset:blockOffset length:2 littleEndian:YES];
+            if (extensionParser == nil) {
+                return nil;
+            }
+            hasAlpha = ([extensionParser byteAtIndex:1] & 0x01) != 0;
+        }
+        // Skip the extension's data sub-blocks.
+        while (true) {
+            ByteParser *_Nullable subBlockParser = [reader parserAtOffset:blockOffset length:1 littleEndian:YES];
+            if (subBlockParser == nil) {
+                return nil;
+            }
+            uint8_t subBlockLength = [subBlockParser byteAtIndex:0];
+            blockOffset += 1 + subBlockLength;
+            if (subBlockLength == 0) {
+                break;
+            }
+        }
+    }
+
+    ImageHeaderInfo *headerInfo = [ImageHeaderInfo new];
+    headerInfo.imageFormat = ImageFormat_Gif;
+    headerInfo.pixelSize = CGSizeMake(width, height);
+    headerInfo.hasAlpha = hasAlpha;
+    // Match imageMetadataWithPath:mimeType:, which treats all GIFs as animated.
+    headerInfo.isAnimated = YES;
+    return headerInfo;
+}
+
+#pragma mark - WebP
+
+// See: https://developers.google.com/speed/webp/docs/riff_container
++ (nullable ImageHeaderInfo *)probeWebpWithReader:(OWSBufferedFileReader *)reader
+{
+    ByteParser *_Nullable riffParser = [reader parserAtOffset:4 length:4 littleEndian:YES];
+    uint32_t riffLength = [riffParser intAtIndex:0];
+    if (riffParser == nil || 8 + (unsigned long long)riffLength > reader.fileLength) {
+        // The file is truncated.
+        return nil;
+    }
+
+    const unsigned long long kChunkOffset = 12;
+    const NSUInteger kChunkHeaderLength = 8;
+    const NSUInteger kChunkProbeLength = 10;
+    NSData *_Nullable chunk = [reader readDataAtOffset:kChunkOffset length:kChunkHeaderLength + kChunkProbeLength];
+    if (chunk == nil) {
+        return nil;
+    }
+    ByteParser *parser = [[ByteParser alloc] initWithData:chunk littleEndian:YES];
+    const NSUInteger kDataOffset = kChunkHeaderLength;
+
+    uint32_t width;
+    uint32_t height;
+    if (HasFourCC(chunk, 0, "VP8X")) {
+        uint8_t flags = [parser byteAtIndex:kDataOffset];
+        if (flags & 0x02) {
+            // Animated; WebPDemux would tell us how many frames there are.
+            return nil;
+        }
+        // 24-bit values, stored minus one.
+        width = 1
+            + ((uint32_t)[parser byteAtIndex:kDataOffset + 4] | ((uint32_t)[parser byteAtIndex:kDataOffset + 5] << 8)
+                | ((uint32_t)[parser byteAtIndex:kDataOffset + 6] << 16));
+        height = 1
+            + ((uint32_t)[parser byteAtIndex:kDataOffset + 7] | ((uint32_t)[parser byteAtIndex:kDataOffset + 8] << 8)
+                | ((uint32_t)[parser byteAtIndex:kDataOffset + 9] << 16));
+    } else if (HasFourCC(chunk, 0, "VP8L")) {
+        if ([parser byteAtIndex:kDataOffset] != 0x2f) {
+            return nil;
+        }
+        // 14-bit values, stored minus one.
+        uint32_t bits = [parser intAtIndex:kDataOffset + 1];
+        width = (bits & 0x3fff) + 1;
+        height = ((bits >> 14) & 0x3fff) + 1;
+    } else if (HasFourCC(chunk, 0, "VP8 ")) {
+        // The frame tag is followed by a start code and 14-bit values.
+        if ([parser byteAtIndex:kDataOffset + 3] != 0x9d || [parser byteAtIndex:kDataOffset + 4] != 0x01
+            || [parser byteAtIndex:kDataOffset + 5] != 0x2a) {
+            return nil;
+        }
+        width = [parser shortAtIndex:kDataOffset + 6] & 0x3fff;
+        height = [parser shortAtIndex:kDataOffset + 8] & 0x3fff;
+    } else {
+        return nil;
+    }
+    if (parser.hasError || width == 0 || height == 0) {
+        return nil;
+    }
+
+    ImageHeaderInfo *headerInfo = [ImageHeaderInfo new];
+    headerInfo.imageFormat = ImageFormat_Webp;
+    headerInfo.pixelSize = CGSizeMake(width, height);
+    // Match imageMetadataWithIsAnimated:imageFormat:, which assumes WebPs have alpha.
+    headerInfo.hasAlpha = YES;
+    headerInfo.isAnimated = NO;
+    return headerInfo;
+}
+
+#pragma mark - HEIF
+
+// Returns the offset of the first box of the given type, or nil.
+//
+// See: ISO/IEC 14496-12
++ (nullable NSNumber *)offsetOfBoxWithType:(const char *)boxType
+                                    inData:(NSData *)data
+                                     range:(NSRange)range
+                                boxLength:(NSUInteger *)boxLengthOut
+{
+    ByteParser *parser = [[ByteParser alloc] initWithData:data littleEndian:NO];
+    NSUInteger boxOffset = range.location;
+    while (boxOffset + 8 <= NSMaxRange(range)) {
+        uint32_t boxLength = [parser intAtIndex:boxOffset];
+        if (boxLength < 8 || boxOffset + boxLength > NSMaxRange(range)) {
+            // We don't expect 64-bit or open-ended boxes within the meta box.
+            return nil;
+        }
+        if (HasFourCC(data, boxOffset + 4, boxType)) {
+            *boxLengthOut = boxLength;
+            return @(boxOffset);
+        }
+        boxOffset += boxLength;
+    }
+    return nil;
+}
+
+// Reads the size of the primary item from its ispe property.
+//
+// See: ISO/IEC 23008-12
++ (nullable ImageHeaderInfo *)probeHeifWithReader:(OWSBufferedFileReader *)reader
+{
+    // Find the top-level meta box, which usually follows the ftyp box.
+    unsigned long long boxOffset = 0;
+    uint32_t metaLength = 0;
+    while (true) {
+        NSData *_Nullable boxHeader = [reader readDataAtOffset:boxOffset length:8];
+        if (boxHeader == nil) {
+            return nil;
+        }
+        uint32_t boxLength = [[[ByteParser alloc] initWithData:boxHeader littleEndian:NO] intAtIndex:0];
+        if (boxLength < 8) {
+            return nil;
+        }
+        if (HasFourCC(boxHeader, 4, "meta")) {
+            metaLength = boxLength;
+            break;
+        } else if (HasFourCC(boxHeader, 4, "mdat")) {
+            return nil;
+        }
+        boxOffset += boxLength;
+    }
+    NSData *_Nullable meta = [reader readDataAtOffset:boxOffset length:metaLength];
+    if (meta == nil) {
+        return nil;
+    }
+    ByteParser *parser = [[ByteParser alloc] initWithData:meta littleEndian:NO];
+    // The meta box is a full box, with a version and flags.
+    NSRange metaChildren = NSMakeRange(12, metaLength - MIN(metaLength, 12));
+
+    NSUInteger pitmLength = 0;
+    NSNumber *_Nullable pitmOffset = [self offsetOfBoxWithType:"pitm"
+                                                        inData:meta
+                                                         range:metaChildren
+                                                     boxLength:&pitmLength];
+    NSUInteger iprpLength = 0;
+    NSNumber *_Nullable iprpOffset = [self offsetOfBoxWithType:"iprp"
+                                                        inData:meta
+                                                         range:metaChildren
+                                                     boxLength:&iprpLength];
+    if (pitmOffset == nil || iprpOffset == nil) {
+        return nil;
+    }
+    uint8_t pitmVersion = [parser byteAtIndex:pitmOffset.unsignedIntegerValue + 8];
+    uint32_t primaryItemId = (pitmVersion == 0 ? [parser shortAtIndex:pitmOffset.unsignedIntegerValue + 12]
+                                                : [parser intAtIndex:pitmOffset.unsignedIntegerValue + 12]);
+
+    NSRange iprpChildren = NSMakeRange(iprpOffset.unsignedIntegerValue + 8, iprpLength - 8);
+    NSUInteger ipcoLength = 0;
+    NSNumber *_Nullable ipcoOffset = [self offsetOfBoxWithType:"ipco"
+                                                        inData:meta
+                                                         range:iprpChildren
+                                                     boxLength:&ipcoLength];
+    NSUInteger ipmaLength = 0;
+    NSNumber *_Nullable ipmaOffset = [self offsetOfBoxWithType:"ipma"
+                                                        inData:meta
+                                                         range:iprpChildren
+                                                     boxLength:&ipmaLength];
+    if (ipcoOffset == nil || ipmaOffset == nil) {
+        return nil;
+    }
+
+    // The properties are referred to by their 1-based index within the ipco box.
+    NSMutableArray<NSNumber *> *propertyOffsets = [NSMutableArray new];
+    NSUInteger propertyOffset = ipcoOffset.unsignedIntegerValue + 8;
+    NSUInteger ipcoEnd = ipcoOffset.unsignedIntegerValue + ipcoLength;
+    while (propertyOffset + 8 <= ipcoEnd) {
+        uint32_t propertyLength = [parser intAtIndex:propertyOffset];
+        if (propertyLength < 8 || propertyOffset + propertyLength > ipcoEnd) {
+            return nil;
+        }
+        if (HasFourCC(meta, propertyOffset + 4, "auxC")) {
+            // Auxiliary images might include an alpha plane, which ImageIO would detect.
+            return nil;
+        }
+        [propertyOffsets addObject:@(propertyOffset)];
+        propertyOffset += propertyLength;
+    }
+
+    // Find the primary item's properties.
+    NSUInteger ipma = ipmaOffset.unsignedIntegerValue;
+    uint8_t ipmaVersion = [parser byteAtIndex:ipma + 8];
+    BOOL hasLargePropertyIndices = ([parser byteAtIndex:ipma + 11] & 0x01) != 0;
+    uint32_t entryCount = [parser intAtIndex:ipma + 12];
+    NSUInteger entryOffset = ipma + 16;
+    NSMutableArray<NSNumber *> *primaryPropertyIndices = [NSMutableArray new];
+    for (uint32_t i = 0; i < entryCount && !parser.hasError; i++) {
+        uint32_t itemId;
+        if (ipmaVersion < 1) {
+            itemId = [parser shortAtIndex:entryOffset];
+            entryOffset += 2;
+        } else {
+            itemId = [parser intAtIndex:entryOffset];
+            entryOffset += 4;
+        }
+        uint8_t associationCount = [parser byteAtIndex:entryOffset];
+        entryOffset += 1;
+        for (uint8_t j = 0; j < associationCount; j++) {
+            NSUInteger propertyIndex;
+            if (hasLargePropertyIndices) {
+                propertyIndex = [parser shortAtIndex:entryOffset] & 0x7fff;
+                entryOffset += 2;
+            } else {
+                propertyIndex = [parser byteAtIndex:entryOffset] & 0x7f;
+                entryOffset += 1;
+            }
+            if (itemId == primaryItemId) {
+                [primaryPropertyIndices addObject:@(propertyIndex)];
+            }
+        }
+    }
+    if (parser.hasError) {
+        return nil;
+    }
+
+    ImageHeaderInfo *headerInfo = [ImageHeaderInfo new];
+    BOOL hasSize = NO;
+    for (NSNumber *propertyIndex in primaryPropertyIndices) {
+        if (propertyIndex.unsignedIntegerValue < 1 || propertyIndex.unsignedIntegerValue > propertyOffsets.count) {
+            continue;
+        }
+        NSUInteger property = propertyOffsets[propertyIndex.unsignedIntegerValue - 1].unsignedIntegerValue;
+        if (HasFourCC(meta, property + 4, "ispe")) {
+            // A full box, followed by the width and height.
+            headerInfo.pixelSize = CGSizeMake([parser intAtIndex:property + 12], [parser intAtIndex:property + 16]);
+            hasSize = YES;
+        } else if (HasFourCC(meta, property + 4, "pixi")) {
+            // A full box, followed by the channel count and the bits per channel.
+            uint8_t channelCount = [parser byteAtIndex:property + 12];
+            NSUInteger depthBits = 0;
+            for (uint8_t channel = 0; channel < channelCount; channel++) {
+                depthBits = MAX(depthBits, [parser byteAtIndex:property + 13 + channel]);
+            }
+            if (depthBits > 0) {
+                headerInfo.depthBits = depthBits;
+            }
+        } else if (HasFourCC(meta, property + 4, "irot") || HasFourCC(meta, property + 4, "imir")) {
+            // ImageIO reconciles these transforms with any EXIF orientation.
+            return nil;
+        }
+    }
+    if (!hasSize || parser.hasError) {
+        return nil;
+    }
+    headerInfo.hasAlpha = NO;
+    headerInfo.isAnimated = NO;
+    return headerInfo;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
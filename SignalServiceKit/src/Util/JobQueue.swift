@@ -3,6 +3,7 @@
 //
 
 import Foundation
+import GRDB
 
 /// JobQueue - A durable work queue
 ///
@@ -74,7 +75,12 @@ public protocol JobQueue: DurableOperationDelegate {
     func add(jobRecord: JobRecordType, transaction: SDSAnyWriteTransaction)
     func restartOldJobs()
     func workStep()
+    func defaultWorkStep()
     func defaultSetup()
+    func didMarkAsReady(oldJobRecords: [JobRecordType], transaction: SDSAnyWriteTransaction)
+
+    /// The most ready jobs that `defaultWorkStep` will start per write transaction.
+    var maxJobsPerWorkStep: Int { get }
 
     // MARK: Required
 
@@ -89,11 +95,11 @@ public protocol JobQueue: DurableOperationDelegate {
     func operationQueue(jobRecord: JobRecordType) -> OperationQueue
     func buildOperation(jobRecord: JobRecordType, transaction: SDSAnyReadTransaction) throws -> DurableOperationType
 
-    /// When `requiresInternet` is true, we immediately run any jobs which are waiting for retry upon detecting Reachability.
+    /// When `requiresInternet` is true, DurableOperationRetryScheduler holds back the retries of these jobs while
+    /// we're offline, and runs any jobs which are waiting for retry upon detecting Reachability.
     ///
-    /// Because `Reachability` isn't 100% reliable, the jobs will be attempted regardless of what we think our current Reachability is.
-    /// However, because these jobs will likely fail many times in succession, their `retryInterval` could be quite long by the time we
-    /// are back online.
+    /// Because these jobs will likely fail many times in succession, their `retryInterval` could be quite long by the
+    /// time we are back online.
     var requiresInternet: Bool { get }
     static var maxRetries: UInt { get }
 }
@@ -110,8 +116,8 @@ public extension JobQueue {
         return AnyJobRecordFinder<JobRecordType>()
     }
 
-    var reachabilityManager: SSKReachabilityManager {
-        return SSKEnvironment.shared.reachabilityManager
+    var maxJobsPerWorkStep: Int {
+        return 8
     }
 
     // MARK: 
@@ -130,6 +136,11 @@ public extension JobQueue {
         return nil != finder.getNextReady(label: self.jobRecordLabel, transaction: transaction)
     }
 
+    func pendingJobCount(transaction: SDSAnyReadTransaction) -> UInt {
+        return finder.jobCount(label: self.jobRecordLabel, status: .ready, transaction: transaction)
+            + finder.jobCount(label: self.jobRecordLabel, status: .running, transaction: transaction)
+    }
+
     func startWorkWhenAppIsReady() {
         guard !CurrentAppContext().isRunningTests else {
             DispatchQueue.global().async {
@@ -149,6 +160,13 @@ public extension JobQueue {
     }
 
     func workStep() {
+        defaultWorkStep()
+    }
+
+    /// Queues may provide their own `workStep` and fall back to this
+    /// implementation, which starts one operation per ready job record,
+    /// up to `maxJobsPerWorkStep` of them per write transaction.
+    func defaultWorkStep() {
         Logger.debug("")
 
         guard !DebugFlags.suppressBackgroundActivity else {
@@ -165,42 +183,52 @@ public extension JobQueue {
         }
 
         self.databaseStorage.write { transaction in
-            guard let nextJob: JobRecordType = self.finder.getNextReady(label: self.jobRecordLabel, transaction: transaction) else {
+            let readyJobs = self.finder.nextReadyRecords(label: self.jobRecordLabel,
+                                                         limit: self.maxJobsPerWorkStep,
+                                                         transaction: transaction)
+            guard !readyJobs.isEmpty else {
                 Logger.verbose("nothing left to enqueue")
                 self.didFlushQueue(transaction: transaction)
                 return
             }
 
-            do {
-                try nextJob.saveAsStarted(transaction: transaction)
+            for nextJob in readyJobs {
+                self.startOperation(jobRecord: nextJob, transaction: transaction)
+            }
 
-                let operationQueue = self.operationQueue(jobRecord: nextJob)
-                let durableOperation = try self.buildOperation(jobRecord: nextJob, transaction: transaction)
+            DispatchQueue.global().async {
+                self.workStep()
+            }
+        }
+    }
 
-                durableOperation.durableOperationDelegate = self as? Self.DurableOperationType.DurableOperationDelegateType
-                assert(durableOperation.durableOperationDelegate != nil)
+    private func startOperation(jobRecord nextJob: JobRecordType, transaction: SDSAnyWriteTransaction) {
+        do {
+            try nextJob.saveAsStarted(transaction: transaction)
 
-                let remainingRetries = self.remainingRetries(durableOperation: durableOperation)
-                durableOperation.remainingRetries = remainingRetries
+            let operationQueue = self.operationQueue(jobRecord: nextJob)
+            let durableOperation = try self.buildOperation(jobRecord: nextJob, transaction: transaction)
 
-                self.runningOperations.append(durableOperation)
+            durableOperation.durableOperationDelegate = self as? Self.DurableOperationType.DurableOperationDelegateType
+            assert(durableOperation.durableOperationDelegate != nil)
 
-                Logger.debug("adding operation: \(durableOperation) with remainingRetries: \(remainingRetries)")
-                operationQueue.addOperation(durableOperation.operation)
-            } catch JobError.assertionFailure(let description) {
-                owsFailDebug("assertion failure: \(description)")
-                nextJob.saveAsPermanentlyFailed(transaction: transaction)
-            } catch JobError.obsolete(let description) {
-                // TODO is this even worthwhile to have obsolete state? Should we just delete the task outright?
-                Logger.verbose("marking obsolete task as such. description:\(description)")
-                nextJob.saveAsObsolete(transaction: transaction)
-            } catch {
-                owsFailDebug("unexpected error")
-            }
+            let remainingRetries = self.remainingRetries(durableOperation: durableOperation)
+            durableOperation.remainingRetries = remainingRetries
+            durableOperation.operation.retryRequiresReachability = self.requiresInternet
 
-            DispatchQueue.global().async {
-                self.workStep()
-            }
+            self.runningOperations.append(durableOperation)
+
+            Logger.debug("adding operation: \(durableOperation) with remainingRetries: \(remainingRetries)")
+            operationQueue.addOperation(durableOperation.operation)
+        } catch JobError.assertionFailure(let description) {
+            owsFailDebug("assertion failure: \(description)")
+            nextJob.saveAsPermanentlyFailed(transaction: transaction)
+        } catch JobError.obsolete(let description) {
+            // TODO is this even worthwhile to have obsolete state? Should we just delete the task outright?
+            Logger.verbose("marking obsolete task as such. description:\(description)")
+            nextJob.saveAsObsolete(transaction: transaction)
+        } catch {
+            owsFailDebug("unexpected error")
         }
     }
 
@@ -212,15 +240,27 @@ public extension JobQueue {
         databaseStorage.write { transaction in
             let runningRecords = self.finder.allRecords(label: self.jobRecordLabel, status: .running, transaction: transaction)
             Logger.info("marking old `running` \(self.jobRecordLabel) JobRecords as ready: \(runningRecords.count)")
+            var readyRecords = [JobRecordType]()
             for jobRecord in runningRecords {
                 do {
                     try jobRecord.saveRunningAsReady(transaction: transaction)
-                    self.didMarkAsReady(oldJobRecord: jobRecord, transaction: transaction)
+                    readyRecords.append(jobRecord)
                 } catch {
                     owsFailDebug("failed to mark old running records as ready error: \(error)")
                     jobRecord.saveAsPermanentlyFailed(transaction: transaction)
                 }
             }
+            if !readyRecords.isEmpty {
+                self.didMarkAsReady(oldJobRecords: readyRecords, transaction: transaction)
+            }
+        }
+    }
+
+    /// Queues whose `didMarkAsReady` touches other records can override this
+    /// to handle all of the restarted jobs at once.
+    func didMarkAsReady(oldJobRecords: [JobRecordType], transaction: SDSAnyWriteTransaction) {
+        for jobRecord in oldJobRecords {
+            didMarkAsReady(oldJobRecord: jobRecord, transaction: transaction)
         }
     }
 
@@ -245,20 +285,6 @@ public extension JobQueue {
             guard let self = self else {
                 return
             }
-            if self.requiresInternet {
-                NotificationCenter.default.addObserver(forName: SSKReachability.owsReachabilityDidChange,
-                                                       object: self.reachabilityManager.observationContext,
-                                                       queue: nil) { _ in
-
-                                                        if self.reachabilityManager.isReachable {
-                                                            Logger.verbose("isReachable: true")
-                                                            self.becameReachable()
-                                                        } else {
-                                                            Logger.verbose("isReachable: false")
-                                                        }
-                }
-            }
-
             self.isSetup.set(true)
             self.startWorkWhenAppIsReady()
         }
@@ -275,15 +301,6 @@ public extension JobQueue {
         return maxRetries - failureCount
     }
 
-    func becameReachable() {
-        guard requiresInternet else {
-            owsFailDebug("should only be called if `requiresInternet` is true")
-            return
-        }
-
-        _ = self.runAnyQueuedRetry()
-    }
-
     func runAnyQueuedRetry() -> DurableOperationType? {
         guard let runningDurableOperation = self.runningOperations.first else {
             return nil
@@ -335,6 +352,7 @@ public protocol JobRecordFinder {
     associatedtype JobRecordType: SSKJobRecord
 
     func getNextReady(label: String, transaction: ReadTransaction) -> JobRecordType?
+    func nextReadyRecords(label: String, limit: Int, transaction: ReadTransaction) -> [JobRecordType]
     func allRecords(label: String, status: SSKJobRecordStatus, transaction: ReadTransaction) -> [JobRecordType]
     func enumerateJobRecords(label: String, transaction: ReadTransaction, block: @escaping (JobRecordType, UnsafeMutablePointer<ObjCBool>) -> Void)
     func enumerateJobRecords(label: String, status: SSKJobRecordStatus, transaction: ReadTransaction, block: @escaping (JobRecordType, UnsafeMutablePointer<ObjCBool>) -> Void)
@@ -350,6 +368,20 @@ extension JobRecordFinder {
         return result
     }
 
+    public func nextReadyRecords(label: String, limit: Int, transaction: ReadTransaction) -> [JobRecordType] {
+        var result: [JobRecordType] = []
+        guard limit > 0 else {
+            return result
+        }
+        self.enumerateJobRecords(label: label, status: .ready, transaction: transaction) { jobRecord, stopPointer in
+            result.append(jobRecord)
+            if result.count >= limit {
+                stopPointer.pointee = true
+            }
+        }
+        return result
+    }
+
     public func allRecords(label: String, status: SSKJobRecordStatus, transaction: ReadTransaction) -> [JobRecordType] {
         var result: [JobRecordType] = []
         self.enumerateJobRecords(label: label, status: status, transaction: transaction) { jobRecord, _ in
@@ -379,6 +411,19 @@ public class AnyJobRecordFinder<JobRecordType> where JobRecordType: SSKJobRecord
     lazy var yapAdapter = YAPDBJobRecordFinder<JobRecordType>()
 
     public init() {}
+
+    public func jobCount(label: String, status: SSKJobRecordStatus, transaction: SDSAnyReadTransaction) -> UInt {
+        switch transaction.readTransaction {
+        case .grdbRead(let grdbRead):
+            return grdbAdapter.jobCount(label: label, status: status, transaction: grdbRead)
+        case .yapRead(let yapRead):
+            var result: UInt = 0
+            yapAdapter.enumerateJobRecords(label: label, status: status, transaction: yapRead) { _, _ in
+                result += 1
+            }
+            return result
+        }
+    }
 }
 
 extension AnyJobRecordFinder: JobRecordFinder {
@@ -402,7 +447,14 @@ extension AnyJobRecordFinder: JobRecordFinder {
 }
 
 class GRDBJobRecordFinder<JobRecordType> where JobRecordType: SSKJobRecord {
-
+    func jobCount(label: String, status: SSKJobRecordStatus, transaction: GRDBReadTransaction) -> UInt {
+        let sql = """
+            SELECT COUNT(*) FROM \(JobRecordRecord.databaseTableName)
+            WHERE \(jobRecordColumn: .status) = ?
+              AND \(jobRecordColumn: .label) = ?
+        """
+        return try! UInt.fetchOne(transaction.database, sql: sql, arguments: [status.rawValue, label]) ?? 0
+    }
 }
 
 extension GRDBJobRecordFinder: JobRecordFinder {
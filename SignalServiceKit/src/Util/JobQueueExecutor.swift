@@ -0,0 +1,65 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// The kind of resource a durable job mostly waits on.
+public enum JobConcurrencyClass: CustomStringConvertible {
+    /// Jobs that spend most of their time waiting on the service.
+    case network
+    /// Jobs that spend most of their time in write transactions.
+    case database
+
+    public var description: String {
+        switch self {
+        case .network:
+            return "network"
+        case .database:
+            return "database"
+        }
+    }
+
+    var maxConcurrentOperationCount: Int {
+        switch self {
+        case .network:
+            return 4
+        case .database:
+            // Writes are serialized by the database anyway; running more
+            // than one of these jobs at a time only adds lock contention.
+            return 1
+        }
+    }
+}
+
+// MARK: -
+
+/// Shared operation queues for job queues that don't need their own ordering.
+///
+/// Queues which must preserve an order between their jobs (e.g. per-thread
+/// message sending) should keep vending their own serial queues instead.
+public class JobQueueExecutor {
+
+    public static let shared = JobQueueExecutor()
+
+    private let networkQueue = JobQueueExecutor.buildOperationQueue(concurrencyClass: .network)
+    private let databaseQueue = JobQueueExecutor.buildOperationQueue(concurrencyClass: .database)
+
+    private init() {}
+
+    private static func buildOperationQueue(concurrencyClass: JobConcurrencyClass) -> OperationQueue {
+        let operationQueue = OperationQueue()
+        operationQueue.name = "JobQueueExecutor.\(concurrencyClass)"
+        operationQueue.maxConcurrentOperationCount = concurrencyClass.maxConcurrentOperationCount
+        return operationQueue
+    }
+
+    public func operationQueue(concurrencyClass: JobConcurrencyClass) -> OperationQueue {
+        switch concurrencyClass {
+        case .network:
+            return networkQueue
+        case .database:
+            return databaseQueue
+        }
+    }
+}
@@ -75,27 +75,50 @@ public class KeyBackupService: NSObject {
     /// This is a local verification and does not make any requests to the KBS.
     @objc
     public static func verifyPin(_ pin: String, resultHandler: @escaping (Bool) -> Void) {
-        DispatchQueue.global().async {
-            var isValid = false
-            defer {
-                DispatchQueue.main.async { resultHandler(isValid) }
-            }
+        verifyPin(pin).done { isValid in
+            resultHandler(isValid)
+        }.catch { error in
+            owsFailDebug("Failed to verify pin with error: \(error)")
+            resultHandler(false)
+        }
+    }
 
+    /// Indicates whether your pin is valid when compared to your stored keys.
+    /// This is a local verification and does not make any requests to the KBS.
+    ///
+    /// Once a pin has been verified, verifying it again in the same session
+    /// doesn't re-derive it. If `cancellation` is cancelled before the
+    /// verification completes, the promise is rejected with `PMKError.cancelled`.
+    public static func verifyPin(_ pin: String, cancellation: DerivationCancellation? = nil) -> Promise<Bool> {
+        return firstly(on: derivationQueue) { () -> Bool in
             guard let encodedVerificationString = getOrLoadStateWithSneakyTransaction().encodedVerificationString else {
                 owsFailDebug("Attempted to verify pin locally when we don't have a verification string")
-                return
+                return false
             }
 
-            guard let pinData = normalizePin(pin).data(using: .utf8) else {
+            guard let pinData = normalizePin(pin).data(using: .utf8),
+                let digest = derivationDigest(pinData: pinData, salt: Data(encodedVerificationString.utf8)) else {
                 owsFailDebug("failed to determine pin data")
-                return
+                return false
             }
 
+            if cacheQueue.sync(execute: { verifiedPinDigests.contains(digest) }) { return true }
+
+            try cancellation?.throwIfCancelled()
+
+            let isValid: Bool
             do {
                 isValid = try Argon2.verify(encoded: encodedVerificationString, password: pinData, variant: .i)
             } catch {
                 owsFailDebug("Failed to validate encodedVerificationString with error: \(error)")
+                return false
             }
+
+            try cancellation?.throwIfCancelled()
+
+            if isValid { cacheQueue.sync { _ = verifiedPinDigests.insert(digest) } }
+
+            return isValid
         }
     }
 
@@ -105,19 +128,28 @@ public class KeyBackupService: NSObject {
     }
 
     /// Loads the users key, if any, from the KBS into the database.
-    public static func restoreKeys(with pin: String, and auth: RemoteAttestationAuth? = nil) -> Promise<Void> {
+    ///
+    /// If `cancellation` is cancelled before the keys have been derived from
+    /// the pin, no request is made and the promise is rejected with
+    /// `PMKError.cancelled`.
+    public static func restoreKeys(
+        with pin: String,
+        and auth: RemoteAttestationAuth? = nil,
+        cancellation: DerivationCancellation? = nil
+    ) -> Promise<Void> {
         // When restoring your backup we want to check the current enclave first,
         // and then fallback to previous enclaves if the current enclave has no
         // record of you. It's important that these are ordered from neweset enclave
         // to oldest enclave, so we start with the newest enclave and then progressively
         // check older enclaves.
         let enclavesToCheck = [TSConstants.keyBackupEnclave] + TSConstants.keyBackupPreviousEnclaves
-        return restoreKeys(pin: pin, auth: auth, enclavesToCheck: enclavesToCheck)
+        return restoreKeys(pin: pin, auth: auth, cancellation: cancellation, enclavesToCheck: enclavesToCheck)
     }
 
     private static func restoreKeys(
         pin: String,
         auth: RemoteAttestationAuth?,
+        cancellation: DerivationCancellation?,
         enclavesToCheck: [KeyBackupEnclave]
     ) -> Promise<Void> {
         guard let enclave = enclavesToCheck.first else {
@@ -127,11 +159,17 @@ public class KeyBackupService: NSObject {
         return restoreKeys(
             pin: pin,
             auth: auth,
+            cancellation: cancellation,
             enclave: enclave
         ).recover { error -> Promise<Void> in
             if let error = error as? KBSError, error == .backupMissing, enclavesToCheck.count > 1 {
                 // There's no backup on this enclave, but we have more enclaves we can try.
-                return restoreKeys(pin: pin, auth: auth, enclavesToCheck: Array(enclavesToCheck.dropFirst()))
+                return restoreKeys(
+                    pin: pin,
+                    auth: auth,
+                    cancellation: cancellation,
+                    enclavesToCheck: Array(enclavesToCheck.dropFirst())
+                )
             }
 
             throw error
@@ -141,6 +179,7 @@ public class KeyBackupService: NSObject {
     private static func restoreKeys(
         pin: String,
         auth: RemoteAttestationAuth?,
+        cancellation: DerivationCancellation?,
         enclave: KeyBackupEnclave
     ) -> Promise<Void> {
         Logger.info("Attempting KBS restore from enclave \(enclave.name)")
@@ -148,8 +187,8 @@ public class KeyBackupService: NSObject {
         return fetchBackupId(
             auth: auth,
             enclave: enclave
-        ).map(on: .global()) { backupId in
-            return try deriveEncryptionKeyAndAccessKey(pin: pin, backupId: backupId)
+        ).then { backupId in
+            deriveEncryptionKeyAndAccessKey(pin: pin, backupId: backupId, cancellation: cancellation)
         }.then { encryptionKey, accessKey in
             restoreKeyRequest(
                 accessKey: accessKey,
@@ -205,13 +244,18 @@ public class KeyBackupService: NSObject {
             // This resets the number of remaining attempts. We always
             // backup to the current enclave, even if we restored from
             // a previous enclave.
-            return backupKeyRequest(
-                accessKey: accessKey,
-                encryptedMasterKey: encryptedMasterKey,
-                enclave: currentEnclave,
-                auth: auth
-            ).map { ($0, masterKey) }
-        }.done(on: .global()) { response, masterKey in
+            // The pin is now known to be correct, so derive its verification
+            // string while the request is in flight.
+            return when(
+                fulfilled: backupKeyRequest(
+                    accessKey: accessKey,
+                    encryptedMasterKey: encryptedMasterKey,
+                    enclave: currentEnclave,
+                    auth: auth
+                ),
+                deriveEncodedVerificationString(pin: pin, cancellation: nil)
+            ).map { ($0, masterKey, $1) }
+        }.done(on: .global()) { response, masterKey, encodedVerificationString in
             guard let status = response.status else {
                 owsFailDebug("KBS backup is missing status")
                 throw KBSError.assertion
@@ -240,8 +284,6 @@ public class KeyBackupService: NSObject {
                 owsFailDebug("the server thinks we provided a `validFrom` in the future")
                 throw KBSError.assertion
             case .ok:
-                let encodedVerificationString = try deriveEncodedVerificationString(pin: pin)
-
                 // We successfully stored the new keys in KBS, save them in the database.
                 // Since the backup request is always for the current enclave, we want to
                 // record the current enclave's name.
@@ -270,6 +312,8 @@ public class KeyBackupService: NSObject {
                 throw error
             }
         }.recover(on: .global()) { error in
+            guard !error.isCancelled else { throw error }
+
             guard let kbsError = error as? KBSError else {
                 owsFailDebug("Unexpectedly surfacing a non KBS error \(error)")
                 throw error
@@ -291,22 +335,26 @@ public class KeyBackupService: NSObject {
         return fetchBackupId(
             auth: nil,
             enclave: currentEnclave
-        ).map(on: .global()) { backupId -> (Data, Data, Data) in
+        ).then { backupId in
+            deriveEncryptionKeyAndAccessKey(pin: pin, backupId: backupId, cancellation: nil)
+        }.map(on: .global()) { encryptionKey, accessKey -> (Data, Data, Data) in
             let masterKey: Data = {
                 if rotateMasterKey { return generateMasterKey() }
                 return getOrLoadStateWithSneakyTransaction().masterKey ?? generateMasterKey()
             }()
-            let (encryptionKey, accessKey) = try deriveEncryptionKeyAndAccessKey(pin: pin, backupId: backupId)
             let encryptedMasterKey = try encryptMasterKey(masterKey, encryptionKey: encryptionKey)
 
             return (masterKey, encryptedMasterKey, accessKey)
-        }.then { masterKey, encryptedMasterKey, accessKey -> Promise<(KeyBackupProtoBackupResponse, Data)> in
-            backupKeyRequest(
-                accessKey: accessKey,
-                encryptedMasterKey: encryptedMasterKey,
-                enclave: currentEnclave
-            ).map { ($0, masterKey) }
-        }.done(on: .global()) { response, masterKey in
+        }.then { masterKey, encryptedMasterKey, accessKey -> Promise<(KeyBackupProtoBackupResponse, Data, String)> in
+            when(
+                fulfilled: backupKeyRequest(
+                    accessKey: accessKey,
+                    encryptedMasterKey: encryptedMasterKey,
+                    enclave: currentEnclave
+                ),
+                deriveEncodedVerificationString(pin: pin, cancellation: nil)
+            ).map { ($0, masterKey, $1) }
+        }.done(on: .global()) { response, masterKey, encodedVerificationString in
             guard let status = response.status else {
                 owsFailDebug("KBS backup is missing status")
                 throw KBSError.assertion
@@ -333,8 +381,6 @@ public class KeyBackupService: NSObject {
                 owsFailDebug("the server thinks we provided a `validFrom` in the future")
                 throw KBSError.assertion
             case .ok:
-                let encodedVerificationString = try deriveEncodedVerificationString(pin: pin)
-
                 // We successfully stored the new keys in KBS, save them in the database
                 databaseStorage.write { transaction in
                     store(
@@ -494,7 +540,7 @@ public class KeyBackupService: NSObject {
     }
 
     static func deriveEncryptionKeyAndAccessKey(pin: String, backupId: Data) throws -> (encryptionKey: Data, accessKey: Data) {
-        assertIsOnBackgroundQueue()
+        assertIsOnDerivationQueue()
 
         guard let pinData = normalizePin(pin).data(using: .utf8) else { throw KBSError.assertion }
         guard backupId.count == 32 else { throw KBSError.assertion }
@@ -514,7 +560,7 @@ public class KeyBackupService: NSObject {
     }
 
     static func deriveEncodedVerificationString(pin: String, salt: Data = Cryptography.generateRandomBytes(16)) throws -> String {
-        assertIsOnBackgroundQueue()
+        assertIsOnDerivationQueue()
 
         guard let pinData = normalizePin(pin).data(using: .utf8) else { throw KBSError.assertion }
         guard salt.count == 16 else { throw KBSError.assertion }
@@ -533,6 +579,100 @@ public class KeyBackupService: NSObject {
         return encodedString
     }
 
+    // PRAGMA MARK: - Pin Derivation
+
+    /// Cancels a pin derivation that hasn't completed yet.
+    ///
+    /// Argon2 can't be interrupted, so a derivation that has already started
+    /// runs to completion, but its result is discarded.
+    public class DerivationCancellation {
+        private let isCancelledFlag = AtomicBool(false)
+
+        public init() {}
+
+        public var isCancelled: Bool { isCancelledFlag.get() }
+
+        public func cancel() { isCancelledFlag.set(true) }
+
+        func throwIfCancelled() throws {
+            guard isCancelled else { return }
+            throw PMKError.cancelled
+        }
+    }
+
+    // Derivations are memory-hard, so they are performed one at a time on a
+    // dedicated queue. The user is usually waiting on them.
+    private static let derivationQueue = DispatchQueue(
+        label: "org.signal.KeyBackupService.derivation",
+        qos: .userInitiated
+    )
+
+    private static func assertIsOnDerivationQueue() {
+        guard !CurrentAppContext().isRunningTests else { return }
+        assertOnQueue(derivationQueue)
+    }
+
+    // Derivation results are kept in memory for the rest of the session,
+    // keyed by a digest of their inputs so the pin itself isn't retained.
+    // These properties should only be accessed on cacheQueue.
+    private static var derivedKeysCache = [Data: (encryptionKey: Data, accessKey: Data)]()
+    private static var verifiedPinDigests = Set<Data>()
+
+    private static func derivationDigest(pinData: Data, salt: Data) -> Data? {
+        return Cryptography.computeSHA256HMAC(pinData, withHMACKey: salt)
+    }
+
+    private static func clearDerivationCaches() {
+        cacheQueue.sync {
+            derivedKeysCache.removeAll()
+            verifiedPinDigests.removeAll()
+        }
+    }
+
+    /// Derives the keys for a pin on the derivation queue, unless they were
+    /// already derived with the same backup id in this session.
+    static func deriveEncryptionKeyAndAccessKey(
+        pin: String,
+        backupId: Data,
+        cancellation: DerivationCancellation?
+    ) -> Promise<(encryptionKey: Data, accessKey: Data)> {
+        let digest = normalizePin(pin).data(using: .utf8).flatMap { derivationDigest(pinData: $0, salt: backupId) }
+        if let digest = digest, let keys = cacheQueue.sync(execute: { derivedKeysCache[digest] }) {
+            return Promise.value(keys)
+        }
+
+        return firstly(on: derivationQueue) { () -> (encryptionKey: Data, accessKey: Data) in
+            try cancellation?.throwIfCancelled()
+            let keys = try deriveEncryptionKeyAndAccessKey(pin: pin, backupId: backupId)
+            try cancellation?.throwIfCancelled()
+
+            if let digest = digest { cacheQueue.sync { derivedKeysCache[digest] = keys } }
+
+            return keys
+        }
+    }
+
+    /// Derives a new verification string for a pin on the derivation queue.
+    /// The pin is then considered verified against it for the rest of the
+    /// session, so confirming the pin doesn't derive it again.
+    static func deriveEncodedVerificationString(
+        pin: String,
+        cancellation: DerivationCancellation?
+    ) -> Promise<String> {
+        return firstly(on: derivationQueue) { () -> String in
+            try cancellation?.throwIfCancelled()
+            let encodedVerificationString = try deriveEncodedVerificationString(pin: pin)
+            try cancellation?.throwIfCancelled()
+
+            if let pinData = normalizePin(pin).data(using: .utf8),
+                let digest = derivationDigest(pinData: pinData, salt: Data(encodedVerificationString.utf8)) {
+                cacheQueue.sync { _ = verifiedPinDigests.insert(digest) }
+            }
+
+            return encodedVerificationString
+        }
+    }
+
     @objc
     public static func normalizePin(_ pin: String) -> String {
         // Trim leading and trailing whitespace
@@ -673,6 +813,10 @@ public class KeyBackupService: NSObject {
     @objc
     public static func warmCaches() {
         let state = getOrLoadStateWithSneakyTransaction()
+        // Only the main app migrates enclaves; it needn't hold up extensions.
+        guard CurrentAppContext().isMainApp else {
+            return
+        }
         migrateEnclavesIfNecessary(state: state)
     }
 
@@ -729,6 +873,8 @@ public class KeyBackupService: NSObject {
             keyValueStore.removeValue(forKey: type.rawValue, transaction: transaction)
         }
 
+        clearDerivationCaches()
+
         reloadState(transaction: transaction)
     }
 
@@ -35,6 +35,9 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
     private var cacheOrder: [KeyType] = []
     private let maxSize: Int
 
+    // The cache isn't thread-safe, but its size may be read on any thread.
+    private let entryCount = AtomicUInt(0)
+
     @objc
     public init(maxSize: Int) {
         self.maxSize = maxSize
@@ -95,11 +98,27 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
             cacheOrder.removeFirst()
             cacheMap.removeValue(forKey: staleKey)
         }
+        entryCount.set(UInt(cacheMap.count))
     }
 
     @objc
     public func clear() {
         cacheMap.removeAll()
         cacheOrder.removeAll()
+        entryCount.set(0)
+    }
+}
+
+// MARK: -
+
+extension LRUCache: MemoryAccountable {
+    // This only counts the entries' inline storage, not whatever they
+    // reference, so it is a lower bound.
+    public var estimatedByteCount: Int {
+        Int(entryCount.get()) * (MemoryLayout<KeyType>.stride + MemoryLayout<ValueType>.stride)
+    }
+
+    public func shedMemory() {
+        clear()
     }
 }
@@ -0,0 +1,207 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// The named phases of a cold launch of the main app or the NSE, roughly
+/// in order.
+/// Some phases are nested in others, e.g. GRDB schema migrations are
+/// part of version migrations.
+@objc
+public enum LaunchPhase: Int, CaseIterable {
+    // From process creation to didFinishLaunching (or NSE setup).
+    case preMain
+    case appSetup
+    case storageOpen
+    case extensionRegistration
+    case versionMigrations
+    case grdbSchemaMigrations
+    case launchJobs
+    // The "will/did become ready" blocks; the polite blocks run later.
+    case appReadiness
+    // From presenting the root view controller to the first frame of
+    // the conversation list.
+    case firstConversationListRender
+    case firstConversationRender
+
+    fileprivate var name: String {
+        switch self {
+        case .preMain: return "Pre-main"
+        case .appSetup: return "App setup"
+        case .storageOpen: return "Storage open"
+        case .extensionRegistration: return "YDB extension registration"
+        case .versionMigrations: return "Version migrations"
+        case .grdbSchemaMigrations: return "GRDB schema migrations"
+        case .launchJobs: return "Launch jobs"
+        case .appReadiness: return "App readiness blocks"
+        case .firstConversationListRender: return "First conversation list render"
+        case .firstConversationRender: return "First conversation render"
+        }
+    }
+}
+
+// MARK: -
+
+/// Times the phases of a cold launch, so that we can tell which dominate.
+///
+/// Each phase is only timed the first time it runs, and only once the
+/// launch has started, so phases which also run later (e.g. schema
+/// migrations after a storage reload) or in other processes are ignored.
+/// The phases are logged once the first frame of the conversation list has
+/// rendered or, for launches in the background, once the app is ready;
+/// phases which end later (e.g. the first conversation render) are logged
+/// as they end. They are also traced with signposts; see Signposts.
+///
+/// This class is thread-safe.
+@objc
+public class LaunchTimer: NSObject {
+
+    @objc
+    public static let shared = LaunchTimer()
+
+    private struct PhaseTiming {
+        let startTime: CFTimeInterval
+        var endTime: CFTimeInterval?
+        let signpostId: UInt64
+    }
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var launchStartedAt: CFTimeInterval?
+    private var phaseTimings = [LaunchPhase: PhaseTiming]()
+    private var hasLoggedReport = false
+
+    private override init() {
+        super.init()
+    }
+
+    /// This should be called as early as possible in didFinishLaunching
+    /// (or, in the NSE, when it is first set up), with the same time base as
+    /// CACurrentMediaTime().
+    @objc
+    public func launchDidStart(at launchStartedAt: CFTimeInterval) {
+        unfairLock.withLock {
+            guard self.launchStartedAt == nil else {
+                owsFailDebug("Launch already started.")
+                return
+            }
+            self.launchStartedAt = launchStartedAt
+
+            if let processAge = Self.processAge() {
+                let processStartedAt = CACurrentMediaTime() - processAge
+                phaseTimings[.preMain] = PhaseTiming(startTime: processStartedAt,
+                                                     endTime: launchStartedAt,
+                                                     signpostId: 0)
+            }
+        }
+    }
+
+    @objc(beginPhase:)
+    public func begin(_ phase: LaunchPhase) {
+        let now = CACurrentMediaTime()
+        unfairLock.withLock {
+            guard launchStartedAt != nil, phaseTimings[phase] == nil else {
+                return
+            }
+            let signpostId = Signposts.begin(.launchPhase, phase.name)
+            phaseTimings[phase] = PhaseTiming(startTime: now, endTime: nil, signpostId: signpostId)
+        }
+    }
+
+    @objc(endPhase:)
+    public func end(_ phase: LaunchPhase) {
+        let now = CACurrentMediaTime()
+        // The app readiness phase ends on the main thread, where we can
+        // check the app's state.
+        let isLaunchInBackground = phase == .appReadiness && !CurrentAppContext().isMainAppAndActive
+        let (shouldLogReport, lateLogLine): (Bool, String?) = unfairLock.withLock {
+            guard let launchStartedAt = launchStartedAt,
+                  var phaseTiming = phaseTimings[phase],
+                  phaseTiming.endTime == nil else {
+                return (false, nil)
+            }
+            phaseTiming.endTime = now
+            phaseTimings[phase] = phaseTiming
+            Signposts.end(.launchPhase, phaseTiming.signpostId)
+
+            guard !hasLoggedReport else {
+                return (false, "Launch phase " + Self.logLine(phase: phase,
+                                                             phaseTiming: phaseTiming,
+                                                             launchStartedAt: launchStartedAt))
+            }
+            switch phase {
+            case .firstConversationListRender:
+                return (true, nil)
+            case .appReadiness:
+                return (isLaunchInBackground, nil)
+            default:
+                return (false, nil)
+            }
+        }
+        if let lateLogLine = lateLogLine {
+            Logger.info(lateLogLine)
+        }
+        if shouldLogReport {
+            logReport()
+        }
+    }
+
+    @objc(measurePhase:block:)
+    public func measure(_ phase: LaunchPhase, block: () -> Void) {
+        begin(phase)
+        block()
+        end(phase)
+    }
+
+    private func logReport() {
+        let report: String? = unfairLock.withLock {
+            guard !hasLoggedReport, let launchStartedAt = launchStartedAt else {
+                return nil
+            }
+            hasLoggedReport = true
+
+            var lines = ["Launch phases:"]
+            for phase in LaunchPhase.allCases {
+                guard let phaseTiming = phaseTimings[phase] else {
+                    continue
+                }
+                lines.append("  " + Self.logLine(phase: phase,
+                                                 phaseTiming: phaseTiming,
+                                                 launchStartedAt: launchStartedAt))
+            }
+            let totalDuration = CACurrentMediaTime() - launchStartedAt
+            lines.append(String(format: "  Total: %0.0fms since didFinishLaunching.", totalDuration * 1000))
+            return lines.joined(separator: "\n")
+        }
+        if let report = report {
+            Logger.info(report)
+        }
+    }
+
+    private static func logLine(phase: LaunchPhase,
+                                phaseTiming: PhaseTiming,
+                                launchStartedAt: CFTimeInterval) -> String {
+        let start = String(format: "%+0.0fms", (phaseTiming.startTime - launchStartedAt) * 1000)
+        guard let endTime = phaseTiming.endTime else {
+            return "\(phase.name): started at \(start), incomplete"
+        }
+        let duration = String(format: "%0.0fms", (endTime - phaseTiming.startTime) * 1000)
+        return "\(phase.name): \(duration), started at \(start)"
+    }
+
+    // How long ago the kernel created this process.
+    private static func processAge() -> TimeInterval? {
+        var info = kinfo_proc()
+        var size = MemoryLayout<kinfo_proc>.stride
+        var mib: [Int32] = [CTL_KERN, KERN_PROC, KERN_PROC_PID, getpid()]
+        guard sysctl(&mib, u_int(mib.count), &info, &size, nil, 0) == 0 else {
+            Logger.warn("sysctl() failed: \(errno)")
+            return nil
+        }
+        let startTime = info.kp_proc.p_starttime
+        let processStartDate = Date(timeIntervalSince1970: TimeInterval(startTime.tv_sec)
+                                        + TimeInterval(startTime.tv_usec) / 1_000_000)
+        return -processStartDate.timeIntervalSinceNow
+    }
+}
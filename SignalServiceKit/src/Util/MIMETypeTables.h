@@ -0,0 +1,28 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+// This file is generated by mime_type_tables.py, do not manually edit it.
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSUInteger, OWSMIMETypeTable) {
+    OWSMIMETypeTableSupportedVideoMIMETypes,
+    OWSMIMETypeTableSupportedAudioMIMETypes,
+    OWSMIMETypeTableSupportedImageMIMETypes,
+    OWSMIMETypeTableSupportedBinaryDataMIMETypes,
+    OWSMIMETypeTableSupportedVideoExtensions,
+    OWSMIMETypeTableSupportedAudioExtensions,
+    OWSMIMETypeTableSupportedImageExtensions,
+    OWSMIMETypeTableGenericMIMETypes,
+    OWSMIMETypeTableGenericExtensions,
+};
+
+// Returns the value for `key`, or nil if the table doesn't contain it.
+//
+// The tables are static, so lookups don't allocate.
+NSString *_Nullable OWSMIMETypeTableLookup(OWSMIMETypeTable table, NSString *key);
+
+NSArray<NSString *> *OWSMIMETypeTableAllKeys(OWSMIMETypeTable table);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,2490 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+// This file is generated by mime_type_tables.py, do not manually edit it.
+
+#import "MIMETypeTables.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef struct {
+    const char *key;
+    __unsafe_unretained NSString *value;
+} OWSMIMETypeTableEntry;
+
+typedef struct {
+    const int32_t *seeds;
+    const OWSMIMETypeTableEntry *entries;
+    uint32_t count;
+} OWSMIMETypeTableDescriptor;
+
+static const size_t kOWSMIMETypeTableMaxKeyLength = 73;
+
+#pragma mark - SupportedVideoMIMETypes
+
+static const int32_t kSupportedVideoMIMETypesSeeds[6] = {
+    0, 1, -5, -3, -2, -1,
+};
+
+static const OWSMIMETypeTableEntry kSupportedVideoMIMETypesEntries[6] = {
+    { "video/quicktime", @"mov" },
+    { "video/mp4", @"mp4" },
+    { "video/x-m4v", @"m4v" },
+    { "video/3gpp2", @"3g2" },
+    { "video/mpeg", @"mpg" },
+    { "video/3gpp", @"3gp" },
+};
+
+#pragma mark - SupportedAudioMIMETypes
+
+static const int32_t kSupportedAudioMIMETypesSeeds[17] = {
+    0, 0, -14, -13, 2, -11, 0, -8, 1, 0,
+    1, 0, -3, 1, 1, 0, -2,
+};
+
+static const OWSMIMETypeTableEntry kSupportedAudioMIMETypesEntries[17] = {
+    { "audio/x-mpeg3", @"mp3" },
+    { "audio/mpeg", @"mp3" },
+    { "audio/3gpp", @"3gp" },
+    { "audio/aac", @"m4a" },
+    { "audio/wav", @"wav" },
+    { "audio/x-aiff", @"aiff" },
+    { "audio/mpeg3", @"mp3" },
+    { "audio/x-m4a", @"m4a" },
+    { "audio/x-mpeg", @"mp3" },
+    { "audio/x-wav", @"wav" },
+    { "audio/x-m4p", @"m4p" },
+    { "audio/mp3", @"mp3" },
+    { "audio/mp4", @"mp4" },
+    { "audio/3gpp2", @"3g2" },
+    { "audio/x-mp3", @"mp3" },
+    { "audio/x-m4b", @"m4b" },
+    { "audio/aiff", @"aiff" },
+};
+
+#pragma mark - SupportedImageMIMETypes
+
+static const int32_t kSupportedImageMIMETypesSeeds[10] = {
+    0, -9, -8, -7, -5, 1, -4, -3, -2, -1,
+};
+
+static const OWSMIMETypeTableEntry kSupportedImageMIMETypesEntries[10] = {
+    { "image/jpeg", @"jpeg" },
+    { "image/heic", @"heic" },
+    { "image/x-windows-bmp", @"bmp" },
+    { "image/bmp", @"bmp" },
+    { "image/png", @"png" },
+    { "image/pjpeg", @"jpeg" },
+    { "image/x-tiff", @"tif" },
+    { "image/tiff", @"tif" },
+    { "image/webp", @"webp" },
+    { "image/heif", @"heif" },
+};
+
+#pragma mark - SupportedBinaryDataMIMETypes
+
+static const int32_t kSupportedBinaryDataMIMETypesSeeds[1] = {
+    -1,
+};
+
+static const OWSMIMETypeTableEntry kSupportedBinaryDataMIMETypesEntries[1] = {
+    { "application/octet-stream", @"dat" },
+};
+
+#pragma mark - SupportedVideoExtensions
+
+static const int32_t kSupportedVideoExtensionsSeeds[10] = {
+    0, -10, 0, -9, -5, 0, 3, -1, 0, 1,
+};
+
+static const OWSMIMETypeTableEntry kSupportedVideoExtensionsEntries[10] = {
+    { "3gp2", @"video/3gpp2" },
+    { "mov", @"video/quicktime" },
+    { "mp4", @"video/mp4" },
+    { "3gpp2", @"video/3gpp2" },
+    { "m4v", @"video/x-m4v" },
+    { "3gpp", @"video/3gpp" },
+    { "mpeg", @"video/mpeg" },
+    { "3gp", @"video/3gpp" },
+    { "mqv", @"video/quicktime" },
+    { "mpg", @"video/mpeg" },
+};
+
+#pragma mark - SupportedAudioExtensions
+
+static const int32_t kSupportedAudioExtensionsSeeds[16] = {
+    -16, -13, 0, -12, -10, -8, 0, 1, -7, 2,
+    1, -6, -4, 0, 0, -3,
+};
+
+static const OWSMIMETypeTableEntry kSupportedAudioExtensionsEntries[16] = {
+    { "aiff", @"audio/aiff" },
+    { "wav", @"audio/wav" },
+    { "cdda", @"audio/aiff" },
+    { "aifc", @"audio/aiff" },
+    { "swa", @"audio/mp3" },
+    { "3gp", @"audio/3gpp" },
+    { "m4p", @"audio/x-m4p" },
+    { "aif", @"audio/aiff" },
+    { "m4b", @"audio/x-m4b" },
+    { "bwf", @"audio/wav" },
+    { "3g2", @"audio/3gpp2" },
+    { "3gp2", @"audio/3gpp2" },
+    { "3gpp", @"audio/3gpp" },
+    { "mp3", @"audio/mp3" },
+    { "m4a", @"audio/x-m4a" },
+    { "mp4", @"audio/mp4" },
+};
+
+#pragma mark - SupportedImageExtensions
+
+static const int32_t kSupportedImageExtensionsSeeds[12] = {
+    -12, -11, 1, -10, -9, -8, -7, -6, -4, 0,
+    -3, -2,
+};
+
+static const OWSMIMETypeTableEntry kSupportedImageExtensionsEntries[12] = {
+    { "jpe", @"image/jpeg" },
+    { "heif", @"image/heif" },
+    { "jfif", @"image/jpeg" },
+    { "tif", @"image/tiff" },
+    { "tiff", @"image/tiff" },
+    { "x-png", @"image/png" },
+    { "heic", @"image/heic" },
+    { "webp", @"image/webp" },
+    { "png", @"image/png" },
+    { "jfif-tbnl", @"image/jpeg" },
+    { "jpeg", @"image/jpeg" },
+    { "jpg", @"image/jpeg" },
+};
+
+#pragma mark - GenericMIMETypes
+
+static const int32_t kGenericMIMETypesSeeds[1060] = {
+    1, -1059, 0, 2, 1, 1, 2, -1049, -1047, 0,
+    1, -1044, -1043, 0, 0, -1039, -1031, 0, 0, -1030,
+    1, -1026, 0, 1, -1022, -1018, 0, 0, 1, 0,
+    0, 0, -1017, 0, 0, 0, 2, 0, 1, 0,
+    1, 0, -1015, 0, -1012, -1010, 0, 0, -1009, -1008,
+    4, 0, 0, -1005, 0, -1002, 0, 2, 0, 0,
+    3, -999, 1, 0, -998, -993, 0, -991, -990, 2,
+    -986, 0, -983, -982, -981, 0, -980, 1, -978, 1,
+    0, 0, -976, 0, -972, -971, 1, -969, -968, 0,
+    1, -967, 0, 1, 0, 0, 4, -964, 0, 0,
+    -960, -952, 1, 2, 0, 0, 1, -950, 0, -948,
+    -947, 0, -941, 16, 0, -937, 1, -929, -922, -919,
+    -916, -914, -905, 2, 0, -904, 1, -903, -899, 0,
+    1, 0, 1, 0, -898, -894, 0, -892, 1, -891,
+    -889, 1, 2, 0, 0, -888, 0, 0, 0, 1,
+    -885, 5, 1, 0, -881, -878, -870, -868, 1, -866,
+    0, -865, 0, -863, 0, 1, -855, -854, 0, 0,
+    0, 1, 1, 0, 0, -852, 0, 10, 0, 0,
+    -850, 0, -849, -848, -843, 1, 0, 2, 0, -841,
+    -839, -838, 0, 0, 1, 1, 0, 0, -835, -833,
+    1, 2, 1, 2, -832, -831, 1, 2, 0, 0,
+    0, -829, 3, 3, 3, 0, -822, 2, 0, 0,
+    -821, 0, 0, 1, -818, -814, -813, -811, -809, 1,
+    0, 0, 0, 2, -804, -803, 3, 0, 3, 0,
+    -801, 1, -796, 0, 0, 0, -793, -792, 2, -781,
+    -780, 0, 2, 0, 0, -778, -777, 0, 0, -776,
+    -774, 1, -770, 4, 0, 0, 0, 0, -769, 0,
+    -764, -763, 0, 0, -759, 0, 0, 0, 1, 0,
+    0, 1, -758, -757, 3, 1, -756, -754, 0, 0,
+    1, 0, 0, 0, -750, 0, -749, -745, 2, 0,
+    0, 0, -741, -740, -735, 0, 0, -730, -728, 0,
+    1, 2, 4, -727, 0, -725, -723, 1, -719, 2,
+    0, 0, -718, 1, -715, 0, 1, -714, -713, -711,
+    1, -709, 0, -708, 0, 0, 7, 2, 1, 6,
+    0, 1, 0, 1, 5, -707, -701, 0, 0, -695,
+    -689, 1, 0, 3, 0, -679, -677, 0, -673, 1,
+    2, 0, 0, -667, -666, 1, 0, 0, 0, 1,
+    3, -665, -664, 0, 0, 2, -663, 0, -661, 1,
+    -659, -658, 1, -657, 0, -656, -655, 1, 0, 0,
+    0, 0, -650, 0, -648, -646, 1, 0, -644, 1,
+    5, 0, 0, 0, -642, -636, -628, 1, 0, -627,
+    -624, 1, 0, 0, 0, 0, 1, 1, -622, 1,
+    0, -620, 2, 1, -616, -615, 0, -611, 0, 3,
+    -610, -609, 0, -607, -603, -601, -599, -597, -593, 0,
+    8, -585, 0, 0, -584, 0, 0, -578, 0, -577,
+    -574, -573, -570, 0, 1, 2, 0, -569, 1, -567,
+    -566, -562, -561, -560, 0, 0, 2, -559, -558, -550,
+    -548, 1, 0, -547, 2, 1, -545, -543, 3, 0,
+    0, -538, -536, 3, 2, -534, -532, -530, 0, -526,
+    0, -521, -519, 1, -517, -516, 2, 5, 0, -511,
+    5, 4, -508, -500, -499, 1, 3, 0, -498, 2,
+    -490, 1, 0, 0, 8, 2, 3, 0, -489, -487,
+    -483, 12, 0, -482, 4, 0, 1, 3, -479, -478,
+    -476, -475, -474, 1, 6, 0, -470, 2, 2, -465,
+    0, 12, 0, 0, 0, -464, -463, -458, 0, 2,
+    2, 4, 0, 0, 0, 0, 0, 0, -456, -455,
+    -453, 0, -452, -449, -444, -442, -438, 1, 1, -437,
+    0, 0, -434, 1, 2, -432, 0, -431, -424, -420,
+    2, 0, 9, 0, -419, -417, -413, -411, -408, 0,
+    0, 2, 0, 0, -407, 0, -402, 0, 2, 0,
+    3, 0, 0, -398, -393, -390, -385, 0, -383, -381,
+    0, 0, 0, -380, 0, 0, 0, -377, 0, -376,
+    -371, 1, 1, -370, 2, 1, -367, 0, -366, 0,
+    5, 1, 0, 3, 2, 9, -365, 0, 0, -363,
+    1, 6, 2, 1, -361, -359, -347, 3, 0, 0,
+    0, 0, -345, 0, 2, 0, 4, 0, -344, 0,
+    -343, 0, 0, 0, 0, 0, -342, -338, 0, -335,
+    0, -334, 1, 2, -332, 0, -325, 2, 0, 3,
+    1, 1, 1, 0, -323, -322, -319, 0, 0, 0,
+    -318, 0, 2, -314, 7, -312, 1, 1, -311, 0,
+    -310, 1, -309, 0, -307, 2, 0, -304, 0, 0,
+    -303, -302, 0, -301, 3, -298, 4, 0, -297, 0,
+    0, -296, 0, 0, 3, 3, 0, 0, -294, 0,
+    -293, 0, 1, 0, -292, 0, 0, 0, 0, 3,
+    7, -290, -285, 0, -284, 0, -283, 0, 0, 0,
+    0, 0, -278, 0, -273, -268, 0, -266, -263, 0,
+    -261, -260, 0, 0, 0, -252, -251, 1, 0, 0,
+    0, 0, 1, 0, -243, -236, 1, 2, 7, -233,
+    -232, 0, 9, 0, -231, -229, 0, 3, 0, 1,
+    0, 0, 1, 1, -228, 4, -227, 1, 6, 0,
+    0, -225, 0, 1, 13, -223, 11, 0, -219, -216,
+    -213, 3, 0, -211, -210, 0, 5, 0, 0, 1,
+    0, 0, 0, -206, 9, 0, -205, -203, 0, -201,
+    0, 3, 0, 0, 1, 3, -195, 0, 0, 0,
+    0, 5, 0, 0, 0, -194, -190, -189, 0, -187,
+    1, 4, 0, 3, 0, -186, 0, 0, 0, 0,
+    6, 0, -185, 0, -183, 0, 5, -182, 1, -181,
+    -175, 1, 0, 0, 0, 0, 3, 0, -174, 0,
+    -169, -166, 0, -165, -161, 0, 0, 0, 2, 0,
+    4, 1, -158, -154, -148, 0, 0, 3, -147, 5,
+    -142, 0, 0, 2, -141, -140, 2, 3, 13, 1,
+    -138, -134, 0, 4, -130, -127, 3, -126, 0, -125,
+    0, 0, -124, -122, 1, -121, 11, 0, 0, -120,
+    -119, 1, 10, 0, 0, -118, 4, 4, -116, 0,
+    0, -112, 0, -104, -103, -102, 0, 0, 3, 3,
+    0, 0, -98, -91, -88, 15, 0, 3, -86, 1,
+    -84, 11, 4, 0, -83, 0, 0, 0, 0, -82,
+    0, 3, 1, 0, 2, 2, -80, 1, 3, -78,
+    0, -76, -74, 0, -72, 1, 0, 0, 4, 7,
+    3, 1, 0, 0, 0, 0, 19, 0, 0, -71,
+    -66, 0, 1, -64, -63, 0, -61, 0, 0, -60,
+    -51, -50, -41, 3, 0, 12, 4, -39, 0, 3,
+    -35, 0, 0, 10, 13, 0, 7, 0, -32, 1,
+    17, 0, -31, 0, -27, -24, -21, 0, -19, -17,
+    -14, -13, 0, -12, -11, 6, 0, 0, 0, 4,
+    9, 9, -10, -5, 0, 0, -4, -2, -1, 6,
+};
+
+static const OWSMIMETypeTableEntry kGenericMIMETypesEntries[1060] = {
+    { "application/x-cpio", @"cpio" },
+    { "application/java-byte-code", @"class" },
+    { "application/vnd.handheld-entertainment+xml", @"zmm" },
+    { "video/x-smv", @"smv" },
+    { "video/vnd.dvb.file", @"dvb" },
+    { "application/vnd.syncml.dm+wbxml", @"bdm" },
+    { "application/wordperfect6.1", @"w61" },
+    { "application/x-visio", @"vsd" },
+    { "application/vnd.curl.pcurl", @"pcurl" },
+    { "application/ringing-tones", @"rng" },
+    { "video/x-ms-vob", @"vob" },
+    { "image/x-portable-graymap", @"pgm" },
+    { "chemical/x-cml", @"cml" },
+    { "application/pgp-encrypted", @"pgp" },
+    { "chemical/x-xyz", @"xyz" },
+    { "application/x-blorb", @"blb" },
+    { "image/jpeg", @"jpg" },
+    { "text/vnd.in3d.spot", @"spot" },
+    { "application/vnd.intu.qbo", @"qbo" },
+    { "image/vnd.fujixerox.edmics-mmr", @"mmr" },
+    { "image/fif", @"fif" },
+    { "application/vnd.lotus-screencam", @"scm" },
+    { "application/x-troff-me", @"me" },
+    { "video/x-ms-wmv", @"wmv" },
+    { "application/dssc+xml", @"xdssc" },
+    { "audio/x-mpegurl", @"m3u" },
+    { "application/x-troff-msvideo", @"avi" },
+    { "application/vnd.smaf", @"mmf" },
+    { "application/x-ace-compressed", @"ace" },
+    { "application/vnd.shana.informed.package", @"ipk" },
+    { "application/sru+xml", @"sru" },
+    { "application/vnd.pmi.widget", @"wg" },
+    { "application/vnd.ms-lrm", @"lrm" },
+    { "application/x-httpd-imap", @"imap" },
+    { "video/mj2", @"mj2" },
+    { "application/vnd.isac.fcs", @"fcs" },
+    { "image/bmp", @"bmp" },
+    { "application/x-navimap", @"map" },
+    { "image/x-jg", @"art" },
+    { "application/vnd.framemaker", @"fm" },
+    { "application/pkcs10", @"p10" },
+    { "application/reginfo+xml", @"rif" },
+    { "application/binhex4", @"hqx" },
+    { "application/vnd.fuzzysheet", @"fzs" },
+    { "application/internet-property-stream", @"acx" },
+    { "application/vnd.unity", @"unityweb" },
+    { "application/vnd.geoplan", @"g2w" },
+    { "application/x-sv4cpio", @"sv4cpio" },
+    { "application/vnd.3gpp.pic-bw-large", @"plb" },
+    { "image/webp", @"webp" },
+    { "application/mbox", @"mbox" },
+    { "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet", @"xlsx" },
+    { "video/x-ms-wmx", @"wmx" },
+    { "text/pascal", @"pas" },
+    { "audio/x-mpeg-3", @"mp3" },
+    { "image/g3fax", @"g3" },
+    { "application/x-ima", @"ima" },
+    { "image/vnd.fastbidsheet", @"fbs" },
+    { "application/oda", @"oda" },
+    { "image/vnd.ms-modi", @"mdi" },
+    { "text/css", @"css" },
+    { "application/ssml+xml", @"ssml" },
+    { "application/x-dtbncx+xml", @"ncx" },
+    { "text/csv", @"csv" },
+    { "application/x-cpt", @"cpt" },
+    { "application/vnd.grafeq", @"gqf" },
+    { "application/vnd.groove-tool-template", @"tpl" },
+    { "application/vnd.nitf", @"ntf" },
+    { "application/x-winhelp", @"hlp" },
+    { "application/x-sprite", @"spr" },
+    { "application/x-compress", @"z" },
+    { "application/vnd.pg.osasli", @"ei6" },
+    { "application/vnd.ms-word.document.macroenabled.12", @"docm" },
+    { "video/x-mng", @"mng" },
+    { "application/vnd.stardivision.impress", @"sdd" },
+    { "application/vnd.recordare.musicxml+xml", @"musicxml" },
+    { "text/ecmascript", @"js" },
+    { "application/pls+xml", @"pls" },
+    { "application/vnd.astraea-software.iota", @"iota" },
+    { "application/vnd.apple.installer+xml", @"mpkg" },
+    { "application/vnd.hydrostatix.sof-data", @"sfd-hdstx" },
+    { "application/andrew-inset", @"ez" },
+    { "application/vnd.ms-pki.certstore", @"sst" },
+    { "application/lzx", @"lzx" },
+    { "application/vnd.sema", @"sema" },
+    { "application/vnd.openxmlformats-officedocument.presentationml.template", @"potx" },
+    { "application/x-dgc-compressed", @"dgc" },
+    { "application/rtf", @"rtf" },
+    { "application/x-javascript", @"js" },
+    { "audio/mod", @"mod" },
+    { "model/vnd.gtw", @"gtw" },
+    { "application/vnd.semf", @"semf" },
+    { "application/vnd.oasis.opendocument.text-web", @"oth" },
+    { "application/vnd.wap.wmlc", @"wmlc" },
+    { "text/vnd.curl.scurl", @"scurl" },
+    { "application/vnd.clonk.c4group", @"c4g" },
+    { "application/x-7z-compressed", @"7z" },
+    { "application/ynd.ms-pkipko", @"pko" },
+    { "application/x-mspowerpoint", @"ppt" },
+    { "application/mcad", @"mcd" },
+    { "application/vnd.oasis.opendocument.presentation", @"odp" },
+    { "application/vnd.novadigm.edm", @"edm" },
+    { "windows/metafile", @"wmf" },
+    { "application/vnd.ezpix-package", @"ez3" },
+    { "audio/x-caf", @"caf" },
+    { "application/vnd.kde.kformula", @"kfo" },
+    { "application/x-tar", @"tar" },
+    { "video/vnd.vivo", @"viv" },
+    { "model/x3d+binary", @"x3db" },
+    { "application/inkml+xml", @"ink" },
+    { "video/x-matroska", @"mkv" },
+    { "application/x-msmoney", @"mny" },
+    { "video/x-f4v", @"f4v" },
+    { "text/yaml", @"yaml" },
+    { "application/vnd.mobius.daf", @"daf" },
+    { "application/vnd.ms-excel.template.macroenabled.12", @"xltm" },
+    { "application/x-bcpio", @"bcpio" },
+    { "audio/x-wav", @"wav" },
+    { "application/ipfix", @"ipfix" },
+    { "audio/vnd.nuera.ecelp9600", @"ecelp9600" },
+    { "application/vnd.adobe.fxp", @"fxp" },
+    { "application/zip", @"zip" },
+    { "application/vnd.adobe.formscentral.fcdt", @"fcdt" },
+    { "application/vnd.sun.xml.impress", @"sxi" },
+    { "video/avi", @"avi" },
+    { "application/x-omcregerator", @"omcr" },
+    { "application/vnd.kinar", @"kne" },
+    { "audio/x-au", @"au" },
+    { "application/lost+xml", @"lostxml" },
+    { "application/vnd.ms-pkistl", @"stl" },
+    { "image/ktx", @"ktx" },
+    { "image/x-freehand", @"fh" },
+    { "application/x-msschedule", @"scd" },
+    { "text/x-script.guile", @"scm" },
+    { "video/msvideo", @"avi" },
+    { "audio/vnd.dts", @"dts" },
+    { "application/mime", @"aps" },
+    { "application/x-silverlight-app", @"xap" },
+    { "application/vnd.jisp", @"jisp" },
+    { "image/x-xbitmap", @"xbm" },
+    { "application/vnd.pawaafile", @"paw" },
+    { "application/x-x509-user-cert", @"crt" },
+    { "application/cdmi-queue", @"cdmiq" },
+    { "application/x-ip2", @"ip" },
+    { "application/vnd.ms-powerpoint.addin.macroenabled.12", @"ppam" },
+    { "application/vnd.anser-web-certificate-issue-initiation", @"cii" },
+    { "application/plain", @"text" },
+    { "audio/x-gsm", @"gsm" },
+    { "application/x-nokia-9000-communicator-add-on-software", @"aos" },
+    { "text/asp", @"asp" },
+    { "application/scvp-cv-response", @"scs" },
+    { "video/x-atomic3d-feature", @"fmf" },
+    { "text/x-uuencode", @"uu" },
+    { "application/x-internett-signup", @"ins" },
+    { "application/vnd.medcalcdata", @"mc1" },
+    { "application/vnd.rim.cod", @"cod" },
+    { "application/vnd.groove-account", @"gac" },
+    { "application/x-midi", @"midi" },
+    { "application/vnd.openxmlformats-officedocument.wordprocessingml.template", @"dotx" },
+    { "text/scriplet", @"wsc" },
+    { "video/vnd.ms-playready.media.pyv", @"pyv" },
+    { "application/prs.cww", @"cww" },
+    { "application/vnd.cosmocaller", @"cmc" },
+    { "application/vnd.realvnc.bed", @"bed" },
+    { "audio/x-psid", @"sid" },
+    { "application/vnd.sun.xml.draw", @"sxd" },
+    { "application/vnd.cinderella", @"cdy" },
+    { "application/mspowerpoint", @"ppt" },
+    { "image/cgm", @"cgm" },
+    { "application/metalink+xml", @"metalink" },
+    { "application/vnd.route66.link66+xml", @"link66" },
+    { "audio/mp4", @"m4a" },
+    { "application/vnd.openxmlformats-officedocument.spreadsheetml.template", @"xltx" },
+    { "application/x-bittorrent", @"torrent" },
+    { "video/jpm", @"jpm" },
+    { "application/xv+xml", @"mxml" },
+    { "application/vnd.epson.esf", @"esf" },
+    { "application/vnd.fujixerox.docuworks", @"xdw" },
+    { "application/x-gca-compressed", @"gca" },
+    { "image/x-pcx", @"pcx" },
+    { "application/vnd.ms-cab-compressed", @"cab" },
+    { "application/mbedlet", @"mbd" },
+    { "application/x-binary", @"bin" },
+    { "application/rpki-roa", @"roa" },
+    { "image/xpm", @"xpm" },
+    { "application/cdmi-container", @"cdmic" },
+    { "application/vnd.sun.xml.math", @"sxm" },
+    { "model/iges", @"iges" },
+    { "application/x-esrehber", @"es" },
+    { "application/x-sv4crc", @"sv4crc" },
+    { "video/x-ms-asf-plugin", @"asx" },
+    { "image/vnd.dece.graphic", @"uvi" },
+    { "image/x-png", @"png" },
+    { "text/vnd.dvb.subtitle", @"sub" },
+    { "application/vnd.sun.xml.calc", @"sxc" },
+    { "audio/x-aiff", @"aiff" },
+    { "application/x-123", @"wk1" },
+    { "application/x-troff-man", @"man" },
+    { "application/set-payment-initiation", @"setpay" },
+    { "application/x-navidoc", @"nvd" },
+    { "text/x-script.ksh", @"ksh" },
+    { "application/vnd.nokia.n-gage.data", @"ngdat" },
+    { "application/vnd.ms-word.template.macroenabled.12", @"dotm" },
+    { "application/vnd.recordare.musicxml", @"mxl" },
+    { "application/vnd.kde.kivio", @"flw" },
+    { "image/x-xbm", @"xbm" },
+    { "application/x-ms-wmz", @"wmz" },
+    { "application/vnd.yamaha.openscoreformat.osfpvg+xml", @"osfpvg" },
+    { "audio/vnd.lucent.voice", @"lvp" },
+    { "application/vnd.ms-pki.seccat", @"cat" },
+    { "text/vnd.abc", @"abc" },
+    { "application/x-mspublisher", @"pub" },
+    { "application/vnd.lotus-1-2-3", @"123" },
+    { "application/x-lzx", @"lzx" },
+    { "application/vnd.proteus.magazine", @"mgz" },
+    { "application/x-pkcs10", @"p10" },
+    { "application/vnd.frogans.ltf", @"ltf" },
+    { "application/vnd.ms-artgalry", @"cil" },
+    { "application/vnd.ms-excel.addin.macroenabled.12", @"xlam" },
+    { "application/vnd.geospace", @"g3w" },
+    { "application/vnd.mediastation.cdkey", @"cdkey" },
+    { "video/jpeg", @"jpgv" },
+    { "text/x-script.lisp", @"lsp" },
+    { "application/vnd.macports.portpkg", @"portpkg" },
+    { "application/ecmascript", @"js" },
+    { "application/vnd.openofficeorg.extension", @"oxt" },
+    { "application/vnd.ms-wpl", @"wpl" },
+    { "application/onenote", @"onetoc" },
+    { "audio/x-ms-wma", @"wma" },
+    { "application/vnd.ms-powerpoint.slide.macroenabled.12", @"sldm" },
+    { "application/vnd.wqd", @"wqd" },
+    { "application/sbml+xml", @"sbml" },
+    { "application/wordperfect6.0", @"w60" },
+    { "video/x-ms-asf", @"asf" },
+    { "video/x-isvideo", @"isu" },
+    { "paleovu/x-pv", @"pvu" },
+    { "image/jutvision", @"jut" },
+    { "application/netmc", @"mcp" },
+    { "application/vnd.frogans.fnc", @"fnc" },
+    { "application/x-dtbook+xml", @"dtb" },
+    { "application/vnd.dvb.ait", @"ait" },
+    { "application/atom+xml", @"atom" },
+    { "application/vnd.ms-pkiseccat", @"cat" },
+    { "model/x3d+vrml", @"x3dv" },
+    { "application/vnd.lotus-wordpro", @"lwp" },
+    { "application/dssc+der", @"dssc" },
+    { "application/x-omc", @"omc" },
+    { "xgl/movie", @"xmz" },
+    { "application/cu-seeme", @"cu" },
+    { "application/vnd.sun.xml.draw.template", @"std" },
+    { "application/vnd.ms-outlook", @"msg" },
+    { "font/woff2", @"woff2" },
+    { "model/vnd.vtu", @"vtu" },
+    { "application/x-xfig", @"fig" },
+    { "application/vnd.oasis.opendocument.formula", @"odf" },
+    { "application/mets+xml", @"mets" },
+    { "application/vnd.fujitsu.oasysprs", @"bh2" },
+    { "text/javascript", @"js" },
+    { "image/xbm", @"xbm" },
+    { "application/vnd.mobius.mbk", @"mbk" },
+    { "application/x-bzip", @"bz" },
+    { "audio/ogg", @"oga" },
+    { "audio/vnd.ms-playready.media.pya", @"pya" },
+    { "application/x-pkcs12", @"p12" },
+    { "application/x-msmediaview", @"mvb" },
+    { "application/vnd.igloader", @"igl" },
+    { "application/voicexml+xml", @"vxml" },
+    { "application/vnd.crick.clicker.template", @"clkt" },
+    { "text/html", @"html" },
+    { "application/vnd.hp-hpid", @"hpid" },
+    { "application/vnd.hp-hps", @"hps" },
+    { "application/rss+xml", @"rss" },
+    { "application/x-navi-animation", @"ani" },
+    { "application/x-xliff+xml", @"xlf" },
+    { "application/vnd.tao.intent-module-archive", @"tao" },
+    { "application/x-ms-application", @"application" },
+    { "application/vnd.umajin", @"umj" },
+    { "application/vnd.ipunplugged.rcprofile", @"rcprofile" },
+    { "application/vnd.anser-web-funds-transfer-initiation", @"fti" },
+    { "application/wordperfect", @"wp" },
+    { "application/vnd.fujixerox.ddd", @"ddd" },
+    { "application/applixware", @"aw" },
+    { "application/solids", @"sol" },
+    { "video/mp4", @"mp4" },
+    { "application/x-zmachine", @"z1" },
+    { "audio/vnd.dra", @"dra" },
+    { "application/vnd.spotfire.sfs", @"sfs" },
+    { "image/vnd.rn-realpix", @"rp" },
+    { "application/vnd.oasis.opendocument.image", @"odi" },
+    { "application/xop+xml", @"xop" },
+    { "application/x-iphone", @"iii" },
+    { "application/x-bytecode.python", @"pyc" },
+    { "application/vnd.sus-calendar", @"sus" },
+    { "text/x-vcalendar", @"vcs" },
+    { "application/mediaservercontrol+xml", @"mscml" },
+    { "application/x-livescreen", @"ivy" },
+    { "text/vnd.fmi.flexstor", @"flx" },
+    { "application/x-macbinary", @"bin" },
+    { "application/vnd.intercon.formnet", @"xpw" },
+    { "application/vnd.sun.xml.writer.template", @"stw" },
+    { "image/x-tiff", @"tiff" },
+    { "application/x-font-ghostscript", @"gsf" },
+    { "video/x-sgi-movie", @"movie" },
+    { "application/x-portable-anymap", @"pnm" },
+    { "application/x-texinfo", @"texinfo" },
+    { "application/x-mscardfile", @"crd" },
+    { "application/json", @"json" },
+    { "application/vnd.llamagraphics.life-balance.desktop", @"lbd" },
+    { "text/vnd.fly", @"fly" },
+    { "application/vnd.noblenet-sealer", @"nns" },
+    { "application/vnd.yellowriver-custom-menu", @"cmp" },
+    { "application/vnd.nokia.ringing-tone", @"rng" },
+    { "application/vnd.simtech-mindmapper", @"twd" },
+    { "application/vnd.yamaha.smaf-audio", @"saf" },
+    { "application/book", @"book" },
+    { "audio/x-flac", @"flac" },
+    { "application/vnd.mobius.dis", @"dis" },
+    { "application/vnd.android.package-archive", @"apk" },
+    { "video/vnd.dece.pd", @"uvp" },
+    { "application/vnd.adobe.xfdf", @"xfdf" },
+    { "text/x-m", @"m" },
+    { "audio/silk", @"sil" },
+    { "application/vnd.yamaha.hv-dic", @"hvd" },
+    { "application/vnd.oasis.opendocument.graphics", @"odg" },
+    { "application/xenc+xml", @"xenc" },
+    { "video/quicktime", @"mov" },
+    { "application/vnd.ms-xpsdocument", @"xps" },
+    { "application/postscript", @"ps" },
+    { "application/x-ustar", @"ustar" },
+    { "application/envoy", @"evy" },
+    { "application/smil+xml", @"smi" },
+    { "application/marcxml+xml", @"mrcx" },
+    { "application/sounder", @"sdr" },
+    { "application/x-nzb", @"nzb" },
+    { "application/x-seelogo", @"sl" },
+    { "image/vnd.fpx", @"fpx" },
+    { "application/dxf", @"dxf" },
+    { "application/vnd.stardivision.draw", @"sda" },
+    { "message/rfc822", @"eml" },
+    { "application/pkcs8", @"p8" },
+    { "application/vnd.smart.teacher", @"teacher" },
+    { "application/mathematica", @"ma" },
+    { "audio/x-pn-realaudio", @"ram" },
+    { "application/vnd.criticaltools.wbs+xml", @"wbs" },
+    { "audio/aiff", @"aiff" },
+    { "application/vnd.previewsystems.box", @"box" },
+    { "multipart/x-zip", @"zip" },
+    { "x-world/x-3dmf", @"3dmf" },
+    { "application/tei+xml", @"tei" },
+    { "video/x-gl", @"gl" },
+    { "application/vnd.mfer", @"mwf" },
+    { "application/vnd.yamaha.hv-script", @"hvs" },
+    { "audio/voc", @"voc" },
+    { "application/x-tex", @"tex" },
+    { "application/vnd.las.las+xml", @"lasxml" },
+    { "application/x-cdlink", @"vcd" },
+    { "application/vnd.sun.xml.impress.template", @"sti" },
+    { "application/java-serialized-object", @"ser" },
+    { "application/x-rtf", @"rtf" },
+    { "image/cis-cod", @"cod" },
+    { "text/x-la-asf", @"lsx" },
+    { "video/ogg", @"ogv" },
+    { "image/apng", @"png" },
+    { "application/vnd.fdsn.mseed", @"mseed" },
+    { "audio/basic", @"au" },
+    { "video/animaflex", @"afl" },
+    { "application/vnd.mobius.mqy", @"mqy" },
+    { "application/vnd.mobius.msl", @"msl" },
+    { "text/sgml", @"sgml" },
+    { "application/mp4", @"mp4" },
+    { "application/sla", @"stl" },
+    { "application/vnd.amazon.ebook", @"azw" },
+    { "application/vnd.mozilla.xul+xml", @"xul" },
+    { "image/x-xpixmap", @"xpm" },
+    { "application/x-lha", @"lha" },
+    { "text/tab-separated-values", @"tsv" },
+    { "application/vnd.lotus-organizer", @"org" },
+    { "application/vnd.oasis.opendocument.spreadsheet", @"ods" },
+    { "application/mac-binhex", @"hqx" },
+    { "application/vnd.trueapp", @"tra" },
+    { "application/vnd.hal+xml", @"hal" },
+    { "application/vnd.pvi.ptid1", @"ptid" },
+    { "audio/vnd.nuera.ecelp4800", @"ecelp4800" },
+    { "application/java-archive", @"jar" },
+    { "chemical/x-csml", @"csml" },
+    { "application/x-debian-package", @"deb" },
+    { "font/woff", @"woff" },
+    { "application/x-conference", @"nsc" },
+    { "image/vasa", @"mcf" },
+    { "application/x-qpro", @"wb1" },
+    { "audio/x-midi", @"midi" },
+    { "text/scriptlet", @"sct" },
+    { "application/vnd.visio2013", @"vsdx" },
+    { "application/vnd.audiograph", @"aep" },
+    { "audio/vnd.qcelp", @"qcp" },
+    { "application/x-chess-pgn", @"pgn" },
+    { "text/uri-list", @"uri" },
+    { "application/x-meme", @"mm" },
+    { "video/x-dv", @"dv" },
+    { "chemical/x-cdx", @"cdx" },
+    { "text/x-script.phyton", @"py" },
+    { "application/vnd.aristanetworks.swi", @"swi" },
+    { "application/fractals", @"fif" },
+    { "application/x-font-linux-psf", @"psf" },
+    { "application/x-subrip", @"srt" },
+    { "application/vnd.accpac.simply.imp", @"imp" },
+    { "application/x-zip-compressed", @"zip" },
+    { "image/heic", @"heic" },
+    { "application/oxps", @"oxps" },
+    { "video/webm", @"webm" },
+    { "application/vnd.nokia.radio-preset", @"rpst" },
+    { "application/vnd.svd", @"svd" },
+    { "application/cdmi-domain", @"cdmid" },
+    { "application/vnd.openxmlformats-officedocument.presentationml.slide", @"sldx" },
+    { "application/x-wintalk", @"wtk" },
+    { "application/streamingmedia", @"ssm" },
+    { "image/heif", @"heif" },
+    { "image/prs.btif", @"btif" },
+    { "video/mpeg", @"mpg" },
+    { "application/vnd.crick.clicker.wordbank", @"clkw" },
+    { "video/x-dl", @"dl" },
+    { "application/x-mac-binhex40", @"hqx" },
+    { "application/x-director", @"dir" },
+    { "application/vnd.oasis.opendocument.text-master", @"odm" },
+    { "application/vnd.groove-help", @"ghf" },
+    { "application/vnd.osgi.subsystem", @"esa" },
+    { "application/vnd.mobius.txf", @"txf" },
+    { "application/x-cmu-raster", @"ras" },
+    { "image/svg+xml", @"svg" },
+    { "application/vnd.fujitsu.oasys", @"oas" },
+    { "audio/x-liveaudio", @"lam" },
+    { "application/x-font-woff", @"woff" },
+    { "application/exi", @"exi" },
+    { "audio/x-adpcm", @"snd" },
+    { "application/x-apple-diskimage", @"dmg" },
+    { "application/vnd.quark.quarkxpress", @"qxd" },
+    { "application/x-troff-ms", @"ms" },
+    { "image/vnd.fst", @"fst" },
+    { "video/vnd.uvvu.mp4", @"uvu" },
+    { "application/vnd.geogebra.file", @"ggb" },
+    { "application/vnd.oasis.opendocument.text-template", @"ott" },
+    { "video/x-scm", @"scm" },
+    { "application/vnd.llamagraphics.life-balance.exchange+xml", @"lbe" },
+    { "application/xcap-diff+xml", @"xdf" },
+    { "text/richtext", @"rtf" },
+    { "multipart/x-ustar", @"ustar" },
+    { "application/vnd.ibm.modcap", @"afp" },
+    { "text/plain-bas", @"par" },
+    { "application/x-shar", @"shar" },
+    { "application/vnd.lotus-freelance", @"pre" },
+    { "application/x-font-snf", @"snf" },
+    { "application/vnd.mfmp", @"mfm" },
+    { "video/x-ms-wvx", @"wvx" },
+    { "application/pkixcmp", @"pki" },
+    { "application/x-glulx", @"ulx" },
+    { "application/vnd.visionary", @"vis" },
+    { "application/x-tcl", @"tcl" },
+    { "video/x-msvideo", @"avi" },
+    { "application/rpki-ghostbusters", @"gbr" },
+    { "application/vnd.micrografx.flo", @"flo" },
+    { "application/widget", @"wgt" },
+    { "application/vnd.kde.karbon", @"karbon" },
+    { "application/vnd.3m.post-it-notes", @"pwn" },
+    { "video/x-mpeg", @"mpg" },
+    { "application/x-pointplus", @"css" },
+    { "image/x-xwindowdump", @"xwd" },
+    { "application/vnd.geonext", @"gxt" },
+    { "application/x-lotusscreencam", @"scm" },
+    { "music/x-karaoke", @"kar" },
+    { "audio/x-aac", @"aac" },
+    { "application/x-futuresplash", @"spl" },
+    { "application/vnd.ibm.secure-container", @"sc" },
+    { "text/x-script.tcl", @"tcl" },
+    { "application/xproc+xml", @"xpl" },
+    { "application/vnd.genomatix.tuxedo", @"txd" },
+    { "application/x-cbr", @"cbr" },
+    { "application/x-dvi", @"dvi" },
+    { "video/3gpp2", @"3g2" },
+    { "application/winhlp", @"hlp" },
+    { "application/vnd.fluxtime.clip", @"ftc" },
+    { "application/x-csh", @"csh" },
+    { "xgl/drawing", @"xgz" },
+    { "image/x-pict", @"pic" },
+    { "application/x-install-instructions", @"install" },
+    { "application/rpki-manifest", @"mft" },
+    { "image/vnd.ms-photo", @"wdp" },
+    { "application/vnd.musician", @"mus" },
+    { "application/x-iso9660-image", @"iso" },
+    { "application/x-frame", @"mif" },
+    { "text/x-java-source", @"java" },
+    { "video/vnd.dece.mobile", @"uvm" },
+    { "application/x-sit", @"sit" },
+    { "application/scvp-vp-request", @"spq" },
+    { "text/x-nfo", @"nfo" },
+    { "application/vnd.trid.tpt", @"tpt" },
+    { "text/mcf", @"mcf" },
+    { "application/vnd.ms-powerpoint.presentation.macroenabled.12", @"pptm" },
+    { "audio/mid", @"rmi" },
+    { "text/iuls", @"uls" },
+    { "application/vnd.syncml.dm+xml", @"xdm" },
+    { "model/vrml", @"vrml" },
+    { "application/x-vrml", @"vrml" },
+    { "application/timestamped-data", @"tsd" },
+    { "text/vnd.curl", @"curl" },
+    { "application/x-pcl", @"pcl" },
+    { "application/vnd.novadigm.ext", @"ext" },
+    { "application/vnd.openxmlformats-officedocument.wordprocessingml.document", @"docx" },
+    { "application/vnd.pg.format", @"str" },
+    { "video/vosaic", @"vos" },
+    { "video/x-ms-wm", @"wm" },
+    { "application/x-mobipocket-ebook", @"prc" },
+    { "application/x-font-otf", @"otf" },
+    { "model/vnd.mts", @"mts" },
+    { "application/drafting", @"drw" },
+    { "application/x-mswrite", @"wri" },
+    { "application/vnd.rig.cryptonote", @"cryptonote" },
+    { "application/x-sdp", @"sdp" },
+    { "text/h323", @"323" },
+    { "video/x-qtc", @"qtc" },
+    { "application/x-pkcs7-mime", @"p7m" },
+    { "text/vcard", @"vcard" },
+    { "application/vnd.micrografx.igx", @"igx" },
+    { "audio/s3m", @"s3m" },
+    { "video/x-la-asf", @"lsf" },
+    { "application/octet-stream", @"bin" },
+    { "application/vnd.lotus-notes", @"nsf" },
+    { "text/x-pascal", @"p" },
+    { "text/x-setext", @"etx" },
+    { "text/x-script.zsh", @"zsh" },
+    { "application/vnd.immervision-ivu", @"ivu" },
+    { "video/x-m4v", @"m4v" },
+    { "application/x-font-type1", @"pfa" },
+    { "application/x-pkcs7-certreqresp", @"p7r" },
+    { "application/metalink4+xml", @"meta4" },
+    { "application/vnd.hp-hpgl", @"hpgl" },
+    { "application/vnd.immervision-ivp", @"ivp" },
+    { "application/vnd.mobius.plc", @"plc" },
+    { "application/xspf+xml", @"xspf" },
+    { "application/vnd.seemail", @"see" },
+    { "application/vnd.kde.kword", @"kwd" },
+    { "model/vnd.gdl", @"gdl" },
+    { "application/freeloader", @"frl" },
+    { "application/x-mif", @"mif" },
+    { "image/vnd.dvb.subtitle", @"sub" },
+    { "application/resource-lists-diff+xml", @"rld" },
+    { "application/x-mplayer2", @"asx" },
+    { "text/vnd.in3d.3dml", @"3dml" },
+    { "application/vnd.kde.kontour", @"kon" },
+    { "application/xaml+xml", @"xaml" },
+    { "application/acad", @"dwg" },
+    { "application/scvp-vp-response", @"spp" },
+    { "application/vnd.osgeo.mapguide.package", @"mgp" },
+    { "application/pkcs-crl", @"crl" },
+    { "application/vnd.oasis.opendocument.chart-template", @"otc" },
+    { "text/x-sfv", @"sfv" },
+    { "application/vnd.mophun.certificate", @"mpc" },
+    { "application/x-aim", @"aim" },
+    { "text/vnd.sun.j2me.app-descriptor", @"jad" },
+    { "video/h264", @"h264" },
+    { "application/vnd.groove-tool-message", @"gtm" },
+    { "video/h261", @"h261" },
+    { "text/webviewhtml", @"htt" },
+    { "text/x-script.scheme", @"scm" },
+    { "application/vnd.fujitsu.oasys3", @"oa3" },
+    { "application/i-deas", @"unv" },
+    { "video/h263", @"h263" },
+    { "application/x-lzh-compressed", @"lzh" },
+    { "video/x-amt-showrun", @"xsr" },
+    { "application/x-chat", @"chat" },
+    { "application/vnd.kodak-descriptor", @"sse" },
+    { "application/vnd.fujitsu.oasysgp", @"fg5" },
+    { "application/vnd.hhe.lesson-player", @"les" },
+    { "application/vnd.dvb.service", @"svc" },
+    { "application/vnd.xara", @"xar" },
+    { "application/x-authorware-map", @"aam" },
+    { "image/gif", @"gif" },
+    { "application/vnd.jcp.javame.midlet-rms", @"rms" },
+    { "application/cdmi-object", @"cdmio" },
+    { "video/vnd.rn-realvideo", @"rv" },
+    { "application/vnd.noblenet-directory", @"nnd" },
+    { "application/xslt+xml", @"xslt" },
+    { "application/vnd.novadigm.edx", @"edx" },
+    { "model/mesh", @"msh" },
+    { "audio/wav", @"wav" },
+    { "application/marc", @"mrc" },
+    { "application/x-abiword", @"abw" },
+    { "application/x-cfs-compressed", @"cfs" },
+    { "audio/x-pn-realaudio-plugin", @"rmp" },
+    { "image/x-portable-anymap", @"pnm" },
+    { "application/vnd.oma.dd2+xml", @"dd2" },
+    { "application/x-compactpro", @"cpt" },
+    { "application/vnd.acucorp", @"atc" },
+    { "application/rls-services+xml", @"rs" },
+    { "application/vnd.chemdraw+xml", @"cdxml" },
+    { "application/vnd.dece.data", @"uvf" },
+    { "application/x-pkcs7-certificates", @"p7b" },
+    { "application/vnd.fsc.weblaunch", @"fsc" },
+    { "application/vnd.ahead.space", @"ahead" },
+    { "application/wspolicy+xml", @"wspolicy" },
+    { "application/vnd.epson.salt", @"slt" },
+    { "application/arj", @"arj" },
+    { "application/vnd.ibm.minipay", @"mpy" },
+    { "application/vnd.crick.clicker.palette", @"clkp" },
+    { "image/vnd.djvu", @"djvu" },
+    { "application/vnd.3gpp.pic-bw-small", @"psb" },
+    { "application/x-java-jnlp-file", @"jnlp" },
+    { "application/x-binhex40", @"hqx" },
+    { "application/vnd.ms-excel.sheet.macroenabled.12", @"xlsm" },
+    { "application/x-msterminal", @"trm" },
+    { "application/vnd.acucobol", @"acu" },
+    { "application/vnd.cloanto.rp9", @"rp9" },
+    { "audio/webm", @"weba" },
+    { "image/vnd.adobe.photoshop", @"psd" },
+    { "audio/x-mid", @"midi" },
+    { "application/vnd.is-xpr", @"xpr" },
+    { "x-music/x-midi", @"midi" },
+    { "application/vnd.rn-realplayer", @"rnx" },
+    { "audio/vnd.dts.hd", @"dtshd" },
+    { "application/vnd.cups-ppd", @"ppd" },
+    { "application/x-gramps-xml", @"gramps" },
+    { "text/x-asm", @"asm" },
+    { "application/vnd.uiq.theme", @"utz" },
+    { "text/vnd.curl.mcurl", @"mcurl" },
+    { "application/vnd.hp-pclxl", @"pclxl" },
+    { "text/x-script.perl", @"pl" },
+    { "application/vnd.kidspiration", @"kia" },
+    { "application/x-tgif", @"obj" },
+    { "application/vnd.neurolanguage.nlu", @"nlu" },
+    { "application/pdf", @"pdf" },
+    { "application/x-shockwave-flash", @"swf" },
+    { "application/x-gnumeric", @"gnumeric" },
+    { "application/vnd.ibm.rights-management", @"irm" },
+    { "video/vnd.fvt", @"fvt" },
+    { "application/vnd.shana.informed.formtemplate", @"itp" },
+    { "application/vnd.gmx", @"gmx" },
+    { "application/pskc+xml", @"pskcxml" },
+    { "text/troff", @"t" },
+    { "application/x-envoy", @"evy" },
+    { "application/x-sea", @"sea" },
+    { "application/x-font-ttf", @"ttf" },
+    { "application/xhtml+xml", @"xhtml" },
+    { "application/vnd.geogebra.tool", @"ggt" },
+    { "application/vnd.eszigno3+xml", @"es3" },
+    { "application/vnd.stepmania.package", @"smzip" },
+    { "application/vnd.dynageo", @"geo" },
+    { "text/plain", @"txt" },
+    { "application/vnd.epson.quickanime", @"qam" },
+    { "application/vnd.airzip.filesecure.azs", @"azs" },
+    { "application/x-elc", @"elc" },
+    { "text/x-vcard", @"vcf" },
+    { "image/vnd.fujixerox.edmics-rlc", @"rlc" },
+    { "application/vnd.insors.igm", @"igm" },
+    { "application/x-lotus", @"wq1" },
+    { "text/vnd.wap.wmlscript", @"wmls" },
+    { "application/vnd.ms-powerpoint", @"ppt" },
+    { "application/vnd.oasis.opendocument.database", @"odb" },
+    { "application/x-hdf", @"hdf" },
+    { "text/vnd.rn-realtext", @"rt" },
+    { "application/x-ms-wmd", @"wmd" },
+    { "application/vnd.cluetrust.cartomobile-config", @"c11amc" },
+    { "application/vnd.kde.kspread", @"ksp" },
+    { "application/vnd.uoml+xml", @"uoml" },
+    { "application/java-vm", @"class" },
+    { "text/vnd.graphviz", @"gv" },
+    { "chemical/x-cif", @"cif" },
+    { "application/vnd.flographit", @"gph" },
+    { "application/x-eva", @"eva" },
+    { "application/cdmi-capability", @"cdmia" },
+    { "application/pgp-signature", @"sig" },
+    { "application/sea", @"sea" },
+    { "application/binhex", @"hqx" },
+    { "application/olescript", @"axs" },
+    { "text/x-script.rexx", @"rexx" },
+    { "application/vnd.triscape.mxs", @"mxs" },
+    { "application/vnd.stardivision.writer", @"sdw" },
+    { "video/dl", @"dl" },
+    { "audio/x-ms-wax", @"wax" },
+    { "application/vnd.lotus-approach", @"apr" },
+    { "application/srgs", @"gram" },
+    { "application/x-xpinstall", @"xpi" },
+    { "application/vnd.noblenet-web", @"nnw" },
+    { "application/x-wais-source", @"src" },
+    { "application/vnd.ms-officetheme", @"thmx" },
+    { "application/vnd.vsf", @"vsf" },
+    { "application/x-tex-tfm", @"tfm" },
+    { "audio/midi", @"midi" },
+    { "audio/vnd.rip", @"rip" },
+    { "text/x-script.csh", @"csh" },
+    { "image/vnd.xiff", @"xif" },
+    { "application/docbook+xml", @"dbk" },
+    { "video/x-fli", @"fli" },
+    { "text/x-sgml", @"sgml" },
+    { "application/hlp", @"hlp" },
+    { "video/avs-video", @"avs" },
+    { "audio/it", @"it" },
+    { "application/x-stuffitx", @"sitx" },
+    { "audio/vnd.dece.audio", @"uva" },
+    { "application/atomsvc+xml", @"atomsvc" },
+    { "application/ogg", @"oga" },
+    { "application/vnd.wolfram.player", @"nbp" },
+    { "application/x-freelance", @"pre" },
+    { "text/java", @"java" },
+    { "application/vnd.stardivision.writer-global", @"sgl" },
+    { "application/commonground", @"dp" },
+    { "application/x-lzh", @"lzh" },
+    { "audio/voxware", @"vox" },
+    { "application/vnd.groove-vcard", @"vcg" },
+    { "application/x-deepv", @"deepv" },
+    { "image/vnd.dxf", @"dxf" },
+    { "application/vnd.tcpdump.pcap", @"pcap" },
+    { "application/vnd.publishare-delta-tree", @"qps" },
+    { "application/vnd.adobe.xdp+xml", @"xdp" },
+    { "video/x-mpeq2a", @"mp2" },
+    { "image/x-icon", @"ico" },
+    { "application/vnd.oasis.opendocument.image-template", @"oti" },
+    { "application/vnd.mophun.application", @"mpn" },
+    { "application/vnd.dece.unspecified", @"uvx" },
+    { "application/msword", @"doc" },
+    { "application/vnd.crick.clicker.keyboard", @"clkk" },
+    { "application/vnd.geometry-explorer", @"gex" },
+    { "video/gl", @"gl" },
+    { "application/vnd.wordperfect", @"wpd" },
+    { "application/vnd.claymore", @"cla" },
+    { "application/pkix-attr-cert", @"ac" },
+    { "application/x-mathcad", @"mcd" },
+    { "application/vnd.airzip.filesecure.azf", @"azf" },
+    { "application/vnd.fujitsu.oasys2", @"oa2" },
+    { "application/vnd.cluetrust.cartomobile-config-pkg", @"c11amz" },
+    { "application/vnd.oasis.opendocument.text", @"odt" },
+    { "application/vnd.muvee.style", @"msty" },
+    { "audio/mpeg3", @"mp3" },
+    { "audio/x-mpeg", @"mp2" },
+    { "application/vnd.fujixerox.docuworks.binder", @"xbd" },
+    { "application/vnd.ctc-posml", @"pml" },
+    { "application/vnd.dece.ttml+xml", @"uvt" },
+    { "application/vnd.olpc-sugar", @"xo" },
+    { "video/x-flv", @"flv" },
+    { "application/vnd.shana.informed.formdata", @"ifm" },
+    { "application/vnd.intergeo", @"i2g" },
+    { "image/x-portable-bitmap", @"pbm" },
+    { "model/vnd.dwf", @"dwf" },
+    { "image/vnd.mozilla.apng", @"png" },
+    { "application/vnd.xfdl", @"xfdl" },
+    { "application/vnd.palm", @"pdb" },
+    { "application/smil", @"smi" },
+    { "application/mp21", @"m21" },
+    { "application/vnd.mcd", @"mcd" },
+    { "image/x-mrsid-image", @"sid" },
+    { "application/x-java-class", @"class" },
+    { "application/clariscad", @"ccad" },
+    { "application/x-vnd.ls-xpix", @"xpix" },
+    { "application/vnd.wt.stf", @"stf" },
+    { "image/x-cmu-raster", @"ras" },
+    { "application/vnd.denovo.fcselayout-link", @"fe_launch" },
+    { "image/x-cmx", @"cmx" },
+    { "application/oebps-package+xml", @"opf" },
+    { "application/vnd.semd", @"semd" },
+    { "application/vnd.yamaha.smaf-phrase", @"spf" },
+    { "application/vnd.adobe.air-application-installer-package+zip", @"air" },
+    { "application/mads+xml", @"mads" },
+    { "application/vnd.kde.kpresenter", @"kpr" },
+    { "application/vnd.dart", @"dart" },
+    { "application/gpx+xml", @"gpx" },
+    { "application/vnd.curl.car", @"car" },
+    { "application/x-omcdatamaker", @"omcd" },
+    { "application/x-xz", @"xz" },
+    { "application/toolbook", @"tbk" },
+    { "application/x-dtbresource+xml", @"res" },
+    { "application/vnd.nokia.configuration-message", @"ncm" },
+    { "application/hyperstudio", @"stk" },
+    { "application/vnd.ms-powerpoint.slideshow.macroenabled.12", @"ppsm" },
+    { "application/mathml+xml", @"mathml" },
+    { "application/vnd.ms-htmlhelp", @"chm" },
+    { "application/vnd.sailingtracker.track", @"st" },
+    { "application/x-font-pcf", @"pcf" },
+    { "application/vnd.enliven", @"nml" },
+    { "image/x-citrix-jpeg", @"jpg" },
+    { "application/vocaltec-media-file", @"vmf" },
+    { "application/font-tdpfr", @"pfr" },
+    { "application/vnd.stardivision.calc", @"sdc" },
+    { "image/pict", @"pict" },
+    { "application/vnd.zzazz.deck+xml", @"zaz" },
+    { "application/set", @"set" },
+    { "model/vnd.collada+xml", @"dae" },
+    { "audio/tsplayer", @"tsp" },
+    { "model/x-pov", @"pov" },
+    { "image/x-dwg", @"dwg" },
+    { "application/vnd.dpgraph", @"dpg" },
+    { "application/vnd.crick.clicker", @"clkx" },
+    { "application/resource-lists+xml", @"rl" },
+    { "text/x-h", @"h" },
+    { "audio/aac", @"aac" },
+    { "application/vnd.spotfire.dxp", @"dxp" },
+    { "application/x-gsp", @"gsp" },
+    { "application/x-gss", @"gss" },
+    { "application/x-bzip2", @"bz2" },
+    { "application/x-msmetafile", @"wmf" },
+    { "application/vnd.groove-identity-message", @"gim" },
+    { "application/scvp-cv-request", @"scq" },
+    { "application/mxf", @"mxf" },
+    { "application/x-research-info-systems", @"ris" },
+    { "application/mswrite", @"wri" },
+    { "text/turtle", @"ttl" },
+    { "application/vnd.ezpix-album", @"ez2" },
+    { "application/x-authorware-seg", @"aas" },
+    { "application/x-bsh", @"sh" },
+    { "application/x-inventor", @"iv" },
+    { "application/patch-ops-error+xml", @"xer" },
+    { "application/vnd.pocketlearn", @"plf" },
+    { "text/x-opml", @"opml" },
+    { "text/x-script.tcsh", @"tcsh" },
+    { "application/vnd.wap.wbxml", @"wbxml" },
+    { "application/vnd.ms-pki.stl", @"stl" },
+    { "audio/x-voc", @"voc" },
+    { "application/vnd.ms-powerpoint.template.macroenabled.12", @"potm" },
+    { "application/vnd.dolby.mlp", @"mlp" },
+    { "video/vnd.dece.hd", @"uvh" },
+    { "application/vnd.apple.mpegurl", @"m3u8" },
+    { "application/x-rar-compressed", @"rar" },
+    { "application/vnd.yamaha.hv-voice", @"hvp" },
+    { "application/macbinary", @"bin" },
+    { "application/emma+xml", @"emma" },
+    { "application/xml", @"xml" },
+    { "application/java", @"class" },
+    { "application/x-lisp", @"lsp" },
+    { "x-world/x-vrml", @"vrml" },
+    { "text/x-uil", @"uil" },
+    { "application/vnd.hp-jlyt", @"jlt" },
+    { "application/vnd.ms-pki.pko", @"pko" },
+    { "application/x-gtar", @"gtar" },
+    { "image/pjpeg", @"jpg" },
+    { "application/x-cocoa", @"cco" },
+    { "image/x-citrix-png", @"png" },
+    { "application/set-registration-initiation", @"setreg" },
+    { "application/vnd.oasis.opendocument.chart", @"odc" },
+    { "application/vnd.zul", @"zir" },
+    { "application/vnd.vcx", @"vcx" },
+    { "application/javascript", @"js" },
+    { "audio/vnd.digital-winds", @"eol" },
+    { "text/x-component", @"htc" },
+    { "application/vnd.mynfc", @"taglet" },
+    { "application/x-gzip", @"gz" },
+    { "image/x-tga", @"tga" },
+    { "application/vnd.irepository.package+xml", @"irp" },
+    { "application/vnd.ms-excel.sheet.binary.macroenabled.12", @"xlsb" },
+    { "text/calendar", @"ics" },
+    { "audio/x-twinvq", @"vqf" },
+    { "text/x-c", @"c" },
+    { "application/vnd.dece.zip", @"uvz" },
+    { "application/step", @"step" },
+    { "video/vdo", @"vdo" },
+    { "application/inf", @"inf" },
+    { "application/mac-binary", @"bin" },
+    { "application/x-freearc", @"arc" },
+    { "application/sparql-query", @"rq" },
+    { "application/groupwise", @"vew" },
+    { "application/vnd.ms-works", @"wps" },
+    { "application/x-x509-ca-cert", @"crt" },
+    { "application/x-mie", @"mie" },
+    { "application/vnd.rn-realmedia-vbr", @"rmvb" },
+    { "application/sparql-results+xml", @"srx" },
+    { "image/x-3ds", @"3ds" },
+    { "application/vnd.epson.ssf", @"ssf" },
+    { "application/x-ms-xbap", @"xbap" },
+    { "image/x-rgb", @"rgb" },
+    { "application/pics-rules", @"prf" },
+    { "audio/x-mpequrl", @"m3u" },
+    { "application/vda", @"vda" },
+    { "application/iges", @"iges" },
+    { "application/x-msexcel", @"xls" },
+    { "application/vnd.yamaha.openscoreformat", @"osf" },
+    { "application/vnd.openxmlformats-officedocument.presentationml.slideshow", @"ppsx" },
+    { "application/yang", @"yang" },
+    { "image/vnd.dwg", @"dwg" },
+    { "image/sgi", @"sgi" },
+    { "application/powerpoint", @"ppt" },
+    { "application/vnd.accpac.simply.aso", @"aso" },
+    { "application/x-msbinder", @"obd" },
+    { "application/vnd.shana.informed.interchange", @"iif" },
+    { "application/x-bytecode.elisp", @"elc" },
+    { "application/vnd.3gpp2.tcap", @"tcap" },
+    { "application/yin+xml", @"yin" },
+    { "text/x-script.elisp", @"el" },
+    { "audio/vnd.nuera.ecelp7470", @"ecelp7470" },
+    { "application/vnd.nokia.radio-presets", @"rpss" },
+    { "application/dsptype", @"tsp" },
+    { "application/vnd.webturbo", @"wtb" },
+    { "image/x-jps", @"jps" },
+    { "application/gml+xml", @"gml" },
+    { "application/vnd.amiga.ami", @"ami" },
+    { "application/vnd.commonspace", @"csp" },
+    { "video/3gpp", @"3gp" },
+    { "application/vnd.ecowin.chart", @"mag" },
+    { "application/vnd.groove-injector", @"grv" },
+    { "application/vnd.chipnuts.karaoke-mmd", @"mmd" },
+    { "image/vnd.wap.wbmp", @"wbmp" },
+    { "application/x-tads", @"gam" },
+    { "application/x-ms-shortcut", @"lnk" },
+    { "application/vnd.stepmania.stepchart", @"sm" },
+    { "application/x-wri", @"wri" },
+    { "application/x-ksh", @"ksh" },
+    { "application/vnd.americandynamics.acc", @"acc" },
+    { "application/x-t3vm-image", @"t3" },
+    { "application/srgs+xml", @"grxml" },
+    { "application/vocaltec-media-desc", @"vmd" },
+    { "application/vnd.iccprofile", @"icc" },
+    { "application/vnd.koan", @"skp" },
+    { "x-conference/x-cooltalk", @"ice" },
+    { "text/x-fortran", @"f" },
+    { "audio/x-jam", @"jam" },
+    { "application/vnd.sun.xml.calc.template", @"stc" },
+    { "application/vnd.hbci", @"hbci" },
+    { "chemical/x-pdb", @"pdb" },
+    { "application/pkix-cert", @"cer" },
+    { "application/vnd.3gpp.pic-bw-var", @"pvb" },
+    { "application/x-newton-compatible-pkg", @"pkg" },
+    { "application/ssdl+xml", @"ssdl" },
+    { "application/font-woff", @"woff" },
+    { "application/vnd.dna", @"dna" },
+    { "application/vnd.kde.kchart", @"chrt" },
+    { "application/vnd.hp-pcl", @"pcl" },
+    { "application/omdoc+xml", @"omdoc" },
+    { "application/x-magic-cap-package-1.0", @"mc$" },
+    { "audio/x-mod", @"mod" },
+    { "drawing/x-dwf", @"dwf" },
+    { "application/vnd.blueice.multipass", @"mpm" },
+    { "application/x-msdownload", @"exe" },
+    { "application/atomcat+xml", @"atomcat" },
+    { "application/sdp", @"sdp" },
+    { "application/vnd.oasis.opendocument.formula-template", @"odft" },
+    { "application/vnd.contact.cmsg", @"cdbcmsg" },
+    { "application/x-authorware-bin", @"aab" },
+    { "application/vnd.google-earth.kmz", @"kmz" },
+    { "www/mime", @"mime" },
+    { "application/x-stuffit", @"sit" },
+    { "chemical/x-cmdf", @"cmdf" },
+    { "text/vnd.wap.wml", @"wml" },
+    { "i-world/i-vrml", @"ivr" },
+    { "text/cache-manifest", @"appcache" },
+    { "application/x-latex", @"ltx" },
+    { "application/vnd.ms-pkicertstore", @"sst" },
+    { "multipart/x-gzip", @"gzip" },
+    { "video/vnd.mpegurl", @"mxu" },
+    { "image/x-windows-bmp", @"bmp" },
+    { "text/n3", @"n3" },
+    { "application/vnd.tmobile-livetv", @"tmo" },
+    { "application/vnd.ms-excel", @"xls" },
+    { "image/x-portable-pixmap", @"ppm" },
+    { "application/vnd.powerbuilder6", @"pbd" },
+    { "image/x-portable-greymap", @"pgm" },
+    { "application/relax-ng-compact-syntax", @"rnc" },
+    { "audio/x-matroska", @"mka" },
+    { "text/x-script.sh", @"sh" },
+    { "application/x-font-bdf", @"bdf" },
+    { "application/vnd.fdsn.seed", @"seed" },
+    { "application/mods+xml", @"mods" },
+    { "application/x-navistyle", @"stl" },
+    { "image/tiff", @"tiff" },
+    { "application/vnd.kahootz", @"ktz" },
+    { "application/vnd.fdf", @"fdf" },
+    { "application/vnd.ufdl", @"ufd" },
+    { "audio/adpcm", @"adp" },
+    { "image/png", @"png" },
+    { "application/vnd.intu.qfx", @"qfx" },
+    { "application/excel", @"xls" },
+    { "application/vnd.solent.sdkm+xml", @"sdkm" },
+    { "application/vnd.oasis.opendocument.spreadsheet-template", @"ots" },
+    { "application/davmount+xml", @"davmount" },
+    { "application/vnd.kenameaapp", @"htke" },
+    { "application/pkcs7-signature", @"p7s" },
+    { "application/pkcs-12", @"p12" },
+    { "application/vnd.bmi", @"bmi" },
+    { "model/x3d+xml", @"x3d" },
+    { "application/vnd.sun.xml.writer.global", @"sxg" },
+    { "application/pkix-pkipath", @"pkipath" },
+    { "application/vnd.ms-ims", @"ims" },
+    { "application/wsdl+xml", @"wsdl" },
+    { "application/vnd.sun.xml.writer", @"sxw" },
+    { "application/vnd.ds-keypoint", @"kpxx" },
+    { "application/x-pkcs7-signature", @"p7s" },
+    { "application/x-pixclscript", @"plx" },
+    { "text/x-script", @"hlb" },
+    { "application/jsonml+json", @"jsonml" },
+    { "application/x-msclip", @"clp" },
+    { "audio/tsp-audio", @"tsi" },
+    { "application/mac-binhex40", @"hqx" },
+    { "application/vnd.joost.joda-archive", @"joda" },
+    { "application/vnd.google-earth.kml+xml", @"kml" },
+    { "application/x-msaccess", @"mdb" },
+    { "application/pkix-crl", @"crl" },
+    { "application/vnd.ms-fontobject", @"eot" },
+    { "application/vnd.data-vision.rdz", @"rdz" },
+    { "audio/mpeg", @"mpg" },
+    { "application/x-wpwin", @"wpd" },
+    { "application/shf+xml", @"shf" },
+    { "audio/x-realaudio", @"ra" },
+    { "application/cdf", @"cdf" },
+    { "application/vnd.osgi.dp", @"dp" },
+    { "application/x-mix-transfer", @"nix" },
+    { "application/ccxml+xml", @"ccxml" },
+    { "audio/x-vnd.audioexplosion.mjuicemediafile", @"mjf" },
+    { "font/ttf", @"ttf" },
+    { "text/xml", @"xml" },
+    { "application/futuresplash", @"spl" },
+    { "application/vnd.epson.msf", @"msf" },
+    { "application/pkcs7-mime", @"p7m" },
+    { "application/x-excel", @"xls" },
+    { "text/vnd.curl.dcurl", @"dcurl" },
+    { "application/thraud+xml", @"tfi" },
+    { "application/vnd.dreamfactory", @"dfac" },
+    { "image/ief", @"ief" },
+    { "application/vnd.ms-project", @"mpp" },
+    { "application/x-sh", @"sh" },
+    { "application/vnd.stardivision.math", @"smf" },
+    { "application/vnd.antix.game-component", @"atx" },
+    { "application/gxf", @"gxf" },
+    { "application/vnd.oasis.opendocument.graphics-template", @"otg" },
+    { "text/x-audiosoft-intra", @"aip" },
+    { "application/vnd.visio", @"vsd" },
+    { "application/x-netcdf", @"nc" },
+    { "image/vnd.net-fpx", @"fpx" },
+    { "application/vnd.picsel", @"efif" },
+    { "audio/xm", @"xm" },
+    { "application/lha", @"lha" },
+    { "application/xml-dtd", @"dtd" },
+    { "image/x-xwd", @"xwd" },
+    { "application/rdf+xml", @"rdf" },
+    { "application/x-sql", @"sql" },
+    { "application/vnd.businessobjects", @"rep" },
+    { "application/gnutar", @"tgz" },
+    { "application/mac-compactpro", @"cpt" },
+    { "application/vnd.wap.wmlscriptc", @"wmlsc" },
+    { "application/vnd.mseq", @"mseq" },
+    { "video/x-amt-demorun", @"xdr" },
+    { "application/epub+zip", @"epub" },
+    { "application/vnd.oasis.opendocument.presentation-template", @"otp" },
+    { "application/vnd.openxmlformats-officedocument.presentationml.presentation", @"pptx" },
+    { "application/vnd.symbian.install", @"sis" },
+    { "video/x-motion-jpeg", @"mjpg" },
+    { "application/hta", @"hta" },
+    { "application/x-cdf", @"cdf" },
+    { "application/rsd+xml", @"rsd" },
+    { "application/x-doom", @"wad" },
+    { "text/prs.lines.logTag", @"dsc" },
+    { "application/vnd.mif", @"mif" },
+    { "x-world/x-svr", @"svr" },
+    { "application/vnd.jam", @"jam" },
+    { "application/x-vnd.audioexplosion.mzz", @"mzz" },
+    { "text/x-script.perl-module", @"pm" },
+    { "video/fli", @"fli" },
+    { "application/x-tbook", @"tbk" },
+    { "video/vnd.dece.video", @"uvv" },
+    { "application/vnd.syncml+xml", @"xsm" },
+    { "image/x-niff", @"niff" },
+    { "image/vnd.rn-realflash", @"rf" },
+    { "application/vnd.rn-realmedia", @"rm" },
+    { "x-world/x-vrt", @"vrt" },
+    { "video/vnd.dece.sd", @"uvs" },
+    { "application/x-java-commerce", @"jcm" },
+    { "application/vnd.nokia.n-gage.symbian.install", @"n-gage" },
+};
+
+#pragma mark - GenericExtensions
+
+static const int32_t kGenericExtensionsSeeds[985] = {
+    -985, -983, -982, 0, 0, 0, 0, 0, -975, 0,
+    0, 0, 0, 0, 4, 0, 0, 2, 0, 0,
+    0, 0, 1, 0, 5, 1, 0, -973, 0, 0,
+    5, 3, 2, 0, 4, -972, -968, -964, -962, -961,
+    -960, 1, -956, 0, 0, -951, -949, 1, -947, 0,
+    0, -946, 0, -942, 0, 0, 6, -941, 1, -938,
+    0, 1, 4, 0, 1, -933, 2, 0, 0, -928,
+    1, -926, 0, -925, -924, -922, -919, 2, 0, -918,
+    -916, 0, 0, -913, -912, 0, -911, 0, 1, 0,
+    1, 4, 0, -908, -905, -902, -901, 0, -900, 0,
+    2, -899, -896, -894, 0, 0, -893, -890, 0, 0,
+    0, 0, -889, 0, 0, 0, 0, -884, 0, -880,
+    -877, -875, 0, -873, -869, 0, -868, 0, 0, -864,
+    0, -862, 2, -859, -854, -848, 1, 0, 3, 3,
+    1, -847, 3, 1, -845, 0, 1, 0, 3, 1,
+    -842, 2, 4, 2, 1, 0, -840, 0, -838, -836,
+    -835, 0, 1, 0, -832, 1, 1, -831, -830, 4,
+    1, 0, 1, -829, 0, -828, -825, -823, 0, -808,
+    0, -806, 0, 0, 1, 6, -802, -801, 0, 0,
+    -800, 1, -789, 0, 0, 2, 3, 1, 2, -784,
+    1, 1, 0, 2, 1, -782, 0, 1, -781, 0,
+    1, 0, 0, -777, -776, 0, 1, -773, 1, -768,
+    0, 0, 2, 1, 0, 0, -764, -760, 0, 0,
+    1, -759, 3, -758, 1, 1, -757, -756, 1, 1,
+    0, 0, -752, 0, 0, 1, 0, 0, 0, -750,
+    -748, 0, 0, -747, -744, -737, 0, 3, 0, 1,
+    -736, -733, -731, 0, 0, 1, 0, 0, 0, -725,
+    2, 1, -722, -711, 0, -710, -707, 3, 0, 0,
+    -706, 1, -702, -701, -700, 0, 5, -699, -698, -697,
+    0, 0, 0, -692, 0, 0, 3, -691, -686, 1,
+    4, 1, 0, -685, -681, -680, -677, 0, 1, 0,
+    0, 0, 1, -676, -675, 2, 0, -668, 0, 0,
+    -663, 1, 4, -661, -656, 0, -655, 0, -654, 0,
+    -653, 0, -652, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, -646, -639, 0, -637, 2, -634, 2,
+    1, 0, 1, -630, -628, 4, -626, -625, 1, -623,
+    0, 0, 0, 0, 1, 0, 5, -621, -610, -603,
+    -602, 1, 0, 0, -596, -594, 0, 0, -593, -588,
+    -586, -585, 0, 1, 0, -584, -583, -579, -578, -577,
+    0, 0, -576, -575, 0, 2, -574, 0, 1, -569,
+    1, 0, 0, -568, 0, 0, 0, -563, -562, 0,
+    2, 0, 0, -560, 1, 0, -557, 2, -556, 7,
+    -550, 0, -549, 0, 1, -543, 0, 0, -542, -541,
+    1, -540, 1, 1, 0, -536, 0, -535, 3, -531,
+    0, 0, 1, 3, 0, 1, -529, 4, 3, 0,
+    1, 0, 3, 2, 1, 0, 2, 6, 0, -525,
+    0, -524, -523, 0, 11, -521, -517, 1, -515, 3,
+    -514, 1, 0, 1, -511, 0, 0, -510, 0, -508,
+    -501, 0, 1, 1, 0, 0, -498, 1, 0, -496,
+    0, -495, 0, 0, 0, 0, -494, 0, 0, 0,
+    0, 0, 0, 0, -489, -484, -482, 1, 1, 0,
+    1, 3, 1, 0, 1, -479, 0, -476, 0, 1,
+    0, 0, 0, 2, 1, -474, 0, 10, 0, 2,
+    -472, 3, -470, 0, -463, -461, 0, 1, -456, 0,
+    4, 2, 0, 6, -454, -453, 0, 0, 0, 0,
+    0, -451, 0, 1, -450, 0, -448, 0, 0, 0,
+    -444, 0, 0, 5, 2, 1, 16, 2, 2, 7,
+    0, 3, 0, 0, -441, -439, 1, -438, -431, -422,
+    -418, -416, -413, 0, -411, 1, -410, 0, -404, 0,
+    0, -403, -401, 0, 0, 0, 3, -398, 9, 0,
+    -396, -395, 3, -391, 1, -390, 0, 1, 1, 2,
+    0, 5, 2, -389, -388, 0, 0, 0, 7, 0,
+    0, 1, 0, 0, 0, -386, 15, -382, 0, 5,
+    7, 1, -378, 0, -377, -375, 0, -360, 0, 5,
+    -357, 9, -355, 1, 1, -353, 3, -351, 0, -345,
+    -344, 2, 0, 0, 3, -343, 0, 0, 0, 0,
+    0, -341, 1, 1, -340, 0, -339, 0, -338, 13,
+    1, -335, 0, 0, 0, 0, 0, 0, 0, -334,
+    1, -333, -332, 7, -331, -327, 0, 0, -325, -323,
+    -320, -313, 2, 0, 0, -309, 2, -302, -301, 0,
+    7, 0, 5, 0, -293, -289, 0, -287, 6, -286,
+    -284, 0, 0, 0, 6, 1, 4, -281, 4, -279,
+    0, 5, 0, 5, 2, 0, -274, 14, 1, -268,
+    0, 1, 0, 6, 1, 21, 3, 1, 0, 0,
+    2, 0, 9, -265, -261, 0, 3, 0, 0, 1,
+    1, 3, -260, -258, 1, 10, 1, 1, 0, -253,
+    0, -252, 0, -248, 0, 1, 0, 8, 2, -244,
+    0, -242, 0, 0, 0, -239, -238, -235, 0, -234,
+    -226, 0, 0, -223, 0, -216, 0, 0, 0, 0,
+    0, -215, -211, 0, 0, -210, -209, 4, 0, 0,
+    -208, 0, 0, 0, 5, -205, 2, -203, -201, 0,
+    0, 0, -199, 5, -198, -196, 0, -193, 0, -191,
+    2, -182, 0, 4, -178, -174, -164, 5, 0, -163,
+    8, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    -160, 0, -157, 0, 0, -154, -150, -148, -144, 0,
+    0, -142, 3, 0, -140, 11, -137, 2, -135, 0,
+    0, -133, 1, 2, 4, -131, 0, -128, -126, 0,
+    -125, 0, 0, 0, 0, -124, 5, -123, -122, 4,
+    -121, -109, 0, -108, -105, 0, 4, 4, 0, -103,
+    -101, 0, 0, 0, 0, 1, -98, 1, -94, 1,
+    0, -92, 0, 11, 0, 0, -91, -89, 0, 6,
+    3, 3, -80, 0, -77, -75, 2, 0, -72, 0,
+    -70, 0, -69, 0, -68, 10, -66, 4, 3, -65,
+    0, -63, 0, 0, 0, -58, -50, 0, -42, -41,
+    1, 0, 8, 0, -38, 0, 23, -36, 0, 0,
+    -34, -32, 0, -30, -28, 0, -24, -17, 0, 4,
+    0, 5, -16, 3, -15, 1, 12, 3, 1, 12,
+    4, 0, 0, 3, -13, 0, 0, 6, 8, -8,
+    0, -6, 0, -5, 0,
+};
+
+static const OWSMIMETypeTableEntry kGenericExtensionsEntries[985] = {
+    { "sxd", @"application/vnd.sun.xml.draw" },
+    { "psb", @"application/vnd.3gpp.pic-bw-small" },
+    { "deb", @"application/x-debian-package" },
+    { "m21", @"application/mp21" },
+    { "wmlc", @"application/vnd.wap.wmlc" },
+    { "wks", @"application/vnd.ms-works" },
+    { "def", @"text/plain" },
+    { "jpgv", @"video/jpeg" },
+    { "listafp", @"application/vnd.ibm.modcap" },
+    { "wg", @"application/vnd.pmi.widget" },
+    { "cpp", @"text/x-c" },
+    { "cmp", @"application/vnd.yellowriver-custom-menu" },
+    { "ait", @"application/vnd.dvb.ait" },
+    { "ksp", @"application/vnd.kde.kspread" },
+    { "au", @"audio/basic" },
+    { "lwp", @"application/vnd.lotus-wordpro" },
+    { "gex", @"application/vnd.geometry-explorer" },
+    { "nfo", @"text/x-nfo" },
+    { "osf", @"application/vnd.yamaha.openscoreformat" },
+    { "bz2", @"application/x-bzip2" },
+    { "nnd", @"application/vnd.noblenet-directory" },
+    { "java", @"text/x-java-source" },
+    { "bdm", @"application/vnd.syncml.dm+wbxml" },
+    { "aif", @"audio/x-aiff" },
+    { "slt", @"application/vnd.epson.salt" },
+    { "7z", @"application/x-7z-compressed" },
+    { "emz", @"application/x-msmetafile" },
+    { "kia", @"application/vnd.kidspiration" },
+    { "aab", @"application/x-authorware-bin" },
+    { "mpga", @"audio/mpeg" },
+    { "potm", @"application/vnd.ms-powerpoint.template.macroenabled.12" },
+    { "wpl", @"application/vnd.ms-wpl" },
+    { "kml", @"application/vnd.google-earth.kml+xml" },
+    { "ris", @"application/x-research-info-systems" },
+    { "ufd", @"application/vnd.ufdl" },
+    { "rip", @"audio/vnd.rip" },
+    { "eml", @"message/rfc822" },
+    { "pyv", @"video/vnd.ms-playready.media.pyv" },
+    { "xltx", @"application/vnd.openxmlformats-officedocument.spreadsheetml.template" },
+    { "nns", @"application/vnd.noblenet-sealer" },
+    { "spc", @"application/x-pkcs7-certificates" },
+    { "tpl", @"application/vnd.groove-tool-template" },
+    { "teacher", @"application/vnd.smart.teacher" },
+    { "cgm", @"image/cgm" },
+    { "ccxml", @"application/ccxml+xml" },
+    { "bz", @"application/x-bzip" },
+    { "emf", @"application/x-msmetafile" },
+    { "pdf", @"application/pdf" },
+    { "wbxml", @"application/vnd.wap.wbxml" },
+    { "spl", @"application/x-futuresplash" },
+    { "afm", @"application/x-font-type1" },
+    { "pdb", @"application/vnd.palm" },
+    { "vcg", @"application/vnd.groove-vcard" },
+    { "ufdl", @"application/vnd.ufdl" },
+    { "mathml", @"application/mathml+xml" },
+    { "so", @"application/octet-stream" },
+    { "f4v", @"video/x-f4v" },
+    { "pya", @"audio/vnd.ms-playready.media.pya" },
+    { "dgc", @"application/x-dgc-compressed" },
+    { "ief", @"image/ief" },
+    { "oprc", @"application/vnd.palm" },
+    { "xml", @"application/xml" },
+    { "png", @"image/png" },
+    { "x3dbz", @"model/x3d+binary" },
+    { "cdmid", @"application/cdmi-domain" },
+    { "cdmia", @"application/cdmi-capability" },
+    { "svgz", @"image/svg+xml" },
+    { "spp", @"application/scvp-vp-response" },
+    { "ppm", @"image/x-portable-pixmap" },
+    { "xlsx", @"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet" },
+    { "clkk", @"application/vnd.crick.clicker.keyboard" },
+    { "tcl", @"application/x-tcl" },
+    { "mobi", @"application/x-mobipocket-ebook" },
+    { "dis", @"application/vnd.mobius.dis" },
+    { "ppd", @"application/vnd.cups-ppd" },
+    { "for", @"text/x-fortran" },
+    { "tpt", @"application/vnd.trid.tpt" },
+    { "atom", @"application/atom+xml" },
+    { "xbm", @"image/x-xbitmap" },
+    { "roff", @"text/troff" },
+    { "sitx", @"application/x-stuffitx" },
+    { "xz", @"application/x-xz" },
+    { "wmlsc", @"application/vnd.wap.wmlscriptc" },
+    { "m2a", @"audio/mpeg" },
+    { "clkp", @"application/vnd.crick.clicker.palette" },
+    { "pcl", @"application/vnd.hp-pcl" },
+    { "thmx", @"application/vnd.ms-officetheme" },
+    { "pnm", @"image/x-portable-anymap" },
+    { "mp21", @"application/mp21" },
+    { "clkw", @"application/vnd.crick.clicker.wordbank" },
+    { "mgp", @"application/vnd.osgeo.mapguide.package" },
+    { "qps", @"application/vnd.publishare-delta-tree" },
+    { "xul", @"application/vnd.mozilla.xul+xml" },
+    { "pkipath", @"application/pkix-pkipath" },
+    { "chrt", @"application/vnd.kde.kchart" },
+    { "kpr", @"application/vnd.kde.kpresenter" },
+    { "fbs", @"image/vnd.fastbidsheet" },
+    { "pps", @"application/vnd.ms-powerpoint" },
+    { "dd2", @"application/vnd.oma.dd2+xml" },
+    { "ac", @"application/pkix-attr-cert" },
+    { "wcm", @"application/vnd.ms-works" },
+    { "gca", @"application/x-gca-compressed" },
+    { "zir", @"application/vnd.zul" },
+    { "ktx", @"image/ktx" },
+    { "hvs", @"application/vnd.yamaha.hv-script" },
+    { "ktz", @"application/vnd.kahootz" },
+    { "hh", @"text/x-c" },
+    { "crt", @"application/x-x509-ca-cert" },
+    { "mads", @"application/mads+xml" },
+    { "wad", @"application/x-doom" },
+    { "xdssc", @"application/dssc+xml" },
+    { "gxf", @"application/gxf" },
+    { "odg", @"application/vnd.oasis.opendocument.graphics" },
+    { "odf", @"application/vnd.oasis.opendocument.formula" },
+    { "osfpvg", @"application/vnd.yamaha.openscoreformat.osfpvg+xml" },
+    { "texinfo", @"application/x-texinfo" },
+    { "odc", @"application/vnd.oasis.opendocument.chart" },
+    { "htm", @"text/html" },
+    { "snd", @"audio/basic" },
+    { "mcurl", @"text/vnd.curl.mcurl" },
+    { "mxu", @"video/vnd.mpegurl" },
+    { "aac", @"audio/x-aac" },
+    { "st", @"application/vnd.sailingtracker.track" },
+    { "crl", @"application/pkix-crl" },
+    { "obd", @"application/x-msbinder" },
+    { "pot", @"application/vnd.ms-powerpoint" },
+    { "fxp", @"application/vnd.adobe.fxp" },
+    { "crd", @"application/x-mscardfile" },
+    { "pvb", @"application/vnd.3gpp.pic-bw-var" },
+    { "wax", @"audio/x-ms-wax" },
+    { "dvi", @"application/x-dvi" },
+    { "m3a", @"audio/mpeg" },
+    { "mfm", @"application/vnd.mfmp" },
+    { "latex", @"application/x-latex" },
+    { "irp", @"application/vnd.irepository.package+xml" },
+    { "tsv", @"text/tab-separated-values" },
+    { "dvb", @"video/vnd.dvb.file" },
+    { "cdmio", @"application/cdmi-object" },
+    { "lzh", @"application/x-lzh-compressed" },
+    { "sm", @"application/vnd.stepmania.stepchart" },
+    { "metalink", @"application/metalink+xml" },
+    { "fgd", @"application/x-director" },
+    { "sql", @"application/x-sql" },
+    { "dcr", @"application/x-director" },
+    { "tmo", @"application/vnd.tmobile-livetv" },
+    { "curl", @"text/vnd.curl" },
+    { "cc", @"text/x-c" },
+    { "scm", @"application/vnd.lotus-screencam" },
+    { "pkg", @"application/octet-stream" },
+    { "jnlp", @"application/x-java-jnlp-file" },
+    { "sda", @"application/vnd.stardivision.draw" },
+    { "swf", @"application/x-shockwave-flash" },
+    { "ifm", @"application/vnd.shana.informed.formdata" },
+    { "iota", @"application/vnd.astraea-software.iota" },
+    { "csml", @"chemical/x-csml" },
+    { "vst", @"application/vnd.visio" },
+    { "clkx", @"application/vnd.crick.clicker" },
+    { "ghf", @"application/vnd.groove-help" },
+    { "c4d", @"application/vnd.clonk.c4group" },
+    { "scd", @"application/x-msschedule" },
+    { "xlam", @"application/vnd.ms-excel.addin.macroenabled.12" },
+    { "pgn", @"application/x-chess-pgn" },
+    { "inkml", @"application/inkml+xml" },
+    { "box", @"application/vnd.previewsystems.box" },
+    { "pgm", @"image/x-portable-graymap" },
+    { "svc", @"application/vnd.dvb.service" },
+    { "in", @"text/plain" },
+    { "clkt", @"application/vnd.crick.clicker.template" },
+    { "m1v", @"video/mpeg" },
+    { "rlc", @"image/vnd.fujixerox.edmics-rlc" },
+    { "setpay", @"application/set-payment-initiation" },
+    { "ez2", @"application/vnd.ezpix-album" },
+    { "mesh", @"model/mesh" },
+    { "scs", @"application/scvp-cv-response" },
+    { "pbd", @"application/vnd.powerbuilder6" },
+    { "c4u", @"application/vnd.clonk.c4group" },
+    { "asm", @"text/x-asm" },
+    { "boz", @"application/x-bzip2" },
+    { "gac", @"application/vnd.groove-account" },
+    { "flac", @"audio/x-flac" },
+    { "omdoc", @"application/omdoc+xml" },
+    { "sse", @"application/vnd.kodak-descriptor" },
+    { "acu", @"application/vnd.acucobol" },
+    { "cpio", @"application/x-cpio" },
+    { "scurl", @"text/vnd.curl.scurl" },
+    { "cct", @"application/x-director" },
+    { "asc", @"application/pgp-signature" },
+    { "mks", @"video/x-matroska" },
+    { "bin", @"application/octet-stream" },
+    { "jsonml", @"application/jsonml+json" },
+    { "u32", @"application/x-authorware-bin" },
+    { "s", @"text/x-asm" },
+    { "onetoc", @"application/onenote" },
+    { "xpi", @"application/x-xpinstall" },
+    { "yin", @"application/yin+xml" },
+    { "ggb", @"application/vnd.geogebra.file" },
+    { "see", @"application/vnd.seemail" },
+    { "n3", @"text/n3" },
+    { "mp2", @"audio/mpeg" },
+    { "mk3d", @"video/x-matroska" },
+    { "smi", @"application/smil+xml" },
+    { "cpt", @"application/mac-compactpro" },
+    { "smv", @"video/x-smv" },
+    { "bpk", @"application/octet-stream" },
+    { "esa", @"application/vnd.osgi.subsystem" },
+    { "xpl", @"application/xproc+xml" },
+    { "cif", @"chemical/x-cif" },
+    { "wbs", @"application/vnd.criticaltools.wbs+xml" },
+    { "ps", @"application/postscript" },
+    { "wrl", @"model/vrml" },
+    { "wri", @"application/x-mswrite" },
+    { "pki", @"application/pkixcmp" },
+    { "pclxl", @"application/vnd.hp-pclxl" },
+    { "otf", @"application/x-font-otf" },
+    { "mpeg", @"video/mpeg" },
+    { "cdxml", @"application/vnd.chemdraw+xml" },
+    { "cab", @"application/vnd.ms-cab-compressed" },
+    { "davmount", @"application/davmount+xml" },
+    { "xvml", @"application/xv+xml" },
+    { "pfb", @"application/x-font-type1" },
+    { "dae", @"model/vnd.collada+xml" },
+    { "daf", @"application/vnd.mobius.daf" },
+    { "xop", @"application/xop+xml" },
+    { "h264", @"video/h264" },
+    { "spot", @"text/vnd.in3d.spot" },
+    { "fh", @"image/x-freehand" },
+    { "hpgl", @"application/vnd.hp-hpgl" },
+    { "tei", @"application/tei+xml" },
+    { "exe", @"application/x-msdownload" },
+    { "sfd-hdstx", @"application/vnd.hydrostatix.sof-data" },
+    { "dotm", @"application/vnd.ms-word.template.macroenabled.12" },
+    { "ecelp7470", @"audio/vnd.nuera.ecelp7470" },
+    { "cmx", @"image/x-cmx" },
+    { "src", @"application/x-wais-source" },
+    { "rnc", @"application/relax-ng-compact-syntax" },
+    { "hlp", @"application/winhlp" },
+    { "wvx", @"video/x-ms-wvx" },
+    { "zaz", @"application/vnd.zzazz.deck+xml" },
+    { "fm", @"application/vnd.framemaker" },
+    { "ttf", @"application/x-font-ttf" },
+    { "gph", @"application/vnd.flographit" },
+    { "nitf", @"application/vnd.nitf" },
+    { "ntf", @"application/vnd.nitf" },
+    { "tra", @"application/vnd.trueapp" },
+    { "fzs", @"application/vnd.fuzzysheet" },
+    { "ltf", @"application/vnd.frogans.ltf" },
+    { "spf", @"application/vnd.yamaha.smaf-phrase" },
+    { "uvz", @"application/vnd.dece.zip" },
+    { "es3", @"application/vnd.eszigno3+xml" },
+    { "susp", @"application/vnd.sus-calendar" },
+    { "chm", @"application/vnd.ms-htmlhelp" },
+    { "mpg", @"video/mpeg" },
+    { "mpe", @"video/mpeg" },
+    { "smzip", @"application/vnd.stepmania.package" },
+    { "dp", @"application/vnd.osgi.dp" },
+    { "hdf", @"application/x-hdf" },
+    { "gpx", @"application/gpx+xml" },
+    { "uvt", @"application/vnd.dece.ttml+xml" },
+    { "text", @"text/plain" },
+    { "ddd", @"application/vnd.fujixerox.ddd" },
+    { "prc", @"application/x-mobipocket-ebook" },
+    { "pct", @"image/x-pict" },
+    { "lbe", @"application/vnd.llamagraphics.life-balance.exchange+xml" },
+    { "dwf", @"model/vnd.dwf" },
+    { "oxps", @"application/oxps" },
+    { "hvd", @"application/vnd.yamaha.hv-dic" },
+    { "uvvv", @"video/vnd.dece.video" },
+    { "m4v", @"video/x-m4v" },
+    { "gbr", @"application/rpki-ghostbusters" },
+    { "fpx", @"image/vnd.fpx" },
+    { "uvvz", @"application/vnd.dece.zip" },
+    { "mseed", @"application/vnd.fdsn.mseed" },
+    { "xfdl", @"application/vnd.xfdl" },
+    { "efif", @"application/vnd.picsel" },
+    { "bed", @"application/vnd.realvnc.bed" },
+    { "sti", @"application/vnd.sun.xml.impress.template" },
+    { "mdi", @"image/vnd.ms-modi" },
+    { "stk", @"application/hyperstudio" },
+    { "sdkd", @"application/vnd.solent.sdkm+xml" },
+    { "obj", @"application/x-tgif" },
+    { "h261", @"video/h261" },
+    { "mdb", @"application/x-msaccess" },
+    { "mpt", @"application/vnd.ms-project" },
+    { "sdkm", @"application/vnd.solent.sdkm+xml" },
+    { "ras", @"image/x-cmu-raster" },
+    { "btif", @"image/prs.btif" },
+    { "qwt", @"application/vnd.quark.quarkxpress" },
+    { "wmz", @"application/x-msmetafile" },
+    { "xht", @"application/xhtml+xml" },
+    { "dll", @"application/x-msdownload" },
+    { "kmz", @"application/vnd.google-earth.kmz" },
+    { "cil", @"application/vnd.ms-artgalry" },
+    { "jisp", @"application/vnd.jisp" },
+    { "cap", @"application/vnd.tcpdump.pcap" },
+    { "vcd", @"application/x-cdlink" },
+    { "z8", @"application/x-zmachine" },
+    { "mp3", @"audio/mpeg" },
+    { "mseq", @"application/vnd.mseq" },
+    { "ra", @"audio/x-pn-realaudio" },
+    { "mpm", @"application/vnd.blueice.multipass" },
+    { "vxml", @"application/voicexml+xml" },
+    { "xhtml", @"application/xhtml+xml" },
+    { "ahead", @"application/vnd.ahead.space" },
+    { "pptx", @"application/vnd.openxmlformats-officedocument.presentationml.presentation" },
+    { "z3", @"application/x-zmachine" },
+    { "fig", @"application/x-xfig" },
+    { "ram", @"audio/x-pn-realaudio" },
+    { "xspf", @"application/xspf+xml" },
+    { "mscml", @"application/mediaservercontrol+xml" },
+    { "musicxml", @"application/vnd.recordare.musicxml+xml" },
+    { "m4a", @"audio/mp4" },
+    { "ttc", @"application/x-font-ttf" },
+    { "qwd", @"application/vnd.quark.quarkxpress" },
+    { "urls", @"text/uri-list" },
+    { "pqa", @"application/vnd.palm" },
+    { "jam", @"application/vnd.jam" },
+    { "nml", @"application/vnd.enliven" },
+    { "sldm", @"application/vnd.ms-powerpoint.slide.macroenabled.12" },
+    { "sv4crc", @"application/x-sv4crc" },
+    { "xwd", @"image/x-xwindowdump" },
+    { "aas", @"application/x-authorware-seg" },
+    { "midi", @"audio/midi" },
+    { "x32", @"application/x-authorware-bin" },
+    { "xbap", @"application/x-ms-xbap" },
+    { "zirz", @"application/vnd.zul" },
+    { "air", @"application/vnd.adobe.air-application-installer-package+zip" },
+    { "cmc", @"application/vnd.cosmocaller" },
+    { "vsf", @"application/vnd.vsf" },
+    { "sldx", @"application/vnd.openxmlformats-officedocument.presentationml.slide" },
+    { "roa", @"application/rpki-roa" },
+    { "uoml", @"application/vnd.uoml+xml" },
+    { "unityweb", @"application/vnd.unity" },
+    { "ifb", @"text/calendar" },
+    { "sus", @"application/vnd.sus-calendar" },
+    { "teicorpus", @"application/tei+xml" },
+    { "pptm", @"application/vnd.ms-powerpoint.presentation.macroenabled.12" },
+    { "saf", @"application/vnd.yamaha.smaf-audio" },
+    { "texi", @"application/x-texinfo" },
+    { "ser", @"application/java-serialized-object" },
+    { "sub", @"text/vnd.dvb.subtitle" },
+    { "xif", @"image/vnd.xiff" },
+    { "uvv", @"video/vnd.dece.video" },
+    { "cbz", @"application/x-cbr" },
+    { "ppsx", @"application/vnd.openxmlformats-officedocument.presentationml.slideshow" },
+    { "hqx", @"application/mac-binhex40" },
+    { "m13", @"application/x-msmediaview" },
+    { "paw", @"application/vnd.pawaafile" },
+    { "mmr", @"image/vnd.fujixerox.edmics-mmr" },
+    { "m14", @"application/x-msmediaview" },
+    { "html", @"text/html" },
+    { "cbr", @"application/x-cbr" },
+    { "smil", @"application/smil+xml" },
+    { "fly", @"text/vnd.fly" },
+    { "fhc", @"image/x-freehand" },
+    { "p", @"text/x-pascal" },
+    { "geo", @"application/vnd.dynageo" },
+    { "flv", @"video/x-flv" },
+    { "mmd", @"application/vnd.chipnuts.karaoke-mmd" },
+    { "uvg", @"image/vnd.dece.graphic" },
+    { "frame", @"application/vnd.framemaker" },
+    { "xlf", @"application/x-xliff+xml" },
+    { "xenc", @"application/xenc+xml" },
+    { "t", @"text/troff" },
+    { "xlc", @"application/vnd.ms-excel" },
+    { "wps", @"application/vnd.ms-works" },
+    { "nb", @"application/mathematica" },
+    { "mp4a", @"audio/mp4" },
+    { "sgl", @"application/vnd.stardivision.writer-global" },
+    { "uvm", @"video/vnd.dece.mobile" },
+    { "xlm", @"application/vnd.ms-excel" },
+    { "sgi", @"image/sgi" },
+    { "kne", @"application/vnd.kinar" },
+    { "json", @"application/json" },
+    { "atomsvc", @"application/atomsvc+xml" },
+    { "cla", @"application/vnd.claymore" },
+    { "xlw", @"application/vnd.ms-excel" },
+    { "ustar", @"application/x-ustar" },
+    { "f", @"text/x-fortran" },
+    { "vcard", @"text/vcard" },
+    { "rcprofile", @"application/vnd.ipunplugged.rcprofile" },
+    { "ssf", @"application/vnd.epson.ssf" },
+    { "c", @"text/x-c" },
+    { "sxg", @"application/vnd.sun.xml.writer.global" },
+    { "rep", @"application/vnd.businessobjects" },
+    { "vtu", @"model/vnd.vtu" },
+    { "g3", @"image/g3fax" },
+    { "bcpio", @"application/x-bcpio" },
+    { "sdp", @"application/sdp" },
+    { "dist", @"application/octet-stream" },
+    { "lbd", @"application/vnd.llamagraphics.life-balance.desktop" },
+    { "utz", @"application/vnd.uiq.theme" },
+    { "sfs", @"application/vnd.spotfire.sfs" },
+    { "cba", @"application/x-cbr" },
+    { "wdb", @"application/vnd.ms-works" },
+    { "xpw", @"application/vnd.intercon.formnet" },
+    { "atx", @"application/vnd.antix.game-component" },
+    { "sfv", @"text/x-sfv" },
+    { "xps", @"application/vnd.ms-xpsdocument" },
+    { "bdf", @"application/x-font-bdf" },
+    { "shar", @"application/x-shar" },
+    { "oti", @"application/vnd.oasis.opendocument.image-template" },
+    { "gre", @"application/vnd.geometry-explorer" },
+    { "oth", @"application/vnd.oasis.opendocument.text-web" },
+    { "xpx", @"application/vnd.intercon.formnet" },
+    { "dxf", @"image/vnd.dxf" },
+    { "udeb", @"application/x-debian-package" },
+    { "xhvml", @"application/xv+xml" },
+    { "ipk", @"application/vnd.shana.informed.package" },
+    { "m2v", @"video/mpeg" },
+    { "otg", @"application/vnd.oasis.opendocument.graphics-template" },
+    { "nlu", @"application/vnd.neurolanguage.nlu" },
+    { "hvp", @"application/vnd.yamaha.hv-voice" },
+    { "otc", @"application/vnd.oasis.opendocument.chart-template" },
+    { "hbci", @"application/vnd.hbci" },
+    { "jad", @"text/vnd.sun.j2me.app-descriptor" },
+    { "odp", @"application/vnd.oasis.opendocument.presentation" },
+    { "fxpl", @"application/vnd.adobe.fxp" },
+    { "ods", @"application/vnd.oasis.opendocument.spreadsheet" },
+    { "fcdt", @"application/vnd.adobe.formscentral.fcdt" },
+    { "uu", @"text/x-uuencode" },
+    { "pas", @"text/x-pascal" },
+    { "atc", @"application/vnd.acucorp" },
+    { "css", @"text/css" },
+    { "csp", @"application/vnd.commonspace" },
+    { "twd", @"application/vnd.simtech-mindmapper" },
+    { "rp9", @"application/vnd.cloanto.rp9" },
+    { "rif", @"application/reginfo+xml" },
+    { "irm", @"application/vnd.ibm.rights-management" },
+    { "ecelp4800", @"audio/vnd.nuera.ecelp4800" },
+    { "fh7", @"image/x-freehand" },
+    { "odm", @"application/vnd.oasis.opendocument.text-master" },
+    { "z7", @"application/x-zmachine" },
+    { "mft", @"application/rpki-manifest" },
+    { "t3", @"application/x-t3vm-image" },
+    { "dir", @"application/x-director" },
+    { "skt", @"application/vnd.koan" },
+    { "mvb", @"application/x-msmediaview" },
+    { "dmp", @"application/vnd.tcpdump.pcap" },
+    { "xpm", @"image/x-xpixmap" },
+    { "nbp", @"application/vnd.wolfram.player" },
+    { "odi", @"application/vnd.oasis.opendocument.image" },
+    { "les", @"application/vnd.hhe.lesson-player" },
+    { "psf", @"application/x-font-linux-psf" },
+    { "conf", @"text/plain" },
+    { "smf", @"application/vnd.stardivision.math" },
+    { "rpss", @"application/vnd.nokia.radio-presets" },
+    { "h263", @"video/h263" },
+    { "dmg", @"application/x-apple-diskimage" },
+    { "blorb", @"application/x-blorb" },
+    { "dpg", @"application/vnd.dpgraph" },
+    { "fdf", @"application/vnd.fdf" },
+    { "mp4", @"video/mp4" },
+    { "snf", @"application/x-font-snf" },
+    { "ami", @"application/vnd.amiga.ami" },
+    { "sc", @"application/vnd.ibm.secure-container" },
+    { "ez3", @"application/vnd.ezpix-package" },
+    { "sxm", @"application/vnd.sun.xml.math" },
+    { "lha", @"application/x-lzh-compressed" },
+    { "stc", @"application/vnd.sun.xml.calc.template" },
+    { "grxml", @"application/srgs+xml" },
+    { "g2w", @"application/vnd.geoplan" },
+    { "taglet", @"application/vnd.mynfc" },
+    { "tex", @"application/x-tex" },
+    { "dump", @"application/octet-stream" },
+    { "weba", @"audio/webm" },
+    { "cmdf", @"chemical/x-cmdf" },
+    { "oga", @"audio/ogg" },
+    { "semd", @"application/vnd.semd" },
+    { "ice", @"x-conference/x-cooltalk" },
+    { "pbm", @"image/x-portable-bitmap" },
+    { "mj2", @"video/mj2" },
+    { "yang", @"application/yang" },
+    { "ogg", @"audio/ogg" },
+    { "ogv", @"video/ogg" },
+    { "ico", @"image/x-icon" },
+    { "rms", @"application/vnd.jcp.javame.midlet-rms" },
+    { "rmp", @"audio/x-pn-realaudio-plugin" },
+    { "skd", @"application/vnd.koan" },
+    { "f77", @"text/x-fortran" },
+    { "cdkey", @"application/vnd.mediastation.cdkey" },
+    { "kfo", @"application/vnd.kde.kformula" },
+    { "cdy", @"application/vnd.cinderella" },
+    { "sxw", @"application/vnd.sun.xml.writer" },
+    { "cdx", @"chemical/x-cdx" },
+    { "ggt", @"application/vnd.geogebra.tool" },
+    { "rmi", @"audio/midi" },
+    { "cbt", @"application/x-cbr" },
+    { "tfi", @"application/thraud+xml" },
+    { "wspolicy", @"application/wspolicy+xml" },
+    { "uvvu", @"video/vnd.uvvu.mp4" },
+    { "xdm", @"application/vnd.syncml.dm+xml" },
+    { "tfm", @"application/x-tex-tfm" },
+    { "chat", @"application/x-chat" },
+    { "wtb", @"application/vnd.webturbo" },
+    { "cdf", @"application/x-netcdf" },
+    { "tiff", @"image/tiff" },
+    { "torrent", @"application/x-bittorrent" },
+    { "application", @"application/x-ms-application" },
+    { "tr", @"text/troff" },
+    { "uvvm", @"video/vnd.dece.mobile" },
+    { "imp", @"application/vnd.accpac.simply.imp" },
+    { "txd", @"application/vnd.genomatix.tuxedo" },
+    { "vox", @"application/x-authorware-bin" },
+    { "uvvi", @"image/vnd.dece.graphic" },
+    { "joda", @"application/vnd.joost.joda-archive" },
+    { "qxt", @"application/vnd.quark.quarkxpress" },
+    { "afp", @"application/vnd.ibm.modcap" },
+    { "wml", @"text/vnd.wap.wml" },
+    { "gsf", @"application/x-font-ghostscript" },
+    { "ims", @"application/vnd.ms-ims" },
+    { "wma", @"audio/x-ms-wma" },
+    { "w3d", @"application/x-director" },
+    { "xdw", @"application/vnd.fujixerox.docuworks" },
+    { "dxr", @"application/x-director" },
+    { "dxp", @"application/vnd.spotfire.dxp" },
+    { "gram", @"application/srgs" },
+    { "uvvh", @"video/vnd.dece.hd" },
+    { "wmx", @"video/x-ms-wmx" },
+    { "uvvx", @"application/vnd.dece.unspecified" },
+    { "xdp", @"application/vnd.adobe.xdp+xml" },
+    { "uvvg", @"image/vnd.dece.graphic" },
+    { "rpst", @"application/vnd.nokia.radio-preset" },
+    { "uvvd", @"application/vnd.dece.data" },
+    { "wm", @"video/x-ms-wm" },
+    { "uvva", @"audio/vnd.dece.audio" },
+    { "uvvs", @"video/vnd.dece.sd" },
+    { "uvvp", @"video/vnd.dece.pd" },
+    { "wmf", @"application/x-msmetafile" },
+    { "uvvt", @"application/vnd.dece.ttml+xml" },
+    { "wmd", @"application/x-ms-wmd" },
+    { "bmi", @"application/vnd.bmi" },
+    { "sdw", @"application/vnd.stardivision.writer" },
+    { "ppsm", @"application/vnd.ms-powerpoint.slideshow.macroenabled.12" },
+    { "kpt", @"application/vnd.kde.kpresenter" },
+    { "ptid", @"application/vnd.pvi.ptid1" },
+    { "ext", @"application/vnd.novadigm.ext" },
+    { "gv", @"text/vnd.graphviz" },
+    { "mpn", @"application/vnd.mophun.application" },
+    { "wsdl", @"application/wsdl+xml" },
+    { "pcx", @"image/x-pcx" },
+    { "pcf", @"application/x-font-pcf" },
+    { "fst", @"image/vnd.fst" },
+    { "ivp", @"application/vnd.immervision-ivp" },
+    { "scq", @"application/scvp-cv-request" },
+    { "ssml", @"application/ssml+xml" },
+    { "gdl", @"model/vnd.gdl" },
+    { "jpg", @"image/jpeg" },
+    { "sit", @"application/x-stuffit" },
+    { "ktr", @"application/vnd.kahootz" },
+    { "emma", @"application/emma+xml" },
+    { "vis", @"application/vnd.visionary" },
+    { "heif", @"image/heif" },
+    { "jpm", @"video/jpm" },
+    { "mc1", @"application/vnd.medcalcdata" },
+    { "heic", @"image/heic" },
+    { "cww", @"application/prs.cww" },
+    { "lostxml", @"application/lost+xml" },
+    { "vrml", @"model/vrml" },
+    { "spq", @"application/scvp-vp-request" },
+    { "mpkg", @"application/vnd.apple.installer+xml" },
+    { "nzb", @"application/x-nzb" },
+    { "gam", @"application/x-tads" },
+    { "fsc", @"application/vnd.fsc.weblaunch" },
+    { "rss", @"application/rss+xml" },
+    { "fg5", @"application/vnd.fujitsu.oasysgp" },
+    { "hps", @"application/vnd.hp-hps" },
+    { "wbmp", @"image/vnd.wap.wbmp" },
+    { "jpeg", @"image/jpeg" },
+    { "xyz", @"chemical/x-xyz" },
+    { "p8", @"application/pkcs8" },
+    { "qbo", @"application/vnd.intu.qbo" },
+    { "ivu", @"application/vnd.immervision-ivu" },
+    { "meta4", @"application/metalink4+xml" },
+    { "gqs", @"application/vnd.grafeq" },
+    { "mb", @"application/mathematica" },
+    { "ma", @"application/mathematica" },
+    { "mime", @"message/rfc822" },
+    { "me", @"text/troff" },
+    { "deploy", @"application/octet-stream" },
+    { "setreg", @"application/set-registration-initiation" },
+    { "res", @"application/x-dtbresource+xml" },
+    { "exi", @"application/exi" },
+    { "ssdl", @"application/ssdl+xml" },
+    { "gqf", @"application/vnd.grafeq" },
+    { "install", @"application/x-install-instructions" },
+    { "mxml", @"application/xv+xml" },
+    { "dtshd", @"audio/vnd.dts.hd" },
+    { "xsm", @"application/vnd.syncml+xml" },
+    { "esf", @"application/vnd.epson.esf" },
+    { "pwn", @"application/vnd.3m.post-it-notes" },
+    { "ogx", @"application/ogg" },
+    { "dwg", @"image/vnd.dwg" },
+    { "xsl", @"application/xml" },
+    { "plb", @"application/vnd.3gpp.pic-bw-large" },
+    { "distz", @"application/octet-stream" },
+    { "plc", @"application/vnd.mobius.plc" },
+    { "dsc", @"text/prs.lines.logTag" },
+    { "mka", @"audio/x-matroska" },
+    { "et3", @"application/vnd.eszigno3+xml" },
+    { "com", @"application/x-msdownload" },
+    { "zip", @"application/zip" },
+    { "str", @"application/vnd.pg.format" },
+    { "sis", @"application/vnd.symbian.install" },
+    { "sdd", @"application/vnd.stardivision.impress" },
+    { "i2g", @"application/vnd.intergeo" },
+    { "igm", @"application/vnd.insors.igm" },
+    { "sbml", @"application/sbml+xml" },
+    { "uva", @"audio/vnd.dece.audio" },
+    { "x3dvz", @"model/x3d+vrml" },
+    { "c11amc", @"application/vnd.cluetrust.cartomobile-config" },
+    { "3g2", @"video/3gpp2" },
+    { "lrm", @"application/vnd.ms-lrm" },
+    { "g3w", @"application/vnd.geospace" },
+    { "wmv", @"video/x-ms-wmv" },
+    { "n-gage", @"application/vnd.nokia.n-gage.symbian.install" },
+    { "vss", @"application/vnd.visio" },
+    { "mkv", @"video/x-matroska" },
+    { "dfac", @"application/vnd.dreamfactory" },
+    { "iges", @"model/iges" },
+    { "cer", @"application/pkix-cert" },
+    { "stw", @"application/vnd.sun.xml.writer.template" },
+    { "x3d", @"model/x3d+xml" },
+    { "c11amz", @"application/vnd.cluetrust.cartomobile-config-pkg" },
+    { "cdmic", @"application/cdmi-container" },
+    { "dcurl", @"text/vnd.curl.dcurl" },
+    { "sil", @"audio/silk" },
+    { "mbox", @"application/mbox" },
+    { "sv4cpio", @"application/x-sv4cpio" },
+    { "mjp2", @"video/mj2" },
+    { "pskcxml", @"application/pskc+xml" },
+    { "ai", @"application/postscript" },
+    { "ei6", @"application/vnd.pg.osasli" },
+    { "vsw", @"application/vnd.visio" },
+    { "sid", @"image/x-mrsid-image" },
+    { "sgm", @"text/sgml" },
+    { "ott", @"application/vnd.oasis.opendocument.text-template" },
+    { "kwt", @"application/vnd.kde.kword" },
+    { "cdmiq", @"application/cdmi-queue" },
+    { "stl", @"application/vnd.ms-pki.stl" },
+    { "ppt", @"application/vnd.ms-powerpoint" },
+    { "gnumeric", @"application/x-gnumeric" },
+    { "mxs", @"application/vnd.triscape.mxs" },
+    { "aiff", @"audio/x-aiff" },
+    { "woff", @"application/font-woff" },
+    { "list3820", @"application/vnd.ibm.modcap" },
+    { "ncx", @"application/x-dtbncx+xml" },
+    { "dra", @"audio/vnd.dra" },
+    { "p7m", @"application/pkcs7-mime" },
+    { "p7b", @"application/x-pkcs7-certificates" },
+    { "p7c", @"application/pkcs7-mime" },
+    { "fnc", @"application/vnd.frogans.fnc" },
+    { "opml", @"text/x-opml" },
+    { "kwd", @"application/vnd.kde.kword" },
+    { "potx", @"application/vnd.openxmlformats-officedocument.presentationml.template" },
+    { "js", @"application/javascript" },
+    { "silo", @"model/mesh" },
+    { "mrcx", @"application/marcxml+xml" },
+    { "p12", @"application/x-pkcs12" },
+    { "ics", @"text/calendar" },
+    { "evy", @"application/x-envoy" },
+    { "eps", @"application/postscript" },
+    { "qam", @"application/vnd.epson.quickanime" },
+    { "3ds", @"image/x-3ds" },
+    { "ftc", @"application/vnd.fluxtime.clip" },
+    { "jpgm", @"video/jpm" },
+    { "p7s", @"application/pkcs7-signature" },
+    { "oxt", @"application/vnd.openofficeorg.extension" },
+    { "vsd", @"application/vnd.visio" },
+    { "mxl", @"application/vnd.recordare.musicxml" },
+    { "fti", @"application/vnd.anser-web-funds-transfer-initiation" },
+    { "adp", @"audio/adpcm" },
+    { "msty", @"application/vnd.muvee.style" },
+    { "3gp", @"video/3gpp" },
+    { "rdz", @"application/vnd.data-vision.rdz" },
+    { "kpxx", @"application/vnd.ds-keypoint" },
+    { "appcache", @"text/cache-manifest" },
+    { "sema", @"application/vnd.sema" },
+    { "rdf", @"application/rdf+xml" },
+    { "kon", @"application/vnd.kde.kontour" },
+    { "swa", @"application/x-director" },
+    { "azw", @"application/vnd.amazon.ebook" },
+    { "elc", @"application/octet-stream" },
+    { "onetmp", @"application/onenote" },
+    { "hal", @"application/vnd.hal+xml" },
+    { "semf", @"application/vnd.semf" },
+    { "acutc", @"application/vnd.acucorp" },
+    { "movie", @"video/x-sgi-movie" },
+    { "avi", @"video/x-msvideo" },
+    { "gtw", @"model/vnd.gtw" },
+    { "fe_launch", @"application/vnd.denovo.fcselayout-link" },
+    { "swi", @"application/vnd.aristanetworks.swi" },
+    { "itp", @"application/vnd.shana.informed.formtemplate" },
+    { "f90", @"text/x-fortran" },
+    { "onepkg", @"application/onenote" },
+    { "txf", @"application/vnd.mobius.txf" },
+    { "odb", @"application/vnd.oasis.opendocument.database" },
+    { "ecma", @"application/ecmascript" },
+    { "wqd", @"application/vnd.wqd" },
+    { "azf", @"application/vnd.airzip.filesecure.azf" },
+    { "cdbcmsg", @"application/vnd.contact.cmsg" },
+    { "aso", @"application/vnd.accpac.simply.aso" },
+    { "vcs", @"text/x-vcalendar" },
+    { "dbk", @"application/docbook+xml" },
+    { "cst", @"application/x-director" },
+    { "dot", @"application/msword" },
+    { "ez", @"application/andrew-inset" },
+    { "asf", @"video/x-ms-asf" },
+    { "dotx", @"application/vnd.openxmlformats-officedocument.wordprocessingml.template" },
+    { "iif", @"application/vnd.shana.informed.interchange" },
+    { "vcx", @"application/vnd.vcx" },
+    { "xltm", @"application/vnd.ms-excel.template.macroenabled.12" },
+    { "ots", @"application/vnd.oasis.opendocument.spreadsheet-template" },
+    { "srx", @"application/sparql-results+xml" },
+    { "vor", @"application/vnd.stardivision.writer" },
+    { "wav", @"audio/x-wav" },
+    { "jar", @"application/java-archive" },
+    { "mlp", @"application/vnd.dolby.mlp" },
+    { "z4", @"application/x-zmachine" },
+    { "sdc", @"application/vnd.stardivision.calc" },
+    { "z6", @"application/x-zmachine" },
+    { "3dml", @"text/vnd.in3d.3dml" },
+    { "wdp", @"image/vnd.ms-photo" },
+    { "z2", @"application/x-zmachine" },
+    { "z1", @"application/x-zmachine" },
+    { "vcf", @"text/x-vcard" },
+    { "class", @"application/java-vm" },
+    { "msi", @"application/x-msdownload" },
+    { "msh", @"model/mesh" },
+    { "cml", @"chemical/x-cml" },
+    { "psd", @"image/vnd.adobe.photoshop" },
+    { "asx", @"video/x-ms-asf" },
+    { "msl", @"application/vnd.mobius.msl" },
+    { "mcd", @"application/vnd.mcd" },
+    { "cb7", @"application/x-cbr" },
+    { "xslt", @"application/xslt+xml" },
+    { "mp4v", @"video/mp4" },
+    { "ace", @"application/x-ace-compressed" },
+    { "msf", @"application/vnd.epson.msf" },
+    { "uvf", @"application/vnd.dece.data" },
+    { "mbk", @"application/vnd.mobius.mbk" },
+    { "srt", @"application/x-subrip" },
+    { "sru", @"application/sru+xml" },
+    { "eot", @"application/vnd.ms-fontobject" },
+    { "viv", @"video/vnd.vivo" },
+    { "gim", @"application/vnd.groove-identity-message" },
+    { "pub", @"application/x-mspublisher" },
+    { "acc", @"application/vnd.americandynamics.acc" },
+    { "pcap", @"application/vnd.tcpdump.pcap" },
+    { "pml", @"application/vnd.ctc-posml" },
+    { "opf", @"application/oebps-package+xml" },
+    { "mwf", @"application/vnd.mfer" },
+    { "edx", @"application/vnd.novadigm.edx" },
+    { "aep", @"application/vnd.audiograph" },
+    { "xbd", @"application/vnd.fujixerox.docuworks.binder" },
+    { "htke", @"application/vnd.kenameaapp" },
+    { "c4g", @"application/vnd.clonk.c4group" },
+    { "c4f", @"application/vnd.clonk.c4group" },
+    { "mie", @"application/x-mie" },
+    { "edm", @"application/vnd.novadigm.edm" },
+    { "bat", @"application/x-msdownload" },
+    { "mus", @"application/vnd.musician" },
+    { "tar", @"application/x-tar" },
+    { "dms", @"application/octet-stream" },
+    { "c4p", @"application/vnd.clonk.c4group" },
+    { "rq", @"application/sparql-query" },
+    { "mif", @"application/vnd.mif" },
+    { "mid", @"audio/midi" },
+    { "arc", @"application/x-freearc" },
+    { "mets", @"application/mets+xml" },
+    { "uvh", @"video/vnd.dece.hd" },
+    { "uvi", @"image/vnd.dece.graphic" },
+    { "csv", @"text/csv" },
+    { "gtar", @"application/x-gtar" },
+    { "uvd", @"application/vnd.dece.data" },
+    { "aam", @"application/x-authorware-map" },
+    { "icc", @"application/vnd.iccprofile" },
+    { "abw", @"application/x-abiword" },
+    { "123", @"application/vnd.lotus-1-2-3" },
+    { "m3u", @"audio/x-mpegurl" },
+    { "fh4", @"image/x-freehand" },
+    { "icm", @"application/vnd.iccprofile" },
+    { "djvu", @"image/vnd.djvu" },
+    { "grv", @"application/vnd.groove-injector" },
+    { "svg", @"image/svg+xml" },
+    { "pgp", @"application/pgp-encrypted" },
+    { "uvx", @"application/vnd.dece.unspecified" },
+    { "pre", @"application/vnd.lotus-freelance" },
+    { "m4u", @"video/vnd.mpegurl" },
+    { "iso", @"application/x-iso9660-image" },
+    { "prf", @"application/pics-rules" },
+    { "uvu", @"video/vnd.uvvu.mp4" },
+    { "odft", @"application/vnd.oasis.opendocument.formula-template" },
+    { "rm", @"application/vnd.rn-realmedia" },
+    { "uvp", @"video/vnd.dece.pd" },
+    { "rld", @"application/resource-lists-diff+xml" },
+    { "wmls", @"text/vnd.wap.wmlscript" },
+    { "uvs", @"video/vnd.dece.sd" },
+    { "rs", @"application/rls-services+xml" },
+    { "rl", @"application/resource-lists+xml" },
+    { "gxt", @"application/vnd.geonext" },
+    { "mods", @"application/mods+xml" },
+    { "wgt", @"application/widget" },
+    { "uvvf", @"application/vnd.dece.data" },
+    { "svd", @"application/vnd.svd" },
+    { "plf", @"application/vnd.pocketlearn" },
+    { "fcs", @"application/vnd.isac.fcs" },
+    { "aifc", @"audio/x-aiff" },
+    { "cxx", @"text/x-c" },
+    { "portpkg", @"application/vnd.macports.portpkg" },
+    { "trm", @"application/x-msterminal" },
+    { "mpp", @"application/vnd.ms-project" },
+    { "mmf", @"application/vnd.smaf" },
+    { "lvp", @"audio/vnd.lucent.voice" },
+    { "lottiesticker", @"text/x-signal-sticker-lottie" },
+    { "flo", @"application/vnd.micrografx.flo" },
+    { "m3u8", @"application/vnd.apple.mpegurl" },
+    { "zmm", @"application/vnd.handheld-entertainment+xml" },
+    { "seed", @"application/vnd.fdsn.seed" },
+    { "ms", @"text/troff" },
+    { "xm", @"audio/xm" },
+    { "rtf", @"application/rtf" },
+    { "xo", @"application/vnd.olpc-sugar" },
+    { "oa2", @"application/vnd.fujitsu.oasys2" },
+    { "pls", @"application/pls+xml" },
+    { "oa3", @"application/vnd.fujitsu.oasys3" },
+    { "mny", @"application/x-msmoney" },
+    { "ulx", @"application/x-glulx" },
+    { "cxt", @"application/x-director" },
+    { "eva", @"application/x-eva" },
+    { "fh5", @"image/x-freehand" },
+    { "lnk", @"application/x-ms-shortcut" },
+    { "car", @"application/vnd.curl.car" },
+    { "jpe", @"image/jpeg" },
+    { "bmp", @"image/bmp" },
+    { "epub", @"application/epub+zip" },
+    { "dic", @"text/x-c" },
+    { "mts", @"model/vnd.mts" },
+    { "cat", @"application/vnd.ms-pki.seccat" },
+    { "xap", @"application/x-silverlight-app" },
+    { "uris", @"text/uri-list" },
+    { "xar", @"application/vnd.xara" },
+    { "z5", @"application/x-zmachine" },
+    { "otp", @"application/vnd.oasis.opendocument.presentation-template" },
+    { "aw", @"application/applixware" },
+    { "caf", @"audio/x-caf" },
+    { "djv", @"image/vnd.djvu" },
+    { "knp", @"application/vnd.kinar" },
+    { "cu", @"application/cu-seeme" },
+    { "mpc", @"application/vnd.mophun.certificate" },
+    { "xfdf", @"application/vnd.adobe.xfdf" },
+    { "kar", @"audio/midi" },
+    { "flw", @"application/vnd.kde.kivio" },
+    { "sh", @"application/x-sh" },
+    { "bh2", @"application/vnd.fujitsu.oasysprs" },
+    { "sgml", @"text/sgml" },
+    { "mpy", @"application/vnd.ibm.minipay" },
+    { "mp4s", @"application/mp4" },
+    { "dssc", @"application/dssc+der" },
+    { "x3dv", @"model/x3d+vrml" },
+    { "dart", @"application/vnd.dart" },
+    { "spx", @"audio/ogg" },
+    { "xdf", @"application/xcap-diff+xml" },
+    { "link66", @"application/vnd.route66.link66+xml" },
+    { "x3dz", @"model/x3d+xml" },
+    { "hpid", @"application/vnd.hp-hpid" },
+    { "x3db", @"model/x3d+binary" },
+    { "der", @"application/x-x509-ca-cert" },
+    { "webm", @"video/webm" },
+    { "rmvb", @"application/vnd.rn-realmedia-vbr" },
+    { "qfx", @"application/vnd.intu.qfx" },
+    { "igl", @"application/vnd.igloader" },
+    { "p10", @"application/pkcs10" },
+    { "webp", @"image/webp" },
+    { "eol", @"audio/vnd.digital-winds" },
+    { "docx", @"application/vnd.openxmlformats-officedocument.wordprocessingml.document" },
+    { "mng", @"video/x-mng" },
+    { "tao", @"application/vnd.tao.intent-module-archive" },
+    { "fli", @"video/x-fli" },
+    { "pcurl", @"application/vnd.curl.pcurl" },
+    { "log", @"text/plain" },
+    { "xvm", @"application/xv+xml" },
+    { "p7r", @"application/x-pkcs7-certreqresp" },
+    { "igx", @"application/vnd.micrografx.igx" },
+    { "s3m", @"audio/s3m" },
+    { "cod", @"application/vnd.rim.cod" },
+    { "tcap", @"application/vnd.3gpp2.tcap" },
+    { "tif", @"image/tiff" },
+    { "igs", @"model/iges" },
+    { "oas", @"application/vnd.fujitsu.oasys" },
+    { "atomcat", @"application/atomcat+xml" },
+    { "gif", @"image/gif" },
+    { "xpr", @"application/vnd.is-xpr" },
+    { "mqy", @"application/vnd.mobius.mqy" },
+    { "man", @"text/troff" },
+    { "umj", @"application/vnd.umajin" },
+    { "ipfix", @"application/ipfix" },
+    { "sig", @"application/pgp-signature" },
+    { "tsd", @"application/timestamped-data" },
+    { "ngdat", @"application/vnd.nokia.n-gage.data" },
+    { "org", @"application/vnd.lotus-organizer" },
+    { "pfx", @"application/x-pkcs12" },
+    { "cryptonote", @"application/vnd.rig.cryptonote" },
+    { "h", @"text/x-c" },
+    { "qt", @"video/quicktime" },
+    { "mag", @"application/vnd.ecowin.chart" },
+    { "tga", @"image/x-tga" },
+    { "doc", @"application/msword" },
+    { "gmx", @"application/vnd.gmx" },
+    { "ink", @"application/inkml+xml" },
+    { "mgz", @"application/vnd.proteus.magazine" },
+    { "pfr", @"application/font-tdpfr" },
+    { "lasxml", @"application/vnd.las.las+xml" },
+    { "mar", @"application/octet-stream" },
+    { "rtx", @"text/richtext" },
+    { "clp", @"application/x-msclip" },
+    { "txt", @"text/plain" },
+    { "mxf", @"application/mxf" },
+    { "nsf", @"application/vnd.lotus-notes" },
+    { "nsc", @"application/x-conference" },
+    { "docm", @"application/vnd.ms-word.document.macroenabled.12" },
+    { "std", @"application/vnd.sun.xml.draw.template" },
+    { "pfm", @"application/x-font-type1" },
+    { "stf", @"application/vnd.wt.stf" },
+    { "vob", @"video/x-ms-vob" },
+    { "gml", @"application/gml+xml" },
+    { "pfa", @"application/x-font-type1" },
+    { "cfs", @"application/x-cfs-compressed" },
+    { "rar", @"application/x-rar-compressed" },
+    { "pic", @"image/x-pict" },
+    { "dts", @"audio/vnd.dts" },
+    { "nnw", @"application/vnd.noblenet-web" },
+    { "skp", @"application/vnd.koan" },
+    { "xer", @"application/patch-ops-error+xml" },
+    { "blb", @"application/x-blorb" },
+    { "wpd", @"application/vnd.wordperfect" },
+    { "xaml", @"application/xaml+xml" },
+    { "mov", @"video/quicktime" },
+    { "xla", @"application/vnd.ms-excel" },
+    { "flx", @"text/vnd.fmi.flexstor" },
+    { "oda", @"application/oda" },
+    { "onetoc2", @"application/onenote" },
+    { "mpg4", @"video/mp4" },
+    { "azs", @"application/vnd.airzip.filesecure.azs" },
+    { "gtm", @"application/vnd.groove-tool-message" },
+    { "karbon", @"application/vnd.kde.karbon" },
+    { "apk", @"application/vnd.android.package-archive" },
+    { "shf", @"application/shf+xml" },
+    { "cii", @"application/vnd.anser-web-certificate-issue-initiation" },
+    { "qxl", @"application/vnd.quark.quarkxpress" },
+    { "twds", @"application/vnd.simtech-mindmapper" },
+    { "xls", @"application/vnd.ms-excel" },
+    { "nc", @"application/x-netcdf" },
+    { "dtd", @"application/xml-dtd" },
+    { "ttl", @"text/turtle" },
+    { "rgb", @"image/x-rgb" },
+    { "apr", @"application/vnd.lotus-approach" },
+    { "dna", @"application/vnd.dna" },
+    { "mrc", @"application/marc" },
+    { "skm", @"application/vnd.koan" },
+    { "xlt", @"application/vnd.ms-excel" },
+    { "dtb", @"application/x-dtbook+xml" },
+    { "qxd", @"application/vnd.quark.quarkxpress" },
+    { "ppam", @"application/vnd.ms-powerpoint.addin.macroenabled.12" },
+    { "sxi", @"application/vnd.sun.xml.impress" },
+    { "ecelp9600", @"audio/vnd.nuera.ecelp9600" },
+    { "uri", @"text/uri-list" },
+    { "gramps", @"application/x-gramps-xml" },
+    { "qxb", @"application/vnd.quark.quarkxpress" },
+    { "jlt", @"application/vnd.hp-jlyt" },
+    { "maker", @"application/vnd.framemaker" },
+    { "odt", @"application/vnd.oasis.opendocument.text" },
+    { "npx", @"image/vnd.net-fpx" },
+    { "sxc", @"application/vnd.sun.xml.calc" },
+    { "list", @"text/plain" },
+    { "csh", @"application/x-csh" },
+    { "fvt", @"video/vnd.fvt" },
+    { "lrf", @"application/octet-stream" },
+    { "dataless", @"application/vnd.fdsn.seed" },
+    { "xlsb", @"application/vnd.ms-excel.sheet.binary.macroenabled.12" },
+    { "sisx", @"application/vnd.symbian.install" },
+    { "book", @"application/vnd.framemaker" },
+    { "mp2a", @"audio/mpeg" },
+    { "rsd", @"application/rsd+xml" },
+    { "xlsm", @"application/vnd.ms-excel.sheet.macroenabled.12" },
+    { "etx", @"text/x-setext" },
+};
+
+#pragma mark -
+
+static const OWSMIMETypeTableDescriptor kOWSMIMETypeTables[] = {
+    [OWSMIMETypeTableSupportedVideoMIMETypes] = { kSupportedVideoMIMETypesSeeds, kSupportedVideoMIMETypesEntries, 6 },
+    [OWSMIMETypeTableSupportedAudioMIMETypes] = { kSupportedAudioMIMETypesSeeds, kSupportedAudioMIMETypesEntries, 17 },
+    [OWSMIMETypeTableSupportedImageMIMETypes] = { kSupportedImageMIMETypesSeeds, kSupportedImageMIMETypesEntries, 10 },
+    [OWSMIMETypeTableSupportedBinaryDataMIMETypes] = { kSupportedBinaryDataMIMETypesSeeds, kSupportedBinaryDataMIMETypesEntries, 1 },
+    [OWSMIMETypeTableSupportedVideoExtensions] = { kSupportedVideoExtensionsSeeds, kSupportedVideoExtensionsEntries, 10 },
+    [OWSMIMETypeTableSupportedAudioExtensions] = { kSupportedAudioExtensionsSeeds, kSupportedAudioExtensionsEntries, 16 },
+    [OWSMIMETypeTableSupportedImageExtensions] = { kSupportedImageExtensionsSeeds, kSupportedImageExtensionsEntries, 12 },
+    [OWSMIMETypeTableGenericMIMETypes] = { kGenericMIMETypesSeeds, kGenericMIMETypesEntries, 1060 },
+    [OWSMIMETypeTableGenericExtensions] = { kGenericExtensionsSeeds, kGenericExtensionsEntries, 985 },
+};
+
+static uint32_t OWSMIMETypeTableHash(uint32_t seed, const char *key)
+{
+    uint32_t hash = (seed != 0 ? seed : 0x01000193);
+    for (const char *c = key; *c != '\0'; c++) {
+        hash = (hash * 0x01000193) ^ (uint8_t)*c;
+    }
+    return hash;
+}
+
+NSString *_Nullable OWSMIMETypeTableLookup(OWSMIMETypeTable table, NSString *key)
+{
+    if (table >= sizeof(kOWSMIMETypeTables) / sizeof(kOWSMIMETypeTables[0])) {
+        OWSCFailDebug(@"Unknown table: %lu", (unsigned long)table);
+        return nil;
+    }
+    const OWSMIMETypeTableDescriptor *descriptor = &kOWSMIMETypeTables[table];
+
+    // Keys longer than the longest key in any table cannot match.
+    char buffer[kOWSMIMETypeTableMaxKeyLength + 1];
+    if (![key getCString:buffer maxLength:sizeof(buffer) encoding:NSUTF8StringEncoding]) {
+        return nil;
+    }
+
+    int32_t seed = descriptor->seeds[OWSMIMETypeTableHash(0, buffer) % descriptor->count];
+    uint32_t slot
+        = (seed < 0 ? (uint32_t)(-seed - 1) : OWSMIMETypeTableHash((uint32_t)seed, buffer) % descriptor->count);
+    const OWSMIMETypeTableEntry *entry = &descriptor->entries[slot];
+    if (strcmp(entry->key, buffer) != 0) {
+        return nil;
+    }
+    return entry->value;
+}
+
+NSArray<NSString *> *OWSMIMETypeTableAllKeys(OWSMIMETypeTable table)
+{
+    if (table >= sizeof(kOWSMIMETypeTables) / sizeof(kOWSMIMETypeTables[0])) {
+        OWSCFailDebug(@"Unknown table: %lu", (unsigned long)table);
+        return @[];
+    }
+    const OWSMIMETypeTableDescriptor *descriptor = &kOWSMIMETypeTables[table];
+
+    NSMutableArray<NSString *> *keys = [NSMutableArray arrayWithCapacity:descriptor->count];
+    for (uint32_t i = 0; i < descriptor->count; i++) {
+        [keys addObject:@(descriptor->entries[i].key)];
+    }
+    return [keys copy];
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,183 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Watches for hangs: stalls of the main thread.
+///
+/// A background thread pings the main queue every pingInterval. If the
+/// main thread doesn't respond within hangThreshold, the main thread's
+/// stack is sampled (see OWSThreadStackSampler) and, once it responds,
+/// the hang is logged with its duration.
+///
+/// Hangs are aggregated by stack. A stack is logged, unsymbolicated, the
+/// first time there's a hang with it; later hangs with the same stack just
+/// refer to it. A summary is logged whenever the app enters the background.
+///
+/// We only watch while the app is in the foreground, since the watchdog
+/// would mistake the app being suspended for a hang.
+@objc
+public class MainThreadHangMonitor: NSObject {
+
+    @objc
+    public static let shared = MainThreadHangMonitor()
+
+    // Apple considers a main thread stall of 250ms or more a hang.
+    private static let hangThreshold: TimeInterval = 0.25
+    private static let pingInterval: TimeInterval = 0.2
+    private static let maxStackDepth: UInt = 64
+    private static let maxStackCount = 50
+
+    private struct HangStack {
+        let stackId: Int
+        var hangCount: UInt = 0
+        var totalDuration: TimeInterval = 0
+        var maxDuration: TimeInterval = 0
+    }
+
+    private let isStarted = AtomicBool(false)
+    private let isInForeground = AtomicBool(false)
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var hangStacks = [[NSNumber]: HangStack]()
+    private var hangCount: UInt = 0
+    private var hangDuration: TimeInterval = 0
+
+    private override init() {
+        super.init()
+    }
+
+    /// This should be called on the main thread.
+    @objc
+    public func start() {
+        AssertIsOnMainThread()
+
+        guard !CurrentAppContext().isRunningTests else {
+            return
+        }
+        guard isStarted.tryToSetFlag() else {
+            owsFailDebug("Already started.")
+            return
+        }
+
+        OWSThreadStackSampler.prepareToSampleMainThread()
+
+        isInForeground.set(!CurrentAppContext().isInBackground())
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(applicationWillEnterForeground),
+                                               name: .OWSApplicationWillEnterForeground,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(applicationDidEnterBackground),
+                                               name: .OWSApplicationDidEnterBackground,
+                                               object: nil)
+
+        let thread = Thread { [weak self] in
+            self?.watch()
+        }
+        thread.name = "MainThreadHangMonitor"
+        // The watchdog should keep running while the app is busy.
+        thread.qualityOfService = .userInteractive
+        thread.start()
+    }
+
+    @objc
+    private func applicationWillEnterForeground() {
+        AssertIsOnMainThread()
+
+        isInForeground.set(true)
+    }
+
+    @objc
+    private func applicationDidEnterBackground() {
+        AssertIsOnMainThread()
+
+        isInForeground.set(false)
+        logSummary()
+    }
+
+    // MARK: - Watchdog
+
+    private func watch() {
+        while true {
+            Thread.sleep(forTimeInterval: Self.pingInterval)
+
+            guard isInForeground.get() else {
+                continue
+            }
+
+            let pingTime = CACurrentMediaTime()
+            let pong = DispatchSemaphore(value: 0)
+            DispatchQueue.main.async {
+                pong.signal()
+            }
+            guard pong.wait(timeout: .now() + Self.hangThreshold) == .timedOut else {
+                continue
+            }
+
+            // The main thread is blocked.
+            let stack = OWSThreadStackSampler.sampleMainThreadReturnAddresses(withMaxDepth: Self.maxStackDepth)
+            pong.wait()
+            let duration = CACurrentMediaTime() - pingTime
+
+            // If the app was suspended during the "hang", it wasn't one.
+            guard isInForeground.get() else {
+                continue
+            }
+            didHang(duration: duration, stack: stack ?? [])
+        }
+    }
+
+    private func didHang(duration: TimeInterval, stack: [NSNumber]) {
+        let (hangStack, isNewStack): (HangStack?, Bool) = unfairLock.withLock {
+            hangCount += 1
+            hangDuration += duration
+
+            let existingHangStack = hangStacks[stack]
+            guard existingHangStack != nil || hangStacks.count < Self.maxStackCount else {
+                return (nil, false)
+            }
+            var hangStack = existingHangStack ?? HangStack(stackId: hangStacks.count + 1)
+            hangStack.hangCount += 1
+            hangStack.totalDuration += duration
+            hangStack.maxDuration = max(hangStack.maxDuration, duration)
+            hangStacks[stack] = hangStack
+            return (hangStack, existingHangStack == nil)
+        }
+
+        guard let stackId = hangStack?.stackId else {
+            Logger.warn(String(format: "Main thread hang: %0.0fms.", duration * 1000))
+            return
+        }
+        Logger.warn(String(format: "Main thread hang: %0.0fms, stack #%ld.", duration * 1000, stackId))
+        if isNewStack {
+            let frames = stack.enumerated().map { index, returnAddress in
+                "\(index) " + OWSThreadStackSampler.describeReturnAddress(returnAddress.uintValue)
+            }
+            Logger.warn("Main thread hang stack #\(stackId):\n" + frames.joined(separator: "\n"))
+        }
+    }
+
+    private func logSummary() {
+        let summary: String? = unfairLock.withLock {
+            guard hangCount > 0 else {
+                return nil
+            }
+            var lines = [String(format: "%lu main thread hangs, %0.0fms in total.", hangCount, hangDuration * 1000)]
+            let worstHangStacks = hangStacks.values.sorted { $0.totalDuration > $1.totalDuration }.prefix(5)
+            for hangStack in worstHangStacks {
+                lines.append(String(format: "Stack #%ld: %lu hangs, %0.0fms in total, max %0.0fms.",
+                                    hangStack.stackId,
+                                    hangStack.hangCount,
+                                    hangStack.totalDuration * 1000,
+                                    hangStack.maxDuration * 1000))
+            }
+            return lines.joined(separator: "\n")
+        }
+        if let summary = summary {
+            Logger.info(summary)
+        }
+    }
+}
@@ -0,0 +1,242 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Something that holds memory it can rebuild, e.g. a cache.
+///
+/// estimatedByteCount may be accessed on any thread. shedMemory() is only
+/// called on the main thread.
+public protocol MemoryAccountable: AnyObject {
+    /// The estimated number of bytes held by the receiver.
+    var estimatedByteCount: Int { get }
+
+    /// Releases as much memory as possible.
+    func shedMemory()
+}
+
+// MARK: -
+
+/// The order in which accounts shed their memory under pressure.
+public enum MemorySheddingPriority: Int, Comparable {
+    // Cheap to rebuild; shed on any memory pressure.
+    case first
+    case normal
+    // Expensive to rebuild; only shed under critical memory pressure.
+    case last
+
+    public static func < (lhs: MemorySheddingPriority, rhs: MemorySheddingPriority) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+// MARK: -
+
+/// Correlates the process' memory footprint with the memory held by each
+/// registered subsystem, so that we can tell what was using the memory when
+/// a process (especially the NSE, with its small memory limit) gets jetsammed.
+///
+/// Snapshots are logged whenever the footprint has grown noticeably since
+/// the last one, and on memory pressure. Under memory pressure, accounts shed
+/// their memory in priority order.
+@objc
+public class MemoryAccountant: NSObject {
+
+    @objc
+    public static let shared = MemoryAccountant()
+
+    private static let samplingInterval: TimeInterval = 10
+    // Log a snapshot whenever the footprint has grown by this much.
+    private static let footprintGrowthToLog: UInt64 = 1024 * 1024
+
+    private struct Account {
+        let name: String
+        let sheddingPriority: MemorySheddingPriority
+        weak var accountable: MemoryAccountable?
+    }
+
+    public struct AccountSnapshot {
+        public let name: String
+        public let byteCount: Int
+    }
+
+    public struct Snapshot {
+        public let date: Date
+        /// The process' physical memory footprint, as used by jetsam.
+        public let memoryFootprint: UInt64?
+        /// Sorted by byteCount, largest first.
+        public let accounts: [AccountSnapshot]
+
+        public var accountedByteCount: Int {
+            accounts.reduce(0) { $0 + $1.byteCount }
+        }
+
+        public var logDescription: String {
+            let footprint = memoryFootprint.map { Self.format(byteCount: Int($0)) } ?? "unknown"
+            var lines = ["Memory footprint: \(footprint), accounted: \(Self.format(byteCount: accountedByteCount))."]
+            for account in accounts where account.byteCount > 0 {
+                lines.append("  \(account.name): \(Self.format(byteCount: account.byteCount))")
+            }
+            return lines.joined(separator: "\n")
+        }
+
+        private static let byteCountFormatter: ByteCountFormatter = {
+            let formatter = ByteCountFormatter()
+            formatter.countStyle = .memory
+            return formatter
+        }()
+
+        public static func format(byteCount: Int) -> String {
+            byteCountFormatter.string(fromByteCount: Int64(byteCount))
+        }
+    }
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var accounts = [Account]()
+
+    private let isStarted = AtomicBool(false)
+    private let serialQueue = DispatchQueue(label: "MemoryAccountant")
+
+    // The properties below should only be accessed on serialQueue.
+    private var samplingTimer: DispatchSourceTimer?
+    private var lastLoggedFootprint: UInt64 = 0
+
+    // This property should only be accessed on the main thread.
+    private var memoryPressureSource: DispatchSourceMemoryPressure?
+
+    private override init() {
+        super.init()
+    }
+
+    // MARK: - Accounts
+
+    /// Accounts are held weakly, and dropped once they are deallocated.
+    public func register(_ accountable: MemoryAccountable,
+                         name: String,
+                         sheddingPriority: MemorySheddingPriority = .normal) {
+        unfairLock.withLock {
+            accounts = accounts.filter { $0.accountable != nil }
+            accounts.append(Account(name: name, sheddingPriority: sheddingPriority, accountable: accountable))
+        }
+    }
+
+    public func snapshot() -> Snapshot {
+        let accounts = unfairLock.withLock { self.accounts }
+        let accountSnapshots = accounts.compactMap { account -> AccountSnapshot? in
+            guard let accountable = account.accountable else {
+                return nil
+            }
+            return AccountSnapshot(name: account.name, byteCount: accountable.estimatedByteCount)
+        }
+        return Snapshot(date: Date(),
+                        memoryFootprint: Self.physicalMemoryFootprint(),
+                        accounts: accountSnapshots.sorted { $0.byteCount > $1.byteCount })
+    }
+
+    /// Sheds the memory of every account with the given priority or a
+    /// higher one, in priority order.
+    public func shedMemory(through sheddingPriority: MemorySheddingPriority) {
+        AssertIsOnMainThread()
+
+        let accounts = unfairLock.withLock { self.accounts }
+        let accountsToShed = accounts.filter { $0.sheddingPriority <= sheddingPriority }
+        for account in accountsToShed.sorted(by: { $0.sheddingPriority < $1.sheddingPriority }) {
+            account.accountable?.shedMemory()
+        }
+    }
+
+    /// Sheds memory as we would for a memory pressure event.
+    @objc
+    public func shedMemory(isCritical: Bool) {
+        shedMemory(through: isCritical ? .last : .first)
+    }
+
+    // MARK: - Monitoring
+
+    @objc
+    public func start() {
+        AssertIsOnMainThread()
+
+        guard !CurrentAppContext().isRunningTests else {
+            return
+        }
+        guard isStarted.tryToSetFlag() else {
+            owsFailDebug("Already started.")
+            return
+        }
+
+        let memoryPressureSource = DispatchSource.makeMemoryPressureSource(eventMask: [.warning, .critical],
+                                                                           queue: .main)
+        memoryPressureSource.setEventHandler { [weak self] in
+            guard let self = self, let memoryPressureSource = self.memoryPressureSource else {
+                return
+            }
+            self.didReceiveMemoryPressure(isCritical: memoryPressureSource.data.contains(.critical))
+        }
+        memoryPressureSource.resume()
+        self.memoryPressureSource = memoryPressureSource
+
+        serialQueue.async {
+            let samplingTimer = DispatchSource.makeTimerSource(queue: self.serialQueue)
+            samplingTimer.schedule(deadline: .now(), repeating: Self.samplingInterval, leeway: .seconds(1))
+            samplingTimer.setEventHandler { [weak self] in
+                self?.sample()
+            }
+            samplingTimer.resume()
+            self.samplingTimer = samplingTimer
+        }
+    }
+
+    private func sample() {
+        assertOnQueue(serialQueue)
+
+        guard let memoryFootprint = Self.physicalMemoryFootprint(),
+              memoryFootprint >= lastLoggedFootprint + Self.footprintGrowthToLog else {
+            return
+        }
+        lastLoggedFootprint = memoryFootprint
+        Logger.info(snapshot().logDescription)
+    }
+
+    private func didReceiveMemoryPressure(isCritical: Bool) {
+        AssertIsOnMainThread()
+
+        Logger.warn("Memory pressure; isCritical: \(isCritical).\n\(snapshot().logDescription)")
+
+        shedMemory(isCritical: isCritical)
+
+        Logger.info("After shedding memory:\n\(snapshot().logDescription)")
+        serialQueue.async {
+            // Log the next snapshot once the footprint grows again.
+            self.lastLoggedFootprint = Self.physicalMemoryFootprint() ?? 0
+        }
+    }
+
+    public static func physicalMemoryFootprint() -> UInt64? {
+        taskVMInfo()?.phys_footprint
+    }
+
+    /// The largest footprint the process has reached, which is what
+    /// matters for jetsam limits.
+    public static func peakPhysicalMemoryFootprint() -> UInt64? {
+        taskVMInfo()?.ledger_phys_footprint_peak
+    }
+
+    private static func taskVMInfo() -> task_vm_info_data_t? {
+        var info = task_vm_info_data_t()
+        let TASK_VM_INFO_COUNT = MemoryLayout<task_vm_info_data_t>.stride / MemoryLayout<natural_t>.stride
+        var count = mach_msg_type_number_t(TASK_VM_INFO_COUNT)
+        let kerr: kern_return_t = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: TASK_VM_INFO_COUNT) {
+                task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), $0, &count)
+            }
+        }
+        guard kerr == KERN_SUCCESS else {
+            Logger.warn("task_info() failed: \(kerr)")
+            return nil
+        }
+        return info
+    }
+}
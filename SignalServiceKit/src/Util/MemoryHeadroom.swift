@@ -0,0 +1,68 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import os
+
+@objc
+public enum MemoryHeadroomLevel: Int {
+    case ample
+    // We should do less at a time and shed what memory we can.
+    case low
+    // We risk being jetsammed if we do any more work.
+    case exhausted
+}
+
+// MARK: -
+
+/// Reports how much memory the process can still allocate before it hits its
+/// jetsam limit, which is tight in app extensions (24 MB in the NSE).
+///
+/// Message processing consults this so that the NSE can shrink its batches
+/// as headroom drops and stop before it runs out, leaving the rest of the
+/// backlog to the main app.
+@objc
+public class MemoryHeadroom: NSObject {
+
+    @objc
+    public static let lowThreshold: UInt64 = 8 * 1024 * 1024
+
+    @objc
+    public static let exhaustedThreshold: UInt64 = 3 * 1024 * 1024
+
+    private override init() {
+        super.init()
+    }
+
+    /// The remaining headroom in bytes, or UInt64.max if it is unknown
+    /// (before iOS 13, or where the process has no memory limit).
+    @objc
+    public static var availableMemory: UInt64 {
+        guard #available(iOS 13, *) else {
+            return UInt64.max
+        }
+        let availableMemory = os_proc_available_memory()
+        // Zero indicates that the process has no limit, e.g. in the simulator.
+        guard availableMemory > 0 else {
+            return UInt64.max
+        }
+        return UInt64(availableMemory)
+    }
+
+    @objc
+    public static var level: MemoryHeadroomLevel {
+        level(availableMemory: availableMemory)
+    }
+
+    @objc
+    public static func level(availableMemory: UInt64) -> MemoryHeadroomLevel {
+        if availableMemory < exhaustedThreshold {
+            return .exhausted
+        } else if availableMemory < lowThreshold {
+            return .low
+        } else {
+            return .ample
+        }
+    }
+}
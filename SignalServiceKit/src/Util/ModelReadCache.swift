@@ -4,52 +4,106 @@
 
 import Foundation
 
-#if TESTABLE_BUILD
-protocol ModelCache {
-    var logName: String { get }
-}
+/// The hit rate and memory use of a model read cache.
+public class ModelReadCacheStats {
+    static let shouldLogCacheStats = false
 
-// MARK: -
+    public let cacheName: String
 
-private struct ModelReadCacheStats {
-    static let shouldLogCacheStats = false
+    /// The cost, in bytes, at which the cache starts evicting.
+    public let costLimit: Int
+
+    private let cacheHitCount = AtomicUInt()
+    private let cacheReadCount = AtomicUInt()
+    private let cachedCost = AtomicValue<Int>(0)
+
+    fileprivate init(cacheName: String, costLimit: Int) {
+        self.cacheName = cacheName
+        self.costLimit = costLimit
+    }
+
+    public var hitCount: UInt { cacheHitCount.get() }
+
+    public var readCount: UInt { cacheReadCount.get() }
 
-    let cacheHitCount = AtomicUInt()
-    let cacheReadCount = AtomicUInt()
+    public var hitRate: Double? {
+        let readCount = self.readCount
+        guard readCount > 0 else {
+            return nil
+        }
+        return Double(hitCount) / Double(readCount)
+    }
 
-    func recordCacheHit(_ cache: ModelCache) {
+    /// The estimated size, in bytes, of the values in the cache;
+    /// see ModelCacheAdapter.cost(forValue:).
+    public var cost: Int { cachedCost.get() }
+
+    fileprivate func recordCacheHit() {
         let hitCount = cacheHitCount.increment()
         let totalCount = cacheReadCount.increment()
-        logStats(hitCount: hitCount, totalCount: totalCount, cache: cache)
+        logStats(hitCount: hitCount, totalCount: totalCount)
     }
 
-    func recordCacheMiss(_ cache: ModelCache) {
+    fileprivate func recordCacheMiss() {
         let hitCount = cacheHitCount.get()
         let totalCount = cacheReadCount.increment()
-        logStats(hitCount: hitCount, totalCount: totalCount, cache: cache)
+        logStats(hitCount: hitCount, totalCount: totalCount)
+    }
+
+    fileprivate func didAddValue(cost: Int) {
+        _ = cachedCost.map { $0 + cost }
+    }
+
+    fileprivate func didReleaseValue(cost: Int) {
+        _ = cachedCost.map { $0 - cost }
     }
 
-    private func logStats(hitCount: UInt, totalCount: UInt, cache: ModelCache) {
+    private func logStats(hitCount: UInt, totalCount: UInt) {
+        #if TESTABLE_BUILD
         if Self.shouldLogCacheStats, totalCount > 0, totalCount % 100 == 0 {
             let percentage = 100 * Double(hitCount) / Double(totalCount)
-            Logger.verbose("---- \(cache.logName): \(percentage)% \(totalCount)")
+            Logger.verbose("---- \(cacheName): \(percentage)% \(totalCount)")
         }
+        #endif
     }
 }
-#endif
 
 // MARK: -
 
+// NSCache doesn't report its total cost, so each box accounts for its
+// own cost while it is alive. Boxes are only retained by the cache and,
+// briefly, by reads.
 private class ModelCacheValueBox<ValueType: BaseModel> {
     let value: ValueType?
+    private let cost: Int
+    private let cacheStats: ModelReadCacheStats
 
-    init(value: ValueType?) {
+    init(value: ValueType?, cost: Int, cacheStats: ModelReadCacheStats) {
         self.value = value
+        self.cost = cost
+        self.cacheStats = cacheStats
+
+        cacheStats.didAddValue(cost: cost)
+    }
+
+    deinit {
+        cacheStats.didReleaseValue(cost: cost)
     }
 }
 
 // MARK: -
 
+// The order in which caches are evacuated in response to memory warnings.
+private enum ModelCacheEvictionTier {
+    // Evacuated on every memory warning, e.g. caches of large models
+    // that are cheap to re-read.
+    case first
+    // Only evacuated if memory warnings continue.
+    case last
+}
+
+// MARK: -
+
 private struct ModelCacheKey<KeyType: AnyObject> {
     let key: KeyType
 }
@@ -82,10 +136,26 @@ private class ModelCacheAdapter<KeyType: AnyObject & Hashable, ValueType: BaseMo
         notImplemented()
     }
 
+    // A rough estimate of the value's size in memory, in bytes.
+    // Subclasses should override this if their models can be large.
+    func cost(forValue value: ValueType) -> Int {
+        Self.baseModelCost
+    }
+
+    static var baseModelCost: Int { 1024 }
+
     let cacheName: String
 
-    init(cacheName: String) {
+    // The fraction of ModelReadCaches.totalCostLimit this cache's
+    // models can use. The fractions of all caches should sum to 1.
+    let budgetFraction: Double
+
+    let evictionTier: ModelCacheEvictionTier
+
+    init(cacheName: String, budgetFraction: Double, evictionTier: ModelCacheEvictionTier) {
         self.cacheName = cacheName
+        self.budgetFraction = budgetFraction
+        self.evictionTier = evictionTier
     }
 }
 
@@ -133,16 +203,15 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
         return "\(cacheName) \(mode)"
     }
 
-    #if TESTABLE_BUILD
-    let cacheStats = ModelReadCacheStats()
-    #endif
+    let cacheStats: ModelReadCacheStats
 
-    // TODO: We could tune the size of this cache.
-    //       NSCache's default behavior is opaque.
-    //       We're currently only using this to cache
-    //       small models, but that could change.
+    // NSCache evicts once the total cost of its values exceeds its
+    // totalCostLimit; see ModelCacheAdapter.cost(forValue:).
     fileprivate let nsCache = NSCache<KeyType, ModelCacheValueBox<ValueType>>()
 
+    // Caching that a model doesn't exist is cheap.
+    private static var nilValueCost: Int { 64 }
+
     private let adapter: ModelCacheAdapter<KeyType, ValueType>
 
     private var isCacheReady: Bool {
@@ -160,6 +229,19 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
         self.mode = mode
         self.adapter = adapter
 
+        // Each cache has a .uiRead and a .read mode, which share its budget.
+        let costLimit = Int(Double(ModelReadCaches.totalCostLimit) * adapter.budgetFraction / 2)
+        self.cacheStats = ModelReadCacheStats(cacheName: "\(adapter.cacheName) \(mode)", costLimit: costLimit)
+        nsCache.totalCostLimit = costLimit
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveMemoryWarning),
+                                               name: ModelReadCaches.didReceiveMemoryWarning,
+                                               object: nil)
+        MemoryAccountant.shared.register(self,
+                                         name: "Model cache \(cacheStats.cacheName)",
+                                         sheddingPriority: adapter.evictionTier == .first ? .first : .normal)
+
         switch mode {
         case .read:
             NotificationCenter.default.addObserver(self,
@@ -186,16 +268,52 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
         nsCache.removeAllObjects()
     }
 
+    @objc
+    func didReceiveMemoryWarning(_ notification: Notification) {
+        AssertIsOnMainThread()
+
+        let isRepeatedWarning = (notification.object as? NSNumber)?.boolValue ?? true
+        guard adapter.evictionTier == .first || isRepeatedWarning else {
+            return
+        }
+
+        evacuateCacheOnMainThread()
+    }
+
+    fileprivate func evacuateCacheOnMainThread() {
+        AssertIsOnMainThread()
+
+        switch mode {
+        case .uiRead:
+            evacuateCache()
+        case .read:
+            performSync {
+                evacuateCache()
+            }
+        }
+    }
+
     @objc
     func didReceiveCrossProcessNotification(_ notification: Notification) {
         AssertIsOnMainThread()
         assert(mode == .read)
 
-        evacuateCache()
+        // If we know what the other process changed, we only need to
+        // evacuate the affected models.
+        let crossProcessChanges = notification.object as? CrossProcessDatabaseChanges
+        let evacuate = {
+            if let crossProcessChanges = crossProcessChanges {
+                self.adapter.uiReadEvacuation(databaseChanges: crossProcessChanges, nsCache: self.nsCache)
+            } else {
+                self.evacuateCache()
+            }
+        }
+
+        evacuate()
 
         DispatchQueue.global().async {
             self.performSync {
-                self.evacuateCache()
+                evacuate()
             }
         }
     }
@@ -218,6 +336,7 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
             return value
         }
         if !isExcluded(cacheKey: cacheKey),
+            transaction.canAdmitToModelReadCaches,
             canUseCache(cacheKey: cacheKey, transaction: transaction) {
             // Update cache.
             writeToCache(cacheKey: cacheKey, value: nil)
@@ -226,6 +345,10 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
     }
 
     func didRead(value: ValueType, transaction: SDSAnyReadTransaction) {
+        guard transaction.canAdmitToModelReadCaches else {
+            // Don't let bulk scans displace the models the app is using.
+            return
+        }
         let cacheKey = adapter.cacheKey(forValue: value)
         guard canUseCache(cacheKey: cacheKey, transaction: transaction) else {
             return
@@ -271,9 +394,7 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
         return performSync {
             if let cachedValue = self.cachedValue(for: cacheKey) {
 
-                #if TESTABLE_BUILD
-                cacheStats.recordCacheHit(self)
-                #endif
+                cacheStats.recordCacheHit()
 
                 if let value = cachedValue.value {
                     // Return a copy of the model.
@@ -296,9 +417,7 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
                     return nil
                 }
             } else {
-                #if TESTABLE_BUILD
-                cacheStats.recordCacheMiss(self)
-                #endif
+                cacheStats.recordCacheMiss()
 
                 guard !returnNilOnCacheMiss else {
                     return nil
@@ -422,7 +541,10 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
     // MARK: -
 
     private func writeToCache(cacheKey: ModelCacheKey<KeyType>, value: ValueType?) {
-        nsCache.setObject(ModelCacheValueBox(value: value), forKey: cacheKey.key)
+        let cost = value.map { adapter.cost(forValue: $0) } ?? Self.nilValueCost
+        nsCache.setObject(ModelCacheValueBox(value: value, cost: cost, cacheStats: cacheStats),
+                          forKey: cacheKey.key,
+                          cost: cost)
     }
 
     private func readFromCache(cacheKey: ModelCacheKey<KeyType>) -> ModelCacheValueBox<ValueType>? {
@@ -552,9 +674,13 @@ private class ModelReadCache<KeyType: AnyObject & Hashable, ValueType: BaseModel
 
 // MARK: -
 
-#if TESTABLE_BUILD
-extension ModelReadCache: ModelCache {}
-#endif
+extension ModelReadCache: MemoryAccountable {
+    var estimatedByteCount: Int { cacheStats.cost }
+
+    func shedMemory() {
+        evacuateCacheOnMainThread()
+    }
+}
 
 // MARK: -
 
@@ -576,6 +702,10 @@ private class ModelReadCacheWrapper<KeyType: AnyObject & Hashable, ValueType: Ba
         readCache = ModelReadCache(mode: .read, adapter: adapter)
     }
 
+    var cacheStats: [ModelReadCacheStats] {
+        [uiReadCache.cacheStats, readCache.cacheStats]
+    }
+
     func getValue(for cacheKey: ModelCacheKey<KeyType>, transaction: SDSAnyReadTransaction) -> ValueType? {
         if transaction.isUIRead {
             assert(Thread.isMainThread)
@@ -651,13 +781,17 @@ public class UserProfileReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "UserProfile")
+    private let adapter = Adapter(cacheName: "UserProfile", budgetFraction: 0.1, evictionTier: .first)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc
     public func getUserProfile(address: SignalServiceAddress, transaction: SDSAnyReadTransaction) -> OWSUserProfile? {
         let address = OWSUserProfile.resolve(address)
@@ -699,6 +833,11 @@ public class SignalAccountReadCache: NSObject {
             value.recipientAddress
         }
 
+        override func cost(forValue value: ValueType) -> Int {
+            // Accounts can hold the contact's avatar.
+            Self.baseModelCost + (value.contactAvatarJpegData?.count ?? 0)
+        }
+
         override func cacheKey(forKey key: KeyType) -> ModelCacheKey<KeyType> {
             ModelCacheKey(key: key)
         }
@@ -720,13 +859,17 @@ public class SignalAccountReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "SignalAccount")
+    private let adapter = Adapter(cacheName: "SignalAccount", budgetFraction: 0.15, evictionTier: .first)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc
     public func getSignalAccount(address: SignalServiceAddress, transaction: SDSAnyReadTransaction) -> SignalAccount? {
         let cacheKey = adapter.cacheKey(forKey: address)
@@ -788,13 +931,17 @@ public class SignalRecipientReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "SignalRecipient")
+    private let adapter = Adapter(cacheName: "SignalRecipient", budgetFraction: 0.05, evictionTier: .last)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc(getSignalRecipientForAddress:transaction:)
     public func getSignalRecipient(address: SignalServiceAddress, transaction: SDSAnyReadTransaction) -> SignalRecipient? {
         let cacheKey = adapter.cacheKey(forKey: address)
@@ -853,13 +1000,17 @@ public class ThreadReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "TSThread")
+    private let adapter = Adapter(cacheName: "TSThread", budgetFraction: 0.15, evictionTier: .last)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc(getThreadForUniqueId:transaction:)
     public func getThread(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSThread? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId as NSString)
@@ -909,6 +1060,14 @@ public class InteractionReadCache: NSObject {
             value.uniqueId as NSString
         }
 
+        override func cost(forValue value: ValueType) -> Int {
+            guard let message = value as? TSMessage else {
+                return Self.baseModelCost
+            }
+            // Long text messages can have large bodies.
+            return Self.baseModelCost + (message.body?.utf8.count ?? 0)
+        }
+
         override func cacheKey(forKey key: KeyType) -> ModelCacheKey<KeyType> {
             return ModelCacheKey(key: key)
         }
@@ -927,13 +1086,17 @@ public class InteractionReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "TSInteraction")
+    private let adapter = Adapter(cacheName: "TSInteraction", budgetFraction: 0.3, evictionTier: .last)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc(getInteractionForUniqueId:transaction:)
     public func getInteraction(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSInteraction? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId as NSString)
@@ -1005,19 +1168,32 @@ public class AttachmentReadCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "TSAttachment")
+    private let adapter = Adapter(cacheName: "TSAttachment", budgetFraction: 0.15, evictionTier: .first)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc(getAttachmentForUniqueId:transaction:)
     public func getAttachment(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSAttachment? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId as NSString)
         return cache.getValue(for: cacheKey, transaction: transaction)
     }
 
+    @objc(getAttachmentsIfInCacheForUniqueIds:transaction:)
+    public func getAttachmentsIfInCache(forUniqueIds uniqueIds: [String], transaction: SDSAnyReadTransaction) -> [String: TSAttachment] {
+        let keys: [NSString] = uniqueIds.map { $0 as NSString }
+        let result: [NSString: TSAttachment] = cache.getValuesIfInCache(for: keys, transaction: transaction)
+        return Dictionary(uniqueKeysWithValues: result.map({ (key, value) in
+            return (key as String, value)
+        }))
+    }
+
     @objc(didRemoveAttachment:transaction:)
     public func didRemove(attachment: TSAttachment, transaction: SDSAnyWriteTransaction) {
         cache.didRemove(value: attachment, transaction: transaction)
@@ -1069,13 +1245,17 @@ public class InstalledStickerCache: NSObject {
     }
 
     private let cache: ModelReadCacheWrapper<KeyType, ValueType>
-    private let adapter = Adapter(cacheName: "InstalledSticker")
+    private let adapter = Adapter(cacheName: "InstalledSticker", budgetFraction: 0.05, evictionTier: .first)
 
     @objc
     public override init() {
         cache = ModelReadCacheWrapper(adapter: adapter)
     }
 
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
     @objc(getInstalledStickerForUniqueId:transaction:)
     public func getInstalledSticker(uniqueId: String, transaction: SDSAnyReadTransaction) -> InstalledSticker? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId as NSString)
@@ -1100,6 +1280,78 @@ public class InstalledStickerCache: NSObject {
 
 // MARK: -
 
+// Identities are read for every recipient device on the encrypt and
+// decrypt paths.
+@objc
+public class RecipientIdentityReadCache: NSObject {
+    typealias KeyType = NSString
+    typealias ValueType = OWSRecipientIdentity
+
+    private class Adapter: ModelCacheAdapter<KeyType, ValueType> {
+        override func read(key: KeyType, transaction: SDSAnyReadTransaction) -> ValueType? {
+            return OWSRecipientIdentity.anyFetch(uniqueId: key as String,
+                                                 transaction: transaction,
+                                                 ignoreCache: true)
+        }
+
+        override func key(forValue value: ValueType) -> KeyType {
+            value.uniqueId as NSString
+        }
+
+        override func cacheKey(forKey key: KeyType) -> ModelCacheKey<KeyType> {
+            return ModelCacheKey(key: key)
+        }
+
+        override func copy(value: ValueType) throws -> ValueType {
+            // We don't need to use a deepCopy for OWSRecipientIdentity.
+            guard let modelCopy = value.copy() as? OWSRecipientIdentity else {
+                throw OWSAssertionError("Copy failed.")
+            }
+            return modelCopy
+        }
+
+        override func uiReadEvacuation(databaseChanges: UIDatabaseChanges,
+                                       nsCache: NSCache<KeyType, ModelCacheValueBox<ValueType>>) {
+            if databaseChanges.didUpdateModel(collection: OWSRecipientIdentity.collection()) {
+                nsCache.removeAllObjects()
+            }
+        }
+    }
+
+    private let cache: ModelReadCacheWrapper<KeyType, ValueType>
+    private let adapter = Adapter(cacheName: "OWSRecipientIdentity", budgetFraction: 0.05, evictionTier: .last)
+
+    @objc
+    public override init() {
+        cache = ModelReadCacheWrapper(adapter: adapter)
+    }
+
+    fileprivate var cacheStats: [ModelReadCacheStats] {
+        cache.cacheStats
+    }
+
+    @objc(getRecipientIdentityForUniqueId:transaction:)
+    public func getRecipientIdentity(uniqueId: String, transaction: SDSAnyReadTransaction) -> OWSRecipientIdentity? {
+        let cacheKey = adapter.cacheKey(forKey: uniqueId as NSString)
+        return cache.getValue(for: cacheKey, transaction: transaction)
+    }
+
+    @objc(didRemoveRecipientIdentity:transaction:)
+    public func didRemove(recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyWriteTransaction) {
+        cache.didRemove(value: recipientIdentity, transaction: transaction)
+    }
+
+    @objc(didInsertOrUpdateRecipientIdentity:transaction:)
+    public func didInsertOrUpdate(recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyWriteTransaction) {
+        cache.didInsertOrUpdate(value: recipientIdentity, transaction: transaction)
+    }
+
+    @objc
+    public func didReadRecipientIdentity(_ recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyReadTransaction) {
+        cache.didRead(value: recipientIdentity, transaction: transaction)
+    }
+}
+
 // MARK: -
 
 @objc
@@ -1118,6 +1370,16 @@ public class ModelReadCaches: NSObject {
                                                 AssertIsOnMainThread()
                                                 self?.evacuateAllCaches()
         }
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveMemoryWarning),
+                                               name: UIApplication.didReceiveMemoryWarningNotification,
+                                               object: nil)
+    }
+
+    // The memory budget shared by all model caches. The NSE has a much
+    // smaller memory limit than the main app.
+    static var totalCostLimit: Int {
+        CurrentAppContext().isMainApp ? 16 * 1024 * 1024 : 2 * 1024 * 1024
     }
 
     @objc
@@ -1134,10 +1396,50 @@ public class ModelReadCaches: NSObject {
     public let attachmentReadCache = AttachmentReadCache()
     @objc
     public let installedStickerCache = InstalledStickerCache()
+    @objc
+    public let recipientIdentityReadCache = RecipientIdentityReadCache()
+
+    public var cacheStats: [ModelReadCacheStats] {
+        userProfileReadCache.cacheStats +
+            signalAccountReadCache.cacheStats +
+            signalRecipientReadCache.cacheStats +
+            threadReadCache.cacheStats +
+            interactionReadCache.cacheStats +
+            attachmentReadCache.cacheStats +
+            installedStickerCache.cacheStats +
+            recipientIdentityReadCache.cacheStats
+    }
 
     @objc
     fileprivate static let evacuateAllModelCaches = Notification.Name("EvacuateAllModelCaches")
 
+    // The notification's object is whether this warning follows another
+    // recent warning, in which case every cache should be evacuated.
+    fileprivate static let didReceiveMemoryWarning = Notification.Name("ModelReadCachesDidReceiveMemoryWarning")
+
+    // Memory warnings within this interval of each other escalate.
+    private static let memoryWarningEscalationInterval: TimeInterval = 60
+
+    // This property should only be accessed on the main thread.
+    private var lastMemoryWarningDate: Date?
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        AssertIsOnMainThread()
+
+        let isRepeatedWarning: Bool = {
+            guard let lastMemoryWarningDate = lastMemoryWarningDate else {
+                return false
+            }
+            return abs(lastMemoryWarningDate.timeIntervalSinceNow) < Self.memoryWarningEscalationInterval
+        }()
+        lastMemoryWarningDate = Date()
+
+        Logger.info("Evacuating model caches; isRepeatedWarning: \(isRepeatedWarning).")
+        NotificationCenter.default.post(name: Self.didReceiveMemoryWarning,
+                                        object: NSNumber(value: isRepeatedWarning))
+    }
+
     func evacuateAllCaches() {
         DispatchSyncMainThreadSafe {
             NotificationCenter.default.post(name: Self.evacuateAllModelCaches, object: nil)
@@ -3,6 +3,7 @@
 //
 
 #import "NSData+Image.h"
+#import "ImageHeaderProbe.h"
 #import "MIMETypeUtil.h"
 #import "OWSFileSystem.h"
 #import "webp/decode.h"
@@ -597,6 +598,12 @@ typedef struct {
 
 + (ImageMetadata *)imageMetadataWithPath:(NSString *)filePath mimeType:(nullable NSString *)mimeType
 {
+    // Most images can be validated from their headers alone.
+    ImageMetadata *_Nullable probedImageMetadata = [self probedImageMetadataWithPath:filePath mimeType:mimeType];
+    if (probedImageMetadata != nil) {
+        return probedImageMetadata;
+    }
+
     NSError *error = nil;
     NSData *_Nullable data = [NSData dataWithContentsOfFile:filePath options:NSDataReadingMappedIfSafe error:&error];
     if (!data || error) {
@@ -610,6 +617,45 @@ typedef struct {
     return [data imageMetadataWithPath:filePath mimeType:mimeType];
 }
 
+// Returns nil if the image's headers don't settle its metadata, in which
+// case the image should be validated using ImageIO or WebPDemux.
++ (nullable ImageMetadata *)probedImageMetadataWithPath:(NSString *)filePath
+                                               mimeType:(nullable NSString *)declaredMimeType
+{
+    if (declaredMimeType != nil && [OWSMimeTypeLottieSticker isEqualToString:declaredMimeType]) {
+        return nil;
+    }
+    ImageHeaderInfo *_Nullable headerInfo = [ImageHeaderProbe probeImageAtPath:filePath];
+    if (headerInfo == nil) {
+        return nil;
+    }
+
+    BOOL isAnimated = headerInfo.isAnimated;
+    if (isAnimated && headerInfo.imageFormat == ImageFormat_Png && !SSKFeatureFlags.supportAnimatedStickers_Apng) {
+        OWSLogWarn(@"Animated png not permitted.");
+        return ImageMetadata.invalid;
+    }
+
+    const NSUInteger kMaxFileSize
+        = (isAnimated ? OWSMediaUtils.kMaxFileSizeAnimatedImage : OWSMediaUtils.kMaxFileSizeImage);
+    if (headerInfo.fileLength > kMaxFileSize) {
+        OWSLogWarn(@"Oversize image.");
+        return ImageMetadata.invalid;
+    }
+
+    CGSize pixelSize = [self applyImageOrientation:headerInfo.orientation toImageSize:headerInfo.pixelSize];
+    CGFloat depthBytes = (CGFloat)ceil(headerInfo.depthBits / 8.f);
+    if (![self ows_isValidImageDimension:pixelSize depthBytes:depthBytes isAnimated:isAnimated]) {
+        OWSLogWarn(@"Image does not have valid dimensions: %@.", NSStringFromCGSize(pixelSize));
+        return ImageMetadata.invalid;
+    }
+
+    return [ImageMetadata validWithImageFormat:headerInfo.imageFormat
+                                     pixelSize:pixelSize
+                                      hasAlpha:headerInfo.hasAlpha
+                                    isAnimated:isAnimated];
+}
+
 // If filePath and/or declaredMimeType is supplied, we warn
 // if they do not match the actual file contents.  But they are
 // both optional, we consider the actual image format (deduced
@@ -10,6 +10,9 @@ NS_ASSUME_NONNULL_BEGIN
 // so we should always send them asynchronously to avoid any
 // possible risk of deadlock.  These methods also ensure that
 // the notifications are always fired on the main thread.
+//
+// See CoalescingNotificationCenter for notifications which
+// are posted in bursts.
 @interface NSNotificationCenter (OWS)
 
 - (void)postNotificationNameAsync:(NSNotificationName)name object:(nullable id)object;
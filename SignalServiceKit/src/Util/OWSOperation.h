@@ -33,6 +33,9 @@ extern NSErrorUserInfoKey const OWSOperationIsRetryableKey;
 // Defaults to 0, set to greater than 0 in init if you'd like the operation to be retryable.
 @property NSUInteger remainingRetries;
 
+// Defaults to NO. If YES, retries are held back while the network is unreachable.
+@property (atomic) BOOL retryRequiresReachability;
+
 #pragma mark - Mandatory Subclass Overrides
 
 // Called every retry, this is where the bulk of the operation's work should go.
@@ -55,12 +58,13 @@ extern NSErrorUserInfoKey const OWSOperationIsRetryableKey;
 // Called at most one time, once retry is no longer possible.
 - (void)didFailWithError:(NSError *)error NS_SWIFT_NAME(didFail(error:));
 
-// How long to wait before retry, if possible
+// How long to wait before retry, if possible.
+// DurableOperationRetryScheduler jitters this interval.
 - (NSTimeInterval)retryInterval;
 
 #pragma mark - Success/Error - Do Not Override
 
-// Runs now if a retry timer has been set by a previous failure,
+// Runs now if a retry has been scheduled by a previous failure,
 // otherwise assumes we're currently running and does nothing.
 - (void)runAnyQueuedRetry;
 
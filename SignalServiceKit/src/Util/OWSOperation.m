@@ -4,7 +4,6 @@
 
 #import "OWSOperation.h"
 #import "NSError+OWSOperation.h"
-#import "NSTimer+OWS.h"
 #import "OWSBackgroundTask.h"
 #import "OWSError.h"
 #import <SignalServiceKit/SignalServiceKit-Swift.h>
@@ -22,9 +21,6 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 @property (atomic) OWSOperationState operationState;
 @property (nonatomic) OWSBackgroundTask *backgroundTask;
 
-// This property should only be accessed on the main queue.
-@property (nonatomic) NSTimer *_Nullable retryTimer;
-
 @property (nonatomic) NSUInteger errorCount;
 
 @end
@@ -142,19 +138,9 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 
 - (void)runAnyQueuedRetry
 {
-    dispatch_async(dispatch_get_main_queue(), ^{
-        NSTimer *_Nullable retryTimer = self.retryTimer;
-        self.retryTimer = nil;
-        [retryTimer invalidate];
-
-        if (retryTimer != nil) {
-            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-                [self run];
-            });
-        } else {
-            OWSLogVerbose(@"not re-running since operation is already running.");
-        }
-    });
+    if (![DurableOperationRetryScheduler.shared runPendingRetryNowForOperation:self]) {
+        OWSLogVerbose(@"not re-running since operation is already running.");
+    }
 }
 
 #pragma mark - Public Methods
@@ -163,6 +149,7 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 - (void)reportSuccess
 {
     OWSLogDebug(@"[%@] succeeded", self);
+    [DurableOperationRetryScheduler.shared operationDidFinishAttempt:self];
     [self didSucceed];
     [self markAsComplete];
 }
@@ -171,6 +158,7 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 - (void)reportCancelled
 {
     OWSLogDebug(@"[%@] cancelled", self);
+    [DurableOperationRetryScheduler.shared operationDidFinishAttempt:self];
     [self didCancel];
     [self markAsComplete];
 }
@@ -185,6 +173,8 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 
     self.errorCount += 1;
 
+    [DurableOperationRetryScheduler.shared operationDidFinishAttempt:self];
+
     [self didReportError:error];
 
     if (error.isFatal) {
@@ -204,23 +194,7 @@ NSString *const OWSOperationKeyIsFinished = @"isFinished";
 
     self.remainingRetries--;
 
-    dispatch_async(dispatch_get_main_queue(), ^{
-        OWSAssertDebug(self.retryTimer == nil);
-        [self.retryTimer invalidate];
-
-        // The `scheduledTimerWith*` methods add the timer to the current thread's RunLoop.
-        // Since Operations typically run on a background thread, that would mean the background
-        // thread's RunLoop. However, the OS can spin down background threads if there's no work
-        // being done, so we run the risk of the timer's RunLoop being deallocated before it's
-        // fired.
-        //
-        // To ensure the timer's thread sticks around, we schedule it while on the main RunLoop.
-        self.retryTimer = [NSTimer weakScheduledTimerWithTimeInterval:self.retryInterval
-                                                               target:self
-                                                             selector:@selector(runAnyQueuedRetry)
-                                                             userInfo:nil
-                                                              repeats:NO];
-    });
+    [DurableOperationRetryScheduler.shared scheduleRetryForOperation:self retryInterval:self.retryInterval];
 }
 
 // Override in subclass if you want something more sophisticated, e.g. exponential backoff
@@ -0,0 +1,44 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An Objective-C wrapper around pthread_rwlock_t. Any number of readers can hold the lock at once, while a writer
+/// holds it exclusively. See: pthread.h
+///
+/// @discussion Prefer OWSUnfairLock for state which is written about as often as it is read. This lock is for
+/// read-mostly state, e.g. cached values which are read by many threads and rarely replaced.
+///
+/// Like pthread_rwlock_t, this lock is not recursive: a thread which holds the lock must not try to acquire it
+/// again, for reading or for writing.
+///
+/// Note: Errors with the lock are fatal and will terminate the process.
+NS_SWIFT_NAME(ReadWriteLock)
+@interface OWSReadWriteLock : NSObject
+
+/// Locks the lock for reading. Blocks if a writer holds the lock.
+/// Forwards to pthread_rwlock_rdlock() defined in pthread.h
+- (void)readLock;
+
+/// Locks the lock for writing. Blocks if any reader or writer holds the lock.
+/// Forwards to pthread_rwlock_wrlock() defined in pthread.h
+- (void)writeLock;
+
+/// Unlocks the lock, which must be held by the current thread for reading or for writing.
+/// Forwards to pthread_rwlock_unlock() defined in pthread.h
+- (void)unlock;
+
+/// Attempts to lock the lock for reading. Returns YES if the lock was successfully acquired.
+/// Forwards to pthread_rwlock_tryrdlock() defined in pthread.h
+- (BOOL)tryReadLock NS_SWIFT_NAME(tryReadLock());
+
+/// Attempts to lock the lock for writing. Returns YES if the lock was successfully acquired.
+/// Forwards to pthread_rwlock_trywrlock() defined in pthread.h
+- (BOOL)tryWriteLock NS_SWIFT_NAME(tryWriteLock());
+
+@end
+
+NS_ASSUME_NONNULL_END
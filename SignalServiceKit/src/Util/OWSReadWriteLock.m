@@ -0,0 +1,63 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import "OWSReadWriteLock.h"
+#import <pthread.h>
+
+@implementation OWSReadWriteLock {
+    pthread_rwlock_t _lock;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        int result = pthread_rwlock_init(&_lock, NULL);
+        if (result != 0) {
+            OWSFail(@"Could not create lock: %d", result);
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    pthread_rwlock_destroy(&_lock);
+}
+
+- (void)readLock
+{
+    int result = pthread_rwlock_rdlock(&_lock);
+    if (result != 0) {
+        OWSFail(@"Could not lock for reading: %d", result);
+    }
+}
+
+- (void)writeLock
+{
+    int result = pthread_rwlock_wrlock(&_lock);
+    if (result != 0) {
+        OWSFail(@"Could not lock for writing: %d", result);
+    }
+}
+
+- (void)unlock
+{
+    int result = pthread_rwlock_unlock(&_lock);
+    if (result != 0) {
+        OWSFail(@"Could not unlock: %d", result);
+    }
+}
+
+- (BOOL)tryReadLock
+{
+    return pthread_rwlock_tryrdlock(&_lock) == 0;
+}
+
+- (BOOL)tryWriteLock
+{
+    return pthread_rwlock_trywrlock(&_lock) == 0;
+}
+
+@end
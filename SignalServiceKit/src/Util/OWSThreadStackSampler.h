@@ -0,0 +1,31 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Samples the stack of the main thread from another thread, e.g. while the
+// main thread is blocked.
+//
+// The stack is walked using frame pointers, so frames of code built without
+// them may be missing.
+//
+// The samples are unsymbolicated: each frame is a return address. Use
+// +describeReturnAddress: to render a frame as an image name and offset,
+// which can be symbolicated later.
+@interface OWSThreadStackSampler : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+// This should be called on the main thread, before any samples are taken.
++ (void)prepareToSampleMainThread;
+
+// This should not be called on the main thread. Returns nil if the main
+// thread couldn't be sampled.
++ (nullable NSArray<NSNumber *> *)sampleMainThreadReturnAddressesWithMaxDepth:(NSUInteger)maxDepth;
+
++ (NSString *)describeReturnAddress:(uintptr_t)returnAddress;
+
+@end
+
+NS_ASSUME_NONNULL_END
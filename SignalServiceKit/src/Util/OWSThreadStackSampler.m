@@ -0,0 +1,171 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+#import "OWSThreadStackSampler.h"
+#import <dlfcn.h>
+#import <mach/mach.h>
+#if __has_include(<ptrauth.h>)
+#import <ptrauth.h>
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+// The sample buffer lives on the sampling thread's stack: nothing may be
+// allocated while the main thread is suspended, since it might hold the
+// malloc lock.
+static const NSUInteger kOWSMaxSampleDepth = 128;
+
+static mach_port_t gOWSMainThreadPort = MACH_PORT_NULL;
+
+static inline uintptr_t OWSStripPointerAuthentication(uintptr_t address)
+{
+#if __has_feature(ptrauth_calls)
+    return (uintptr_t)ptrauth_strip((void *)address, ptrauth_key_return_address);
+#else
+    return address;
+#endif
+}
+
+// Unlike dereferencing the pointer, this fails safely if the frame
+// pointer chain is corrupt.
+static BOOL OWSReadMemory(uintptr_t address, void *buffer, size_t length)
+{
+    vm_size_t bytesCopied = 0;
+    kern_return_t result
+        = vm_read_overwrite(mach_task_self(), (vm_address_t)address, length, (vm_address_t)buffer, &bytesCopied);
+    return result == KERN_SUCCESS && bytesCopied == length;
+}
+
+// The thread should be suspended.
+static NSUInteger OWSWalkStack(thread_t thread, uintptr_t *returnAddresses, NSUInteger maxDepth)
+{
+    uintptr_t pc;
+    uintptr_t fp;
+    uintptr_t lr = 0;
+#if defined(__arm64__)
+    arm_thread_state64_t state;
+    mach_msg_type_number_t stateCount = ARM_THREAD_STATE64_COUNT;
+    if (thread_get_state(thread, ARM_THREAD_STATE64, (thread_state_t)&state, &stateCount) != KERN_SUCCESS) {
+        return 0;
+    }
+    pc = (uintptr_t)arm_thread_state64_get_pc(state);
+    fp = (uintptr_t)arm_thread_state64_get_fp(state);
+    lr = (uintptr_t)arm_thread_state64_get_lr(state);
+#elif defined(__x86_64__)
+    x86_thread_state64_t state;
+    mach_msg_type_number_t stateCount = x86_THREAD_STATE64_COUNT;
+    if (thread_get_state(thread, x86_THREAD_STATE64, (thread_state_t)&state, &stateCount) != KERN_SUCCESS) {
+        return 0;
+    }
+    pc = (uintptr_t)state.__rip;
+    fp = (uintptr_t)state.__rbp;
+#else
+    return 0;
+#endif
+
+    NSUInteger depth = 0;
+    if (maxDepth < 1) {
+        return depth;
+    }
+    returnAddresses[depth++] = OWSStripPointerAuthentication(pc);
+
+    // A leaf function on arm64 might not have pushed a frame yet, in which
+    // case its caller is only in the link register.
+    lr = OWSStripPointerAuthentication(lr);
+    if (lr != 0 && depth < maxDepth) {
+        returnAddresses[depth++] = lr;
+    }
+
+    BOOL isFirstFrame = YES;
+    while (fp != 0 && depth < maxDepth) {
+        // Each frame record is the caller's frame pointer, then the return address.
+        uintptr_t frameRecord[2];
+        if ((fp % sizeof(uintptr_t)) != 0 || !OWSReadMemory(fp, frameRecord, sizeof(frameRecord))) {
+            break;
+        }
+        uintptr_t returnAddress = OWSStripPointerAuthentication(frameRecord[1]);
+        if (returnAddress == 0) {
+            break;
+        }
+        // Skip the link register if the current function has pushed a frame.
+        if (!(isFirstFrame && returnAddress == lr)) {
+            returnAddresses[depth++] = returnAddress;
+        }
+        isFirstFrame = NO;
+
+        // The stack grows down, so callers' frames are at higher addresses.
+        uintptr_t callerFp = frameRecord[0];
+        if (callerFp <= fp) {
+            break;
+        }
+        fp = callerFp;
+    }
+    return depth;
+}
+
+#pragma mark -
+
+@implementation OWSThreadStackSampler
+
++ (void)prepareToSampleMainThread
+{
+    OWSAssertIsOnMainThread();
+
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // We never deallocate this port right.
+        gOWSMainThreadPort = mach_thread_self();
+    });
+}
+
++ (nullable NSArray<NSNumber *> *)sampleMainThreadReturnAddressesWithMaxDepth:(NSUInteger)maxDepth
+{
+    OWSAssertDebug(!NSThread.isMainThread);
+
+    if (gOWSMainThreadPort == MACH_PORT_NULL) {
+        OWSFailDebug(@"Not prepared to sample the main thread.");
+        return nil;
+    }
+
+    uintptr_t returnAddresses[kOWSMaxSampleDepth];
+    maxDepth = MIN(maxDepth, kOWSMaxSampleDepth);
+
+    // Don't log, allocate or take locks until the thread has been resumed.
+    if (thread_suspend(gOWSMainThreadPort) != KERN_SUCCESS) {
+        return nil;
+    }
+    NSUInteger depth = OWSWalkStack(gOWSMainThreadPort, returnAddresses, maxDepth);
+    thread_resume(gOWSMainThreadPort);
+
+    if (depth < 1) {
+        return nil;
+    }
+    NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:depth];
+    for (NSUInteger i = 0; i < depth; i++) {
+        [result addObject:@(returnAddresses[i])];
+    }
+    return result;
+}
+
+// Renders the frame like a crash report does, e.g.
+// "SignalServiceKit 0x0000000104a5c3f4 0x104800000 + 2474996",
+// so that it can be symbolicated with the usual tools.
++ (NSString *)describeReturnAddress:(uintptr_t)returnAddress
+{
+    Dl_info info;
+    if (dladdr((const void *)returnAddress, &info) == 0 || info.dli_fname == NULL) {
+        return [NSString stringWithFormat:@"??? 0x%016lx", (unsigned long)returnAddress];
+    }
+    NSString *imageName = @(info.dli_fname).lastPathComponent;
+    uintptr_t imageBase = (uintptr_t)info.dli_fbase;
+    return [NSString stringWithFormat:@"%@ 0x%016lx 0x%lx + %lu",
+                     imageName,
+                     (unsigned long)returnAddress,
+                     (unsigned long)imageBase,
+                     (unsigned long)(returnAddress - imageBase)];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
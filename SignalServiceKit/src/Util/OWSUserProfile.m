@@ -271,7 +271,8 @@ NSUInteger const kUserProfileSchemaVersion = 1;
 
 - (SignalServiceAddress *)address
 {
-    return [[SignalServiceAddress alloc] initWithUuidString:self.recipientUUID phoneNumber:self.recipientPhoneNumber];
+    return [SignalServiceAddress canonicalAddressWithUuidString:self.recipientUUID
+                                                    phoneNumber:self.recipientPhoneNumber];
 }
 
 // When possible, update the avatar properties in lockstep.
@@ -0,0 +1,223 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// A point-in-time summary of the app's queues, database, model caches,
+/// memory and websocket, for the performance page of the Debug UI and
+/// for debug log uploads.
+@objc
+public class PerformanceSnapshot: NSObject {
+
+    // MARK: - Dependencies
+
+    private static var databaseStorage: SDSDatabaseStorage {
+        return SDSDatabaseStorage.shared
+    }
+
+    private static var messageReceiver: OWSMessageReceiver {
+        return SSKEnvironment.shared.messageReceiver
+    }
+
+    private static var batchMessageProcessor: OWSBatchMessageProcessor {
+        return SSKEnvironment.shared.batchMessageProcessor
+    }
+
+    private static var messageSenderJobQueue: MessageSenderJobQueue {
+        return SSKEnvironment.shared.messageSenderJobQueue
+    }
+
+    private static var attachmentDownloads: OWSAttachmentDownloads {
+        return SSKEnvironment.shared.attachmentDownloads
+    }
+
+    private static var socketManager: TSSocketManager {
+        return SSKEnvironment.shared.socketManager
+    }
+
+    // MARK: -
+
+    public struct CacheSnapshot {
+        public let cacheName: String
+        public let hitRate: Double?
+        public let readCount: UInt
+        public let cost: Int
+        public let costLimit: Int
+    }
+
+    public let date: Date
+
+    public let decryptQueueDepth: UInt
+    public let contentQueueDepth: UInt
+    public let sendQueueDepth: UInt
+    public let activeDownloadCount: UInt
+    public let queuedDownloadCount: UInt
+
+    public let commitsPerSecond: Double
+    public let p95CommitDuration: TimeInterval
+    public let totalCommitCount: UInt64
+    public let mainThreadReadCount: UInt64
+    public let mainThreadSlowReadCount: UInt64
+
+    public let caches: [CacheSnapshot]
+
+    /// The process' physical memory footprint, as used by jetsam.
+    public let memoryFootprint: UInt64?
+
+    /// The memory held by each subsystem; see MemoryAccountant.
+    public let memoryAccounts: [MemoryAccountant.AccountSnapshot]
+
+    public let socketState: OWSWebSocketState
+
+    private init(date: Date,
+                 decryptQueueDepth: UInt,
+                 contentQueueDepth: UInt,
+                 sendQueueDepth: UInt,
+                 activeDownloadCount: UInt,
+                 queuedDownloadCount: UInt,
+                 commitsPerSecond: Double,
+                 p95CommitDuration: TimeInterval,
+                 totalCommitCount: UInt64,
+                 mainThreadReadCount: UInt64,
+                 mainThreadSlowReadCount: UInt64,
+                 caches: [CacheSnapshot],
+                 memoryFootprint: UInt64?,
+                 memoryAccounts: [MemoryAccountant.AccountSnapshot],
+                 socketState: OWSWebSocketState) {
+        self.date = date
+        self.decryptQueueDepth = decryptQueueDepth
+        self.contentQueueDepth = contentQueueDepth
+        self.sendQueueDepth = sendQueueDepth
+        self.activeDownloadCount = activeDownloadCount
+        self.queuedDownloadCount = queuedDownloadCount
+        self.commitsPerSecond = commitsPerSecond
+        self.p95CommitDuration = p95CommitDuration
+        self.totalCommitCount = totalCommitCount
+        self.mainThreadReadCount = mainThreadReadCount
+        self.mainThreadSlowReadCount = mainThreadSlowReadCount
+        self.caches = caches
+        self.memoryFootprint = memoryFootprint
+        self.memoryAccounts = memoryAccounts
+        self.socketState = socketState
+    }
+
+    /// The websocket's state should only be accessed on the main thread,
+    /// so this should only be called on the main thread. It performs a
+    /// short database read to count the queued jobs.
+    @objc
+    public static func capture() -> PerformanceSnapshot {
+        AssertIsOnMainThread()
+
+        var decryptQueueDepth: UInt = 0
+        var contentQueueDepth: UInt = 0
+        var sendQueueDepth: UInt = 0
+        databaseStorage.read { transaction in
+            decryptQueueDepth = UInt(messageReceiver.queuedJobCount(with: transaction))
+            contentQueueDepth = UInt(batchMessageProcessor.queuedJobCount(with: transaction))
+            sendQueueDepth = messageSenderJobQueue.pendingJobCount(transaction: transaction)
+        }
+
+        let commitRateMonitor = databaseStorage.commitRateMonitor
+        let mainThreadReadMonitor = MainThreadReadMonitor.shared
+        let caches = ModelReadCaches.shared.cacheStats.map { cacheStats in
+            CacheSnapshot(cacheName: cacheStats.cacheName,
+                          hitRate: cacheStats.hitRate,
+                          readCount: cacheStats.readCount,
+                          cost: cacheStats.cost,
+                          costLimit: cacheStats.costLimit)
+        }
+        let memorySnapshot = MemoryAccountant.shared.snapshot()
+
+        return PerformanceSnapshot(date: Date(),
+                                   decryptQueueDepth: decryptQueueDepth,
+                                   contentQueueDepth: contentQueueDepth,
+                                   sendQueueDepth: sendQueueDepth,
+                                   activeDownloadCount: UInt(attachmentDownloads.activeDownloadCount),
+                                   queuedDownloadCount: UInt(attachmentDownloads.queuedDownloadCount),
+                                   commitsPerSecond: commitRateMonitor.commitsPerSecond,
+                                   p95CommitDuration: commitRateMonitor.p95CommitDuration,
+                                   totalCommitCount: commitRateMonitor.totalCommitCount,
+                                   mainThreadReadCount: mainThreadReadMonitor.mainThreadReadCount,
+                                   mainThreadSlowReadCount: mainThreadReadMonitor.mainThreadSlowReadCount,
+                                   caches: caches,
+                                   memoryFootprint: memorySnapshot.memoryFootprint,
+                                   memoryAccounts: memorySnapshot.accounts,
+                                   socketState: socketManager.socketState())
+    }
+
+    // MARK: - Formatting
+
+    private static let byteCountFormatter: ByteCountFormatter = {
+        let formatter = ByteCountFormatter()
+        formatter.countStyle = .memory
+        return formatter
+    }()
+
+    public static func format(byteCount: Int) -> String {
+        byteCountFormatter.string(fromByteCount: Int64(byteCount))
+    }
+
+    public static func format(duration: TimeInterval) -> String {
+        String(format: "%.1f ms", duration * 1000)
+    }
+
+    public static func format(hitRate: Double?) -> String {
+        guard let hitRate = hitRate else {
+            return "-"
+        }
+        return String(format: "%.1f%%", hitRate * 100)
+    }
+
+    public var socketStateDescription: String {
+        switch socketState {
+        case .closed:
+            return "Closed"
+        case .connecting:
+            return "Connecting"
+        case .open:
+            return "Open"
+        @unknown default:
+            return "Unknown"
+        }
+    }
+
+    public var memoryFootprintDescription: String {
+        guard let memoryFootprint = memoryFootprint else {
+            return "-"
+        }
+        return Self.format(byteCount: Int(memoryFootprint))
+    }
+
+    /// A plain text rendering of the snapshot.
+    @objc
+    public var reportText: String {
+        var lines = [String]()
+        lines.append("Performance snapshot: \(date)")
+        lines.append("")
+        lines.append("Queues")
+        lines.append("  Decrypt: \(decryptQueueDepth)")
+        lines.append("  Content: \(contentQueueDepth)")
+        lines.append("  Send: \(sendQueueDepth)")
+        lines.append("  Downloads: \(activeDownloadCount) active, \(queuedDownloadCount) queued")
+        lines.append("")
+        lines.append("Database")
+        lines.append("  Commits/s: \(String(format: "%.1f", commitsPerSecond))")
+        lines.append("  p95 write duration: \(Self.format(duration: p95CommitDuration))")
+        lines.append("  Total commits: \(totalCommitCount)")
+        lines.append("  Main thread reads: \(mainThreadReadCount) (\(mainThreadSlowReadCount) slow)")
+        lines.append("")
+        lines.append("Model read caches")
+        for cache in caches {
+            lines.append("  \(cache.cacheName): hit rate \(Self.format(hitRate: cache.hitRate)) of \(cache.readCount), "
+                            + "\(Self.format(byteCount: cache.cost)) of \(Self.format(byteCount: cache.costLimit))")
+        }
+        lines.append("")
+        lines.append("Memory footprint: \(memoryFootprintDescription)")
+        for account in memoryAccounts {
+            lines.append("  \(account.name): \(Self.format(byteCount: account.byteCount))")
+        }
+        lines.append("Websocket: \(socketStateDescription)")
+        return lines.joined(separator: "\n")
+    }
+}
@@ -244,7 +244,7 @@ public class BulkProfileFetch: NSObject {
                     if IsNetworkConnectivityFailure(error) {
                         Logger.warn("Error: \(error)")
                         self.lastOutcomeMap[uuid] = UpdateOutcome(.networkFailure)
-                    } else if error.httpStatusCode == 413 {
+                    } else if error.httpStatusCode == 413 || error.httpStatusCode == 429 {
                         Logger.error("Error: \(error)")
                         self.lastOutcomeMap[uuid] = UpdateOutcome(.retryLimit)
                         self.lastRateLimitErrorDate = Date()
@@ -0,0 +1,154 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// Runs "blocking" profile fetches for many addresses at once, e.g. for every
+// member of a group we're joining or migrating.
+//
+// The service has no batch profile endpoint, so each address is still a
+// separate request. But rather than starting every request (and every
+// profile decryption) at once, at most a few fetches are in flight at a
+// time, duplicate fetches for the same address share a single request, and
+// all fetches pause and back off once the service reports a rate limit.
+//
+// BulkProfileFetch should still be used for non-urgent profile updates.
+public class ProfileFetchScheduler {
+
+    public static let shared = ProfileFetchScheduler()
+
+    static let maxConcurrentFetches = 4
+    static let minRateLimitBackoff: TimeInterval = 5
+    static let maxRateLimitBackoff: TimeInterval = 60
+    // How many times a rate-limited fetch is retried.
+    static let maxRateLimitRetries = 2
+
+    // Each fetch holds its slot until its profile has been decrypted and
+    // saved, so this also bounds the decryption work.
+    private let workQueue = BoundedWorkQueue(label: "org.signal.profileFetchScheduler",
+                                             maxConcurrentCount: ProfileFetchScheduler.maxConcurrentFetches)
+
+    private let singleflight = Singleflight<SignalServiceProfile>(label: "ProfileFetchScheduler")
+
+    private let lock = UnfairLock()
+
+    // These properties should only be accessed while holding the lock.
+    private var rateLimitBackoff: TimeInterval?
+    private var rateLimitPauseDate: Date?
+
+    init() {}
+
+    /// Fetches the profiles for `addresses`, ignoring duplicates.
+    ///
+    /// Fails if any of the fetches fail.
+    public func fetchProfiles(addresses: [SignalServiceAddress],
+                              mainAppOnly: Bool = true,
+                              ignoreThrottling: Bool = false,
+                              fetchType: ProfileFetchType = .default) -> Promise<Void> {
+        let uniqueAddresses = OrderedSet(addresses).orderedMembers
+        Logger.info("Fetching \(uniqueAddresses.count) profiles.")
+
+        let promises = uniqueAddresses.map { address in
+            fetchProfile(address: address,
+                         mainAppOnly: mainAppOnly,
+                         ignoreThrottling: ignoreThrottling,
+                         fetchType: fetchType)
+        }
+        return when(fulfilled: promises).asVoid()
+    }
+
+    public func fetchProfile(address: SignalServiceAddress,
+                             mainAppOnly: Bool = true,
+                             ignoreThrottling: Bool = false,
+                             fetchType: ProfileFetchType = .default) -> Promise<SignalServiceProfile> {
+        let enqueueFetch = {
+            self.workQueue.enqueue {
+                self.fetchProfileWithRetries(address: address,
+                                             mainAppOnly: mainAppOnly,
+                                             ignoreThrottling: ignoreThrottling,
+                                             fetchType: fetchType,
+                                             retryCount: 0)
+            }
+        }
+        guard let serviceIdentifier = address.serviceIdentifier else {
+            owsFailDebug("Invalid address.")
+            return enqueueFetch()
+        }
+        return singleflight.perform(key: "\(serviceIdentifier).\(fetchType.rawValue)", enqueueFetch)
+    }
+
+    private func fetchProfileWithRetries(address: SignalServiceAddress,
+                                         mainAppOnly: Bool,
+                                         ignoreThrottling: Bool,
+                                         fetchType: ProfileFetchType,
+                                         retryCount: Int) -> Promise<SignalServiceProfile> {
+        firstly {
+            waitForRateLimit()
+        }.then(on: .global()) {
+            ProfileFetcherJob.fetchProfilePromise(address: address,
+                                                  mainAppOnly: mainAppOnly,
+                                                  ignoreThrottling: ignoreThrottling,
+                                                  fetchType: fetchType)
+        }.map(on: .global()) { (profile: SignalServiceProfile) -> SignalServiceProfile in
+            self.fetchDidSucceed()
+            return profile
+        }.recover(on: .global()) { (error: Error) -> Promise<SignalServiceProfile> in
+            guard case ProfileFetchError.rateLimit = error else {
+                throw error
+            }
+            self.fetchDidHitRateLimit()
+            guard retryCount < Self.maxRateLimitRetries else {
+                Logger.warn("Giving up after rate limit.")
+                throw error
+            }
+            return self.fetchProfileWithRetries(address: address,
+                                                mainAppOnly: mainAppOnly,
+                                                ignoreThrottling: ignoreThrottling,
+                                                fetchType: fetchType,
+                                                retryCount: retryCount + 1)
+        }
+    }
+
+    // MARK: - Rate Limit
+
+    private func waitForRateLimit() -> Guarantee<Void> {
+        let delay: TimeInterval = lock.withLock {
+            guard let rateLimitPauseDate = rateLimitPauseDate else {
+                return 0
+            }
+            return max(0, rateLimitPauseDate.timeIntervalSinceNow)
+        }
+        guard delay > 0 else {
+            return Guarantee.value(())
+        }
+        return after(seconds: delay)
+    }
+
+    private func fetchDidSucceed() {
+        lock.withLock {
+            rateLimitBackoff = nil
+        }
+    }
+
+    private func fetchDidHitRateLimit() {
+        lock.withLock {
+            // Concurrent fetches are likely to hit the rate limit together,
+            // so only back off further once the current pause has elapsed.
+            if let rateLimitPauseDate = rateLimitPauseDate,
+               rateLimitPauseDate.timeIntervalSinceNow > 0 {
+                return
+            }
+            let backoff: TimeInterval
+            if let rateLimitBackoff = rateLimitBackoff {
+                backoff = min(Self.maxRateLimitBackoff, rateLimitBackoff * 2)
+            } else {
+                backoff = Self.minRateLimitBackoff
+            }
+            Logger.warn("Hit rate limit, pausing profile fetches for \(backoff)s.")
+            rateLimitBackoff = backoff
+            rateLimitPauseDate = Date(timeIntervalSinceNow: backoff)
+        }
+    }
+}
@@ -307,7 +307,7 @@ public class ProfileFetcherJob: NSObject {
             if error.httpStatusCode == 404 {
                 return resolver.reject(ProfileFetchError.missing)
             }
-            if error.httpStatusCode == 413 {
+            if error.httpStatusCode == 413 || error.httpStatusCode == 429 {
                 return resolver.reject(ProfileFetchError.rateLimit)
             }
 
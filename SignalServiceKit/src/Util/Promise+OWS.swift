@@ -118,11 +118,10 @@ public func firstly<U: Thenable>(on dispatchQueue: DispatchQueue,
                                  execute body: @escaping () throws -> U) -> Promise<U.T> {
     let (promise, resolver) = Promise<U.T>.pending()
     dispatchQueue.async {
-        firstly {
-            return try body()
-        }.done(on: .global()) { value in
-            resolver.fulfill(value)
-        }.catch(on: .global()) { error in
+        // Forward the result without another hop onto a global queue.
+        do {
+            try body().pipe(to: resolver.resolve)
+        } catch {
             resolver.reject(error)
         }
     }
@@ -0,0 +1,26 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+public extension ReadWriteLock {
+
+    /// Acquires the lock for reading and releases it around the provided closure. Blocks the current thread while a
+    /// writer holds the lock.
+    final func withReadLock<T>(_ criticalSection: () throws -> T) rethrows -> T {
+        readLock()
+        defer { unlock() }
+
+        return try criticalSection()
+    }
+
+    /// Acquires the lock for writing and releases it around the provided closure. Blocks the current thread while any
+    /// reader or writer holds the lock.
+    final func withWriteLock<T>(_ criticalSection: () throws -> T) rethrows -> T {
+        writeLock()
+        defer { unlock() }
+
+        return try criticalSection()
+    }
+}
@@ -19,6 +19,9 @@ import Foundation
 //   become ready" block which are performed with slight delays
 //   to avoid a stampede which could block the main thread. One
 //   of the risks there is 0x8badf00d crashes.
+// * Lastly, there's an "idle" flavor of "did become ready" block
+//   which are performed after the polite blocks, a few at a time
+//   in short slices, for work that can wait until the app settles.
 // * The flag can be used in various "queue modes". "App readiness"
 //   blocks should be enqueued and performed on the main thread.
 //   Other flags will want to do their work off the main thread.
@@ -60,19 +63,53 @@ public class ReadyFlag: NSObject {
 
     private static let blockLogDuration: TimeInterval = 0.01
     private static let groupLogDuration: TimeInterval = 0.1
+    // How many of the slowest blocks of a slow group to log.
+    private static let slowBlockLogCount = 5
+
+    // Idle blocks are performed in slices; each slice performs blocks
+    // until it has used its budget, then yields for the interval.
+    private static let idleSliceBudget: TimeInterval = 0.005
+    private static let idleSliceInterval: TimeInterval = 0.05
+
+    // Blocks are labeled by whoever enqueued them, so that we can tell
+    // which are slow.
+    private struct LabeledBlock {
+        let label: String
+        let block: ReadyBlock
+    }
+
+    private struct BlockTiming {
+        let label: String
+        let duration: TimeInterval
+    }
 
     // This property should only be set on serialQueue.
     // It can be read from any queue.
     private let flag = AtomicBool(false)
 
     // This property should only be accessed on serialQueue.
-    private var willBecomeReadyBlocks = [ReadyBlock]()
+    private var willBecomeReadyBlocks = [LabeledBlock]()
+
+    // This property should only be accessed on serialQueue.
+    private var didBecomeReadyBlocks = [LabeledBlock]()
+
+    // This property should only be accessed on serialQueue.
+    private var didBecomeReadyPoliteBlocks = [LabeledBlock]()
+
+    // This property should only be accessed on serialQueue.
+    private var didBecomeReadyIdleBlocks = [LabeledBlock]()
+
+    // Set once the polite blocks have been performed; from then on,
+    // idle blocks are performed soon after they are enqueued.
+    //
+    // This property should only be accessed on serialQueue.
+    private var isPerformingIdleBlocks = false
 
     // This property should only be accessed on serialQueue.
-    private var didBecomeReadyBlocks = [ReadyBlock]()
+    private var isIdleSliceScheduled = false
 
     // This property should only be accessed on serialQueue.
-    private var didBecomeReadyPoliteBlocks = [ReadyBlock]()
+    private var idleTimings = [BlockTiming]()
 
     @objc
     public required init(name: String, queueMode: QueueMode) {
@@ -86,38 +123,48 @@ public class ReadyFlag: NSObject {
     }
 
     @objc
-    public func runNowOrWhenWillBecomeReady(_ readyBlock: @escaping ReadyBlock) {
+    public func runNowOrWhenWillBecomeReady(_ readyBlock: @escaping ReadyBlock, label: String) {
         performInternal {
             if self.isSet {
                 readyBlock()
             } else {
-                self.willBecomeReadyBlocks.append(readyBlock)
+                self.willBecomeReadyBlocks.append(LabeledBlock(label: label, block: readyBlock))
             }
         }
     }
 
     @objc
-    public func runNowOrWhenDidBecomeReady(_ readyBlock: @escaping ReadyBlock) {
+    public func runNowOrWhenDidBecomeReady(_ readyBlock: @escaping ReadyBlock, label: String) {
         performInternal {
             if self.isSet {
                 readyBlock()
             } else {
-                self.didBecomeReadyBlocks.append(readyBlock)
+                self.didBecomeReadyBlocks.append(LabeledBlock(label: label, block: readyBlock))
             }
         }
     }
 
     @objc
-    public func runNowOrWhenDidBecomeReadyPolite(_ readyBlock: @escaping ReadyBlock) {
+    public func runNowOrWhenDidBecomeReadyPolite(_ readyBlock: @escaping ReadyBlock, label: String) {
         performInternal {
             if self.isSet {
                 readyBlock()
             } else {
-                self.didBecomeReadyPoliteBlocks.append(readyBlock)
+                self.didBecomeReadyPoliteBlocks.append(LabeledBlock(label: label, block: readyBlock))
             }
         }
     }
 
+    /// Idle blocks are always performed asynchronously, even if the flag
+    /// is already set.
+    @objc
+    public func runNowOrWhenDidBecomeReadyIdle(_ readyBlock: @escaping ReadyBlock, label: String) {
+        performInternal {
+            self.didBecomeReadyIdleBlocks.append(LabeledBlock(label: label, block: readyBlock))
+            self.scheduleIdleSliceIfNecessary()
+        }
+    }
+
     @objc
     public func setIsReady() {
         performInternal {
@@ -136,31 +183,51 @@ public class ReadyFlag: NSObject {
             self.didBecomeReadyBlocks = []
             self.didBecomeReadyPoliteBlocks = []
 
-            // We bench the blocks individually and as a group.
-            BenchManager.bench(title: self.name + ".willBecomeReady group",
-                               logIfLongerThan: Self.groupLogDuration,
-                               logInProduction: true) {
-                                for block in willBecomeReadyBlocks {
-                                    BenchManager.bench(title: self.name + ".willBecomeReady",
-                                                       logIfLongerThan: Self.blockLogDuration,
-                                                       logInProduction: true,
-                                                       block: block)
-                                }
+            // We time the blocks individually and as a group.
+            let willBecomeReadyTimings = willBecomeReadyBlocks.map {
+                self.perform($0, groupName: "willBecomeReady")
             }
-            BenchManager.bench(title: self.name + ".didBecomeReady group",
-                               logIfLongerThan: Self.groupLogDuration,
-                               logInProduction: true) {
-                                for block in didBecomeReadyBlocks {
-                                    BenchManager.bench(title: self.name + ".didBecomeReady",
-                                                       logIfLongerThan: Self.blockLogDuration,
-                                                       logInProduction: true,
-                                                       block: block)
-                                }
+            self.logGroup(groupName: "willBecomeReady", timings: willBecomeReadyTimings)
+            let didBecomeReadyTimings = didBecomeReadyBlocks.map {
+                self.perform($0, groupName: "didBecomeReady")
             }
-            self.performDidBecomeReadyPoliteBlocks(didBecomeReadyPoliteBlocks)
+            self.logGroup(groupName: "didBecomeReady", timings: didBecomeReadyTimings)
+            self.performDidBecomeReadyPoliteBlocks(didBecomeReadyPoliteBlocks, timings: [])
         }
     }
 
+    private func perform(_ labeledBlock: LabeledBlock, groupName: String) -> BlockTiming {
+        let startTime = CACurrentMediaTime()
+        Signposts.measure(.readyFlagBlock, "\(name).\(groupName) \(labeledBlock.label)") {
+            labeledBlock.block()
+        }
+        let duration = CACurrentMediaTime() - startTime
+        if duration > Self.blockLogDuration {
+            Logger.info(String(format: "%@.%@ block took %0.1fms: %@",
+                               name,
+                               groupName,
+                               duration * 1000,
+                               labeledBlock.label))
+        }
+        return BlockTiming(label: labeledBlock.label, duration: duration)
+    }
+
+    private func logGroup(groupName: String, timings: [BlockTiming]) {
+        let totalDuration = timings.reduce(0) { $0 + $1.duration }
+        guard totalDuration > Self.groupLogDuration else {
+            return
+        }
+        var lines = [String(format: "%@.%@: %ld blocks took %0.1fms. The slowest:",
+                            name,
+                            groupName,
+                            timings.count,
+                            totalDuration * 1000)]
+        for timing in timings.sorted(by: { $0.duration > $1.duration }).prefix(Self.slowBlockLogCount) {
+            lines.append(String(format: "  %0.1fms: %@", timing.duration * 1000, timing.label))
+        }
+        Logger.info(lines.joined(separator: "\n"))
+    }
+
     private func performInternal(_ block: @escaping () -> Void) {
         switch queueMode {
         case .mainThreadOnly:
@@ -174,30 +241,70 @@ public class ReadyFlag: NSObject {
         }
     }
 
-    private func performDidBecomeReadyPoliteBlocks(_ blocks: [ReadyBlock]) {
-        let dispatchQueue: DispatchQueue
-        switch queueMode {
-        case .mainThreadOnly:
-            dispatchQueue = .main
-        case .serialQueueSync, .serialQueueAsync:
-            dispatchQueue = Self.serialQueue
-        }
-
-        dispatchQueue.asyncAfter(deadline: DispatchTime.now() + 0.025) { [weak self] in
+    private func performDidBecomeReadyPoliteBlocks(_ blocks: [LabeledBlock], timings: [BlockTiming]) {
+        blockDispatchQueue.asyncAfter(deadline: DispatchTime.now() + 0.025) { [weak self] in
             guard let self = self else {
                 return
             }
             guard let block = blocks.first else {
+                self.logGroup(groupName: "didBecomeReadyPolite", timings: timings)
+                self.isPerformingIdleBlocks = true
+                self.scheduleIdleSliceIfNecessary()
                 return
             }
-            BenchManager.bench(title: self.name + ".didBecomeReadyPolite",
-                               logIfLongerThan: Self.blockLogDuration,
-                               logInProduction: true,
-                               block: block)
+            let timing = self.perform(block, groupName: "didBecomeReadyPolite")
 
             var blocksCopy = blocks
             blocksCopy.removeFirst(1)
-            self.performDidBecomeReadyPoliteBlocks(blocksCopy)
+            self.performDidBecomeReadyPoliteBlocks(blocksCopy, timings: timings + [timing])
+        }
+    }
+
+    // Polite and idle blocks are performed on this queue, which also
+    // isolates the local properties.
+    private var blockDispatchQueue: DispatchQueue {
+        switch queueMode {
+        case .mainThreadOnly:
+            return .main
+        case .serialQueueSync, .serialQueueAsync:
+            return Self.serialQueue
+        }
+    }
+
+    // This method should only be called on blockDispatchQueue.
+    private func scheduleIdleSliceIfNecessary() {
+        guard isPerformingIdleBlocks,
+              !isIdleSliceScheduled,
+              !didBecomeReadyIdleBlocks.isEmpty else {
+            return
+        }
+        isIdleSliceScheduled = true
+        blockDispatchQueue.asyncAfter(deadline: DispatchTime.now() + Self.idleSliceInterval) { [weak self] in
+            self?.performIdleSlice()
+        }
+    }
+
+    // Performs idle blocks until the slice's budget is used, always
+    // performing at least one.
+    //
+    // This method should only be called on blockDispatchQueue.
+    private func performIdleSlice() {
+        isIdleSliceScheduled = false
+
+        let sliceStartTime = CACurrentMediaTime()
+        repeat {
+            guard !didBecomeReadyIdleBlocks.isEmpty else {
+                break
+            }
+            let block = didBecomeReadyIdleBlocks.removeFirst()
+            idleTimings.append(perform(block, groupName: "didBecomeReadyIdle"))
+        } while CACurrentMediaTime() - sliceStartTime < Self.idleSliceBudget
+
+        if didBecomeReadyIdleBlocks.isEmpty {
+            logGroup(groupName: "didBecomeReadyIdle", timings: idleTimings)
+            idleTimings = []
+        } else {
+            scheduleIdleSliceIfNecessary()
         }
     }
 }
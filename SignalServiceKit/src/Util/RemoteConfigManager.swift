@@ -139,6 +139,13 @@ public class RemoteConfig: BaseFlags {
         return DebugFlags.forceGroupCalling || !isEnabled(.groupCallingKillSwitch)
     }
 
+    /// Whether the service accepts gzip-encoded bodies for requests which
+    /// support them. See TSRequest.shouldCompressBody.
+    @objc
+    public static var requestCompression: Bool {
+        return isEnabled(.requestCompression)
+    }
+
     @objc
     public static var cdsSyncInterval: TimeInterval {
         guard let cdsSyncIntervalString: String = value(.cdsSyncInterval),
@@ -345,6 +352,7 @@ private struct Flags {
         case groupsV2blockingMigrations
         case groupCallingKillSwitch
         case automaticSessionResetKillSwitch
+        case requestCompression
     }
 
     // Values defined in this array remain set once they are
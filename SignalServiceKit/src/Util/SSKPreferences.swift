@@ -101,6 +101,28 @@ public class SSKPreferences: NSObject {
 
     // MARK: -
 
+    private static let hasYdbMigrationCheckpointsKey = "hasYdbMigrationCheckpoints"
+
+    // Set while a YDB-to-GRDB migration has committed some of its records,
+    // so that an interrupted migration can resume rather than starting over.
+    @objc
+    public static func hasYdbMigrationCheckpoints() -> Bool {
+        let appUserDefaults = CurrentAppContext().appUserDefaults()
+        guard let preference = appUserDefaults.object(forKey: hasYdbMigrationCheckpointsKey) as? NSNumber else {
+            return false
+        }
+        return preference.boolValue
+    }
+
+    @objc
+    public static func setHasYdbMigrationCheckpoints(_ value: Bool) {
+        let appUserDefaults = CurrentAppContext().appUserDefaults()
+        appUserDefaults.set(value, forKey: hasYdbMigrationCheckpointsKey)
+        appUserDefaults.synchronize()
+    }
+
+    // MARK: -
+
     private static let didEverUseYdbKey = "didEverUseYdb"
 
     @objc
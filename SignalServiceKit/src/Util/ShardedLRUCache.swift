@@ -0,0 +1,260 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+@objc
+public class AnyShardedLRUCache: NSObject {
+
+    private let backingCache: ShardedLRUCache<NSObject, NSObject>
+
+    @objc
+    public init(maxSize: Int) {
+        backingCache = ShardedLRUCache(maxSize: maxSize)
+    }
+
+    @objc
+    public func get(key: NSObject) -> NSObject? {
+        return self.backingCache.get(key: key)
+    }
+
+    @objc
+    public func set(key: NSObject, value: NSObject) {
+        self.backingCache.set(key: key, value: value)
+    }
+
+    @objc
+    public func remove(key: NSObject) {
+        self.backingCache.remove(key: key)
+    }
+
+    @objc
+    public func clear() {
+        self.backingCache.clear()
+    }
+}
+
+// MARK: -
+
+// A thread-safe cache bounded by the number of entries, for lookups
+// which are hot on several threads at once.
+//
+// LRUCache reorders its entries on every hit, so every reader needs
+// exclusive access to the whole cache. This cache instead splits its
+// entries across shards, each with its own lock, and only approximates
+// recency: a hit just marks its entry as referenced. When a shard is
+// full, a "clock" hand sweeps its entries, giving referenced entries a
+// second chance and evicting the first unreferenced one. Readers of
+// different keys rarely contend, and a hit never moves anything.
+//
+// The cache can optionally also be bounded by the total "cost" of its
+// entries, e.g. the number of bytes of decoded images. Each shard gets
+// an equal share of the cost limit.
+public class ShardedLRUCache<KeyType: Hashable, ValueType> {
+
+    private struct Slot {
+        let key: KeyType
+        var value: ValueType
+        var cost: Int
+        var isReferenced: Bool
+    }
+
+    private class Shard {
+        let lock = UnfairLock()
+        let maxSize: Int
+        let maxCost: Int
+
+        // Guarded by lock.
+        var slots = [Slot]()
+        var slotIndexMap = [KeyType: Int]()
+        var clockHand = 0
+        var totalCost = 0
+
+        init(maxSize: Int, maxCost: Int) {
+            self.maxSize = maxSize
+            self.maxCost = maxCost
+        }
+
+        func get(key: KeyType) -> ValueType? {
+            guard let slotIndex = slotIndexMap[key] else {
+                return nil
+            }
+            slots[slotIndex].isReferenced = true
+            return slots[slotIndex].value
+        }
+
+        func set(key: KeyType, value: ValueType, cost: Int) {
+            defer { evictWhileOverCost(sparing: key) }
+
+            if let slotIndex = slotIndexMap[key] {
+                totalCost += cost - slots[slotIndex].cost
+                slots[slotIndex].value = value
+                slots[slotIndex].cost = cost
+                slots[slotIndex].isReferenced = true
+                return
+            }
+            let slot = Slot(key: key, value: value, cost: cost, isReferenced: false)
+            totalCost += cost
+            guard slots.count >= maxSize else {
+                slotIndexMap[key] = slots.count
+                slots.append(slot)
+                return
+            }
+            let victimIndex = nextVictimIndex(sparing: nil)
+            totalCost -= slots[victimIndex].cost
+            slotIndexMap.removeValue(forKey: slots[victimIndex].key)
+            slotIndexMap[key] = victimIndex
+            slots[victimIndex] = slot
+            clockHand = (victimIndex + 1) % slots.count
+        }
+
+        // Sweep until we find an unreferenced entry. This terminates within
+        // two revolutions, since the sweep clears the bits and at most one
+        // entry is spared.
+        private func nextVictimIndex(sparing sparedKey: KeyType?) -> Int {
+            while slots[clockHand].isReferenced || slots[clockHand].key == sparedKey {
+                slots[clockHand].isReferenced = false
+                clockHand = (clockHand + 1) % slots.count
+            }
+            return clockHand
+        }
+
+        // The entry that was just set is never evicted, even if it alone
+        // exceeds the cost limit.
+        private func evictWhileOverCost(sparing sparedKey: KeyType) {
+            while totalCost > maxCost, slots.count > 1 {
+                remove(key: slots[nextVictimIndex(sparing: sparedKey)].key)
+            }
+        }
+
+        func remove(key: KeyType) {
+            guard let slotIndex = slotIndexMap.removeValue(forKey: key) else {
+                return
+            }
+            totalCost -= slots[slotIndex].cost
+            // Fill the hole with the last slot.
+            let lastSlot = slots.removeLast()
+            if slotIndex < slots.count {
+                slots[slotIndex] = lastSlot
+                slotIndexMap[lastSlot.key] = slotIndex
+            }
+            if clockHand >= slots.count {
+                clockHand = 0
+            }
+        }
+
+        func clear() {
+            slots.removeAll()
+            slotIndexMap.removeAll()
+            clockHand = 0
+            totalCost = 0
+        }
+    }
+
+    private let shards: [Shard]
+    private let costBlock: ((ValueType) -> Int)?
+
+    public init(maxSize: Int,
+                shardCount: Int = 8,
+                maxCost: Int = .max,
+                cost costBlock: ((ValueType) -> Int)? = nil) {
+        owsAssertDebug(maxSize > 0)
+        owsAssertDebug(shardCount > 0)
+        owsAssertDebug(maxCost > 0)
+
+        // Small caches get fewer shards, so that each can hold at least one entry.
+        let shardCount = max(1, min(shardCount, maxSize))
+        let shardMaxSize = max(1, (maxSize + shardCount - 1) / shardCount)
+        let shardMaxCost = maxCost == .max ? .max : max(1, maxCost / shardCount)
+        self.shards = (0..<shardCount).map { _ in Shard(maxSize: shardMaxSize, maxCost: shardMaxCost) }
+        self.costBlock = costBlock
+
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didReceiveMemoryWarning),
+                                               name: UIApplication.didReceiveMemoryWarningNotification,
+                                               object: nil)
+        NotificationCenter.default.addObserver(self,
+                                               selector: #selector(didEnterBackground),
+                                               name: .OWSApplicationDidEnterBackground,
+                                               object: nil)
+    }
+
+    deinit {
+        NotificationCenter.default.removeObserver(self)
+    }
+
+    @objc func didEnterBackground() {
+        AssertIsOnMainThread()
+
+        clear()
+    }
+
+    @objc func didReceiveMemoryWarning() {
+        AssertIsOnMainThread()
+
+        clear()
+    }
+
+    private func shard(forKey key: KeyType) -> Shard {
+        // hashValue may be negative.
+        let hash = UInt(bitPattern: key.hashValue)
+        return shards[Int(hash % UInt(shards.count))]
+    }
+
+    public func get(key: KeyType) -> ValueType? {
+        let shard = self.shard(forKey: key)
+        return shard.lock.withLock { shard.get(key: key) }
+    }
+
+    private func cost(of value: ValueType) -> Int {
+        costBlock?(value) ?? 0
+    }
+
+    public func set(key: KeyType, value: ValueType) {
+        let shard = self.shard(forKey: key)
+        let cost = self.cost(of: value)
+        shard.lock.withLock { shard.set(key: key, value: value, cost: cost) }
+    }
+
+    /// Atomically replaces the value for a key. Returning nil removes it.
+    public func update(key: KeyType, block: (ValueType?) -> ValueType?) {
+        let shard = self.shard(forKey: key)
+        shard.lock.withLock {
+            if let value = block(shard.get(key: key)) {
+                shard.set(key: key, value: value, cost: cost(of: value))
+            } else {
+                shard.remove(key: key)
+            }
+        }
+    }
+
+    public func remove(key: KeyType) {
+        let shard = self.shard(forKey: key)
+        shard.lock.withLock { shard.remove(key: key) }
+    }
+
+    public func clear() {
+        for shard in shards {
+            shard.lock.withLock { shard.clear() }
+        }
+    }
+
+    /// The total cost of the entries, across all shards.
+    public var totalCost: Int {
+        shards.reduce(0) { sum, shard in
+            sum + shard.lock.withLock { shard.totalCost }
+        }
+    }
+}
+
+// MARK: -
+
+extension ShardedLRUCache: MemoryAccountable {
+    // This assumes that the cost of an entry is its size in bytes.
+    public var estimatedByteCount: Int { totalCost }
+
+    public func shedMemory() {
+        clear()
+    }
+}
@@ -0,0 +1,162 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import os
+
+/// The intervals we trace with os_signpost, so that they show up in the
+/// Instruments timeline ("os_signpost" and "Points of Interest").
+///
+/// Each interval belongs to a category, which Instruments shows as its own
+/// track.
+@objc
+public enum SignpostInterval: Int {
+    case databaseRead
+    case databaseUIRead
+    case databaseWrite
+    case messageDecrypt
+    case messageProcess
+    case messageSend
+    case messageSendPrepare
+    case messageSendRequest
+    case conversationLoad
+    case conversationMeasure
+    case conversationRender
+    case attachmentDownload
+    case attachmentDecrypt
+    case attachmentThumbnail
+    case launchPhase
+    case readyFlagBlock
+
+    fileprivate var category: SignpostCategory {
+        switch self {
+        case .databaseRead, .databaseUIRead, .databaseWrite:
+            return .database
+        case .messageDecrypt, .messageProcess:
+            return .messageProcessing
+        case .messageSend, .messageSendPrepare, .messageSendRequest:
+            return .messageSending
+        case .conversationLoad, .conversationMeasure, .conversationRender:
+            return .conversationView
+        case .attachmentDownload, .attachmentDecrypt, .attachmentThumbnail:
+            return .attachments
+        case .launchPhase, .readyFlagBlock:
+            return .launch
+        }
+    }
+
+    // os_signpost requires a static name.
+    fileprivate var name: StaticString {
+        switch self {
+        case .databaseRead: return "Read"
+        case .databaseUIRead: return "UI Read"
+        case .databaseWrite: return "Write"
+        case .messageDecrypt: return "Decrypt"
+        case .messageProcess: return "Process"
+        case .messageSend: return "Send"
+        case .messageSendPrepare: return "Prepare"
+        case .messageSendRequest: return "Send Request"
+        case .conversationLoad: return "Load"
+        case .conversationMeasure: return "Measure"
+        case .conversationRender: return "Render"
+        case .attachmentDownload: return "Download"
+        case .attachmentDecrypt: return "Decrypt"
+        case .attachmentThumbnail: return "Thumbnail"
+        case .launchPhase: return "Launch Phase"
+        case .readyFlagBlock: return "Ready Block"
+        }
+    }
+}
+
+// MARK: -
+
+private enum SignpostCategory: String, CaseIterable {
+    case database = "Database"
+    case messageProcessing = "Message Processing"
+    case messageSending = "Message Sending"
+    case conversationView = "Conversation View"
+    case attachments = "Attachments"
+    case launch = "Launch"
+
+    static let logs: [SignpostCategory: OSLog] = {
+        var result = [SignpostCategory: OSLog]()
+        for category in allCases {
+            result[category] = OSLog(subsystem: "org.whispersystems.signal", category: category.rawValue)
+        }
+        return result
+    }()
+
+    var log: OSLog { Self.logs[self]! }
+}
+
+// MARK: -
+
+/// Traces intervals with os_signpost.
+///
+///     let signpostId = Signposts.begin(.attachmentDownload, attachmentId)
+///     ...
+///     Signposts.end(.attachmentDownload, signpostId)
+///
+/// or, for synchronous work:
+///
+///     Signposts.measure(.messageProcess) {
+///         ...
+///     }
+///
+/// Tracing is only enabled in internal builds (see DebugFlags.signposts).
+/// Otherwise these do nothing, and the messages aren't built.
+@objc
+public class Signposts: NSObject {
+
+    @objc
+    public static let isEnabled: Bool = {
+        guard DebugFlags.signposts else {
+            return false
+        }
+        guard #available(iOS 12, *) else {
+            return false
+        }
+        return true
+    }()
+
+    /// Returns the id to end the interval with, or zero if tracing is disabled.
+    public static func begin(_ interval: SignpostInterval, _ message: @autoclosure () -> String = "") -> UInt64 {
+        guard isEnabled, #available(iOS 12, *) else {
+            return 0
+        }
+        let log = interval.category.log
+        let signpostId = OSSignpostID(log: log)
+        os_signpost(.begin, log: log, name: interval.name, signpostID: signpostId, "%{public}@", message() as NSString)
+        return signpostId.rawValue
+    }
+
+    public static func end(_ interval: SignpostInterval, _ signpostId: UInt64) {
+        guard isEnabled, signpostId != 0, #available(iOS 12, *) else {
+            return
+        }
+        let log = interval.category.log
+        os_signpost(.end, log: log, name: interval.name, signpostID: OSSignpostID(signpostId))
+    }
+
+    public static func measure<T>(_ interval: SignpostInterval,
+                                  _ message: @autoclosure () -> String = "",
+                                  block: () throws -> T) rethrows -> T {
+        guard isEnabled else {
+            return try block()
+        }
+        let signpostId = begin(interval, message())
+        defer { end(interval, signpostId) }
+        return try block()
+    }
+
+    @objc(beginInterval:)
+    public static func objcBegin(_ interval: SignpostInterval) -> UInt64 {
+        begin(interval)
+    }
+
+    @objc(endInterval:signpostId:)
+    public static func objcEnd(_ interval: SignpostInterval, signpostId: UInt64) {
+        end(interval, signpostId)
+    }
+}
@@ -0,0 +1,66 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// Coalesces concurrent work with the same key: while work for a key is in
+// flight, further requests for that key share its result instead of
+// starting their own.
+//
+// Only use this for idempotent work whose result can safely be shared by
+// every caller.
+public class Singleflight<Value> {
+
+    private let label: String
+
+    private let lock = UnfairLock()
+
+    // These properties should only be accessed while holding the lock.
+    private var inFlightPromises = [String: Promise<Value>]()
+    private var _coalescedCount: UInt = 0
+
+    public init(label: String) {
+        self.label = label
+    }
+
+    /// The number of requests which shared in-flight work.
+    public var coalescedCount: UInt {
+        lock.withLock { _coalescedCount }
+    }
+
+    public func perform(key: String, _ block: () -> Promise<Value>) -> Promise<Value> {
+        let (promise, resolver) = Promise<Value>.pending()
+        let existingPromise: Promise<Value>? = lock.withLock {
+            if let existingPromise = inFlightPromises[key] {
+                _coalescedCount += 1
+                return existingPromise
+            }
+            inFlightPromises[key] = promise
+            return nil
+        }
+        if let existingPromise = existingPromise {
+            Logger.verbose("\(label): coalesced request, \(coalescedCount) total.")
+            return existingPromise
+        }
+
+        // Start the work outside the lock, in case it completes synchronously.
+        block().done(on: .global()) { value in
+            self.complete(key: key, promise: promise)
+            resolver.fulfill(value)
+        }.catch(on: .global()) { error in
+            self.complete(key: key, promise: promise)
+            resolver.reject(error)
+        }
+        return promise
+    }
+
+    private func complete(key: String, promise: Promise<Value>) {
+        lock.withLock {
+            if inFlightPromises[key] === promise {
+                inFlightPromises.removeValue(forKey: key)
+            }
+        }
+    }
+}
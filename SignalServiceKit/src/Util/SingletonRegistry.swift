@@ -0,0 +1,201 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+
+/// Records how long each of the environments' singletons took to construct
+/// and what they depend on, so that we can see which contribute to the
+/// cost of a cold launch.
+///
+/// AppSetup constructs most singletons eagerly, through this registry, and
+/// logs a report once the environments are set up. Singletons which aren't
+/// needed before the first frame are constructed lazily (see LazySingleton)
+/// and logged as they are constructed.
+///
+/// Dependencies are the singletons a singleton is injected with, plus any
+/// lazy singletons it constructs while it is being constructed.
+///
+/// This class is thread-safe.
+@objc
+public class SingletonRegistry: NSObject {
+
+    @objc
+    public static let shared = SingletonRegistry()
+
+    public struct Entry {
+        public let name: String
+        // Includes the construction of any lazy dependencies.
+        public let duration: CFTimeInterval
+        public let dependencies: [String]
+        public let isLazy: Bool
+    }
+
+    // The names of the singletons being constructed on a given thread,
+    // each with the dependencies it has constructed so far.
+    private class ConstructionStack {
+        var frames = [(name: String, dependencies: [String])]()
+    }
+
+    private static let constructionStackKey = "SingletonRegistry.constructionStack"
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var entries = [Entry]()
+    private var hasLoggedReport = false
+
+    private override init() {
+        super.init()
+    }
+
+    // MARK: -
+
+    public func construct<T>(_ name: String,
+                             dependencies: [String] = [],
+                             isLazy: Bool = false,
+                             block: () -> T) -> T {
+        let constructionStack = Self.currentConstructionStack
+        constructionStack.frames.append((name: name, dependencies: dependencies))
+
+        let startTime = CACurrentMediaTime()
+        let value = block()
+        let duration = CACurrentMediaTime() - startTime
+
+        let frame = constructionStack.frames.removeLast()
+        if !constructionStack.frames.isEmpty {
+            constructionStack.frames[constructionStack.frames.count - 1].dependencies.append(name)
+        }
+
+        let entry = Entry(name: name, duration: duration, dependencies: frame.dependencies, isLazy: isLazy)
+        let shouldLogEntry: Bool = unfairLock.withLock {
+            entries.append(entry)
+            return hasLoggedReport
+        }
+        if shouldLogEntry {
+            Logger.info("Constructed singleton " + Self.logLine(entry: entry))
+        }
+        return value
+    }
+
+    @objc(constructSingletonNamed:dependencies:block:)
+    public func constructObjc(name: String, dependencies: [String], block: () -> AnyObject) -> AnyObject {
+        construct(name, dependencies: dependencies, block: block)
+    }
+
+    public var allEntries: [Entry] {
+        unfairLock.withLock { entries }
+    }
+
+    private static var currentConstructionStack: ConstructionStack {
+        let threadDictionary = Thread.current.threadDictionary
+        if let constructionStack = threadDictionary[constructionStackKey] as? ConstructionStack {
+            return constructionStack
+        }
+        let constructionStack = ConstructionStack()
+        threadDictionary[constructionStackKey] = constructionStack
+        return constructionStack
+    }
+
+    // MARK: - Logging
+
+    // Singletons constructed after the report is logged are logged individually.
+    @objc
+    public func logReport() {
+        let report: String? = unfairLock.withLock {
+            guard !hasLoggedReport else {
+                return nil
+            }
+            hasLoggedReport = true
+
+            let totalDuration = entries.reduce(0) { $0 + ($1.isLazy ? 0 : $1.duration) }
+            var lines = ["Singletons, slowest first:"]
+            for entry in entries.sorted(by: { $0.duration > $1.duration }) {
+                lines.append("  " + Self.logLine(entry: entry))
+            }
+            lines.append(String(format: "  Total: %0.1fms for %lu eager singletons.",
+                                totalDuration * 1000,
+                                entries.filter { !$0.isLazy }.count))
+            return lines.joined(separator: "\n")
+        }
+        if let report = report {
+            Logger.info(report)
+        }
+    }
+
+    private static func logLine(entry: Entry) -> String {
+        var line = String(format: "%@: %0.1fms", entry.name, entry.duration * 1000)
+        if entry.isLazy {
+            line += " (lazy)"
+        }
+        if !entry.dependencies.isEmpty {
+            line += ", depends on: " + entry.dependencies.joined(separator: ", ")
+        }
+        return line
+    }
+}
+
+// MARK: -
+
+/// Constructs a singleton the first time it is accessed, rather than when
+/// the environment is set up, and records its construction in the
+/// SingletonRegistry.
+///
+/// This should only be used for singletons whose initializers have no side
+/// effects that the app relies upon, e.g. registering observers or
+/// AppReadiness blocks.
+///
+/// This class is thread-safe.
+@objc
+public class LazySingleton: NSObject {
+
+    public typealias Block = () -> AnyObject
+
+    private let name: String
+    private let dependencies: [String]
+
+    // The properties below should only be accessed with unfairLock.
+    private let unfairLock = UnfairLock()
+    private var block: Block?
+    private var value: AnyObject?
+
+    @objc
+    public init(name: String, dependencies: [String], block: @escaping Block) {
+        self.name = name
+        self.dependencies = dependencies
+        self.block = block
+
+        super.init()
+    }
+
+    @objc
+    public convenience init(name: String, block: @escaping Block) {
+        self.init(name: name, dependencies: [], block: block)
+    }
+
+    @objc
+    public var isConstructed: Bool {
+        unfairLock.withLock { value != nil }
+    }
+
+    @objc
+    public func get() -> AnyObject {
+        // Singletons should not depend on themselves, even indirectly; that
+        // would deadlock.
+        unfairLock.withLock {
+            if let value = value {
+                return value
+            }
+            guard let block = block else {
+                owsFail("Missing block.")
+            }
+            let value = SingletonRegistry.shared.construct(name,
+                                                           dependencies: dependencies,
+                                                           isLazy: true,
+                                                           block: block)
+            self.value = value
+            // Release anything the block captured.
+            self.block = nil
+            return value
+        }
+    }
+}
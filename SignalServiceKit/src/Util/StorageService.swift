@@ -253,7 +253,7 @@ public struct StorageService {
             builder.setManifest(try manifestWrapperBuilder.build())
 
             // Encrypt the new items
-            builder.setInsertItem(try newItems.map { item in
+            builder.setInsertItem(try newItems.concurrentMap { item in
                 let itemData = try item.record.serializedData()
                 let encryptedItemData = try KeyBackupService.encrypt(
                     keyType: .storageServiceRecord(identifier: item.identifier),
@@ -330,7 +330,7 @@ public struct StorageService {
 
             let keyToIdentifier = Dictionary(uniqueKeysWithValues: keys.map { ($0.data, $0) })
 
-            return try itemsProto.items.map { item in
+            return try itemsProto.items.concurrentMap { item in
                 let encryptedItemData = item.value
                 guard let itemIdentifier = keyToIdentifier[item.key] else {
                     owsFailDebug("missing identifier for fetched item")
@@ -409,6 +409,8 @@ public struct StorageService {
             // Some 4xx responses are expected;
             // we'll discriminate the status code ourselves.
             urlSession.require2xxOr3xx = false
+            // Storage service sync is never urgent.
+            urlSession.requestPriority = .background
             return urlSession.dataTaskPromise(endpoint,
                                               method: method,
                                               headers: headers,
@@ -633,6 +635,32 @@ public extension StorageService {
 
 // MARK: -
 
+fileprivate extension Array {
+
+    // Below this many elements, the cost of dispatching outweighs the
+    // benefit of encrypting or decrypting items in parallel.
+    static var concurrentMapThreshold: Int { 8 }
+
+    /// Like `map`, but transforms the elements in parallel. The results are
+    /// returned in the original order. If any transform throws, the error
+    /// for the lowest index is rethrown.
+    func concurrentMap<T>(_ transform: (Element) throws -> T) throws -> [T] {
+        guard count >= Self.concurrentMapThreshold else {
+            return try map(transform)
+        }
+
+        var results = [Result<T, Error>?](repeating: nil, count: count)
+        let lock = UnfairLock()
+        DispatchQueue.concurrentPerform(iterations: count) { index in
+            let result = Result { try transform(self[index]) }
+            lock.withLock { results[index] = result }
+        }
+        return try results.map { try $0!.get() }
+    }
+}
+
+// MARK: -
+
 extension StorageServiceProtoManifestRecordKeyType: Codable {}
 
 extension StorageServiceProtoManifestRecordKeyType: CustomStringConvertible {
@@ -0,0 +1,216 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import PromiseKit
+
+// A dispatch queue which knows whether it is the current queue.
+//
+// PromiseKit dispatches every step of a chain onto the step's queue, even
+// when the previous step finished on that same queue. A chain of several
+// cheap steps therefore allocates a block and may switch threads once per
+// step. The Thenable overloads below which take a TaskQueue instead run a
+// step immediately if the previous step finished on the step's queue, and
+// only dispatch it otherwise. A chain then only hops when it changes
+// queues, e.g. when a network request completes.
+//
+// Steps can also share a TaskCancellation: once it is cancelled, steps
+// which haven't started yet are skipped and the chain fails with
+// PMKError.cancelled.
+public final class TaskQueue {
+    public let dispatchQueue: DispatchQueue
+
+    private let specificKey = DispatchSpecificKey<Void>()
+
+    public init(label: String,
+                qos: DispatchQoS = .unspecified,
+                attributes: DispatchQueue.Attributes = []) {
+        dispatchQueue = DispatchQueue(label: label,
+                                      qos: qos,
+                                      attributes: attributes,
+                                      autoreleaseFrequency: .workItem)
+        dispatchQueue.setSpecific(key: specificKey, value: ())
+    }
+
+    public var isCurrent: Bool {
+        return DispatchQueue.getSpecific(key: specificKey) != nil
+    }
+
+    // Runs the block immediately if called on this queue; otherwise
+    // dispatches it asynchronously.
+    public func perform(_ block: @escaping () -> Void) {
+        guard !isCurrent else {
+            block()
+            return
+        }
+
+        #if TESTABLE_BUILD
+        dispatchCount.increment()
+        #endif
+
+        dispatchQueue.async(execute: block)
+    }
+
+    #if TESTABLE_BUILD
+    // The number of blocks which were dispatched onto the queue rather
+    // than run immediately.
+    let dispatchCount = AtomicUInt(0)
+    #endif
+}
+
+// MARK: -
+
+// Cancels the steps of one or more promise chains which haven't started
+// yet. Cancelling a cancellation also cancels its children, so that work
+// can be cancelled as a whole or in part.
+public final class TaskCancellation {
+    private let unfairLock = UnfairLock()
+    private var isCancelledValue = false
+    private var children = [TaskCancellation]()
+
+    public init() {}
+
+    public var isCancelled: Bool {
+        unfairLock.withLock { isCancelledValue }
+    }
+
+    public func cancel() {
+        let children = unfairLock.withLock { () -> [TaskCancellation] in
+            guard !isCancelledValue else {
+                return []
+            }
+            isCancelledValue = true
+            let children = self.children
+            self.children = []
+            return children
+        }
+        for child in children {
+            child.cancel()
+        }
+    }
+
+    public func makeChild() -> TaskCancellation {
+        let child = TaskCancellation()
+        let isCancelled = unfairLock.withLock { () -> Bool in
+            if !isCancelledValue {
+                children.append(child)
+            }
+            return isCancelledValue
+        }
+        if isCancelled {
+            child.cancel()
+        }
+        return child
+    }
+
+    public func throwIfCancelled() throws {
+        guard isCancelled else { return }
+        throw PMKError.cancelled
+    }
+}
+
+// MARK: -
+
+public func firstly<U: Thenable>(on taskQueue: TaskQueue,
+                                 cancellation: TaskCancellation? = nil,
+                                 execute body: @escaping () throws -> U) -> Promise<U.T> {
+    return Guarantee.value(()).then(on: taskQueue, cancellation: cancellation, body)
+}
+
+public func firstly<T>(on taskQueue: TaskQueue,
+                       cancellation: TaskCancellation? = nil,
+                       execute body: @escaping () throws -> T) -> Promise<T> {
+    return Guarantee.value(()).map(on: taskQueue, cancellation: cancellation, body)
+}
+
+public extension Thenable {
+
+    func then<U: Thenable>(on taskQueue: TaskQueue,
+                           cancellation: TaskCancellation? = nil,
+                           _ body: @escaping (T) throws -> U) -> Promise<U.T> {
+        let (promise, resolver) = Promise<U.T>.pending()
+        pipe { result in
+            switch result {
+            case .fulfilled(let value):
+                taskQueue.perform {
+                    do {
+                        try cancellation?.throwIfCancelled()
+                        try body(value).pipe(to: resolver.resolve)
+                    } catch {
+                        resolver.reject(error)
+                    }
+                }
+            case .rejected(let error):
+                resolver.reject(error)
+            }
+        }
+        return promise
+    }
+
+    func map<U>(on taskQueue: TaskQueue,
+                cancellation: TaskCancellation? = nil,
+                _ body: @escaping (T) throws -> U) -> Promise<U> {
+        return then(on: taskQueue, cancellation: cancellation) { value in
+            Promise.value(try body(value))
+        }
+    }
+
+    func done(on taskQueue: TaskQueue,
+              cancellation: TaskCancellation? = nil,
+              _ body: @escaping (T) throws -> Void) -> Promise<Void> {
+        return map(on: taskQueue, cancellation: cancellation, body)
+    }
+
+    func recover(on taskQueue: TaskQueue, _ body: @escaping (Error) throws -> Promise<T>) -> Promise<T> {
+        let (promise, resolver) = Promise<T>.pending()
+        pipe { result in
+            switch result {
+            case .fulfilled(let value):
+                resolver.fulfill(value)
+            case .rejected(let error):
+                taskQueue.perform {
+                    do {
+                        try body(error).pipe(to: resolver.resolve)
+                    } catch {
+                        resolver.reject(error)
+                    }
+                }
+            }
+        }
+        return promise
+    }
+
+    func ensure(on taskQueue: TaskQueue, _ body: @escaping () -> Void) -> Promise<T> {
+        let (promise, resolver) = Promise<T>.pending()
+        pipe { result in
+            taskQueue.perform {
+                body()
+                resolver.resolve(result)
+            }
+        }
+        return promise
+    }
+
+    // Like PromiseKit's catch, this ignores cancellation.
+    func `catch`(on taskQueue: TaskQueue, _ body: @escaping (Error) -> Void) {
+        pipe { result in
+            guard case .rejected(let error) = result, !error.isCancelled else {
+                return
+            }
+            taskQueue.perform {
+                body(error)
+            }
+        }
+    }
+}
+
+public extension Thenable where T == Void {
+
+    func recover(on taskQueue: TaskQueue, _ body: @escaping (Error) throws -> Void) -> Promise<Void> {
+        return recover(on: taskQueue) { (error: Error) -> Promise<Void> in
+            try body(error)
+            return Promise.value(())
+        }
+    }
+}
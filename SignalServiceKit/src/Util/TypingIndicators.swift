@@ -247,6 +247,24 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
         private var sendPauseTimer: Timer?
         private var sendRefreshTimer: Timer?
 
+        // Each typing message is encrypted for and sent to every device of
+        // every member, so we send fewer of them in larger groups.
+        //
+        // Above this size, we don't send "stopped" messages; recipients
+        // stop displaying the indicator on their own after 15 seconds, or
+        // when our next message arrives.
+        static let maxRecipientsForStoppedMessages = 25
+        // Above this size, we don't send typing messages at all.
+        static let maxRecipientsForTypingMessages = 100
+
+        // We only send one typing message per thread at a time. If the
+        // action changes while it is in flight, only the latest action is
+        // sent once it completes.
+        private var isSendInFlight = false
+        private var pendingAction: TypingIndicatorAction?
+        // The action recipients were last told of, if any.
+        private var lastSentAction: TypingIndicatorAction?
+
         init(delegate: TypingIndicators, thread: TSThread) {
             self.delegate = delegate
             self.thread = thread
@@ -333,6 +351,18 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
 
             sendPauseTimer?.invalidate()
             sendPauseTimer = nil
+
+            // Recipients stop displaying the indicator when they receive
+            // the message.
+            lastSentAction = nil
+            pendingAction = nil
+        }
+
+        private var recipientCount: Int {
+            guard let groupThread = thread as? TSGroupThread else {
+                return 1
+            }
+            return max(0, groupThread.groupModel.groupMembership.fullMembers.count - 1)
         }
 
         private func sendTypingMessageIfNecessary(forThread thread: TSThread, action: TypingIndicatorAction) {
@@ -349,9 +379,47 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
                 return
             }
 
+            let recipientCount = self.recipientCount
+            guard recipientCount <= Self.maxRecipientsForTypingMessages else {
+                return
+            }
+            if action == .stopped, recipientCount > Self.maxRecipientsForStoppedMessages {
+                return
+            }
+
+            guard !isSendInFlight else {
+                pendingAction = action
+                return
+            }
+            guard action != .stopped || lastSentAction == .started else {
+                // Recipients don't think we're typing.
+                return
+            }
+
+            isSendInFlight = true
+            lastSentAction = action
+
+            let startTime = CACurrentMediaTime()
             let message = TypingIndicatorMessage(thread: thread, action: action)
             firstly {
                 messageSender.sendMessage(.promise, message.asPreparer)
+            }.ensure {
+                let sendDuration = CACurrentMediaTime() - startTime
+                let logLine = String(format: "Sent typing message (%@) to %ld recipients in %0.3fs.",
+                                     "\(action)", recipientCount, sendDuration)
+                if recipientCount > Self.maxRecipientsForStoppedMessages {
+                    Logger.info(logLine)
+                } else {
+                    Logger.verbose(logLine)
+                }
+
+                self.isSendInFlight = false
+                if let pendingAction = self.pendingAction {
+                    self.pendingAction = nil
+                    if pendingAction != self.lastSentAction {
+                        self.sendTypingMessageIfNecessary(forThread: thread, action: pendingAction)
+                    }
+                }
             }.catch { error in
                 Logger.error("Error: \(error)")
             }
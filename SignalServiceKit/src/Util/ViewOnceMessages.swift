@@ -4,6 +4,7 @@
 
 import Foundation
 import SignalCoreKit
+import GRDB
 
 @objc
 public class ViewOnceMessages: NSObject {
@@ -32,9 +33,7 @@ public class ViewOnceMessages: NSObject {
     public class func appDidBecomeReady() {
         AssertIsOnMainThread()
 
-        DispatchQueue.global().async {
-            self.checkForAutoCompletion()
-        }
+        checkForAutoCompletion()
     }
 
     // "Check for auto-completion", e.g. complete messages whether or
@@ -42,14 +41,7 @@ public class ViewOnceMessages: NSObject {
     // sent messages. We need to repeat this check periodically while
     // the app is running.
     private class func checkForAutoCompletion() {
-        // Find all view-once messages which are not yet complete.
-        // Complete messages if necessary.
-        databaseStorage.write { (transaction) in
-            let messages = AnyViewOnceMessageFinder().allMessagesWithViewOnceMessage(transaction: transaction)
-            for message in messages {
-                completeIfNecessary(message: message, transaction: transaction)
-            }
-        }
+        MessageContentSweeper.scheduleSweep()
 
         // We need to "check for auto-completion" once per day.
         DispatchQueue.global().asyncAfter(wallDeadline: .now() + kDayInterval) {
@@ -57,6 +49,35 @@ public class ViewOnceMessages: NSObject {
         }
     }
 
+    // Completes the next batch of messages which are due for completion.
+    // Returns the row id of the last message considered, or nil if there
+    // are no more candidates.
+    class func completeDueMessages(afterRowId rowId: Int64,
+                                   limit: Int,
+                                   transaction: SDSAnyWriteTransaction) -> Int64? {
+        switch transaction.writeTransaction {
+        case .yapWrite:
+            let messages = AnyViewOnceMessageFinder().allMessagesWithViewOnceMessage(transaction: transaction)
+            for message in messages {
+                completeIfNecessary(message: message, transaction: transaction)
+            }
+            return nil
+        case .grdbWrite(let grdbWrite):
+            let autoCompleteCutoffMs = nowMs() - autoCompleteIntervalMs
+            let messages = GRDBViewOnceMessageFinder().completionCandidates(afterRowId: rowId,
+                                                                          autoCompleteCutoffMs: autoCompleteCutoffMs,
+                                                                          limit: limit,
+                                                                          transaction: grdbWrite)
+            for message in messages {
+                completeIfNecessary(message: message, transaction: transaction)
+            }
+            guard messages.count == limit, let lastRowId = messages.last?.grdbId else {
+                return nil
+            }
+            return lastRowId.int64Value
+        }
+    }
+
     @objc
     public class func completeIfNecessary(message: TSMessage,
                                           transaction: SDSAnyWriteTransaction) {
@@ -101,8 +122,10 @@ public class ViewOnceMessages: NSObject {
     }
 
     // We auto-complete messages after 30 days, even if the user hasn't seen them.
+    private static let autoCompleteIntervalMs: UInt64 = 30 * kDayInMs
+
     private class func shouldMessageAutoComplete(_ message: TSMessage) -> Bool {
-        let autoCompleteDeadlineMs = min(message.timestamp, message.receivedAtTimestamp) + 30 * kDayInMs
+        let autoCompleteDeadlineMs = min(message.timestamp, message.receivedAtTimestamp) + autoCompleteIntervalMs
         return nowMs() >= autoCompleteDeadlineMs
     }
 
@@ -312,6 +335,52 @@ class GRDBViewOnceMessageFinder: ViewOnceMessageFinder {
 
 // MARK: -
 
+extension GRDBViewOnceMessageFinder {
+    // Incomplete view-once messages which have passed their auto-complete
+    // deadline or which may have been sent, in row id order.
+    func completionCandidates(afterRowId rowId: Int64,
+                              autoCompleteCutoffMs: UInt64,
+                              limit: Int,
+                              transaction: GRDBReadTransaction) -> [TSMessage] {
+        let sql = """
+        SELECT * FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .isViewOnceMessage) IS NOT NULL
+        AND \(interactionColumn: .isViewOnceMessage) == TRUE
+        AND \(interactionColumn: .isViewOnceComplete) IS NOT NULL
+        AND \(interactionColumn: .isViewOnceComplete) == FALSE
+        AND \(interactionColumn: .id) > ?
+        AND (
+            MIN(\(interactionColumn: .timestamp), \(interactionColumn: .receivedAtTimestamp)) <= ?
+            OR \(interactionColumn: .storedMessageState) = ?
+        )
+        ORDER BY \(interactionColumn: .id)
+        LIMIT ?
+        """
+        let arguments: StatementArguments = [rowId,
+                                             autoCompleteCutoffMs,
+                                             TSOutgoingMessageState.sent.rawValue,
+                                             limit]
+        let cursor = TSInteraction.grdbFetchCursor(sql: sql,
+                                                   arguments: arguments,
+                                                   transaction: transaction)
+        var result = [TSMessage]()
+        do {
+            while let next = try cursor.next() {
+                guard let message = next as? TSMessage else {
+                    owsFailDebug("expecting message but found: \(next)")
+                    continue
+                }
+                result.append(message)
+            }
+        } catch {
+            owsFailDebug("unexpected error \(error)")
+        }
+        return result
+    }
+}
+
+// MARK: -
+
 class YAPDBViewOnceMessageFinder: ViewOnceMessageFinder {
     public func enumerateAllIncompleteViewOnceMessages(transaction: YapDatabaseReadTransaction, block: @escaping EnumerateTSMessageBlock) {
         guard let dbView = TSDatabaseView.incompleteViewOnceMessagesDatabaseView(transaction) as? YapDatabaseViewTransaction else {
@@ -855,7 +855,7 @@ public class GroupManager: NSObject {
         }
 
         return firstly { () -> Promise<Void> in
-            self.tryToEnableGroupsV2(for: Array(proposedGroupModel.groupMembership.allMembersOfAnyKind), isBlocking: true, ignoreErrors: true)
+            self.tryToPrepareNewMembersV2(oldGroupModel: oldGroupModel, newGroupModel: proposedGroupModel)
         }.then(on: .global()) { () -> Promise<Void> in
             return self.ensureLocalProfileHasCommitmentIfNecessary()
         }.then(on: DispatchQueue.global()) { () -> Promise<String?> in
@@ -923,6 +923,41 @@ public class GroupManager: NSObject {
         }
     }
 
+    // Adding many members at once (e.g. from a list) used to fetch the
+    // capabilities of every member of the group and then, while building
+    // the change proto, the profile key credentials of the new members.
+    //
+    // Instead, we fetch the capabilities and profile key credentials of
+    // just the new members, all at once and before we separate out the
+    // members we need to invite. ProfileFetchScheduler bounds how many
+    // fetches are in flight. Errors are ignored; members we can't get
+    // a credential for are invited and members that don't support
+    // groups v2 are skipped, so that one member can't fail the update.
+    private static func tryToPrepareNewMembersV2(oldGroupModel: TSGroupModelV2,
+                                                 newGroupModel: TSGroupModelV2) -> Promise<Void> {
+        let oldGroupMembership = oldGroupModel.groupMembership
+        let newGroupMembership = newGroupModel.groupMembership
+        var newMembers = newGroupMembership.allMembersOfAnyKind.subtracting(oldGroupMembership.allMembersOfAnyKind)
+        // Invited and requesting members that we're adding also need credentials.
+        newMembers.formUnion(newGroupMembership.fullMembers.subtracting(oldGroupMembership.fullMembers))
+        guard !newMembers.isEmpty else {
+            return Promise.value(())
+        }
+
+        let startDate = Date()
+        return firstly { () -> Promise<Void> in
+            self.tryToEnableGroupsV2(for: Array(newMembers), isBlocking: true, ignoreErrors: true)
+        }.then(on: .global()) { () -> Promise<Void> in
+            self.groupsV2.tryToEnsureProfileKeyCredentials(for: Array(newMembers))
+        }.recover(on: .global()) { error -> Guarantee<Void> in
+            Logger.warn("Error: \(error).")
+            return Guarantee.value(())
+        }.done(on: .global()) {
+            let duration = abs(startDate.timeIntervalSinceNow)
+            Logger.info("Prepared \(newMembers.count) new members in \(String(format: "%.2f", duration))s.")
+        }
+    }
+
     // If dmConfiguration is nil, don't change the disappearing messages configuration.
     private static func updateInfoV1(groupModel proposedGroupModel: TSGroupModel,
                                      dmConfiguration: OWSDisappearingMessagesConfiguration?,
@@ -1573,11 +1608,9 @@ public class GroupManager: NSObject {
             }
             if isBlocking {
                 // Block on the outcome of the profile updates.
-                var promises = [Promise<Void>]()
-                for address in addressesWithoutCapability {
-                    promises.append(self.profileManager.fetchProfile(forAddressPromise: address).asVoid())
-                }
-                return when(fulfilled: promises)
+                return ProfileFetchScheduler.shared.fetchProfiles(addresses: addressesWithoutCapability,
+                                                                  mainAppOnly: false,
+                                                                  ignoreThrottling: true)
             } else {
                 // This will throttle, de-bounce, etc.
                 self.bulkProfileFetch.fetchProfiles(addresses: addressesWithoutCapability)
@@ -2190,6 +2223,138 @@ public class GroupManager: NSObject {
         return UpsertGroupResult(action: .updatedWithUserFacingChanges, groupThread: groupThread)
     }
 
+    public struct GroupThreadUpdate {
+        public let newGroupModel: TSGroupModel
+        // If nil, don't update the disappearing messages configuration.
+        public let newDisappearingMessageToken: DisappearingMessageToken?
+        public let groupUpdateSourceAddress: SignalServiceAddress?
+
+        public init(newGroupModel: TSGroupModel,
+                    newDisappearingMessageToken: DisappearingMessageToken?,
+                    groupUpdateSourceAddress: SignalServiceAddress?) {
+            self.newGroupModel = newGroupModel
+            self.newDisappearingMessageToken = newDisappearingMessageToken
+            self.groupUpdateSourceAddress = groupUpdateSourceAddress
+        }
+    }
+
+    // This is equivalent to calling updateExistingGroupThreadInDatabaseAndCreateInfoMessage()
+    // for each of a sequence of updates, e.g. when catching up on many group changes. But the
+    // updates are folded in memory, so the thread and its disappearing messages configuration
+    // are written at most once, followed by the "group update" info message of each update
+    // which had user-facing changes.
+    public static func updateExistingGroupThreadInDatabaseAndCreateInfoMessages(updates: [GroupThreadUpdate],
+                                                                                transaction: SDSAnyWriteTransaction) throws -> UpsertGroupResult {
+        guard let firstUpdate = updates.first else {
+            throw OWSAssertionError("Missing updates.")
+        }
+        guard updates.count > 1 else {
+            return try updateExistingGroupThreadInDatabaseAndCreateInfoMessage(newGroupModel: firstUpdate.newGroupModel,
+                                                                               newDisappearingMessageToken: firstUpdate.newDisappearingMessageToken,
+                                                                               groupUpdateSourceAddress: firstUpdate.groupUpdateSourceAddress,
+                                                                               transaction: transaction)
+        }
+
+        // See updateExistingGroupThreadInDatabaseAndCreateInfoMessage().
+        let groupId = firstUpdate.newGroupModel.groupId
+        guard let groupThread = TSGroupThread.fetch(groupId: groupId, transaction: transaction) else {
+            throw OWSAssertionError("Missing groupThread.")
+        }
+        let oldConfiguration = OWSDisappearingMessagesConfiguration.fetchOrBuildDefault(with: groupThread,
+                                                                                        transaction: transaction)
+
+        struct PendingInfoMessage {
+            let oldGroupModel: TSGroupModel
+            let newGroupModel: TSGroupModel
+            let oldDisappearingMessageToken: DisappearingMessageToken
+            let newDisappearingMessageToken: DisappearingMessageToken
+            let groupUpdateSourceAddress: SignalServiceAddress?
+        }
+        var pendingInfoMessages = [PendingInfoMessage]()
+        var groupModel = groupThread.groupModel
+        var disappearingMessageToken = oldConfiguration.asToken
+        var didUpdateGroupModel = false
+
+        for update in updates {
+            var newGroupModel = update.newGroupModel
+            guard newGroupModel.groupId == groupId else {
+                throw OWSAssertionError("Mismatched groupId.")
+            }
+            if newGroupModel.groupsVersion == .V1,
+               groupModel.groupsVersion == .V2 {
+                Logger.warn("Cannot downgrade migrated group from v2 to v1.")
+                throw GroupsV2Error.groupDowngradeNotAllowed
+            }
+
+            let oldDisappearingMessageToken = disappearingMessageToken
+            if let newDisappearingMessageToken = update.newDisappearingMessageToken {
+                disappearingMessageToken = newDisappearingMessageToken
+            }
+            let didUpdateDMConfiguration = oldDisappearingMessageToken != disappearingMessageToken
+
+            let oldGroupModel = groupModel
+            var hasUserFacingChange = false
+            if let newGroupModelV2 = newGroupModel as? TSGroupModelV2,
+               let oldGroupModelV2 = oldGroupModel as? TSGroupModelV2,
+               newGroupModelV2.revision < oldGroupModelV2.revision {
+                Logger.warn("Skipping stale update for v2 group.")
+            } else if !oldGroupModel.isEqual(to: newGroupModel, comparisonMode: .compareAll) {
+                hasUserFacingChange = !oldGroupModel.isEqual(to: newGroupModel, comparisonMode: .userFacingOnly)
+
+                newGroupModel = updateAddedByAddressIfNecessary(oldGroupModel: oldGroupModel,
+                                                                newGroupModel: newGroupModel,
+                                                                groupUpdateSourceAddress: update.groupUpdateSourceAddress)
+
+                autoWhitelistGroupIfNecessary(oldGroupModel: oldGroupModel,
+                                              newGroupModel: newGroupModel,
+                                              groupUpdateSourceAddress: update.groupUpdateSourceAddress,
+                                              transaction: transaction)
+
+                groupModel = newGroupModel
+                didUpdateGroupModel = true
+            }
+
+            if didUpdateDMConfiguration || hasUserFacingChange {
+                pendingInfoMessages.append(PendingInfoMessage(oldGroupModel: oldGroupModel,
+                                                              newGroupModel: groupModel,
+                                                              oldDisappearingMessageToken: oldDisappearingMessageToken,
+                                                              newDisappearingMessageToken: disappearingMessageToken,
+                                                              groupUpdateSourceAddress: update.groupUpdateSourceAddress))
+            }
+        }
+
+        if disappearingMessageToken != oldConfiguration.asToken {
+            _ = updateDisappearingMessagesInDatabaseAndCreateMessages(token: disappearingMessageToken,
+                                                                      thread: groupThread,
+                                                                      shouldInsertInfoMessage: false,
+                                                                      groupUpdateSourceAddress: nil,
+                                                                      transaction: transaction)
+        }
+        if didUpdateGroupModel {
+            TSGroupThread.ensureGroupIdMapping(forGroupId: groupId, transaction: transaction)
+            groupThread.update(with: groupModel, transaction: transaction)
+        }
+        for pendingInfoMessage in pendingInfoMessages {
+            insertGroupUpdateInfoMessage(groupThread: groupThread,
+                                         oldGroupModel: pendingInfoMessage.oldGroupModel,
+                                         newGroupModel: pendingInfoMessage.newGroupModel,
+                                         oldDisappearingMessageToken: pendingInfoMessage.oldDisappearingMessageToken,
+                                         newDisappearingMessageToken: pendingInfoMessage.newDisappearingMessageToken,
+                                         groupUpdateSourceAddress: pendingInfoMessage.groupUpdateSourceAddress,
+                                         transaction: transaction)
+        }
+
+        let action: UpsertGroupResult.Action
+        if !pendingInfoMessages.isEmpty {
+            action = .updatedWithUserFacingChanges
+        } else if didUpdateGroupModel {
+            action = .updatedWithoutUserFacingChanges
+        } else {
+            action = .unchanged
+        }
+        return UpsertGroupResult(action: action, groupThread: groupThread)
+    }
+
     // MARK: - Storage Service
 
     private static func notifyStorageServiceOfInsertedGroup(groupModel: TSGroupModel,
@@ -187,6 +187,59 @@ class InvalidInviteModel: MTLModel {
 
 // MARK: -
 
+// The members of each kind, precomputed from a member state map so that
+// accessors like fullMembers don't filter every member on every call.
+//
+// This class is immutable, so it is shared by every GroupMembership
+// decoded from the same serialized member states.
+private final class GroupMemberIndex {
+    let memberStates: [SignalServiceAddress: GroupMemberState]
+
+    let fullMembers: Set<SignalServiceAddress>
+    let fullMemberAdministrators: Set<SignalServiceAddress>
+    let invitedMembers: Set<SignalServiceAddress>
+    let requestingMembers: Set<SignalServiceAddress>
+    let allMembersOfAnyKind: Set<SignalServiceAddress>
+    let allMemberUuidsOfAnyKind: Set<UUID>
+    // Sorted by GroupMembership.normalize().
+    let sortedFullMembers: [SignalServiceAddress]
+
+    init(memberStates: [SignalServiceAddress: GroupMemberState]) {
+        self.memberStates = memberStates
+
+        var fullMembers = Set<SignalServiceAddress>()
+        var fullMemberAdministrators = Set<SignalServiceAddress>()
+        var invitedMembers = Set<SignalServiceAddress>()
+        var requestingMembers = Set<SignalServiceAddress>()
+        var allMemberUuidsOfAnyKind = Set<UUID>()
+        for (address, memberState) in memberStates {
+            switch memberState {
+            case .fullMember(let role, _):
+                fullMembers.insert(address)
+                if role == .administrator {
+                    fullMemberAdministrators.insert(address)
+                }
+            case .invited:
+                invitedMembers.insert(address)
+            case .Requesting:
+                requestingMembers.insert(address)
+            }
+            if let uuid = address.uuid {
+                allMemberUuidsOfAnyKind.insert(uuid)
+            }
+        }
+        self.fullMembers = fullMembers
+        self.fullMemberAdministrators = fullMemberAdministrators
+        self.invitedMembers = invitedMembers
+        self.requestingMembers = requestingMembers
+        self.allMembersOfAnyKind = Set(memberStates.keys)
+        self.allMemberUuidsOfAnyKind = allMemberUuidsOfAnyKind
+        self.sortedFullMembers = fullMembers.sorted { $0.compare($1) == .orderedAscending }
+    }
+}
+
+// MARK: -
+
 // This class is immutable.
 @objc
 public class GroupMembership: MTLModel {
@@ -201,6 +254,15 @@ public class GroupMembership: MTLModel {
     @objc
     var invalidInviteMap: InvalidInviteMap
 
+    // Built on first use; see memberIndex.
+    private let cachedMemberIndex = AtomicOptional<GroupMemberIndex>(nil)
+
+    // Group models are decoded far more often than their membership changes,
+    // e.g. each time a group thread is read. Memberships decoded from the same
+    // serialized member states share their member state map and index, so
+    // neither is rebuilt for every decode.
+    private static let decodedMemberIndexCache = ShardedLRUCache<Data, GroupMemberIndex>(maxSize: 256)
+
     @objc
     public override init() {
         self.memberStates = MemberStateMap()
@@ -219,12 +281,20 @@ public class GroupMembership: MTLModel {
         }
 
         if let memberStatesData = aDecoder.decodeObject(forKey: Self.memberStatesKey) as? Data {
-            let decoder = JSONDecoder()
-            do {
-                self.memberStates = try decoder.decode(MemberStateMap.self, from: memberStatesData)
-            } catch {
-                owsFailDebug("Error: \(error)")
-                return nil
+            if let memberIndex = Self.decodedMemberIndexCache.get(key: memberStatesData) {
+                self.memberStates = memberIndex.memberStates
+                self.cachedMemberIndex.set(memberIndex)
+            } else {
+                let decoder = JSONDecoder()
+                do {
+                    self.memberStates = try decoder.decode(MemberStateMap.self, from: memberStatesData)
+                } catch {
+                    owsFailDebug("Error: \(error)")
+                    return nil
+                }
+                let memberIndex = GroupMemberIndex(memberStates: self.memberStates)
+                self.cachedMemberIndex.set(memberIndex)
+                Self.decodedMemberIndexCache.set(key: memberStatesData, value: memberIndex)
             }
         } else if let legacyMemberStateMap = aDecoder.decodeObject(forKey: Self.legacyMemberStatesKey) as? LegacyMemberStateMap {
             self.memberStates = Self.convertLegacyMemberStateMap(legacyMemberStateMap)
@@ -306,6 +376,18 @@ public class GroupMembership: MTLModel {
 
     // MARK: -
 
+    private var memberIndex: GroupMemberIndex {
+        if let memberIndex = cachedMemberIndex.get() {
+            return memberIndex
+        }
+        // Racing threads may each build an index, but they'll be equivalent.
+        let memberIndex = GroupMemberIndex(memberStates: memberStates)
+        cachedMemberIndex.set(memberIndex)
+        return memberIndex
+    }
+
+    // MARK: -
+
     private static func convertLegacyMemberStateMap(_ legacyMemberStateMap: LegacyMemberStateMap) -> MemberStateMap {
         var result = MemberStateMap()
         for (address, legacyMemberState) in legacyMemberStateMap {
@@ -383,31 +465,32 @@ public class GroupMembership: MTLModel {
 public extension GroupMembership {
 
     var fullMemberAdministrators: Set<SignalServiceAddress> {
-        return Set(memberStates.filter { $0.value.isAdministrator && $0.value.isFullMember }.keys)
+        return memberIndex.fullMemberAdministrators
     }
 
     var fullMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.filter { $0.value.isFullMember }.keys)
+        return memberIndex.fullMembers
+    }
+
+    // The full members, in the order of GroupMembership.normalize().
+    var sortedFullMembers: [SignalServiceAddress] {
+        return memberIndex.sortedFullMembers
     }
 
     var invitedMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.filter { $0.value.isInvited }.keys)
+        return memberIndex.invitedMembers
     }
 
     var requestingMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.filter { $0.value.isRequesting }.keys)
+        return memberIndex.requestingMembers
     }
 
     var fullOrInvitedMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.filter {
-            $0.value.isFullMember || $0.value.isInvited
-        }.keys)
+        return memberIndex.fullMembers.union(memberIndex.invitedMembers)
     }
 
     var invitedOrRequestMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.filter {
-            $0.value.isInvited || $0.value.isRequesting
-        }.keys)
+        return memberIndex.invitedMembers.union(memberIndex.requestingMembers)
     }
 
     // allMembersOfAnyKind includes _all_ members:
@@ -415,7 +498,7 @@ public extension GroupMembership {
     // * Normal and administrator.
     // * Normal, pending profile key, requesting.
     var allMembersOfAnyKind: Set<SignalServiceAddress> {
-        return Set(memberStates.keys)
+        return memberIndex.allMembersOfAnyKind
     }
 
     // allUsers includes _all_ members:
@@ -423,7 +506,7 @@ public extension GroupMembership {
     // * Normal and administrator.
     // * Normal, pending profile key, requesting.
     var allMemberUuidsOfAnyKind: Set<UUID> {
-        return Set(memberStates.keys.compactMap { $0.uuid })
+        return memberIndex.allMemberUuidsOfAnyKind
     }
 }
 
@@ -98,7 +98,7 @@ public class TSGroupModelV2: TSGroupModel {
 
     @objc
     public override var groupMembers: [SignalServiceAddress] {
-        return Array(groupMembership.fullMembers)
+        return groupMembership.sortedFullMembers
     }
 
     public override func isEqual(to model: TSGroupModel,
@@ -0,0 +1,44 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class TSAccountManagerTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    private var tsAccountManager: TSAccountManager {
+        return TSAccountManager.shared()
+    }
+
+    // MARK: -
+
+    func testLocalIdentityIsCachedUntilRegistrationChanges() {
+        let uuid = UUID()
+        tsAccountManager.registerForTests(withLocalNumber: "+13334445555", uuid: uuid)
+
+        XCTAssertTrue(tsAccountManager.isRegisteredAndReady)
+        XCTAssertEqual(.registered, tsAccountManager.registrationState())
+
+        guard let localAddress = tsAccountManager.localAddress else {
+            XCTFail("Missing local address.")
+            return
+        }
+        XCTAssertEqual(uuid, localAddress.uuid)
+        XCTAssertEqual("+13334445555", localAddress.phoneNumber)
+        XCTAssertTrue(localAddress === tsAccountManager.localAddress)
+        read { transaction in
+            XCTAssertTrue(localAddress === self.tsAccountManager.localAddress(with: transaction))
+        }
+
+        tsAccountManager.setIsDeregistered(true)
+
+        XCTAssertFalse(tsAccountManager.isRegisteredAndReady)
+        XCTAssertEqual(.deregistered, tsAccountManager.registrationState())
+        XCTAssertEqual(localAddress, tsAccountManager.localAddress)
+        XCTAssertFalse(localAddress === tsAccountManager.localAddress)
+    }
+}
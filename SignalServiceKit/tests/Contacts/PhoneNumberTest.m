@@ -197,5 +197,24 @@
     XCTAssertTrue([parsed containsObject:@"+33170393800"]);
 }
 
+- (void)testTryParsePhoneNumbersFromUserSpecifiedTexts
+{
+    NSMutableArray<NSString *> *texts = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 100; i++) {
+        [texts addObject:[NSString stringWithFormat:@"(323) 555-%04lu", (unsigned long)i]];
+    }
+    [texts addObject:@"not a phone number"];
+    [texts addObject:@""];
+
+    NSArray<NSArray<PhoneNumber *> *> *results =
+        [PhoneNumber tryParsePhoneNumbersFromUserSpecifiedTexts:texts clientPhoneNumber:@"+13213214321"];
+    XCTAssertEqual(results.count, texts.count);
+    for (NSUInteger i = 0; i < texts.count; i++) {
+        NSArray<NSString *> *expected =
+            [self unpackTryParsePhoneNumbersFromsUserSpecifiedText:texts[i] clientPhoneNumber:@"+13213214321"];
+        XCTAssertEqualObjects([results[i] valueForKey:@"toE164"], expected);
+    }
+    XCTAssertTrue([[results[0] valueForKey:@"toE164"] containsObject:@"+13235550000"]);
+}
 
 @end
@@ -360,6 +360,11 @@ extension UUIDBackfillTaskTest {
         }
         override func uuid(forPhoneNumber phoneNumber: String) -> UUID? { return nil }
         override func phoneNumber(forUuid uuid: UUID) -> String? { return nil }
+        override func resolve(uuid: UUID?, phoneNumber: String?, trustLevel: SignalRecipientTrustLevel) -> ResolvedAddress {
+            return ResolvedAddress(uuid: uuid,
+                                   phoneNumber: phoneNumber,
+                                   hashValue: hashAndCache(uuid: uuid, phoneNumber: phoneNumber, trustLevel: trustLevel))
+        }
     }
 
     class MockReadiness: UUIDBackfillTask.ReadinessProvider {
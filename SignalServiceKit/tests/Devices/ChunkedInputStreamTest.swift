@@ -0,0 +1,48 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class ChunkedInputStreamTest: SSKBaseTestSwift {
+
+    // Two records: a varint length followed by that many bytes.
+    private let input = Data([0x03, 0x61, 0x62, 0x63, 0x02, 0x64, 0x65])
+
+    func testResumeFromOffset() throws {
+        try input.withUnsafeBytes { (buffer: UnsafeRawBufferPointer) in
+            let pointer = buffer.bindMemory(to: UInt8.self).baseAddress!
+
+            var stream = ChunkedInputStream(forReadingFrom: pointer, count: input.count)
+            XCTAssertEqual(stream.offset, 0)
+            var length: UInt32 = 0
+            try stream.decodeSingularUInt32Field(value: &length)
+            var record = Data()
+            try stream.decodeData(value: &record, count: Int(length))
+            XCTAssertEqual(record, Data("abc".utf8))
+            let resumeOffset = stream.offset
+            XCTAssertEqual(resumeOffset, 4)
+
+            var resumedStream = ChunkedInputStream(forReadingFrom: pointer, count: input.count)
+            try resumedStream.skip(toOffset: resumeOffset)
+            try resumedStream.decodeSingularUInt32Field(value: &length)
+            try resumedStream.decodeData(value: &record, count: Int(length))
+            XCTAssertEqual(record, Data("de".utf8))
+            XCTAssertTrue(resumedStream.isEmpty)
+        }
+    }
+
+    func testTruncatedInput() throws {
+        try input.withUnsafeBytes { (buffer: UnsafeRawBufferPointer) in
+            let pointer = buffer.bindMemory(to: UInt8.self).baseAddress!
+
+            var stream = ChunkedInputStream(forReadingFrom: pointer, count: input.count)
+            XCTAssertThrowsError(try stream.skip(toOffset: input.count + 1))
+
+            var record = Data()
+            XCTAssertThrowsError(try stream.decodeData(value: &record, count: input.count + 1))
+        }
+    }
+}
@@ -39,4 +39,47 @@ class GroupModelsTest: SSKBaseTestSwift {
 
         XCTAssertFalse(membership3 == membership4)
     }
+
+    func test_groupMembershipAccessors() {
+        let adminUuid = UUID()
+        let normalUuid = UUID()
+        let invitedUuid = UUID()
+        let requestingUuid = UUID()
+
+        var membershipBuilder = GroupMembership.Builder()
+        membershipBuilder.addFullMember(adminUuid, role: .administrator)
+        membershipBuilder.addFullMember(normalUuid, role: .normal)
+        membershipBuilder.addInvitedMember(invitedUuid, role: .normal, addedByUuid: adminUuid)
+        membershipBuilder.addRequestingMember(requestingUuid)
+        let membership = membershipBuilder.build()
+
+        let adminAddress = SignalServiceAddress(uuid: adminUuid)
+        let normalAddress = SignalServiceAddress(uuid: normalUuid)
+        let invitedAddress = SignalServiceAddress(uuid: invitedUuid)
+        let requestingAddress = SignalServiceAddress(uuid: requestingUuid)
+
+        XCTAssertEqual(membership.fullMembers, [adminAddress, normalAddress])
+        XCTAssertEqual(membership.sortedFullMembers, GroupMembership.normalize([adminAddress, normalAddress]))
+        XCTAssertEqual(membership.fullMemberAdministrators, [adminAddress])
+        XCTAssertEqual(membership.invitedMembers, [invitedAddress])
+        XCTAssertEqual(membership.requestingMembers, [requestingAddress])
+        XCTAssertEqual(membership.fullOrInvitedMembers, [adminAddress, normalAddress, invitedAddress])
+        XCTAssertEqual(membership.invitedOrRequestMembers, [invitedAddress, requestingAddress])
+        XCTAssertEqual(membership.allMembersOfAnyKind,
+                       [adminAddress, normalAddress, invitedAddress, requestingAddress])
+        XCTAssertEqual(membership.allMemberUuidsOfAnyKind,
+                       [adminUuid, normalUuid, invitedUuid, requestingUuid])
+
+        // Decoded memberships should have the same members, whether or not
+        // their index is shared with an earlier decode.
+        let data = NSKeyedArchiver.archivedData(withRootObject: membership)
+        for _ in 0..<2 {
+            let decodedMembership = NSKeyedUnarchiver.unarchiveObject(with: data) as! GroupMembership
+            XCTAssertEqual(decodedMembership, membership)
+            XCTAssertEqual(decodedMembership.fullMembers, membership.fullMembers)
+            XCTAssertEqual(decodedMembership.sortedFullMembers, membership.sortedFullMembers)
+            XCTAssertEqual(decodedMembership.invitedMembers, membership.invitedMembers)
+            XCTAssertEqual(decodedMembership.requestingMembers, membership.requestingMembers)
+        }
+    }
 }
@@ -0,0 +1,110 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class AttachmentBlobStoreTest: SSKBaseTestSwift {
+
+    private func makeAttachmentStream(data: Data) -> TSAttachmentStream {
+        let attachmentStream = TSAttachmentStream(contentType: OWSMimeTypeImageJpeg,
+                                                  byteCount: UInt32(data.count),
+                                                  sourceFilename: nil,
+                                                  caption: nil,
+                                                  albumMessageId: nil)
+        try! attachmentStream.write(data)
+        // Wait for the file to be deduplicated.
+        AttachmentBlobStore.serialQueue.sync {}
+        return attachmentStream
+    }
+
+    private func fileNumber(ofPath filePath: String) -> NSNumber? {
+        let attributes = try? FileManager.default.attributesOfItem(atPath: filePath)
+        return attributes?[.systemFileNumber] as? NSNumber
+    }
+
+    private func blobFilePaths() -> [String] {
+        let blobsDirPath = AttachmentBlobStore.blobsDirPath
+        let fileNames = (try? FileManager.default.contentsOfDirectory(atPath: blobsDirPath)) ?? []
+        return fileNames.map { (blobsDirPath as NSString).appendingPathComponent($0) }
+    }
+
+    func testSharesIdenticalContents() {
+        let data = Randomness.generateRandomBytes(1024)
+        let attachmentStream1 = makeAttachmentStream(data: data)
+        let attachmentStream2 = makeAttachmentStream(data: data)
+        let attachmentStream3 = makeAttachmentStream(data: Randomness.generateRandomBytes(1024))
+
+        let filePath1 = attachmentStream1.originalFilePath!
+        let filePath2 = attachmentStream2.originalFilePath!
+        XCTAssertNotEqual(filePath1, filePath2)
+        XCTAssertEqual(fileNumber(ofPath: filePath1), fileNumber(ofPath: filePath2))
+        XCTAssertNotEqual(fileNumber(ofPath: filePath1), fileNumber(ofPath: attachmentStream3.originalFilePath!))
+        XCTAssertEqual(data, try! attachmentStream2.readDataFromFile())
+
+        guard let blobFilePath = blobFilePaths().first(where: { fileNumber(ofPath: $0) == fileNumber(ofPath: filePath1) }) else {
+            XCTFail("Missing blob.")
+            return
+        }
+        XCTAssertTrue(AttachmentBlobStore.isBlobFilePath(blobFilePath))
+        XCTAssertFalse(AttachmentBlobStore.isBlobFilePath(filePath1))
+
+        // Removing one stream's file leaves the contents for the other.
+        OWSFileSystem.deleteFileIfExists(filePath1)
+        XCTAssertFalse(AttachmentBlobStore.isUnreferencedBlob(atPath: blobFilePath))
+        XCTAssertEqual(data, try! attachmentStream2.readDataFromFile())
+
+        OWSFileSystem.deleteFileIfExists(filePath2)
+        XCTAssertTrue(AttachmentBlobStore.isUnreferencedBlob(atPath: blobFilePath))
+    }
+
+    func testRemovingLastFileRemovesBlob() {
+        let data = Randomness.generateRandomBytes(1024)
+        let attachmentStream1 = makeAttachmentStream(data: data)
+        let attachmentStream2 = makeAttachmentStream(data: data)
+        let filePath1 = attachmentStream1.originalFilePath!
+        let filePath2 = attachmentStream2.originalFilePath!
+
+        guard let blobFilePath = blobFilePaths().first(where: { fileNumber(ofPath: $0) == fileNumber(ofPath: filePath1) }) else {
+            XCTFail("Missing blob.")
+            return
+        }
+        // The blob's name doesn't reveal the digest of its contents.
+        XCTAssertNotEqual(Cryptography.computeSHA256Digest(data)?.hexadecimalString,
+                          (blobFilePath as NSString).lastPathComponent)
+
+        XCTAssertTrue(AttachmentBlobStore.removeFile(atPath: filePath1))
+        XCTAssertTrue(FileManager.default.fileExists(atPath: blobFilePath))
+        XCTAssertEqual(data, try! attachmentStream2.readDataFromFile())
+
+        XCTAssertTrue(AttachmentBlobStore.removeFile(atPath: filePath2))
+        XCTAssertFalse(FileManager.default.fileExists(atPath: filePath2))
+        XCTAssertFalse(FileManager.default.fileExists(atPath: blobFilePath))
+    }
+
+    func testWritingSharedFileLeavesOthersUnchanged() {
+        let data = Randomness.generateRandomBytes(1024)
+        let attachmentStream1 = makeAttachmentStream(data: data)
+        let attachmentStream2 = makeAttachmentStream(data: data)
+        let filePath1 = attachmentStream1.originalFilePath!
+        let filePath2 = attachmentStream2.originalFilePath!
+        XCTAssertEqual(fileNumber(ofPath: filePath1), fileNumber(ofPath: filePath2))
+
+        // Write through a file handle, as an in-place writer would, once
+        // the file has been unshared.
+        let newData = Randomness.generateRandomBytes(512)
+        XCTAssertTrue(AttachmentBlobStore.writeFile(atPath: filePath1) {
+            let fileHandle = FileHandle(forWritingAtPath: filePath1)!
+            fileHandle.write(newData)
+            fileHandle.closeFile()
+            return true
+        })
+        AttachmentBlobStore.serialQueue.sync {}
+
+        XCTAssertNotEqual(fileNumber(ofPath: filePath1), fileNumber(ofPath: filePath2))
+        XCTAssertEqual(newData, try! attachmentStream1.readDataFromFile().prefix(newData.count))
+        XCTAssertEqual(data, try! attachmentStream2.readDataFromFile())
+    }
+}
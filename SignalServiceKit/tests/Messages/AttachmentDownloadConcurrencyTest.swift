@@ -0,0 +1,52 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class AttachmentDownloadConcurrencyTest: SSKBaseTestSwift {
+
+    // Simulates downloads whose aggregate throughput depends on how many run at once.
+    private func simulateDownloads(concurrency: AttachmentDownloadConcurrency,
+                                   count: Int,
+                                   aggregateThroughput: (Int) -> Double) {
+        for _ in 0..<count {
+            let concurrentDownloadCount = concurrency.maxConcurrentDownloads
+            let duration: TimeInterval = 2
+            let byteCount = aggregateThroughput(concurrentDownloadCount) / Double(concurrentDownloadCount) * duration
+            concurrency.didCompleteDownload(byteCount: UInt(byteCount),
+                                            duration: duration,
+                                            concurrentDownloadCount: concurrentDownloadCount)
+        }
+    }
+
+    func testFindsBestConcurrency() {
+        let concurrency = AttachmentDownloadConcurrency(networkMaxLimit: { AttachmentDownloadConcurrency.wifiMaxLimit })
+        XCTAssertEqual(AttachmentDownloadConcurrency.initialLimit, concurrency.maxConcurrentDownloads)
+
+        // Throughput peaks at 6 downloads.
+        simulateDownloads(concurrency: concurrency, count: 50) { downloadCount in
+            Double(min(downloadCount, 6) * 100_000 - max(0, downloadCount - 6) * 50_000)
+        }
+        XCTAssertEqual(6, concurrency.maxConcurrentDownloads)
+    }
+
+    func testRespectsNetworkLimit() {
+        var networkMaxLimit = AttachmentDownloadConcurrency.wifiMaxLimit
+        let concurrency = AttachmentDownloadConcurrency(networkMaxLimit: { networkMaxLimit })
+
+        // Throughput increases with every download.
+        simulateDownloads(concurrency: concurrency, count: 50) { downloadCount in
+            Double(downloadCount * 100_000)
+        }
+        XCTAssertEqual(AttachmentDownloadConcurrency.wifiMaxLimit, concurrency.maxConcurrentDownloads)
+
+        networkMaxLimit = AttachmentDownloadConcurrency.cellularMaxLimit
+        XCTAssertEqual(AttachmentDownloadConcurrency.cellularMaxLimit, concurrency.maxConcurrentDownloads)
+
+        networkMaxLimit = AttachmentDownloadConcurrency.minLimit
+        XCTAssertEqual(AttachmentDownloadConcurrency.minLimit, concurrency.maxConcurrentDownloads)
+    }
+}
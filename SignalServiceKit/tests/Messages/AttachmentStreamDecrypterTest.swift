@@ -0,0 +1,83 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class AttachmentStreamDecrypterTest: SSKBaseTestSwift {
+
+    private struct EncryptedAttachment {
+        let fileUrl: URL
+        let encryptionKey: Data
+        let digest: Data
+    }
+
+    private func encrypt(_ plaintext: Data) -> EncryptedAttachment {
+        var nsEncryptionKey = NSData()
+        var nsDigest = NSData()
+        let ciphertext = Cryptography.encryptAttachmentData(plaintext,
+                                                            shouldPad: true,
+                                                            outKey: &nsEncryptionKey,
+                                                            outDigest: &nsDigest)!
+        let fileUrl = OWSFileSystem.temporaryFileUrl()
+        try! ciphertext.write(to: fileUrl)
+        return EncryptedAttachment(fileUrl: fileUrl, encryptionKey: nsEncryptionKey as Data, digest: nsDigest as Data)
+    }
+
+    func testMatchesInMemoryDecryption() {
+        // Sizes around the chunk and block boundaries.
+        let chunkSize = AttachmentStreamDecrypter.chunkSize
+        for plaintextLength in [1, 15, 16, 17, chunkSize - 1, chunkSize, chunkSize + 1, 3 * chunkSize + 100] {
+            let plaintext = Randomness.generateRandomBytes(Int32(plaintextLength))
+            let encrypted = encrypt(plaintext)
+            let outputFileUrl = OWSFileSystem.temporaryFileUrl()
+
+            try! AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encrypted.fileUrl,
+                                                   encryptionKey: encrypted.encryptionKey,
+                                                   digest: encrypted.digest,
+                                                   unpaddedSize: UInt32(plaintextLength),
+                                                   outputFileUrl: outputFileUrl)
+            XCTAssertEqual(plaintext, try! Data(contentsOf: outputFileUrl))
+
+            let inMemoryPlaintext = try! Cryptography.decryptAttachment(try! Data(contentsOf: encrypted.fileUrl),
+                                                                        withKey: encrypted.encryptionKey,
+                                                                        digest: encrypted.digest,
+                                                                        unpaddedSize: UInt32(plaintextLength))
+            XCTAssertEqual(inMemoryPlaintext, plaintext)
+        }
+    }
+
+    func testRejectsTamperedAttachments() {
+        let plaintext = Randomness.generateRandomBytes(1000)
+        let encrypted = encrypt(plaintext)
+        let outputFileUrl = OWSFileSystem.temporaryFileUrl()
+
+        // Wrong digest.
+        XCTAssertThrowsError(try AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encrypted.fileUrl,
+                                                                   encryptionKey: encrypted.encryptionKey,
+                                                                   digest: Randomness.generateRandomBytes(32),
+                                                                   unpaddedSize: 1000,
+                                                                   outputFileUrl: outputFileUrl))
+        XCTAssertFalse(OWSFileSystem.fileOrFolderExists(url: outputFileUrl))
+
+        // Missing digest.
+        XCTAssertThrowsError(try AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encrypted.fileUrl,
+                                                                   encryptionKey: encrypted.encryptionKey,
+                                                                   digest: nil,
+                                                                   unpaddedSize: 1000,
+                                                                   outputFileUrl: outputFileUrl))
+
+        // Modified ciphertext.
+        var ciphertext = try! Data(contentsOf: encrypted.fileUrl)
+        ciphertext[20] ^= 0xff
+        try! ciphertext.write(to: encrypted.fileUrl)
+        XCTAssertThrowsError(try AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encrypted.fileUrl,
+                                                                   encryptionKey: encrypted.encryptionKey,
+                                                                   digest: encrypted.digest,
+                                                                   unpaddedSize: 1000,
+                                                                   outputFileUrl: outputFileUrl))
+        XCTAssertFalse(OWSFileSystem.fileOrFolderExists(url: outputFileUrl))
+    }
+}
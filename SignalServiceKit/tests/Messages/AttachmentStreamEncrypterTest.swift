@@ -0,0 +1,168 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+import PromiseKit
+@testable import SignalServiceKit
+
+class AttachmentStreamEncrypterTest: SSKBaseTestSwift {
+
+    private func encrypt(plaintextFileUrl: URL, outputFileUrl: URL) throws -> AttachmentStreamEncrypter {
+        let fileSize = OWSFileSystem.fileSize(ofPath: plaintextFileUrl.path)!.intValue
+        let encrypter = try AttachmentStreamEncrypter(plaintextLength: fileSize)
+        let outputStream = OutputStream(url: outputFileUrl, append: false)!
+        outputStream.open()
+        defer { outputStream.close() }
+        try encrypter.encryptFile(at: plaintextFileUrl) { encrypted in
+            try outputStream.writeChunk(encrypted)
+        }
+        return encrypter
+    }
+
+    func testRoundTrip() {
+        // Sizes around the chunk and block boundaries.
+        let chunkSize = AttachmentStreamEncrypter.chunkSize
+        for plaintextLength in [1, 15, 16, 17, chunkSize - 1, chunkSize, chunkSize + 1, 3 * chunkSize + 100] {
+            let plaintext = Randomness.generateRandomBytes(Int32(plaintextLength))
+            let plaintextFileUrl = OWSFileSystem.temporaryFileUrl()
+            try! plaintext.write(to: plaintextFileUrl)
+            let encryptedFileUrl = OWSFileSystem.temporaryFileUrl()
+
+            let encrypter = try! self.encrypt(plaintextFileUrl: plaintextFileUrl,
+                                              outputFileUrl: encryptedFileUrl)
+            let ciphertext = try! Data(contentsOf: encryptedFileUrl)
+            XCTAssertEqual(encrypter.encryptedLength, ciphertext.count)
+            XCTAssertNotNil(encrypter.digest)
+
+            let decrypted = try! Cryptography.decryptAttachment(ciphertext,
+                                                                withKey: encrypter.encryptionKey,
+                                                                digest: encrypter.digest,
+                                                                unpaddedSize: UInt32(plaintextLength))
+            XCTAssertEqual(plaintext, decrypted)
+
+            let decryptedFileUrl = OWSFileSystem.temporaryFileUrl()
+            try! AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encryptedFileUrl,
+                                                   encryptionKey: encrypter.encryptionKey,
+                                                   digest: encrypter.digest,
+                                                   unpaddedSize: UInt32(plaintextLength),
+                                                   outputFileUrl: decryptedFileUrl)
+            XCTAssertEqual(plaintext, try! Data(contentsOf: decryptedFileUrl))
+        }
+    }
+
+    func testResumesWithSameKeyAndIV() {
+        let plaintextLength = 2 * AttachmentStreamEncrypter.chunkSize + 100
+        let plaintextFileUrl = OWSFileSystem.temporaryFileUrl()
+        try! Randomness.generateRandomBytes(Int32(plaintextLength)).write(to: plaintextFileUrl)
+
+        let encrypter = try! AttachmentStreamEncrypter(plaintextLength: plaintextLength)
+        var ciphertext = Data()
+        try! encrypter.encryptFile(at: plaintextFileUrl) { ciphertext.append($0) }
+
+        // Encrypting again with the same key and IV reproduces the ciphertext,
+        // so a resumed upload can send just the rest of it.
+        let skippedLength = AttachmentStreamEncrypter.chunkSize + 7
+        let resumingEncrypter = try! AttachmentStreamEncrypter(plaintextLength: plaintextLength,
+                                                               encryptionKey: encrypter.encryptionKey,
+                                                               iv: encrypter.iv)
+        var remainingCiphertext = Data()
+        try! resumingEncrypter.encryptFile(at: plaintextFileUrl, skippingLength: skippedLength) {
+            remainingCiphertext.append($0)
+        }
+        XCTAssertEqual(ciphertext.suffix(from: skippedLength), remainingCiphertext)
+        XCTAssertEqual(encrypter.digest, resumingEncrypter.digest)
+    }
+
+    func testEncryptingStream() {
+        let plaintextLength = 3 * AttachmentStreamEncrypter.chunkSize + 100
+        let plaintext = Randomness.generateRandomBytes(Int32(plaintextLength))
+        let plaintextFileUrl = OWSFileSystem.temporaryFileUrl()
+        try! plaintext.write(to: plaintextFileUrl)
+
+        let encrypter = try! AttachmentStreamEncrypter(plaintextLength: plaintextLength)
+        let stream = AttachmentEncryptingStream(encryptedLength: encrypter.encryptedLength,
+                                                plaintextFileUrl: plaintextFileUrl) {
+            try AttachmentStreamEncrypter(plaintextLength: plaintextLength,
+                                          encryptionKey: encrypter.encryptionKey,
+                                          iv: encrypter.iv)
+        }
+
+        func readBody() -> Data {
+            let inputStream = stream.makeInputStream()!
+            inputStream.open()
+            defer { inputStream.close() }
+
+            var ciphertext = Data()
+            var buffer = [UInt8](repeating: 0, count: 4096)
+            while true {
+                let bytesRead = inputStream.read(&buffer, maxLength: buffer.count)
+                guard bytesRead > 0 else {
+                    break
+                }
+                ciphertext.append(buffer, count: bytesRead)
+            }
+            return ciphertext
+        }
+
+        let ciphertext = readBody()
+        // A new body stream, e.g. for a redirect, reproduces the body.
+        XCTAssertEqual(ciphertext, readBody())
+
+        let expectation = self.expectation(description: "write")
+        var digest: Data?
+        stream.digestPromise.done {
+            digest = $0
+            expectation.fulfill()
+        }.catch { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 5)
+
+        XCTAssertEqual(stream.bodyLength, ciphertext.count)
+        let decrypted = try! Cryptography.decryptAttachment(ciphertext,
+                                                            withKey: encrypter.encryptionKey,
+                                                            digest: digest,
+                                                            unpaddedSize: UInt32(plaintextLength))
+        XCTAssertEqual(plaintext, decrypted)
+    }
+
+    func testPerformanceEncryptFile() {
+        let plaintextFileUrl = OWSFileSystem.temporaryFileUrl()
+        try! Randomness.generateRandomBytes(8 * 1024 * 1024).write(to: plaintextFileUrl)
+        let encryptedFileUrl = OWSFileSystem.temporaryFileUrl()
+
+        measure {
+            _ = try! self.encrypt(plaintextFileUrl: plaintextFileUrl,
+                                  outputFileUrl: encryptedFileUrl)
+        }
+    }
+
+    func testPerformanceDecryptFile() {
+        let plaintextLength = 8 * 1024 * 1024
+        let plaintextFileUrl = OWSFileSystem.temporaryFileUrl()
+        try! Randomness.generateRandomBytes(Int32(plaintextLength)).write(to: plaintextFileUrl)
+        let encryptedFileUrl = OWSFileSystem.temporaryFileUrl()
+        let encrypter = try! self.encrypt(plaintextFileUrl: plaintextFileUrl,
+                                          outputFileUrl: encryptedFileUrl)
+        let decryptedFileUrl = OWSFileSystem.temporaryFileUrl()
+
+        measure {
+            try! AttachmentStreamDecrypter.decrypt(encryptedFileUrl: encryptedFileUrl,
+                                                   encryptionKey: encrypter.encryptionKey,
+                                                   digest: encrypter.digest,
+                                                   unpaddedSize: UInt32(plaintextLength),
+                                                   outputFileUrl: decryptedFileUrl)
+        }
+    }
+
+    func testRejectsUnexpectedLengths() {
+        let encrypter = try! AttachmentStreamEncrypter(plaintextLength: 10)
+        XCTAssertNoThrow(try encrypter.encrypt(Data(count: 5)))
+        // Too short.
+        XCTAssertThrowsError(try encrypter.finalize())
+        // Too long.
+        XCTAssertThrowsError(try encrypter.encrypt(Data(count: 6)))
+    }
+}
@@ -0,0 +1,126 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+import blurhash
+@testable import SignalServiceKit
+
+class BlurHashCodecTest: SSKBaseTestSwift {
+
+    // The size of the placeholders rendered while scrolling.
+    private let placeholderSize = 32
+
+    private let blurHashes = [
+        "LEHV6nWB2yk8pyo0adR*.7kCMdnj",
+        "LGF5]+Yk^6#M@-5c,1J5@[or[Q6.",
+        "L6PZfSi_.AyE_3t7t7R**0o#DgR4",
+        "LKO2?U%2Tw=w]~RBVZRi};RPxuwH"
+    ]
+
+    private func testImage() -> UIImage {
+        let size = CGSize(width: placeholderSize, height: placeholderSize)
+        UIGraphicsBeginImageContextWithOptions(size, true, 1)
+        UIColor.red.setFill()
+        UIRectFill(CGRect(origin: .zero, size: size))
+        UIColor.blue.setFill()
+        UIRectFill(CGRect(x: 0, y: 0, width: size.width / 2, height: size.height / 3))
+        UIColor.green.setFill()
+        UIRectFill(CGRect(x: size.width / 2, y: size.height / 2, width: size.width / 4, height: size.height / 2))
+        let image = UIGraphicsGetImageFromCurrentImageContext()!
+        UIGraphicsEndImageContext()
+        return image
+    }
+
+    private func encode(_ image: UIImage) -> String? {
+        BlurHashCodec.encode(cgImage: image.cgImage!,
+                             width: placeholderSize,
+                             height: placeholderSize,
+                             backgroundColor: UIColor.white.cgColor,
+                             componentsX: 4,
+                             componentsY: 3)
+    }
+
+    private func pixels(of image: UIImage) -> [UInt8] {
+        let width = Int(image.size.width)
+        let height = Int(image.size.height)
+        var pixels = [UInt8](repeating: 0, count: width * height * 4)
+        let context = CGContext(data: &pixels,
+                                width: width,
+                                height: height,
+                                bitsPerComponent: 8,
+                                bytesPerRow: width * 4,
+                                space: CGColorSpaceCreateDeviceRGB(),
+                                bitmapInfo: CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.noneSkipLast.rawValue)!
+        context.draw(image.cgImage!, in: CGRect(x: 0, y: 0, width: width, height: height))
+        return pixels
+    }
+
+    func testEncodeMatchesReference() {
+        let image = testImage()
+        let blurHash = encode(image)
+        XCTAssertEqual(image.blurHash(numberOfComponents: (4, 3)), blurHash)
+        XCTAssertTrue(BlurHash.isValidBlurHash(blurHash))
+    }
+
+    func testDecodeMatchesReference() {
+        for blurHash in blurHashes {
+            let size = CGSize(width: placeholderSize, height: placeholderSize)
+            let referencePixels = pixels(of: UIImage(blurHash: blurHash, size: size)!)
+            let decodedPixels = pixels(of: BlurHashCodec.image(for: blurHash, width: placeholderSize, height: placeholderSize)!)
+            XCTAssertEqual(referencePixels.count, decodedPixels.count)
+            // Allow for differences in rounding.
+            for (referencePixel, decodedPixel) in zip(referencePixels, decodedPixels) {
+                XCTAssertLessThanOrEqual(abs(Int(referencePixel) - Int(decodedPixel)), 1)
+            }
+        }
+    }
+
+    func testDecodeInvalid() {
+        XCTAssertNil(BlurHashCodec.image(for: "", width: placeholderSize, height: placeholderSize))
+        XCTAssertNil(BlurHashCodec.image(for: "LEHV6n", width: placeholderSize, height: placeholderSize))
+        XCTAssertNil(BlurHashCodec.image(for: "LEHV6nWB2yk8pyo0adR*.7kCMdn\"", width: placeholderSize, height: placeholderSize))
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformanceEncode_reference() {
+        let image = testImage()
+        measure {
+            for _ in 0..<100 {
+                _ = image.blurHash(numberOfComponents: (4, 3))
+            }
+        }
+    }
+
+    func testPerformanceEncode() {
+        let image = testImage()
+        measure {
+            for _ in 0..<100 {
+                _ = encode(image)
+            }
+        }
+    }
+
+    func testPerformanceDecode_reference() {
+        let size = CGSize(width: placeholderSize, height: placeholderSize)
+        measure {
+            for _ in 0..<25 {
+                for blurHash in blurHashes {
+                    _ = UIImage(blurHash: blurHash, size: size)
+                }
+            }
+        }
+    }
+
+    func testPerformanceDecode() {
+        measure {
+            for _ in 0..<25 {
+                for blurHash in blurHashes {
+                    _ = BlurHashCodec.image(for: blurHash, width: placeholderSize, height: placeholderSize)
+                }
+            }
+        }
+    }
+}
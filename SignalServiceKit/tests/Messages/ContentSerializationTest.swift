@@ -0,0 +1,53 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class ContentSerializationTest: SSKBaseTestSwift {
+
+    func testDataMessage() throws {
+        // Long enough that the length needs more than one byte.
+        for body in ["Hi", String(repeating: "a", count: 300)] {
+            let builder = SSKProtoDataMessage.builder()
+            builder.setBody(body)
+            builder.setTimestamp(1234)
+            let dataMessage = try builder.build()
+
+            let contentBuilder = SSKProtoContent.builder()
+            contentBuilder.setDataMessage(dataMessage)
+            let expectedData = try contentBuilder.buildSerializedData()
+
+            let contentData = try SSKProtoContent.serializedData(dataMessage: dataMessage)
+            XCTAssertEqual(contentData, expectedData)
+            XCTAssertEqual(try SSKProtoContent(serializedData: contentData).dataMessage?.body, body)
+        }
+    }
+
+    func testReceiptMessage() throws {
+        let builder = SSKProtoReceiptMessage.builder()
+        builder.setType(.read)
+        builder.setTimestamp([1, 2, 3])
+        let receiptMessage = try builder.build()
+
+        let contentBuilder = SSKProtoContent.builder()
+        contentBuilder.setReceiptMessage(receiptMessage)
+
+        XCTAssertEqual(try SSKProtoContent.serializedData(receiptMessage: receiptMessage),
+                       try contentBuilder.buildSerializedData())
+    }
+
+    func testTypingMessage() throws {
+        let builder = SSKProtoTypingMessage.builder(timestamp: 1234)
+        builder.setAction(.started)
+        let typingMessage = try builder.build()
+
+        let contentBuilder = SSKProtoContent.builder()
+        contentBuilder.setTypingMessage(typingMessage)
+
+        XCTAssertEqual(try SSKProtoContent.serializedData(typingMessage: typingMessage),
+                       try contentBuilder.buildSerializedData())
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+class DisappearingMessagesExpirationWheelTest: SSKBaseTestSwift {
+
+    private func insertMessage(expiresInSeconds: UInt32,
+                               expireStartedAt: UInt64,
+                               transaction: SDSAnyWriteTransaction) -> TSIncomingMessage {
+        let address = CommonGenerator.address()
+        let thread = TSContactThread.getOrCreateThread(withContactAddress: address, transaction: transaction)
+        let messageBuilder = TSIncomingMessageBuilder(thread: thread,
+                                                      authorAddress: address,
+                                                      messageBody: "Test 123")
+        messageBuilder.expiresInSeconds = expiresInSeconds
+        messageBuilder.expireStartedAt = expireStartedAt
+        let message = messageBuilder.build()
+        message.anyInsert(transaction: transaction)
+        return message
+    }
+
+    func testLoadAndPop() {
+        let nowMs = NSDate.ows_millisecondTimeStamp()
+        let (expiredMessage, laterMessage, unloadedMessage) = write { transaction in
+            (self.insertMessage(expiresInSeconds: 1, expireStartedAt: nowMs - 5000, transaction: transaction),
+             self.insertMessage(expiresInSeconds: 60, expireStartedAt: nowMs, transaction: transaction),
+             self.insertMessage(expiresInSeconds: 60 * 60, expireStartedAt: nowMs, transaction: transaction))
+        }
+
+        let wheel = DisappearingMessagesExpirationWheel()
+        XCTAssertTrue(wheel.needsLoad(nowMs: nowMs))
+        read { transaction in
+            XCTAssertTrue(wheel.load(nowMs: nowMs, transaction: transaction))
+        }
+        XCTAssertFalse(wheel.needsLoad(nowMs: nowMs))
+
+        // The message expiring beyond the window isn't loaded, but is still the
+        // wheel's next expiration once the messages before it are popped.
+        XCTAssertEqual(2, wheel.trackedMessageCount)
+        XCTAssertEqual(expiredMessage.expiresAt, wheel.nextExpirationTimestamp?.uint64Value)
+
+        XCTAssertEqual([expiredMessage.uniqueId], wheel.popExpiredMessageIds(nowMs: nowMs))
+        XCTAssertEqual([], wheel.popExpiredMessageIds(nowMs: nowMs))
+        XCTAssertEqual(laterMessage.expiresAt, wheel.nextExpirationTimestamp?.uint64Value)
+
+        XCTAssertEqual([laterMessage.uniqueId], wheel.popExpiredMessageIds(nowMs: laterMessage.expiresAt))
+        XCTAssertEqual(unloadedMessage.expiresAt, wheel.nextExpirationTimestamp?.uint64Value)
+    }
+
+    func testLoadRunLongerThanPage() {
+        let nowMs = NSDate.ows_millisecondTimeStamp()
+        let expireStartedAt = nowMs - 5000
+        let (runMessages, laterMessage) = write { transaction -> ([TSIncomingMessage], TSIncomingMessage) in
+            let runMessages = (0..<7).map { _ in
+                self.insertMessage(expiresInSeconds: 1, expireStartedAt: expireStartedAt, transaction: transaction)
+            }
+            let laterMessage = self.insertMessage(expiresInSeconds: 60, expireStartedAt: nowMs, transaction: transaction)
+            return (runMessages, laterMessage)
+        }
+        XCTAssertEqual(1, Set(runMessages.map { $0.expiresAt }).count)
+
+        // Every message in the run is loaded, although the run spans three pages.
+        let wheel = DisappearingMessagesExpirationWheel(maxLoadedMessageCount: 3)
+        read { transaction in
+            XCTAssertTrue(wheel.load(nowMs: nowMs, transaction: transaction))
+        }
+        XCTAssertEqual(7, wheel.trackedMessageCount)
+        XCTAssertEqual(Set(runMessages.map { $0.uniqueId }), Set(wheel.popExpiredMessageIds(nowMs: nowMs)))
+
+        // The wheel is loaded through the run, so the next pass loads the later message.
+        XCTAssertTrue(wheel.needsLoad(nowMs: nowMs))
+        XCTAssertEqual(laterMessage.expiresAt, wheel.nextExpirationTimestamp?.uint64Value)
+        write { transaction in
+            for message in runMessages {
+                message.anyRemove(transaction: transaction)
+            }
+        }
+        read { transaction in
+            XCTAssertTrue(wheel.load(nowMs: nowMs, transaction: transaction))
+        }
+        XCTAssertFalse(wheel.needsLoad(nowMs: nowMs))
+        XCTAssertEqual(1, wheel.trackedMessageCount)
+        XCTAssertEqual(laterMessage.expiresAt, wheel.nextExpirationTimestamp?.uint64Value)
+    }
+
+    func testTrackMessage() {
+        let nowMs = NSDate.ows_millisecondTimeStamp()
+        let wheel = DisappearingMessagesExpirationWheel()
+        read { transaction in
+            XCTAssertTrue(wheel.load(nowMs: nowMs, transaction: transaction))
+        }
+        XCTAssertNil(wheel.nextExpirationTimestamp)
+
+        wheel.trackMessage(uniqueId: "a", expiresAt: nowMs + 2000)
+        wheel.trackMessage(uniqueId: "b", expiresAt: nowMs + 4000)
+        // Re-tracking a message replaces its earlier expiration.
+        wheel.trackMessage(uniqueId: "b", expiresAt: nowMs + 1000)
+        XCTAssertEqual(2, wheel.trackedMessageCount)
+        XCTAssertEqual(nowMs + 1000, wheel.nextExpirationTimestamp?.uint64Value)
+
+        XCTAssertEqual([], wheel.popExpiredMessageIds(nowMs: nowMs))
+        XCTAssertEqual(["b"], wheel.popExpiredMessageIds(nowMs: nowMs + 1000))
+        XCTAssertEqual(["a"], wheel.popExpiredMessageIds(nowMs: nowMs + 5000))
+        XCTAssertEqual(0, wheel.trackedMessageCount)
+    }
+}
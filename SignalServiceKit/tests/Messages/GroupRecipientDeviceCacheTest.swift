@@ -0,0 +1,68 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class GroupRecipientDeviceCacheTest: SSKBaseTestSwift {
+
+    var tsAccountManager: TSAccountManager {
+        return SSKEnvironment.shared.tsAccountManager
+    }
+
+    lazy var localAddress = CommonGenerator.address()
+
+    override func setUp() {
+        super.setUp()
+
+        tsAccountManager.registerForTests(withLocalNumber: localAddress.phoneNumber!, uuid: localAddress.uuid!)
+    }
+
+    func testDeviceListsReflectRecipientChanges() {
+        let cache = GroupRecipientDeviceCache.shared
+        let memberAddresses = (0..<3).map { _ in CommonGenerator.address() }
+        let unknownAddress = CommonGenerator.address()
+
+        let groupThread: TSGroupThread = write { transaction in
+            for address in memberAddresses {
+                SignalRecipient.mark(asRegisteredAndGet: address, trustLevel: .high, transaction: transaction)
+            }
+            let factory = GroupThreadFactory()
+            factory.memberAddressesBuilder = { memberAddresses }
+            return factory.create(transaction: transaction)
+        }
+
+        read { transaction in
+            let devicesMap = cache.recipientDevices(for: memberAddresses + [unknownAddress],
+                                                    thread: groupThread,
+                                                    transaction: transaction)
+            XCTAssertEqual(Set(devicesMap.keys), Set(memberAddresses))
+            for address in memberAddresses {
+                XCTAssertEqual(devicesMap[address]?.deviceIds, [NSNumber(value: OWSDevicePrimaryDeviceId)])
+            }
+        }
+
+        let linkedDeviceId = NSNumber(value: 2)
+        write { transaction in
+            SignalRecipient.update(with: memberAddresses[0],
+                                   devicesToAdd: [linkedDeviceId],
+                                   devicesToRemove: [],
+                                   transaction: transaction)
+            SignalRecipient.mark(asRegisteredAndGet: unknownAddress, trustLevel: .high, transaction: transaction)
+        }
+
+        read { transaction in
+            let devicesMap = cache.recipientDevices(for: memberAddresses + [unknownAddress],
+                                                    thread: groupThread,
+                                                    transaction: transaction)
+            XCTAssertEqual(Set(devicesMap.keys), Set(memberAddresses + [unknownAddress]))
+            XCTAssertEqual(devicesMap[memberAddresses[0]]?.deviceIds,
+                           [NSNumber(value: OWSDevicePrimaryDeviceId), linkedDeviceId])
+
+            let devices = cache.recipientDevices(for: memberAddresses[0], thread: groupThread, transaction: transaction)
+            XCTAssertEqual(devices?.deviceIds, [NSNumber(value: OWSDevicePrimaryDeviceId), linkedDeviceId])
+        }
+    }
+}
@@ -0,0 +1,51 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class GroupUpdateCopyCacheTest: SSKBaseTestSwift {
+
+    func testCachesUntilInvalidated() {
+        let cache = GroupUpdateCopyCache.shared
+        let uniqueId = UUID().uuidString
+        var buildCount = 0
+        func items() -> [GroupUpdateCopyItem]? {
+            cache.items(forInfoMessageId: uniqueId) {
+                buildCount += 1
+                return [GroupUpdateCopyItem(type: .groupName, text: "copy \(buildCount)")]
+            }
+        }
+
+        XCTAssertEqual(items()?.first?.text, "copy 1")
+        XCTAssertEqual(items()?.first?.text, "copy 1")
+        XCTAssertEqual(buildCount, 1)
+
+        cache.invalidate()
+        XCTAssertEqual(items()?.first?.text, "copy 2")
+        XCTAssertEqual(buildCount, 2)
+
+        NotificationCenter.default.post(name: .otherUsersProfileDidChange, object: nil)
+        XCTAssertEqual(items()?.first?.text, "copy 3")
+        XCTAssertEqual(buildCount, 3)
+    }
+
+    func testDoesNotCacheStaleCopy() {
+        let cache = GroupUpdateCopyCache.shared
+        let uniqueId = UUID().uuidString
+
+        // Names change while the copy is being built.
+        let staleItems = cache.items(forInfoMessageId: uniqueId) { () -> [GroupUpdateCopyItem]? in
+            cache.invalidate()
+            return [GroupUpdateCopyItem(type: .groupName, text: "stale")]
+        }
+        XCTAssertEqual(staleItems?.first?.text, "stale")
+
+        let items = cache.items(forInfoMessageId: uniqueId) {
+            [GroupUpdateCopyItem(type: .groupName, text: "fresh")]
+        }
+        XCTAssertEqual(items?.first?.text, "fresh")
+    }
+}
@@ -0,0 +1,97 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class MessageContentSweeperTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    private var tsAccountManager: TSAccountManager {
+        return TSAccountManager.shared()
+    }
+
+    // MARK: -
+
+    private let authorAddress = SignalServiceAddress(phoneNumber: "+13213334445")
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+        // Completing a view-once message sends a sync message.
+        tsAccountManager.registerForTests(withLocalNumber: "+13334445555", uuid: UUID())
+    }
+
+    private func insertMessage(timestamp: UInt64? = nil, isViewOnceMessage: Bool) -> (TSIncomingMessage, TSAttachmentStream) {
+        let attachment = TSAttachmentStream(contentType: OWSMimeTypeImageGif,
+                                            byteCount: 1024,
+                                            sourceFilename: "some.gif",
+                                            caption: nil,
+                                            albumMessageId: nil)
+        var message: TSIncomingMessage!
+        write { transaction in
+            let thread = TSContactThread.getOrCreateThread(withContactAddress: self.authorAddress,
+                                                           transaction: transaction)
+            message = TSIncomingMessageBuilder(thread: thread,
+                                               timestamp: timestamp,
+                                               authorAddress: self.authorAddress,
+                                               attachmentIds: [attachment.uniqueId],
+                                               isViewOnceMessage: isViewOnceMessage).build()
+            attachment.anyInsert(transaction: transaction)
+            message.anyInsert(transaction: transaction)
+        }
+        return (message, attachment)
+    }
+
+    private func attachmentExists(_ attachment: TSAttachment) -> Bool {
+        return databaseStorage.read { transaction in
+            TSAttachment.anyFetch(uniqueId: attachment.uniqueId, transaction: transaction) != nil
+        }
+    }
+
+    private func latestCopy(_ message: TSMessage) -> TSMessage {
+        return databaseStorage.read { transaction in
+            TSMessage.anyFetchMessage(uniqueId: message.uniqueId, transaction: transaction)!
+        }
+    }
+
+    func testRemoteDeletePurgesAttachmentsLater() {
+        let (message, attachment) = insertMessage(isViewOnceMessage: false)
+
+        write { transaction in
+            message.updateWithRemotelyDeletedAndRemoveRenderableContent(with: transaction)
+        }
+        XCTAssertTrue(latestCopy(message).wasRemotelyDeleted)
+        XCTAssertEqual([], latestCopy(message).attachmentIds)
+        XCTAssertTrue(attachmentExists(attachment))
+
+        MessageContentSweeper.sweepSync()
+        XCTAssertFalse(attachmentExists(attachment))
+
+        // Sweeping again is a no-op.
+        MessageContentSweeper.sweepSync()
+        XCTAssertFalse(attachmentExists(attachment))
+    }
+
+    func testSweepCompletesDueViewOnceMessages() {
+        let dueTimestamp = NSDate.ows_millisecondTimeStamp() - 31 * kDayInMs
+        let (dueMessage, dueAttachment) = insertMessage(timestamp: dueTimestamp, isViewOnceMessage: true)
+        let (recentMessage, recentAttachment) = insertMessage(isViewOnceMessage: true)
+
+        MessageContentSweeper.sweepSync()
+
+        XCTAssertTrue(latestCopy(dueMessage).isViewOnceComplete)
+        XCTAssertFalse(attachmentExists(dueAttachment))
+
+        XCTAssertFalse(latestCopy(recentMessage).isViewOnceComplete)
+        XCTAssertTrue(attachmentExists(recentAttachment))
+    }
+}
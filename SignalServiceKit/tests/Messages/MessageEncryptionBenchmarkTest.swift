@@ -0,0 +1,107 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+// Measures the session encrypt and decrypt hot paths against the app's own
+// protocol stores, so that regressions show up as slower measurements.
+//
+// Sealed sender isn't covered: its sender certificates must be signed by
+// the service, which the test environment can't do.
+class MessageEncryptionBenchmarkTest: SSKBaseTestSwift {
+
+    private let localClient = LocalSignalClient()
+    private let runner = TestProtocolRunner()
+    private lazy var fakeService = FakeService(localClient: localClient, runner: runner)
+
+    private let messageCount = 100
+    private let groupDeviceCount = 100
+
+    private let plaintext = Data(repeating: 0x61, count: 160)
+
+    override func setUp() {
+        super.setUp()
+
+        SSKEnvironment.shared.identityManager.generateNewIdentityKey()
+        SSKEnvironment.shared.tsAccountManager.registerForTests(withLocalNumber: "+13235551234", uuid: UUID())
+    }
+
+    // Many messages to one recipient.
+    func testPerformanceContactEncrypt() {
+        let bobClient = FakeSignalClient.generate(e164Identifier: "+12223334444")
+        write { transaction in
+            try! self.runner.initialize(senderClient: self.localClient, recipientClient: bobClient, transaction: transaction)
+        }
+
+        measure {
+            self.write { transaction in
+                let accountId = bobClient.accountId(transaction: transaction)
+                for _ in 0..<self.messageCount {
+                    _ = try! self.runner.encrypt(plaintext: self.plaintext,
+                                                 senderClient: self.localClient,
+                                                 recipientAccountId: accountId,
+                                                 protocolContext: transaction)
+                }
+            }
+        }
+    }
+
+    // One message to every device in a large group.
+    func testPerformanceGroupEncrypt() {
+        var recipientClients = [FakeSignalClient]()
+        write { transaction in
+            for index in 0..<self.groupDeviceCount {
+                let client = FakeSignalClient.generate(e164Identifier: String(format: "+1222555%04d", index))
+                try! self.runner.initialize(senderClient: self.localClient, recipientClient: client, transaction: transaction)
+                recipientClients.append(client)
+            }
+        }
+
+        measure {
+            self.write { transaction in
+                for client in recipientClients {
+                    _ = try! self.runner.encrypt(plaintext: self.plaintext,
+                                                 senderClient: self.localClient,
+                                                 recipientAccountId: client.accountId(transaction: transaction),
+                                                 protocolContext: transaction)
+                }
+            }
+        }
+    }
+
+    // Many envelopes from one sender, decrypted in one transaction the way
+    // the decrypt job queue does.
+    func testPerformanceContactDecrypt() {
+        let bobClient = FakeSignalClient.generate(e164Identifier: "+12223334444")
+        write { transaction in
+            try! self.runner.initialize(senderClient: bobClient, recipientClient: self.localClient, transaction: transaction)
+        }
+        let messageDecrypter = SSKEnvironment.shared.messageDecrypter
+
+        measureMetrics(XCTestCase.defaultPerformanceMetrics, automaticallyStartMeasuring: false) {
+            // Each message can only be decrypted once, so each run needs new ones.
+            let envelopes: [(SSKProtoEnvelope, Data)] = (0..<self.messageCount).map { _ in
+                let builder = try! self.fakeService.envelopeBuilder(fromSenderClient: bobClient)
+                builder.setSourceE164(bobClient.e164Identifier!)
+                builder.setSourceUuid(bobClient.uuidIdentifier)
+                let envelopeData = try! builder.buildSerializedData()
+                return (try! SSKProtoEnvelope(serializedData: envelopeData), envelopeData)
+            }
+
+            startMeasuring()
+            self.write { transaction in
+                for (envelope, envelopeData) in envelopes {
+                    messageDecrypter.decryptEnvelope(envelope,
+                                                     envelopeData: envelopeData,
+                                                     transaction: transaction,
+                                                     successBlock: { _, _ in },
+                                                     failureBlock: { XCTFail("Decryption failed.") })
+                }
+            }
+            stopMeasuring()
+        }
+    }
+}
@@ -172,6 +172,32 @@ class MessagePipelineSupervisorTest: SSKBaseTestSwift {
         // Verify, we should only get one callout before the weak hashtable loses the stage
         XCTAssertEqual(calloutCount, 1)
     }
+
+    func testTimings() {
+        let timings = dut.timings
+        XCTAssertEqual(timings.summary, "")
+
+        let envelopeBuilder = SSKProtoEnvelope.builder(timestamp: 1234)
+        envelopeBuilder.setType(.ciphertext)
+        envelopeBuilder.setServerTimestamp(5678)
+        let envelope = try! envelopeBuilder.build()
+
+        // Envelopes we never saw arrive aren't tracked.
+        timings.record(stage: .processed, envelope: envelope)
+        timings.recordProcessedEnvelopesVisible()
+        XCTAssertEqual(timings.summary, "")
+
+        for stage in MessagePipelineTimingStage.allCases where stage != .visible {
+            timings.record(stage: stage, envelope: envelope)
+        }
+        timings.recordProcessedEnvelopesVisible()
+
+        let lines = timings.summary.components(separatedBy: "\n")
+        XCTAssertEqual(lines.count, 5)
+        XCTAssertTrue(lines[0].hasPrefix("received -> persisted: p50 "))
+        XCTAssertTrue(lines[4].hasPrefix("received -> visible: p50 "))
+        XCTAssertTrue(lines[4].hasSuffix("(n=1)"))
+    }
 }
 
 extension MessagePipelineSupervisorTest {
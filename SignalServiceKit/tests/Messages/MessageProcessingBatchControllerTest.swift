@@ -0,0 +1,92 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class MessageProcessingBatchControllerTest: SSKBaseTestSwift {
+
+    var dut: MessageProcessingBatchController! = nil
+
+    override func setUp() {
+        super.setUp()
+        dut = MessageProcessingBatchController()
+    }
+
+    func testEmptyQueue() {
+        XCTAssertEqual(dut.nextBatchSize(queueDepth: 0, remainingBackgroundTime: -1), 0)
+        XCTAssertEqual(dut.delayBeforeNextBatch(queueDepth: 0, remainingBackgroundTime: -1), 0)
+    }
+
+    func testSingleMessageIsProcessedImmediately() {
+        XCTAssertEqual(dut.nextBatchSize(queueDepth: 1, remainingBackgroundTime: -1), 1)
+    }
+
+    func testBatchSizeNeverExceedsQueueDepthOrMaximum() {
+        XCTAssertEqual(dut.nextBatchSize(queueDepth: 3, remainingBackgroundTime: -1), 3)
+        XCTAssertLessThanOrEqual(dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: -1),
+                                 MessageProcessingBatchController.maxBatchSize)
+    }
+
+    func testBatchSizeAdaptsToLatency() {
+        // Cheap batches should grow the batch size.
+        for _ in 0..<50 {
+            dut.didCompleteBatch(size: 10, duration: 0.001)
+        }
+        let fastBatchSize = dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: -1)
+
+        // Expensive batches should shrink it.
+        for _ in 0..<50 {
+            dut.didCompleteBatch(size: 10, duration: 1)
+        }
+        let slowBatchSize = dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: -1)
+
+        XCTAssertGreaterThan(fastBatchSize, slowBatchSize)
+        XCTAssertEqual(slowBatchSize, 1)
+        XCTAssertEqual(dut.lastBatchSize, 10)
+        XCTAssertEqual(dut.lastBatchDuration, 1)
+    }
+
+    func testBackgroundBudget() {
+        let foregroundBatchSize = dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: -1)
+        let backgroundBatchSize = dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: 0.01)
+        XCTAssertLessThan(backgroundBatchSize, foregroundBatchSize)
+        XCTAssertEqual(dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: 0), 1)
+
+        // Don't wait between batches in the background.
+        XCTAssertEqual(dut.delayBeforeNextBatch(queueDepth: 1, remainingBackgroundTime: 10), 0)
+    }
+
+    func testMemoryHeadroom() {
+        let unboundedBatchSize = dut.nextBatchSize(queueDepth: 10_000, remainingBackgroundTime: -1)
+        let ampleBatchSize = dut.nextBatchSize(queueDepth: 10_000,
+                                               remainingBackgroundTime: -1,
+                                               availableMemory: MemoryHeadroom.lowThreshold)
+        XCTAssertEqual(ampleBatchSize, unboundedBatchSize)
+
+        // Batches shrink as headroom drops, but we always process at least one message.
+        let lowBatchSize = dut.nextBatchSize(queueDepth: 10_000,
+                                             remainingBackgroundTime: -1,
+                                             availableMemory: MemoryHeadroom.exhaustedThreshold + 2 * 1024 * 1024)
+        XCTAssertLessThan(lowBatchSize, ampleBatchSize)
+        XCTAssertGreaterThan(lowBatchSize, 1)
+        XCTAssertEqual(dut.nextBatchSize(queueDepth: 10_000,
+                                         remainingBackgroundTime: -1,
+                                         availableMemory: MemoryHeadroom.exhaustedThreshold), 1)
+
+        XCTAssertEqual(MemoryHeadroom.level(availableMemory: UInt64.max), .ample)
+        XCTAssertEqual(MemoryHeadroom.level(availableMemory: MemoryHeadroom.lowThreshold - 1), .low)
+        XCTAssertEqual(MemoryHeadroom.level(availableMemory: MemoryHeadroom.exhaustedThreshold - 1), .exhausted)
+    }
+
+    func testDelayBeforeNextBatch() {
+        // A large backlog shouldn't wait.
+        XCTAssertEqual(dut.delayBeforeNextBatch(queueDepth: 10_000, remainingBackgroundTime: -1), 0)
+        // A trickle of messages should wait briefly to coalesce.
+        let delay = dut.delayBeforeNextBatch(queueDepth: 1, remainingBackgroundTime: -1)
+        XCTAssertGreaterThan(delay, 0)
+        XCTAssertLessThanOrEqual(delay, MessageProcessingBatchController.maxCoalescingDelay)
+    }
+}
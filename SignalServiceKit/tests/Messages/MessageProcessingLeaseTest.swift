@@ -0,0 +1,43 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class MessageProcessingLeaseTest: SSKBaseTestSwift {
+
+    func testLeaseFile() throws {
+        let fileUrl = OWSFileSystem.temporaryFileUrl()
+        let leaseFile = MessageProcessingLease.LeaseFile(fileUrl: fileUrl)
+        let now = Date()
+
+        XCTAssertTrue(try leaseFile.acquire(ownerId: "nse", ownerDescription: "nse", canPreempt: false, now: now))
+        XCTAssertEqual(leaseFile.currentOwnerDescription(), "nse")
+
+        // The holder can renew the lease; others defer until it expires.
+        XCTAssertTrue(try leaseFile.acquire(ownerId: "nse", ownerDescription: "nse", canPreempt: false, now: now))
+        XCTAssertFalse(try leaseFile.acquire(ownerId: "other", ownerDescription: "other", canPreempt: false, now: now))
+        let expirationDate = now.addingTimeInterval(MessageProcessingLease.leaseDuration + 1)
+        XCTAssertTrue(try leaseFile.acquire(ownerId: "other",
+                                            ownerDescription: "other",
+                                            canPreempt: false,
+                                            now: expirationDate))
+        XCTAssertFalse(try leaseFile.acquire(ownerId: "nse",
+                                             ownerDescription: "nse",
+                                             canPreempt: false,
+                                             now: expirationDate))
+
+        // The main app preempts the holder.
+        XCTAssertTrue(try leaseFile.acquire(ownerId: "main", ownerDescription: "main", canPreempt: true, now: now))
+        XCTAssertFalse(try leaseFile.acquire(ownerId: "nse", ownerDescription: "nse", canPreempt: false, now: now))
+
+        // Only the holder can release the lease.
+        try leaseFile.release(ownerId: "nse")
+        XCTAssertEqual(leaseFile.currentOwnerDescription(), "main")
+        try leaseFile.release(ownerId: "main")
+        XCTAssertNil(leaseFile.currentOwnerDescription())
+        XCTAssertTrue(try leaseFile.acquire(ownerId: "nse", ownerDescription: "nse", canPreempt: false, now: now))
+    }
+}
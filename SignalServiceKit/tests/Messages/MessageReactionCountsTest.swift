@@ -0,0 +1,77 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class MessageReactionCountsTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+    }
+
+    private func emojiCounts(_ message: TSMessage) -> [String] {
+        var result = [String]()
+        read { transaction in
+            result = MessageReactionCounts.emojiCounts(uniqueMessageId: message.uniqueId,
+                                                       transaction: transaction.unwrapGrdbRead)
+                .map { "\($0.emoji)\($0.count)" }
+        }
+        return result
+    }
+
+    func testCountsFollowReactions() {
+        let authorAddress = SignalServiceAddress(phoneNumber: "+13213334445")
+        let contactThread = TSContactThread(contactAddress: authorAddress)
+        let message = TSIncomingMessageBuilder(thread: contactThread,
+                                               authorAddress: authorAddress,
+                                               messageBody: "body").build()
+        let reactors = (0..<3).map { SignalServiceAddress(phoneNumber: "+1321333445\($0)") }
+
+        write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            message.anyInsert(transaction: transaction)
+        }
+        XCTAssertEqual(emojiCounts(message), [])
+
+        write { transaction in
+            for (index, reactor) in reactors.enumerated() {
+                message.recordReaction(for: reactor,
+                                       emoji: index == 1 ? "😂" : "👍",
+                                       sentAtTimestamp: UInt64(index + 1),
+                                       receivedAtTimestamp: UInt64(index + 1),
+                                       transaction: transaction)
+            }
+        }
+        // Most recent first.
+        XCTAssertEqual(emojiCounts(message), ["👍2", "😂1"])
+
+        write { transaction in
+            // Replaces the reactor's previous reaction.
+            message.recordReaction(for: reactors[0],
+                                   emoji: "😂",
+                                   sentAtTimestamp: 4,
+                                   receivedAtTimestamp: 4,
+                                   transaction: transaction)
+        }
+        XCTAssertEqual(emojiCounts(message), ["😂2", "👍1"])
+
+        write { transaction in
+            message.removeReaction(for: reactors[2], transaction: transaction)
+            message.reactionFinder.deleteAllReactions(transaction: transaction.unwrapGrdbWrite)
+        }
+        XCTAssertEqual(emojiCounts(message), [])
+    }
+}
@@ -258,6 +258,83 @@ class OWSUDManagerTest: SSKBaseTestSwift {
         }
         self.wait(for: [completed], timeout: 1.0)
     }
+
+    func test_senderAccessMap() {
+        XCTAssert(udManager.hasSenderCertificates())
+
+        guard let localAddress = tsAccountManager.localAddress else {
+            XCTFail("localAddress was unexpectedly nil")
+            return
+        }
+
+        // Ensure UD is enabled by setting our own access level to enabled.
+        udManager.setUnidentifiedAccessMode(.enabled, address: localAddress)
+
+        let bobRecipientAddress = SignalServiceAddress(phoneNumber: "+13213214322")
+        let carolRecipientAddress = SignalServiceAddress(phoneNumber: "+13213214323")
+        let daveRecipientAddress = SignalServiceAddress(phoneNumber: "+13213214324")
+        write { transaction in
+            for address in [bobRecipientAddress, carolRecipientAddress] {
+                self.profileManager.setProfileKeyData(OWSAES256Key.generateRandom().keyData,
+                                                      for: address,
+                                                      wasLocallyInitiated: true,
+                                                      transaction: transaction)
+            }
+        }
+
+        let completed = self.expectation(description: "completed")
+        udManager.ensureSenderCertificates(certificateExpirationPolicy: .strict).done { senderCertificates in
+            let addresses = [bobRecipientAddress, carolRecipientAddress, daveRecipientAddress]
+
+            do {
+                let sendingAccessMap = self.udManager.udSendingAccessMap(forAddresses: addresses,
+                                                                         requireSyncAccess: false,
+                                                                         senderCertificates: senderCertificates)
+                XCTAssertEqual(3, sendingAccessMap.count)
+                XCTAssertFalse(sendingAccessMap[bobRecipientAddress]!.udAccess.isRandomKey)
+                XCTAssertFalse(sendingAccessMap[carolRecipientAddress]!.udAccess.isRandomKey)
+                // Dave has no profile key, so we try a random key.
+                XCTAssert(sendingAccessMap[daveRecipientAddress]!.udAccess.isRandomKey)
+
+                // The batch result should agree with per-recipient lookups.
+                for address in addresses {
+                    let sendingAccess = self.udManager.udSendingAccess(forAddress: address,
+                                                                       requireSyncAccess: false,
+                                                                       senderCertificates: senderCertificates)!
+                    XCTAssertEqual(sendingAccess.udAccess.udAccessMode, sendingAccessMap[address]!.udAccess.udAccessMode)
+                    XCTAssertEqual(sendingAccess.udAccess.isRandomKey, sendingAccessMap[address]!.udAccess.isRandomKey)
+                }
+            }
+
+            do {
+                self.udManager.setUnidentifiedAccessMode(.disabled, address: carolRecipientAddress)
+                let sendingAccessMap = self.udManager.udSendingAccessMap(forAddresses: addresses,
+                                                                         requireSyncAccess: false,
+                                                                         senderCertificates: senderCertificates)
+                XCTAssertEqual(2, sendingAccessMap.count)
+                XCTAssertNil(sendingAccessMap[carolRecipientAddress])
+            }
+
+            do {
+                // Once the cache is invalidated, we pick up profile key changes.
+                self.write { transaction in
+                    self.profileManager.setProfileKeyData(OWSAES256Key.generateRandom().keyData,
+                                                          for: daveRecipientAddress,
+                                                          wasLocallyInitiated: true,
+                                                          transaction: transaction)
+                }
+                self.udManager.invalidateUDAccessKeyCache()
+                let sendingAccessMap = self.udManager.udSendingAccessMap(forAddresses: addresses,
+                                                                         requireSyncAccess: false,
+                                                                         senderCertificates: senderCertificates)
+                XCTAssertFalse(sendingAccessMap[daveRecipientAddress]!.udAccess.isRandomKey)
+            }
+        }.done {
+            completed.fulfill()
+        }
+        self.wait(for: [completed], timeout: 1.0)
+    }
+
     // MARK: - Util
 
     func buildServerCertificateProto() -> SMKProtoServerCertificate {
@@ -143,4 +143,35 @@ class SignalServiceAddressTest: SSKBaseTestSwift {
             XCTAssertEqual(address2b.phoneNumber, phoneNumber2)
         }
     }
+
+    func test_canonicalAddresses() {
+        let uuid1 = UUID()
+        let phoneNumber1 = "+13213214321"
+        let phoneNumber2 = "+13213214322"
+
+        autoreleasepool {
+            let address1a = SignalServiceAddress.canonicalAddress(uuid: uuid1, phoneNumber: nil)
+            let address1b = SignalServiceAddress.canonicalAddress(uuidString: uuid1.uuidString, phoneNumber: nil)
+            XCTAssertTrue(address1a === address1b)
+            XCTAssertEqual(address1a, SignalServiceAddress(uuid: uuid1))
+            XCTAssertEqual(address1a.hash, SignalServiceAddress(uuid: uuid1).hash)
+
+            // An address with other backing values isn't shared.
+            let address1c = SignalServiceAddress.canonicalAddress(uuid: uuid1, phoneNumber: phoneNumber1)
+            XCTAssertFalse(address1a === address1c)
+            XCTAssertEqual(address1a, address1c)
+
+            let address2a = SignalServiceAddress.canonicalAddress(uuid: nil, phoneNumber: phoneNumber2)
+            XCTAssertTrue(address2a === SignalServiceAddress.canonicalAddress(uuid: nil, phoneNumber: phoneNumber2))
+
+            // Shared addresses follow mapping changes like any other address.
+            cache.updateMapping(uuid: uuid1, phoneNumber: phoneNumber1)
+            XCTAssertEqual(address1a.phoneNumber, phoneNumber1)
+
+            let address1d = SignalServiceAddress.canonicalAddress(uuid: nil, phoneNumber: phoneNumber1)
+            XCTAssertEqual(address1d.uuid, uuid1)
+            XCTAssertEqual(address1d.phoneNumber, phoneNumber1)
+            XCTAssertEqual(address1a, address1d)
+        }
+    }
 }
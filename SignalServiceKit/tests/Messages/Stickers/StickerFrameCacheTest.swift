@@ -0,0 +1,65 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+import SignalCoreKit
+import YYImage
+@testable import SignalServiceKit
+
+class StickerFrameCacheTest: SSKBaseTestSwift {
+
+    private func writeStickerFile() throws -> URL {
+        let renderer = UIGraphicsImageRenderer(size: CGSize(width: 512, height: 512), format: {
+            let format = UIGraphicsImageRendererFormat()
+            format.scale = 1
+            return format
+        }())
+        let image = renderer.image { context in
+            UIColor.red.setFill()
+            context.fill(CGRect(origin: .zero, size: CGSize(width: 512, height: 512)))
+        }
+        let url = OWSFileSystem.temporaryFileUrl(fileExtension: "png")
+        try image.pngData()!.write(to: url)
+        return url
+    }
+
+    private let stickerInfo = StickerInfo(packId: Randomness.generateRandomBytes(16),
+                                          packKey: Randomness.generateRandomBytes(32),
+                                          stickerId: 1)
+
+    func testFramesAreSharedAndScaled() throws {
+        let cache = StickerFrameCache()
+        let url = try writeStickerFile()
+
+        let image = cache.animatedImage(stickerInfo: stickerInfo, stickerDataUrl: url, pixelSize: CGSize(width: 128, height: 128))
+        let otherImage = cache.animatedImage(stickerInfo: stickerInfo, stickerDataUrl: url, pixelSize: CGSize(width: 128, height: 128))
+        XCTAssertNotNil(image)
+        XCTAssertTrue(image === otherImage)
+
+        let frame = (image as? YYAnimatedImage)?.animatedImageFrame(at: 0)
+        XCTAssertEqual(128, frame?.cgImage?.width)
+        XCTAssertTrue(frame === (otherImage as? YYAnimatedImage)?.animatedImageFrame(at: 0))
+        // Frames keep the sticker's size in points.
+        XCTAssertEqual(CGSize(width: 512, height: 512), frame?.size)
+
+        // Different display sizes are decoded separately.
+        let fullSizeImage = cache.animatedImage(stickerInfo: stickerInfo, stickerDataUrl: url, pixelSize: .zero)
+        XCTAssertFalse(image === fullSizeImage)
+        XCTAssertEqual(512, (fullSizeImage as? YYAnimatedImage)?.animatedImageFrame(at: 0)?.cgImage?.width)
+    }
+
+    func testCost() throws {
+        let cache = StickerFrameCache()
+        let url = try writeStickerFile()
+        XCTAssertEqual(0, cache.currentCostBytes)
+
+        let image = cache.animatedImage(stickerInfo: stickerInfo, stickerDataUrl: url, pixelSize: CGSize(width: 128, height: 128))
+        _ = (image as? YYAnimatedImage)?.animatedImageFrame(at: 0)
+        XCTAssertGreaterThanOrEqual(cache.currentCostBytes, UInt(128 * 128 * 4))
+
+        cache.removeAllFrames()
+        XCTAssertEqual(0, cache.currentCostBytes)
+    }
+}
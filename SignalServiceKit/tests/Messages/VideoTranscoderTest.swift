@@ -0,0 +1,62 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class VideoTranscoderTest: SSKBaseTestSwift {
+
+    private let maxSize = CGSize(width: 640, height: 480)
+
+    func testOutputSize() {
+        // Landscape video is scaled to fit.
+        XCTAssertEqual(CGSize(width: 640, height: 360),
+                       VideoTranscoder.outputSize(naturalSize: CGSize(width: 1920, height: 1080),
+                                                  preferredTransform: .identity,
+                                                  maxSize: maxSize))
+
+        // Portrait video is scaled to fit the portrait box, in its natural orientation.
+        XCTAssertEqual(CGSize(width: 640, height: 360),
+                       VideoTranscoder.outputSize(naturalSize: CGSize(width: 1920, height: 1080),
+                                                  preferredTransform: CGAffineTransform(rotationAngle: .pi / 2),
+                                                  maxSize: maxSize))
+        XCTAssertEqual(CGSize(width: 360, height: 640),
+                       VideoTranscoder.outputSize(naturalSize: CGSize(width: 1080, height: 1920),
+                                                  preferredTransform: .identity,
+                                                  maxSize: maxSize))
+
+        // Small video isn't scaled up, and dimensions are even.
+        XCTAssertEqual(CGSize(width: 320, height: 240),
+                       VideoTranscoder.outputSize(naturalSize: CGSize(width: 320, height: 240),
+                                                  preferredTransform: .identity,
+                                                  maxSize: maxSize))
+        XCTAssertEqual(CGSize(width: 176, height: 144),
+                       VideoTranscoder.outputSize(naturalSize: CGSize(width: 175, height: 143),
+                                                  preferredTransform: .identity,
+                                                  maxSize: maxSize))
+    }
+
+    func testVideoBitRate() {
+        var configuration = VideoTranscoder.Configuration()
+        XCTAssertEqual(configuration.maxVideoBitRate,
+                       VideoTranscoder.videoBitRate(configuration: configuration, duration: 60 * 60, hasAudio: true))
+
+        // Short videos fit within the target at the maximum bitrate.
+        configuration.targetFileSize = 100 * 1024 * 1024
+        XCTAssertEqual(configuration.maxVideoBitRate,
+                       VideoTranscoder.videoBitRate(configuration: configuration, duration: 60, hasAudio: true))
+
+        // Long videos have their bitrate lowered to fit.
+        let duration: TimeInterval = 30 * 60
+        let bitRate = VideoTranscoder.videoBitRate(configuration: configuration, duration: duration, hasAudio: true)
+        XCTAssertLessThan(bitRate, configuration.maxVideoBitRate)
+        let estimatedFileSize = Double(bitRate + configuration.audioBitRate) * duration / 8
+        XCTAssertLessThanOrEqual(estimatedFileSize, Double(configuration.targetFileSize!))
+
+        // The bitrate never drops below the minimum.
+        XCTAssertEqual(configuration.minVideoBitRate,
+                       VideoTranscoder.videoBitRate(configuration: configuration, duration: 24 * 60 * 60, hasAudio: true))
+    }
+}
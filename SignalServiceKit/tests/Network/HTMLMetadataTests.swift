@@ -131,6 +131,26 @@ class HTMLMetadataTests: SSKBaseTestSwift {
         ))
     }
 
+    func testParsingStopsAtEndOfHead() {
+        let testHTML = """
+        <head><title>HeadTitle</title></HEAD>
+        <body><meta property="og:title" content="BodyTitle" /></body>
+        """
+
+        let testMetadata = HTMLMetadata.construct(parsing: testHTML)
+        XCTAssertEqual(testMetadata, HTMLMetadata(titleTag: "HeadTitle"))
+    }
+
+    func testHeadBufferFindsTagAcrossChunks() {
+        let headBuffer = HTMLHeadBuffer()
+        XCTAssertFalse(headBuffer.append(Data("<head><title>é</title></HE".utf8), response: nil))
+        XCTAssertNil(headBuffer.completedHead)
+        XCTAssertTrue(headBuffer.append(Data("AD><body>".utf8), response: nil))
+
+        let head = String(data: headBuffer.completedHead!.data, encoding: .utf8)
+        XCTAssertEqual(head, "<head><title>é</title>")
+    }
+
     func testLinkDataParsing() {
         let linkText = ("<meta property=\"og:title\" content=\"Randomness is Random - Numberphile\">" +
                         "<meta property=\"og:image\" content=\"https://i.ytimg.com/vi/tP-Ipsat90c/maxresdefault.jpg\">")
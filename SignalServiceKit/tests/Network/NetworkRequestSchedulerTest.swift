@@ -0,0 +1,73 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class NetworkRequestSchedulerTest: SSKBaseTestSwift {
+
+    private let queue = DispatchQueue(label: "NetworkRequestSchedulerTest")
+
+    func testBackgroundRequestsYieldToInteractiveRequests() {
+        let scheduler = NetworkRequestScheduler()
+
+        var completeInteractiveRequest: (() -> Void)?
+        let interactiveExpectation = expectation(description: "interactive request started")
+        scheduler.scheduleRequest(host: "example.com", priority: .interactive, queue: queue) { completion in
+            completeInteractiveRequest = completion
+            interactiveExpectation.fulfill()
+        }
+        wait(for: [interactiveExpectation], timeout: 1)
+
+        let backgroundExpectation = expectation(description: "background request started")
+        scheduler.scheduleRequest(host: "example.com", priority: .background, queue: queue) { completion in
+            backgroundExpectation.fulfill()
+            completion()
+        }
+        queue.sync {}
+        XCTAssertEqual(scheduler.pendingRequestCount, 1)
+
+        queue.sync {
+            completeInteractiveRequest?()
+        }
+        wait(for: [backgroundExpectation], timeout: 1)
+        XCTAssertEqual(scheduler.pendingRequestCount, 0)
+    }
+
+    func testPerHostCap() {
+        let scheduler = NetworkRequestScheduler()
+        let maxCount = NetworkRequestScheduler.maxConcurrentRequestsPerHost
+
+        var completions = [() -> Void]()
+        let startedExpectation = expectation(description: "requests started")
+        startedExpectation.expectedFulfillmentCount = maxCount
+        // The last request starts once a slot is freed.
+        startedExpectation.assertForOverFulfill = false
+        for _ in 0..<(maxCount + 1) {
+            scheduler.scheduleRequest(host: "example.com", priority: .default, queue: queue) { completion in
+                completions.append(completion)
+                startedExpectation.fulfill()
+            }
+        }
+        wait(for: [startedExpectation], timeout: 1)
+        queue.sync {}
+        XCTAssertEqual(scheduler.pendingRequestCount, 1)
+
+        // Requests to other hosts aren't blocked.
+        let otherHostExpectation = expectation(description: "other host request started")
+        scheduler.scheduleRequest(host: "example.org", priority: .default, queue: queue) { completion in
+            otherHostExpectation.fulfill()
+            completion()
+        }
+        wait(for: [otherHostExpectation], timeout: 1)
+        XCTAssertEqual(scheduler.pendingRequestCount, 1)
+
+        queue.sync {
+            completions.first?()
+        }
+        queue.sync {}
+        XCTAssertEqual(scheduler.pendingRequestCount, 0)
+    }
+}
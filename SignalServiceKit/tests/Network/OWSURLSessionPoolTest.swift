@@ -0,0 +1,24 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class OWSURLSessionPoolTest: SSKBaseTestSwift {
+
+    func testSessionsAreSharedPerKey() {
+        let pool = OWSURLSessionPool()
+
+        let session = pool.session(forKey: "a", configuration: .ephemeral)
+        XCTAssertTrue(session === pool.session(forKey: "a", configuration: .ephemeral))
+        XCTAssertFalse(session === pool.session(forKey: "b", configuration: .ephemeral))
+
+        pool.removeAllSessions()
+        XCTAssertFalse(session === pool.session(forKey: "a", configuration: .ephemeral))
+
+        XCTAssertEqual(0, pool.connectionReuseRatio)
+        XCTAssertEqual(0, pool.averageHandshakeDuration)
+    }
+}
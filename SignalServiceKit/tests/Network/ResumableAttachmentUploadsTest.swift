@@ -0,0 +1,56 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class ResumableAttachmentUploadsTest: SSKBaseTestSwift {
+
+    private func makeUpload(attachmentId: String, creationDate: Date = Date()) -> ResumableAttachmentUpload {
+        return ResumableAttachmentUpload(attachmentId: attachmentId,
+                                         plaintextLength: 100,
+                                         encryptionKey: Randomness.generateRandomBytes(64),
+                                         iv: Randomness.generateRandomBytes(16),
+                                         cdnKey: "cdnKey",
+                                         cdnNumber: 2,
+                                         locationUrl: URL(string: "https://example.com/upload")!,
+                                         creationDate: creationDate,
+                                         bytesUploaded: 0,
+                                         digest: nil)
+    }
+
+    func testPersistsProgress() {
+        let upload = makeUpload(attachmentId: "attachment1")
+        ResumableAttachmentUploads.save(upload)
+
+        ResumableAttachmentUploads.recordProgress(42, forAttachmentId: "attachment1")
+        let loadedUpload = ResumableAttachmentUploads.upload(forAttachmentId: "attachment1")
+        XCTAssertEqual(42, loadedUpload?.bytesUploaded)
+        XCTAssertEqual(upload.locationUrl, loadedUpload?.locationUrl)
+        XCTAssertEqual(upload.iv, loadedUpload?.iv)
+        XCTAssertNil(loadedUpload?.digest)
+
+        let digest = Randomness.generateRandomBytes(32)
+        ResumableAttachmentUploads.recordDigest(digest, forAttachmentId: "attachment1")
+        XCTAssertEqual(digest, ResumableAttachmentUploads.upload(forAttachmentId: "attachment1")?.digest)
+        XCTAssertEqual(42, ResumableAttachmentUploads.upload(forAttachmentId: "attachment1")?.bytesUploaded)
+        XCTAssertNil(ResumableAttachmentUploads.upload(forAttachmentId: "attachment2"))
+
+        ResumableAttachmentUploads.discard(upload)
+        XCTAssertNil(ResumableAttachmentUploads.upload(forAttachmentId: "attachment1"))
+    }
+
+    func testDiscardsExpiredUploads() {
+        let expiredDate = Date(timeIntervalSinceNow: -7 * kDayInterval)
+        ResumableAttachmentUploads.save(makeUpload(attachmentId: "attachment1", creationDate: expiredDate))
+        XCTAssertNil(ResumableAttachmentUploads.upload(forAttachmentId: "attachment1"))
+
+        ResumableAttachmentUploads.save(makeUpload(attachmentId: "attachment2", creationDate: expiredDate))
+        ResumableAttachmentUploads.save(makeUpload(attachmentId: "attachment3"))
+        ResumableAttachmentUploads.removeExpiredUploads()
+        XCTAssertNil(ResumableAttachmentUploads.upload(forAttachmentId: "attachment2"))
+        XCTAssertNotNil(ResumableAttachmentUploads.upload(forAttachmentId: "attachment3"))
+    }
+}
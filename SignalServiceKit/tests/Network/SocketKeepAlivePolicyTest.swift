@@ -0,0 +1,49 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class SocketKeepAlivePolicyTest: SSKBaseTestSwift {
+
+    func testReconnectBackoff() {
+        let policy = SocketKeepAlivePolicy(networkKeyBlock: { "test" })
+
+        XCTAssertEqual(SocketKeepAlivePolicy.minReconnectDelay, policy.nextReconnectDelay())
+        var lastDelay = SocketKeepAlivePolicy.minReconnectDelay
+        for _ in 0..<100 {
+            let delay = policy.nextReconnectDelay()
+            XCTAssertGreaterThanOrEqual(delay, SocketKeepAlivePolicy.minReconnectDelay)
+            XCTAssertLessThanOrEqual(delay, min(SocketKeepAlivePolicy.maxReconnectDelay, lastDelay * 3))
+            lastDelay = delay
+        }
+
+        policy.resetReconnectBackoff()
+        XCTAssertEqual(SocketKeepAlivePolicy.minReconnectDelay, policy.nextReconnectDelay())
+    }
+
+    func testHeartbeatIntervalIsLearnedPerNetwork() {
+        var networkKey = "wifi"
+        let policy = SocketKeepAlivePolicy(networkKeyBlock: { networkKey })
+        XCTAssertEqual(SocketKeepAlivePolicy.defaultHeartbeatInterval, policy.heartbeatInterval)
+
+        var didChange = false
+        for _ in 0..<SocketKeepAlivePolicy.heartbeatsBeforeLengthening {
+            didChange = policy.heartbeatDidSucceed()
+        }
+        XCTAssertTrue(didChange)
+        XCTAssertEqual(SocketKeepAlivePolicy.defaultHeartbeatInterval + SocketKeepAlivePolicy.heartbeatIntervalStep,
+                       policy.heartbeatInterval)
+
+        networkKey = "cellular"
+        XCTAssertEqual(SocketKeepAlivePolicy.defaultHeartbeatInterval, policy.heartbeatInterval)
+
+        // The interval never exceeds the maximum.
+        for _ in 0..<100 {
+            _ = policy.heartbeatDidSucceed()
+        }
+        XCTAssertEqual(SocketKeepAlivePolicy.maxHeartbeatInterval, policy.heartbeatInterval)
+    }
+}
@@ -0,0 +1,46 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class SocketRequestRouterTest: SSKBaseTestSwift {
+
+    private func makeRequest() -> TSRequest {
+        return TSRequest(url: URL(string: "v1/profile/test")!, method: "GET", parameters: nil)
+    }
+
+    func testEligibility() {
+        XCTAssertTrue(SocketRequestRouter.isEligibleForWebsocket(makeRequest()))
+
+        let udRequest = makeRequest()
+        udRequest.isUDRequest = true
+        XCTAssertFalse(SocketRequestRouter.isEligibleForWebsocket(udRequest))
+
+        let authRequest = makeRequest()
+        authRequest.authUsername = "username"
+        authRequest.authPassword = "password"
+        XCTAssertFalse(SocketRequestRouter.isEligibleForWebsocket(authRequest))
+
+        let customHostRequest = makeRequest()
+        customHostRequest.customHost = "example.com"
+        XCTAssertFalse(SocketRequestRouter.isEligibleForWebsocket(customHostRequest))
+    }
+
+    func testHealth() {
+        let router = SocketRequestRouter()
+        XCTAssertTrue(router.isWebsocketHealthy)
+
+        // Responses from the service don't affect the socket's health.
+        router.websocketRequestDidFail(statusCode: 404)
+        XCTAssertTrue(router.isWebsocketHealthy)
+
+        router.websocketRequestDidFail(statusCode: 0)
+        XCTAssertFalse(router.isWebsocketHealthy)
+
+        router.websocketRequestDidSucceed()
+        XCTAssertTrue(router.isWebsocketHealthy)
+    }
+}
@@ -83,4 +83,48 @@
     XCTAssertNotEqualObjects(aliceFingerprint.displayableText, charlieFingerprint.displayableText);
 }
 
+
+- (void)testCachedTextChangesWithIdentityKey
+{
+    SignalServiceAddress *aliceStableAddress = [[SignalServiceAddress alloc] initWithUuid:NSUUID.UUID
+                                                                              phoneNumber:@"+13231111111"];
+    NSData *aliceIdentityKey = [Curve25519 generateKeyPair].publicKey;
+    SignalServiceAddress *bobStableAddress = [[SignalServiceAddress alloc] initWithUuid:NSUUID.UUID
+                                                                            phoneNumber:@"+14152222222"];
+    NSData *bobIdentityKey = [Curve25519 generateKeyPair].publicKey;
+    NSData *bobNewIdentityKey = [Curve25519 generateKeyPair].publicKey;
+
+    OWSFingerprint *fingerprint = [OWSFingerprint fingerprintWithMyStableAddress:aliceStableAddress
+                                                                   myIdentityKey:aliceIdentityKey
+                                                              theirStableAddress:bobStableAddress
+                                                                theirIdentityKey:bobIdentityKey
+                                                                       theirName:@"Bob"
+                                                                  hashIterations:2];
+
+    OWSFingerprint *cachedFingerprint = [OWSFingerprint fingerprintWithMyStableAddress:aliceStableAddress
+                                                                         myIdentityKey:aliceIdentityKey
+                                                                    theirStableAddress:bobStableAddress
+                                                                      theirIdentityKey:bobIdentityKey
+                                                                             theirName:@"Bob"
+                                                                        hashIterations:2];
+
+    OWSFingerprint *moreIterationsFingerprint = [OWSFingerprint fingerprintWithMyStableAddress:aliceStableAddress
+                                                                                 myIdentityKey:aliceIdentityKey
+                                                                            theirStableAddress:bobStableAddress
+                                                                              theirIdentityKey:bobIdentityKey
+                                                                                     theirName:@"Bob"
+                                                                                hashIterations:3];
+
+    OWSFingerprint *changedFingerprint = [OWSFingerprint fingerprintWithMyStableAddress:aliceStableAddress
+                                                                          myIdentityKey:aliceIdentityKey
+                                                                     theirStableAddress:bobStableAddress
+                                                                       theirIdentityKey:bobNewIdentityKey
+                                                                              theirName:@"Bob"
+                                                                         hashIterations:2];
+
+    XCTAssertEqualObjects(fingerprint.displayableText, cachedFingerprint.displayableText);
+    XCTAssertNotEqualObjects(fingerprint.displayableText, moreIterationsFingerprint.displayableText);
+    XCTAssertNotEqualObjects(fingerprint.displayableText, changedFingerprint.displayableText);
+}
+
 @end
@@ -0,0 +1,62 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class AttachmentFinderTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+    }
+
+    func testFetchAttachments() {
+        let attachments = AttachmentStreamFactory().create(count: 3)
+        let uniqueIds = attachments.map { $0.uniqueId }
+
+        read { transaction in
+            XCTAssertTrue(AttachmentFinder.fetchAttachments(uniqueIds: [], transaction: transaction).isEmpty)
+
+            let result = AttachmentFinder.fetchAttachments(uniqueIds: uniqueIds + ["missing"], transaction: transaction)
+            XCTAssertEqual(Set(uniqueIds), Set(result.keys))
+            for uniqueId in uniqueIds {
+                XCTAssertEqual(uniqueId, result[uniqueId]?.uniqueId)
+            }
+        }
+    }
+
+    func testAttachmentsAreInIdOrder() {
+        let gifFactory = AttachmentStreamFactory()
+        gifFactory.contentTypeBuilder = { OWSMimeTypeImageGif }
+        let gif = gifFactory.create(count: 1)[0]
+        let others = AttachmentStreamFactory().create(count: 2)
+
+        let attachmentIds = [others[1].uniqueId, gif.uniqueId, "missing", others[0].uniqueId, gif.uniqueId]
+        read { transaction in
+            let grdbTransaction = transaction.unwrapGrdbRead
+            XCTAssertEqual([others[1].uniqueId, gif.uniqueId, others[0].uniqueId],
+                           AttachmentFinder.attachments(withAttachmentIds: attachmentIds,
+                                                        transaction: grdbTransaction).map { $0.uniqueId })
+            XCTAssertEqual([gif.uniqueId],
+                           AttachmentFinder.attachments(withAttachmentIds: attachmentIds,
+                                                        matchingContentType: OWSMimeTypeImageGif,
+                                                        transaction: grdbTransaction).map { $0.uniqueId })
+            XCTAssertEqual([others[1].uniqueId, others[0].uniqueId],
+                           AttachmentFinder.attachments(withAttachmentIds: attachmentIds,
+                                                        ignoringContentType: OWSMimeTypeImageGif,
+                                                        transaction: grdbTransaction).map { $0.uniqueId })
+        }
+    }
+}
@@ -0,0 +1,61 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class CrossProcessDatabaseChangesTest: SSKBaseTestSwift {
+
+    private func makeJournal() -> CrossProcessDatabaseChanges.Journal {
+        let fileUrl = URL(fileURLWithPath: OWSTemporaryDirectory()).appendingPathComponent(UUID().uuidString)
+        return CrossProcessDatabaseChanges.Journal(fileUrl: fileUrl)
+    }
+
+    private func makeChanges(interactionUniqueIds: Set<String>,
+                             interactionDeletedUniqueIds: Set<String> = []) -> ObservedDatabaseChanges {
+        let changes = ObservedDatabaseChanges(concurrencyMode: .mainThread)
+        changes.append(interactionUniqueIds: interactionUniqueIds)
+        changes.append(interactionDeletedUniqueIds: interactionDeletedUniqueIds)
+        changes.append(collections: [TSInteraction.collection()])
+        return changes
+    }
+
+    func testMergesEntries() {
+        let journal = makeJournal()
+
+        journal.append(changes: makeChanges(interactionUniqueIds: ["a", "b"]))
+        journal.append(changes: makeChanges(interactionUniqueIds: ["c"], interactionDeletedUniqueIds: ["b"]))
+
+        guard let changes = journal.consume() else {
+            XCTFail("Missing changes.")
+            return
+        }
+        XCTAssertEqual(["a", "b", "c"], changes.interactionUniqueIds)
+        XCTAssertEqual(["b"], changes.interactionDeletedUniqueIds)
+        XCTAssertTrue(changes.didUpdateInteractions)
+        XCTAssertFalse(changes.didUpdateThreads)
+
+        // Consuming the journal clears it.
+        XCTAssertEqual([], journal.consume()?.interactionUniqueIds)
+    }
+
+    func testOverflow() {
+        let journal = makeJournal()
+
+        journal.append(changes: makeChanges(interactionUniqueIds: ["a"]))
+        journal.appendOverflow()
+        XCTAssertNil(journal.consume())
+
+        // Too many changes to apply incrementally.
+        for index in 0..<UIDatabaseObserver.kMaxIncrementalRowChanges {
+            journal.append(changes: makeChanges(interactionUniqueIds: ["\(index)"]))
+        }
+        XCTAssertNil(journal.consume())
+
+        journal.append(changes: makeChanges(interactionUniqueIds: ["a"]))
+        journal.removeAll()
+        XCTAssertEqual([], journal.consume()?.interactionUniqueIds)
+    }
+}
@@ -0,0 +1,52 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class DatabaseFixtureTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+    }
+
+    func testFixtureCounts() {
+        let fixture = DatabaseFixture()
+        fixture.threadCount = 10
+        fixture.interactionCount = 100
+        fixture.attachmentCount = 12
+        fixture.reactionCount = 15
+        fixture.largeGroupCount = 1
+        fixture.largeGroupMemberCount = 20
+        fixture.batchSize = 30
+        fixture.create()
+
+        XCTAssertEqual(10, fixture.threads.count)
+        read { transaction in
+            XCTAssertEqual(10, TSThread.anyCount(transaction: transaction))
+            XCTAssertEqual(100, TSInteraction.anyCount(transaction: transaction))
+            XCTAssertEqual(12, TSAttachment.anyCount(transaction: transaction))
+            XCTAssertEqual(15, OWSReaction.anyCount(transaction: transaction))
+        }
+    }
+
+    func testFactoryCreatesInBatches() {
+        let threads = ContactThreadFactory().create(count: 25, batchSize: 10)
+        XCTAssertEqual(25, threads.count)
+        read { transaction in
+            XCTAssertEqual(25, TSThread.anyCount(transaction: transaction))
+        }
+    }
+}
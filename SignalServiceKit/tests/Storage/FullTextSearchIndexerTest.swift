@@ -0,0 +1,99 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class FullTextSearchIndexerTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+        FullTextSearchIndexer.shouldDeferIndexing = true
+    }
+
+    override func tearDown() {
+        FullTextSearchIndexer.shouldDeferIndexing = false
+
+        super.tearDown()
+    }
+
+    private func matchCount(searchText: String) -> Int {
+        var count = 0
+        read { transaction in
+            FullTextSearchFinder().enumerateObjects(searchText: searchText, transaction: transaction) { _, _, _ in
+                count += 1
+            }
+        }
+        return count
+    }
+
+    private func insertMessage(body: String) -> TSOutgoingMessage {
+        var message: TSOutgoingMessage!
+        write { transaction in
+            let address = SignalServiceAddress(phoneNumber: "+12345678900")
+            let thread = TSContactThread.getOrCreateThread(withContactAddress: address, transaction: transaction)
+            message = TSOutgoingMessage(in: thread, messageBody: body, attachmentId: nil)
+            message.anyInsert(transaction: transaction)
+        }
+        return message
+    }
+
+    func testDeferredIndexing() {
+        _ = insertMessage(body: "Deferred hello")
+        XCTAssertEqual(0, matchCount(searchText: "deferred"))
+
+        FullTextSearchIndexer.flushSync()
+        XCTAssertEqual(1, matchCount(searchText: "deferred"))
+
+        // Flushing again is a no-op.
+        FullTextSearchIndexer.flushSync()
+        XCTAssertEqual(1, matchCount(searchText: "deferred"))
+    }
+
+    func testRemovedBeforeIndexing() {
+        let message = insertMessage(body: "Ephemeral hello")
+        write { transaction in
+            message.anyRemove(transaction: transaction)
+        }
+
+        FullTextSearchIndexer.flushSync()
+        XCTAssertEqual(0, matchCount(searchText: "ephemeral"))
+    }
+
+    func testRemovedContentIsIndexedImmediately() {
+        let message = insertMessage(body: "Retracted hello")
+        FullTextSearchIndexer.flushSync()
+        XCTAssertEqual(1, matchCount(searchText: "retracted"))
+
+        // The update isn't deferred, so no flush is needed.
+        write { transaction in
+            message.updateWithRemotelyDeletedAndRemoveRenderableContent(with: transaction)
+        }
+        XCTAssertEqual(0, matchCount(searchText: "retracted"))
+    }
+
+    func testRebuildIndex() {
+        _ = insertMessage(body: "Rebuilt hello")
+        FullTextSearchIndexer.flushSync()
+
+        let expectation = self.expectation(description: "Index rebuilt")
+        FullTextSearchIndexer.rebuildIndex {
+            expectation.fulfill()
+        }
+        waitForExpectations(timeout: 5)
+
+        XCTAssertEqual(1, matchCount(searchText: "rebuilt"))
+    }
+}
@@ -0,0 +1,70 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class GRDBBackgroundMigratorTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+    }
+
+    func testMigratesInChunks() {
+        let store = SDSKeyValueStore(collection: "GRDBBackgroundMigratorTest")
+        let rowCount = 10
+        let chunkSize = 3
+
+        var checkpoints = [Int?]()
+        let migrator = GRDBBackgroundMigrator()
+        migrator.registerMigration("testMigration") { checkpoint, transaction in
+            checkpoints.append(checkpoint)
+            let start = checkpoint.map { $0 + 1 } ?? 0
+            let end = min(start + chunkSize, rowCount)
+            for index in start..<end {
+                store.setBool(true, key: "\(index)", transaction: transaction.asAnyWrite)
+            }
+            return end < rowCount ? end - 1 : nil
+        }
+
+        migrator.runOutstandingMigrationsSync()
+
+        XCTAssertEqual(checkpoints, [nil, 2, 5, 8])
+        read { transaction in
+            XCTAssertEqual(store.numberOfKeys(transaction: transaction), UInt(rowCount))
+            XCTAssertTrue(migrator.isComplete(identifier: "testMigration", transaction: transaction.unwrapGrdbRead))
+        }
+
+        // Completed migrations aren't run again.
+        migrator.runOutstandingMigrationsSync()
+        XCTAssertEqual(checkpoints.count, 4)
+    }
+
+    func testMarkAllMigrationsAsComplete() {
+        var chunkCount = 0
+        let migrator = GRDBBackgroundMigrator()
+        migrator.registerMigration("testMigration") { _, _ in
+            chunkCount += 1
+            return nil
+        }
+
+        write { transaction in
+            migrator.markAllMigrationsAsComplete(transaction: transaction.unwrapGrdbWrite)
+        }
+        migrator.runOutstandingMigrationsSync()
+
+        XCTAssertEqual(chunkCount, 0)
+    }
+}
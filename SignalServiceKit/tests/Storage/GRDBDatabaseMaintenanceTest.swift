@@ -0,0 +1,45 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class GRDBDatabaseMaintenanceTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+    }
+
+    func testReleasesFreePages() {
+        let store = SDSKeyValueStore(collection: "GRDBDatabaseMaintenanceTest")
+
+        self.write { transaction in
+            for index in 0..<256 {
+                store.setData(Randomness.generateRandomBytes(4096), key: "\(index)", transaction: transaction)
+            }
+        }
+        self.write { transaction in
+            store.removeAll(transaction: transaction)
+        }
+
+        guard let (before, after) = databaseStorage.grdbStorage.testing_runMaintenance() else {
+            XCTFail("Maintenance failed.")
+            return
+        }
+        XCTAssertGreaterThan(before.freePageCount, 0)
+        XCTAssertEqual(0, after.freePageCount)
+        XCTAssertLessThan(after.pageCount, before.pageCount)
+    }
+}
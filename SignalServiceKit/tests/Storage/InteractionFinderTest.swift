@@ -73,4 +73,190 @@ class InteractionFinderTest: SSKBaseTestSwift {
             XCTAssertEqual(2, finder2.count(transaction: transaction))
         }
     }
+
+    func testThreadInteractionCounters() {
+        let contactThread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213334444"))
+        let finder = InteractionFinder(threadUniqueId: contactThread.uniqueId)
+
+        let incomingMessages: [TSIncomingMessage] = (0..<3).map { index in
+            let builder = TSIncomingMessageBuilder(thread: contactThread,
+                                                   authorAddress: SignalServiceAddress(phoneNumber: "+13213334445"),
+                                                   messageBody: "\(index)")
+            builder.timestamp = UInt64(index + 1)
+            return builder.build()
+        }
+        let outgoingMessage = TSOutgoingMessage(in: contactThread, messageBody: "outgoing", attachmentId: nil)
+
+        self.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            for message in incomingMessages {
+                message.anyInsert(transaction: transaction)
+            }
+            outgoingMessage.anyInsert(transaction: transaction)
+        }
+        self.read { transaction in
+            XCTAssertEqual(4, finder.count(transaction: transaction))
+            XCTAssertEqual(3, finder.unreadCount(transaction: transaction.unwrapGrdbRead))
+        }
+
+        self.write { transaction in
+            incomingMessages[0].debugonly_markAsReadNow(transaction: transaction)
+            incomingMessages[1].anyRemove(transaction: transaction)
+        }
+        self.read { transaction in
+            XCTAssertEqual(3, finder.count(transaction: transaction))
+            XCTAssertEqual(1, finder.unreadCount(transaction: transaction.unwrapGrdbRead))
+        }
+
+        self.write { transaction in
+            XCTAssertEqual(0, ThreadInteractionCounters.verifyAndRepair(transaction: transaction.unwrapGrdbWrite))
+
+            // Simulate drift.
+            try! transaction.unwrapGrdbWrite.database.execute(sql: "UPDATE thread_interaction_counters SET unreadCount = 7")
+            XCTAssertEqual(1, ThreadInteractionCounters.verifyAndRepair(transaction: transaction.unwrapGrdbWrite))
+            XCTAssertEqual(0, ThreadInteractionCounters.verifyAndRepair(transaction: transaction.unwrapGrdbWrite))
+        }
+        self.read { transaction in
+            XCTAssertEqual(1, finder.unreadCount(transaction: transaction.unwrapGrdbRead))
+        }
+    }
+
+    func testMessageAttachmentIdProjection() {
+        let contactThread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213334444"))
+        let attachment = TSAttachmentStream(contentType: OWSMimeTypeImageGif,
+                                            byteCount: 1024,
+                                            sourceFilename: "some.gif",
+                                            caption: nil,
+                                            albumMessageId: nil)
+        let messageWithAttachment = TSOutgoingMessage(in: contactThread, messageBody: "good heavens", attachmentId: attachment.uniqueId)
+        let messageWithoutAttachment = TSOutgoingMessage(in: contactThread, messageBody: "oh my word", attachmentId: nil)
+
+        self.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            attachment.anyInsert(transaction: transaction)
+            messageWithAttachment.anyInsert(transaction: transaction)
+            messageWithoutAttachment.anyInsert(transaction: transaction)
+        }
+
+        self.read { transaction in
+            var attachmentIds = [String]()
+            InteractionFinder.enumerateAllMessageAttachmentIds(transaction: transaction) { ids, _ in
+                attachmentIds += ids
+            }
+            XCTAssertEqual([attachment.uniqueId], attachmentIds)
+            XCTAssertEqual(messageWithAttachment.allAttachmentIds(), attachmentIds)
+
+            XCTAssertNil(InteractionFinder.nextExpirationTimestamp(transaction: transaction))
+        }
+    }
+
+    func testThreadInteractionIdIndex() {
+        let contactThread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213334444"))
+        let otherThread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213334445"))
+        let messages: [TSOutgoingMessage] = (0..<5).map { index in
+            TSOutgoingMessage(in: contactThread, messageBody: "\(index)", attachmentId: nil)
+        }
+        let otherMessage = TSOutgoingMessage(in: otherThread, messageBody: "other", attachmentId: nil)
+
+        self.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            otherThread.anyInsert(transaction: transaction)
+            for message in messages.prefix(4) {
+                message.anyInsert(transaction: transaction)
+            }
+            otherMessage.anyInsert(transaction: transaction)
+        }
+
+        let index = ThreadInteractionIdIndex(threadUniqueId: contactThread.uniqueId)
+        let finder = InteractionFinder(threadUniqueId: contactThread.uniqueId)
+        func assertMatchesFinder() {
+            self.read { transaction in
+                try! index.update(transaction: transaction.unwrapGrdbRead)
+                XCTAssertEqual(Int(finder.count(transaction: transaction)), index.count)
+                let range = NSRange(location: 0, length: index.count + 1)
+                let interactionIds = try! finder.interactionIds(inRange: range, transaction: transaction)
+                XCTAssertEqual(interactionIds, index.interactionIds(inRange: range))
+                for (sortIndex, interactionId) in interactionIds.enumerated() {
+                    XCTAssertEqual(sortIndex, index.sortIndex(interactionUniqueId: interactionId))
+                }
+            }
+        }
+
+        assertMatchesFinder()
+        XCTAssertEqual(4, index.count)
+        XCTAssertEqual([messages[1].uniqueId, messages[2].uniqueId],
+                       index.interactionIds(inRange: NSRange(location: 1, length: 2)))
+        XCTAssertNil(index.sortIndex(interactionUniqueId: otherMessage.uniqueId))
+
+        // Inserts are picked up by the next update.
+        self.write { transaction in
+            messages[4].anyInsert(transaction: transaction)
+        }
+        assertMatchesFinder()
+        XCTAssertEqual(5, index.count)
+
+        // Deletes are applied from the database changes...
+        self.write { transaction in
+            messages[1].anyRemove(transaction: transaction)
+        }
+        index.didDeleteInteractions(uniqueIds: [messages[1].uniqueId, otherMessage.uniqueId])
+        assertMatchesFinder()
+        XCTAssertEqual(4, index.count)
+
+        // ...but if they're missed, the index reloads itself.
+        self.write { transaction in
+            messages[3].anyRemove(transaction: transaction)
+        }
+        assertMatchesFinder()
+        XCTAssertEqual(3, index.count)
+    }
+
+    func testFindMessagesWithTimestampsAndAuthors() {
+        let author = SignalServiceAddress(phoneNumber: "+13213334444")
+        let otherAuthor = SignalServiceAddress(phoneNumber: "+13213334445")
+        let contactThread = TSContactThread(contactAddress: author)
+        let otherThread = TSContactThread(contactAddress: otherAuthor)
+        let incomingMessages: [TSIncomingMessage] = (0..<3).map { index in
+            let builder = TSIncomingMessageBuilder(thread: contactThread,
+                                                   authorAddress: author,
+                                                   messageBody: "\(index)")
+            builder.timestamp = UInt64(index + 1)
+            return builder.build()
+        }
+        let otherBuilder = TSIncomingMessageBuilder(thread: otherThread,
+                                                    authorAddress: otherAuthor,
+                                                    messageBody: "other")
+        otherBuilder.timestamp = 2
+        let otherMessage = otherBuilder.build()
+
+        self.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            otherThread.anyInsert(transaction: transaction)
+            for message in incomingMessages {
+                message.anyInsert(transaction: transaction)
+            }
+            otherMessage.anyInsert(transaction: transaction)
+        }
+
+        self.read { transaction in
+            let references: [InteractionFinder.MessageReference] = [
+                (timestamp: 3, author: author),
+                (timestamp: 1, author: author),
+                // Wrong author.
+                (timestamp: 2, author: otherAuthor),
+                // No such message.
+                (timestamp: 4, author: author),
+                (timestamp: 2, author: author)
+            ]
+            let messages = InteractionFinder.findMessages(withTimestampsAndAuthors: references,
+                                                          threadId: contactThread.uniqueId,
+                                                          transaction: transaction)
+            XCTAssertEqual(messages.map { $0?.uniqueId },
+                           [incomingMessages[2].uniqueId,
+                            incomingMessages[0].uniqueId,
+                            nil,
+                            nil,
+                            incomingMessages[1].uniqueId])
+        }
+    }
 }
@@ -103,6 +103,24 @@
     }];
 }
 
+- (void)testSavedKeyIsReadAfterCommit
+{
+    NSData *originalKey = [Randomness generateRandomBytes:32];
+    NSData *otherKey = [Randomness generateRandomBytes:32];
+    SignalServiceAddress *address = [[SignalServiceAddress alloc] initWithPhoneNumber:@"+12223334444"];
+
+    [self writeWithBlock:^(SDSAnyWriteTransaction *transaction) {
+        [self.identityManager saveRemoteIdentity:originalKey address:address transaction:transaction];
+    }];
+    XCTAssertEqualObjects([self.identityManager identityKeyForAddress:address], originalKey);
+
+    [self writeWithBlock:^(SDSAnyWriteTransaction *transaction) {
+        [self.identityManager saveRemoteIdentity:otherKey address:address transaction:transaction];
+        XCTAssertEqualObjects([self.identityManager identityKeyForAddress:address transaction:transaction], otherKey);
+    }];
+    XCTAssertEqualObjects([self.identityManager identityKeyForAddress:address], otherKey);
+}
+
 - (void)testIdentityKey
 {
     [self.identityManager generateNewIdentityKey];
@@ -0,0 +1,238 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+import GRDB
+@testable import SignalServiceKit
+
+// Runs the finder queries against a seeded database and checks that
+// none of them fall back to scanning a whole table.
+class QueryPlanTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    // Scans of these are expected.
+    private static let allowedTableScans: Set<String> = [
+        // The message queues are processed in order, a batch at a time.
+        MessageContentJobRecord.databaseTableName,
+        IncomingGroupsV2MessageJobRecord.databaseTableName,
+        // The badge sums the counters of every thread. Newer versions
+        // of SQLite only report the alias of the table.
+        ThreadInteractionCounters.databaseTableName,
+        "counters"
+    ]
+
+    private var contactThread: TSContactThread!
+    private var incomingMessage: TSIncomingMessage!
+    private var attachment: TSAttachmentStream!
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+
+        let otherAddress = SignalServiceAddress(phoneNumber: "+13213334445")
+        let contactThread = TSContactThread(contactAddress: otherAddress)
+        let attachment = TSAttachmentStream(contentType: OWSMimeTypeImageGif,
+                                            byteCount: 1024,
+                                            sourceFilename: "some.gif",
+                                            caption: nil,
+                                            albumMessageId: nil)
+        let incomingMessages: [TSIncomingMessage] = (0..<10).map { index in
+            let builder = TSIncomingMessageBuilder(thread: contactThread,
+                                                   authorAddress: otherAddress,
+                                                   messageBody: "\(index)")
+            builder.timestamp = UInt64(index + 1)
+            return builder.build()
+        }
+        let outgoingMessage = TSOutgoingMessage(in: contactThread, messageBody: "outgoing", attachmentId: attachment.uniqueId)
+
+        self.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+            attachment.anyInsert(transaction: transaction)
+            for message in incomingMessages {
+                message.anyInsert(transaction: transaction)
+            }
+            outgoingMessage.anyInsert(transaction: transaction)
+
+            self.contactThread = TSContactThread.anyFetchContactThread(uniqueId: contactThread.uniqueId,
+                                                                       transaction: transaction)
+            self.attachment = TSAttachmentStream.anyFetchAttachmentStream(uniqueId: attachment.uniqueId,
+                                                                          transaction: transaction)
+        }
+        incomingMessage = incomingMessages.last
+    }
+
+    func testFinderQueryPlans() {
+        let statements = captureStatements { transaction in
+            let grdbTransaction = transaction.unwrapGrdbRead
+            let thread = self.contactThread!
+            let address = self.incomingMessage.authorAddress
+
+            // InteractionFinder
+            _ = try! InteractionFinder.fetch(uniqueId: self.incomingMessage.uniqueId, transaction: transaction)
+            _ = InteractionFinder.existsIncomingMessage(timestamp: 1, address: address, sourceDeviceId: 1, transaction: transaction)
+            _ = try! InteractionFinder.interactions(withTimestamp: 1, filter: { _ in true }, transaction: transaction)
+            _ = try! InteractionFinder.interactions(withTimestamps: [1, 2], filter: { _ in true }, transaction: transaction)
+            _ = InteractionFinder.findMessages(withTimestampsAndAuthors: [(timestamp: 1, author: address)],
+                                               threadId: thread.uniqueId,
+                                               transaction: transaction)
+            _ = try! InteractionFinder.outgoingMessagesByTimestamp(withTimestamps: [1, 2], transaction: transaction)
+            _ = InteractionFinder.incompleteCallIds(transaction: transaction)
+            _ = InteractionFinder.attemptingOutInteractionIds(transaction: transaction)
+            _ = InteractionFinder.unreadCountInAllThreads(transaction: grdbTransaction)
+            InteractionFinder.enumerateMessagesWithStartedPerConversationExpiration(transaction: transaction) { _, _ in }
+            _ = InteractionFinder.interactionIdsWithExpiredPerConversationExpiration(transaction: transaction)
+            _ = InteractionFinder.nextExpirationTimestamp(transaction: transaction)
+            InteractionFinder.enumerateMessagesWhichFailedToStartExpiring(transaction: transaction) { _, _ in }
+            _ = InteractionFinder.interactions(withInteractionIds: [self.incomingMessage.uniqueId], transaction: transaction)
+            _ = InteractionFinder.existsGroupCallMessageForEraId("eraId", thread: thread, transaction: transaction)
+            _ = InteractionFinder.unendedCallsForGroupThread(thread, transaction: transaction)
+
+            let finder = InteractionFinder(threadUniqueId: thread.uniqueId)
+            _ = finder.mostRecentInteractionForInbox(transaction: transaction)
+            _ = finder.earliestKnownInteractionRowId(transaction: transaction)
+            _ = try! finder.distanceFromLatest(interactionUniqueId: self.incomingMessage.uniqueId, transaction: transaction)
+            _ = finder.count(transaction: transaction)
+            _ = finder.unreadCount(transaction: grdbTransaction)
+            try! finder.enumerateInteractionIds(transaction: transaction) { _, _ in }
+            try! finder.enumerateRecentInteractions(transaction: transaction) { _, _ in }
+            try! finder.enumerateInteractions(range: NSRange(location: 2, length: 5), transaction: transaction) { _, _ in }
+            _ = try! finder.interactionIds(inRange: NSRange(location: 2, length: 5), transaction: transaction)
+            _ = finder.allUnreadMessages(transaction: grdbTransaction)
+            _ = finder.unreadMessages(beforeSortId: UInt64.max, transaction: grdbTransaction)
+            _ = finder.messagesWithUnreadReactions(beforeSortId: UInt64.max, transaction: grdbTransaction)
+            _ = try! finder.oldestUnreadInteraction(transaction: grdbTransaction)
+            _ = try! finder.interaction(afterSortId: 1, transaction: grdbTransaction)
+            _ = try! finder.interaction(at: 3, transaction: transaction)
+            _ = finder.firstInteraction(atOrAroundSortId: 3, transaction: transaction)
+            _ = finder.existsOutgoingMessage(transaction: transaction)
+            _ = finder.outgoingMessageCount(transaction: transaction)
+
+            let grdbFinder = GRDBInteractionFinder(threadUniqueId: thread.uniqueId)
+            try! grdbFinder.enumerateMessagesWithAttachments(transaction: grdbTransaction) { _, _ in }
+            _ = grdbFinder.hasGroupUpdateInfoMessage(transaction: grdbTransaction)
+            _ = grdbFinder.possiblyHasIncomingMessages(transaction: grdbTransaction)
+
+            // AttachmentFinder
+            _ = AttachmentFinder.unfailedAttachmentPointerIds(transaction: transaction)
+            AttachmentFinder.enumerateAttachmentPointersWithLazyRestoreFragments(transaction: transaction) { _, _ in }
+            _ = AttachmentFinder.fetchAttachments(uniqueIds: ["a", "b"], transaction: transaction)
+            _ = AttachmentFinder.attachments(withAttachmentIds: ["a", "b"], transaction: grdbTransaction)
+            _ = AttachmentFinder.attachments(withAttachmentIds: ["a", "b"],
+                                             matchingContentType: OWSMimeTypeImageGif,
+                                             transaction: grdbTransaction)
+            _ = AttachmentFinder.existsAttachments(withAttachmentIds: ["a", "b"],
+                                                   ignoringContentType: OWSMimeTypeImageGif,
+                                                   transaction: grdbTransaction)
+
+            // ViewOnceMessageFinder
+            _ = GRDBViewOnceMessageFinder().completionCandidates(afterRowId: 0,
+                                                                 autoCompleteCutoffMs: 1,
+                                                                 limit: 10,
+                                                                 transaction: grdbTransaction)
+
+            // MediaGalleryFinder
+            let mediaGalleryFinder = AnyMediaGalleryFinder(thread: thread)
+            _ = mediaGalleryFinder.mediaCount(transaction: transaction)
+            _ = mediaGalleryFinder.mostRecentMediaAttachment(transaction: transaction)
+            _ = mediaGalleryFinder.mediaIndex(attachment: self.attachment, transaction: transaction)
+            mediaGalleryFinder.enumerateMediaAttachments(range: NSRange(location: 0, length: 5),
+                                                         transaction: transaction) { _ in }
+
+            // Reactions
+            _ = MessageReactionCounts.emojiCounts(uniqueMessageId: self.incomingMessage.uniqueId,
+                                                  transaction: grdbTransaction)
+
+            // ThreadFinder
+            let threadFinder = AnyThreadFinder()
+            _ = try! threadFinder.visibleThreadCount(isArchived: false, transaction: transaction)
+            try! threadFinder.enumerateVisibleThreads(isArchived: false, transaction: transaction) { _ in }
+            _ = try! threadFinder.visibleThreadIds(isArchived: false, transaction: transaction)
+            _ = try! threadFinder.sortIndex(thread: thread, transaction: transaction)
+            _ = try! threadFinder.threads(withThreadIds: [thread.uniqueId], transaction: transaction)
+
+            // Job finders
+            let jobRecordFinder = AnyJobRecordFinder<SSKJobRecord>()
+            jobRecordFinder.enumerateJobRecords(label: "label", transaction: transaction) { _, _ in }
+            jobRecordFinder.enumerateJobRecords(label: "label", status: .ready, transaction: transaction) { _, _ in }
+            _ = AnyMessageContentJobFinder().nextJobs(batchSize: 10, transaction: transaction)
+            let groupsV2MessageJobFinder = GRDBGroupsV2MessageJobFinder()
+            _ = groupsV2MessageJobFinder.allEnqueuedGroupIds(transaction: grdbTransaction)
+            _ = groupsV2MessageJobFinder.nextJobs(batchSize: 10, transaction: grdbTransaction)
+            _ = groupsV2MessageJobFinder.nextJobs(forGroupId: Randomness.generateRandomBytes(32),
+                                                  batchSize: 10,
+                                                  transaction: grdbTransaction)
+            _ = groupsV2MessageJobFinder.jobCount(forGroupId: Randomness.generateRandomBytes(32),
+                                                  transaction: grdbTransaction)
+        }
+        XCTAssertFalse(statements.isEmpty)
+
+        self.read { transaction in
+            for sql in statements {
+                let tableScans = try! self.tableScans(sql: sql, transaction: transaction.unwrapGrdbRead)
+                    .filter { !Self.allowedTableScans.contains($0) }
+                XCTAssertEqual([], tableScans, "Query scans a table: \(sql)")
+            }
+        }
+    }
+
+    // MARK: - Helpers
+
+    // Returns the SELECT statements executed by the block.
+    private func captureStatements(block: @escaping (SDSAnyReadTransaction) -> Void) -> [String] {
+        let unfairLock = UnfairLock()
+        var statements = [String]()
+        GRDBDatabaseStorageAdapter.queryObserver.set { sql in
+            let sql = sql.trimmingCharacters(in: .whitespacesAndNewlines)
+            guard sql.uppercased().hasPrefix("SELECT") else {
+                return
+            }
+            unfairLock.withLock {
+                if !statements.contains(sql) {
+                    statements.append(sql)
+                }
+            }
+        }
+        defer {
+            GRDBDatabaseStorageAdapter.queryObserver.set(nil)
+        }
+
+        self.read(block)
+
+        return unfairLock.withLock { statements }
+    }
+
+    // Returns the names of the tables the query scans without an index.
+    private func tableScans(sql: String, transaction: GRDBReadTransaction) throws -> [String] {
+        let rows = try Row.fetchAll(transaction.database, sql: "EXPLAIN QUERY PLAN \(sql)")
+        return rows.compactMap { row -> String? in
+            // e.g. "SCAN TABLE model_TSInteraction" or, in newer versions
+            // of SQLite, "SCAN model_TSInteraction".
+            let detail: String = row["detail"]
+            var words = detail.components(separatedBy: " ")
+            guard words.first == "SCAN", !words.contains("USING") else {
+                return nil
+            }
+            words.removeFirst()
+            if words.first == "TABLE" {
+                words.removeFirst()
+            }
+            guard let name = words.first,
+                  !name.hasPrefix("("),
+                  name != "SUBQUERY",
+                  name != "CONSTANT" else {
+                return nil
+            }
+            return name
+        }
+    }
+}
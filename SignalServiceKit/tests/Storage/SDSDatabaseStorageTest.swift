@@ -4,6 +4,7 @@
 
 import Foundation
 import XCTest
+import PromiseKit
 @testable import SignalServiceKit
 
 extension TSThread {
@@ -82,6 +83,11 @@ class SDSDatabaseStorageTest: SSKBaseTestSwift {
 
         XCTAssertEqual(2, TSThread.anyFetchAll(databaseStorage: storage).count)
 
+        // Copies of a group thread share its immutable group model.
+        let groupThreadCopy: TSGroupThread = try! DeepCopies.deepCopy(groupThread)
+        XCTAssertFalse(groupThreadCopy === groupThread)
+        XCTAssertTrue(groupThreadCopy.groupModel === groupThread.groupModel)
+
         storage.write { transaction in
             XCTAssertEqual(2, TSThread.anyFetchAll(transaction: transaction).count)
             contactThread.anyRemove(transaction: transaction)
@@ -185,4 +191,57 @@ class SDSDatabaseStorageTest: SSKBaseTestSwift {
         XCTAssertEqual(1, TSThread.anyFetchAll(databaseStorage: storage).count)
         XCTAssertEqual(0, TSInteraction.anyFetchAll(databaseStorage: storage).count)
     }
+
+    func test_concurrentRead() {
+        let storage = SDSDatabaseStorage.shared
+
+        let contactThread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213214321"))
+        storage.write { transaction in
+            contactThread.anyInsert(transaction: transaction)
+        }
+
+        let blocks: [(SDSAnyReadTransaction) -> Int] = (0..<10).map { index in
+            return { transaction in
+                XCTAssertFalse(Thread.isMainThread)
+                return index + TSThread.anyFetchAll(transaction: transaction).count
+            }
+        }
+
+        let expectation = self.expectation(description: "concurrent read")
+        storage.concurrentRead(.promise, blocks).done { results in
+            XCTAssertEqual(Array(1...10), results)
+            expectation.fulfill()
+        }.catch { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 5.0, handler: nil)
+    }
+
+    func test_coalescedWrite() {
+        let storage = SDSDatabaseStorage.shared
+        let store = SDSKeyValueStore(collection: "test_coalescedWrite")
+        let commitCount = storage.writeCoalescer.commitCount
+
+        let promises: [Promise<Void>] = (0..<3).map { index in
+            storage.coalescedWrite { transaction in
+                store.setInt(index, key: "\(index)", transaction: transaction)
+            }
+        }
+
+        let expectation = self.expectation(description: "coalesced writes")
+        when(fulfilled: promises).done {
+            // The writes have committed by the time their promises are fulfilled.
+            storage.read { transaction in
+                for index in 0..<3 {
+                    XCTAssertEqual(index, store.getInt("\(index)", transaction: transaction))
+                }
+            }
+            expectation.fulfill()
+        }.catch { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 5.0, handler: nil)
+
+        XCTAssertEqual(commitCount + 1, storage.writeCoalescer.commitCount)
+    }
 }
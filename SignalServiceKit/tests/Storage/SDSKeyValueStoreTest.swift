@@ -216,4 +216,67 @@ class SDSKeyValueStoreTest: SSKBaseTestSwift {
             XCTAssertEqual(0, store.numberOfKeys(transaction: transaction))
         }
     }
+
+    func test_typedEncoding() {
+        let values: [Any] = [
+            NSNumber(value: true),
+            NSNumber(value: Int64.min),
+            NSNumber(value: UInt64.max),
+            NSNumber(value: 1.5),
+            "a string" as NSString,
+            Date(timeIntervalSince1970: 1234) as NSDate,
+            Data([0, 1, 2]) as NSData,
+            ["a", "b"] as NSArray,
+            NSSet(array: [NSNumber(value: 1), NSNumber(value: 2)]),
+            [[NSNumber(value: 1)], ["a"]] as NSArray
+        ]
+        for value in values {
+            guard let encoded = SDSKeyValueEncoding.encode(value) else {
+                XCTFail("Couldn't encode: \(value)")
+                continue
+            }
+            XCTAssertTrue(SDSKeyValueEncoding.isEncoded(encoded))
+            XCTAssertEqual(value as? NSObject, try? SDSKeyValueEncoding.decode(encoded) as? NSObject)
+        }
+
+        // Other types are archived.
+        XCTAssertNil(SDSKeyValueEncoding.encode(["a": "b"]))
+        XCTAssertNil(SDSKeyValueEncoding.encode([["a": "b"]]))
+
+        // Keyed archives aren't mistaken for encoded values.
+        XCTAssertFalse(SDSKeyValueEncoding.isEncoded(NSKeyedArchiver.archivedData(withRootObject: "a string")))
+
+        guard var truncated = SDSKeyValueEncoding.encode("a string") else {
+            XCTFail("Couldn't encode.")
+            return
+        }
+        truncated.removeLast()
+        XCTAssertThrowsError(try SDSKeyValueEncoding.decode(truncated))
+    }
+
+    func test_batches() {
+        SSKEnvironment.shared.storageCoordinator.useGRDBForTests()
+
+        let store = SDSKeyValueStore(collection: "test")
+
+        self.write { transaction in
+            store.setObjects(["a": NSNumber(value: 1),
+                              "b": ["x", "y"],
+                              "c": ["key": "value"]],
+                             transaction: transaction)
+        }
+
+        self.read { transaction in
+            let values = store.getObjects(forKeys: ["a", "c", "missing"], transaction: transaction)
+            XCTAssertEqual(["a", "c"], Set(values.keys))
+            XCTAssertEqual(1, values["a"] as? Int)
+            XCTAssertEqual(["key": "value"], values["c"] as? [String: String])
+
+            let allValues = store.allKeysAndObjects(transaction: transaction)
+            XCTAssertEqual(["a", "b", "c"], Set(allValues.keys))
+            XCTAssertEqual(["x", "y"], allValues["b"] as? [String])
+
+            XCTAssertEqual(3, store.allValues(transaction: transaction).count)
+        }
+    }
 }
@@ -0,0 +1,72 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class SDSParallelEnumerationTest: SSKBaseTestSwift {
+
+    // MARK: - Dependencies
+
+    var storageCoordinator: StorageCoordinator {
+        return SSKEnvironment.shared.storageCoordinator
+    }
+
+    // MARK: -
+
+    private var messageIds = [String]()
+
+    override func setUp() {
+        super.setUp()
+
+        storageCoordinator.useGRDBForTests()
+
+        write { transaction in
+            let address = SignalServiceAddress(phoneNumber: "+12345678900")
+            let thread = TSContactThread.getOrCreateThread(withContactAddress: address, transaction: transaction)
+            self.messageIds = (0..<50).map { index in
+                let message = TSOutgoingMessage(in: thread, messageBody: "\(index)", attachmentId: nil)
+                message.anyInsert(transaction: transaction)
+                return message.uniqueId
+            }
+        }
+    }
+
+    private func enumerate(order: SDSEnumerationOrder, stopAfter limit: Int = Int.max) -> [String] {
+        var result = [String]()
+        read { transaction in
+            TSInteraction.grdbEnumerateInParallel(recordType: InteractionRecord.self,
+                                                  sql: """
+                                                    SELECT * FROM \(InteractionRecord.databaseTableName)
+                                                    ORDER BY \(interactionColumn: .id)
+                                                    """,
+                                                  transaction: transaction.unwrapGrdbRead,
+                                                  batchSize: 7,
+                                                  order: order,
+                                                  decode: { try TSInteraction.fromRecord($0) }) { interaction, stop in
+                result.append(interaction.uniqueId)
+                if result.count >= limit {
+                    stop.pointee = true
+                }
+            }
+        }
+        return result
+    }
+
+    func testOrderedEnumeration() {
+        XCTAssertEqual(messageIds, enumerate(order: .ordered))
+    }
+
+    func testUnorderedEnumeration() {
+        let uniqueIds = enumerate(order: .unordered)
+        XCTAssertEqual(messageIds.count, uniqueIds.count)
+        XCTAssertEqual(Set(messageIds), Set(uniqueIds))
+    }
+
+    func testStop() {
+        XCTAssertEqual(Array(messageIds.prefix(10)), enumerate(order: .ordered, stopAfter: 10))
+        XCTAssertEqual(10, enumerate(order: .unordered, stopAfter: 10).count)
+    }
+}
@@ -4,6 +4,7 @@
 
 #import "SSKBaseTestObjC.h"
 #import "SSKPreKeyStore.h"
+#import <Curve25519Kit/Curve25519.h>
 #import <SignalServiceKit/SDSDatabaseStorage+Objc.h>
 #import <SignalServiceKit/SignalServiceKit-Swift.h>
 
@@ -15,6 +16,8 @@
 
 @interface SSKPreKeyStore (Tests)
 
+@property (nonatomic, readonly) NSMutableArray<ECKeyPair *> *pregeneratedKeyPairs;
+
 @end
 
 #pragma mark -
@@ -80,6 +83,34 @@
         isEqualToData:firstPreKeyRecord.keyPair.publicKey]);
 }
 
+- (void)testPregeneratedPreKeys
+{
+    [self.preKeyStore pregeneratePreKeysIfNecessary];
+
+    __block NSArray<ECKeyPair *> *pregeneratedKeyPairs;
+    NSPredicate *predicate = [NSPredicate predicateWithBlock:^BOOL(SSKPreKeyStore *preKeyStore, id bindings) {
+        @synchronized(preKeyStore.pregeneratedKeyPairs) {
+            pregeneratedKeyPairs = [preKeyStore.pregeneratedKeyPairs copy];
+        }
+        return pregeneratedKeyPairs.count == 100;
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:predicate evaluatedWithObject:self.preKeyStore handler:nil] ]
+                      timeout:10];
+
+    NSArray<PreKeyRecord *> *generatedKeys = [self.preKeyStore generatePreKeyRecords];
+    XCTAssertEqual(generatedKeys.count, 100);
+    XCTAssertEqual(self.preKeyStore.pregeneratedKeyPairs.count, 0);
+
+    NSMutableSet<NSData *> *pregeneratedPublicKeys = [NSMutableSet new];
+    for (ECKeyPair *keyPair in pregeneratedKeyPairs) {
+        [pregeneratedPublicKeys addObject:keyPair.publicKey];
+    }
+    for (PreKeyRecord *record in generatedKeys) {
+        XCTAssertTrue([pregeneratedPublicKeys containsObject:record.keyPair.publicKey]);
+        XCTAssertEqual(record.Id, generatedKeys.firstObject.Id + (int)[generatedKeys indexOfObject:record]);
+    }
+}
+
 - (void)testRemovingPreKeys
 {
     NSArray *generatedKeys = [self.preKeyStore generatePreKeyRecords];
@@ -0,0 +1,63 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+import AxolotlKit
+@testable import SignalServiceKit
+
+class SessionRecordCacheTest: SSKBaseTestSwift {
+
+    private let accountId = "SessionRecordCacheTest"
+
+    private func previousStateCount(_ cache: SessionRecordCache, transaction: SDSAnyReadTransaction) -> Int? {
+        cache.sessionRecords(accountId: accountId, transaction: transaction)[1]?.previousSessionStates().count
+    }
+
+    func testStoredRecordsAreWrittenBack() {
+        let cache = SessionRecordCache(keyValueStore: SDSKeyValueStore(collection: "SessionRecordCacheTest"))
+
+        write { transaction in
+            cache.storeSessionRecord(SessionRecord(), accountId: self.accountId, deviceId: 1, transaction: transaction)
+            cache.storeSessionRecord(SessionRecord(), accountId: self.accountId, deviceId: 2, transaction: transaction)
+            cache.removeSessionRecord(accountId: self.accountId, deviceId: 2, transaction: transaction)
+            XCTAssertNotNil(cache.loadSessionRecord(accountId: self.accountId, deviceId: 1, transaction: transaction))
+        }
+
+        read { transaction in
+            let records = cache.sessionRecords(accountId: self.accountId, transaction: transaction)
+            XCTAssertEqual(Set(records.keys), [1])
+        }
+    }
+
+    func testUnstoredChangesAreDiscarded() {
+        let cache = SessionRecordCache(keyValueStore: SDSKeyValueStore(collection: "SessionRecordCacheTest"))
+
+        write { transaction in
+            cache.storeSessionRecord(SessionRecord(), accountId: self.accountId, deviceId: 1, transaction: transaction)
+
+            // Loaded and modified, but never stored, e.g. after a failed decryption.
+            let record = cache.loadSessionRecord(accountId: self.accountId, deviceId: 1, transaction: transaction)
+            record?.archiveCurrentState()
+
+            let reloadedRecord = cache.loadSessionRecord(accountId: self.accountId, deviceId: 1, transaction: transaction)
+            XCTAssertEqual(reloadedRecord?.previousSessionStates().count, 0)
+        }
+
+        read { transaction in
+            XCTAssertEqual(self.previousStateCount(cache, transaction: transaction), 0)
+        }
+
+        write { transaction in
+            let record = cache.loadSessionRecord(accountId: self.accountId, deviceId: 1, transaction: transaction)!
+            record.archiveCurrentState()
+            cache.storeSessionRecord(record, accountId: self.accountId, deviceId: 1, transaction: transaction)
+            XCTAssertEqual(self.previousStateCount(cache, transaction: transaction), 1)
+        }
+
+        read { transaction in
+            XCTAssertEqual(self.previousStateCount(cache, transaction: transaction), 1)
+        }
+    }
+}
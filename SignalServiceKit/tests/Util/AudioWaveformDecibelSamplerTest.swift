@@ -0,0 +1,54 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class AudioWaveformDecibelSamplerTest: SSKBaseTestSwift {
+
+    private func sample(_ amplitudes: [Int16], groupSize: Int, chunkSize: Int) -> [Float] {
+        let sampler = AudioWaveformDecibelSampler(groupSize: groupSize)
+        amplitudes.withUnsafeBufferPointer { amplitudes in
+            var offset = 0
+            while offset < amplitudes.count {
+                let count = min(chunkSize, amplitudes.count - offset)
+                sampler.append(amplitudes: amplitudes.baseAddress! + offset, count: count)
+                offset += count
+            }
+        }
+        return sampler.decibelSamples
+    }
+
+    func testAveragesGroups() {
+        // Full scale is 0 dB; a tenth of full scale is -20 dB; silence is clipped to -50 dB.
+        let loud = [Int16](repeating: Int16.max, count: 4)
+        let quiet = [Int16](repeating: Int16.max / 10, count: 4)
+        let silent = [Int16](repeating: 0, count: 4)
+        let samples = sample(loud + [Int16.min + 1, Int16.max, 0, 0] + quiet + silent + [Int16.max],
+                             groupSize: 4,
+                             chunkSize: 1024)
+
+        // The trailing partial group is discarded.
+        XCTAssertEqual(4, samples.count)
+        XCTAssertEqual(0, samples[0], accuracy: 0.01)
+        XCTAssertEqual(-25, samples[1], accuracy: 0.01)
+        XCTAssertEqual(-20, samples[2], accuracy: 0.01)
+        XCTAssertEqual(-50, samples[3], accuracy: 0.01)
+    }
+
+    func testIgnoresChunkBoundaries() {
+        let amplitudes: [Int16] = (0..<10_000).map { Int16(truncatingIfNeeded: $0 * 7919) }
+        let expected = sample(amplitudes, groupSize: 100, chunkSize: amplitudes.count)
+        XCTAssertEqual(100, expected.count)
+
+        for chunkSize in [1, 7, 99, 100, 1024] {
+            let samples = sample(amplitudes, groupSize: 100, chunkSize: chunkSize)
+            XCTAssertEqual(expected.count, samples.count)
+            for (sample, expectedSample) in zip(samples, expected) {
+                XCTAssertEqual(expectedSample, sample, accuracy: 0.001)
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+import PromiseKit
+@testable import SignalServiceKit
+
+class BoundedWorkQueueTest: SSKBaseTestSwift {
+
+    func testConcurrencyLimit() {
+        let queue = BoundedWorkQueue(label: "BoundedWorkQueueTest", maxConcurrentCount: 3)
+
+        let lock = UnfairLock()
+        var activeCount = 0
+        var maxActiveCount = 0
+
+        var promises = [Promise<Int>]()
+        for index in 0..<20 {
+            promises.append(queue.enqueue { () -> Promise<Int> in
+                lock.withLock {
+                    activeCount += 1
+                    maxActiveCount = max(maxActiveCount, activeCount)
+                }
+                // Each item stays in flight until its promise resolves.
+                return after(seconds: 0.01).map { () -> Int in
+                    lock.withLock {
+                        activeCount -= 1
+                    }
+                    return index
+                }
+            })
+        }
+
+        let expectation = self.expectation(description: "All items complete.")
+        when(fulfilled: promises).done { results in
+            XCTAssertEqual(Array(0..<20), results)
+            expectation.fulfill()
+        }.catch { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 10)
+
+        XCTAssertLessThanOrEqual(maxActiveCount, 3)
+        XCTAssertGreaterThan(maxActiveCount, 0)
+    }
+
+    func testErrorsReleaseSlots() {
+        let queue = BoundedWorkQueue(label: "BoundedWorkQueueTest", maxConcurrentCount: 1)
+
+        let failingPromise = queue.enqueue { () -> Promise<Void> in
+            throw OWSGenericError("Failure.")
+        }
+        let succeedingPromise = queue.enqueue { Promise.value(1) }
+
+        let expectation = self.expectation(description: "Second item completes.")
+        failingPromise.catch { _ in
+            succeedingPromise.done { value in
+                XCTAssertEqual(1, value)
+                expectation.fulfill()
+            }.catch { error in
+                XCTFail("Error: \(error)")
+            }
+        }
+        waitForExpectations(timeout: 10)
+    }
+
+    func testMaxConcurrentCount() {
+        XCTAssertEqual(1, BoundedWorkQueue.maxConcurrentCount(bytesPerItem: UInt64.max))
+        XCTAssertLessThanOrEqual(BoundedWorkQueue.maxConcurrentCount(bytesPerItem: 1),
+                                 ProcessInfo.processInfo.activeProcessorCount)
+    }
+}
@@ -0,0 +1,100 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class CoalescingNotificationCenterTest: SSKBaseTestSwift {
+
+    private let testNotification = Notification.Name("CoalescingNotificationCenterTest")
+    private let otherNotification = Notification.Name("CoalescingNotificationCenterTest.other")
+    private let window: TimeInterval = 0.1
+
+    func testBurstIsMerged() {
+        let notificationCenter = NotificationCenter()
+        let coalescingCenter = CoalescingNotificationCenter(notificationCenter: notificationCenter)
+
+        var notifications = [Notification]()
+        let observer = notificationCenter.addObserver(forName: testNotification, object: nil, queue: nil) { notification in
+            AssertIsOnMainThread()
+            notifications.append(notification)
+        }
+        defer { notificationCenter.removeObserver(observer) }
+
+        for index in 0..<5 {
+            coalescingCenter.post(name: testNotification, userInfo: ["index": index], window: window)
+        }
+        XCTAssertTrue(notifications.isEmpty)
+
+        // Wait past the window, so that a redundant delayed delivery would be observed.
+        let expectation = self.expectation(description: "waited")
+        DispatchQueue.main.asyncAfter(deadline: .now() + window * 3) {
+            expectation.fulfill()
+        }
+        waitForExpectations(timeout: 1.0)
+
+        XCTAssertEqual(1, notifications.count)
+        XCTAssertEqual(1, coalescingCenter.deliveryCount.get())
+        let notification = notifications[0]
+        XCTAssertEqual([0, 1, 2, 3, 4], notification.coalescedUserInfos.compactMap { $0["index"] as? Int })
+        // Later values replace earlier ones.
+        XCTAssertEqual(4, notification.userInfo?["index"] as? Int)
+    }
+
+    func testNamesAreCoalescedSeparately() {
+        let notificationCenter = NotificationCenter()
+        let coalescingCenter = CoalescingNotificationCenter(notificationCenter: notificationCenter)
+
+        let expectation1 = self.expectation(description: "test")
+        let expectation2 = self.expectation(description: "other")
+        let observer1 = notificationCenter.addObserver(forName: testNotification, object: nil, queue: nil) { notification in
+            XCTAssertNil(notification.userInfo)
+            XCTAssertTrue(notification.coalescedUserInfos.isEmpty)
+            expectation1.fulfill()
+        }
+        let observer2 = notificationCenter.addObserver(forName: otherNotification, object: nil, queue: nil) { _ in
+            expectation2.fulfill()
+        }
+        defer {
+            notificationCenter.removeObserver(observer1)
+            notificationCenter.removeObserver(observer2)
+        }
+
+        coalescingCenter.post(name: testNotification, window: window)
+        coalescingCenter.post(name: otherNotification, window: window)
+        coalescingCenter.post(name: testNotification, window: window)
+        waitForExpectations(timeout: 1.0)
+    }
+
+    func testLaterBurstIsDelivered() {
+        let notificationCenter = NotificationCenter()
+        let coalescingCenter = CoalescingNotificationCenter(notificationCenter: notificationCenter)
+
+        var deliveredCount = 0
+        let observer = notificationCenter.addObserver(forName: testNotification, object: nil, queue: nil) { _ in
+            deliveredCount += 1
+        }
+        defer { notificationCenter.removeObserver(observer) }
+
+        coalescingCenter.post(name: testNotification, window: window)
+        let expectation1 = self.expectation(description: "first")
+        DispatchQueue.main.async {
+            XCTAssertEqual(1, deliveredCount)
+
+            // This notification is posted within the window, so it is delayed.
+            coalescingCenter.post(name: self.testNotification, window: self.window)
+            XCTAssertEqual(1, deliveredCount)
+            expectation1.fulfill()
+        }
+        waitForExpectations(timeout: 1.0)
+
+        let expectation2 = self.expectation(description: "second")
+        DispatchQueue.main.asyncAfter(deadline: .now() + window * 3) {
+            XCTAssertEqual(2, deliveredCount)
+            expectation2.fulfill()
+        }
+        waitForExpectations(timeout: 1.0)
+    }
+}
@@ -0,0 +1,52 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+import Compression
+@testable import SignalServiceKit
+
+class DataGzipTest: SSKBaseTestSwift {
+
+    func testCRC32() {
+        XCTAssertEqual(Data.crc32(Data("123456789".utf8)), 0xcbf43926)
+        XCTAssertEqual(Data.crc32(Data()), 0)
+    }
+
+    func testGzipCompressed() throws {
+        let input = Data(String(repeating: "{\"destinationDeviceId\":1,\"content\":\"abc\"},", count: 100).utf8)
+        let compressed = try XCTUnwrap(input.gzipCompressed())
+        XCTAssertLessThan(compressed.count, input.count)
+
+        // Header.
+        XCTAssertEqual(Array(compressed.prefix(3)), [0x1f, 0x8b, 0x08])
+
+        // Trailer: CRC-32 and size, little-endian.
+        let trailer = Array(compressed.suffix(8))
+        let crc = trailer[0..<4].reversed().reduce(UInt32(0)) { ($0 << 8) | UInt32($1) }
+        let size = trailer[4..<8].reversed().reduce(UInt32(0)) { ($0 << 8) | UInt32($1) }
+        XCTAssertEqual(crc, Data.crc32(input))
+        XCTAssertEqual(size, UInt32(input.count))
+
+        // The DEFLATE stream round-trips.
+        let deflated = Data(compressed.dropFirst(10).dropLast(8))
+        var output = Data(count: input.count)
+        let outputCount = output.withUnsafeMutableBytes { (dstBuffer: UnsafeMutableRawBufferPointer) -> Int in
+            deflated.withUnsafeBytes { (srcBuffer: UnsafeRawBufferPointer) -> Int in
+                compression_decode_buffer(dstBuffer.bindMemory(to: UInt8.self).baseAddress!,
+                                          input.count,
+                                          srcBuffer.bindMemory(to: UInt8.self).baseAddress!,
+                                          deflated.count,
+                                          nil,
+                                          COMPRESSION_ZLIB)
+            }
+        }
+        XCTAssertEqual(output.prefix(outputCount), input)
+    }
+
+    func testIncompressibleData() {
+        XCTAssertNil(Data().gzipCompressed())
+        XCTAssertNil(Randomness.generateRandomBytes(16).gzipCompressed())
+    }
+}
@@ -0,0 +1,43 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+@testable import SignalServiceKit
+
+class DataSourceTest: SSKBaseTestSwift {
+
+    private let sampleData = Data((0..<1024).map { UInt8(truncatingIfNeeded: $0 * 31) })
+
+    private func dataSources() throws -> [DataSource] {
+        let valueDataSource = DataSourceValue.dataSource(with: sampleData, fileExtension: "bin")!
+        let pathDataSource = try DataSourcePath.dataSourceWritingTempFileData(sampleData, fileExtension: "bin")
+        let mappedDataSource = try DataSourceMappedPath.dataSourceWritingTempFileData(sampleData, fileExtension: "bin")
+        return [valueDataSource, pathDataSource, mappedDataSource]
+    }
+
+    func testData() throws {
+        for dataSource in try dataSources() {
+            XCTAssertEqual(sampleData, dataSource.data)
+            XCTAssertEqual(UInt(sampleData.count), dataSource.dataLength)
+        }
+    }
+
+    func testReadDataInRange() throws {
+        for dataSource in try dataSources() {
+            XCTAssertEqual(sampleData.subdata(in: 0..<16), try dataSource.readData(in: NSRange(location: 0, length: 16)))
+            XCTAssertEqual(sampleData.subdata(in: 500..<1024), try dataSource.readData(in: NSRange(location: 500, length: 524)))
+            XCTAssertEqual(Data(), try dataSource.readData(in: NSRange(location: 1024, length: 0)))
+
+            XCTAssertThrowsError(try dataSource.readData(in: NSRange(location: 1000, length: 25)))
+            XCTAssertThrowsError(try dataSource.readData(in: NSRange(location: 1025, length: 0)))
+        }
+    }
+
+    func testReadDataInRange_afterData() throws {
+        let dataSource = try DataSourceMappedPath.dataSourceWritingTempFileData(sampleData, fileExtension: "bin")
+        XCTAssertEqual(sampleData, dataSource.data)
+        XCTAssertEqual(sampleData.subdata(in: 100..<200), try dataSource.readData(in: NSRange(location: 100, length: 100)))
+    }
+}
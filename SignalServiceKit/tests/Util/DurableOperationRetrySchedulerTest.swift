@@ -0,0 +1,91 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+class DurableOperationRetrySchedulerTest: SSKBaseTestSwift {
+
+    func test_jitteredRetryInterval() {
+        XCTAssertEqual(0, DurableOperationRetryScheduler.jitteredRetryInterval(0))
+        for _ in 0..<100 {
+            let interval = DurableOperationRetryScheduler.jitteredRetryInterval(10)
+            XCTAssertGreaterThanOrEqual(interval, 5)
+            XCTAssertLessThanOrEqual(interval, 10)
+        }
+    }
+
+    func test_runPendingRetryNow() {
+        class RetryingOperation: OWSOperation {
+            let expectation: XCTestExpectation
+
+            init(expectation: XCTestExpectation) {
+                self.expectation = expectation
+                super.init()
+            }
+
+            override func run() {
+                expectation.fulfill()
+                reportSuccess()
+            }
+        }
+
+        let scheduler = DurableOperationRetryScheduler.shared
+        let operation = RetryingOperation(expectation: expectation(description: "retried"))
+        XCTAssertFalse(scheduler.runPendingRetryNow(operation: operation))
+
+        let pendingRetryCount = scheduler.pendingRetryCount
+        scheduler.scheduleRetry(operation: operation, retryInterval: 60)
+        XCTAssertEqual(pendingRetryCount + 1, scheduler.pendingRetryCount)
+
+        XCTAssertTrue(scheduler.runPendingRetryNow(operation: operation))
+        XCTAssertEqual(pendingRetryCount, scheduler.pendingRetryCount)
+        XCTAssertFalse(scheduler.runPendingRetryNow(operation: operation))
+
+        waitForExpectations(timeout: 1.0, handler: nil)
+    }
+
+    func test_userVisibleRetriesAreExemptFromCap() {
+        class PendingOperation: OWSOperation {
+            let runCount = AtomicUInt(0)
+
+            override func run() {
+                // Don't report back, so that the attempt stays in flight.
+                runCount.increment()
+            }
+        }
+
+        let scheduler = DurableOperationRetryScheduler.shared
+        let heldRetryCount = scheduler.heldRetryCount
+
+        // One more background retry than there are slots.
+        let backgroundOperations = (0...DurableOperationRetryScheduler.maxConcurrentRetries).map { _ in
+            PendingOperation()
+        }
+        let userVisibleOperation = PendingOperation()
+        userVisibleOperation.queuePriority = .high
+        for operation in backgroundOperations + [userVisibleOperation] {
+            scheduler.scheduleRetry(operation: operation, retryInterval: 0)
+        }
+
+        let expectation = self.expectation(description: "retries started")
+        DispatchQueue.global().asyncAfter(deadline: .now() + 0.5) {
+            expectation.fulfill()
+        }
+        waitForExpectations(timeout: 1.0, handler: nil)
+
+        let startedOperations = backgroundOperations.filter { $0.runCount.get() > 0 }
+        XCTAssertEqual(DurableOperationRetryScheduler.maxConcurrentRetries, startedOperations.count)
+        XCTAssertEqual(1, userVisibleOperation.runCount.get())
+        XCTAssertEqual(heldRetryCount + 1, scheduler.heldRetryCount)
+
+        // Finishing an attempt frees a slot for the held retry.
+        startedOperations[0].reportSuccess()
+        XCTAssertEqual(heldRetryCount, scheduler.heldRetryCount)
+
+        for operation in backgroundOperations + [userVisibleOperation] where operation !== startedOperations[0] {
+            operation.reportSuccess()
+        }
+    }
+}
@@ -91,6 +91,51 @@ class JobQueueTest: SSKBaseTestSwift {
 
     // MARK: 
 
+    func test_nextReadyRecordsRespectsLimitAndOrder() {
+        let jobRecords = (0..<3).map { _ in buildJobRecord() }
+        self.write { transaction in
+            for jobRecord in jobRecords {
+                jobRecord.anyInsert(transaction: transaction)
+            }
+        }
+
+        let finder = AnyJobRecordFinder<TestJobRecord>()
+        self.read { transaction in
+            let firstTwo = finder.nextReadyRecords(label: kJobRecordLabel, limit: 2, transaction: transaction)
+            XCTAssertEqual(jobRecords.prefix(2).map { $0.uniqueId }, firstTwo.map { $0.uniqueId })
+
+            let all = finder.nextReadyRecords(label: kJobRecordLabel, limit: 10, transaction: transaction)
+            XCTAssertEqual(jobRecords.map { $0.uniqueId }, all.map { $0.uniqueId })
+
+            XCTAssertEqual(0, finder.nextReadyRecords(label: kJobRecordLabel, limit: 0, transaction: transaction).count)
+        }
+    }
+
+    func test_stateTransitionsArePersisted() {
+        let jobRecord = buildJobRecord()
+        self.write { transaction in
+            jobRecord.anyInsert(transaction: transaction)
+            try! jobRecord.saveAsStarted(transaction: transaction)
+            try! jobRecord.addFailure(transaction: transaction)
+        }
+
+        let latestCopy = { () -> TestJobRecord in
+            return self.databaseStorage.read { transaction in
+                TestJobRecord.anyFetch(uniqueId: jobRecord.uniqueId, transaction: transaction)!
+            }
+        }
+        XCTAssertEqual(.running, latestCopy().status)
+        XCTAssertEqual(1, latestCopy().failureCount)
+
+        self.write { transaction in
+            try! jobRecord.saveRunningAsReady(transaction: transaction)
+        }
+        XCTAssertEqual(.ready, jobRecord.status)
+        XCTAssertEqual(.ready, latestCopy().status)
+        XCTAssertEqual(1, latestCopy().failureCount)
+        XCTAssertEqual(kJobRecordLabel, latestCopy().label)
+    }
+
     #if BROKEN_TESTS
 
     func test_setupMarksInProgressJobsAsReady() {
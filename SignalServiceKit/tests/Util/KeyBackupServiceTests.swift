@@ -4,6 +4,7 @@
 
 import Foundation
 import XCTest
+import PromiseKit
 
 @testable import SignalServiceKit
 
@@ -112,6 +113,48 @@ class KeyBackupServiceTests: SSKBaseTestSwift {
         AssertPin("notmypassword", isValid: false)
     }
 
+    func test_derivationCancellation() throws {
+        let pin = "apassword"
+        let backupId = Cryptography.generateRandomBytes(32)
+
+        let cancellation = KeyBackupService.DerivationCancellation()
+        cancellation.cancel()
+
+        let cancelledExpectation = expectation(description: "Cancelled derivation")
+        KeyBackupService.deriveEncryptionKeyAndAccessKey(
+            pin: pin,
+            backupId: backupId,
+            cancellation: cancellation
+        ).done { _ in
+            XCTFail("Derivation should have been cancelled")
+        }.catch(policy: .allErrors) { error in
+            XCTAssertTrue(error.isCancelled)
+            cancelledExpectation.fulfill()
+        }
+        wait(for: [cancelledExpectation], timeout: 5)
+
+        let derivedExpectation = expectation(description: "Derivation")
+        KeyBackupService.deriveEncryptionKeyAndAccessKey(
+            pin: pin,
+            backupId: backupId,
+            cancellation: nil
+        ).then { keys in
+            // Once derived, the keys are cached for the session.
+            KeyBackupService.deriveEncryptionKeyAndAccessKey(
+                pin: pin,
+                backupId: backupId,
+                cancellation: cancellation
+            ).map { (keys, $0) }
+        }.done { keys, cachedKeys in
+            XCTAssertEqual(keys.encryptionKey, cachedKeys.encryptionKey)
+            XCTAssertEqual(keys.accessKey, cachedKeys.accessKey)
+            derivedExpectation.fulfill()
+        }.catch(policy: .allErrors) { error in
+            XCTFail("Unexpected error: \(error)")
+        }
+        wait(for: [derivedExpectation], timeout: 5)
+    }
+
     func test_storageServiceEncryption() throws {
         struct Vector: Codable {
             enum VectorType: String, Codable {
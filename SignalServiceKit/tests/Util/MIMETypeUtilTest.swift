@@ -0,0 +1,56 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import MobileCoreServices
+import XCTest
+@testable import SignalServiceKit
+
+class MIMETypeUtilTest: SSKBaseTestSwift {
+
+    func testSupportedTypes() {
+        XCTAssertTrue(MIMETypeUtil.isSupportedImageMIMEType(OWSMimeTypeImageJpeg))
+        XCTAssertTrue(MIMETypeUtil.isSupportedImageMIMEType(OWSMimeTypeImageWebp))
+        XCTAssertFalse(MIMETypeUtil.isSupportedImageMIMEType("video/mp4"))
+        XCTAssertFalse(MIMETypeUtil.isSupportedImageMIMEType(""))
+        XCTAssertTrue(MIMETypeUtil.isSupportedVideoMIMEType("video/mp4"))
+        XCTAssertTrue(MIMETypeUtil.isSupportedAudioMIMEType("audio/x-m4a"))
+
+        XCTAssertTrue(MIMETypeUtil.isSupportedImageFile("/tmp/image.JPG"))
+        XCTAssertTrue(MIMETypeUtil.isSupportedVideoFile("/tmp/video.mov"))
+        XCTAssertFalse(MIMETypeUtil.isSupportedAudioFile("/tmp/document.pdf"))
+
+        XCTAssertEqual("jpeg", MIMETypeUtil.getSupportedExtensionFromImageMIMEType("image/pjpeg"))
+        XCTAssertEqual("m4a", MIMETypeUtil.getSupportedExtensionFromAudioMIMEType("audio/aac"))
+        XCTAssertNil(MIMETypeUtil.getSupportedExtensionFromVideoMIMEType("image/png"))
+    }
+
+    func testGenericTypes() {
+        XCTAssertEqual("application/pdf", MIMETypeUtil.mimeType(forFileExtension: "pdf"))
+        XCTAssertEqual(OWSMimeTypeLottieSticker, MIMETypeUtil.mimeType(forFileExtension: kLottieStickerFileExtension))
+        XCTAssertEqual(OWSMimeTypeApplicationZip, MIMETypeUtil.mimeType(forFileExtension: "zip"))
+        XCTAssertNil(MIMETypeUtil.mimeType(forFileExtension: "not-an-extension"))
+
+        XCTAssertEqual("png", MIMETypeUtil.fileExtension(forMIMEType: OWSMimeTypeImageApng1))
+        XCTAssertEqual("xgz", MIMETypeUtil.fileExtension(forMIMEType: "xgl/drawing"))
+    }
+
+    func testUTITypes() {
+        XCTAssertTrue(MIMETypeUtil.supportedInputImageUTITypes().contains(kUTTypeJPEG as String))
+        XCTAssertFalse(MIMETypeUtil.supportedOutputImageUTITypes().contains("public.heic"))
+        XCTAssertTrue(MIMETypeUtil.supportedVideoUTITypes().contains(kUTTypeMPEG4 as String))
+    }
+
+    func testPerformanceLookup() {
+        let mimeTypes = ["image/jpeg", "image/png", "video/mp4", "audio/aac", "application/pdf", "text/plain"]
+        measure {
+            for _ in 0..<10_000 {
+                for mimeType in mimeTypes {
+                    _ = MIMETypeUtil.isSupportedImageMIMEType(mimeType)
+                    _ = MIMETypeUtil.fileExtension(forMIMEType: mimeType)
+                }
+            }
+        }
+    }
+}
@@ -41,4 +41,44 @@ class NSDataImageTests: SSKBaseTestSwift {
             XCTAssertNil(isApng)
         }
     }
+
+    func testProbeImageHeaders() {
+        let image = UIImage(color: .red, size: CGSize(width: 3, height: 2))
+        let pngData = image.pngData()!
+        let jpegData = image.jpegData(compressionQuality: 0.8)!
+
+        for (data, imageFormat) in [(pngData, ImageFormat.png), (jpegData, ImageFormat.jpeg)] {
+            let fileUrl = OWSFileSystem.temporaryFileUrl()
+            try! data.write(to: fileUrl)
+
+            guard let headerInfo = ImageHeaderProbe.probeImage(atPath: fileUrl.path) else {
+                XCTFail("Could not probe image.")
+                continue
+            }
+            XCTAssertEqual(imageFormat, headerInfo.imageFormat)
+            XCTAssertEqual(CGSize(width: 3, height: 2), headerInfo.pixelSize)
+
+            // The headers should agree with ImageIO.
+            let imageMetadata = (data as NSData).imageMetadata(withPath: nil, mimeType: nil)
+            XCTAssertTrue(imageMetadata.isValid)
+            XCTAssertEqual(imageMetadata.pixelSize, headerInfo.pixelSize)
+            XCTAssertEqual(imageMetadata.hasAlpha, headerInfo.hasAlpha)
+
+            XCTAssertEqual(imageMetadata.pixelSize, NSData.imageSize(forFilePath: fileUrl.path, mimeType: nil))
+        }
+    }
+
+    func testProbeImageHeaders_invalid() {
+        for length in [0, 16, 1024] {
+            let fileUrl = OWSFileSystem.temporaryFileUrl()
+            try! Randomness.generateRandomBytes(Int32(length)).write(to: fileUrl)
+            XCTAssertNil(ImageHeaderProbe.probeImage(atPath: fileUrl.path))
+        }
+
+        // A PNG whose chunks are truncated before the image data.
+        let pngData = UIImage(color: .red, size: CGSize(width: 1, height: 1)).pngData()!
+        let fileUrl = OWSFileSystem.temporaryFileUrl()
+        try! pngData.prefix(40).write(to: fileUrl)
+        XCTAssertNil(ImageHeaderProbe.probeImage(atPath: fileUrl.path))
+    }
 }
@@ -0,0 +1,158 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class ReadWriteLockTest: SSKBaseTestSwift {
+
+    private var dut: ReadWriteLock! = nil
+
+    override func setUp() {
+        dut = ReadWriteLock()
+    }
+
+    // MARK: - Lock + Unlock
+
+    func testWriteLockPreventsDataRace() {
+        // Setup
+        var sharedVal = 0
+
+        // Test
+        fanout(1000) {
+            self.dut.withWriteLock {
+                sharedVal += 1
+            }
+        }
+
+        // Verify
+        XCTAssertEqual(sharedVal, 1000, "Lock failed to prevent data race.")
+    }
+
+    func testReadersAndWriters() {
+        // Setup
+        var sharedVal = 0
+
+        // Test
+        fanout(1000) {
+            let observedVal = self.dut.withReadLock {
+                return sharedVal
+            }
+            XCTAssertGreaterThanOrEqual(observedVal, 0)
+            self.dut.withWriteLock {
+                sharedVal += 1
+            }
+        }
+
+        // Verify
+        XCTAssertEqual(sharedVal, 1000, "Lock failed to prevent data race.")
+    }
+
+    // MARK: - Lock attempts
+
+    func testReadersShareLock() {
+        // Setup
+        dut.readLock()
+
+        // Test
+        let didReadLockInner = dut.tryReadLock()
+        if didReadLockInner {
+            dut.unlock()
+        }
+        let didWriteLockInner = dut.tryWriteLock()
+        if didWriteLockInner {
+            dut.unlock()
+        }
+        dut.unlock()
+
+        // Verify
+        XCTAssertTrue(didReadLockInner, "tryReadLock() failed to share a read lock.")
+        XCTAssertFalse(didWriteLockInner, "tryWriteLock() acquired a lock held by a reader.")
+    }
+
+    func testWriterExcludesReaders() {
+        // Setup
+        let didLockOuter = dut.tryWriteLock()
+        var didLockInner = false
+
+        // Test
+        fanout(1000) {
+            if self.dut.tryReadLock() {
+                didLockInner = true
+                self.dut.unlock()
+            }
+        }
+        dut.unlock()
+
+        // Verify
+        XCTAssertTrue(didLockOuter, "Failed to acquire the uncontended lock.")
+        XCTAssertFalse(didLockInner, "tryReadLock() acquired a lock held by a writer.")
+    }
+
+    func testPropagatedReturnValue() {
+        // Setup
+        let outerVal: String? = "Hello, this is an optional string"
+
+        // Test
+        let returnedVal = dut.withReadLock {
+            return outerVal?.appending("!")
+        }
+
+        // Expect
+        XCTAssertEqual(returnedVal, "Hello, this is an optional string!")
+    }
+
+    // MARK: - Throwing Inner Closure
+
+    func testThrowingLockedClosure() {
+        // Setup
+        var didCatchError = false
+        var didReacquireLock = false
+
+        // Test
+        let toThrow = NSError(domain: "ReadWriteLockTests", code: 2, userInfo: nil)
+        do {
+            try dut.withWriteLock {
+                throw toThrow
+            }
+        } catch {
+            XCTAssertEqual(toThrow, (error as NSError))
+            didCatchError = true
+        }
+
+        didReacquireLock = dut.tryWriteLock()
+        if didReacquireLock {
+            dut.unlock()
+        }
+
+        // Verify
+        XCTAssertTrue(didCatchError)
+        XCTAssertTrue(didReacquireLock)
+    }
+
+    // MARK: - AtomicSnapshot
+
+    func testAtomicSnapshotUpdate() {
+        // Setup
+        let snapshot = AtomicSnapshot<[Int]>([])
+
+        // Test
+        fanout(1000) {
+            XCTAssertLessThanOrEqual(snapshot.get().count, 1000)
+            snapshot.update { $0 + [1] }
+        }
+
+        // Verify
+        XCTAssertEqual(snapshot.get().count, 1000, "Snapshot lost an update.")
+    }
+
+    // MARK: - Test Helpers
+
+    func fanout(_ iterations: Int, _ block: () -> Void) {
+        DispatchQueue.concurrentPerform(iterations: iterations) { (_) in block() }
+    }
+
+}
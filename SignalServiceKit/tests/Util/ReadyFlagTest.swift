@@ -0,0 +1,34 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class ReadyFlagTest: SSKBaseTestSwift {
+
+    func testBlockOrder() {
+        let readyFlag = ReadyFlag(name: "ReadyFlagTest", queueMode: .mainThreadOnly)
+        var events = [String]()
+        let expectation = self.expectation(description: "Idle blocks performed")
+
+        readyFlag.runNowOrWhenDidBecomeReadyIdle({ events.append("idle1") }, label: "idle1")
+        readyFlag.runNowOrWhenDidBecomeReadyPolite({ events.append("polite") }, label: "polite")
+        readyFlag.runNowOrWhenDidBecomeReady({ events.append("did") }, label: "did")
+        readyFlag.runNowOrWhenWillBecomeReady({ events.append("will") }, label: "will")
+
+        readyFlag.setIsReady()
+        XCTAssertEqual(events, ["will", "did"])
+
+        // Idle blocks enqueued after the flag is set are still deferred.
+        readyFlag.runNowOrWhenDidBecomeReadyIdle({
+            events.append("idle2")
+            expectation.fulfill()
+        }, label: "idle2")
+        XCTAssertEqual(events, ["will", "did"])
+
+        waitForExpectations(timeout: 5)
+        XCTAssertEqual(events, ["will", "did", "polite", "idle1", "idle2"])
+    }
+}
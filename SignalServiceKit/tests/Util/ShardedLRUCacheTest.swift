@@ -0,0 +1,93 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class ShardedLRUCacheTest: SSKBaseTestSwift {
+
+    func testSetGetRemove() {
+        let cache = ShardedLRUCache<String, Int>(maxSize: 16)
+        cache.set(key: "a", value: 1)
+        cache.set(key: "b", value: 2)
+        XCTAssertEqual(1, cache.get(key: "a"))
+        XCTAssertEqual(2, cache.get(key: "b"))
+        XCTAssertNil(cache.get(key: "c"))
+
+        cache.set(key: "a", value: 3)
+        XCTAssertEqual(3, cache.get(key: "a"))
+
+        cache.update(key: "b") { ($0 ?? 0) + 10 }
+        XCTAssertEqual(12, cache.get(key: "b"))
+        cache.update(key: "b") { _ in nil }
+        XCTAssertNil(cache.get(key: "b"))
+
+        cache.remove(key: "a")
+        XCTAssertNil(cache.get(key: "a"))
+
+        cache.set(key: "a", value: 1)
+        cache.clear()
+        XCTAssertNil(cache.get(key: "a"))
+    }
+
+    func testSecondChance() {
+        let cache = ShardedLRUCache<Int, Int>(maxSize: 3, shardCount: 1)
+        cache.set(key: 1, value: 1)
+        cache.set(key: 2, value: 2)
+        cache.set(key: 3, value: 3)
+
+        // 1 was referenced, so 2 is evicted instead.
+        _ = cache.get(key: 1)
+        cache.set(key: 4, value: 4)
+        XCTAssertEqual(1, cache.get(key: 1))
+        XCTAssertNil(cache.get(key: 2))
+        XCTAssertEqual(3, cache.get(key: 3))
+        XCTAssertEqual(4, cache.get(key: 4))
+    }
+
+    func testBounded() {
+        let cache = ShardedLRUCache<Int, Int>(maxSize: 64, shardCount: 4)
+        for index in 0..<1000 {
+            cache.set(key: index, value: index)
+        }
+        let count = (0..<1000).filter { cache.get(key: $0) != nil }.count
+        XCTAssertGreaterThan(count, 0)
+        XCTAssertLessThanOrEqual(count, 64)
+    }
+
+    func testBoundedByCost() {
+        let cache = ShardedLRUCache<Int, Int>(maxSize: 16, shardCount: 1, maxCost: 10) { $0 }
+        cache.set(key: 1, value: 4)
+        cache.set(key: 2, value: 4)
+        cache.set(key: 3, value: 4)
+        XCTAssertNil(cache.get(key: 1))
+        XCTAssertEqual(4, cache.get(key: 2))
+        XCTAssertEqual(4, cache.get(key: 3))
+
+        // An entry that alone exceeds the limit evicts everything else.
+        cache.set(key: 4, value: 20)
+        XCTAssertNil(cache.get(key: 2))
+        XCTAssertNil(cache.get(key: 3))
+        XCTAssertEqual(20, cache.get(key: 4))
+
+        // Replacing an entry updates its cost.
+        cache.set(key: 4, value: 2)
+        cache.set(key: 5, value: 8)
+        XCTAssertEqual(2, cache.get(key: 4))
+        XCTAssertEqual(8, cache.get(key: 5))
+    }
+
+    func testConcurrentAccess() {
+        let cache = ShardedLRUCache<Int, Int>(maxSize: 128)
+        DispatchQueue.concurrentPerform(iterations: 1000) { index in
+            cache.set(key: index % 200, value: index)
+            _ = cache.get(key: (index + 7) % 200)
+            if index % 10 == 0 {
+                cache.remove(key: index % 200)
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+import PromiseKit
+@testable import SignalServiceKit
+
+class SingleflightTest: SSKBaseTestSwift {
+
+    func testIdenticalRequestsShareWork() {
+        let singleflight = Singleflight<Int>(label: "test")
+        let (workPromise, workResolver) = Promise<Int>.pending()
+        var workCount = 0
+        let work = { () -> Promise<Int> in
+            workCount += 1
+            return workPromise
+        }
+
+        let promise1 = singleflight.perform(key: "a", work)
+        let promise2 = singleflight.perform(key: "a", work)
+        let promise3 = singleflight.perform(key: "b", work)
+        XCTAssertEqual(2, workCount)
+        XCTAssertEqual(1, singleflight.coalescedCount)
+
+        workResolver.fulfill(7)
+        let expectation = self.expectation(description: "completed")
+        when(fulfilled: promise1, promise2, promise3).done { values in
+            XCTAssertEqual(7, values.0)
+            XCTAssertEqual(7, values.1)
+            XCTAssertEqual(7, values.2)
+            expectation.fulfill()
+        }.catch { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 1.0)
+
+        // Completed work isn't reused.
+        _ = singleflight.perform(key: "a", work)
+        XCTAssertEqual(3, workCount)
+    }
+
+    func testFailuresAreShared() {
+        let singleflight = Singleflight<Int>(label: "test")
+        let (workPromise, workResolver) = Promise<Int>.pending()
+
+        let promise1 = singleflight.perform(key: "a") { workPromise }
+        let promise2 = singleflight.perform(key: "a") { workPromise }
+        workResolver.reject(OWSGenericError("failed"))
+
+        let expectation1 = self.expectation(description: "failed1")
+        let expectation2 = self.expectation(description: "failed2")
+        promise1.catch { _ in expectation1.fulfill() }
+        promise2.catch { _ in expectation2.fulfill() }
+        waitForExpectations(timeout: 1.0)
+    }
+}
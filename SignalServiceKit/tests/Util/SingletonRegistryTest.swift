@@ -0,0 +1,37 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+@testable import SignalServiceKit
+
+class SingletonRegistryTest: SSKBaseTestSwift {
+
+    func testLazySingletonRecordsDependencies() {
+        var constructionCount = 0
+        let lazyDependency = LazySingleton(name: "SingletonRegistryTest.dependency") {
+            constructionCount += 1
+            return NSObject()
+        }
+        let lazySingleton = LazySingleton(name: "SingletonRegistryTest.singleton",
+                                          dependencies: ["SingletonRegistryTest.injected"]) {
+            _ = lazyDependency.get()
+            return NSObject()
+        }
+        XCTAssertFalse(lazySingleton.isConstructed)
+        XCTAssertFalse(lazyDependency.isConstructed)
+
+        let value = lazySingleton.get()
+        XCTAssertTrue(lazySingleton.isConstructed)
+        XCTAssertTrue(lazyDependency.isConstructed)
+        XCTAssertTrue(value === lazySingleton.get())
+        _ = lazyDependency.get()
+        XCTAssertEqual(constructionCount, 1)
+
+        let entries = SingletonRegistry.shared.allEntries.filter { $0.name.hasPrefix("SingletonRegistryTest.") }
+        XCTAssertEqual(entries.map { $0.name }, ["SingletonRegistryTest.dependency", "SingletonRegistryTest.singleton"])
+        XCTAssertEqual(entries.last?.dependencies, ["SingletonRegistryTest.injected", "SingletonRegistryTest.dependency"])
+        XCTAssertTrue(entries.allSatisfy { $0.isLazy })
+    }
+}
@@ -0,0 +1,102 @@
+//
+//  Copyright (c) 2021 Open Whisper Systems. All rights reserved.
+//
+
+import XCTest
+import Foundation
+import PromiseKit
+@testable import SignalServiceKit
+
+class TaskQueueTest: SSKBaseTestSwift {
+
+    func testChainOnOneQueueDispatchesOnce() {
+        let taskQueue = TaskQueue(label: "test")
+
+        let expectation = self.expectation(description: "completed")
+        firstly(on: taskQueue) { () -> Int in
+            XCTAssertTrue(taskQueue.isCurrent)
+            return 1
+        }.map(on: taskQueue) { value in
+            value + 1
+        }.then(on: taskQueue) { value in
+            Promise.value(value * 2)
+        }.done(on: taskQueue) { value in
+            XCTAssertTrue(taskQueue.isCurrent)
+            XCTAssertEqual(4, value)
+            expectation.fulfill()
+        }.catch(on: taskQueue) { error in
+            XCTFail("Error: \(error)")
+        }
+        waitForExpectations(timeout: 1.0)
+
+        // Only the first step was dispatched; the rest ran immediately.
+        XCTAssertEqual(1, taskQueue.dispatchCount.get())
+        XCTAssertFalse(taskQueue.isCurrent)
+    }
+
+    func testCancellationSkipsPendingSteps() {
+        let taskQueue = TaskQueue(label: "test")
+        let cancellation = TaskCancellation()
+        let (promise, resolver) = Promise<Void>.pending()
+
+        var didRunStep = false
+        let chain = promise.done(on: taskQueue, cancellation: cancellation) {
+            didRunStep = true
+        }
+        cancellation.cancel()
+        resolver.fulfill(())
+
+        let expectation = self.expectation(description: "cancelled")
+        chain.done {
+            XCTFail("Chain should be cancelled.")
+        }.catch(policy: .allErrors) { error in
+            XCTAssertTrue(error.isCancelled)
+            expectation.fulfill()
+        }
+        waitForExpectations(timeout: 1.0)
+        XCTAssertFalse(didRunStep)
+    }
+
+    func testCancellationPropagatesToChildren() {
+        let parent = TaskCancellation()
+        let child = parent.makeChild()
+        let grandchild = child.makeChild()
+
+        grandchild.cancel()
+        XCTAssertTrue(grandchild.isCancelled)
+        XCTAssertFalse(child.isCancelled)
+        XCTAssertFalse(parent.isCancelled)
+
+        let otherChild = parent.makeChild()
+        parent.cancel()
+        XCTAssertTrue(parent.isCancelled)
+        XCTAssertTrue(child.isCancelled)
+        XCTAssertTrue(otherChild.isCancelled)
+
+        // Children of a cancelled parent start out cancelled.
+        XCTAssertTrue(parent.makeChild().isCancelled)
+    }
+
+    func testBoundedConcurrencyRunsTasksAfterFailure() {
+        let startedCount = AtomicUInt(0)
+        let failingTask = { () -> Promise<Void> in
+            startedCount.increment()
+            return Promise(error: OWSGenericError("failed"))
+        }
+        let task = { () -> Promise<Void> in
+            startedCount.increment()
+            return Promise.value(())
+        }
+
+        let expectation = self.expectation(description: "failed")
+        MessageSender.performWithBoundedConcurrency([failingTask, task, task, task],
+                                                    maxConcurrency: 1).done {
+            XCTFail("Tasks should fail.")
+        }.catch { _ in
+            expectation.fulfill()
+        }
+        waitForExpectations(timeout: 1.0)
+        // The failure is only reported once every task has run.
+        XCTAssertEqual(4, startedCount.get())
+    }
+}
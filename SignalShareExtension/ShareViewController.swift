@@ -23,7 +23,6 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
     private var isReadyForAppExtensions = false
     private var areVersionMigrationsComplete = false
 
-    private var progressPoller: ProgressPoller?
     var loadViewController: SAELoadViewController?
 
     private var shareViewNavigationController: OWSNavigationController?
@@ -515,41 +514,49 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
     }
 
     private func buildAttachmentsAndPresentConversationPicker() {
-        firstly { () -> Promise<[UnloadedItem]> in
+        let unloadedItems: [UnloadedItem]
+        do {
             guard let inputItems = self.extensionContext?.inputItems as? [NSExtensionItem] else {
                 throw OWSAssertionError("no input item")
             }
-            let result = try itemsToLoad(inputItems: inputItems)
-            return Promise.value(result)
-        }.then { [weak self] (unloadedItems: [UnloadedItem]) -> Promise<[LoadedItem]> in
-            guard let self = self else { throw PMKError.cancelled }
+            unloadedItems = try itemsToLoad(inputItems: inputItems)
+        } catch {
+            return showBuildAttachmentsFailure(error: error)
+        }
 
-            return self.loadItems(unloadedItems: unloadedItems)
+        // Show the picker immediately, and import the shared items while the user
+        // picks conversations. The picker waits for the import if need be.
+        let attachmentsPromise = firstly { () -> Promise<[LoadedItem]> in
+            self.loadItems(unloadedItems: unloadedItems)
         }.then { [weak self] (loadedItems: [LoadedItem]) -> Promise<[SignalAttachment]> in
             guard let self = self else { throw PMKError.cancelled }
 
             return self.buildAttachments(loadedItems: loadedItems)
-        }.done { [weak self] (attachments: [SignalAttachment]) in
-            guard let self = self else { throw PMKError.cancelled }
+        }
+
+        self.loadViewController = nil
 
-            self.progressPoller = nil
-            self.loadViewController = nil
+        let conversationPicker = SharingThreadPickerViewController(attachmentsPromise: attachmentsPromise, shareViewDelegate: self)
+        self.showPrimaryViewController(conversationPicker)
 
-            let conversationPicker = SharingThreadPickerViewController(attachments: attachments, shareViewDelegate: self)
-            self.showPrimaryViewController(conversationPicker)
-            Logger.info("showing picker with attachments: \(attachments)")
+        attachmentsPromise.done { (attachments: [SignalAttachment]) in
+            Logger.info("built attachments: \(attachments)")
         }.catch { [weak self] error in
-            guard let self = self else { return }
-
-            let alertTitle = NSLocalizedString("SHARE_EXTENSION_UNABLE_TO_BUILD_ATTACHMENT_ALERT_TITLE",
-                                               comment: "Shown when trying to share content to a Signal user for the share extension. Followed by failure details.")
-            OWSActionSheets.showActionSheet(title: alertTitle,
-                                message: error.localizedDescription,
-                                buttonTitle: CommonStrings.cancelButton) { _ in
-                                    self.shareViewWasCancelled()
-            }
-            owsFailDebug("building attachment failed with error: \(error)")
+            self?.showBuildAttachmentsFailure(error: error)
+        }
+    }
+
+    private func showBuildAttachmentsFailure(error: Error) {
+        AssertIsOnMainThread()
+
+        let alertTitle = NSLocalizedString("SHARE_EXTENSION_UNABLE_TO_BUILD_ATTACHMENT_ALERT_TITLE",
+                                           comment: "Shown when trying to share content to a Signal user for the share extension. Followed by failure details.")
+        OWSActionSheets.showActionSheet(title: alertTitle,
+                            message: error.localizedDescription,
+                            buttonTitle: CommonStrings.cancelButton) { _ in
+                                self.shareViewWasCancelled()
         }
+        owsFailDebug("building attachment failed with error: \(error)")
     }
 
     private func presentScreenLock() {
@@ -774,9 +781,15 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
                            payload: .text(text))
             }
         case .pdf:
-            return itemProvider.loadData(forTypeIdentifier: kUTTypePDF as String, options: nil).map { data in
+            // Prefer a URL, so that we needn't read the whole document into memory.
+            return itemProvider.loadUrl(forTypeIdentifier: kUTTypePDF as String, options: nil).map { fileUrl in
                 LoadedItem(itemProvider: unloadedItem.itemProvider,
-                           payload: .pdf(data))
+                           payload: .fileUrl(fileUrl))
+            }.recover(on: .global()) { _ -> Promise<LoadedItem> in
+                return itemProvider.loadData(forTypeIdentifier: kUTTypePDF as String, options: nil).map { data in
+                    LoadedItem(itemProvider: unloadedItem.itemProvider,
+                               payload: .pdf(data))
+                }
             }
         case .other:
             return itemProvider.loadUrl(forTypeIdentifier: kUTTypeFileURL as String, options: nil).map { fileUrl in
@@ -787,10 +800,18 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
     }
 
     private func buildAttachments(loadedItems: [LoadedItem]) -> Promise<[SignalAttachment]> {
-        let attachmentPromises = loadedItems.map {
-            buildAttachment(loadedItem: $0)
+        // Build the attachments one at a time, so that we only ever hold one
+        // large image or video transcode in memory.
+        var attachments = [SignalAttachment]()
+        var promise = Promise.value(())
+        for loadedItem in loadedItems {
+            promise = promise.then { () -> Promise<Void> in
+                self.buildAttachment(loadedItem: loadedItem).done { attachment in
+                    attachments.append(attachment)
+                }
+            }
         }
-        return when(fulfilled: attachmentPromises)
+        return promise.map { attachments }
     }
 
     private func buildAttachment(loadedItem: LoadedItem) -> Promise<SignalAttachment> {
@@ -822,7 +843,7 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
                 return Promise(error: error)
             }
 
-            guard let dataSource = try? DataSourcePath.dataSource(with: url, shouldDeleteOnDeallocation: false) else {
+            guard let dataSource = try? DataSourceMappedPath.dataSource(with: url, shouldDeleteOnDeallocation: false) else {
                 let error = ShareViewControllerError.assertionError(description: "Unable to read attachment data")
                 return Promise(error: error)
             }
@@ -832,25 +853,9 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
             guard !SignalAttachment.isVideoThatNeedsCompression(dataSource: dataSource, dataUTI: utiType) else {
                 // This can happen, e.g. when sharing a quicktime-video from iCloud drive.
 
-                let (promise, exportSession) = SignalAttachment.compressVideoAsMp4(dataSource: dataSource, dataUTI: utiType)
-
-                // TODO: How can we move waiting for this export to the end of the share flow rather than having to do it up front?
-                // Ideally we'd be able to start it here, and not block the UI on conversion unless there's still work to be done
-                // when the user hits "send".
-                if let exportSession = exportSession {
-                    let progressPoller = ProgressPoller(timeInterval: 0.1, ratioCompleteBlock: { return exportSession.progress })
-                    AssertIsOnMainThread()
-                    self.progressPoller = progressPoller
-                    progressPoller.startPolling()
-
-                    guard let loadViewController = self.loadViewController else {
-                        owsFailDebug("load view controller was unexpectedly nil")
-                        return promise
-                    }
-
-                    loadViewController.progress = progressPoller.progress
-                }
-
+                // The picker is shown while we transcode, so this only blocks the UI if
+                // the user approves the share before the export completes.
+                let (promise, _) = SignalAttachment.compressVideoAsMp4(dataSource: dataSource, dataUTI: utiType)
                 return promise
             }
 
@@ -918,46 +923,3 @@ extension ShareViewController: UIAdaptivePresentationControllerDelegate {
         shareViewWasCancelled()
     }
 }
-
-// Exposes a Progress object, whose progress is updated by polling the return of a given block
-private class ProgressPoller: NSObject {
-
-    let progress: Progress
-    private(set) var timer: Timer?
-
-    // Higher number offers higher ganularity
-    let progressTotalUnitCount: Int64 = 10000
-    private let timeInterval: Double
-    private let ratioCompleteBlock: () -> Float
-
-    init(timeInterval: TimeInterval, ratioCompleteBlock: @escaping () -> Float) {
-        self.timeInterval = timeInterval
-        self.ratioCompleteBlock = ratioCompleteBlock
-
-        self.progress = Progress()
-
-        progress.totalUnitCount = progressTotalUnitCount
-        progress.completedUnitCount = Int64(ratioCompleteBlock() * Float(progressTotalUnitCount))
-    }
-
-    func startPolling() {
-        guard self.timer == nil else {
-            owsFailDebug("already started timer")
-            return
-        }
-
-        self.timer = WeakTimer.scheduledTimer(timeInterval: timeInterval, target: self, userInfo: nil, repeats: true) { [weak self] (timer) in
-            guard let strongSelf = self else {
-                return
-            }
-
-            let completedUnitCount = Int64(strongSelf.ratioCompleteBlock() * Float(strongSelf.progressTotalUnitCount))
-            strongSelf.progress.completedUnitCount = completedUnitCount
-
-            if completedUnitCount == strongSelf.progressTotalUnitCount {
-                Logger.debug("progress complete")
-                timer.invalidate()
-            }
-        }
-    }
-}
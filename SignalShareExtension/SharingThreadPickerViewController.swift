@@ -11,17 +11,19 @@ class SharingThreadPickerViewController: ConversationPickerViewController {
 
     weak var shareViewDelegate: ShareViewDelegate?
 
-    let attachments: [SignalAttachment]
+    // The picker is shown while the shared items are still being imported.
+    let attachmentsPromise: Promise<[SignalAttachment]>
+    private var attachments: [SignalAttachment]?
 
-    lazy var isTextMessage: Bool = {
-        guard attachments.count == 1, let attachment = attachments.first else { return false }
+    var isTextMessage: Bool {
+        guard let attachments = attachments, attachments.count == 1, let attachment = attachments.first else { return false }
         return attachment.isConvertibleToTextMessage && attachment.dataLength < kOversizeTextMessageSizeThreshold
-    }()
+    }
 
-    lazy var isContactShare: Bool = {
-        guard attachments.count == 1, let attachment = attachments.first else { return false }
+    var isContactShare: Bool {
+        guard let attachments = attachments, attachments.count == 1, let attachment = attachments.first else { return false }
         return attachment.isConvertibleToContactShare
-    }()
+    }
 
     var approvedAttachments: [SignalAttachment]?
     var approvedContactShare: ContactShareViewModel?
@@ -35,11 +37,15 @@ class SharingThreadPickerViewController: ConversationPickerViewController {
     var selectedConversations: [ConversationItem] = []
 
     @objc
-    public init(attachments: [SignalAttachment], shareViewDelegate: ShareViewDelegate) {
-        self.attachments = attachments
+    public init(attachmentsPromise: Promise<[SignalAttachment]>, shareViewDelegate: ShareViewDelegate) {
+        self.attachmentsPromise = attachmentsPromise
         self.shareViewDelegate = shareViewDelegate
         super.init()
         delegate = self
+
+        attachmentsPromise.done { [weak self] attachments in
+            self?.attachments = attachments
+        }.cauterize()
     }
 }
 
@@ -48,6 +54,27 @@ class SharingThreadPickerViewController: ConversationPickerViewController {
 extension SharingThreadPickerViewController {
 
     func approve() {
+        guard attachments == nil else {
+            showApprovalUIOrFail()
+            return
+        }
+
+        // Wait for the import to finish. If it fails, the share view
+        // controller reports the error.
+        ModalActivityIndicatorViewController.present(fromViewController: self, canCancel: true) { [weak self] modal in
+            guard let self = self else { return }
+            self.attachmentsPromise.done { _ in
+                guard !modal.wasCancelled else { return }
+                modal.dismiss {
+                    self.showApprovalUIOrFail()
+                }
+            }.catch { _ in
+                modal.dismiss {}
+            }
+        }
+    }
+
+    private func showApprovalUIOrFail() {
         do {
             try showApprovalUI()
         } catch {
@@ -56,7 +83,7 @@ extension SharingThreadPickerViewController {
     }
 
     func showApprovalUI() throws {
-        guard let firstAttachment = attachments.first else {
+        guard let attachments = attachments, let firstAttachment = attachments.first else {
             throw OWSAssertionError("Unexpectedly missing attachments")
         }
         guard let navigationController = navigationController else {